@@ -15,7 +15,14 @@
         fprintf(stderr, "(%s:%d) " FMT "\n", __func__, __LINE__, ##__VA_ARGS__); \
     } while (0)
 
+// CONVERTERS_QUIET drops the per character trace, benchmarks build with it.
+#ifdef CONVERTERS_QUIET
+#define PRINT_DEBUG(FMT, ...) \
+    do {                      \
+    } while (0)
+#else
 #define PRINT_DEBUG(FMT, ...) LOG(LOG_DEBUG, FMT, ##__VA_ARGS__)
+#endif
 #define PRINT_ERROR(FMT, ...) LOG(LOG_ERR, FMT, ##__VA_ARGS__)
 
 #ifndef __is_print
@@ -221,12 +228,37 @@ size_t unicode_loop_convert(conv_t cd, const uint8_t **inbuf, size_t *inbyteslef
     return result;
 }
 
+size_t gbk2utf8_iconv(const uint8_t *in, size_t inlen, uint8_t *out, size_t outlen) {
+    iconv_t conv = {
+        .ifuncs = ces_gbk_mbtowc,
+        .ofuncs = utf8_wctomb,
+    };
+    const uint8_t *pin = in;
+    uint8_t *pout = out;
+    size_t ileft = inlen;
+    size_t oleft = outlen;
+
+    if (unicode_loop_convert(&conv, &pin, &ileft, &pout, &oleft) == (size_t)-1) {
+        return (size_t)-1;
+    }
+    return outlen - oleft;
+}
+
+// CONVERTERS_NO_MAIN links the converters into another program, e.g. src/bench.
+#ifndef CONVERTERS_NO_MAIN
 int32_t main(int32_t argc, char *argv[]) {
     iconv_t conv = {
         .ifuncs = gbk_mbtowc,
         .ofuncs = utf8_wctomb,
     };
 
+#ifndef GBK_NO_FLAT_TABLE
+    if (!gbk_mbtowc_tab_selftest()) {
+        PRINT_ERROR("gbk_mbtowc table selftest failed!");
+        return 1;
+    }
+#endif
+
     uint8_t gbk[] = {0xCE, 0xD2, 0xCA, 0xC7, 0xD6, 0xD0, 0xB9, 0xFA, 0xC8, 0xCB, 0x00, 0x00};
     // uint8_t gbk[] = {0xE6, 0x88, 0x91, 0xE6, 0x98, 0xAF, 0xE4, 0xB8, 0xAD, 0xE5, 0x9B, 0xBD, 0xE4, 0xBA, 0xBA, 0x00, 0x00, 0x00};
     uint8_t utf[100] = {0};
@@ -240,4 +272,5 @@ int32_t main(int32_t argc, char *argv[]) {
     print_hex(utf, sizeof(utf));
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
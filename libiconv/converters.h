@@ -19,6 +19,15 @@
 
 /* This file defines all the converters. */
 
+/*
+ * gbk to utf8 through unicode_loop_convert() with ces_gbk_mbtowc and utf8_wctomb, defined in
+ * converters.c. Returns the output length, (size_t)-1 on invalid input or a short out.
+ */
+size_t gbk2utf8_iconv(const uint8_t *in, size_t inlen, uint8_t *out, size_t outlen);
+
+/* CONVERTERS_API_ONLY stops here, for programs linking converters.c built with CONVERTERS_NO_MAIN. */
+#ifndef CONVERTERS_API_ONLY
+
 /* Our own notion of wide character, as UCS-4, according to ISO-10646-1. */
 typedef uint32_t ucs4_t;
 
@@ -81,3 +90,5 @@ typedef struct {
 #include "ces_gbk.h"
 #include "cp936.h"
 #include "gb18030.h"
+
+#endif
@@ -59,7 +59,13 @@
 #include "gbkext2.h"
 #include "gbkext_inv.h"
 
-int32_t gbk_mbtowc(conv_t conv, ucs4_t *pwc, const uint8_t *s, size_t n) {
+/*
+ * Reference decoder: GB2312, then CP936 extensions, then GBK/3, GBK/4 and GBK/5 plus the special
+ * cases above. A character can pay for several failed lookups here, gbk_mbtowc() below answers
+ * from the table gen_gbk2uni_tab --layout=mbtowc derives from it, unless GBK_NO_FLAT_TABLE is
+ * defined (the generator itself is built that way).
+ */
+static int32_t gbk_chain_mbtowc(conv_t conv, ucs4_t *pwc, const uint8_t *s, size_t n) {
     uint8_t c = *s;
 
     if (c >= 0x81 && c < 0xff) {
@@ -107,6 +113,46 @@ int32_t gbk_mbtowc(conv_t conv, ucs4_t *pwc, const uint8_t *s, size_t n) {
     return RET_ILSEQ;
 }
 
+/*
+ * Decoder over a table in the mbtowc layout: one row of GBK_TAB_COLS entries per lead byte
+ * 0x81..0xFE, indexed by the trail byte from GBK_TAB_TRAIL_MIN, 0 where the chain rejects the
+ * code (no GBK code decodes to U+0000). The generator checks it against the chain for every
+ * input before emitting the table.
+ */
+#define GBK_TAB_LEAD_MIN 0x81
+#define GBK_TAB_TRAIL_MIN 0x40
+#define GBK_TAB_COLS (0x100 - GBK_TAB_TRAIL_MIN)
+
+static inline int32_t gbk_tab_mbtowc(const uint16_t *tab, ucs4_t *pwc, const uint8_t *s, size_t n) {
+    uint8_t c = *s;
+    uint16_t wc;
+
+    if (c >= 0x81 && c < 0xff) {
+        if (n < 2)
+            return RET_TOOFEW(0);
+        if (s[1] >= GBK_TAB_TRAIL_MIN) {
+            wc = tab[(c - GBK_TAB_LEAD_MIN) * GBK_TAB_COLS + (s[1] - GBK_TAB_TRAIL_MIN)];
+            if (wc != 0) {
+                *pwc = wc;
+                return 2;
+            }
+        }
+    }
+    return RET_ILSEQ;
+}
+
+#ifndef GBK_NO_FLAT_TABLE
+#include "gbk_mbtowc_tab.h"
+
+int32_t gbk_mbtowc(conv_t conv, ucs4_t *pwc, const uint8_t *s, size_t n) {
+    return gbk_tab_mbtowc(GBK_MBTOWC_TABLE, pwc, s, n);
+}
+#else
+int32_t gbk_mbtowc(conv_t conv, ucs4_t *pwc, const uint8_t *s, size_t n) {
+    return gbk_chain_mbtowc(conv, pwc, s, n);
+}
+#endif
+
 int32_t gbk_wctomb(conv_t conv, uint8_t *r, ucs4_t wc, size_t n) {
     uint8_t buf[2];
     int32_t ret;
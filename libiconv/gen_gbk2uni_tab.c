@@ -1,184 +1,659 @@
-#include <ctype.h>
-#include <errno.h>
-#include <limits.h>
-#include <stdbool.h>
-#include <stdint.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <unistd.h>
-
-#include "converters.h"
-
-#define LOG(LEVEL, FMT, ...)                                                     \
-    do {                                                                         \
-        fprintf(stderr, "(%s:%d) " FMT "\n", __func__, __LINE__, ##__VA_ARGS__); \
-    } while (0)
-
-#define PRINT_DEBUG(FMT, ...) LOG(LOG_DEBUG, FMT, ##__VA_ARGS__)
-#define PRINT_ERROR(FMT, ...) LOG(LOG_ERR, FMT, ##__VA_ARGS__)
-
-#define _s(x) ((uint16_t)(x))
-#define merge_b16b(h, l) ((_s(l) << 8) | _s(h))
-#define merge_b16l(h, l) ((_s(h) << 8) | _s(l))
-
-#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-#define swap_b16(x) (((_s(x) & 0x00ff) << 8) | ((_s(x) & 0xff00) >> 8))
-#define merge_b16 merge_b16l
-#else
-#define swap_b16(_x) (_x)
-#define merge_b16 merge_b16b
-#endif
-
-int32_t main(int32_t argc, char *argv[]) {
-    uint16_t gbkc = 0;
-    uint16_t gbkl = 0;
-    uint16_t gbkh = 0;
-    ucs4_t wc = 0;
-    int32_t ret = 0;
-
-#if 0 // test big-little endian
-    gbkl = 0xD2;
-    gbkh = 0x04;
-    gbkc = merge_b16l(gbkh, gbkl);
-    // OUTPUT: 0x04D2, 0x04D2, 0x04D2, 0x04D2
-    printf("0x%02X%02X, 0x%04X, 0x%04X, 0x%04X\n", gbkh, gbkl, gbkc, __BYTE_ORDER__, __ORDER_LITTLE_ENDIAN__);
-    gbkc = merge_b16b(gbkh, gbkl);
-    // OUTPUT: 0x04D2, 0xD204, 0x04D2, 0x04D2
-    printf("0x%02X%02X, 0x%04X, 0x%04X, 0x%04X\n", gbkh, gbkl, gbkc, __BYTE_ORDER__, __ORDER_LITTLE_ENDIAN__);
-
-    gbkl = 0xCE;
-    gbkh = 0xD2;
-    gbkc = merge_b16l(gbkh, gbkl);
-    ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-    // OUTPUT: 0xD2CE, 0xD2CE, 0x6211
-    printf("0x%02X%02X, 0x%04X, 0x%04X\n", gbkh, gbkl, gbkc, wc);
-    gbkc = merge_b16b(gbkh, gbkl);
-    ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-    // OUTPUT: 0xD2CE, 0xCED2, 0x6905
-    printf("0x%02X%02X, 0x%04X, 0x%04X\n", gbkh, gbkl, gbkc, wc);
-
-    uint8_t *ptr = (uint8_t *)&gbkc;
-    ptr[0] = 0xCE;
-    ptr[1] = 0xD2;
-    ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-    // OUTPUT: 0xCED2, 0xD2CE, 0x6211
-    printf("0x%02X%02X, 0x%04X, 0x%04X\n", ptr[0], ptr[1], gbkc, wc);
-#elif 0
-    for (gbkh = 0; gbkh <= 0xff; gbkh++) {
-        for (gbkl = 0; gbkl <= 0xff; gbkl++) {
-            gbkc = merge_b16(gbkh, gbkl);
-            ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-            if (ret > 0) {
-                printf("0x%02X%02X, 0x%04X, 0x%04X\n", gbkh, gbkl, gbkc, wc);
-            } else {
-                printf("0x%02X%02X, 0x%04X, %d\n", gbkh, gbkl, gbkc, ret);
-            }
-        }
-    }
-#elif 0
-    uint32_t line = 0;
-    printf("#ifndef __GBK2UNICODE_TABLE_H__\n");
-    printf("#define __GBK2UNICODE_TABLE_H__\n\n");
-    printf("static const uint16_t GBK2UNICODE_TABLE[] = {\n\t");
-    for (gbkh = 0; gbkh <= 0xff; gbkh++) {
-        for (gbkl = 0; gbkl <= 0xff; gbkl++) {
-            gbkc = merge_b16(gbkh, gbkl);
-            ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-            if (ret <= 0) {
-                wc = 0;
-            }
-
-            printf("0x%04X, ", wc);
-            if (((++line) % 16) == 0) {
-                printf("\n\t");
-            }
-        }
-    }
-    printf("};\n\n");
-    printf("#define GBK2UNICODE_TABLE_SIZE (sizeof(GBK2UNICODE_TABLE) / sizeof(uint16_t))\n\n");
-    printf("#endif\n\n");
-#elif 0
-    uint32_t start = 0;
-    uint32_t line = 0;
-    printf("#ifndef __GBK2UNICODE_TABLE_H__\n");
-    printf("#define __GBK2UNICODE_TABLE_H__\n\n");
-    printf("static const uint16_t GBK2UNICODE_TABLE[] = {\n\t");
-    for (gbkh = 0; gbkh <= 0xff; gbkh++) {
-        for (gbkl = 0; gbkl <= 0xff; gbkl++) {
-            gbkc = merge_b16(gbkh, gbkl);
-            ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-            if (ret > 0) {
-                if (start == 0) {
-                    start = gbkc;
-                }
-            } else {
-                wc = 0;
-            }
-            if (start) {
-                printf("0x%04X, ", wc);
-                if (((++line) % 16) == 0) {
-                    printf("\n\t");
-                }
-            }
-        }
-    }
-    printf("};\n\n");
-    printf("#define GBK2UNICODE_TABLE_SIZE (sizeof(GBK2UNICODE_TABLE) / sizeof(uint16_t))\n");
-    printf("#define GBK2UNICODE_TABLE_START 0x%04X\n\n", start);
-    printf("#endif\n\n");
-#else
-#define GBKH_MIN 0x81
-#define GBKH_MAX 0xFE
-#define GBKL_MIN 0x40
-#define GBKL_MAX 0xFE
-// #define GBK2UNI_TABLE_SIZE merge_b16b((GBKH_MAX - GBKH_MIN + 1), (GBKL_MAX - GBKL_MIN + 1))
-#define GBK2UNI_TABLE_OFFSET ((GBKL_MAX - GBKL_MIN) + 2)
-#define GBK2UNI_TABLE_SIZE ((GBKH_MAX - GBKH_MIN) * (GBK2UNI_TABLE_OFFSET) + GBK2UNI_TABLE_OFFSET)
-    uint32_t line = 0;
-    uint32_t gbki = 0;
-    uint16_t GBK2UNI_TABLE[GBK2UNI_TABLE_SIZE] = {0};
-    memset(GBK2UNI_TABLE, 0xFF, sizeof(GBK2UNI_TABLE));
-
-    PRINT_DEBUG("GBK2UNI_TABLE_SIZE: %u", GBK2UNI_TABLE_SIZE);
-
-    for (gbkl = GBKL_MIN; gbkl <= GBKL_MAX; gbkl++) {
-        for (gbkh = GBKH_MIN; gbkh <= GBKH_MAX; gbkh++) {
-            gbkc = merge_b16b(gbkh, gbkl);
-            // gbki = merge_b16b((gbkh - GBKH_MIN), (gbkl - GBKL_MIN));
-            gbki = (gbkh - GBKH_MIN) * GBK2UNI_TABLE_OFFSET + (gbkl - GBKL_MIN);
-
-            if (GBK2UNI_TABLE[gbki] != 0xFFFF) {
-                PRINT_ERROR(
-                    "gbkh: 0x%02X, gbkl: 0x%02X, gbki: 0x%04X, gbkc: 0x%04X, wc: 0x%04X, table: 0x%04X conflict!!!",
-                    gbkh, gbkl, gbki, gbkc, wc, GBK2UNI_TABLE[gbki]);
-                return -1;
-            }
-
-            ret = gbk_mbtowc(NULL, &wc, &gbkc, sizeof(gbkc));
-            if (ret <= 0) {
-                wc = 0;
-            }
-            PRINT_DEBUG("gbkh: 0x%02X, gbkl: 0x%02X, gbki: 0x%04X, gbkc: 0x%04X, wc: 0x%04X", gbkh, gbkl, gbki, gbkc,
-                        wc);
-            GBK2UNI_TABLE[gbki] = wc;
-        }
-    }
-
-    printf("#ifndef __GBK2UNICODE_TABLE_H__\n");
-    printf("#define __GBK2UNICODE_TABLE_H__\n\n");
-    printf("static const uint16_t GBK2UNI_TABLE[] = {\n\t");
-    for (gbki = 0; gbki < GBK2UNI_TABLE_SIZE; gbki++) {
-        gbkc = GBK2UNI_TABLE[gbki];
-        gbkc = (((gbkc == 0xFFFF) || (gbkc == 0x0000)) ? 0x0001 : gbkc);
-        printf("0x%04X, ", gbkc);
-        if (((++line) % 16) == 0) {
-            printf("\n\t");
-        }
-    }
-    printf("};\n\n");
-    printf("#define GBK2UNI_TABLE_SIZE (sizeof(GBK2UNI_TABLE) / sizeof(uint16_t)) // %u\n", GBK2UNI_TABLE_SIZE);
-    printf("#endif\n\n");
-#endif
-    return 0;
-}
\ No newline at end of file
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// gbk_mbtowc() is the reference chain here, the mbtowc layout is what replaces it.
+#define GBK_NO_FLAT_TABLE
+#include "converters.h"
+
+#define LOG(LEVEL, FMT, ...)                                                     \
+    do {                                                                         \
+        fprintf(stderr, "(%s:%d) " FMT "\n", __func__, __LINE__, ##__VA_ARGS__); \
+    } while (0)
+
+#define PRINT_DEBUG(FMT, ...) LOG(LOG_DEBUG, FMT, ##__VA_ARGS__)
+#define PRINT_ERROR(FMT, ...) LOG(LOG_ERR, FMT, ##__VA_ARGS__)
+
+#define _s(x) ((uint16_t)(x))
+#define merge_b16b(h, l) ((_s(l) << 8) | _s(h))
+#define merge_b16l(h, l) ((_s(h) << 8) | _s(l))
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define swap_b16(x) (((_s(x) & 0x00ff) << 8) | ((_s(x) & 0xff00) >> 8))
+#define merge_b16 merge_b16l
+#else
+#define swap_b16(_x) (_x)
+#define merge_b16 merge_b16b
+#endif
+
+/*
+ * Table layouts consumed by src/gbk2uni.c and libiconv, every one is derived from gbk_chain_mbtowc():
+ *
+ *   flat     GBK2UNI_TABLE, indexed by the little-endian code word (trail << 8 | lead) - GBK2UNI_TABLE_START.
+ *   row      GBK2UNI_TABLE, one row of GBKH_COLS entries per lead byte, unmapped codes are 0x0001.
+ *   utf8     GBK2UTF8_TABLE, row layout holding the uni2utf8() bytes and their length, 0 if rejected.
+ *   inverse  UNI2GBK_TABLE, Unicode BMP code point to GBK code (lead << 8 | trail), 0 if unmapped.
+ *   runs     GBK2UNI_RUNS, the row layout range-delta compressed, see RUNS_OP_* below.
+ *   mbtowc   GBK_MBTOWC_TABLE, row layout with 0 for unmapped codes, decoded by gbk_tab_mbtowc() in gbk.h.
+ *
+ * Each emitted header carries a checksum of its table and an inline self-test.
+ */
+#define GBKH_MIN 0x81
+#define GBKH_MAX 0xFE
+#define GBKL_MIN 0x40
+#define GBKL_MAX 0xFF
+#define GBKH_ROWS (GBKH_MAX - GBKH_MIN + 1)
+#define GBKH_COLS (GBKL_MAX - GBKL_MIN + 1)
+#define GBK2UNI_ROW_SIZE (GBKH_ROWS * GBKH_COLS)
+#define GBK2UNI_FLAT_START 0x4081
+#define GBK2UNI_FLAT_SIZE (0x10000 - GBK2UNI_FLAT_START)
+#define UNI2GBK_SIZE 0x10000
+
+/*
+ * Compressed rows: each row of GBKH_COLS entries is a byte stream of ops, the low 6 bits of the
+ * op byte hold the count minus one. GBK/3 and GBK/4 are mostly ascending Unicode runs, GB2312 is
+ * in pinyin order and goes into literal blocks.
+ */
+#define RUNS_OP_SKIP 0x00 /* count unmapped entries */
+#define RUNS_OP_SEQ 0x40  /* count entries base, base + 1, ..., base is 2 bytes little endian */
+#define RUNS_OP_LIT 0x80  /* count literal entries, 2 bytes little endian each */
+#define RUNS_OP_MASK 0xC0
+#define RUNS_OP_MAX 64
+#define RUNS_MIN_SEQ 2
+
+typedef enum {
+    LAYOUT_FLAT,
+    LAYOUT_ROW,
+    LAYOUT_UTF8,
+    LAYOUT_INVERSE,
+    LAYOUT_RUNS,
+    LAYOUT_MBTOWC,
+    LAYOUT_MAX,
+} layout_t;
+
+static const char *layout_names[LAYOUT_MAX] = {"flat", "row", "utf8", "inverse", "runs", "mbtowc"};
+
+/* Probe codes written into every self-test, {lead, trail}. */
+static const uint8_t probe_codes[][2] = {
+    {0xCE, 0xD2}, {0xA1, 0xA4}, {0xA1, 0xAA}, {0xA2, 0xA1}, {0xA2, 0xAA}, {0x81, 0x40}, {0x81, 0x7F},
+    {0xA6, 0xE0}, {0xA8, 0xBB}, {0xA8, 0xBF}, {0xB0, 0xA1}, {0xD7, 0xF9}, {0xFE, 0x4F}, {0xFE, 0xA0},
+    {0xA7, 0xA1}, {0xFE, 0xFE},
+};
+#define PROBE_COUNT (sizeof(probe_codes) / sizeof(probe_codes[0]))
+
+static uint16_t gbk2uni_ref[GBKH_ROWS][GBKH_COLS];
+static uint32_t runs_rows[GBKH_ROWS + 1];
+static uint32_t runs_size;
+
+static uint32_t fnv1a(uint32_t hash, uint32_t val, uint32_t bytes) {
+    uint32_t i = 0;
+
+    for (i = 0; i < bytes; i++) {
+        hash = (hash ^ ((val >> (i * 8)) & 0xFF)) * 0x01000193;
+    }
+    return hash;
+}
+
+/* Same conversion as uni2utf8() in src/gbk2uni.c, packed as b0 | b1 << 8 | b2 << 16 | len << 24. */
+static uint32_t uni2utf8_packed(uint16_t ns) {
+    if (ns < 0xFF) {
+        return 0;
+    }
+    if ((ns == 0x0251) || (ns == 0x0261) || (ns == 0x02C9) || (ns == 0x02C7) || (ns == 0x02CA) || (ns == 0x02CB) ||
+        (ns == 0x02D9) || (ns == 0x0401) || (ns == 0x0451)) {
+        return 0;
+    }
+    if ((ns >= 0x0410) && (ns <= 0x044F)) {
+        return 0;
+    }
+    if (0 != (ns & 0xF100)) {
+        return ((uint32_t)((ns & 0xF000) >> 12 | 0xE0)) | ((uint32_t)((ns & 0x0FC0) >> 6 | 0x80) << 8) |
+               ((uint32_t)((ns & 0x003F) | 0x80) << 16) | (3u << 24);
+    }
+    return ((uint32_t)((ns & 0x07C0) >> 6 | 0xE0)) | ((uint32_t)((ns & 0x003F) | 0x80) << 8) | (2u << 24);
+}
+
+static uint16_t ref_lookup(uint8_t lead, uint8_t trail) {
+    if ((lead < GBKH_MIN) || (lead > GBKH_MAX) || (trail < GBKL_MIN)) {
+        return 0;
+    }
+    return gbk2uni_ref[lead - GBKH_MIN][trail - GBKL_MIN];
+}
+
+static void build_reference(void) {
+    uint16_t gbkh = 0, gbkl = 0;
+    uint8_t gbk[2] = {0};
+    ucs4_t wc = 0;
+
+    for (gbkh = GBKH_MIN; gbkh <= GBKH_MAX; gbkh++) {
+        for (gbkl = GBKL_MIN; gbkl <= GBKL_MAX; gbkl++) {
+            gbk[0] = gbkh;
+            gbk[1] = gbkl;
+            if ((gbk_chain_mbtowc(NULL, &wc, gbk, sizeof(gbk)) <= 0) || (wc > 0xFFFF)) {
+                wc = 0;
+            }
+            gbk2uni_ref[gbkh - GBKH_MIN][gbkl - GBKL_MIN] = wc;
+        }
+    }
+}
+
+static uint32_t layout_size(layout_t layout) {
+    switch (layout) {
+        case LAYOUT_FLAT:
+            return GBK2UNI_FLAT_SIZE;
+        case LAYOUT_ROW:
+        case LAYOUT_UTF8:
+        case LAYOUT_MBTOWC:
+            return GBK2UNI_ROW_SIZE;
+        case LAYOUT_INVERSE:
+            return UNI2GBK_SIZE;
+        case LAYOUT_RUNS:
+            return runs_size;
+        default:
+            return 0;
+    }
+}
+
+static uint32_t layout_width(layout_t layout) {
+    switch (layout) {
+        case LAYOUT_UTF8:
+            return sizeof(uint32_t);
+        case LAYOUT_RUNS:
+            return sizeof(uint8_t);
+        default:
+            return sizeof(uint16_t);
+    }
+}
+
+static uint32_t runs_put(uint32_t *tab, uint32_t pos, uint8_t op, uint32_t count, const uint16_t *vals) {
+    uint32_t i = 0;
+
+    tab[pos++] = op | (count - 1);
+    if (op == RUNS_OP_SEQ) {
+        tab[pos++] = vals[0] & 0xFF;
+        tab[pos++] = vals[0] >> 8;
+    } else if (op == RUNS_OP_LIT) {
+        for (i = 0; i < count; i++) {
+            tab[pos++] = vals[i] & 0xFF;
+            tab[pos++] = vals[i] >> 8;
+        }
+    }
+    return pos;
+}
+
+static uint32_t build_runs(uint32_t *tab) {
+    uint32_t row = 0, col = 0, cnt = 0, lit = 0, pos = 0;
+    const uint16_t *vals = NULL;
+
+    for (row = 0; row < GBKH_ROWS; row++) {
+        runs_rows[row] = pos;
+        vals = gbk2uni_ref[row];
+        for (col = 0, lit = 0; col < GBKH_COLS; col += cnt) {
+            for (cnt = 1; ((col + cnt) < GBKH_COLS) && (cnt < RUNS_OP_MAX); cnt++) {
+                if ((vals[col] == 0) ? (vals[col + cnt] != 0) : (vals[col + cnt] != vals[col] + cnt)) {
+                    break;
+                }
+            }
+            if ((vals[col] != 0) && (cnt < RUNS_MIN_SEQ)) {
+                // Too short for a run, extend the pending literal block instead.
+                if (lit == RUNS_OP_MAX) {
+                    pos = runs_put(tab, pos, RUNS_OP_LIT, lit, vals + col - lit);
+                    lit = 0;
+                }
+                lit++;
+                continue;
+            }
+            if (lit != 0) {
+                pos = runs_put(tab, pos, RUNS_OP_LIT, lit, vals + col - lit);
+                lit = 0;
+            }
+            pos = runs_put(tab, pos, ((vals[col] == 0) ? RUNS_OP_SKIP : RUNS_OP_SEQ), cnt, vals + col);
+        }
+        if (lit != 0) {
+            pos = runs_put(tab, pos, RUNS_OP_LIT, lit, vals + col - lit);
+        }
+    }
+    runs_rows[GBKH_ROWS] = pos;
+    return pos;
+}
+
+/* Decoder for the runs layout, mirrors gbk2uni_runs_expand() in the emitted header. */
+static void expand_runs(const uint32_t *tab, uint32_t row, uint16_t *out) {
+    uint32_t pos = runs_rows[row], col = 0, cnt = 0, i = 0;
+    uint8_t op = 0;
+
+    while (col < GBKH_COLS) {
+        op = tab[pos] & RUNS_OP_MASK;
+        cnt = (tab[pos++] & ~RUNS_OP_MASK) + 1;
+        for (i = 0; i < cnt; i++, col++) {
+            if (op == RUNS_OP_SKIP) {
+                out[col] = 0;
+            } else if (op == RUNS_OP_SEQ) {
+                out[col] = (tab[pos] | (tab[pos + 1] << 8)) + i;
+            } else {
+                out[col] = tab[pos + i * 2] | (tab[pos + i * 2 + 1] << 8);
+            }
+        }
+        pos += ((op == RUNS_OP_SEQ) ? 2 : ((op == RUNS_OP_LIT) ? (cnt * 2) : 0));
+    }
+}
+
+static void build_layout(layout_t layout, uint32_t *tab) {
+    uint32_t i = 0, size = layout_size(layout);
+    uint16_t gbkh = 0, gbkl = 0;
+    uint8_t buf[2] = {0};
+    uint16_t uni = 0;
+
+    if (layout == LAYOUT_RUNS) {
+        runs_size = build_runs(tab);
+        return;
+    }
+
+    for (i = 0; i < size; i++) {
+        switch (layout) {
+            case LAYOUT_FLAT:
+                tab[i] = ref_lookup((i + GBK2UNI_FLAT_START) & 0xFF, (i + GBK2UNI_FLAT_START) >> 8);
+                break;
+            case LAYOUT_ROW:
+                uni = gbk2uni_ref[i / GBKH_COLS][i % GBKH_COLS];
+                tab[i] = ((uni == 0) ? 0x0001 : uni);
+                break;
+            case LAYOUT_UTF8:
+                tab[i] = uni2utf8_packed(gbk2uni_ref[i / GBKH_COLS][i % GBKH_COLS]);
+                break;
+            case LAYOUT_MBTOWC:
+                tab[i] = gbk2uni_ref[i / GBKH_COLS][i % GBKH_COLS];
+                break;
+            case LAYOUT_INVERSE:
+                tab[i] = 0;
+                if ((i >= 0x80) && (gbk_wctomb(NULL, buf, i, sizeof(buf)) == 2)) {
+                    gbkh = buf[0];
+                    gbkl = buf[1];
+                    tab[i] = merge_b16b(gbkl, gbkh);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static uint32_t layout_checksum(layout_t layout, const uint32_t *tab) {
+    uint32_t i = 0, size = layout_size(layout), width = layout_width(layout);
+    uint32_t hash = 0x811C9DC5;
+
+    for (i = 0; i < size; i++) {
+        hash = fnv1a(hash, tab[i], width);
+    }
+    return hash;
+}
+
+/* Check a layout against the reference chain for every code, the same rules the emitted self-tests spot-check. */
+static int32_t check_layout(layout_t layout, const uint32_t *tab) {
+    uint32_t i = 0, code = 0;
+    uint16_t uni = 0, gbkh = 0, gbkl = 0;
+    uint16_t row[GBKH_COLS] = {0};
+
+    for (gbkh = GBKH_MIN; gbkh <= GBKH_MAX; gbkh++) {
+        for (gbkl = GBKL_MIN; gbkl <= GBKL_MAX; gbkl++) {
+            uni = ref_lookup(gbkh, gbkl);
+            i = (gbkh - GBKH_MIN) * GBKH_COLS + (gbkl - GBKL_MIN);
+            code = merge_b16l(gbkl, gbkh) - GBK2UNI_FLAT_START;
+            if (((layout == LAYOUT_FLAT) && (tab[code] != uni)) ||
+                ((layout == LAYOUT_ROW) && (tab[i] != ((uni == 0) ? 0x0001 : uni))) ||
+                ((layout == LAYOUT_UTF8) && (tab[i] != uni2utf8_packed(uni))) ||
+                ((layout == LAYOUT_MBTOWC) && (tab[i] != uni))) {
+                PRINT_ERROR("%s: gbk 0x%02X%02X mismatch, uni 0x%04X", layout_names[layout], gbkh, gbkl, uni);
+                return -1;
+            }
+        }
+    }
+
+    if (layout == LAYOUT_RUNS) {
+        for (i = 0; i < GBKH_ROWS; i++) {
+            expand_runs(tab, i, row);
+            if (memcmp(row, gbk2uni_ref[i], sizeof(row)) != 0) {
+                PRINT_ERROR("%s: row 0x%02X mismatch", layout_names[layout], GBKH_MIN + i);
+                return -1;
+            }
+        }
+    }
+
+    if (layout == LAYOUT_INVERSE) {
+        for (i = 0x80; i < UNI2GBK_SIZE; i++) {
+            if ((tab[i] != 0) && (ref_lookup(tab[i] >> 8, tab[i] & 0xFF) != i)) {
+                PRINT_ERROR("%s: uni 0x%04X -> gbk 0x%04X does not round trip", layout_names[layout], i, tab[i]);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* gbk_tab_mbtowc() over the mbtowc layout must return exactly what the reference chain returns, for every input and length. */
+static int32_t check_mbtowc(const uint32_t *tab) {
+    static uint16_t tab16[GBK2UNI_ROW_SIZE];
+    uint32_t code = 0;
+    size_t n = 0;
+    uint8_t gbk[2] = {0};
+    ucs4_t wc = 0, ref_wc = 0;
+    int32_t ret = 0, ref_ret = 0;
+
+    for (code = 0; code < GBK2UNI_ROW_SIZE; code++) {
+        tab16[code] = tab[code];
+    }
+    for (code = 0; code <= 0xFFFF; code++) {
+        for (n = 1; n <= sizeof(gbk); n++) {
+            gbk[0] = code >> 8;
+            gbk[1] = code & 0xFF;
+            wc = ref_wc = 0;
+            ret = gbk_tab_mbtowc(tab16, &wc, gbk, n);
+            ref_ret = gbk_chain_mbtowc(NULL, &ref_wc, gbk, n);
+            if ((ret != ref_ret) || ((ret > 0) && (wc != ref_wc))) {
+                PRINT_ERROR("gbk_tab_mbtowc: 0x%04X/%zu returns %d:0x%04X, expect %d:0x%04X", code, n, ret, wc,
+                            ref_ret, ref_wc);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+static void emit_table(FILE *fp, const char *type, const char *name, const uint32_t *tab, uint32_t size,
+                       uint32_t width) {
+    uint32_t i = 0;
+
+    fprintf(fp, "// clang-format off\n");
+    fprintf(fp, "// size: %u\n", size);
+    fprintf(fp, "static const %s %s[] = {\n    ", type, name);
+    for (i = 0; i < size; i++) {
+        fprintf(fp, (width == 4) ? "0x%08X," : ((width == 2) ? "0x%04X," : "0x%02X,"), tab[i]);
+        if ((i + 1) == size) {
+            fprintf(fp, "\n");
+        } else if (((i + 1) % 16) == 0) {
+            fprintf(fp, "\n    ");
+        }
+    }
+    fprintf(fp, "};\n");
+    fprintf(fp, "// clang-format on\n\n");
+}
+
+static void emit_checksum(FILE *fp, const char *prefix, const char *name, const char *type, uint32_t width) {
+    fprintf(fp, "static inline uint32_t %s_checksum(void) {\n", prefix);
+    fprintf(fp, "    uint32_t hash = 0x811C9DC5;\n");
+    fprintf(fp, "    uint32_t i = 0, j = 0;\n\n");
+    fprintf(fp, "    for (i = 0; i < sizeof(%s) / sizeof(%s); i++) {\n", name, type);
+    fprintf(fp, "        for (j = 0; j < %u; j++) {\n", width);
+    fprintf(fp, "            hash = (hash ^ ((%s[i] >> (j * 8)) & 0xFF)) * 0x01000193;\n", name);
+    fprintf(fp, "        }\n");
+    fprintf(fp, "    }\n");
+    fprintf(fp, "    return hash;\n");
+    fprintf(fp, "}\n\n");
+}
+
+static void emit_runs_expand(FILE *fp) {
+    fprintf(fp, "#define GBK2UNI_RUNS_SKIP 0x%02X\n", RUNS_OP_SKIP);
+    fprintf(fp, "#define GBK2UNI_RUNS_SEQ 0x%02X\n", RUNS_OP_SEQ);
+    fprintf(fp, "#define GBK2UNI_RUNS_LIT 0x%02X\n", RUNS_OP_LIT);
+    fprintf(fp, "#define GBK2UNI_RUNS_MASK 0x%02X\n\n", RUNS_OP_MASK);
+    fprintf(fp, "/* Expand one compressed row into GBK2UNI_RUNS_COLS entries, 0 marks unmapped codes. */\n");
+    fprintf(fp, "static inline void gbk2uni_runs_expand(uint32_t row, uint16_t *out) {\n");
+    fprintf(fp, "    const uint8_t *ptr = GBK2UNI_RUNS + GBK2UNI_RUNS_ROW[row];\n");
+    fprintf(fp, "    const uint8_t *end = GBK2UNI_RUNS + GBK2UNI_RUNS_ROW[row + 1];\n");
+    fprintf(fp, "    uint32_t cnt = 0, i = 0;\n");
+    fprintf(fp, "    uint16_t base = 0;\n");
+    fprintf(fp, "    uint8_t op = 0;\n\n");
+    fprintf(fp, "    while (ptr < end) {\n");
+    fprintf(fp, "        op = *ptr & GBK2UNI_RUNS_MASK;\n");
+    fprintf(fp, "        cnt = (*ptr++ & ~GBK2UNI_RUNS_MASK) + 1;\n");
+    fprintf(fp, "        if (op == GBK2UNI_RUNS_SKIP) {\n");
+    fprintf(fp, "            for (i = 0; i < cnt; i++) {\n");
+    fprintf(fp, "                *out++ = 0;\n");
+    fprintf(fp, "            }\n");
+    fprintf(fp, "        } else if (op == GBK2UNI_RUNS_SEQ) {\n");
+    fprintf(fp, "            base = ptr[0] | (ptr[1] << 8);\n");
+    fprintf(fp, "            ptr += 2;\n");
+    fprintf(fp, "            for (i = 0; i < cnt; i++) {\n");
+    fprintf(fp, "                *out++ = base + i;\n");
+    fprintf(fp, "            }\n");
+    fprintf(fp, "        } else {\n");
+    fprintf(fp, "            for (i = 0; i < cnt; i++, ptr += 2) {\n");
+    fprintf(fp, "                *out++ = ptr[0] | (ptr[1] << 8);\n");
+    fprintf(fp, "            }\n");
+    fprintf(fp, "        }\n");
+    fprintf(fp, "    }\n");
+    fprintf(fp, "}\n\n");
+}
+
+static void emit_layout(FILE *fp, layout_t layout, const uint32_t *tab) {
+    const char *name = NULL, *guard = NULL, *prefix = NULL, *type = "uint16_t";
+    uint32_t i = 0, size = layout_size(layout), width = layout_width(layout);
+    uint8_t lead = 0, trail = 0;
+    uint16_t uni = 0;
+
+    switch (layout) {
+        case LAYOUT_FLAT:
+            name = "GBK2UNI_TABLE", guard = "__GBK2UNI_FLAT_H__", prefix = "gbk2uni_flat";
+            break;
+        case LAYOUT_ROW:
+            name = "GBK2UNI_TABLE", guard = "__GBK2UNI_ROW_H__", prefix = "gbk2uni_row";
+            break;
+        case LAYOUT_UTF8:
+            name = "GBK2UTF8_TABLE", guard = "__GBK2UTF8_TAB_H__", prefix = "gbk2utf8_tab", type = "uint32_t";
+            break;
+        case LAYOUT_INVERSE:
+            name = "UNI2GBK_TABLE", guard = "__UNI2GBK_TAB_H__", prefix = "uni2gbk_tab";
+            break;
+        case LAYOUT_RUNS:
+            name = "GBK2UNI_RUNS", guard = "__GBK2UNI_RUNS_H__", prefix = "gbk2uni_runs", type = "uint8_t";
+            break;
+        case LAYOUT_MBTOWC:
+            name = "GBK_MBTOWC_TABLE", guard = "__GBK_MBTOWC_TAB_H__", prefix = "gbk_mbtowc_tab";
+            break;
+        default:
+            return;
+    }
+
+    fprintf(fp, "/* Generated by gen_gbk2uni_tab --layout=%s from libiconv gbk_chain_mbtowc(), do not edit. */\n\n",
+            layout_names[layout]);
+    fprintf(fp, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(fp, "#include <stdbool.h>\n#include <stdint.h>\n\n");
+    emit_table(fp, type, name, tab, size, width);
+
+    fprintf(fp, "#define %s_CHECKSUM 0x%08X\n", name, layout_checksum(layout, tab));
+    switch (layout) {
+        case LAYOUT_FLAT:
+            fprintf(fp, "#define %s_START 0x%04X\n", name, GBK2UNI_FLAT_START);
+            fprintf(fp, "#define %s_INDEX(_lead, _trail) ((((_trail) << 8) | (_lead)) - %s_START)\n", name, name);
+            break;
+        case LAYOUT_ROW:
+        case LAYOUT_UTF8:
+        case LAYOUT_MBTOWC:
+            fprintf(fp, "#define %s_COLS %u\n", name, GBKH_COLS);
+            fprintf(fp, "#define %s_INDEX(_lead, _trail) (((_lead) - 0x%02X) * %s_COLS + ((_trail) - 0x%02X))\n", name,
+                    GBKH_MIN, name, GBKL_MIN);
+            break;
+        case LAYOUT_INVERSE:
+            fprintf(fp, "#define %s_INDEX(_uni) (_uni)\n", name);
+            break;
+        case LAYOUT_RUNS:
+            fprintf(fp, "#define %s_ROWS %u\n", name, GBKH_ROWS);
+            fprintf(fp, "#define %s_COLS %u\n", name, GBKH_COLS);
+            fprintf(fp, "#define %s_LEAD_MIN 0x%02X\n", name, GBKH_MIN);
+            fprintf(fp, "#define %s_TRAIL_MIN 0x%02X\n", name, GBKL_MIN);
+            break;
+        default:
+            break;
+    }
+    if (layout == LAYOUT_UTF8) {
+        fprintf(fp, "#define %s_LEN(_v) ((_v) >> 24)\n", name);
+    }
+    fprintf(fp, "\n");
+
+    if (layout == LAYOUT_RUNS) {
+        emit_table(fp, "uint16_t", "GBK2UNI_RUNS_ROW", runs_rows, GBKH_ROWS + 1, sizeof(uint16_t));
+        emit_runs_expand(fp);
+    }
+
+    emit_checksum(fp, prefix, name, type, width);
+
+    fprintf(fp, "static inline bool %s_selftest(void) {\n", prefix);
+    if (layout == LAYOUT_RUNS) {
+        fprintf(fp, "    uint16_t row[%s_COLS];\n\n", name);
+    }
+    fprintf(fp, "    if (%s_checksum() != %s_CHECKSUM) {\n", prefix, name);
+    fprintf(fp, "        return false;\n");
+    fprintf(fp, "    }\n");
+    for (i = 0; i < PROBE_COUNT; i++) {
+        lead = probe_codes[i][0];
+        trail = probe_codes[i][1];
+        uni = ref_lookup(lead, trail);
+        switch (layout) {
+            case LAYOUT_FLAT:
+            case LAYOUT_MBTOWC:
+                fprintf(fp, "    if (%s[%s_INDEX(0x%02X, 0x%02X)] != 0x%04X) {\n", name, name, lead, trail, uni);
+                break;
+            case LAYOUT_ROW:
+                fprintf(fp, "    if (%s[%s_INDEX(0x%02X, 0x%02X)] != 0x%04X) {\n", name, name, lead, trail,
+                        ((uni == 0) ? 0x0001 : uni));
+                break;
+            case LAYOUT_UTF8:
+                fprintf(fp, "    if (%s[%s_INDEX(0x%02X, 0x%02X)] != 0x%08X) {\n", name, name, lead, trail,
+                        uni2utf8_packed(uni));
+                break;
+            case LAYOUT_RUNS:
+                fprintf(fp, "    gbk2uni_runs_expand(0x%02X - %s_LEAD_MIN, row);\n", lead, name);
+                fprintf(fp, "    if (row[0x%02X - %s_TRAIL_MIN] != 0x%04X) {\n", trail, name, uni);
+                break;
+            case LAYOUT_INVERSE:
+                if (uni == 0) {
+                    continue;
+                }
+                fprintf(fp, "    if (%s[%s_INDEX(0x%04X)] != 0x%04X) {\n", name, name, uni, tab[uni]);
+                break;
+            default:
+                break;
+        }
+        fprintf(fp, "        return false;\n");
+        fprintf(fp, "    }\n");
+    }
+    fprintf(fp, "    return true;\n");
+    fprintf(fp, "}\n\n");
+    fprintf(fp, "#endif\n");
+}
+
+static void usage(const char *exe_name) {
+    printf("Usage: %s [-c] [-l LAYOUT] [-o OUTPUT_FILE]\n", exe_name);
+    printf("  -l, --layout=LAYOUT  emit one of: flat, row, utf8, inverse, runs, mbtowc\n");
+    printf("  -c, --check          verify every layout and gbk_tab_mbtowc() against the reference chain\n");
+    printf("  -o, --output=FILE    write the header to FILE instead of stdout\n");
+}
+
+static const struct option long_options[] = {
+    {"layout", required_argument, NULL, 'l'},
+    {"check", no_argument, NULL, 'c'},
+    {"output", required_argument, NULL, 'o'},
+    {"help", no_argument, NULL, 'h'},
+    {NULL, 0, NULL, 0},
+};
+
+int32_t main(int32_t argc, char *argv[]) {
+    int32_t ret = 0;
+    int opt = 0;
+    int32_t layout = LAYOUT_MAX;
+    bool check = false;
+    const char *out_file = NULL;
+    FILE *fp = stdout;
+    uint32_t *tab = NULL;
+
+    while ((opt = getopt_long(argc, argv, "l:co:h", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'l':
+                for (layout = 0; layout < LAYOUT_MAX; layout++) {
+                    if (strcmp(optarg, layout_names[layout]) == 0) {
+                        break;
+                    }
+                }
+                if (layout == LAYOUT_MAX) {
+                    PRINT_ERROR("Unknown layout [%s]!", optarg);
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            case 'c':
+                check = true;
+                break;
+            case 'o':
+                out_file = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (!check && (layout == LAYOUT_MAX)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    tab = (uint32_t *)calloc(UNI2GBK_SIZE, sizeof(uint32_t));
+    if (tab == NULL) {
+        PRINT_ERROR("Failed to malloc table!");
+        return -1;
+    }
+
+    build_reference();
+
+    if (check) {
+        for (opt = 0; opt < LAYOUT_MAX; opt++) {
+            build_layout(opt, tab);
+            if (check_layout(opt, tab) != 0) {
+                ret = -1;
+                goto __oops;
+            }
+            PRINT_DEBUG("%s: %u entries, checksum 0x%08X ok", layout_names[opt], layout_size(opt),
+                        layout_checksum(opt, tab));
+        }
+        build_layout(LAYOUT_MBTOWC, tab);
+        if (check_mbtowc(tab) != 0) {
+            ret = -1;
+            goto __oops;
+        }
+        PRINT_DEBUG("gbk_tab_mbtowc: mbtowc table matches the reference chain");
+    }
+
+    if (layout != LAYOUT_MAX) {
+        // The emitted layout is always checked, a mismatch fails the build instead of shipping a bad table.
+        build_layout(layout, tab);
+        if ((check_layout(layout, tab) != 0) || ((layout == LAYOUT_MBTOWC) && (check_mbtowc(tab) != 0))) {
+            ret = -1;
+            goto __oops;
+        }
+        if (out_file != NULL) {
+            fp = fopen(out_file, "w");
+            if (fp == NULL) {
+                PRINT_ERROR("Failed to open file [%s]", out_file);
+                ret = -1;
+                goto __oops;
+            }
+        }
+        emit_layout(fp, layout, tab);
+        if ((fp != stdout) && (fclose(fp) != 0)) {
+            PRINT_ERROR("Failed to write file [%s]", out_file);
+            remove(out_file);
+            ret = -1;
+        }
+    }
+
+__oops:
+    free(tab);
+    return ret;
+}
@@ -1,3069 +0,0 @@
-/*
- * Copyright (c) 2020 Louis Suen
- * Licensed under the MIT License. See the LICENSE file for the full text.
- */
-#ifndef __TAB_GBK2UNI__H__D76B1C4F_4C55_4497_AA37_CE482DC90E19
-#define __TAB_GBK2UNI__H__D76B1C4F_4C55_4497_AA37_CE482DC90E19
-
-//# -*- coding: UTF-8 -*-
-//def gbkutf82Unicode(num):
-//    if (num <= 0):
-//        return 0
-//    elif (num > 0 and num <= 0x7F):
-//        return num
-//    if (num >= 0x10000):
-//        a = (num >> 16) & 0x0F
-//        b = (num >> 8) & 0x3F
-//        c = num & 0x3F
-//        return c | (b << 6) | (a <<12)
-//    elif (num >= 0x100):
-//        a = (num >> 8) & 0x1F
-//        b = num & 0x3F
-//        return b | a << 6
-//    return 0;     
-	
-//我
-//#b'\xce\xd2'
-//[(0xce - 0x81) * 12 * 16 + 0xd2 - 0x40] = 14930
-//uni:0x6211
-//utf8:0xe68891
-static const unsigned short tab_gbk_contents[] = {
-0X8140,0X8141,0X8142,0X8143,0X8144,0X8145,0X8146,0X8147,0X8148,0X8149,0X814A,0X814B,0X814C,0X814D,0X814E,0X814F,
-0X8150,0X8151,0X8152,0X8153,0X8154,0X8155,0X8156,0X8157,0X8158,0X8159,0X815A,0X815B,0X815C,0X815D,0X815E,0X815F,
-0X8160,0X8161,0X8162,0X8163,0X8164,0X8165,0X8166,0X8167,0X8168,0X8169,0X816A,0X816B,0X816C,0X816D,0X816E,0X816F,
-0X8170,0X8171,0X8172,0X8173,0X8174,0X8175,0X8176,0X8177,0X8178,0X8179,0X817A,0X817B,0X817C,0X817D,0X817E,0X817F,
-0X8180,0X8181,0X8182,0X8183,0X8184,0X8185,0X8186,0X8187,0X8188,0X8189,0X818A,0X818B,0X818C,0X818D,0X818E,0X818F,
-0X8190,0X8191,0X8192,0X8193,0X8194,0X8195,0X8196,0X8197,0X8198,0X8199,0X819A,0X819B,0X819C,0X819D,0X819E,0X819F,
-0X81A0,0X81A1,0X81A2,0X81A3,0X81A4,0X81A5,0X81A6,0X81A7,0X81A8,0X81A9,0X81AA,0X81AB,0X81AC,0X81AD,0X81AE,0X81AF,
-0X81B0,0X81B1,0X81B2,0X81B3,0X81B4,0X81B5,0X81B6,0X81B7,0X81B8,0X81B9,0X81BA,0X81BB,0X81BC,0X81BD,0X81BE,0X81BF,
-0X81C0,0X81C1,0X81C2,0X81C3,0X81C4,0X81C5,0X81C6,0X81C7,0X81C8,0X81C9,0X81CA,0X81CB,0X81CC,0X81CD,0X81CE,0X81CF,
-0X81D0,0X81D1,0X81D2,0X81D3,0X81D4,0X81D5,0X81D6,0X81D7,0X81D8,0X81D9,0X81DA,0X81DB,0X81DC,0X81DD,0X81DE,0X81DF,
-0X81E0,0X81E1,0X81E2,0X81E3,0X81E4,0X81E5,0X81E6,0X81E7,0X81E8,0X81E9,0X81EA,0X81EB,0X81EC,0X81ED,0X81EE,0X81EF,
-0X81F0,0X81F1,0X81F2,0X81F3,0X81F4,0X81F5,0X81F6,0X81F7,0X81F8,0X81F9,0X81FA,0X81FB,0X81FC,0X81FD,0X81FE,0X81FF,
-0X8240,0X8241,0X8242,0X8243,0X8244,0X8245,0X8246,0X8247,0X8248,0X8249,0X824A,0X824B,0X824C,0X824D,0X824E,0X824F,
-0X8250,0X8251,0X8252,0X8253,0X8254,0X8255,0X8256,0X8257,0X8258,0X8259,0X825A,0X825B,0X825C,0X825D,0X825E,0X825F,
-0X8260,0X8261,0X8262,0X8263,0X8264,0X8265,0X8266,0X8267,0X8268,0X8269,0X826A,0X826B,0X826C,0X826D,0X826E,0X826F,
-0X8270,0X8271,0X8272,0X8273,0X8274,0X8275,0X8276,0X8277,0X8278,0X8279,0X827A,0X827B,0X827C,0X827D,0X827E,0X827F,
-0X8280,0X8281,0X8282,0X8283,0X8284,0X8285,0X8286,0X8287,0X8288,0X8289,0X828A,0X828B,0X828C,0X828D,0X828E,0X828F,
-0X8290,0X8291,0X8292,0X8293,0X8294,0X8295,0X8296,0X8297,0X8298,0X8299,0X829A,0X829B,0X829C,0X829D,0X829E,0X829F,
-0X82A0,0X82A1,0X82A2,0X82A3,0X82A4,0X82A5,0X82A6,0X82A7,0X82A8,0X82A9,0X82AA,0X82AB,0X82AC,0X82AD,0X82AE,0X82AF,
-0X82B0,0X82B1,0X82B2,0X82B3,0X82B4,0X82B5,0X82B6,0X82B7,0X82B8,0X82B9,0X82BA,0X82BB,0X82BC,0X82BD,0X82BE,0X82BF,
-0X82C0,0X82C1,0X82C2,0X82C3,0X82C4,0X82C5,0X82C6,0X82C7,0X82C8,0X82C9,0X82CA,0X82CB,0X82CC,0X82CD,0X82CE,0X82CF,
-0X82D0,0X82D1,0X82D2,0X82D3,0X82D4,0X82D5,0X82D6,0X82D7,0X82D8,0X82D9,0X82DA,0X82DB,0X82DC,0X82DD,0X82DE,0X82DF,
-0X82E0,0X82E1,0X82E2,0X82E3,0X82E4,0X82E5,0X82E6,0X82E7,0X82E8,0X82E9,0X82EA,0X82EB,0X82EC,0X82ED,0X82EE,0X82EF,
-0X82F0,0X82F1,0X82F2,0X82F3,0X82F4,0X82F5,0X82F6,0X82F7,0X82F8,0X82F9,0X82FA,0X82FB,0X82FC,0X82FD,0X82FE,0X82FF,
-0X8340,0X8341,0X8342,0X8343,0X8344,0X8345,0X8346,0X8347,0X8348,0X8349,0X834A,0X834B,0X834C,0X834D,0X834E,0X834F,
-0X8350,0X8351,0X8352,0X8353,0X8354,0X8355,0X8356,0X8357,0X8358,0X8359,0X835A,0X835B,0X835C,0X835D,0X835E,0X835F,
-0X8360,0X8361,0X8362,0X8363,0X8364,0X8365,0X8366,0X8367,0X8368,0X8369,0X836A,0X836B,0X836C,0X836D,0X836E,0X836F,
-0X8370,0X8371,0X8372,0X8373,0X8374,0X8375,0X8376,0X8377,0X8378,0X8379,0X837A,0X837B,0X837C,0X837D,0X837E,0X837F,
-0X8380,0X8381,0X8382,0X8383,0X8384,0X8385,0X8386,0X8387,0X8388,0X8389,0X838A,0X838B,0X838C,0X838D,0X838E,0X838F,
-0X8390,0X8391,0X8392,0X8393,0X8394,0X8395,0X8396,0X8397,0X8398,0X8399,0X839A,0X839B,0X839C,0X839D,0X839E,0X839F,
-0X83A0,0X83A1,0X83A2,0X83A3,0X83A4,0X83A5,0X83A6,0X83A7,0X83A8,0X83A9,0X83AA,0X83AB,0X83AC,0X83AD,0X83AE,0X83AF,
-0X83B0,0X83B1,0X83B2,0X83B3,0X83B4,0X83B5,0X83B6,0X83B7,0X83B8,0X83B9,0X83BA,0X83BB,0X83BC,0X83BD,0X83BE,0X83BF,
-0X83C0,0X83C1,0X83C2,0X83C3,0X83C4,0X83C5,0X83C6,0X83C7,0X83C8,0X83C9,0X83CA,0X83CB,0X83CC,0X83CD,0X83CE,0X83CF,
-0X83D0,0X83D1,0X83D2,0X83D3,0X83D4,0X83D5,0X83D6,0X83D7,0X83D8,0X83D9,0X83DA,0X83DB,0X83DC,0X83DD,0X83DE,0X83DF,
-0X83E0,0X83E1,0X83E2,0X83E3,0X83E4,0X83E5,0X83E6,0X83E7,0X83E8,0X83E9,0X83EA,0X83EB,0X83EC,0X83ED,0X83EE,0X83EF,
-0X83F0,0X83F1,0X83F2,0X83F3,0X83F4,0X83F5,0X83F6,0X83F7,0X83F8,0X83F9,0X83FA,0X83FB,0X83FC,0X83FD,0X83FE,0X83FF,
-0X8440,0X8441,0X8442,0X8443,0X8444,0X8445,0X8446,0X8447,0X8448,0X8449,0X844A,0X844B,0X844C,0X844D,0X844E,0X844F,
-0X8450,0X8451,0X8452,0X8453,0X8454,0X8455,0X8456,0X8457,0X8458,0X8459,0X845A,0X845B,0X845C,0X845D,0X845E,0X845F,
-0X8460,0X8461,0X8462,0X8463,0X8464,0X8465,0X8466,0X8467,0X8468,0X8469,0X846A,0X846B,0X846C,0X846D,0X846E,0X846F,
-0X8470,0X8471,0X8472,0X8473,0X8474,0X8475,0X8476,0X8477,0X8478,0X8479,0X847A,0X847B,0X847C,0X847D,0X847E,0X847F,
-0X8480,0X8481,0X8482,0X8483,0X8484,0X8485,0X8486,0X8487,0X8488,0X8489,0X848A,0X848B,0X848C,0X848D,0X848E,0X848F,
-0X8490,0X8491,0X8492,0X8493,0X8494,0X8495,0X8496,0X8497,0X8498,0X8499,0X849A,0X849B,0X849C,0X849D,0X849E,0X849F,
-0X84A0,0X84A1,0X84A2,0X84A3,0X84A4,0X84A5,0X84A6,0X84A7,0X84A8,0X84A9,0X84AA,0X84AB,0X84AC,0X84AD,0X84AE,0X84AF,
-0X84B0,0X84B1,0X84B2,0X84B3,0X84B4,0X84B5,0X84B6,0X84B7,0X84B8,0X84B9,0X84BA,0X84BB,0X84BC,0X84BD,0X84BE,0X84BF,
-0X84C0,0X84C1,0X84C2,0X84C3,0X84C4,0X84C5,0X84C6,0X84C7,0X84C8,0X84C9,0X84CA,0X84CB,0X84CC,0X84CD,0X84CE,0X84CF,
-0X84D0,0X84D1,0X84D2,0X84D3,0X84D4,0X84D5,0X84D6,0X84D7,0X84D8,0X84D9,0X84DA,0X84DB,0X84DC,0X84DD,0X84DE,0X84DF,
-0X84E0,0X84E1,0X84E2,0X84E3,0X84E4,0X84E5,0X84E6,0X84E7,0X84E8,0X84E9,0X84EA,0X84EB,0X84EC,0X84ED,0X84EE,0X84EF,
-0X84F0,0X84F1,0X84F2,0X84F3,0X84F4,0X84F5,0X84F6,0X84F7,0X84F8,0X84F9,0X84FA,0X84FB,0X84FC,0X84FD,0X84FE,0X84FF,
-0X8540,0X8541,0X8542,0X8543,0X8544,0X8545,0X8546,0X8547,0X8548,0X8549,0X854A,0X854B,0X854C,0X854D,0X854E,0X854F,
-0X8550,0X8551,0X8552,0X8553,0X8554,0X8555,0X8556,0X8557,0X8558,0X8559,0X855A,0X855B,0X855C,0X855D,0X855E,0X855F,
-0X8560,0X8561,0X8562,0X8563,0X8564,0X8565,0X8566,0X8567,0X8568,0X8569,0X856A,0X856B,0X856C,0X856D,0X856E,0X856F,
-0X8570,0X8571,0X8572,0X8573,0X8574,0X8575,0X8576,0X8577,0X8578,0X8579,0X857A,0X857B,0X857C,0X857D,0X857E,0X857F,
-0X8580,0X8581,0X8582,0X8583,0X8584,0X8585,0X8586,0X8587,0X8588,0X8589,0X858A,0X858B,0X858C,0X858D,0X858E,0X858F,
-0X8590,0X8591,0X8592,0X8593,0X8594,0X8595,0X8596,0X8597,0X8598,0X8599,0X859A,0X859B,0X859C,0X859D,0X859E,0X859F,
-0X85A0,0X85A1,0X85A2,0X85A3,0X85A4,0X85A5,0X85A6,0X85A7,0X85A8,0X85A9,0X85AA,0X85AB,0X85AC,0X85AD,0X85AE,0X85AF,
-0X85B0,0X85B1,0X85B2,0X85B3,0X85B4,0X85B5,0X85B6,0X85B7,0X85B8,0X85B9,0X85BA,0X85BB,0X85BC,0X85BD,0X85BE,0X85BF,
-0X85C0,0X85C1,0X85C2,0X85C3,0X85C4,0X85C5,0X85C6,0X85C7,0X85C8,0X85C9,0X85CA,0X85CB,0X85CC,0X85CD,0X85CE,0X85CF,
-0X85D0,0X85D1,0X85D2,0X85D3,0X85D4,0X85D5,0X85D6,0X85D7,0X85D8,0X85D9,0X85DA,0X85DB,0X85DC,0X85DD,0X85DE,0X85DF,
-0X85E0,0X85E1,0X85E2,0X85E3,0X85E4,0X85E5,0X85E6,0X85E7,0X85E8,0X85E9,0X85EA,0X85EB,0X85EC,0X85ED,0X85EE,0X85EF,
-0X85F0,0X85F1,0X85F2,0X85F3,0X85F4,0X85F5,0X85F6,0X85F7,0X85F8,0X85F9,0X85FA,0X85FB,0X85FC,0X85FD,0X85FE,0X85FF,
-0X8640,0X8641,0X8642,0X8643,0X8644,0X8645,0X8646,0X8647,0X8648,0X8649,0X864A,0X864B,0X864C,0X864D,0X864E,0X864F,
-0X8650,0X8651,0X8652,0X8653,0X8654,0X8655,0X8656,0X8657,0X8658,0X8659,0X865A,0X865B,0X865C,0X865D,0X865E,0X865F,
-0X8660,0X8661,0X8662,0X8663,0X8664,0X8665,0X8666,0X8667,0X8668,0X8669,0X866A,0X866B,0X866C,0X866D,0X866E,0X866F,
-0X8670,0X8671,0X8672,0X8673,0X8674,0X8675,0X8676,0X8677,0X8678,0X8679,0X867A,0X867B,0X867C,0X867D,0X867E,0X867F,
-0X8680,0X8681,0X8682,0X8683,0X8684,0X8685,0X8686,0X8687,0X8688,0X8689,0X868A,0X868B,0X868C,0X868D,0X868E,0X868F,
-0X8690,0X8691,0X8692,0X8693,0X8694,0X8695,0X8696,0X8697,0X8698,0X8699,0X869A,0X869B,0X869C,0X869D,0X869E,0X869F,
-0X86A0,0X86A1,0X86A2,0X86A3,0X86A4,0X86A5,0X86A6,0X86A7,0X86A8,0X86A9,0X86AA,0X86AB,0X86AC,0X86AD,0X86AE,0X86AF,
-0X86B0,0X86B1,0X86B2,0X86B3,0X86B4,0X86B5,0X86B6,0X86B7,0X86B8,0X86B9,0X86BA,0X86BB,0X86BC,0X86BD,0X86BE,0X86BF,
-0X86C0,0X86C1,0X86C2,0X86C3,0X86C4,0X86C5,0X86C6,0X86C7,0X86C8,0X86C9,0X86CA,0X86CB,0X86CC,0X86CD,0X86CE,0X86CF,
-0X86D0,0X86D1,0X86D2,0X86D3,0X86D4,0X86D5,0X86D6,0X86D7,0X86D8,0X86D9,0X86DA,0X86DB,0X86DC,0X86DD,0X86DE,0X86DF,
-0X86E0,0X86E1,0X86E2,0X86E3,0X86E4,0X86E5,0X86E6,0X86E7,0X86E8,0X86E9,0X86EA,0X86EB,0X86EC,0X86ED,0X86EE,0X86EF,
-0X86F0,0X86F1,0X86F2,0X86F3,0X86F4,0X86F5,0X86F6,0X86F7,0X86F8,0X86F9,0X86FA,0X86FB,0X86FC,0X86FD,0X86FE,0X86FF,
-0X8740,0X8741,0X8742,0X8743,0X8744,0X8745,0X8746,0X8747,0X8748,0X8749,0X874A,0X874B,0X874C,0X874D,0X874E,0X874F,
-0X8750,0X8751,0X8752,0X8753,0X8754,0X8755,0X8756,0X8757,0X8758,0X8759,0X875A,0X875B,0X875C,0X875D,0X875E,0X875F,
-0X8760,0X8761,0X8762,0X8763,0X8764,0X8765,0X8766,0X8767,0X8768,0X8769,0X876A,0X876B,0X876C,0X876D,0X876E,0X876F,
-0X8770,0X8771,0X8772,0X8773,0X8774,0X8775,0X8776,0X8777,0X8778,0X8779,0X877A,0X877B,0X877C,0X877D,0X877E,0X877F,
-0X8780,0X8781,0X8782,0X8783,0X8784,0X8785,0X8786,0X8787,0X8788,0X8789,0X878A,0X878B,0X878C,0X878D,0X878E,0X878F,
-0X8790,0X8791,0X8792,0X8793,0X8794,0X8795,0X8796,0X8797,0X8798,0X8799,0X879A,0X879B,0X879C,0X879D,0X879E,0X879F,
-0X87A0,0X87A1,0X87A2,0X87A3,0X87A4,0X87A5,0X87A6,0X87A7,0X87A8,0X87A9,0X87AA,0X87AB,0X87AC,0X87AD,0X87AE,0X87AF,
-0X87B0,0X87B1,0X87B2,0X87B3,0X87B4,0X87B5,0X87B6,0X87B7,0X87B8,0X87B9,0X87BA,0X87BB,0X87BC,0X87BD,0X87BE,0X87BF,
-0X87C0,0X87C1,0X87C2,0X87C3,0X87C4,0X87C5,0X87C6,0X87C7,0X87C8,0X87C9,0X87CA,0X87CB,0X87CC,0X87CD,0X87CE,0X87CF,
-0X87D0,0X87D1,0X87D2,0X87D3,0X87D4,0X87D5,0X87D6,0X87D7,0X87D8,0X87D9,0X87DA,0X87DB,0X87DC,0X87DD,0X87DE,0X87DF,
-0X87E0,0X87E1,0X87E2,0X87E3,0X87E4,0X87E5,0X87E6,0X87E7,0X87E8,0X87E9,0X87EA,0X87EB,0X87EC,0X87ED,0X87EE,0X87EF,
-0X87F0,0X87F1,0X87F2,0X87F3,0X87F4,0X87F5,0X87F6,0X87F7,0X87F8,0X87F9,0X87FA,0X87FB,0X87FC,0X87FD,0X87FE,0X87FF,
-0X8840,0X8841,0X8842,0X8843,0X8844,0X8845,0X8846,0X8847,0X8848,0X8849,0X884A,0X884B,0X884C,0X884D,0X884E,0X884F,
-0X8850,0X8851,0X8852,0X8853,0X8854,0X8855,0X8856,0X8857,0X8858,0X8859,0X885A,0X885B,0X885C,0X885D,0X885E,0X885F,
-0X8860,0X8861,0X8862,0X8863,0X8864,0X8865,0X8866,0X8867,0X8868,0X8869,0X886A,0X886B,0X886C,0X886D,0X886E,0X886F,
-0X8870,0X8871,0X8872,0X8873,0X8874,0X8875,0X8876,0X8877,0X8878,0X8879,0X887A,0X887B,0X887C,0X887D,0X887E,0X887F,
-0X8880,0X8881,0X8882,0X8883,0X8884,0X8885,0X8886,0X8887,0X8888,0X8889,0X888A,0X888B,0X888C,0X888D,0X888E,0X888F,
-0X8890,0X8891,0X8892,0X8893,0X8894,0X8895,0X8896,0X8897,0X8898,0X8899,0X889A,0X889B,0X889C,0X889D,0X889E,0X889F,
-0X88A0,0X88A1,0X88A2,0X88A3,0X88A4,0X88A5,0X88A6,0X88A7,0X88A8,0X88A9,0X88AA,0X88AB,0X88AC,0X88AD,0X88AE,0X88AF,
-0X88B0,0X88B1,0X88B2,0X88B3,0X88B4,0X88B5,0X88B6,0X88B7,0X88B8,0X88B9,0X88BA,0X88BB,0X88BC,0X88BD,0X88BE,0X88BF,
-0X88C0,0X88C1,0X88C2,0X88C3,0X88C4,0X88C5,0X88C6,0X88C7,0X88C8,0X88C9,0X88CA,0X88CB,0X88CC,0X88CD,0X88CE,0X88CF,
-0X88D0,0X88D1,0X88D2,0X88D3,0X88D4,0X88D5,0X88D6,0X88D7,0X88D8,0X88D9,0X88DA,0X88DB,0X88DC,0X88DD,0X88DE,0X88DF,
-0X88E0,0X88E1,0X88E2,0X88E3,0X88E4,0X88E5,0X88E6,0X88E7,0X88E8,0X88E9,0X88EA,0X88EB,0X88EC,0X88ED,0X88EE,0X88EF,
-0X88F0,0X88F1,0X88F2,0X88F3,0X88F4,0X88F5,0X88F6,0X88F7,0X88F8,0X88F9,0X88FA,0X88FB,0X88FC,0X88FD,0X88FE,0X88FF,
-0X8940,0X8941,0X8942,0X8943,0X8944,0X8945,0X8946,0X8947,0X8948,0X8949,0X894A,0X894B,0X894C,0X894D,0X894E,0X894F,
-0X8950,0X8951,0X8952,0X8953,0X8954,0X8955,0X8956,0X8957,0X8958,0X8959,0X895A,0X895B,0X895C,0X895D,0X895E,0X895F,
-0X8960,0X8961,0X8962,0X8963,0X8964,0X8965,0X8966,0X8967,0X8968,0X8969,0X896A,0X896B,0X896C,0X896D,0X896E,0X896F,
-0X8970,0X8971,0X8972,0X8973,0X8974,0X8975,0X8976,0X8977,0X8978,0X8979,0X897A,0X897B,0X897C,0X897D,0X897E,0X897F,
-0X8980,0X8981,0X8982,0X8983,0X8984,0X8985,0X8986,0X8987,0X8988,0X8989,0X898A,0X898B,0X898C,0X898D,0X898E,0X898F,
-0X8990,0X8991,0X8992,0X8993,0X8994,0X8995,0X8996,0X8997,0X8998,0X8999,0X899A,0X899B,0X899C,0X899D,0X899E,0X899F,
-0X89A0,0X89A1,0X89A2,0X89A3,0X89A4,0X89A5,0X89A6,0X89A7,0X89A8,0X89A9,0X89AA,0X89AB,0X89AC,0X89AD,0X89AE,0X89AF,
-0X89B0,0X89B1,0X89B2,0X89B3,0X89B4,0X89B5,0X89B6,0X89B7,0X89B8,0X89B9,0X89BA,0X89BB,0X89BC,0X89BD,0X89BE,0X89BF,
-0X89C0,0X89C1,0X89C2,0X89C3,0X89C4,0X89C5,0X89C6,0X89C7,0X89C8,0X89C9,0X89CA,0X89CB,0X89CC,0X89CD,0X89CE,0X89CF,
-0X89D0,0X89D1,0X89D2,0X89D3,0X89D4,0X89D5,0X89D6,0X89D7,0X89D8,0X89D9,0X89DA,0X89DB,0X89DC,0X89DD,0X89DE,0X89DF,
-0X89E0,0X89E1,0X89E2,0X89E3,0X89E4,0X89E5,0X89E6,0X89E7,0X89E8,0X89E9,0X89EA,0X89EB,0X89EC,0X89ED,0X89EE,0X89EF,
-0X89F0,0X89F1,0X89F2,0X89F3,0X89F4,0X89F5,0X89F6,0X89F7,0X89F8,0X89F9,0X89FA,0X89FB,0X89FC,0X89FD,0X89FE,0X89FF,
-0X8A40,0X8A41,0X8A42,0X8A43,0X8A44,0X8A45,0X8A46,0X8A47,0X8A48,0X8A49,0X8A4A,0X8A4B,0X8A4C,0X8A4D,0X8A4E,0X8A4F,
-0X8A50,0X8A51,0X8A52,0X8A53,0X8A54,0X8A55,0X8A56,0X8A57,0X8A58,0X8A59,0X8A5A,0X8A5B,0X8A5C,0X8A5D,0X8A5E,0X8A5F,
-0X8A60,0X8A61,0X8A62,0X8A63,0X8A64,0X8A65,0X8A66,0X8A67,0X8A68,0X8A69,0X8A6A,0X8A6B,0X8A6C,0X8A6D,0X8A6E,0X8A6F,
-0X8A70,0X8A71,0X8A72,0X8A73,0X8A74,0X8A75,0X8A76,0X8A77,0X8A78,0X8A79,0X8A7A,0X8A7B,0X8A7C,0X8A7D,0X8A7E,0X8A7F,
-0X8A80,0X8A81,0X8A82,0X8A83,0X8A84,0X8A85,0X8A86,0X8A87,0X8A88,0X8A89,0X8A8A,0X8A8B,0X8A8C,0X8A8D,0X8A8E,0X8A8F,
-0X8A90,0X8A91,0X8A92,0X8A93,0X8A94,0X8A95,0X8A96,0X8A97,0X8A98,0X8A99,0X8A9A,0X8A9B,0X8A9C,0X8A9D,0X8A9E,0X8A9F,
-0X8AA0,0X8AA1,0X8AA2,0X8AA3,0X8AA4,0X8AA5,0X8AA6,0X8AA7,0X8AA8,0X8AA9,0X8AAA,0X8AAB,0X8AAC,0X8AAD,0X8AAE,0X8AAF,
-0X8AB0,0X8AB1,0X8AB2,0X8AB3,0X8AB4,0X8AB5,0X8AB6,0X8AB7,0X8AB8,0X8AB9,0X8ABA,0X8ABB,0X8ABC,0X8ABD,0X8ABE,0X8ABF,
-0X8AC0,0X8AC1,0X8AC2,0X8AC3,0X8AC4,0X8AC5,0X8AC6,0X8AC7,0X8AC8,0X8AC9,0X8ACA,0X8ACB,0X8ACC,0X8ACD,0X8ACE,0X8ACF,
-0X8AD0,0X8AD1,0X8AD2,0X8AD3,0X8AD4,0X8AD5,0X8AD6,0X8AD7,0X8AD8,0X8AD9,0X8ADA,0X8ADB,0X8ADC,0X8ADD,0X8ADE,0X8ADF,
-0X8AE0,0X8AE1,0X8AE2,0X8AE3,0X8AE4,0X8AE5,0X8AE6,0X8AE7,0X8AE8,0X8AE9,0X8AEA,0X8AEB,0X8AEC,0X8AED,0X8AEE,0X8AEF,
-0X8AF0,0X8AF1,0X8AF2,0X8AF3,0X8AF4,0X8AF5,0X8AF6,0X8AF7,0X8AF8,0X8AF9,0X8AFA,0X8AFB,0X8AFC,0X8AFD,0X8AFE,0X8AFF,
-0X8B40,0X8B41,0X8B42,0X8B43,0X8B44,0X8B45,0X8B46,0X8B47,0X8B48,0X8B49,0X8B4A,0X8B4B,0X8B4C,0X8B4D,0X8B4E,0X8B4F,
-0X8B50,0X8B51,0X8B52,0X8B53,0X8B54,0X8B55,0X8B56,0X8B57,0X8B58,0X8B59,0X8B5A,0X8B5B,0X8B5C,0X8B5D,0X8B5E,0X8B5F,
-0X8B60,0X8B61,0X8B62,0X8B63,0X8B64,0X8B65,0X8B66,0X8B67,0X8B68,0X8B69,0X8B6A,0X8B6B,0X8B6C,0X8B6D,0X8B6E,0X8B6F,
-0X8B70,0X8B71,0X8B72,0X8B73,0X8B74,0X8B75,0X8B76,0X8B77,0X8B78,0X8B79,0X8B7A,0X8B7B,0X8B7C,0X8B7D,0X8B7E,0X8B7F,
-0X8B80,0X8B81,0X8B82,0X8B83,0X8B84,0X8B85,0X8B86,0X8B87,0X8B88,0X8B89,0X8B8A,0X8B8B,0X8B8C,0X8B8D,0X8B8E,0X8B8F,
-0X8B90,0X8B91,0X8B92,0X8B93,0X8B94,0X8B95,0X8B96,0X8B97,0X8B98,0X8B99,0X8B9A,0X8B9B,0X8B9C,0X8B9D,0X8B9E,0X8B9F,
-0X8BA0,0X8BA1,0X8BA2,0X8BA3,0X8BA4,0X8BA5,0X8BA6,0X8BA7,0X8BA8,0X8BA9,0X8BAA,0X8BAB,0X8BAC,0X8BAD,0X8BAE,0X8BAF,
-0X8BB0,0X8BB1,0X8BB2,0X8BB3,0X8BB4,0X8BB5,0X8BB6,0X8BB7,0X8BB8,0X8BB9,0X8BBA,0X8BBB,0X8BBC,0X8BBD,0X8BBE,0X8BBF,
-0X8BC0,0X8BC1,0X8BC2,0X8BC3,0X8BC4,0X8BC5,0X8BC6,0X8BC7,0X8BC8,0X8BC9,0X8BCA,0X8BCB,0X8BCC,0X8BCD,0X8BCE,0X8BCF,
-0X8BD0,0X8BD1,0X8BD2,0X8BD3,0X8BD4,0X8BD5,0X8BD6,0X8BD7,0X8BD8,0X8BD9,0X8BDA,0X8BDB,0X8BDC,0X8BDD,0X8BDE,0X8BDF,
-0X8BE0,0X8BE1,0X8BE2,0X8BE3,0X8BE4,0X8BE5,0X8BE6,0X8BE7,0X8BE8,0X8BE9,0X8BEA,0X8BEB,0X8BEC,0X8BED,0X8BEE,0X8BEF,
-0X8BF0,0X8BF1,0X8BF2,0X8BF3,0X8BF4,0X8BF5,0X8BF6,0X8BF7,0X8BF8,0X8BF9,0X8BFA,0X8BFB,0X8BFC,0X8BFD,0X8BFE,0X8BFF,
-0X8C40,0X8C41,0X8C42,0X8C43,0X8C44,0X8C45,0X8C46,0X8C47,0X8C48,0X8C49,0X8C4A,0X8C4B,0X8C4C,0X8C4D,0X8C4E,0X8C4F,
-0X8C50,0X8C51,0X8C52,0X8C53,0X8C54,0X8C55,0X8C56,0X8C57,0X8C58,0X8C59,0X8C5A,0X8C5B,0X8C5C,0X8C5D,0X8C5E,0X8C5F,
-0X8C60,0X8C61,0X8C62,0X8C63,0X8C64,0X8C65,0X8C66,0X8C67,0X8C68,0X8C69,0X8C6A,0X8C6B,0X8C6C,0X8C6D,0X8C6E,0X8C6F,
-0X8C70,0X8C71,0X8C72,0X8C73,0X8C74,0X8C75,0X8C76,0X8C77,0X8C78,0X8C79,0X8C7A,0X8C7B,0X8C7C,0X8C7D,0X8C7E,0X8C7F,
-0X8C80,0X8C81,0X8C82,0X8C83,0X8C84,0X8C85,0X8C86,0X8C87,0X8C88,0X8C89,0X8C8A,0X8C8B,0X8C8C,0X8C8D,0X8C8E,0X8C8F,
-0X8C90,0X8C91,0X8C92,0X8C93,0X8C94,0X8C95,0X8C96,0X8C97,0X8C98,0X8C99,0X8C9A,0X8C9B,0X8C9C,0X8C9D,0X8C9E,0X8C9F,
-0X8CA0,0X8CA1,0X8CA2,0X8CA3,0X8CA4,0X8CA5,0X8CA6,0X8CA7,0X8CA8,0X8CA9,0X8CAA,0X8CAB,0X8CAC,0X8CAD,0X8CAE,0X8CAF,
-0X8CB0,0X8CB1,0X8CB2,0X8CB3,0X8CB4,0X8CB5,0X8CB6,0X8CB7,0X8CB8,0X8CB9,0X8CBA,0X8CBB,0X8CBC,0X8CBD,0X8CBE,0X8CBF,
-0X8CC0,0X8CC1,0X8CC2,0X8CC3,0X8CC4,0X8CC5,0X8CC6,0X8CC7,0X8CC8,0X8CC9,0X8CCA,0X8CCB,0X8CCC,0X8CCD,0X8CCE,0X8CCF,
-0X8CD0,0X8CD1,0X8CD2,0X8CD3,0X8CD4,0X8CD5,0X8CD6,0X8CD7,0X8CD8,0X8CD9,0X8CDA,0X8CDB,0X8CDC,0X8CDD,0X8CDE,0X8CDF,
-0X8CE0,0X8CE1,0X8CE2,0X8CE3,0X8CE4,0X8CE5,0X8CE6,0X8CE7,0X8CE8,0X8CE9,0X8CEA,0X8CEB,0X8CEC,0X8CED,0X8CEE,0X8CEF,
-0X8CF0,0X8CF1,0X8CF2,0X8CF3,0X8CF4,0X8CF5,0X8CF6,0X8CF7,0X8CF8,0X8CF9,0X8CFA,0X8CFB,0X8CFC,0X8CFD,0X8CFE,0X8CFF,
-0X8D40,0X8D41,0X8D42,0X8D43,0X8D44,0X8D45,0X8D46,0X8D47,0X8D48,0X8D49,0X8D4A,0X8D4B,0X8D4C,0X8D4D,0X8D4E,0X8D4F,
-0X8D50,0X8D51,0X8D52,0X8D53,0X8D54,0X8D55,0X8D56,0X8D57,0X8D58,0X8D59,0X8D5A,0X8D5B,0X8D5C,0X8D5D,0X8D5E,0X8D5F,
-0X8D60,0X8D61,0X8D62,0X8D63,0X8D64,0X8D65,0X8D66,0X8D67,0X8D68,0X8D69,0X8D6A,0X8D6B,0X8D6C,0X8D6D,0X8D6E,0X8D6F,
-0X8D70,0X8D71,0X8D72,0X8D73,0X8D74,0X8D75,0X8D76,0X8D77,0X8D78,0X8D79,0X8D7A,0X8D7B,0X8D7C,0X8D7D,0X8D7E,0X8D7F,
-0X8D80,0X8D81,0X8D82,0X8D83,0X8D84,0X8D85,0X8D86,0X8D87,0X8D88,0X8D89,0X8D8A,0X8D8B,0X8D8C,0X8D8D,0X8D8E,0X8D8F,
-0X8D90,0X8D91,0X8D92,0X8D93,0X8D94,0X8D95,0X8D96,0X8D97,0X8D98,0X8D99,0X8D9A,0X8D9B,0X8D9C,0X8D9D,0X8D9E,0X8D9F,
-0X8DA0,0X8DA1,0X8DA2,0X8DA3,0X8DA4,0X8DA5,0X8DA6,0X8DA7,0X8DA8,0X8DA9,0X8DAA,0X8DAB,0X8DAC,0X8DAD,0X8DAE,0X8DAF,
-0X8DB0,0X8DB1,0X8DB2,0X8DB3,0X8DB4,0X8DB5,0X8DB6,0X8DB7,0X8DB8,0X8DB9,0X8DBA,0X8DBB,0X8DBC,0X8DBD,0X8DBE,0X8DBF,
-0X8DC0,0X8DC1,0X8DC2,0X8DC3,0X8DC4,0X8DC5,0X8DC6,0X8DC7,0X8DC8,0X8DC9,0X8DCA,0X8DCB,0X8DCC,0X8DCD,0X8DCE,0X8DCF,
-0X8DD0,0X8DD1,0X8DD2,0X8DD3,0X8DD4,0X8DD5,0X8DD6,0X8DD7,0X8DD8,0X8DD9,0X8DDA,0X8DDB,0X8DDC,0X8DDD,0X8DDE,0X8DDF,
-0X8DE0,0X8DE1,0X8DE2,0X8DE3,0X8DE4,0X8DE5,0X8DE6,0X8DE7,0X8DE8,0X8DE9,0X8DEA,0X8DEB,0X8DEC,0X8DED,0X8DEE,0X8DEF,
-0X8DF0,0X8DF1,0X8DF2,0X8DF3,0X8DF4,0X8DF5,0X8DF6,0X8DF7,0X8DF8,0X8DF9,0X8DFA,0X8DFB,0X8DFC,0X8DFD,0X8DFE,0X8DFF,
-0X8E40,0X8E41,0X8E42,0X8E43,0X8E44,0X8E45,0X8E46,0X8E47,0X8E48,0X8E49,0X8E4A,0X8E4B,0X8E4C,0X8E4D,0X8E4E,0X8E4F,
-0X8E50,0X8E51,0X8E52,0X8E53,0X8E54,0X8E55,0X8E56,0X8E57,0X8E58,0X8E59,0X8E5A,0X8E5B,0X8E5C,0X8E5D,0X8E5E,0X8E5F,
-0X8E60,0X8E61,0X8E62,0X8E63,0X8E64,0X8E65,0X8E66,0X8E67,0X8E68,0X8E69,0X8E6A,0X8E6B,0X8E6C,0X8E6D,0X8E6E,0X8E6F,
-0X8E70,0X8E71,0X8E72,0X8E73,0X8E74,0X8E75,0X8E76,0X8E77,0X8E78,0X8E79,0X8E7A,0X8E7B,0X8E7C,0X8E7D,0X8E7E,0X8E7F,
-0X8E80,0X8E81,0X8E82,0X8E83,0X8E84,0X8E85,0X8E86,0X8E87,0X8E88,0X8E89,0X8E8A,0X8E8B,0X8E8C,0X8E8D,0X8E8E,0X8E8F,
-0X8E90,0X8E91,0X8E92,0X8E93,0X8E94,0X8E95,0X8E96,0X8E97,0X8E98,0X8E99,0X8E9A,0X8E9B,0X8E9C,0X8E9D,0X8E9E,0X8E9F,
-0X8EA0,0X8EA1,0X8EA2,0X8EA3,0X8EA4,0X8EA5,0X8EA6,0X8EA7,0X8EA8,0X8EA9,0X8EAA,0X8EAB,0X8EAC,0X8EAD,0X8EAE,0X8EAF,
-0X8EB0,0X8EB1,0X8EB2,0X8EB3,0X8EB4,0X8EB5,0X8EB6,0X8EB7,0X8EB8,0X8EB9,0X8EBA,0X8EBB,0X8EBC,0X8EBD,0X8EBE,0X8EBF,
-0X8EC0,0X8EC1,0X8EC2,0X8EC3,0X8EC4,0X8EC5,0X8EC6,0X8EC7,0X8EC8,0X8EC9,0X8ECA,0X8ECB,0X8ECC,0X8ECD,0X8ECE,0X8ECF,
-0X8ED0,0X8ED1,0X8ED2,0X8ED3,0X8ED4,0X8ED5,0X8ED6,0X8ED7,0X8ED8,0X8ED9,0X8EDA,0X8EDB,0X8EDC,0X8EDD,0X8EDE,0X8EDF,
-0X8EE0,0X8EE1,0X8EE2,0X8EE3,0X8EE4,0X8EE5,0X8EE6,0X8EE7,0X8EE8,0X8EE9,0X8EEA,0X8EEB,0X8EEC,0X8EED,0X8EEE,0X8EEF,
-0X8EF0,0X8EF1,0X8EF2,0X8EF3,0X8EF4,0X8EF5,0X8EF6,0X8EF7,0X8EF8,0X8EF9,0X8EFA,0X8EFB,0X8EFC,0X8EFD,0X8EFE,0X8EFF,
-0X8F40,0X8F41,0X8F42,0X8F43,0X8F44,0X8F45,0X8F46,0X8F47,0X8F48,0X8F49,0X8F4A,0X8F4B,0X8F4C,0X8F4D,0X8F4E,0X8F4F,
-0X8F50,0X8F51,0X8F52,0X8F53,0X8F54,0X8F55,0X8F56,0X8F57,0X8F58,0X8F59,0X8F5A,0X8F5B,0X8F5C,0X8F5D,0X8F5E,0X8F5F,
-0X8F60,0X8F61,0X8F62,0X8F63,0X8F64,0X8F65,0X8F66,0X8F67,0X8F68,0X8F69,0X8F6A,0X8F6B,0X8F6C,0X8F6D,0X8F6E,0X8F6F,
-0X8F70,0X8F71,0X8F72,0X8F73,0X8F74,0X8F75,0X8F76,0X8F77,0X8F78,0X8F79,0X8F7A,0X8F7B,0X8F7C,0X8F7D,0X8F7E,0X8F7F,
-0X8F80,0X8F81,0X8F82,0X8F83,0X8F84,0X8F85,0X8F86,0X8F87,0X8F88,0X8F89,0X8F8A,0X8F8B,0X8F8C,0X8F8D,0X8F8E,0X8F8F,
-0X8F90,0X8F91,0X8F92,0X8F93,0X8F94,0X8F95,0X8F96,0X8F97,0X8F98,0X8F99,0X8F9A,0X8F9B,0X8F9C,0X8F9D,0X8F9E,0X8F9F,
-0X8FA0,0X8FA1,0X8FA2,0X8FA3,0X8FA4,0X8FA5,0X8FA6,0X8FA7,0X8FA8,0X8FA9,0X8FAA,0X8FAB,0X8FAC,0X8FAD,0X8FAE,0X8FAF,
-0X8FB0,0X8FB1,0X8FB2,0X8FB3,0X8FB4,0X8FB5,0X8FB6,0X8FB7,0X8FB8,0X8FB9,0X8FBA,0X8FBB,0X8FBC,0X8FBD,0X8FBE,0X8FBF,
-0X8FC0,0X8FC1,0X8FC2,0X8FC3,0X8FC4,0X8FC5,0X8FC6,0X8FC7,0X8FC8,0X8FC9,0X8FCA,0X8FCB,0X8FCC,0X8FCD,0X8FCE,0X8FCF,
-0X8FD0,0X8FD1,0X8FD2,0X8FD3,0X8FD4,0X8FD5,0X8FD6,0X8FD7,0X8FD8,0X8FD9,0X8FDA,0X8FDB,0X8FDC,0X8FDD,0X8FDE,0X8FDF,
-0X8FE0,0X8FE1,0X8FE2,0X8FE3,0X8FE4,0X8FE5,0X8FE6,0X8FE7,0X8FE8,0X8FE9,0X8FEA,0X8FEB,0X8FEC,0X8FED,0X8FEE,0X8FEF,
-0X8FF0,0X8FF1,0X8FF2,0X8FF3,0X8FF4,0X8FF5,0X8FF6,0X8FF7,0X8FF8,0X8FF9,0X8FFA,0X8FFB,0X8FFC,0X8FFD,0X8FFE,0X8FFF,
-0X9040,0X9041,0X9042,0X9043,0X9044,0X9045,0X9046,0X9047,0X9048,0X9049,0X904A,0X904B,0X904C,0X904D,0X904E,0X904F,
-0X9050,0X9051,0X9052,0X9053,0X9054,0X9055,0X9056,0X9057,0X9058,0X9059,0X905A,0X905B,0X905C,0X905D,0X905E,0X905F,
-0X9060,0X9061,0X9062,0X9063,0X9064,0X9065,0X9066,0X9067,0X9068,0X9069,0X906A,0X906B,0X906C,0X906D,0X906E,0X906F,
-0X9070,0X9071,0X9072,0X9073,0X9074,0X9075,0X9076,0X9077,0X9078,0X9079,0X907A,0X907B,0X907C,0X907D,0X907E,0X907F,
-0X9080,0X9081,0X9082,0X9083,0X9084,0X9085,0X9086,0X9087,0X9088,0X9089,0X908A,0X908B,0X908C,0X908D,0X908E,0X908F,
-0X9090,0X9091,0X9092,0X9093,0X9094,0X9095,0X9096,0X9097,0X9098,0X9099,0X909A,0X909B,0X909C,0X909D,0X909E,0X909F,
-0X90A0,0X90A1,0X90A2,0X90A3,0X90A4,0X90A5,0X90A6,0X90A7,0X90A8,0X90A9,0X90AA,0X90AB,0X90AC,0X90AD,0X90AE,0X90AF,
-0X90B0,0X90B1,0X90B2,0X90B3,0X90B4,0X90B5,0X90B6,0X90B7,0X90B8,0X90B9,0X90BA,0X90BB,0X90BC,0X90BD,0X90BE,0X90BF,
-0X90C0,0X90C1,0X90C2,0X90C3,0X90C4,0X90C5,0X90C6,0X90C7,0X90C8,0X90C9,0X90CA,0X90CB,0X90CC,0X90CD,0X90CE,0X90CF,
-0X90D0,0X90D1,0X90D2,0X90D3,0X90D4,0X90D5,0X90D6,0X90D7,0X90D8,0X90D9,0X90DA,0X90DB,0X90DC,0X90DD,0X90DE,0X90DF,
-0X90E0,0X90E1,0X90E2,0X90E3,0X90E4,0X90E5,0X90E6,0X90E7,0X90E8,0X90E9,0X90EA,0X90EB,0X90EC,0X90ED,0X90EE,0X90EF,
-0X90F0,0X90F1,0X90F2,0X90F3,0X90F4,0X90F5,0X90F6,0X90F7,0X90F8,0X90F9,0X90FA,0X90FB,0X90FC,0X90FD,0X90FE,0X90FF,
-0X9140,0X9141,0X9142,0X9143,0X9144,0X9145,0X9146,0X9147,0X9148,0X9149,0X914A,0X914B,0X914C,0X914D,0X914E,0X914F,
-0X9150,0X9151,0X9152,0X9153,0X9154,0X9155,0X9156,0X9157,0X9158,0X9159,0X915A,0X915B,0X915C,0X915D,0X915E,0X915F,
-0X9160,0X9161,0X9162,0X9163,0X9164,0X9165,0X9166,0X9167,0X9168,0X9169,0X916A,0X916B,0X916C,0X916D,0X916E,0X916F,
-0X9170,0X9171,0X9172,0X9173,0X9174,0X9175,0X9176,0X9177,0X9178,0X9179,0X917A,0X917B,0X917C,0X917D,0X917E,0X917F,
-0X9180,0X9181,0X9182,0X9183,0X9184,0X9185,0X9186,0X9187,0X9188,0X9189,0X918A,0X918B,0X918C,0X918D,0X918E,0X918F,
-0X9190,0X9191,0X9192,0X9193,0X9194,0X9195,0X9196,0X9197,0X9198,0X9199,0X919A,0X919B,0X919C,0X919D,0X919E,0X919F,
-0X91A0,0X91A1,0X91A2,0X91A3,0X91A4,0X91A5,0X91A6,0X91A7,0X91A8,0X91A9,0X91AA,0X91AB,0X91AC,0X91AD,0X91AE,0X91AF,
-0X91B0,0X91B1,0X91B2,0X91B3,0X91B4,0X91B5,0X91B6,0X91B7,0X91B8,0X91B9,0X91BA,0X91BB,0X91BC,0X91BD,0X91BE,0X91BF,
-0X91C0,0X91C1,0X91C2,0X91C3,0X91C4,0X91C5,0X91C6,0X91C7,0X91C8,0X91C9,0X91CA,0X91CB,0X91CC,0X91CD,0X91CE,0X91CF,
-0X91D0,0X91D1,0X91D2,0X91D3,0X91D4,0X91D5,0X91D6,0X91D7,0X91D8,0X91D9,0X91DA,0X91DB,0X91DC,0X91DD,0X91DE,0X91DF,
-0X91E0,0X91E1,0X91E2,0X91E3,0X91E4,0X91E5,0X91E6,0X91E7,0X91E8,0X91E9,0X91EA,0X91EB,0X91EC,0X91ED,0X91EE,0X91EF,
-0X91F0,0X91F1,0X91F2,0X91F3,0X91F4,0X91F5,0X91F6,0X91F7,0X91F8,0X91F9,0X91FA,0X91FB,0X91FC,0X91FD,0X91FE,0X91FF,
-0X9240,0X9241,0X9242,0X9243,0X9244,0X9245,0X9246,0X9247,0X9248,0X9249,0X924A,0X924B,0X924C,0X924D,0X924E,0X924F,
-0X9250,0X9251,0X9252,0X9253,0X9254,0X9255,0X9256,0X9257,0X9258,0X9259,0X925A,0X925B,0X925C,0X925D,0X925E,0X925F,
-0X9260,0X9261,0X9262,0X9263,0X9264,0X9265,0X9266,0X9267,0X9268,0X9269,0X926A,0X926B,0X926C,0X926D,0X926E,0X926F,
-0X9270,0X9271,0X9272,0X9273,0X9274,0X9275,0X9276,0X9277,0X9278,0X9279,0X927A,0X927B,0X927C,0X927D,0X927E,0X927F,
-0X9280,0X9281,0X9282,0X9283,0X9284,0X9285,0X9286,0X9287,0X9288,0X9289,0X928A,0X928B,0X928C,0X928D,0X928E,0X928F,
-0X9290,0X9291,0X9292,0X9293,0X9294,0X9295,0X9296,0X9297,0X9298,0X9299,0X929A,0X929B,0X929C,0X929D,0X929E,0X929F,
-0X92A0,0X92A1,0X92A2,0X92A3,0X92A4,0X92A5,0X92A6,0X92A7,0X92A8,0X92A9,0X92AA,0X92AB,0X92AC,0X92AD,0X92AE,0X92AF,
-0X92B0,0X92B1,0X92B2,0X92B3,0X92B4,0X92B5,0X92B6,0X92B7,0X92B8,0X92B9,0X92BA,0X92BB,0X92BC,0X92BD,0X92BE,0X92BF,
-0X92C0,0X92C1,0X92C2,0X92C3,0X92C4,0X92C5,0X92C6,0X92C7,0X92C8,0X92C9,0X92CA,0X92CB,0X92CC,0X92CD,0X92CE,0X92CF,
-0X92D0,0X92D1,0X92D2,0X92D3,0X92D4,0X92D5,0X92D6,0X92D7,0X92D8,0X92D9,0X92DA,0X92DB,0X92DC,0X92DD,0X92DE,0X92DF,
-0X92E0,0X92E1,0X92E2,0X92E3,0X92E4,0X92E5,0X92E6,0X92E7,0X92E8,0X92E9,0X92EA,0X92EB,0X92EC,0X92ED,0X92EE,0X92EF,
-0X92F0,0X92F1,0X92F2,0X92F3,0X92F4,0X92F5,0X92F6,0X92F7,0X92F8,0X92F9,0X92FA,0X92FB,0X92FC,0X92FD,0X92FE,0X92FF,
-0X9340,0X9341,0X9342,0X9343,0X9344,0X9345,0X9346,0X9347,0X9348,0X9349,0X934A,0X934B,0X934C,0X934D,0X934E,0X934F,
-0X9350,0X9351,0X9352,0X9353,0X9354,0X9355,0X9356,0X9357,0X9358,0X9359,0X935A,0X935B,0X935C,0X935D,0X935E,0X935F,
-0X9360,0X9361,0X9362,0X9363,0X9364,0X9365,0X9366,0X9367,0X9368,0X9369,0X936A,0X936B,0X936C,0X936D,0X936E,0X936F,
-0X9370,0X9371,0X9372,0X9373,0X9374,0X9375,0X9376,0X9377,0X9378,0X9379,0X937A,0X937B,0X937C,0X937D,0X937E,0X937F,
-0X9380,0X9381,0X9382,0X9383,0X9384,0X9385,0X9386,0X9387,0X9388,0X9389,0X938A,0X938B,0X938C,0X938D,0X938E,0X938F,
-0X9390,0X9391,0X9392,0X9393,0X9394,0X9395,0X9396,0X9397,0X9398,0X9399,0X939A,0X939B,0X939C,0X939D,0X939E,0X939F,
-0X93A0,0X93A1,0X93A2,0X93A3,0X93A4,0X93A5,0X93A6,0X93A7,0X93A8,0X93A9,0X93AA,0X93AB,0X93AC,0X93AD,0X93AE,0X93AF,
-0X93B0,0X93B1,0X93B2,0X93B3,0X93B4,0X93B5,0X93B6,0X93B7,0X93B8,0X93B9,0X93BA,0X93BB,0X93BC,0X93BD,0X93BE,0X93BF,
-0X93C0,0X93C1,0X93C2,0X93C3,0X93C4,0X93C5,0X93C6,0X93C7,0X93C8,0X93C9,0X93CA,0X93CB,0X93CC,0X93CD,0X93CE,0X93CF,
-0X93D0,0X93D1,0X93D2,0X93D3,0X93D4,0X93D5,0X93D6,0X93D7,0X93D8,0X93D9,0X93DA,0X93DB,0X93DC,0X93DD,0X93DE,0X93DF,
-0X93E0,0X93E1,0X93E2,0X93E3,0X93E4,0X93E5,0X93E6,0X93E7,0X93E8,0X93E9,0X93EA,0X93EB,0X93EC,0X93ED,0X93EE,0X93EF,
-0X93F0,0X93F1,0X93F2,0X93F3,0X93F4,0X93F5,0X93F6,0X93F7,0X93F8,0X93F9,0X93FA,0X93FB,0X93FC,0X93FD,0X93FE,0X93FF,
-0X9440,0X9441,0X9442,0X9443,0X9444,0X9445,0X9446,0X9447,0X9448,0X9449,0X944A,0X944B,0X944C,0X944D,0X944E,0X944F,
-0X9450,0X9451,0X9452,0X9453,0X9454,0X9455,0X9456,0X9457,0X9458,0X9459,0X945A,0X945B,0X945C,0X945D,0X945E,0X945F,
-0X9460,0X9461,0X9462,0X9463,0X9464,0X9465,0X9466,0X9467,0X9468,0X9469,0X946A,0X946B,0X946C,0X946D,0X946E,0X946F,
-0X9470,0X9471,0X9472,0X9473,0X9474,0X9475,0X9476,0X9477,0X9478,0X9479,0X947A,0X947B,0X947C,0X947D,0X947E,0X947F,
-0X9480,0X9481,0X9482,0X9483,0X9484,0X9485,0X9486,0X9487,0X9488,0X9489,0X948A,0X948B,0X948C,0X948D,0X948E,0X948F,
-0X9490,0X9491,0X9492,0X9493,0X9494,0X9495,0X9496,0X9497,0X9498,0X9499,0X949A,0X949B,0X949C,0X949D,0X949E,0X949F,
-0X94A0,0X94A1,0X94A2,0X94A3,0X94A4,0X94A5,0X94A6,0X94A7,0X94A8,0X94A9,0X94AA,0X94AB,0X94AC,0X94AD,0X94AE,0X94AF,
-0X94B0,0X94B1,0X94B2,0X94B3,0X94B4,0X94B5,0X94B6,0X94B7,0X94B8,0X94B9,0X94BA,0X94BB,0X94BC,0X94BD,0X94BE,0X94BF,
-0X94C0,0X94C1,0X94C2,0X94C3,0X94C4,0X94C5,0X94C6,0X94C7,0X94C8,0X94C9,0X94CA,0X94CB,0X94CC,0X94CD,0X94CE,0X94CF,
-0X94D0,0X94D1,0X94D2,0X94D3,0X94D4,0X94D5,0X94D6,0X94D7,0X94D8,0X94D9,0X94DA,0X94DB,0X94DC,0X94DD,0X94DE,0X94DF,
-0X94E0,0X94E1,0X94E2,0X94E3,0X94E4,0X94E5,0X94E6,0X94E7,0X94E8,0X94E9,0X94EA,0X94EB,0X94EC,0X94ED,0X94EE,0X94EF,
-0X94F0,0X94F1,0X94F2,0X94F3,0X94F4,0X94F5,0X94F6,0X94F7,0X94F8,0X94F9,0X94FA,0X94FB,0X94FC,0X94FD,0X94FE,0X94FF,
-0X9540,0X9541,0X9542,0X9543,0X9544,0X9545,0X9546,0X9547,0X9548,0X9549,0X954A,0X954B,0X954C,0X954D,0X954E,0X954F,
-0X9550,0X9551,0X9552,0X9553,0X9554,0X9555,0X9556,0X9557,0X9558,0X9559,0X955A,0X955B,0X955C,0X955D,0X955E,0X955F,
-0X9560,0X9561,0X9562,0X9563,0X9564,0X9565,0X9566,0X9567,0X9568,0X9569,0X956A,0X956B,0X956C,0X956D,0X956E,0X956F,
-0X9570,0X9571,0X9572,0X9573,0X9574,0X9575,0X9576,0X9577,0X9578,0X9579,0X957A,0X957B,0X957C,0X957D,0X957E,0X957F,
-0X9580,0X9581,0X9582,0X9583,0X9584,0X9585,0X9586,0X9587,0X9588,0X9589,0X958A,0X958B,0X958C,0X958D,0X958E,0X958F,
-0X9590,0X9591,0X9592,0X9593,0X9594,0X9595,0X9596,0X9597,0X9598,0X9599,0X959A,0X959B,0X959C,0X959D,0X959E,0X959F,
-0X95A0,0X95A1,0X95A2,0X95A3,0X95A4,0X95A5,0X95A6,0X95A7,0X95A8,0X95A9,0X95AA,0X95AB,0X95AC,0X95AD,0X95AE,0X95AF,
-0X95B0,0X95B1,0X95B2,0X95B3,0X95B4,0X95B5,0X95B6,0X95B7,0X95B8,0X95B9,0X95BA,0X95BB,0X95BC,0X95BD,0X95BE,0X95BF,
-0X95C0,0X95C1,0X95C2,0X95C3,0X95C4,0X95C5,0X95C6,0X95C7,0X95C8,0X95C9,0X95CA,0X95CB,0X95CC,0X95CD,0X95CE,0X95CF,
-0X95D0,0X95D1,0X95D2,0X95D3,0X95D4,0X95D5,0X95D6,0X95D7,0X95D8,0X95D9,0X95DA,0X95DB,0X95DC,0X95DD,0X95DE,0X95DF,
-0X95E0,0X95E1,0X95E2,0X95E3,0X95E4,0X95E5,0X95E6,0X95E7,0X95E8,0X95E9,0X95EA,0X95EB,0X95EC,0X95ED,0X95EE,0X95EF,
-0X95F0,0X95F1,0X95F2,0X95F3,0X95F4,0X95F5,0X95F6,0X95F7,0X95F8,0X95F9,0X95FA,0X95FB,0X95FC,0X95FD,0X95FE,0X95FF,
-0X9640,0X9641,0X9642,0X9643,0X9644,0X9645,0X9646,0X9647,0X9648,0X9649,0X964A,0X964B,0X964C,0X964D,0X964E,0X964F,
-0X9650,0X9651,0X9652,0X9653,0X9654,0X9655,0X9656,0X9657,0X9658,0X9659,0X965A,0X965B,0X965C,0X965D,0X965E,0X965F,
-0X9660,0X9661,0X9662,0X9663,0X9664,0X9665,0X9666,0X9667,0X9668,0X9669,0X966A,0X966B,0X966C,0X966D,0X966E,0X966F,
-0X9670,0X9671,0X9672,0X9673,0X9674,0X9675,0X9676,0X9677,0X9678,0X9679,0X967A,0X967B,0X967C,0X967D,0X967E,0X967F,
-0X9680,0X9681,0X9682,0X9683,0X9684,0X9685,0X9686,0X9687,0X9688,0X9689,0X968A,0X968B,0X968C,0X968D,0X968E,0X968F,
-0X9690,0X9691,0X9692,0X9693,0X9694,0X9695,0X9696,0X9697,0X9698,0X9699,0X969A,0X969B,0X969C,0X969D,0X969E,0X969F,
-0X96A0,0X96A1,0X96A2,0X96A3,0X96A4,0X96A5,0X96A6,0X96A7,0X96A8,0X96A9,0X96AA,0X96AB,0X96AC,0X96AD,0X96AE,0X96AF,
-0X96B0,0X96B1,0X96B2,0X96B3,0X96B4,0X96B5,0X96B6,0X96B7,0X96B8,0X96B9,0X96BA,0X96BB,0X96BC,0X96BD,0X96BE,0X96BF,
-0X96C0,0X96C1,0X96C2,0X96C3,0X96C4,0X96C5,0X96C6,0X96C7,0X96C8,0X96C9,0X96CA,0X96CB,0X96CC,0X96CD,0X96CE,0X96CF,
-0X96D0,0X96D1,0X96D2,0X96D3,0X96D4,0X96D5,0X96D6,0X96D7,0X96D8,0X96D9,0X96DA,0X96DB,0X96DC,0X96DD,0X96DE,0X96DF,
-0X96E0,0X96E1,0X96E2,0X96E3,0X96E4,0X96E5,0X96E6,0X96E7,0X96E8,0X96E9,0X96EA,0X96EB,0X96EC,0X96ED,0X96EE,0X96EF,
-0X96F0,0X96F1,0X96F2,0X96F3,0X96F4,0X96F5,0X96F6,0X96F7,0X96F8,0X96F9,0X96FA,0X96FB,0X96FC,0X96FD,0X96FE,0X96FF,
-0X9740,0X9741,0X9742,0X9743,0X9744,0X9745,0X9746,0X9747,0X9748,0X9749,0X974A,0X974B,0X974C,0X974D,0X974E,0X974F,
-0X9750,0X9751,0X9752,0X9753,0X9754,0X9755,0X9756,0X9757,0X9758,0X9759,0X975A,0X975B,0X975C,0X975D,0X975E,0X975F,
-0X9760,0X9761,0X9762,0X9763,0X9764,0X9765,0X9766,0X9767,0X9768,0X9769,0X976A,0X976B,0X976C,0X976D,0X976E,0X976F,
-0X9770,0X9771,0X9772,0X9773,0X9774,0X9775,0X9776,0X9777,0X9778,0X9779,0X977A,0X977B,0X977C,0X977D,0X977E,0X977F,
-0X9780,0X9781,0X9782,0X9783,0X9784,0X9785,0X9786,0X9787,0X9788,0X9789,0X978A,0X978B,0X978C,0X978D,0X978E,0X978F,
-0X9790,0X9791,0X9792,0X9793,0X9794,0X9795,0X9796,0X9797,0X9798,0X9799,0X979A,0X979B,0X979C,0X979D,0X979E,0X979F,
-0X97A0,0X97A1,0X97A2,0X97A3,0X97A4,0X97A5,0X97A6,0X97A7,0X97A8,0X97A9,0X97AA,0X97AB,0X97AC,0X97AD,0X97AE,0X97AF,
-0X97B0,0X97B1,0X97B2,0X97B3,0X97B4,0X97B5,0X97B6,0X97B7,0X97B8,0X97B9,0X97BA,0X97BB,0X97BC,0X97BD,0X97BE,0X97BF,
-0X97C0,0X97C1,0X97C2,0X97C3,0X97C4,0X97C5,0X97C6,0X97C7,0X97C8,0X97C9,0X97CA,0X97CB,0X97CC,0X97CD,0X97CE,0X97CF,
-0X97D0,0X97D1,0X97D2,0X97D3,0X97D4,0X97D5,0X97D6,0X97D7,0X97D8,0X97D9,0X97DA,0X97DB,0X97DC,0X97DD,0X97DE,0X97DF,
-0X97E0,0X97E1,0X97E2,0X97E3,0X97E4,0X97E5,0X97E6,0X97E7,0X97E8,0X97E9,0X97EA,0X97EB,0X97EC,0X97ED,0X97EE,0X97EF,
-0X97F0,0X97F1,0X97F2,0X97F3,0X97F4,0X97F5,0X97F6,0X97F7,0X97F8,0X97F9,0X97FA,0X97FB,0X97FC,0X97FD,0X97FE,0X97FF,
-0X9840,0X9841,0X9842,0X9843,0X9844,0X9845,0X9846,0X9847,0X9848,0X9849,0X984A,0X984B,0X984C,0X984D,0X984E,0X984F,
-0X9850,0X9851,0X9852,0X9853,0X9854,0X9855,0X9856,0X9857,0X9858,0X9859,0X985A,0X985B,0X985C,0X985D,0X985E,0X985F,
-0X9860,0X9861,0X9862,0X9863,0X9864,0X9865,0X9866,0X9867,0X9868,0X9869,0X986A,0X986B,0X986C,0X986D,0X986E,0X986F,
-0X9870,0X9871,0X9872,0X9873,0X9874,0X9875,0X9876,0X9877,0X9878,0X9879,0X987A,0X987B,0X987C,0X987D,0X987E,0X987F,
-0X9880,0X9881,0X9882,0X9883,0X9884,0X9885,0X9886,0X9887,0X9888,0X9889,0X988A,0X988B,0X988C,0X988D,0X988E,0X988F,
-0X9890,0X9891,0X9892,0X9893,0X9894,0X9895,0X9896,0X9897,0X9898,0X9899,0X989A,0X989B,0X989C,0X989D,0X989E,0X989F,
-0X98A0,0X98A1,0X98A2,0X98A3,0X98A4,0X98A5,0X98A6,0X98A7,0X98A8,0X98A9,0X98AA,0X98AB,0X98AC,0X98AD,0X98AE,0X98AF,
-0X98B0,0X98B1,0X98B2,0X98B3,0X98B4,0X98B5,0X98B6,0X98B7,0X98B8,0X98B9,0X98BA,0X98BB,0X98BC,0X98BD,0X98BE,0X98BF,
-0X98C0,0X98C1,0X98C2,0X98C3,0X98C4,0X98C5,0X98C6,0X98C7,0X98C8,0X98C9,0X98CA,0X98CB,0X98CC,0X98CD,0X98CE,0X98CF,
-0X98D0,0X98D1,0X98D2,0X98D3,0X98D4,0X98D5,0X98D6,0X98D7,0X98D8,0X98D9,0X98DA,0X98DB,0X98DC,0X98DD,0X98DE,0X98DF,
-0X98E0,0X98E1,0X98E2,0X98E3,0X98E4,0X98E5,0X98E6,0X98E7,0X98E8,0X98E9,0X98EA,0X98EB,0X98EC,0X98ED,0X98EE,0X98EF,
-0X98F0,0X98F1,0X98F2,0X98F3,0X98F4,0X98F5,0X98F6,0X98F7,0X98F8,0X98F9,0X98FA,0X98FB,0X98FC,0X98FD,0X98FE,0X98FF,
-0X9940,0X9941,0X9942,0X9943,0X9944,0X9945,0X9946,0X9947,0X9948,0X9949,0X994A,0X994B,0X994C,0X994D,0X994E,0X994F,
-0X9950,0X9951,0X9952,0X9953,0X9954,0X9955,0X9956,0X9957,0X9958,0X9959,0X995A,0X995B,0X995C,0X995D,0X995E,0X995F,
-0X9960,0X9961,0X9962,0X9963,0X9964,0X9965,0X9966,0X9967,0X9968,0X9969,0X996A,0X996B,0X996C,0X996D,0X996E,0X996F,
-0X9970,0X9971,0X9972,0X9973,0X9974,0X9975,0X9976,0X9977,0X9978,0X9979,0X997A,0X997B,0X997C,0X997D,0X997E,0X997F,
-0X9980,0X9981,0X9982,0X9983,0X9984,0X9985,0X9986,0X9987,0X9988,0X9989,0X998A,0X998B,0X998C,0X998D,0X998E,0X998F,
-0X9990,0X9991,0X9992,0X9993,0X9994,0X9995,0X9996,0X9997,0X9998,0X9999,0X999A,0X999B,0X999C,0X999D,0X999E,0X999F,
-0X99A0,0X99A1,0X99A2,0X99A3,0X99A4,0X99A5,0X99A6,0X99A7,0X99A8,0X99A9,0X99AA,0X99AB,0X99AC,0X99AD,0X99AE,0X99AF,
-0X99B0,0X99B1,0X99B2,0X99B3,0X99B4,0X99B5,0X99B6,0X99B7,0X99B8,0X99B9,0X99BA,0X99BB,0X99BC,0X99BD,0X99BE,0X99BF,
-0X99C0,0X99C1,0X99C2,0X99C3,0X99C4,0X99C5,0X99C6,0X99C7,0X99C8,0X99C9,0X99CA,0X99CB,0X99CC,0X99CD,0X99CE,0X99CF,
-0X99D0,0X99D1,0X99D2,0X99D3,0X99D4,0X99D5,0X99D6,0X99D7,0X99D8,0X99D9,0X99DA,0X99DB,0X99DC,0X99DD,0X99DE,0X99DF,
-0X99E0,0X99E1,0X99E2,0X99E3,0X99E4,0X99E5,0X99E6,0X99E7,0X99E8,0X99E9,0X99EA,0X99EB,0X99EC,0X99ED,0X99EE,0X99EF,
-0X99F0,0X99F1,0X99F2,0X99F3,0X99F4,0X99F5,0X99F6,0X99F7,0X99F8,0X99F9,0X99FA,0X99FB,0X99FC,0X99FD,0X99FE,0X99FF,
-0X9A40,0X9A41,0X9A42,0X9A43,0X9A44,0X9A45,0X9A46,0X9A47,0X9A48,0X9A49,0X9A4A,0X9A4B,0X9A4C,0X9A4D,0X9A4E,0X9A4F,
-0X9A50,0X9A51,0X9A52,0X9A53,0X9A54,0X9A55,0X9A56,0X9A57,0X9A58,0X9A59,0X9A5A,0X9A5B,0X9A5C,0X9A5D,0X9A5E,0X9A5F,
-0X9A60,0X9A61,0X9A62,0X9A63,0X9A64,0X9A65,0X9A66,0X9A67,0X9A68,0X9A69,0X9A6A,0X9A6B,0X9A6C,0X9A6D,0X9A6E,0X9A6F,
-0X9A70,0X9A71,0X9A72,0X9A73,0X9A74,0X9A75,0X9A76,0X9A77,0X9A78,0X9A79,0X9A7A,0X9A7B,0X9A7C,0X9A7D,0X9A7E,0X9A7F,
-0X9A80,0X9A81,0X9A82,0X9A83,0X9A84,0X9A85,0X9A86,0X9A87,0X9A88,0X9A89,0X9A8A,0X9A8B,0X9A8C,0X9A8D,0X9A8E,0X9A8F,
-0X9A90,0X9A91,0X9A92,0X9A93,0X9A94,0X9A95,0X9A96,0X9A97,0X9A98,0X9A99,0X9A9A,0X9A9B,0X9A9C,0X9A9D,0X9A9E,0X9A9F,
-0X9AA0,0X9AA1,0X9AA2,0X9AA3,0X9AA4,0X9AA5,0X9AA6,0X9AA7,0X9AA8,0X9AA9,0X9AAA,0X9AAB,0X9AAC,0X9AAD,0X9AAE,0X9AAF,
-0X9AB0,0X9AB1,0X9AB2,0X9AB3,0X9AB4,0X9AB5,0X9AB6,0X9AB7,0X9AB8,0X9AB9,0X9ABA,0X9ABB,0X9ABC,0X9ABD,0X9ABE,0X9ABF,
-0X9AC0,0X9AC1,0X9AC2,0X9AC3,0X9AC4,0X9AC5,0X9AC6,0X9AC7,0X9AC8,0X9AC9,0X9ACA,0X9ACB,0X9ACC,0X9ACD,0X9ACE,0X9ACF,
-0X9AD0,0X9AD1,0X9AD2,0X9AD3,0X9AD4,0X9AD5,0X9AD6,0X9AD7,0X9AD8,0X9AD9,0X9ADA,0X9ADB,0X9ADC,0X9ADD,0X9ADE,0X9ADF,
-0X9AE0,0X9AE1,0X9AE2,0X9AE3,0X9AE4,0X9AE5,0X9AE6,0X9AE7,0X9AE8,0X9AE9,0X9AEA,0X9AEB,0X9AEC,0X9AED,0X9AEE,0X9AEF,
-0X9AF0,0X9AF1,0X9AF2,0X9AF3,0X9AF4,0X9AF5,0X9AF6,0X9AF7,0X9AF8,0X9AF9,0X9AFA,0X9AFB,0X9AFC,0X9AFD,0X9AFE,0X9AFF,
-0X9B40,0X9B41,0X9B42,0X9B43,0X9B44,0X9B45,0X9B46,0X9B47,0X9B48,0X9B49,0X9B4A,0X9B4B,0X9B4C,0X9B4D,0X9B4E,0X9B4F,
-0X9B50,0X9B51,0X9B52,0X9B53,0X9B54,0X9B55,0X9B56,0X9B57,0X9B58,0X9B59,0X9B5A,0X9B5B,0X9B5C,0X9B5D,0X9B5E,0X9B5F,
-0X9B60,0X9B61,0X9B62,0X9B63,0X9B64,0X9B65,0X9B66,0X9B67,0X9B68,0X9B69,0X9B6A,0X9B6B,0X9B6C,0X9B6D,0X9B6E,0X9B6F,
-0X9B70,0X9B71,0X9B72,0X9B73,0X9B74,0X9B75,0X9B76,0X9B77,0X9B78,0X9B79,0X9B7A,0X9B7B,0X9B7C,0X9B7D,0X9B7E,0X9B7F,
-0X9B80,0X9B81,0X9B82,0X9B83,0X9B84,0X9B85,0X9B86,0X9B87,0X9B88,0X9B89,0X9B8A,0X9B8B,0X9B8C,0X9B8D,0X9B8E,0X9B8F,
-0X9B90,0X9B91,0X9B92,0X9B93,0X9B94,0X9B95,0X9B96,0X9B97,0X9B98,0X9B99,0X9B9A,0X9B9B,0X9B9C,0X9B9D,0X9B9E,0X9B9F,
-0X9BA0,0X9BA1,0X9BA2,0X9BA3,0X9BA4,0X9BA5,0X9BA6,0X9BA7,0X9BA8,0X9BA9,0X9BAA,0X9BAB,0X9BAC,0X9BAD,0X9BAE,0X9BAF,
-0X9BB0,0X9BB1,0X9BB2,0X9BB3,0X9BB4,0X9BB5,0X9BB6,0X9BB7,0X9BB8,0X9BB9,0X9BBA,0X9BBB,0X9BBC,0X9BBD,0X9BBE,0X9BBF,
-0X9BC0,0X9BC1,0X9BC2,0X9BC3,0X9BC4,0X9BC5,0X9BC6,0X9BC7,0X9BC8,0X9BC9,0X9BCA,0X9BCB,0X9BCC,0X9BCD,0X9BCE,0X9BCF,
-0X9BD0,0X9BD1,0X9BD2,0X9BD3,0X9BD4,0X9BD5,0X9BD6,0X9BD7,0X9BD8,0X9BD9,0X9BDA,0X9BDB,0X9BDC,0X9BDD,0X9BDE,0X9BDF,
-0X9BE0,0X9BE1,0X9BE2,0X9BE3,0X9BE4,0X9BE5,0X9BE6,0X9BE7,0X9BE8,0X9BE9,0X9BEA,0X9BEB,0X9BEC,0X9BED,0X9BEE,0X9BEF,
-0X9BF0,0X9BF1,0X9BF2,0X9BF3,0X9BF4,0X9BF5,0X9BF6,0X9BF7,0X9BF8,0X9BF9,0X9BFA,0X9BFB,0X9BFC,0X9BFD,0X9BFE,0X9BFF,
-0X9C40,0X9C41,0X9C42,0X9C43,0X9C44,0X9C45,0X9C46,0X9C47,0X9C48,0X9C49,0X9C4A,0X9C4B,0X9C4C,0X9C4D,0X9C4E,0X9C4F,
-0X9C50,0X9C51,0X9C52,0X9C53,0X9C54,0X9C55,0X9C56,0X9C57,0X9C58,0X9C59,0X9C5A,0X9C5B,0X9C5C,0X9C5D,0X9C5E,0X9C5F,
-0X9C60,0X9C61,0X9C62,0X9C63,0X9C64,0X9C65,0X9C66,0X9C67,0X9C68,0X9C69,0X9C6A,0X9C6B,0X9C6C,0X9C6D,0X9C6E,0X9C6F,
-0X9C70,0X9C71,0X9C72,0X9C73,0X9C74,0X9C75,0X9C76,0X9C77,0X9C78,0X9C79,0X9C7A,0X9C7B,0X9C7C,0X9C7D,0X9C7E,0X9C7F,
-0X9C80,0X9C81,0X9C82,0X9C83,0X9C84,0X9C85,0X9C86,0X9C87,0X9C88,0X9C89,0X9C8A,0X9C8B,0X9C8C,0X9C8D,0X9C8E,0X9C8F,
-0X9C90,0X9C91,0X9C92,0X9C93,0X9C94,0X9C95,0X9C96,0X9C97,0X9C98,0X9C99,0X9C9A,0X9C9B,0X9C9C,0X9C9D,0X9C9E,0X9C9F,
-0X9CA0,0X9CA1,0X9CA2,0X9CA3,0X9CA4,0X9CA5,0X9CA6,0X9CA7,0X9CA8,0X9CA9,0X9CAA,0X9CAB,0X9CAC,0X9CAD,0X9CAE,0X9CAF,
-0X9CB0,0X9CB1,0X9CB2,0X9CB3,0X9CB4,0X9CB5,0X9CB6,0X9CB7,0X9CB8,0X9CB9,0X9CBA,0X9CBB,0X9CBC,0X9CBD,0X9CBE,0X9CBF,
-0X9CC0,0X9CC1,0X9CC2,0X9CC3,0X9CC4,0X9CC5,0X9CC6,0X9CC7,0X9CC8,0X9CC9,0X9CCA,0X9CCB,0X9CCC,0X9CCD,0X9CCE,0X9CCF,
-0X9CD0,0X9CD1,0X9CD2,0X9CD3,0X9CD4,0X9CD5,0X9CD6,0X9CD7,0X9CD8,0X9CD9,0X9CDA,0X9CDB,0X9CDC,0X9CDD,0X9CDE,0X9CDF,
-0X9CE0,0X9CE1,0X9CE2,0X9CE3,0X9CE4,0X9CE5,0X9CE6,0X9CE7,0X9CE8,0X9CE9,0X9CEA,0X9CEB,0X9CEC,0X9CED,0X9CEE,0X9CEF,
-0X9CF0,0X9CF1,0X9CF2,0X9CF3,0X9CF4,0X9CF5,0X9CF6,0X9CF7,0X9CF8,0X9CF9,0X9CFA,0X9CFB,0X9CFC,0X9CFD,0X9CFE,0X9CFF,
-0X9D40,0X9D41,0X9D42,0X9D43,0X9D44,0X9D45,0X9D46,0X9D47,0X9D48,0X9D49,0X9D4A,0X9D4B,0X9D4C,0X9D4D,0X9D4E,0X9D4F,
-0X9D50,0X9D51,0X9D52,0X9D53,0X9D54,0X9D55,0X9D56,0X9D57,0X9D58,0X9D59,0X9D5A,0X9D5B,0X9D5C,0X9D5D,0X9D5E,0X9D5F,
-0X9D60,0X9D61,0X9D62,0X9D63,0X9D64,0X9D65,0X9D66,0X9D67,0X9D68,0X9D69,0X9D6A,0X9D6B,0X9D6C,0X9D6D,0X9D6E,0X9D6F,
-0X9D70,0X9D71,0X9D72,0X9D73,0X9D74,0X9D75,0X9D76,0X9D77,0X9D78,0X9D79,0X9D7A,0X9D7B,0X9D7C,0X9D7D,0X9D7E,0X9D7F,
-0X9D80,0X9D81,0X9D82,0X9D83,0X9D84,0X9D85,0X9D86,0X9D87,0X9D88,0X9D89,0X9D8A,0X9D8B,0X9D8C,0X9D8D,0X9D8E,0X9D8F,
-0X9D90,0X9D91,0X9D92,0X9D93,0X9D94,0X9D95,0X9D96,0X9D97,0X9D98,0X9D99,0X9D9A,0X9D9B,0X9D9C,0X9D9D,0X9D9E,0X9D9F,
-0X9DA0,0X9DA1,0X9DA2,0X9DA3,0X9DA4,0X9DA5,0X9DA6,0X9DA7,0X9DA8,0X9DA9,0X9DAA,0X9DAB,0X9DAC,0X9DAD,0X9DAE,0X9DAF,
-0X9DB0,0X9DB1,0X9DB2,0X9DB3,0X9DB4,0X9DB5,0X9DB6,0X9DB7,0X9DB8,0X9DB9,0X9DBA,0X9DBB,0X9DBC,0X9DBD,0X9DBE,0X9DBF,
-0X9DC0,0X9DC1,0X9DC2,0X9DC3,0X9DC4,0X9DC5,0X9DC6,0X9DC7,0X9DC8,0X9DC9,0X9DCA,0X9DCB,0X9DCC,0X9DCD,0X9DCE,0X9DCF,
-0X9DD0,0X9DD1,0X9DD2,0X9DD3,0X9DD4,0X9DD5,0X9DD6,0X9DD7,0X9DD8,0X9DD9,0X9DDA,0X9DDB,0X9DDC,0X9DDD,0X9DDE,0X9DDF,
-0X9DE0,0X9DE1,0X9DE2,0X9DE3,0X9DE4,0X9DE5,0X9DE6,0X9DE7,0X9DE8,0X9DE9,0X9DEA,0X9DEB,0X9DEC,0X9DED,0X9DEE,0X9DEF,
-0X9DF0,0X9DF1,0X9DF2,0X9DF3,0X9DF4,0X9DF5,0X9DF6,0X9DF7,0X9DF8,0X9DF9,0X9DFA,0X9DFB,0X9DFC,0X9DFD,0X9DFE,0X9DFF,
-0X9E40,0X9E41,0X9E42,0X9E43,0X9E44,0X9E45,0X9E46,0X9E47,0X9E48,0X9E49,0X9E4A,0X9E4B,0X9E4C,0X9E4D,0X9E4E,0X9E4F,
-0X9E50,0X9E51,0X9E52,0X9E53,0X9E54,0X9E55,0X9E56,0X9E57,0X9E58,0X9E59,0X9E5A,0X9E5B,0X9E5C,0X9E5D,0X9E5E,0X9E5F,
-0X9E60,0X9E61,0X9E62,0X9E63,0X9E64,0X9E65,0X9E66,0X9E67,0X9E68,0X9E69,0X9E6A,0X9E6B,0X9E6C,0X9E6D,0X9E6E,0X9E6F,
-0X9E70,0X9E71,0X9E72,0X9E73,0X9E74,0X9E75,0X9E76,0X9E77,0X9E78,0X9E79,0X9E7A,0X9E7B,0X9E7C,0X9E7D,0X9E7E,0X9E7F,
-0X9E80,0X9E81,0X9E82,0X9E83,0X9E84,0X9E85,0X9E86,0X9E87,0X9E88,0X9E89,0X9E8A,0X9E8B,0X9E8C,0X9E8D,0X9E8E,0X9E8F,
-0X9E90,0X9E91,0X9E92,0X9E93,0X9E94,0X9E95,0X9E96,0X9E97,0X9E98,0X9E99,0X9E9A,0X9E9B,0X9E9C,0X9E9D,0X9E9E,0X9E9F,
-0X9EA0,0X9EA1,0X9EA2,0X9EA3,0X9EA4,0X9EA5,0X9EA6,0X9EA7,0X9EA8,0X9EA9,0X9EAA,0X9EAB,0X9EAC,0X9EAD,0X9EAE,0X9EAF,
-0X9EB0,0X9EB1,0X9EB2,0X9EB3,0X9EB4,0X9EB5,0X9EB6,0X9EB7,0X9EB8,0X9EB9,0X9EBA,0X9EBB,0X9EBC,0X9EBD,0X9EBE,0X9EBF,
-0X9EC0,0X9EC1,0X9EC2,0X9EC3,0X9EC4,0X9EC5,0X9EC6,0X9EC7,0X9EC8,0X9EC9,0X9ECA,0X9ECB,0X9ECC,0X9ECD,0X9ECE,0X9ECF,
-0X9ED0,0X9ED1,0X9ED2,0X9ED3,0X9ED4,0X9ED5,0X9ED6,0X9ED7,0X9ED8,0X9ED9,0X9EDA,0X9EDB,0X9EDC,0X9EDD,0X9EDE,0X9EDF,
-0X9EE0,0X9EE1,0X9EE2,0X9EE3,0X9EE4,0X9EE5,0X9EE6,0X9EE7,0X9EE8,0X9EE9,0X9EEA,0X9EEB,0X9EEC,0X9EED,0X9EEE,0X9EEF,
-0X9EF0,0X9EF1,0X9EF2,0X9EF3,0X9EF4,0X9EF5,0X9EF6,0X9EF7,0X9EF8,0X9EF9,0X9EFA,0X9EFB,0X9EFC,0X9EFD,0X9EFE,0X9EFF,
-0X9F40,0X9F41,0X9F42,0X9F43,0X9F44,0X9F45,0X9F46,0X9F47,0X9F48,0X9F49,0X9F4A,0X9F4B,0X9F4C,0X9F4D,0X9F4E,0X9F4F,
-0X9F50,0X9F51,0X9F52,0X9F53,0X9F54,0X9F55,0X9F56,0X9F57,0X9F58,0X9F59,0X9F5A,0X9F5B,0X9F5C,0X9F5D,0X9F5E,0X9F5F,
-0X9F60,0X9F61,0X9F62,0X9F63,0X9F64,0X9F65,0X9F66,0X9F67,0X9F68,0X9F69,0X9F6A,0X9F6B,0X9F6C,0X9F6D,0X9F6E,0X9F6F,
-0X9F70,0X9F71,0X9F72,0X9F73,0X9F74,0X9F75,0X9F76,0X9F77,0X9F78,0X9F79,0X9F7A,0X9F7B,0X9F7C,0X9F7D,0X9F7E,0X9F7F,
-0X9F80,0X9F81,0X9F82,0X9F83,0X9F84,0X9F85,0X9F86,0X9F87,0X9F88,0X9F89,0X9F8A,0X9F8B,0X9F8C,0X9F8D,0X9F8E,0X9F8F,
-0X9F90,0X9F91,0X9F92,0X9F93,0X9F94,0X9F95,0X9F96,0X9F97,0X9F98,0X9F99,0X9F9A,0X9F9B,0X9F9C,0X9F9D,0X9F9E,0X9F9F,
-0X9FA0,0X9FA1,0X9FA2,0X9FA3,0X9FA4,0X9FA5,0X9FA6,0X9FA7,0X9FA8,0X9FA9,0X9FAA,0X9FAB,0X9FAC,0X9FAD,0X9FAE,0X9FAF,
-0X9FB0,0X9FB1,0X9FB2,0X9FB3,0X9FB4,0X9FB5,0X9FB6,0X9FB7,0X9FB8,0X9FB9,0X9FBA,0X9FBB,0X9FBC,0X9FBD,0X9FBE,0X9FBF,
-0X9FC0,0X9FC1,0X9FC2,0X9FC3,0X9FC4,0X9FC5,0X9FC6,0X9FC7,0X9FC8,0X9FC9,0X9FCA,0X9FCB,0X9FCC,0X9FCD,0X9FCE,0X9FCF,
-0X9FD0,0X9FD1,0X9FD2,0X9FD3,0X9FD4,0X9FD5,0X9FD6,0X9FD7,0X9FD8,0X9FD9,0X9FDA,0X9FDB,0X9FDC,0X9FDD,0X9FDE,0X9FDF,
-0X9FE0,0X9FE1,0X9FE2,0X9FE3,0X9FE4,0X9FE5,0X9FE6,0X9FE7,0X9FE8,0X9FE9,0X9FEA,0X9FEB,0X9FEC,0X9FED,0X9FEE,0X9FEF,
-0X9FF0,0X9FF1,0X9FF2,0X9FF3,0X9FF4,0X9FF5,0X9FF6,0X9FF7,0X9FF8,0X9FF9,0X9FFA,0X9FFB,0X9FFC,0X9FFD,0X9FFE,0X9FFF,
-0XA040,0XA041,0XA042,0XA043,0XA044,0XA045,0XA046,0XA047,0XA048,0XA049,0XA04A,0XA04B,0XA04C,0XA04D,0XA04E,0XA04F,
-0XA050,0XA051,0XA052,0XA053,0XA054,0XA055,0XA056,0XA057,0XA058,0XA059,0XA05A,0XA05B,0XA05C,0XA05D,0XA05E,0XA05F,
-0XA060,0XA061,0XA062,0XA063,0XA064,0XA065,0XA066,0XA067,0XA068,0XA069,0XA06A,0XA06B,0XA06C,0XA06D,0XA06E,0XA06F,
-0XA070,0XA071,0XA072,0XA073,0XA074,0XA075,0XA076,0XA077,0XA078,0XA079,0XA07A,0XA07B,0XA07C,0XA07D,0XA07E,0XA07F,
-0XA080,0XA081,0XA082,0XA083,0XA084,0XA085,0XA086,0XA087,0XA088,0XA089,0XA08A,0XA08B,0XA08C,0XA08D,0XA08E,0XA08F,
-0XA090,0XA091,0XA092,0XA093,0XA094,0XA095,0XA096,0XA097,0XA098,0XA099,0XA09A,0XA09B,0XA09C,0XA09D,0XA09E,0XA09F,
-0XA0A0,0XA0A1,0XA0A2,0XA0A3,0XA0A4,0XA0A5,0XA0A6,0XA0A7,0XA0A8,0XA0A9,0XA0AA,0XA0AB,0XA0AC,0XA0AD,0XA0AE,0XA0AF,
-0XA0B0,0XA0B1,0XA0B2,0XA0B3,0XA0B4,0XA0B5,0XA0B6,0XA0B7,0XA0B8,0XA0B9,0XA0BA,0XA0BB,0XA0BC,0XA0BD,0XA0BE,0XA0BF,
-0XA0C0,0XA0C1,0XA0C2,0XA0C3,0XA0C4,0XA0C5,0XA0C6,0XA0C7,0XA0C8,0XA0C9,0XA0CA,0XA0CB,0XA0CC,0XA0CD,0XA0CE,0XA0CF,
-0XA0D0,0XA0D1,0XA0D2,0XA0D3,0XA0D4,0XA0D5,0XA0D6,0XA0D7,0XA0D8,0XA0D9,0XA0DA,0XA0DB,0XA0DC,0XA0DD,0XA0DE,0XA0DF,
-0XA0E0,0XA0E1,0XA0E2,0XA0E3,0XA0E4,0XA0E5,0XA0E6,0XA0E7,0XA0E8,0XA0E9,0XA0EA,0XA0EB,0XA0EC,0XA0ED,0XA0EE,0XA0EF,
-0XA0F0,0XA0F1,0XA0F2,0XA0F3,0XA0F4,0XA0F5,0XA0F6,0XA0F7,0XA0F8,0XA0F9,0XA0FA,0XA0FB,0XA0FC,0XA0FD,0XA0FE,0XA0FF,
-0XA140,0XA141,0XA142,0XA143,0XA144,0XA145,0XA146,0XA147,0XA148,0XA149,0XA14A,0XA14B,0XA14C,0XA14D,0XA14E,0XA14F,
-0XA150,0XA151,0XA152,0XA153,0XA154,0XA155,0XA156,0XA157,0XA158,0XA159,0XA15A,0XA15B,0XA15C,0XA15D,0XA15E,0XA15F,
-0XA160,0XA161,0XA162,0XA163,0XA164,0XA165,0XA166,0XA167,0XA168,0XA169,0XA16A,0XA16B,0XA16C,0XA16D,0XA16E,0XA16F,
-0XA170,0XA171,0XA172,0XA173,0XA174,0XA175,0XA176,0XA177,0XA178,0XA179,0XA17A,0XA17B,0XA17C,0XA17D,0XA17E,0XA17F,
-0XA180,0XA181,0XA182,0XA183,0XA184,0XA185,0XA186,0XA187,0XA188,0XA189,0XA18A,0XA18B,0XA18C,0XA18D,0XA18E,0XA18F,
-0XA190,0XA191,0XA192,0XA193,0XA194,0XA195,0XA196,0XA197,0XA198,0XA199,0XA19A,0XA19B,0XA19C,0XA19D,0XA19E,0XA19F,
-0XA1A0,0XA1A1,0XA1A2,0XA1A3,0XA1A4,0XA1A5,0XA1A6,0XA1A7,0XA1A8,0XA1A9,0XA1AA,0XA1AB,0XA1AC,0XA1AD,0XA1AE,0XA1AF,
-0XA1B0,0XA1B1,0XA1B2,0XA1B3,0XA1B4,0XA1B5,0XA1B6,0XA1B7,0XA1B8,0XA1B9,0XA1BA,0XA1BB,0XA1BC,0XA1BD,0XA1BE,0XA1BF,
-0XA1C0,0XA1C1,0XA1C2,0XA1C3,0XA1C4,0XA1C5,0XA1C6,0XA1C7,0XA1C8,0XA1C9,0XA1CA,0XA1CB,0XA1CC,0XA1CD,0XA1CE,0XA1CF,
-0XA1D0,0XA1D1,0XA1D2,0XA1D3,0XA1D4,0XA1D5,0XA1D6,0XA1D7,0XA1D8,0XA1D9,0XA1DA,0XA1DB,0XA1DC,0XA1DD,0XA1DE,0XA1DF,
-0XA1E0,0XA1E1,0XA1E2,0XA1E3,0XA1E4,0XA1E5,0XA1E6,0XA1E7,0XA1E8,0XA1E9,0XA1EA,0XA1EB,0XA1EC,0XA1ED,0XA1EE,0XA1EF,
-0XA1F0,0XA1F1,0XA1F2,0XA1F3,0XA1F4,0XA1F5,0XA1F6,0XA1F7,0XA1F8,0XA1F9,0XA1FA,0XA1FB,0XA1FC,0XA1FD,0XA1FE,0XA1FF,
-0XA240,0XA241,0XA242,0XA243,0XA244,0XA245,0XA246,0XA247,0XA248,0XA249,0XA24A,0XA24B,0XA24C,0XA24D,0XA24E,0XA24F,
-0XA250,0XA251,0XA252,0XA253,0XA254,0XA255,0XA256,0XA257,0XA258,0XA259,0XA25A,0XA25B,0XA25C,0XA25D,0XA25E,0XA25F,
-0XA260,0XA261,0XA262,0XA263,0XA264,0XA265,0XA266,0XA267,0XA268,0XA269,0XA26A,0XA26B,0XA26C,0XA26D,0XA26E,0XA26F,
-0XA270,0XA271,0XA272,0XA273,0XA274,0XA275,0XA276,0XA277,0XA278,0XA279,0XA27A,0XA27B,0XA27C,0XA27D,0XA27E,0XA27F,
-0XA280,0XA281,0XA282,0XA283,0XA284,0XA285,0XA286,0XA287,0XA288,0XA289,0XA28A,0XA28B,0XA28C,0XA28D,0XA28E,0XA28F,
-0XA290,0XA291,0XA292,0XA293,0XA294,0XA295,0XA296,0XA297,0XA298,0XA299,0XA29A,0XA29B,0XA29C,0XA29D,0XA29E,0XA29F,
-0XA2A0,0XA2A1,0XA2A2,0XA2A3,0XA2A4,0XA2A5,0XA2A6,0XA2A7,0XA2A8,0XA2A9,0XA2AA,0XA2AB,0XA2AC,0XA2AD,0XA2AE,0XA2AF,
-0XA2B0,0XA2B1,0XA2B2,0XA2B3,0XA2B4,0XA2B5,0XA2B6,0XA2B7,0XA2B8,0XA2B9,0XA2BA,0XA2BB,0XA2BC,0XA2BD,0XA2BE,0XA2BF,
-0XA2C0,0XA2C1,0XA2C2,0XA2C3,0XA2C4,0XA2C5,0XA2C6,0XA2C7,0XA2C8,0XA2C9,0XA2CA,0XA2CB,0XA2CC,0XA2CD,0XA2CE,0XA2CF,
-0XA2D0,0XA2D1,0XA2D2,0XA2D3,0XA2D4,0XA2D5,0XA2D6,0XA2D7,0XA2D8,0XA2D9,0XA2DA,0XA2DB,0XA2DC,0XA2DD,0XA2DE,0XA2DF,
-0XA2E0,0XA2E1,0XA2E2,0XA2E3,0XA2E4,0XA2E5,0XA2E6,0XA2E7,0XA2E8,0XA2E9,0XA2EA,0XA2EB,0XA2EC,0XA2ED,0XA2EE,0XA2EF,
-0XA2F0,0XA2F1,0XA2F2,0XA2F3,0XA2F4,0XA2F5,0XA2F6,0XA2F7,0XA2F8,0XA2F9,0XA2FA,0XA2FB,0XA2FC,0XA2FD,0XA2FE,0XA2FF,
-0XA340,0XA341,0XA342,0XA343,0XA344,0XA345,0XA346,0XA347,0XA348,0XA349,0XA34A,0XA34B,0XA34C,0XA34D,0XA34E,0XA34F,
-0XA350,0XA351,0XA352,0XA353,0XA354,0XA355,0XA356,0XA357,0XA358,0XA359,0XA35A,0XA35B,0XA35C,0XA35D,0XA35E,0XA35F,
-0XA360,0XA361,0XA362,0XA363,0XA364,0XA365,0XA366,0XA367,0XA368,0XA369,0XA36A,0XA36B,0XA36C,0XA36D,0XA36E,0XA36F,
-0XA370,0XA371,0XA372,0XA373,0XA374,0XA375,0XA376,0XA377,0XA378,0XA379,0XA37A,0XA37B,0XA37C,0XA37D,0XA37E,0XA37F,
-0XA380,0XA381,0XA382,0XA383,0XA384,0XA385,0XA386,0XA387,0XA388,0XA389,0XA38A,0XA38B,0XA38C,0XA38D,0XA38E,0XA38F,
-0XA390,0XA391,0XA392,0XA393,0XA394,0XA395,0XA396,0XA397,0XA398,0XA399,0XA39A,0XA39B,0XA39C,0XA39D,0XA39E,0XA39F,
-0XA3A0,0XA3A1,0XA3A2,0XA3A3,0XA3A4,0XA3A5,0XA3A6,0XA3A7,0XA3A8,0XA3A9,0XA3AA,0XA3AB,0XA3AC,0XA3AD,0XA3AE,0XA3AF,
-0XA3B0,0XA3B1,0XA3B2,0XA3B3,0XA3B4,0XA3B5,0XA3B6,0XA3B7,0XA3B8,0XA3B9,0XA3BA,0XA3BB,0XA3BC,0XA3BD,0XA3BE,0XA3BF,
-0XA3C0,0XA3C1,0XA3C2,0XA3C3,0XA3C4,0XA3C5,0XA3C6,0XA3C7,0XA3C8,0XA3C9,0XA3CA,0XA3CB,0XA3CC,0XA3CD,0XA3CE,0XA3CF,
-0XA3D0,0XA3D1,0XA3D2,0XA3D3,0XA3D4,0XA3D5,0XA3D6,0XA3D7,0XA3D8,0XA3D9,0XA3DA,0XA3DB,0XA3DC,0XA3DD,0XA3DE,0XA3DF,
-0XA3E0,0XA3E1,0XA3E2,0XA3E3,0XA3E4,0XA3E5,0XA3E6,0XA3E7,0XA3E8,0XA3E9,0XA3EA,0XA3EB,0XA3EC,0XA3ED,0XA3EE,0XA3EF,
-0XA3F0,0XA3F1,0XA3F2,0XA3F3,0XA3F4,0XA3F5,0XA3F6,0XA3F7,0XA3F8,0XA3F9,0XA3FA,0XA3FB,0XA3FC,0XA3FD,0XA3FE,0XA3FF,
-0XA440,0XA441,0XA442,0XA443,0XA444,0XA445,0XA446,0XA447,0XA448,0XA449,0XA44A,0XA44B,0XA44C,0XA44D,0XA44E,0XA44F,
-0XA450,0XA451,0XA452,0XA453,0XA454,0XA455,0XA456,0XA457,0XA458,0XA459,0XA45A,0XA45B,0XA45C,0XA45D,0XA45E,0XA45F,
-0XA460,0XA461,0XA462,0XA463,0XA464,0XA465,0XA466,0XA467,0XA468,0XA469,0XA46A,0XA46B,0XA46C,0XA46D,0XA46E,0XA46F,
-0XA470,0XA471,0XA472,0XA473,0XA474,0XA475,0XA476,0XA477,0XA478,0XA479,0XA47A,0XA47B,0XA47C,0XA47D,0XA47E,0XA47F,
-0XA480,0XA481,0XA482,0XA483,0XA484,0XA485,0XA486,0XA487,0XA488,0XA489,0XA48A,0XA48B,0XA48C,0XA48D,0XA48E,0XA48F,
-0XA490,0XA491,0XA492,0XA493,0XA494,0XA495,0XA496,0XA497,0XA498,0XA499,0XA49A,0XA49B,0XA49C,0XA49D,0XA49E,0XA49F,
-0XA4A0,0XA4A1,0XA4A2,0XA4A3,0XA4A4,0XA4A5,0XA4A6,0XA4A7,0XA4A8,0XA4A9,0XA4AA,0XA4AB,0XA4AC,0XA4AD,0XA4AE,0XA4AF,
-0XA4B0,0XA4B1,0XA4B2,0XA4B3,0XA4B4,0XA4B5,0XA4B6,0XA4B7,0XA4B8,0XA4B9,0XA4BA,0XA4BB,0XA4BC,0XA4BD,0XA4BE,0XA4BF,
-0XA4C0,0XA4C1,0XA4C2,0XA4C3,0XA4C4,0XA4C5,0XA4C6,0XA4C7,0XA4C8,0XA4C9,0XA4CA,0XA4CB,0XA4CC,0XA4CD,0XA4CE,0XA4CF,
-0XA4D0,0XA4D1,0XA4D2,0XA4D3,0XA4D4,0XA4D5,0XA4D6,0XA4D7,0XA4D8,0XA4D9,0XA4DA,0XA4DB,0XA4DC,0XA4DD,0XA4DE,0XA4DF,
-0XA4E0,0XA4E1,0XA4E2,0XA4E3,0XA4E4,0XA4E5,0XA4E6,0XA4E7,0XA4E8,0XA4E9,0XA4EA,0XA4EB,0XA4EC,0XA4ED,0XA4EE,0XA4EF,
-0XA4F0,0XA4F1,0XA4F2,0XA4F3,0XA4F4,0XA4F5,0XA4F6,0XA4F7,0XA4F8,0XA4F9,0XA4FA,0XA4FB,0XA4FC,0XA4FD,0XA4FE,0XA4FF,
-0XA540,0XA541,0XA542,0XA543,0XA544,0XA545,0XA546,0XA547,0XA548,0XA549,0XA54A,0XA54B,0XA54C,0XA54D,0XA54E,0XA54F,
-0XA550,0XA551,0XA552,0XA553,0XA554,0XA555,0XA556,0XA557,0XA558,0XA559,0XA55A,0XA55B,0XA55C,0XA55D,0XA55E,0XA55F,
-0XA560,0XA561,0XA562,0XA563,0XA564,0XA565,0XA566,0XA567,0XA568,0XA569,0XA56A,0XA56B,0XA56C,0XA56D,0XA56E,0XA56F,
-0XA570,0XA571,0XA572,0XA573,0XA574,0XA575,0XA576,0XA577,0XA578,0XA579,0XA57A,0XA57B,0XA57C,0XA57D,0XA57E,0XA57F,
-0XA580,0XA581,0XA582,0XA583,0XA584,0XA585,0XA586,0XA587,0XA588,0XA589,0XA58A,0XA58B,0XA58C,0XA58D,0XA58E,0XA58F,
-0XA590,0XA591,0XA592,0XA593,0XA594,0XA595,0XA596,0XA597,0XA598,0XA599,0XA59A,0XA59B,0XA59C,0XA59D,0XA59E,0XA59F,
-0XA5A0,0XA5A1,0XA5A2,0XA5A3,0XA5A4,0XA5A5,0XA5A6,0XA5A7,0XA5A8,0XA5A9,0XA5AA,0XA5AB,0XA5AC,0XA5AD,0XA5AE,0XA5AF,
-0XA5B0,0XA5B1,0XA5B2,0XA5B3,0XA5B4,0XA5B5,0XA5B6,0XA5B7,0XA5B8,0XA5B9,0XA5BA,0XA5BB,0XA5BC,0XA5BD,0XA5BE,0XA5BF,
-0XA5C0,0XA5C1,0XA5C2,0XA5C3,0XA5C4,0XA5C5,0XA5C6,0XA5C7,0XA5C8,0XA5C9,0XA5CA,0XA5CB,0XA5CC,0XA5CD,0XA5CE,0XA5CF,
-0XA5D0,0XA5D1,0XA5D2,0XA5D3,0XA5D4,0XA5D5,0XA5D6,0XA5D7,0XA5D8,0XA5D9,0XA5DA,0XA5DB,0XA5DC,0XA5DD,0XA5DE,0XA5DF,
-0XA5E0,0XA5E1,0XA5E2,0XA5E3,0XA5E4,0XA5E5,0XA5E6,0XA5E7,0XA5E8,0XA5E9,0XA5EA,0XA5EB,0XA5EC,0XA5ED,0XA5EE,0XA5EF,
-0XA5F0,0XA5F1,0XA5F2,0XA5F3,0XA5F4,0XA5F5,0XA5F6,0XA5F7,0XA5F8,0XA5F9,0XA5FA,0XA5FB,0XA5FC,0XA5FD,0XA5FE,0XA5FF,
-0XA640,0XA641,0XA642,0XA643,0XA644,0XA645,0XA646,0XA647,0XA648,0XA649,0XA64A,0XA64B,0XA64C,0XA64D,0XA64E,0XA64F,
-0XA650,0XA651,0XA652,0XA653,0XA654,0XA655,0XA656,0XA657,0XA658,0XA659,0XA65A,0XA65B,0XA65C,0XA65D,0XA65E,0XA65F,
-0XA660,0XA661,0XA662,0XA663,0XA664,0XA665,0XA666,0XA667,0XA668,0XA669,0XA66A,0XA66B,0XA66C,0XA66D,0XA66E,0XA66F,
-0XA670,0XA671,0XA672,0XA673,0XA674,0XA675,0XA676,0XA677,0XA678,0XA679,0XA67A,0XA67B,0XA67C,0XA67D,0XA67E,0XA67F,
-0XA680,0XA681,0XA682,0XA683,0XA684,0XA685,0XA686,0XA687,0XA688,0XA689,0XA68A,0XA68B,0XA68C,0XA68D,0XA68E,0XA68F,
-0XA690,0XA691,0XA692,0XA693,0XA694,0XA695,0XA696,0XA697,0XA698,0XA699,0XA69A,0XA69B,0XA69C,0XA69D,0XA69E,0XA69F,
-0XA6A0,0XA6A1,0XA6A2,0XA6A3,0XA6A4,0XA6A5,0XA6A6,0XA6A7,0XA6A8,0XA6A9,0XA6AA,0XA6AB,0XA6AC,0XA6AD,0XA6AE,0XA6AF,
-0XA6B0,0XA6B1,0XA6B2,0XA6B3,0XA6B4,0XA6B5,0XA6B6,0XA6B7,0XA6B8,0XA6B9,0XA6BA,0XA6BB,0XA6BC,0XA6BD,0XA6BE,0XA6BF,
-0XA6C0,0XA6C1,0XA6C2,0XA6C3,0XA6C4,0XA6C5,0XA6C6,0XA6C7,0XA6C8,0XA6C9,0XA6CA,0XA6CB,0XA6CC,0XA6CD,0XA6CE,0XA6CF,
-0XA6D0,0XA6D1,0XA6D2,0XA6D3,0XA6D4,0XA6D5,0XA6D6,0XA6D7,0XA6D8,0XA6D9,0XA6DA,0XA6DB,0XA6DC,0XA6DD,0XA6DE,0XA6DF,
-0XA6E0,0XA6E1,0XA6E2,0XA6E3,0XA6E4,0XA6E5,0XA6E6,0XA6E7,0XA6E8,0XA6E9,0XA6EA,0XA6EB,0XA6EC,0XA6ED,0XA6EE,0XA6EF,
-0XA6F0,0XA6F1,0XA6F2,0XA6F3,0XA6F4,0XA6F5,0XA6F6,0XA6F7,0XA6F8,0XA6F9,0XA6FA,0XA6FB,0XA6FC,0XA6FD,0XA6FE,0XA6FF,
-0XA740,0XA741,0XA742,0XA743,0XA744,0XA745,0XA746,0XA747,0XA748,0XA749,0XA74A,0XA74B,0XA74C,0XA74D,0XA74E,0XA74F,
-0XA750,0XA751,0XA752,0XA753,0XA754,0XA755,0XA756,0XA757,0XA758,0XA759,0XA75A,0XA75B,0XA75C,0XA75D,0XA75E,0XA75F,
-0XA760,0XA761,0XA762,0XA763,0XA764,0XA765,0XA766,0XA767,0XA768,0XA769,0XA76A,0XA76B,0XA76C,0XA76D,0XA76E,0XA76F,
-0XA770,0XA771,0XA772,0XA773,0XA774,0XA775,0XA776,0XA777,0XA778,0XA779,0XA77A,0XA77B,0XA77C,0XA77D,0XA77E,0XA77F,
-0XA780,0XA781,0XA782,0XA783,0XA784,0XA785,0XA786,0XA787,0XA788,0XA789,0XA78A,0XA78B,0XA78C,0XA78D,0XA78E,0XA78F,
-0XA790,0XA791,0XA792,0XA793,0XA794,0XA795,0XA796,0XA797,0XA798,0XA799,0XA79A,0XA79B,0XA79C,0XA79D,0XA79E,0XA79F,
-0XA7A0,0XA7A1,0XA7A2,0XA7A3,0XA7A4,0XA7A5,0XA7A6,0XA7A7,0XA7A8,0XA7A9,0XA7AA,0XA7AB,0XA7AC,0XA7AD,0XA7AE,0XA7AF,
-0XA7B0,0XA7B1,0XA7B2,0XA7B3,0XA7B4,0XA7B5,0XA7B6,0XA7B7,0XA7B8,0XA7B9,0XA7BA,0XA7BB,0XA7BC,0XA7BD,0XA7BE,0XA7BF,
-0XA7C0,0XA7C1,0XA7C2,0XA7C3,0XA7C4,0XA7C5,0XA7C6,0XA7C7,0XA7C8,0XA7C9,0XA7CA,0XA7CB,0XA7CC,0XA7CD,0XA7CE,0XA7CF,
-0XA7D0,0XA7D1,0XA7D2,0XA7D3,0XA7D4,0XA7D5,0XA7D6,0XA7D7,0XA7D8,0XA7D9,0XA7DA,0XA7DB,0XA7DC,0XA7DD,0XA7DE,0XA7DF,
-0XA7E0,0XA7E1,0XA7E2,0XA7E3,0XA7E4,0XA7E5,0XA7E6,0XA7E7,0XA7E8,0XA7E9,0XA7EA,0XA7EB,0XA7EC,0XA7ED,0XA7EE,0XA7EF,
-0XA7F0,0XA7F1,0XA7F2,0XA7F3,0XA7F4,0XA7F5,0XA7F6,0XA7F7,0XA7F8,0XA7F9,0XA7FA,0XA7FB,0XA7FC,0XA7FD,0XA7FE,0XA7FF,
-0XA840,0XA841,0XA842,0XA843,0XA844,0XA845,0XA846,0XA847,0XA848,0XA849,0XA84A,0XA84B,0XA84C,0XA84D,0XA84E,0XA84F,
-0XA850,0XA851,0XA852,0XA853,0XA854,0XA855,0XA856,0XA857,0XA858,0XA859,0XA85A,0XA85B,0XA85C,0XA85D,0XA85E,0XA85F,
-0XA860,0XA861,0XA862,0XA863,0XA864,0XA865,0XA866,0XA867,0XA868,0XA869,0XA86A,0XA86B,0XA86C,0XA86D,0XA86E,0XA86F,
-0XA870,0XA871,0XA872,0XA873,0XA874,0XA875,0XA876,0XA877,0XA878,0XA879,0XA87A,0XA87B,0XA87C,0XA87D,0XA87E,0XA87F,
-0XA880,0XA881,0XA882,0XA883,0XA884,0XA885,0XA886,0XA887,0XA888,0XA889,0XA88A,0XA88B,0XA88C,0XA88D,0XA88E,0XA88F,
-0XA890,0XA891,0XA892,0XA893,0XA894,0XA895,0XA896,0XA897,0XA898,0XA899,0XA89A,0XA89B,0XA89C,0XA89D,0XA89E,0XA89F,
-0XA8A0,0XA8A1,0XA8A2,0XA8A3,0XA8A4,0XA8A5,0XA8A6,0XA8A7,0XA8A8,0XA8A9,0XA8AA,0XA8AB,0XA8AC,0XA8AD,0XA8AE,0XA8AF,
-0XA8B0,0XA8B1,0XA8B2,0XA8B3,0XA8B4,0XA8B5,0XA8B6,0XA8B7,0XA8B8,0XA8B9,0XA8BA,0XA8BB,0XA8BC,0XA8BD,0XA8BE,0XA8BF,
-0XA8C0,0XA8C1,0XA8C2,0XA8C3,0XA8C4,0XA8C5,0XA8C6,0XA8C7,0XA8C8,0XA8C9,0XA8CA,0XA8CB,0XA8CC,0XA8CD,0XA8CE,0XA8CF,
-0XA8D0,0XA8D1,0XA8D2,0XA8D3,0XA8D4,0XA8D5,0XA8D6,0XA8D7,0XA8D8,0XA8D9,0XA8DA,0XA8DB,0XA8DC,0XA8DD,0XA8DE,0XA8DF,
-0XA8E0,0XA8E1,0XA8E2,0XA8E3,0XA8E4,0XA8E5,0XA8E6,0XA8E7,0XA8E8,0XA8E9,0XA8EA,0XA8EB,0XA8EC,0XA8ED,0XA8EE,0XA8EF,
-0XA8F0,0XA8F1,0XA8F2,0XA8F3,0XA8F4,0XA8F5,0XA8F6,0XA8F7,0XA8F8,0XA8F9,0XA8FA,0XA8FB,0XA8FC,0XA8FD,0XA8FE,0XA8FF,
-0XA940,0XA941,0XA942,0XA943,0XA944,0XA945,0XA946,0XA947,0XA948,0XA949,0XA94A,0XA94B,0XA94C,0XA94D,0XA94E,0XA94F,
-0XA950,0XA951,0XA952,0XA953,0XA954,0XA955,0XA956,0XA957,0XA958,0XA959,0XA95A,0XA95B,0XA95C,0XA95D,0XA95E,0XA95F,
-0XA960,0XA961,0XA962,0XA963,0XA964,0XA965,0XA966,0XA967,0XA968,0XA969,0XA96A,0XA96B,0XA96C,0XA96D,0XA96E,0XA96F,
-0XA970,0XA971,0XA972,0XA973,0XA974,0XA975,0XA976,0XA977,0XA978,0XA979,0XA97A,0XA97B,0XA97C,0XA97D,0XA97E,0XA97F,
-0XA980,0XA981,0XA982,0XA983,0XA984,0XA985,0XA986,0XA987,0XA988,0XA989,0XA98A,0XA98B,0XA98C,0XA98D,0XA98E,0XA98F,
-0XA990,0XA991,0XA992,0XA993,0XA994,0XA995,0XA996,0XA997,0XA998,0XA999,0XA99A,0XA99B,0XA99C,0XA99D,0XA99E,0XA99F,
-0XA9A0,0XA9A1,0XA9A2,0XA9A3,0XA9A4,0XA9A5,0XA9A6,0XA9A7,0XA9A8,0XA9A9,0XA9AA,0XA9AB,0XA9AC,0XA9AD,0XA9AE,0XA9AF,
-0XA9B0,0XA9B1,0XA9B2,0XA9B3,0XA9B4,0XA9B5,0XA9B6,0XA9B7,0XA9B8,0XA9B9,0XA9BA,0XA9BB,0XA9BC,0XA9BD,0XA9BE,0XA9BF,
-0XA9C0,0XA9C1,0XA9C2,0XA9C3,0XA9C4,0XA9C5,0XA9C6,0XA9C7,0XA9C8,0XA9C9,0XA9CA,0XA9CB,0XA9CC,0XA9CD,0XA9CE,0XA9CF,
-0XA9D0,0XA9D1,0XA9D2,0XA9D3,0XA9D4,0XA9D5,0XA9D6,0XA9D7,0XA9D8,0XA9D9,0XA9DA,0XA9DB,0XA9DC,0XA9DD,0XA9DE,0XA9DF,
-0XA9E0,0XA9E1,0XA9E2,0XA9E3,0XA9E4,0XA9E5,0XA9E6,0XA9E7,0XA9E8,0XA9E9,0XA9EA,0XA9EB,0XA9EC,0XA9ED,0XA9EE,0XA9EF,
-0XA9F0,0XA9F1,0XA9F2,0XA9F3,0XA9F4,0XA9F5,0XA9F6,0XA9F7,0XA9F8,0XA9F9,0XA9FA,0XA9FB,0XA9FC,0XA9FD,0XA9FE,0XA9FF,
-0XAA40,0XAA41,0XAA42,0XAA43,0XAA44,0XAA45,0XAA46,0XAA47,0XAA48,0XAA49,0XAA4A,0XAA4B,0XAA4C,0XAA4D,0XAA4E,0XAA4F,
-0XAA50,0XAA51,0XAA52,0XAA53,0XAA54,0XAA55,0XAA56,0XAA57,0XAA58,0XAA59,0XAA5A,0XAA5B,0XAA5C,0XAA5D,0XAA5E,0XAA5F,
-0XAA60,0XAA61,0XAA62,0XAA63,0XAA64,0XAA65,0XAA66,0XAA67,0XAA68,0XAA69,0XAA6A,0XAA6B,0XAA6C,0XAA6D,0XAA6E,0XAA6F,
-0XAA70,0XAA71,0XAA72,0XAA73,0XAA74,0XAA75,0XAA76,0XAA77,0XAA78,0XAA79,0XAA7A,0XAA7B,0XAA7C,0XAA7D,0XAA7E,0XAA7F,
-0XAA80,0XAA81,0XAA82,0XAA83,0XAA84,0XAA85,0XAA86,0XAA87,0XAA88,0XAA89,0XAA8A,0XAA8B,0XAA8C,0XAA8D,0XAA8E,0XAA8F,
-0XAA90,0XAA91,0XAA92,0XAA93,0XAA94,0XAA95,0XAA96,0XAA97,0XAA98,0XAA99,0XAA9A,0XAA9B,0XAA9C,0XAA9D,0XAA9E,0XAA9F,
-0XAAA0,0XAAA1,0XAAA2,0XAAA3,0XAAA4,0XAAA5,0XAAA6,0XAAA7,0XAAA8,0XAAA9,0XAAAA,0XAAAB,0XAAAC,0XAAAD,0XAAAE,0XAAAF,
-0XAAB0,0XAAB1,0XAAB2,0XAAB3,0XAAB4,0XAAB5,0XAAB6,0XAAB7,0XAAB8,0XAAB9,0XAABA,0XAABB,0XAABC,0XAABD,0XAABE,0XAABF,
-0XAAC0,0XAAC1,0XAAC2,0XAAC3,0XAAC4,0XAAC5,0XAAC6,0XAAC7,0XAAC8,0XAAC9,0XAACA,0XAACB,0XAACC,0XAACD,0XAACE,0XAACF,
-0XAAD0,0XAAD1,0XAAD2,0XAAD3,0XAAD4,0XAAD5,0XAAD6,0XAAD7,0XAAD8,0XAAD9,0XAADA,0XAADB,0XAADC,0XAADD,0XAADE,0XAADF,
-0XAAE0,0XAAE1,0XAAE2,0XAAE3,0XAAE4,0XAAE5,0XAAE6,0XAAE7,0XAAE8,0XAAE9,0XAAEA,0XAAEB,0XAAEC,0XAAED,0XAAEE,0XAAEF,
-0XAAF0,0XAAF1,0XAAF2,0XAAF3,0XAAF4,0XAAF5,0XAAF6,0XAAF7,0XAAF8,0XAAF9,0XAAFA,0XAAFB,0XAAFC,0XAAFD,0XAAFE,0XAAFF,
-0XAB40,0XAB41,0XAB42,0XAB43,0XAB44,0XAB45,0XAB46,0XAB47,0XAB48,0XAB49,0XAB4A,0XAB4B,0XAB4C,0XAB4D,0XAB4E,0XAB4F,
-0XAB50,0XAB51,0XAB52,0XAB53,0XAB54,0XAB55,0XAB56,0XAB57,0XAB58,0XAB59,0XAB5A,0XAB5B,0XAB5C,0XAB5D,0XAB5E,0XAB5F,
-0XAB60,0XAB61,0XAB62,0XAB63,0XAB64,0XAB65,0XAB66,0XAB67,0XAB68,0XAB69,0XAB6A,0XAB6B,0XAB6C,0XAB6D,0XAB6E,0XAB6F,
-0XAB70,0XAB71,0XAB72,0XAB73,0XAB74,0XAB75,0XAB76,0XAB77,0XAB78,0XAB79,0XAB7A,0XAB7B,0XAB7C,0XAB7D,0XAB7E,0XAB7F,
-0XAB80,0XAB81,0XAB82,0XAB83,0XAB84,0XAB85,0XAB86,0XAB87,0XAB88,0XAB89,0XAB8A,0XAB8B,0XAB8C,0XAB8D,0XAB8E,0XAB8F,
-0XAB90,0XAB91,0XAB92,0XAB93,0XAB94,0XAB95,0XAB96,0XAB97,0XAB98,0XAB99,0XAB9A,0XAB9B,0XAB9C,0XAB9D,0XAB9E,0XAB9F,
-0XABA0,0XABA1,0XABA2,0XABA3,0XABA4,0XABA5,0XABA6,0XABA7,0XABA8,0XABA9,0XABAA,0XABAB,0XABAC,0XABAD,0XABAE,0XABAF,
-0XABB0,0XABB1,0XABB2,0XABB3,0XABB4,0XABB5,0XABB6,0XABB7,0XABB8,0XABB9,0XABBA,0XABBB,0XABBC,0XABBD,0XABBE,0XABBF,
-0XABC0,0XABC1,0XABC2,0XABC3,0XABC4,0XABC5,0XABC6,0XABC7,0XABC8,0XABC9,0XABCA,0XABCB,0XABCC,0XABCD,0XABCE,0XABCF,
-0XABD0,0XABD1,0XABD2,0XABD3,0XABD4,0XABD5,0XABD6,0XABD7,0XABD8,0XABD9,0XABDA,0XABDB,0XABDC,0XABDD,0XABDE,0XABDF,
-0XABE0,0XABE1,0XABE2,0XABE3,0XABE4,0XABE5,0XABE6,0XABE7,0XABE8,0XABE9,0XABEA,0XABEB,0XABEC,0XABED,0XABEE,0XABEF,
-0XABF0,0XABF1,0XABF2,0XABF3,0XABF4,0XABF5,0XABF6,0XABF7,0XABF8,0XABF9,0XABFA,0XABFB,0XABFC,0XABFD,0XABFE,0XABFF,
-0XAC40,0XAC41,0XAC42,0XAC43,0XAC44,0XAC45,0XAC46,0XAC47,0XAC48,0XAC49,0XAC4A,0XAC4B,0XAC4C,0XAC4D,0XAC4E,0XAC4F,
-0XAC50,0XAC51,0XAC52,0XAC53,0XAC54,0XAC55,0XAC56,0XAC57,0XAC58,0XAC59,0XAC5A,0XAC5B,0XAC5C,0XAC5D,0XAC5E,0XAC5F,
-0XAC60,0XAC61,0XAC62,0XAC63,0XAC64,0XAC65,0XAC66,0XAC67,0XAC68,0XAC69,0XAC6A,0XAC6B,0XAC6C,0XAC6D,0XAC6E,0XAC6F,
-0XAC70,0XAC71,0XAC72,0XAC73,0XAC74,0XAC75,0XAC76,0XAC77,0XAC78,0XAC79,0XAC7A,0XAC7B,0XAC7C,0XAC7D,0XAC7E,0XAC7F,
-0XAC80,0XAC81,0XAC82,0XAC83,0XAC84,0XAC85,0XAC86,0XAC87,0XAC88,0XAC89,0XAC8A,0XAC8B,0XAC8C,0XAC8D,0XAC8E,0XAC8F,
-0XAC90,0XAC91,0XAC92,0XAC93,0XAC94,0XAC95,0XAC96,0XAC97,0XAC98,0XAC99,0XAC9A,0XAC9B,0XAC9C,0XAC9D,0XAC9E,0XAC9F,
-0XACA0,0XACA1,0XACA2,0XACA3,0XACA4,0XACA5,0XACA6,0XACA7,0XACA8,0XACA9,0XACAA,0XACAB,0XACAC,0XACAD,0XACAE,0XACAF,
-0XACB0,0XACB1,0XACB2,0XACB3,0XACB4,0XACB5,0XACB6,0XACB7,0XACB8,0XACB9,0XACBA,0XACBB,0XACBC,0XACBD,0XACBE,0XACBF,
-0XACC0,0XACC1,0XACC2,0XACC3,0XACC4,0XACC5,0XACC6,0XACC7,0XACC8,0XACC9,0XACCA,0XACCB,0XACCC,0XACCD,0XACCE,0XACCF,
-0XACD0,0XACD1,0XACD2,0XACD3,0XACD4,0XACD5,0XACD6,0XACD7,0XACD8,0XACD9,0XACDA,0XACDB,0XACDC,0XACDD,0XACDE,0XACDF,
-0XACE0,0XACE1,0XACE2,0XACE3,0XACE4,0XACE5,0XACE6,0XACE7,0XACE8,0XACE9,0XACEA,0XACEB,0XACEC,0XACED,0XACEE,0XACEF,
-0XACF0,0XACF1,0XACF2,0XACF3,0XACF4,0XACF5,0XACF6,0XACF7,0XACF8,0XACF9,0XACFA,0XACFB,0XACFC,0XACFD,0XACFE,0XACFF,
-0XAD40,0XAD41,0XAD42,0XAD43,0XAD44,0XAD45,0XAD46,0XAD47,0XAD48,0XAD49,0XAD4A,0XAD4B,0XAD4C,0XAD4D,0XAD4E,0XAD4F,
-0XAD50,0XAD51,0XAD52,0XAD53,0XAD54,0XAD55,0XAD56,0XAD57,0XAD58,0XAD59,0XAD5A,0XAD5B,0XAD5C,0XAD5D,0XAD5E,0XAD5F,
-0XAD60,0XAD61,0XAD62,0XAD63,0XAD64,0XAD65,0XAD66,0XAD67,0XAD68,0XAD69,0XAD6A,0XAD6B,0XAD6C,0XAD6D,0XAD6E,0XAD6F,
-0XAD70,0XAD71,0XAD72,0XAD73,0XAD74,0XAD75,0XAD76,0XAD77,0XAD78,0XAD79,0XAD7A,0XAD7B,0XAD7C,0XAD7D,0XAD7E,0XAD7F,
-0XAD80,0XAD81,0XAD82,0XAD83,0XAD84,0XAD85,0XAD86,0XAD87,0XAD88,0XAD89,0XAD8A,0XAD8B,0XAD8C,0XAD8D,0XAD8E,0XAD8F,
-0XAD90,0XAD91,0XAD92,0XAD93,0XAD94,0XAD95,0XAD96,0XAD97,0XAD98,0XAD99,0XAD9A,0XAD9B,0XAD9C,0XAD9D,0XAD9E,0XAD9F,
-0XADA0,0XADA1,0XADA2,0XADA3,0XADA4,0XADA5,0XADA6,0XADA7,0XADA8,0XADA9,0XADAA,0XADAB,0XADAC,0XADAD,0XADAE,0XADAF,
-0XADB0,0XADB1,0XADB2,0XADB3,0XADB4,0XADB5,0XADB6,0XADB7,0XADB8,0XADB9,0XADBA,0XADBB,0XADBC,0XADBD,0XADBE,0XADBF,
-0XADC0,0XADC1,0XADC2,0XADC3,0XADC4,0XADC5,0XADC6,0XADC7,0XADC8,0XADC9,0XADCA,0XADCB,0XADCC,0XADCD,0XADCE,0XADCF,
-0XADD0,0XADD1,0XADD2,0XADD3,0XADD4,0XADD5,0XADD6,0XADD7,0XADD8,0XADD9,0XADDA,0XADDB,0XADDC,0XADDD,0XADDE,0XADDF,
-0XADE0,0XADE1,0XADE2,0XADE3,0XADE4,0XADE5,0XADE6,0XADE7,0XADE8,0XADE9,0XADEA,0XADEB,0XADEC,0XADED,0XADEE,0XADEF,
-0XADF0,0XADF1,0XADF2,0XADF3,0XADF4,0XADF5,0XADF6,0XADF7,0XADF8,0XADF9,0XADFA,0XADFB,0XADFC,0XADFD,0XADFE,0XADFF,
-0XAE40,0XAE41,0XAE42,0XAE43,0XAE44,0XAE45,0XAE46,0XAE47,0XAE48,0XAE49,0XAE4A,0XAE4B,0XAE4C,0XAE4D,0XAE4E,0XAE4F,
-0XAE50,0XAE51,0XAE52,0XAE53,0XAE54,0XAE55,0XAE56,0XAE57,0XAE58,0XAE59,0XAE5A,0XAE5B,0XAE5C,0XAE5D,0XAE5E,0XAE5F,
-0XAE60,0XAE61,0XAE62,0XAE63,0XAE64,0XAE65,0XAE66,0XAE67,0XAE68,0XAE69,0XAE6A,0XAE6B,0XAE6C,0XAE6D,0XAE6E,0XAE6F,
-0XAE70,0XAE71,0XAE72,0XAE73,0XAE74,0XAE75,0XAE76,0XAE77,0XAE78,0XAE79,0XAE7A,0XAE7B,0XAE7C,0XAE7D,0XAE7E,0XAE7F,
-0XAE80,0XAE81,0XAE82,0XAE83,0XAE84,0XAE85,0XAE86,0XAE87,0XAE88,0XAE89,0XAE8A,0XAE8B,0XAE8C,0XAE8D,0XAE8E,0XAE8F,
-0XAE90,0XAE91,0XAE92,0XAE93,0XAE94,0XAE95,0XAE96,0XAE97,0XAE98,0XAE99,0XAE9A,0XAE9B,0XAE9C,0XAE9D,0XAE9E,0XAE9F,
-0XAEA0,0XAEA1,0XAEA2,0XAEA3,0XAEA4,0XAEA5,0XAEA6,0XAEA7,0XAEA8,0XAEA9,0XAEAA,0XAEAB,0XAEAC,0XAEAD,0XAEAE,0XAEAF,
-0XAEB0,0XAEB1,0XAEB2,0XAEB3,0XAEB4,0XAEB5,0XAEB6,0XAEB7,0XAEB8,0XAEB9,0XAEBA,0XAEBB,0XAEBC,0XAEBD,0XAEBE,0XAEBF,
-0XAEC0,0XAEC1,0XAEC2,0XAEC3,0XAEC4,0XAEC5,0XAEC6,0XAEC7,0XAEC8,0XAEC9,0XAECA,0XAECB,0XAECC,0XAECD,0XAECE,0XAECF,
-0XAED0,0XAED1,0XAED2,0XAED3,0XAED4,0XAED5,0XAED6,0XAED7,0XAED8,0XAED9,0XAEDA,0XAEDB,0XAEDC,0XAEDD,0XAEDE,0XAEDF,
-0XAEE0,0XAEE1,0XAEE2,0XAEE3,0XAEE4,0XAEE5,0XAEE6,0XAEE7,0XAEE8,0XAEE9,0XAEEA,0XAEEB,0XAEEC,0XAEED,0XAEEE,0XAEEF,
-0XAEF0,0XAEF1,0XAEF2,0XAEF3,0XAEF4,0XAEF5,0XAEF6,0XAEF7,0XAEF8,0XAEF9,0XAEFA,0XAEFB,0XAEFC,0XAEFD,0XAEFE,0XAEFF,
-0XAF40,0XAF41,0XAF42,0XAF43,0XAF44,0XAF45,0XAF46,0XAF47,0XAF48,0XAF49,0XAF4A,0XAF4B,0XAF4C,0XAF4D,0XAF4E,0XAF4F,
-0XAF50,0XAF51,0XAF52,0XAF53,0XAF54,0XAF55,0XAF56,0XAF57,0XAF58,0XAF59,0XAF5A,0XAF5B,0XAF5C,0XAF5D,0XAF5E,0XAF5F,
-0XAF60,0XAF61,0XAF62,0XAF63,0XAF64,0XAF65,0XAF66,0XAF67,0XAF68,0XAF69,0XAF6A,0XAF6B,0XAF6C,0XAF6D,0XAF6E,0XAF6F,
-0XAF70,0XAF71,0XAF72,0XAF73,0XAF74,0XAF75,0XAF76,0XAF77,0XAF78,0XAF79,0XAF7A,0XAF7B,0XAF7C,0XAF7D,0XAF7E,0XAF7F,
-0XAF80,0XAF81,0XAF82,0XAF83,0XAF84,0XAF85,0XAF86,0XAF87,0XAF88,0XAF89,0XAF8A,0XAF8B,0XAF8C,0XAF8D,0XAF8E,0XAF8F,
-0XAF90,0XAF91,0XAF92,0XAF93,0XAF94,0XAF95,0XAF96,0XAF97,0XAF98,0XAF99,0XAF9A,0XAF9B,0XAF9C,0XAF9D,0XAF9E,0XAF9F,
-0XAFA0,0XAFA1,0XAFA2,0XAFA3,0XAFA4,0XAFA5,0XAFA6,0XAFA7,0XAFA8,0XAFA9,0XAFAA,0XAFAB,0XAFAC,0XAFAD,0XAFAE,0XAFAF,
-0XAFB0,0XAFB1,0XAFB2,0XAFB3,0XAFB4,0XAFB5,0XAFB6,0XAFB7,0XAFB8,0XAFB9,0XAFBA,0XAFBB,0XAFBC,0XAFBD,0XAFBE,0XAFBF,
-0XAFC0,0XAFC1,0XAFC2,0XAFC3,0XAFC4,0XAFC5,0XAFC6,0XAFC7,0XAFC8,0XAFC9,0XAFCA,0XAFCB,0XAFCC,0XAFCD,0XAFCE,0XAFCF,
-0XAFD0,0XAFD1,0XAFD2,0XAFD3,0XAFD4,0XAFD5,0XAFD6,0XAFD7,0XAFD8,0XAFD9,0XAFDA,0XAFDB,0XAFDC,0XAFDD,0XAFDE,0XAFDF,
-0XAFE0,0XAFE1,0XAFE2,0XAFE3,0XAFE4,0XAFE5,0XAFE6,0XAFE7,0XAFE8,0XAFE9,0XAFEA,0XAFEB,0XAFEC,0XAFED,0XAFEE,0XAFEF,
-0XAFF0,0XAFF1,0XAFF2,0XAFF3,0XAFF4,0XAFF5,0XAFF6,0XAFF7,0XAFF8,0XAFF9,0XAFFA,0XAFFB,0XAFFC,0XAFFD,0XAFFE,0XAFFF,
-0XB040,0XB041,0XB042,0XB043,0XB044,0XB045,0XB046,0XB047,0XB048,0XB049,0XB04A,0XB04B,0XB04C,0XB04D,0XB04E,0XB04F,
-0XB050,0XB051,0XB052,0XB053,0XB054,0XB055,0XB056,0XB057,0XB058,0XB059,0XB05A,0XB05B,0XB05C,0XB05D,0XB05E,0XB05F,
-0XB060,0XB061,0XB062,0XB063,0XB064,0XB065,0XB066,0XB067,0XB068,0XB069,0XB06A,0XB06B,0XB06C,0XB06D,0XB06E,0XB06F,
-0XB070,0XB071,0XB072,0XB073,0XB074,0XB075,0XB076,0XB077,0XB078,0XB079,0XB07A,0XB07B,0XB07C,0XB07D,0XB07E,0XB07F,
-0XB080,0XB081,0XB082,0XB083,0XB084,0XB085,0XB086,0XB087,0XB088,0XB089,0XB08A,0XB08B,0XB08C,0XB08D,0XB08E,0XB08F,
-0XB090,0XB091,0XB092,0XB093,0XB094,0XB095,0XB096,0XB097,0XB098,0XB099,0XB09A,0XB09B,0XB09C,0XB09D,0XB09E,0XB09F,
-0XB0A0,0XB0A1,0XB0A2,0XB0A3,0XB0A4,0XB0A5,0XB0A6,0XB0A7,0XB0A8,0XB0A9,0XB0AA,0XB0AB,0XB0AC,0XB0AD,0XB0AE,0XB0AF,
-0XB0B0,0XB0B1,0XB0B2,0XB0B3,0XB0B4,0XB0B5,0XB0B6,0XB0B7,0XB0B8,0XB0B9,0XB0BA,0XB0BB,0XB0BC,0XB0BD,0XB0BE,0XB0BF,
-0XB0C0,0XB0C1,0XB0C2,0XB0C3,0XB0C4,0XB0C5,0XB0C6,0XB0C7,0XB0C8,0XB0C9,0XB0CA,0XB0CB,0XB0CC,0XB0CD,0XB0CE,0XB0CF,
-0XB0D0,0XB0D1,0XB0D2,0XB0D3,0XB0D4,0XB0D5,0XB0D6,0XB0D7,0XB0D8,0XB0D9,0XB0DA,0XB0DB,0XB0DC,0XB0DD,0XB0DE,0XB0DF,
-0XB0E0,0XB0E1,0XB0E2,0XB0E3,0XB0E4,0XB0E5,0XB0E6,0XB0E7,0XB0E8,0XB0E9,0XB0EA,0XB0EB,0XB0EC,0XB0ED,0XB0EE,0XB0EF,
-0XB0F0,0XB0F1,0XB0F2,0XB0F3,0XB0F4,0XB0F5,0XB0F6,0XB0F7,0XB0F8,0XB0F9,0XB0FA,0XB0FB,0XB0FC,0XB0FD,0XB0FE,0XB0FF,
-0XB140,0XB141,0XB142,0XB143,0XB144,0XB145,0XB146,0XB147,0XB148,0XB149,0XB14A,0XB14B,0XB14C,0XB14D,0XB14E,0XB14F,
-0XB150,0XB151,0XB152,0XB153,0XB154,0XB155,0XB156,0XB157,0XB158,0XB159,0XB15A,0XB15B,0XB15C,0XB15D,0XB15E,0XB15F,
-0XB160,0XB161,0XB162,0XB163,0XB164,0XB165,0XB166,0XB167,0XB168,0XB169,0XB16A,0XB16B,0XB16C,0XB16D,0XB16E,0XB16F,
-0XB170,0XB171,0XB172,0XB173,0XB174,0XB175,0XB176,0XB177,0XB178,0XB179,0XB17A,0XB17B,0XB17C,0XB17D,0XB17E,0XB17F,
-0XB180,0XB181,0XB182,0XB183,0XB184,0XB185,0XB186,0XB187,0XB188,0XB189,0XB18A,0XB18B,0XB18C,0XB18D,0XB18E,0XB18F,
-0XB190,0XB191,0XB192,0XB193,0XB194,0XB195,0XB196,0XB197,0XB198,0XB199,0XB19A,0XB19B,0XB19C,0XB19D,0XB19E,0XB19F,
-0XB1A0,0XB1A1,0XB1A2,0XB1A3,0XB1A4,0XB1A5,0XB1A6,0XB1A7,0XB1A8,0XB1A9,0XB1AA,0XB1AB,0XB1AC,0XB1AD,0XB1AE,0XB1AF,
-0XB1B0,0XB1B1,0XB1B2,0XB1B3,0XB1B4,0XB1B5,0XB1B6,0XB1B7,0XB1B8,0XB1B9,0XB1BA,0XB1BB,0XB1BC,0XB1BD,0XB1BE,0XB1BF,
-0XB1C0,0XB1C1,0XB1C2,0XB1C3,0XB1C4,0XB1C5,0XB1C6,0XB1C7,0XB1C8,0XB1C9,0XB1CA,0XB1CB,0XB1CC,0XB1CD,0XB1CE,0XB1CF,
-0XB1D0,0XB1D1,0XB1D2,0XB1D3,0XB1D4,0XB1D5,0XB1D6,0XB1D7,0XB1D8,0XB1D9,0XB1DA,0XB1DB,0XB1DC,0XB1DD,0XB1DE,0XB1DF,
-0XB1E0,0XB1E1,0XB1E2,0XB1E3,0XB1E4,0XB1E5,0XB1E6,0XB1E7,0XB1E8,0XB1E9,0XB1EA,0XB1EB,0XB1EC,0XB1ED,0XB1EE,0XB1EF,
-0XB1F0,0XB1F1,0XB1F2,0XB1F3,0XB1F4,0XB1F5,0XB1F6,0XB1F7,0XB1F8,0XB1F9,0XB1FA,0XB1FB,0XB1FC,0XB1FD,0XB1FE,0XB1FF,
-0XB240,0XB241,0XB242,0XB243,0XB244,0XB245,0XB246,0XB247,0XB248,0XB249,0XB24A,0XB24B,0XB24C,0XB24D,0XB24E,0XB24F,
-0XB250,0XB251,0XB252,0XB253,0XB254,0XB255,0XB256,0XB257,0XB258,0XB259,0XB25A,0XB25B,0XB25C,0XB25D,0XB25E,0XB25F,
-0XB260,0XB261,0XB262,0XB263,0XB264,0XB265,0XB266,0XB267,0XB268,0XB269,0XB26A,0XB26B,0XB26C,0XB26D,0XB26E,0XB26F,
-0XB270,0XB271,0XB272,0XB273,0XB274,0XB275,0XB276,0XB277,0XB278,0XB279,0XB27A,0XB27B,0XB27C,0XB27D,0XB27E,0XB27F,
-0XB280,0XB281,0XB282,0XB283,0XB284,0XB285,0XB286,0XB287,0XB288,0XB289,0XB28A,0XB28B,0XB28C,0XB28D,0XB28E,0XB28F,
-0XB290,0XB291,0XB292,0XB293,0XB294,0XB295,0XB296,0XB297,0XB298,0XB299,0XB29A,0XB29B,0XB29C,0XB29D,0XB29E,0XB29F,
-0XB2A0,0XB2A1,0XB2A2,0XB2A3,0XB2A4,0XB2A5,0XB2A6,0XB2A7,0XB2A8,0XB2A9,0XB2AA,0XB2AB,0XB2AC,0XB2AD,0XB2AE,0XB2AF,
-0XB2B0,0XB2B1,0XB2B2,0XB2B3,0XB2B4,0XB2B5,0XB2B6,0XB2B7,0XB2B8,0XB2B9,0XB2BA,0XB2BB,0XB2BC,0XB2BD,0XB2BE,0XB2BF,
-0XB2C0,0XB2C1,0XB2C2,0XB2C3,0XB2C4,0XB2C5,0XB2C6,0XB2C7,0XB2C8,0XB2C9,0XB2CA,0XB2CB,0XB2CC,0XB2CD,0XB2CE,0XB2CF,
-0XB2D0,0XB2D1,0XB2D2,0XB2D3,0XB2D4,0XB2D5,0XB2D6,0XB2D7,0XB2D8,0XB2D9,0XB2DA,0XB2DB,0XB2DC,0XB2DD,0XB2DE,0XB2DF,
-0XB2E0,0XB2E1,0XB2E2,0XB2E3,0XB2E4,0XB2E5,0XB2E6,0XB2E7,0XB2E8,0XB2E9,0XB2EA,0XB2EB,0XB2EC,0XB2ED,0XB2EE,0XB2EF,
-0XB2F0,0XB2F1,0XB2F2,0XB2F3,0XB2F4,0XB2F5,0XB2F6,0XB2F7,0XB2F8,0XB2F9,0XB2FA,0XB2FB,0XB2FC,0XB2FD,0XB2FE,0XB2FF,
-0XB340,0XB341,0XB342,0XB343,0XB344,0XB345,0XB346,0XB347,0XB348,0XB349,0XB34A,0XB34B,0XB34C,0XB34D,0XB34E,0XB34F,
-0XB350,0XB351,0XB352,0XB353,0XB354,0XB355,0XB356,0XB357,0XB358,0XB359,0XB35A,0XB35B,0XB35C,0XB35D,0XB35E,0XB35F,
-0XB360,0XB361,0XB362,0XB363,0XB364,0XB365,0XB366,0XB367,0XB368,0XB369,0XB36A,0XB36B,0XB36C,0XB36D,0XB36E,0XB36F,
-0XB370,0XB371,0XB372,0XB373,0XB374,0XB375,0XB376,0XB377,0XB378,0XB379,0XB37A,0XB37B,0XB37C,0XB37D,0XB37E,0XB37F,
-0XB380,0XB381,0XB382,0XB383,0XB384,0XB385,0XB386,0XB387,0XB388,0XB389,0XB38A,0XB38B,0XB38C,0XB38D,0XB38E,0XB38F,
-0XB390,0XB391,0XB392,0XB393,0XB394,0XB395,0XB396,0XB397,0XB398,0XB399,0XB39A,0XB39B,0XB39C,0XB39D,0XB39E,0XB39F,
-0XB3A0,0XB3A1,0XB3A2,0XB3A3,0XB3A4,0XB3A5,0XB3A6,0XB3A7,0XB3A8,0XB3A9,0XB3AA,0XB3AB,0XB3AC,0XB3AD,0XB3AE,0XB3AF,
-0XB3B0,0XB3B1,0XB3B2,0XB3B3,0XB3B4,0XB3B5,0XB3B6,0XB3B7,0XB3B8,0XB3B9,0XB3BA,0XB3BB,0XB3BC,0XB3BD,0XB3BE,0XB3BF,
-0XB3C0,0XB3C1,0XB3C2,0XB3C3,0XB3C4,0XB3C5,0XB3C6,0XB3C7,0XB3C8,0XB3C9,0XB3CA,0XB3CB,0XB3CC,0XB3CD,0XB3CE,0XB3CF,
-0XB3D0,0XB3D1,0XB3D2,0XB3D3,0XB3D4,0XB3D5,0XB3D6,0XB3D7,0XB3D8,0XB3D9,0XB3DA,0XB3DB,0XB3DC,0XB3DD,0XB3DE,0XB3DF,
-0XB3E0,0XB3E1,0XB3E2,0XB3E3,0XB3E4,0XB3E5,0XB3E6,0XB3E7,0XB3E8,0XB3E9,0XB3EA,0XB3EB,0XB3EC,0XB3ED,0XB3EE,0XB3EF,
-0XB3F0,0XB3F1,0XB3F2,0XB3F3,0XB3F4,0XB3F5,0XB3F6,0XB3F7,0XB3F8,0XB3F9,0XB3FA,0XB3FB,0XB3FC,0XB3FD,0XB3FE,0XB3FF,
-0XB440,0XB441,0XB442,0XB443,0XB444,0XB445,0XB446,0XB447,0XB448,0XB449,0XB44A,0XB44B,0XB44C,0XB44D,0XB44E,0XB44F,
-0XB450,0XB451,0XB452,0XB453,0XB454,0XB455,0XB456,0XB457,0XB458,0XB459,0XB45A,0XB45B,0XB45C,0XB45D,0XB45E,0XB45F,
-0XB460,0XB461,0XB462,0XB463,0XB464,0XB465,0XB466,0XB467,0XB468,0XB469,0XB46A,0XB46B,0XB46C,0XB46D,0XB46E,0XB46F,
-0XB470,0XB471,0XB472,0XB473,0XB474,0XB475,0XB476,0XB477,0XB478,0XB479,0XB47A,0XB47B,0XB47C,0XB47D,0XB47E,0XB47F,
-0XB480,0XB481,0XB482,0XB483,0XB484,0XB485,0XB486,0XB487,0XB488,0XB489,0XB48A,0XB48B,0XB48C,0XB48D,0XB48E,0XB48F,
-0XB490,0XB491,0XB492,0XB493,0XB494,0XB495,0XB496,0XB497,0XB498,0XB499,0XB49A,0XB49B,0XB49C,0XB49D,0XB49E,0XB49F,
-0XB4A0,0XB4A1,0XB4A2,0XB4A3,0XB4A4,0XB4A5,0XB4A6,0XB4A7,0XB4A8,0XB4A9,0XB4AA,0XB4AB,0XB4AC,0XB4AD,0XB4AE,0XB4AF,
-0XB4B0,0XB4B1,0XB4B2,0XB4B3,0XB4B4,0XB4B5,0XB4B6,0XB4B7,0XB4B8,0XB4B9,0XB4BA,0XB4BB,0XB4BC,0XB4BD,0XB4BE,0XB4BF,
-0XB4C0,0XB4C1,0XB4C2,0XB4C3,0XB4C4,0XB4C5,0XB4C6,0XB4C7,0XB4C8,0XB4C9,0XB4CA,0XB4CB,0XB4CC,0XB4CD,0XB4CE,0XB4CF,
-0XB4D0,0XB4D1,0XB4D2,0XB4D3,0XB4D4,0XB4D5,0XB4D6,0XB4D7,0XB4D8,0XB4D9,0XB4DA,0XB4DB,0XB4DC,0XB4DD,0XB4DE,0XB4DF,
-0XB4E0,0XB4E1,0XB4E2,0XB4E3,0XB4E4,0XB4E5,0XB4E6,0XB4E7,0XB4E8,0XB4E9,0XB4EA,0XB4EB,0XB4EC,0XB4ED,0XB4EE,0XB4EF,
-0XB4F0,0XB4F1,0XB4F2,0XB4F3,0XB4F4,0XB4F5,0XB4F6,0XB4F7,0XB4F8,0XB4F9,0XB4FA,0XB4FB,0XB4FC,0XB4FD,0XB4FE,0XB4FF,
-0XB540,0XB541,0XB542,0XB543,0XB544,0XB545,0XB546,0XB547,0XB548,0XB549,0XB54A,0XB54B,0XB54C,0XB54D,0XB54E,0XB54F,
-0XB550,0XB551,0XB552,0XB553,0XB554,0XB555,0XB556,0XB557,0XB558,0XB559,0XB55A,0XB55B,0XB55C,0XB55D,0XB55E,0XB55F,
-0XB560,0XB561,0XB562,0XB563,0XB564,0XB565,0XB566,0XB567,0XB568,0XB569,0XB56A,0XB56B,0XB56C,0XB56D,0XB56E,0XB56F,
-0XB570,0XB571,0XB572,0XB573,0XB574,0XB575,0XB576,0XB577,0XB578,0XB579,0XB57A,0XB57B,0XB57C,0XB57D,0XB57E,0XB57F,
-0XB580,0XB581,0XB582,0XB583,0XB584,0XB585,0XB586,0XB587,0XB588,0XB589,0XB58A,0XB58B,0XB58C,0XB58D,0XB58E,0XB58F,
-0XB590,0XB591,0XB592,0XB593,0XB594,0XB595,0XB596,0XB597,0XB598,0XB599,0XB59A,0XB59B,0XB59C,0XB59D,0XB59E,0XB59F,
-0XB5A0,0XB5A1,0XB5A2,0XB5A3,0XB5A4,0XB5A5,0XB5A6,0XB5A7,0XB5A8,0XB5A9,0XB5AA,0XB5AB,0XB5AC,0XB5AD,0XB5AE,0XB5AF,
-0XB5B0,0XB5B1,0XB5B2,0XB5B3,0XB5B4,0XB5B5,0XB5B6,0XB5B7,0XB5B8,0XB5B9,0XB5BA,0XB5BB,0XB5BC,0XB5BD,0XB5BE,0XB5BF,
-0XB5C0,0XB5C1,0XB5C2,0XB5C3,0XB5C4,0XB5C5,0XB5C6,0XB5C7,0XB5C8,0XB5C9,0XB5CA,0XB5CB,0XB5CC,0XB5CD,0XB5CE,0XB5CF,
-0XB5D0,0XB5D1,0XB5D2,0XB5D3,0XB5D4,0XB5D5,0XB5D6,0XB5D7,0XB5D8,0XB5D9,0XB5DA,0XB5DB,0XB5DC,0XB5DD,0XB5DE,0XB5DF,
-0XB5E0,0XB5E1,0XB5E2,0XB5E3,0XB5E4,0XB5E5,0XB5E6,0XB5E7,0XB5E8,0XB5E9,0XB5EA,0XB5EB,0XB5EC,0XB5ED,0XB5EE,0XB5EF,
-0XB5F0,0XB5F1,0XB5F2,0XB5F3,0XB5F4,0XB5F5,0XB5F6,0XB5F7,0XB5F8,0XB5F9,0XB5FA,0XB5FB,0XB5FC,0XB5FD,0XB5FE,0XB5FF,
-0XB640,0XB641,0XB642,0XB643,0XB644,0XB645,0XB646,0XB647,0XB648,0XB649,0XB64A,0XB64B,0XB64C,0XB64D,0XB64E,0XB64F,
-0XB650,0XB651,0XB652,0XB653,0XB654,0XB655,0XB656,0XB657,0XB658,0XB659,0XB65A,0XB65B,0XB65C,0XB65D,0XB65E,0XB65F,
-0XB660,0XB661,0XB662,0XB663,0XB664,0XB665,0XB666,0XB667,0XB668,0XB669,0XB66A,0XB66B,0XB66C,0XB66D,0XB66E,0XB66F,
-0XB670,0XB671,0XB672,0XB673,0XB674,0XB675,0XB676,0XB677,0XB678,0XB679,0XB67A,0XB67B,0XB67C,0XB67D,0XB67E,0XB67F,
-0XB680,0XB681,0XB682,0XB683,0XB684,0XB685,0XB686,0XB687,0XB688,0XB689,0XB68A,0XB68B,0XB68C,0XB68D,0XB68E,0XB68F,
-0XB690,0XB691,0XB692,0XB693,0XB694,0XB695,0XB696,0XB697,0XB698,0XB699,0XB69A,0XB69B,0XB69C,0XB69D,0XB69E,0XB69F,
-0XB6A0,0XB6A1,0XB6A2,0XB6A3,0XB6A4,0XB6A5,0XB6A6,0XB6A7,0XB6A8,0XB6A9,0XB6AA,0XB6AB,0XB6AC,0XB6AD,0XB6AE,0XB6AF,
-0XB6B0,0XB6B1,0XB6B2,0XB6B3,0XB6B4,0XB6B5,0XB6B6,0XB6B7,0XB6B8,0XB6B9,0XB6BA,0XB6BB,0XB6BC,0XB6BD,0XB6BE,0XB6BF,
-0XB6C0,0XB6C1,0XB6C2,0XB6C3,0XB6C4,0XB6C5,0XB6C6,0XB6C7,0XB6C8,0XB6C9,0XB6CA,0XB6CB,0XB6CC,0XB6CD,0XB6CE,0XB6CF,
-0XB6D0,0XB6D1,0XB6D2,0XB6D3,0XB6D4,0XB6D5,0XB6D6,0XB6D7,0XB6D8,0XB6D9,0XB6DA,0XB6DB,0XB6DC,0XB6DD,0XB6DE,0XB6DF,
-0XB6E0,0XB6E1,0XB6E2,0XB6E3,0XB6E4,0XB6E5,0XB6E6,0XB6E7,0XB6E8,0XB6E9,0XB6EA,0XB6EB,0XB6EC,0XB6ED,0XB6EE,0XB6EF,
-0XB6F0,0XB6F1,0XB6F2,0XB6F3,0XB6F4,0XB6F5,0XB6F6,0XB6F7,0XB6F8,0XB6F9,0XB6FA,0XB6FB,0XB6FC,0XB6FD,0XB6FE,0XB6FF,
-0XB740,0XB741,0XB742,0XB743,0XB744,0XB745,0XB746,0XB747,0XB748,0XB749,0XB74A,0XB74B,0XB74C,0XB74D,0XB74E,0XB74F,
-0XB750,0XB751,0XB752,0XB753,0XB754,0XB755,0XB756,0XB757,0XB758,0XB759,0XB75A,0XB75B,0XB75C,0XB75D,0XB75E,0XB75F,
-0XB760,0XB761,0XB762,0XB763,0XB764,0XB765,0XB766,0XB767,0XB768,0XB769,0XB76A,0XB76B,0XB76C,0XB76D,0XB76E,0XB76F,
-0XB770,0XB771,0XB772,0XB773,0XB774,0XB775,0XB776,0XB777,0XB778,0XB779,0XB77A,0XB77B,0XB77C,0XB77D,0XB77E,0XB77F,
-0XB780,0XB781,0XB782,0XB783,0XB784,0XB785,0XB786,0XB787,0XB788,0XB789,0XB78A,0XB78B,0XB78C,0XB78D,0XB78E,0XB78F,
-0XB790,0XB791,0XB792,0XB793,0XB794,0XB795,0XB796,0XB797,0XB798,0XB799,0XB79A,0XB79B,0XB79C,0XB79D,0XB79E,0XB79F,
-0XB7A0,0XB7A1,0XB7A2,0XB7A3,0XB7A4,0XB7A5,0XB7A6,0XB7A7,0XB7A8,0XB7A9,0XB7AA,0XB7AB,0XB7AC,0XB7AD,0XB7AE,0XB7AF,
-0XB7B0,0XB7B1,0XB7B2,0XB7B3,0XB7B4,0XB7B5,0XB7B6,0XB7B7,0XB7B8,0XB7B9,0XB7BA,0XB7BB,0XB7BC,0XB7BD,0XB7BE,0XB7BF,
-0XB7C0,0XB7C1,0XB7C2,0XB7C3,0XB7C4,0XB7C5,0XB7C6,0XB7C7,0XB7C8,0XB7C9,0XB7CA,0XB7CB,0XB7CC,0XB7CD,0XB7CE,0XB7CF,
-0XB7D0,0XB7D1,0XB7D2,0XB7D3,0XB7D4,0XB7D5,0XB7D6,0XB7D7,0XB7D8,0XB7D9,0XB7DA,0XB7DB,0XB7DC,0XB7DD,0XB7DE,0XB7DF,
-0XB7E0,0XB7E1,0XB7E2,0XB7E3,0XB7E4,0XB7E5,0XB7E6,0XB7E7,0XB7E8,0XB7E9,0XB7EA,0XB7EB,0XB7EC,0XB7ED,0XB7EE,0XB7EF,
-0XB7F0,0XB7F1,0XB7F2,0XB7F3,0XB7F4,0XB7F5,0XB7F6,0XB7F7,0XB7F8,0XB7F9,0XB7FA,0XB7FB,0XB7FC,0XB7FD,0XB7FE,0XB7FF,
-0XB840,0XB841,0XB842,0XB843,0XB844,0XB845,0XB846,0XB847,0XB848,0XB849,0XB84A,0XB84B,0XB84C,0XB84D,0XB84E,0XB84F,
-0XB850,0XB851,0XB852,0XB853,0XB854,0XB855,0XB856,0XB857,0XB858,0XB859,0XB85A,0XB85B,0XB85C,0XB85D,0XB85E,0XB85F,
-0XB860,0XB861,0XB862,0XB863,0XB864,0XB865,0XB866,0XB867,0XB868,0XB869,0XB86A,0XB86B,0XB86C,0XB86D,0XB86E,0XB86F,
-0XB870,0XB871,0XB872,0XB873,0XB874,0XB875,0XB876,0XB877,0XB878,0XB879,0XB87A,0XB87B,0XB87C,0XB87D,0XB87E,0XB87F,
-0XB880,0XB881,0XB882,0XB883,0XB884,0XB885,0XB886,0XB887,0XB888,0XB889,0XB88A,0XB88B,0XB88C,0XB88D,0XB88E,0XB88F,
-0XB890,0XB891,0XB892,0XB893,0XB894,0XB895,0XB896,0XB897,0XB898,0XB899,0XB89A,0XB89B,0XB89C,0XB89D,0XB89E,0XB89F,
-0XB8A0,0XB8A1,0XB8A2,0XB8A3,0XB8A4,0XB8A5,0XB8A6,0XB8A7,0XB8A8,0XB8A9,0XB8AA,0XB8AB,0XB8AC,0XB8AD,0XB8AE,0XB8AF,
-0XB8B0,0XB8B1,0XB8B2,0XB8B3,0XB8B4,0XB8B5,0XB8B6,0XB8B7,0XB8B8,0XB8B9,0XB8BA,0XB8BB,0XB8BC,0XB8BD,0XB8BE,0XB8BF,
-0XB8C0,0XB8C1,0XB8C2,0XB8C3,0XB8C4,0XB8C5,0XB8C6,0XB8C7,0XB8C8,0XB8C9,0XB8CA,0XB8CB,0XB8CC,0XB8CD,0XB8CE,0XB8CF,
-0XB8D0,0XB8D1,0XB8D2,0XB8D3,0XB8D4,0XB8D5,0XB8D6,0XB8D7,0XB8D8,0XB8D9,0XB8DA,0XB8DB,0XB8DC,0XB8DD,0XB8DE,0XB8DF,
-0XB8E0,0XB8E1,0XB8E2,0XB8E3,0XB8E4,0XB8E5,0XB8E6,0XB8E7,0XB8E8,0XB8E9,0XB8EA,0XB8EB,0XB8EC,0XB8ED,0XB8EE,0XB8EF,
-0XB8F0,0XB8F1,0XB8F2,0XB8F3,0XB8F4,0XB8F5,0XB8F6,0XB8F7,0XB8F8,0XB8F9,0XB8FA,0XB8FB,0XB8FC,0XB8FD,0XB8FE,0XB8FF,
-0XB940,0XB941,0XB942,0XB943,0XB944,0XB945,0XB946,0XB947,0XB948,0XB949,0XB94A,0XB94B,0XB94C,0XB94D,0XB94E,0XB94F,
-0XB950,0XB951,0XB952,0XB953,0XB954,0XB955,0XB956,0XB957,0XB958,0XB959,0XB95A,0XB95B,0XB95C,0XB95D,0XB95E,0XB95F,
-0XB960,0XB961,0XB962,0XB963,0XB964,0XB965,0XB966,0XB967,0XB968,0XB969,0XB96A,0XB96B,0XB96C,0XB96D,0XB96E,0XB96F,
-0XB970,0XB971,0XB972,0XB973,0XB974,0XB975,0XB976,0XB977,0XB978,0XB979,0XB97A,0XB97B,0XB97C,0XB97D,0XB97E,0XB97F,
-0XB980,0XB981,0XB982,0XB983,0XB984,0XB985,0XB986,0XB987,0XB988,0XB989,0XB98A,0XB98B,0XB98C,0XB98D,0XB98E,0XB98F,
-0XB990,0XB991,0XB992,0XB993,0XB994,0XB995,0XB996,0XB997,0XB998,0XB999,0XB99A,0XB99B,0XB99C,0XB99D,0XB99E,0XB99F,
-0XB9A0,0XB9A1,0XB9A2,0XB9A3,0XB9A4,0XB9A5,0XB9A6,0XB9A7,0XB9A8,0XB9A9,0XB9AA,0XB9AB,0XB9AC,0XB9AD,0XB9AE,0XB9AF,
-0XB9B0,0XB9B1,0XB9B2,0XB9B3,0XB9B4,0XB9B5,0XB9B6,0XB9B7,0XB9B8,0XB9B9,0XB9BA,0XB9BB,0XB9BC,0XB9BD,0XB9BE,0XB9BF,
-0XB9C0,0XB9C1,0XB9C2,0XB9C3,0XB9C4,0XB9C5,0XB9C6,0XB9C7,0XB9C8,0XB9C9,0XB9CA,0XB9CB,0XB9CC,0XB9CD,0XB9CE,0XB9CF,
-0XB9D0,0XB9D1,0XB9D2,0XB9D3,0XB9D4,0XB9D5,0XB9D6,0XB9D7,0XB9D8,0XB9D9,0XB9DA,0XB9DB,0XB9DC,0XB9DD,0XB9DE,0XB9DF,
-0XB9E0,0XB9E1,0XB9E2,0XB9E3,0XB9E4,0XB9E5,0XB9E6,0XB9E7,0XB9E8,0XB9E9,0XB9EA,0XB9EB,0XB9EC,0XB9ED,0XB9EE,0XB9EF,
-0XB9F0,0XB9F1,0XB9F2,0XB9F3,0XB9F4,0XB9F5,0XB9F6,0XB9F7,0XB9F8,0XB9F9,0XB9FA,0XB9FB,0XB9FC,0XB9FD,0XB9FE,0XB9FF,
-0XBA40,0XBA41,0XBA42,0XBA43,0XBA44,0XBA45,0XBA46,0XBA47,0XBA48,0XBA49,0XBA4A,0XBA4B,0XBA4C,0XBA4D,0XBA4E,0XBA4F,
-0XBA50,0XBA51,0XBA52,0XBA53,0XBA54,0XBA55,0XBA56,0XBA57,0XBA58,0XBA59,0XBA5A,0XBA5B,0XBA5C,0XBA5D,0XBA5E,0XBA5F,
-0XBA60,0XBA61,0XBA62,0XBA63,0XBA64,0XBA65,0XBA66,0XBA67,0XBA68,0XBA69,0XBA6A,0XBA6B,0XBA6C,0XBA6D,0XBA6E,0XBA6F,
-0XBA70,0XBA71,0XBA72,0XBA73,0XBA74,0XBA75,0XBA76,0XBA77,0XBA78,0XBA79,0XBA7A,0XBA7B,0XBA7C,0XBA7D,0XBA7E,0XBA7F,
-0XBA80,0XBA81,0XBA82,0XBA83,0XBA84,0XBA85,0XBA86,0XBA87,0XBA88,0XBA89,0XBA8A,0XBA8B,0XBA8C,0XBA8D,0XBA8E,0XBA8F,
-0XBA90,0XBA91,0XBA92,0XBA93,0XBA94,0XBA95,0XBA96,0XBA97,0XBA98,0XBA99,0XBA9A,0XBA9B,0XBA9C,0XBA9D,0XBA9E,0XBA9F,
-0XBAA0,0XBAA1,0XBAA2,0XBAA3,0XBAA4,0XBAA5,0XBAA6,0XBAA7,0XBAA8,0XBAA9,0XBAAA,0XBAAB,0XBAAC,0XBAAD,0XBAAE,0XBAAF,
-0XBAB0,0XBAB1,0XBAB2,0XBAB3,0XBAB4,0XBAB5,0XBAB6,0XBAB7,0XBAB8,0XBAB9,0XBABA,0XBABB,0XBABC,0XBABD,0XBABE,0XBABF,
-0XBAC0,0XBAC1,0XBAC2,0XBAC3,0XBAC4,0XBAC5,0XBAC6,0XBAC7,0XBAC8,0XBAC9,0XBACA,0XBACB,0XBACC,0XBACD,0XBACE,0XBACF,
-0XBAD0,0XBAD1,0XBAD2,0XBAD3,0XBAD4,0XBAD5,0XBAD6,0XBAD7,0XBAD8,0XBAD9,0XBADA,0XBADB,0XBADC,0XBADD,0XBADE,0XBADF,
-0XBAE0,0XBAE1,0XBAE2,0XBAE3,0XBAE4,0XBAE5,0XBAE6,0XBAE7,0XBAE8,0XBAE9,0XBAEA,0XBAEB,0XBAEC,0XBAED,0XBAEE,0XBAEF,
-0XBAF0,0XBAF1,0XBAF2,0XBAF3,0XBAF4,0XBAF5,0XBAF6,0XBAF7,0XBAF8,0XBAF9,0XBAFA,0XBAFB,0XBAFC,0XBAFD,0XBAFE,0XBAFF,
-0XBB40,0XBB41,0XBB42,0XBB43,0XBB44,0XBB45,0XBB46,0XBB47,0XBB48,0XBB49,0XBB4A,0XBB4B,0XBB4C,0XBB4D,0XBB4E,0XBB4F,
-0XBB50,0XBB51,0XBB52,0XBB53,0XBB54,0XBB55,0XBB56,0XBB57,0XBB58,0XBB59,0XBB5A,0XBB5B,0XBB5C,0XBB5D,0XBB5E,0XBB5F,
-0XBB60,0XBB61,0XBB62,0XBB63,0XBB64,0XBB65,0XBB66,0XBB67,0XBB68,0XBB69,0XBB6A,0XBB6B,0XBB6C,0XBB6D,0XBB6E,0XBB6F,
-0XBB70,0XBB71,0XBB72,0XBB73,0XBB74,0XBB75,0XBB76,0XBB77,0XBB78,0XBB79,0XBB7A,0XBB7B,0XBB7C,0XBB7D,0XBB7E,0XBB7F,
-0XBB80,0XBB81,0XBB82,0XBB83,0XBB84,0XBB85,0XBB86,0XBB87,0XBB88,0XBB89,0XBB8A,0XBB8B,0XBB8C,0XBB8D,0XBB8E,0XBB8F,
-0XBB90,0XBB91,0XBB92,0XBB93,0XBB94,0XBB95,0XBB96,0XBB97,0XBB98,0XBB99,0XBB9A,0XBB9B,0XBB9C,0XBB9D,0XBB9E,0XBB9F,
-0XBBA0,0XBBA1,0XBBA2,0XBBA3,0XBBA4,0XBBA5,0XBBA6,0XBBA7,0XBBA8,0XBBA9,0XBBAA,0XBBAB,0XBBAC,0XBBAD,0XBBAE,0XBBAF,
-0XBBB0,0XBBB1,0XBBB2,0XBBB3,0XBBB4,0XBBB5,0XBBB6,0XBBB7,0XBBB8,0XBBB9,0XBBBA,0XBBBB,0XBBBC,0XBBBD,0XBBBE,0XBBBF,
-0XBBC0,0XBBC1,0XBBC2,0XBBC3,0XBBC4,0XBBC5,0XBBC6,0XBBC7,0XBBC8,0XBBC9,0XBBCA,0XBBCB,0XBBCC,0XBBCD,0XBBCE,0XBBCF,
-0XBBD0,0XBBD1,0XBBD2,0XBBD3,0XBBD4,0XBBD5,0XBBD6,0XBBD7,0XBBD8,0XBBD9,0XBBDA,0XBBDB,0XBBDC,0XBBDD,0XBBDE,0XBBDF,
-0XBBE0,0XBBE1,0XBBE2,0XBBE3,0XBBE4,0XBBE5,0XBBE6,0XBBE7,0XBBE8,0XBBE9,0XBBEA,0XBBEB,0XBBEC,0XBBED,0XBBEE,0XBBEF,
-0XBBF0,0XBBF1,0XBBF2,0XBBF3,0XBBF4,0XBBF5,0XBBF6,0XBBF7,0XBBF8,0XBBF9,0XBBFA,0XBBFB,0XBBFC,0XBBFD,0XBBFE,0XBBFF,
-0XBC40,0XBC41,0XBC42,0XBC43,0XBC44,0XBC45,0XBC46,0XBC47,0XBC48,0XBC49,0XBC4A,0XBC4B,0XBC4C,0XBC4D,0XBC4E,0XBC4F,
-0XBC50,0XBC51,0XBC52,0XBC53,0XBC54,0XBC55,0XBC56,0XBC57,0XBC58,0XBC59,0XBC5A,0XBC5B,0XBC5C,0XBC5D,0XBC5E,0XBC5F,
-0XBC60,0XBC61,0XBC62,0XBC63,0XBC64,0XBC65,0XBC66,0XBC67,0XBC68,0XBC69,0XBC6A,0XBC6B,0XBC6C,0XBC6D,0XBC6E,0XBC6F,
-0XBC70,0XBC71,0XBC72,0XBC73,0XBC74,0XBC75,0XBC76,0XBC77,0XBC78,0XBC79,0XBC7A,0XBC7B,0XBC7C,0XBC7D,0XBC7E,0XBC7F,
-0XBC80,0XBC81,0XBC82,0XBC83,0XBC84,0XBC85,0XBC86,0XBC87,0XBC88,0XBC89,0XBC8A,0XBC8B,0XBC8C,0XBC8D,0XBC8E,0XBC8F,
-0XBC90,0XBC91,0XBC92,0XBC93,0XBC94,0XBC95,0XBC96,0XBC97,0XBC98,0XBC99,0XBC9A,0XBC9B,0XBC9C,0XBC9D,0XBC9E,0XBC9F,
-0XBCA0,0XBCA1,0XBCA2,0XBCA3,0XBCA4,0XBCA5,0XBCA6,0XBCA7,0XBCA8,0XBCA9,0XBCAA,0XBCAB,0XBCAC,0XBCAD,0XBCAE,0XBCAF,
-0XBCB0,0XBCB1,0XBCB2,0XBCB3,0XBCB4,0XBCB5,0XBCB6,0XBCB7,0XBCB8,0XBCB9,0XBCBA,0XBCBB,0XBCBC,0XBCBD,0XBCBE,0XBCBF,
-0XBCC0,0XBCC1,0XBCC2,0XBCC3,0XBCC4,0XBCC5,0XBCC6,0XBCC7,0XBCC8,0XBCC9,0XBCCA,0XBCCB,0XBCCC,0XBCCD,0XBCCE,0XBCCF,
-0XBCD0,0XBCD1,0XBCD2,0XBCD3,0XBCD4,0XBCD5,0XBCD6,0XBCD7,0XBCD8,0XBCD9,0XBCDA,0XBCDB,0XBCDC,0XBCDD,0XBCDE,0XBCDF,
-0XBCE0,0XBCE1,0XBCE2,0XBCE3,0XBCE4,0XBCE5,0XBCE6,0XBCE7,0XBCE8,0XBCE9,0XBCEA,0XBCEB,0XBCEC,0XBCED,0XBCEE,0XBCEF,
-0XBCF0,0XBCF1,0XBCF2,0XBCF3,0XBCF4,0XBCF5,0XBCF6,0XBCF7,0XBCF8,0XBCF9,0XBCFA,0XBCFB,0XBCFC,0XBCFD,0XBCFE,0XBCFF,
-0XBD40,0XBD41,0XBD42,0XBD43,0XBD44,0XBD45,0XBD46,0XBD47,0XBD48,0XBD49,0XBD4A,0XBD4B,0XBD4C,0XBD4D,0XBD4E,0XBD4F,
-0XBD50,0XBD51,0XBD52,0XBD53,0XBD54,0XBD55,0XBD56,0XBD57,0XBD58,0XBD59,0XBD5A,0XBD5B,0XBD5C,0XBD5D,0XBD5E,0XBD5F,
-0XBD60,0XBD61,0XBD62,0XBD63,0XBD64,0XBD65,0XBD66,0XBD67,0XBD68,0XBD69,0XBD6A,0XBD6B,0XBD6C,0XBD6D,0XBD6E,0XBD6F,
-0XBD70,0XBD71,0XBD72,0XBD73,0XBD74,0XBD75,0XBD76,0XBD77,0XBD78,0XBD79,0XBD7A,0XBD7B,0XBD7C,0XBD7D,0XBD7E,0XBD7F,
-0XBD80,0XBD81,0XBD82,0XBD83,0XBD84,0XBD85,0XBD86,0XBD87,0XBD88,0XBD89,0XBD8A,0XBD8B,0XBD8C,0XBD8D,0XBD8E,0XBD8F,
-0XBD90,0XBD91,0XBD92,0XBD93,0XBD94,0XBD95,0XBD96,0XBD97,0XBD98,0XBD99,0XBD9A,0XBD9B,0XBD9C,0XBD9D,0XBD9E,0XBD9F,
-0XBDA0,0XBDA1,0XBDA2,0XBDA3,0XBDA4,0XBDA5,0XBDA6,0XBDA7,0XBDA8,0XBDA9,0XBDAA,0XBDAB,0XBDAC,0XBDAD,0XBDAE,0XBDAF,
-0XBDB0,0XBDB1,0XBDB2,0XBDB3,0XBDB4,0XBDB5,0XBDB6,0XBDB7,0XBDB8,0XBDB9,0XBDBA,0XBDBB,0XBDBC,0XBDBD,0XBDBE,0XBDBF,
-0XBDC0,0XBDC1,0XBDC2,0XBDC3,0XBDC4,0XBDC5,0XBDC6,0XBDC7,0XBDC8,0XBDC9,0XBDCA,0XBDCB,0XBDCC,0XBDCD,0XBDCE,0XBDCF,
-0XBDD0,0XBDD1,0XBDD2,0XBDD3,0XBDD4,0XBDD5,0XBDD6,0XBDD7,0XBDD8,0XBDD9,0XBDDA,0XBDDB,0XBDDC,0XBDDD,0XBDDE,0XBDDF,
-0XBDE0,0XBDE1,0XBDE2,0XBDE3,0XBDE4,0XBDE5,0XBDE6,0XBDE7,0XBDE8,0XBDE9,0XBDEA,0XBDEB,0XBDEC,0XBDED,0XBDEE,0XBDEF,
-0XBDF0,0XBDF1,0XBDF2,0XBDF3,0XBDF4,0XBDF5,0XBDF6,0XBDF7,0XBDF8,0XBDF9,0XBDFA,0XBDFB,0XBDFC,0XBDFD,0XBDFE,0XBDFF,
-0XBE40,0XBE41,0XBE42,0XBE43,0XBE44,0XBE45,0XBE46,0XBE47,0XBE48,0XBE49,0XBE4A,0XBE4B,0XBE4C,0XBE4D,0XBE4E,0XBE4F,
-0XBE50,0XBE51,0XBE52,0XBE53,0XBE54,0XBE55,0XBE56,0XBE57,0XBE58,0XBE59,0XBE5A,0XBE5B,0XBE5C,0XBE5D,0XBE5E,0XBE5F,
-0XBE60,0XBE61,0XBE62,0XBE63,0XBE64,0XBE65,0XBE66,0XBE67,0XBE68,0XBE69,0XBE6A,0XBE6B,0XBE6C,0XBE6D,0XBE6E,0XBE6F,
-0XBE70,0XBE71,0XBE72,0XBE73,0XBE74,0XBE75,0XBE76,0XBE77,0XBE78,0XBE79,0XBE7A,0XBE7B,0XBE7C,0XBE7D,0XBE7E,0XBE7F,
-0XBE80,0XBE81,0XBE82,0XBE83,0XBE84,0XBE85,0XBE86,0XBE87,0XBE88,0XBE89,0XBE8A,0XBE8B,0XBE8C,0XBE8D,0XBE8E,0XBE8F,
-0XBE90,0XBE91,0XBE92,0XBE93,0XBE94,0XBE95,0XBE96,0XBE97,0XBE98,0XBE99,0XBE9A,0XBE9B,0XBE9C,0XBE9D,0XBE9E,0XBE9F,
-0XBEA0,0XBEA1,0XBEA2,0XBEA3,0XBEA4,0XBEA5,0XBEA6,0XBEA7,0XBEA8,0XBEA9,0XBEAA,0XBEAB,0XBEAC,0XBEAD,0XBEAE,0XBEAF,
-0XBEB0,0XBEB1,0XBEB2,0XBEB3,0XBEB4,0XBEB5,0XBEB6,0XBEB7,0XBEB8,0XBEB9,0XBEBA,0XBEBB,0XBEBC,0XBEBD,0XBEBE,0XBEBF,
-0XBEC0,0XBEC1,0XBEC2,0XBEC3,0XBEC4,0XBEC5,0XBEC6,0XBEC7,0XBEC8,0XBEC9,0XBECA,0XBECB,0XBECC,0XBECD,0XBECE,0XBECF,
-0XBED0,0XBED1,0XBED2,0XBED3,0XBED4,0XBED5,0XBED6,0XBED7,0XBED8,0XBED9,0XBEDA,0XBEDB,0XBEDC,0XBEDD,0XBEDE,0XBEDF,
-0XBEE0,0XBEE1,0XBEE2,0XBEE3,0XBEE4,0XBEE5,0XBEE6,0XBEE7,0XBEE8,0XBEE9,0XBEEA,0XBEEB,0XBEEC,0XBEED,0XBEEE,0XBEEF,
-0XBEF0,0XBEF1,0XBEF2,0XBEF3,0XBEF4,0XBEF5,0XBEF6,0XBEF7,0XBEF8,0XBEF9,0XBEFA,0XBEFB,0XBEFC,0XBEFD,0XBEFE,0XBEFF,
-0XBF40,0XBF41,0XBF42,0XBF43,0XBF44,0XBF45,0XBF46,0XBF47,0XBF48,0XBF49,0XBF4A,0XBF4B,0XBF4C,0XBF4D,0XBF4E,0XBF4F,
-0XBF50,0XBF51,0XBF52,0XBF53,0XBF54,0XBF55,0XBF56,0XBF57,0XBF58,0XBF59,0XBF5A,0XBF5B,0XBF5C,0XBF5D,0XBF5E,0XBF5F,
-0XBF60,0XBF61,0XBF62,0XBF63,0XBF64,0XBF65,0XBF66,0XBF67,0XBF68,0XBF69,0XBF6A,0XBF6B,0XBF6C,0XBF6D,0XBF6E,0XBF6F,
-0XBF70,0XBF71,0XBF72,0XBF73,0XBF74,0XBF75,0XBF76,0XBF77,0XBF78,0XBF79,0XBF7A,0XBF7B,0XBF7C,0XBF7D,0XBF7E,0XBF7F,
-0XBF80,0XBF81,0XBF82,0XBF83,0XBF84,0XBF85,0XBF86,0XBF87,0XBF88,0XBF89,0XBF8A,0XBF8B,0XBF8C,0XBF8D,0XBF8E,0XBF8F,
-0XBF90,0XBF91,0XBF92,0XBF93,0XBF94,0XBF95,0XBF96,0XBF97,0XBF98,0XBF99,0XBF9A,0XBF9B,0XBF9C,0XBF9D,0XBF9E,0XBF9F,
-0XBFA0,0XBFA1,0XBFA2,0XBFA3,0XBFA4,0XBFA5,0XBFA6,0XBFA7,0XBFA8,0XBFA9,0XBFAA,0XBFAB,0XBFAC,0XBFAD,0XBFAE,0XBFAF,
-0XBFB0,0XBFB1,0XBFB2,0XBFB3,0XBFB4,0XBFB5,0XBFB6,0XBFB7,0XBFB8,0XBFB9,0XBFBA,0XBFBB,0XBFBC,0XBFBD,0XBFBE,0XBFBF,
-0XBFC0,0XBFC1,0XBFC2,0XBFC3,0XBFC4,0XBFC5,0XBFC6,0XBFC7,0XBFC8,0XBFC9,0XBFCA,0XBFCB,0XBFCC,0XBFCD,0XBFCE,0XBFCF,
-0XBFD0,0XBFD1,0XBFD2,0XBFD3,0XBFD4,0XBFD5,0XBFD6,0XBFD7,0XBFD8,0XBFD9,0XBFDA,0XBFDB,0XBFDC,0XBFDD,0XBFDE,0XBFDF,
-0XBFE0,0XBFE1,0XBFE2,0XBFE3,0XBFE4,0XBFE5,0XBFE6,0XBFE7,0XBFE8,0XBFE9,0XBFEA,0XBFEB,0XBFEC,0XBFED,0XBFEE,0XBFEF,
-0XBFF0,0XBFF1,0XBFF2,0XBFF3,0XBFF4,0XBFF5,0XBFF6,0XBFF7,0XBFF8,0XBFF9,0XBFFA,0XBFFB,0XBFFC,0XBFFD,0XBFFE,0XBFFF,
-0XC040,0XC041,0XC042,0XC043,0XC044,0XC045,0XC046,0XC047,0XC048,0XC049,0XC04A,0XC04B,0XC04C,0XC04D,0XC04E,0XC04F,
-0XC050,0XC051,0XC052,0XC053,0XC054,0XC055,0XC056,0XC057,0XC058,0XC059,0XC05A,0XC05B,0XC05C,0XC05D,0XC05E,0XC05F,
-0XC060,0XC061,0XC062,0XC063,0XC064,0XC065,0XC066,0XC067,0XC068,0XC069,0XC06A,0XC06B,0XC06C,0XC06D,0XC06E,0XC06F,
-0XC070,0XC071,0XC072,0XC073,0XC074,0XC075,0XC076,0XC077,0XC078,0XC079,0XC07A,0XC07B,0XC07C,0XC07D,0XC07E,0XC07F,
-0XC080,0XC081,0XC082,0XC083,0XC084,0XC085,0XC086,0XC087,0XC088,0XC089,0XC08A,0XC08B,0XC08C,0XC08D,0XC08E,0XC08F,
-0XC090,0XC091,0XC092,0XC093,0XC094,0XC095,0XC096,0XC097,0XC098,0XC099,0XC09A,0XC09B,0XC09C,0XC09D,0XC09E,0XC09F,
-0XC0A0,0XC0A1,0XC0A2,0XC0A3,0XC0A4,0XC0A5,0XC0A6,0XC0A7,0XC0A8,0XC0A9,0XC0AA,0XC0AB,0XC0AC,0XC0AD,0XC0AE,0XC0AF,
-0XC0B0,0XC0B1,0XC0B2,0XC0B3,0XC0B4,0XC0B5,0XC0B6,0XC0B7,0XC0B8,0XC0B9,0XC0BA,0XC0BB,0XC0BC,0XC0BD,0XC0BE,0XC0BF,
-0XC0C0,0XC0C1,0XC0C2,0XC0C3,0XC0C4,0XC0C5,0XC0C6,0XC0C7,0XC0C8,0XC0C9,0XC0CA,0XC0CB,0XC0CC,0XC0CD,0XC0CE,0XC0CF,
-0XC0D0,0XC0D1,0XC0D2,0XC0D3,0XC0D4,0XC0D5,0XC0D6,0XC0D7,0XC0D8,0XC0D9,0XC0DA,0XC0DB,0XC0DC,0XC0DD,0XC0DE,0XC0DF,
-0XC0E0,0XC0E1,0XC0E2,0XC0E3,0XC0E4,0XC0E5,0XC0E6,0XC0E7,0XC0E8,0XC0E9,0XC0EA,0XC0EB,0XC0EC,0XC0ED,0XC0EE,0XC0EF,
-0XC0F0,0XC0F1,0XC0F2,0XC0F3,0XC0F4,0XC0F5,0XC0F6,0XC0F7,0XC0F8,0XC0F9,0XC0FA,0XC0FB,0XC0FC,0XC0FD,0XC0FE,0XC0FF,
-0XC140,0XC141,0XC142,0XC143,0XC144,0XC145,0XC146,0XC147,0XC148,0XC149,0XC14A,0XC14B,0XC14C,0XC14D,0XC14E,0XC14F,
-0XC150,0XC151,0XC152,0XC153,0XC154,0XC155,0XC156,0XC157,0XC158,0XC159,0XC15A,0XC15B,0XC15C,0XC15D,0XC15E,0XC15F,
-0XC160,0XC161,0XC162,0XC163,0XC164,0XC165,0XC166,0XC167,0XC168,0XC169,0XC16A,0XC16B,0XC16C,0XC16D,0XC16E,0XC16F,
-0XC170,0XC171,0XC172,0XC173,0XC174,0XC175,0XC176,0XC177,0XC178,0XC179,0XC17A,0XC17B,0XC17C,0XC17D,0XC17E,0XC17F,
-0XC180,0XC181,0XC182,0XC183,0XC184,0XC185,0XC186,0XC187,0XC188,0XC189,0XC18A,0XC18B,0XC18C,0XC18D,0XC18E,0XC18F,
-0XC190,0XC191,0XC192,0XC193,0XC194,0XC195,0XC196,0XC197,0XC198,0XC199,0XC19A,0XC19B,0XC19C,0XC19D,0XC19E,0XC19F,
-0XC1A0,0XC1A1,0XC1A2,0XC1A3,0XC1A4,0XC1A5,0XC1A6,0XC1A7,0XC1A8,0XC1A9,0XC1AA,0XC1AB,0XC1AC,0XC1AD,0XC1AE,0XC1AF,
-0XC1B0,0XC1B1,0XC1B2,0XC1B3,0XC1B4,0XC1B5,0XC1B6,0XC1B7,0XC1B8,0XC1B9,0XC1BA,0XC1BB,0XC1BC,0XC1BD,0XC1BE,0XC1BF,
-0XC1C0,0XC1C1,0XC1C2,0XC1C3,0XC1C4,0XC1C5,0XC1C6,0XC1C7,0XC1C8,0XC1C9,0XC1CA,0XC1CB,0XC1CC,0XC1CD,0XC1CE,0XC1CF,
-0XC1D0,0XC1D1,0XC1D2,0XC1D3,0XC1D4,0XC1D5,0XC1D6,0XC1D7,0XC1D8,0XC1D9,0XC1DA,0XC1DB,0XC1DC,0XC1DD,0XC1DE,0XC1DF,
-0XC1E0,0XC1E1,0XC1E2,0XC1E3,0XC1E4,0XC1E5,0XC1E6,0XC1E7,0XC1E8,0XC1E9,0XC1EA,0XC1EB,0XC1EC,0XC1ED,0XC1EE,0XC1EF,
-0XC1F0,0XC1F1,0XC1F2,0XC1F3,0XC1F4,0XC1F5,0XC1F6,0XC1F7,0XC1F8,0XC1F9,0XC1FA,0XC1FB,0XC1FC,0XC1FD,0XC1FE,0XC1FF,
-0XC240,0XC241,0XC242,0XC243,0XC244,0XC245,0XC246,0XC247,0XC248,0XC249,0XC24A,0XC24B,0XC24C,0XC24D,0XC24E,0XC24F,
-0XC250,0XC251,0XC252,0XC253,0XC254,0XC255,0XC256,0XC257,0XC258,0XC259,0XC25A,0XC25B,0XC25C,0XC25D,0XC25E,0XC25F,
-0XC260,0XC261,0XC262,0XC263,0XC264,0XC265,0XC266,0XC267,0XC268,0XC269,0XC26A,0XC26B,0XC26C,0XC26D,0XC26E,0XC26F,
-0XC270,0XC271,0XC272,0XC273,0XC274,0XC275,0XC276,0XC277,0XC278,0XC279,0XC27A,0XC27B,0XC27C,0XC27D,0XC27E,0XC27F,
-0XC280,0XC281,0XC282,0XC283,0XC284,0XC285,0XC286,0XC287,0XC288,0XC289,0XC28A,0XC28B,0XC28C,0XC28D,0XC28E,0XC28F,
-0XC290,0XC291,0XC292,0XC293,0XC294,0XC295,0XC296,0XC297,0XC298,0XC299,0XC29A,0XC29B,0XC29C,0XC29D,0XC29E,0XC29F,
-0XC2A0,0XC2A1,0XC2A2,0XC2A3,0XC2A4,0XC2A5,0XC2A6,0XC2A7,0XC2A8,0XC2A9,0XC2AA,0XC2AB,0XC2AC,0XC2AD,0XC2AE,0XC2AF,
-0XC2B0,0XC2B1,0XC2B2,0XC2B3,0XC2B4,0XC2B5,0XC2B6,0XC2B7,0XC2B8,0XC2B9,0XC2BA,0XC2BB,0XC2BC,0XC2BD,0XC2BE,0XC2BF,
-0XC2C0,0XC2C1,0XC2C2,0XC2C3,0XC2C4,0XC2C5,0XC2C6,0XC2C7,0XC2C8,0XC2C9,0XC2CA,0XC2CB,0XC2CC,0XC2CD,0XC2CE,0XC2CF,
-0XC2D0,0XC2D1,0XC2D2,0XC2D3,0XC2D4,0XC2D5,0XC2D6,0XC2D7,0XC2D8,0XC2D9,0XC2DA,0XC2DB,0XC2DC,0XC2DD,0XC2DE,0XC2DF,
-0XC2E0,0XC2E1,0XC2E2,0XC2E3,0XC2E4,0XC2E5,0XC2E6,0XC2E7,0XC2E8,0XC2E9,0XC2EA,0XC2EB,0XC2EC,0XC2ED,0XC2EE,0XC2EF,
-0XC2F0,0XC2F1,0XC2F2,0XC2F3,0XC2F4,0XC2F5,0XC2F6,0XC2F7,0XC2F8,0XC2F9,0XC2FA,0XC2FB,0XC2FC,0XC2FD,0XC2FE,0XC2FF,
-0XC340,0XC341,0XC342,0XC343,0XC344,0XC345,0XC346,0XC347,0XC348,0XC349,0XC34A,0XC34B,0XC34C,0XC34D,0XC34E,0XC34F,
-0XC350,0XC351,0XC352,0XC353,0XC354,0XC355,0XC356,0XC357,0XC358,0XC359,0XC35A,0XC35B,0XC35C,0XC35D,0XC35E,0XC35F,
-0XC360,0XC361,0XC362,0XC363,0XC364,0XC365,0XC366,0XC367,0XC368,0XC369,0XC36A,0XC36B,0XC36C,0XC36D,0XC36E,0XC36F,
-0XC370,0XC371,0XC372,0XC373,0XC374,0XC375,0XC376,0XC377,0XC378,0XC379,0XC37A,0XC37B,0XC37C,0XC37D,0XC37E,0XC37F,
-0XC380,0XC381,0XC382,0XC383,0XC384,0XC385,0XC386,0XC387,0XC388,0XC389,0XC38A,0XC38B,0XC38C,0XC38D,0XC38E,0XC38F,
-0XC390,0XC391,0XC392,0XC393,0XC394,0XC395,0XC396,0XC397,0XC398,0XC399,0XC39A,0XC39B,0XC39C,0XC39D,0XC39E,0XC39F,
-0XC3A0,0XC3A1,0XC3A2,0XC3A3,0XC3A4,0XC3A5,0XC3A6,0XC3A7,0XC3A8,0XC3A9,0XC3AA,0XC3AB,0XC3AC,0XC3AD,0XC3AE,0XC3AF,
-0XC3B0,0XC3B1,0XC3B2,0XC3B3,0XC3B4,0XC3B5,0XC3B6,0XC3B7,0XC3B8,0XC3B9,0XC3BA,0XC3BB,0XC3BC,0XC3BD,0XC3BE,0XC3BF,
-0XC3C0,0XC3C1,0XC3C2,0XC3C3,0XC3C4,0XC3C5,0XC3C6,0XC3C7,0XC3C8,0XC3C9,0XC3CA,0XC3CB,0XC3CC,0XC3CD,0XC3CE,0XC3CF,
-0XC3D0,0XC3D1,0XC3D2,0XC3D3,0XC3D4,0XC3D5,0XC3D6,0XC3D7,0XC3D8,0XC3D9,0XC3DA,0XC3DB,0XC3DC,0XC3DD,0XC3DE,0XC3DF,
-0XC3E0,0XC3E1,0XC3E2,0XC3E3,0XC3E4,0XC3E5,0XC3E6,0XC3E7,0XC3E8,0XC3E9,0XC3EA,0XC3EB,0XC3EC,0XC3ED,0XC3EE,0XC3EF,
-0XC3F0,0XC3F1,0XC3F2,0XC3F3,0XC3F4,0XC3F5,0XC3F6,0XC3F7,0XC3F8,0XC3F9,0XC3FA,0XC3FB,0XC3FC,0XC3FD,0XC3FE,0XC3FF,
-0XC440,0XC441,0XC442,0XC443,0XC444,0XC445,0XC446,0XC447,0XC448,0XC449,0XC44A,0XC44B,0XC44C,0XC44D,0XC44E,0XC44F,
-0XC450,0XC451,0XC452,0XC453,0XC454,0XC455,0XC456,0XC457,0XC458,0XC459,0XC45A,0XC45B,0XC45C,0XC45D,0XC45E,0XC45F,
-0XC460,0XC461,0XC462,0XC463,0XC464,0XC465,0XC466,0XC467,0XC468,0XC469,0XC46A,0XC46B,0XC46C,0XC46D,0XC46E,0XC46F,
-0XC470,0XC471,0XC472,0XC473,0XC474,0XC475,0XC476,0XC477,0XC478,0XC479,0XC47A,0XC47B,0XC47C,0XC47D,0XC47E,0XC47F,
-0XC480,0XC481,0XC482,0XC483,0XC484,0XC485,0XC486,0XC487,0XC488,0XC489,0XC48A,0XC48B,0XC48C,0XC48D,0XC48E,0XC48F,
-0XC490,0XC491,0XC492,0XC493,0XC494,0XC495,0XC496,0XC497,0XC498,0XC499,0XC49A,0XC49B,0XC49C,0XC49D,0XC49E,0XC49F,
-0XC4A0,0XC4A1,0XC4A2,0XC4A3,0XC4A4,0XC4A5,0XC4A6,0XC4A7,0XC4A8,0XC4A9,0XC4AA,0XC4AB,0XC4AC,0XC4AD,0XC4AE,0XC4AF,
-0XC4B0,0XC4B1,0XC4B2,0XC4B3,0XC4B4,0XC4B5,0XC4B6,0XC4B7,0XC4B8,0XC4B9,0XC4BA,0XC4BB,0XC4BC,0XC4BD,0XC4BE,0XC4BF,
-0XC4C0,0XC4C1,0XC4C2,0XC4C3,0XC4C4,0XC4C5,0XC4C6,0XC4C7,0XC4C8,0XC4C9,0XC4CA,0XC4CB,0XC4CC,0XC4CD,0XC4CE,0XC4CF,
-0XC4D0,0XC4D1,0XC4D2,0XC4D3,0XC4D4,0XC4D5,0XC4D6,0XC4D7,0XC4D8,0XC4D9,0XC4DA,0XC4DB,0XC4DC,0XC4DD,0XC4DE,0XC4DF,
-0XC4E0,0XC4E1,0XC4E2,0XC4E3,0XC4E4,0XC4E5,0XC4E6,0XC4E7,0XC4E8,0XC4E9,0XC4EA,0XC4EB,0XC4EC,0XC4ED,0XC4EE,0XC4EF,
-0XC4F0,0XC4F1,0XC4F2,0XC4F3,0XC4F4,0XC4F5,0XC4F6,0XC4F7,0XC4F8,0XC4F9,0XC4FA,0XC4FB,0XC4FC,0XC4FD,0XC4FE,0XC4FF,
-0XC540,0XC541,0XC542,0XC543,0XC544,0XC545,0XC546,0XC547,0XC548,0XC549,0XC54A,0XC54B,0XC54C,0XC54D,0XC54E,0XC54F,
-0XC550,0XC551,0XC552,0XC553,0XC554,0XC555,0XC556,0XC557,0XC558,0XC559,0XC55A,0XC55B,0XC55C,0XC55D,0XC55E,0XC55F,
-0XC560,0XC561,0XC562,0XC563,0XC564,0XC565,0XC566,0XC567,0XC568,0XC569,0XC56A,0XC56B,0XC56C,0XC56D,0XC56E,0XC56F,
-0XC570,0XC571,0XC572,0XC573,0XC574,0XC575,0XC576,0XC577,0XC578,0XC579,0XC57A,0XC57B,0XC57C,0XC57D,0XC57E,0XC57F,
-0XC580,0XC581,0XC582,0XC583,0XC584,0XC585,0XC586,0XC587,0XC588,0XC589,0XC58A,0XC58B,0XC58C,0XC58D,0XC58E,0XC58F,
-0XC590,0XC591,0XC592,0XC593,0XC594,0XC595,0XC596,0XC597,0XC598,0XC599,0XC59A,0XC59B,0XC59C,0XC59D,0XC59E,0XC59F,
-0XC5A0,0XC5A1,0XC5A2,0XC5A3,0XC5A4,0XC5A5,0XC5A6,0XC5A7,0XC5A8,0XC5A9,0XC5AA,0XC5AB,0XC5AC,0XC5AD,0XC5AE,0XC5AF,
-0XC5B0,0XC5B1,0XC5B2,0XC5B3,0XC5B4,0XC5B5,0XC5B6,0XC5B7,0XC5B8,0XC5B9,0XC5BA,0XC5BB,0XC5BC,0XC5BD,0XC5BE,0XC5BF,
-0XC5C0,0XC5C1,0XC5C2,0XC5C3,0XC5C4,0XC5C5,0XC5C6,0XC5C7,0XC5C8,0XC5C9,0XC5CA,0XC5CB,0XC5CC,0XC5CD,0XC5CE,0XC5CF,
-0XC5D0,0XC5D1,0XC5D2,0XC5D3,0XC5D4,0XC5D5,0XC5D6,0XC5D7,0XC5D8,0XC5D9,0XC5DA,0XC5DB,0XC5DC,0XC5DD,0XC5DE,0XC5DF,
-0XC5E0,0XC5E1,0XC5E2,0XC5E3,0XC5E4,0XC5E5,0XC5E6,0XC5E7,0XC5E8,0XC5E9,0XC5EA,0XC5EB,0XC5EC,0XC5ED,0XC5EE,0XC5EF,
-0XC5F0,0XC5F1,0XC5F2,0XC5F3,0XC5F4,0XC5F5,0XC5F6,0XC5F7,0XC5F8,0XC5F9,0XC5FA,0XC5FB,0XC5FC,0XC5FD,0XC5FE,0XC5FF,
-0XC640,0XC641,0XC642,0XC643,0XC644,0XC645,0XC646,0XC647,0XC648,0XC649,0XC64A,0XC64B,0XC64C,0XC64D,0XC64E,0XC64F,
-0XC650,0XC651,0XC652,0XC653,0XC654,0XC655,0XC656,0XC657,0XC658,0XC659,0XC65A,0XC65B,0XC65C,0XC65D,0XC65E,0XC65F,
-0XC660,0XC661,0XC662,0XC663,0XC664,0XC665,0XC666,0XC667,0XC668,0XC669,0XC66A,0XC66B,0XC66C,0XC66D,0XC66E,0XC66F,
-0XC670,0XC671,0XC672,0XC673,0XC674,0XC675,0XC676,0XC677,0XC678,0XC679,0XC67A,0XC67B,0XC67C,0XC67D,0XC67E,0XC67F,
-0XC680,0XC681,0XC682,0XC683,0XC684,0XC685,0XC686,0XC687,0XC688,0XC689,0XC68A,0XC68B,0XC68C,0XC68D,0XC68E,0XC68F,
-0XC690,0XC691,0XC692,0XC693,0XC694,0XC695,0XC696,0XC697,0XC698,0XC699,0XC69A,0XC69B,0XC69C,0XC69D,0XC69E,0XC69F,
-0XC6A0,0XC6A1,0XC6A2,0XC6A3,0XC6A4,0XC6A5,0XC6A6,0XC6A7,0XC6A8,0XC6A9,0XC6AA,0XC6AB,0XC6AC,0XC6AD,0XC6AE,0XC6AF,
-0XC6B0,0XC6B1,0XC6B2,0XC6B3,0XC6B4,0XC6B5,0XC6B6,0XC6B7,0XC6B8,0XC6B9,0XC6BA,0XC6BB,0XC6BC,0XC6BD,0XC6BE,0XC6BF,
-0XC6C0,0XC6C1,0XC6C2,0XC6C3,0XC6C4,0XC6C5,0XC6C6,0XC6C7,0XC6C8,0XC6C9,0XC6CA,0XC6CB,0XC6CC,0XC6CD,0XC6CE,0XC6CF,
-0XC6D0,0XC6D1,0XC6D2,0XC6D3,0XC6D4,0XC6D5,0XC6D6,0XC6D7,0XC6D8,0XC6D9,0XC6DA,0XC6DB,0XC6DC,0XC6DD,0XC6DE,0XC6DF,
-0XC6E0,0XC6E1,0XC6E2,0XC6E3,0XC6E4,0XC6E5,0XC6E6,0XC6E7,0XC6E8,0XC6E9,0XC6EA,0XC6EB,0XC6EC,0XC6ED,0XC6EE,0XC6EF,
-0XC6F0,0XC6F1,0XC6F2,0XC6F3,0XC6F4,0XC6F5,0XC6F6,0XC6F7,0XC6F8,0XC6F9,0XC6FA,0XC6FB,0XC6FC,0XC6FD,0XC6FE,0XC6FF,
-0XC740,0XC741,0XC742,0XC743,0XC744,0XC745,0XC746,0XC747,0XC748,0XC749,0XC74A,0XC74B,0XC74C,0XC74D,0XC74E,0XC74F,
-0XC750,0XC751,0XC752,0XC753,0XC754,0XC755,0XC756,0XC757,0XC758,0XC759,0XC75A,0XC75B,0XC75C,0XC75D,0XC75E,0XC75F,
-0XC760,0XC761,0XC762,0XC763,0XC764,0XC765,0XC766,0XC767,0XC768,0XC769,0XC76A,0XC76B,0XC76C,0XC76D,0XC76E,0XC76F,
-0XC770,0XC771,0XC772,0XC773,0XC774,0XC775,0XC776,0XC777,0XC778,0XC779,0XC77A,0XC77B,0XC77C,0XC77D,0XC77E,0XC77F,
-0XC780,0XC781,0XC782,0XC783,0XC784,0XC785,0XC786,0XC787,0XC788,0XC789,0XC78A,0XC78B,0XC78C,0XC78D,0XC78E,0XC78F,
-0XC790,0XC791,0XC792,0XC793,0XC794,0XC795,0XC796,0XC797,0XC798,0XC799,0XC79A,0XC79B,0XC79C,0XC79D,0XC79E,0XC79F,
-0XC7A0,0XC7A1,0XC7A2,0XC7A3,0XC7A4,0XC7A5,0XC7A6,0XC7A7,0XC7A8,0XC7A9,0XC7AA,0XC7AB,0XC7AC,0XC7AD,0XC7AE,0XC7AF,
-0XC7B0,0XC7B1,0XC7B2,0XC7B3,0XC7B4,0XC7B5,0XC7B6,0XC7B7,0XC7B8,0XC7B9,0XC7BA,0XC7BB,0XC7BC,0XC7BD,0XC7BE,0XC7BF,
-0XC7C0,0XC7C1,0XC7C2,0XC7C3,0XC7C4,0XC7C5,0XC7C6,0XC7C7,0XC7C8,0XC7C9,0XC7CA,0XC7CB,0XC7CC,0XC7CD,0XC7CE,0XC7CF,
-0XC7D0,0XC7D1,0XC7D2,0XC7D3,0XC7D4,0XC7D5,0XC7D6,0XC7D7,0XC7D8,0XC7D9,0XC7DA,0XC7DB,0XC7DC,0XC7DD,0XC7DE,0XC7DF,
-0XC7E0,0XC7E1,0XC7E2,0XC7E3,0XC7E4,0XC7E5,0XC7E6,0XC7E7,0XC7E8,0XC7E9,0XC7EA,0XC7EB,0XC7EC,0XC7ED,0XC7EE,0XC7EF,
-0XC7F0,0XC7F1,0XC7F2,0XC7F3,0XC7F4,0XC7F5,0XC7F6,0XC7F7,0XC7F8,0XC7F9,0XC7FA,0XC7FB,0XC7FC,0XC7FD,0XC7FE,0XC7FF,
-0XC840,0XC841,0XC842,0XC843,0XC844,0XC845,0XC846,0XC847,0XC848,0XC849,0XC84A,0XC84B,0XC84C,0XC84D,0XC84E,0XC84F,
-0XC850,0XC851,0XC852,0XC853,0XC854,0XC855,0XC856,0XC857,0XC858,0XC859,0XC85A,0XC85B,0XC85C,0XC85D,0XC85E,0XC85F,
-0XC860,0XC861,0XC862,0XC863,0XC864,0XC865,0XC866,0XC867,0XC868,0XC869,0XC86A,0XC86B,0XC86C,0XC86D,0XC86E,0XC86F,
-0XC870,0XC871,0XC872,0XC873,0XC874,0XC875,0XC876,0XC877,0XC878,0XC879,0XC87A,0XC87B,0XC87C,0XC87D,0XC87E,0XC87F,
-0XC880,0XC881,0XC882,0XC883,0XC884,0XC885,0XC886,0XC887,0XC888,0XC889,0XC88A,0XC88B,0XC88C,0XC88D,0XC88E,0XC88F,
-0XC890,0XC891,0XC892,0XC893,0XC894,0XC895,0XC896,0XC897,0XC898,0XC899,0XC89A,0XC89B,0XC89C,0XC89D,0XC89E,0XC89F,
-0XC8A0,0XC8A1,0XC8A2,0XC8A3,0XC8A4,0XC8A5,0XC8A6,0XC8A7,0XC8A8,0XC8A9,0XC8AA,0XC8AB,0XC8AC,0XC8AD,0XC8AE,0XC8AF,
-0XC8B0,0XC8B1,0XC8B2,0XC8B3,0XC8B4,0XC8B5,0XC8B6,0XC8B7,0XC8B8,0XC8B9,0XC8BA,0XC8BB,0XC8BC,0XC8BD,0XC8BE,0XC8BF,
-0XC8C0,0XC8C1,0XC8C2,0XC8C3,0XC8C4,0XC8C5,0XC8C6,0XC8C7,0XC8C8,0XC8C9,0XC8CA,0XC8CB,0XC8CC,0XC8CD,0XC8CE,0XC8CF,
-0XC8D0,0XC8D1,0XC8D2,0XC8D3,0XC8D4,0XC8D5,0XC8D6,0XC8D7,0XC8D8,0XC8D9,0XC8DA,0XC8DB,0XC8DC,0XC8DD,0XC8DE,0XC8DF,
-0XC8E0,0XC8E1,0XC8E2,0XC8E3,0XC8E4,0XC8E5,0XC8E6,0XC8E7,0XC8E8,0XC8E9,0XC8EA,0XC8EB,0XC8EC,0XC8ED,0XC8EE,0XC8EF,
-0XC8F0,0XC8F1,0XC8F2,0XC8F3,0XC8F4,0XC8F5,0XC8F6,0XC8F7,0XC8F8,0XC8F9,0XC8FA,0XC8FB,0XC8FC,0XC8FD,0XC8FE,0XC8FF,
-0XC940,0XC941,0XC942,0XC943,0XC944,0XC945,0XC946,0XC947,0XC948,0XC949,0XC94A,0XC94B,0XC94C,0XC94D,0XC94E,0XC94F,
-0XC950,0XC951,0XC952,0XC953,0XC954,0XC955,0XC956,0XC957,0XC958,0XC959,0XC95A,0XC95B,0XC95C,0XC95D,0XC95E,0XC95F,
-0XC960,0XC961,0XC962,0XC963,0XC964,0XC965,0XC966,0XC967,0XC968,0XC969,0XC96A,0XC96B,0XC96C,0XC96D,0XC96E,0XC96F,
-0XC970,0XC971,0XC972,0XC973,0XC974,0XC975,0XC976,0XC977,0XC978,0XC979,0XC97A,0XC97B,0XC97C,0XC97D,0XC97E,0XC97F,
-0XC980,0XC981,0XC982,0XC983,0XC984,0XC985,0XC986,0XC987,0XC988,0XC989,0XC98A,0XC98B,0XC98C,0XC98D,0XC98E,0XC98F,
-0XC990,0XC991,0XC992,0XC993,0XC994,0XC995,0XC996,0XC997,0XC998,0XC999,0XC99A,0XC99B,0XC99C,0XC99D,0XC99E,0XC99F,
-0XC9A0,0XC9A1,0XC9A2,0XC9A3,0XC9A4,0XC9A5,0XC9A6,0XC9A7,0XC9A8,0XC9A9,0XC9AA,0XC9AB,0XC9AC,0XC9AD,0XC9AE,0XC9AF,
-0XC9B0,0XC9B1,0XC9B2,0XC9B3,0XC9B4,0XC9B5,0XC9B6,0XC9B7,0XC9B8,0XC9B9,0XC9BA,0XC9BB,0XC9BC,0XC9BD,0XC9BE,0XC9BF,
-0XC9C0,0XC9C1,0XC9C2,0XC9C3,0XC9C4,0XC9C5,0XC9C6,0XC9C7,0XC9C8,0XC9C9,0XC9CA,0XC9CB,0XC9CC,0XC9CD,0XC9CE,0XC9CF,
-0XC9D0,0XC9D1,0XC9D2,0XC9D3,0XC9D4,0XC9D5,0XC9D6,0XC9D7,0XC9D8,0XC9D9,0XC9DA,0XC9DB,0XC9DC,0XC9DD,0XC9DE,0XC9DF,
-0XC9E0,0XC9E1,0XC9E2,0XC9E3,0XC9E4,0XC9E5,0XC9E6,0XC9E7,0XC9E8,0XC9E9,0XC9EA,0XC9EB,0XC9EC,0XC9ED,0XC9EE,0XC9EF,
-0XC9F0,0XC9F1,0XC9F2,0XC9F3,0XC9F4,0XC9F5,0XC9F6,0XC9F7,0XC9F8,0XC9F9,0XC9FA,0XC9FB,0XC9FC,0XC9FD,0XC9FE,0XC9FF,
-0XCA40,0XCA41,0XCA42,0XCA43,0XCA44,0XCA45,0XCA46,0XCA47,0XCA48,0XCA49,0XCA4A,0XCA4B,0XCA4C,0XCA4D,0XCA4E,0XCA4F,
-0XCA50,0XCA51,0XCA52,0XCA53,0XCA54,0XCA55,0XCA56,0XCA57,0XCA58,0XCA59,0XCA5A,0XCA5B,0XCA5C,0XCA5D,0XCA5E,0XCA5F,
-0XCA60,0XCA61,0XCA62,0XCA63,0XCA64,0XCA65,0XCA66,0XCA67,0XCA68,0XCA69,0XCA6A,0XCA6B,0XCA6C,0XCA6D,0XCA6E,0XCA6F,
-0XCA70,0XCA71,0XCA72,0XCA73,0XCA74,0XCA75,0XCA76,0XCA77,0XCA78,0XCA79,0XCA7A,0XCA7B,0XCA7C,0XCA7D,0XCA7E,0XCA7F,
-0XCA80,0XCA81,0XCA82,0XCA83,0XCA84,0XCA85,0XCA86,0XCA87,0XCA88,0XCA89,0XCA8A,0XCA8B,0XCA8C,0XCA8D,0XCA8E,0XCA8F,
-0XCA90,0XCA91,0XCA92,0XCA93,0XCA94,0XCA95,0XCA96,0XCA97,0XCA98,0XCA99,0XCA9A,0XCA9B,0XCA9C,0XCA9D,0XCA9E,0XCA9F,
-0XCAA0,0XCAA1,0XCAA2,0XCAA3,0XCAA4,0XCAA5,0XCAA6,0XCAA7,0XCAA8,0XCAA9,0XCAAA,0XCAAB,0XCAAC,0XCAAD,0XCAAE,0XCAAF,
-0XCAB0,0XCAB1,0XCAB2,0XCAB3,0XCAB4,0XCAB5,0XCAB6,0XCAB7,0XCAB8,0XCAB9,0XCABA,0XCABB,0XCABC,0XCABD,0XCABE,0XCABF,
-0XCAC0,0XCAC1,0XCAC2,0XCAC3,0XCAC4,0XCAC5,0XCAC6,0XCAC7,0XCAC8,0XCAC9,0XCACA,0XCACB,0XCACC,0XCACD,0XCACE,0XCACF,
-0XCAD0,0XCAD1,0XCAD2,0XCAD3,0XCAD4,0XCAD5,0XCAD6,0XCAD7,0XCAD8,0XCAD9,0XCADA,0XCADB,0XCADC,0XCADD,0XCADE,0XCADF,
-0XCAE0,0XCAE1,0XCAE2,0XCAE3,0XCAE4,0XCAE5,0XCAE6,0XCAE7,0XCAE8,0XCAE9,0XCAEA,0XCAEB,0XCAEC,0XCAED,0XCAEE,0XCAEF,
-0XCAF0,0XCAF1,0XCAF2,0XCAF3,0XCAF4,0XCAF5,0XCAF6,0XCAF7,0XCAF8,0XCAF9,0XCAFA,0XCAFB,0XCAFC,0XCAFD,0XCAFE,0XCAFF,
-0XCB40,0XCB41,0XCB42,0XCB43,0XCB44,0XCB45,0XCB46,0XCB47,0XCB48,0XCB49,0XCB4A,0XCB4B,0XCB4C,0XCB4D,0XCB4E,0XCB4F,
-0XCB50,0XCB51,0XCB52,0XCB53,0XCB54,0XCB55,0XCB56,0XCB57,0XCB58,0XCB59,0XCB5A,0XCB5B,0XCB5C,0XCB5D,0XCB5E,0XCB5F,
-0XCB60,0XCB61,0XCB62,0XCB63,0XCB64,0XCB65,0XCB66,0XCB67,0XCB68,0XCB69,0XCB6A,0XCB6B,0XCB6C,0XCB6D,0XCB6E,0XCB6F,
-0XCB70,0XCB71,0XCB72,0XCB73,0XCB74,0XCB75,0XCB76,0XCB77,0XCB78,0XCB79,0XCB7A,0XCB7B,0XCB7C,0XCB7D,0XCB7E,0XCB7F,
-0XCB80,0XCB81,0XCB82,0XCB83,0XCB84,0XCB85,0XCB86,0XCB87,0XCB88,0XCB89,0XCB8A,0XCB8B,0XCB8C,0XCB8D,0XCB8E,0XCB8F,
-0XCB90,0XCB91,0XCB92,0XCB93,0XCB94,0XCB95,0XCB96,0XCB97,0XCB98,0XCB99,0XCB9A,0XCB9B,0XCB9C,0XCB9D,0XCB9E,0XCB9F,
-0XCBA0,0XCBA1,0XCBA2,0XCBA3,0XCBA4,0XCBA5,0XCBA6,0XCBA7,0XCBA8,0XCBA9,0XCBAA,0XCBAB,0XCBAC,0XCBAD,0XCBAE,0XCBAF,
-0XCBB0,0XCBB1,0XCBB2,0XCBB3,0XCBB4,0XCBB5,0XCBB6,0XCBB7,0XCBB8,0XCBB9,0XCBBA,0XCBBB,0XCBBC,0XCBBD,0XCBBE,0XCBBF,
-0XCBC0,0XCBC1,0XCBC2,0XCBC3,0XCBC4,0XCBC5,0XCBC6,0XCBC7,0XCBC8,0XCBC9,0XCBCA,0XCBCB,0XCBCC,0XCBCD,0XCBCE,0XCBCF,
-0XCBD0,0XCBD1,0XCBD2,0XCBD3,0XCBD4,0XCBD5,0XCBD6,0XCBD7,0XCBD8,0XCBD9,0XCBDA,0XCBDB,0XCBDC,0XCBDD,0XCBDE,0XCBDF,
-0XCBE0,0XCBE1,0XCBE2,0XCBE3,0XCBE4,0XCBE5,0XCBE6,0XCBE7,0XCBE8,0XCBE9,0XCBEA,0XCBEB,0XCBEC,0XCBED,0XCBEE,0XCBEF,
-0XCBF0,0XCBF1,0XCBF2,0XCBF3,0XCBF4,0XCBF5,0XCBF6,0XCBF7,0XCBF8,0XCBF9,0XCBFA,0XCBFB,0XCBFC,0XCBFD,0XCBFE,0XCBFF,
-0XCC40,0XCC41,0XCC42,0XCC43,0XCC44,0XCC45,0XCC46,0XCC47,0XCC48,0XCC49,0XCC4A,0XCC4B,0XCC4C,0XCC4D,0XCC4E,0XCC4F,
-0XCC50,0XCC51,0XCC52,0XCC53,0XCC54,0XCC55,0XCC56,0XCC57,0XCC58,0XCC59,0XCC5A,0XCC5B,0XCC5C,0XCC5D,0XCC5E,0XCC5F,
-0XCC60,0XCC61,0XCC62,0XCC63,0XCC64,0XCC65,0XCC66,0XCC67,0XCC68,0XCC69,0XCC6A,0XCC6B,0XCC6C,0XCC6D,0XCC6E,0XCC6F,
-0XCC70,0XCC71,0XCC72,0XCC73,0XCC74,0XCC75,0XCC76,0XCC77,0XCC78,0XCC79,0XCC7A,0XCC7B,0XCC7C,0XCC7D,0XCC7E,0XCC7F,
-0XCC80,0XCC81,0XCC82,0XCC83,0XCC84,0XCC85,0XCC86,0XCC87,0XCC88,0XCC89,0XCC8A,0XCC8B,0XCC8C,0XCC8D,0XCC8E,0XCC8F,
-0XCC90,0XCC91,0XCC92,0XCC93,0XCC94,0XCC95,0XCC96,0XCC97,0XCC98,0XCC99,0XCC9A,0XCC9B,0XCC9C,0XCC9D,0XCC9E,0XCC9F,
-0XCCA0,0XCCA1,0XCCA2,0XCCA3,0XCCA4,0XCCA5,0XCCA6,0XCCA7,0XCCA8,0XCCA9,0XCCAA,0XCCAB,0XCCAC,0XCCAD,0XCCAE,0XCCAF,
-0XCCB0,0XCCB1,0XCCB2,0XCCB3,0XCCB4,0XCCB5,0XCCB6,0XCCB7,0XCCB8,0XCCB9,0XCCBA,0XCCBB,0XCCBC,0XCCBD,0XCCBE,0XCCBF,
-0XCCC0,0XCCC1,0XCCC2,0XCCC3,0XCCC4,0XCCC5,0XCCC6,0XCCC7,0XCCC8,0XCCC9,0XCCCA,0XCCCB,0XCCCC,0XCCCD,0XCCCE,0XCCCF,
-0XCCD0,0XCCD1,0XCCD2,0XCCD3,0XCCD4,0XCCD5,0XCCD6,0XCCD7,0XCCD8,0XCCD9,0XCCDA,0XCCDB,0XCCDC,0XCCDD,0XCCDE,0XCCDF,
-0XCCE0,0XCCE1,0XCCE2,0XCCE3,0XCCE4,0XCCE5,0XCCE6,0XCCE7,0XCCE8,0XCCE9,0XCCEA,0XCCEB,0XCCEC,0XCCED,0XCCEE,0XCCEF,
-0XCCF0,0XCCF1,0XCCF2,0XCCF3,0XCCF4,0XCCF5,0XCCF6,0XCCF7,0XCCF8,0XCCF9,0XCCFA,0XCCFB,0XCCFC,0XCCFD,0XCCFE,0XCCFF,
-0XCD40,0XCD41,0XCD42,0XCD43,0XCD44,0XCD45,0XCD46,0XCD47,0XCD48,0XCD49,0XCD4A,0XCD4B,0XCD4C,0XCD4D,0XCD4E,0XCD4F,
-0XCD50,0XCD51,0XCD52,0XCD53,0XCD54,0XCD55,0XCD56,0XCD57,0XCD58,0XCD59,0XCD5A,0XCD5B,0XCD5C,0XCD5D,0XCD5E,0XCD5F,
-0XCD60,0XCD61,0XCD62,0XCD63,0XCD64,0XCD65,0XCD66,0XCD67,0XCD68,0XCD69,0XCD6A,0XCD6B,0XCD6C,0XCD6D,0XCD6E,0XCD6F,
-0XCD70,0XCD71,0XCD72,0XCD73,0XCD74,0XCD75,0XCD76,0XCD77,0XCD78,0XCD79,0XCD7A,0XCD7B,0XCD7C,0XCD7D,0XCD7E,0XCD7F,
-0XCD80,0XCD81,0XCD82,0XCD83,0XCD84,0XCD85,0XCD86,0XCD87,0XCD88,0XCD89,0XCD8A,0XCD8B,0XCD8C,0XCD8D,0XCD8E,0XCD8F,
-0XCD90,0XCD91,0XCD92,0XCD93,0XCD94,0XCD95,0XCD96,0XCD97,0XCD98,0XCD99,0XCD9A,0XCD9B,0XCD9C,0XCD9D,0XCD9E,0XCD9F,
-0XCDA0,0XCDA1,0XCDA2,0XCDA3,0XCDA4,0XCDA5,0XCDA6,0XCDA7,0XCDA8,0XCDA9,0XCDAA,0XCDAB,0XCDAC,0XCDAD,0XCDAE,0XCDAF,
-0XCDB0,0XCDB1,0XCDB2,0XCDB3,0XCDB4,0XCDB5,0XCDB6,0XCDB7,0XCDB8,0XCDB9,0XCDBA,0XCDBB,0XCDBC,0XCDBD,0XCDBE,0XCDBF,
-0XCDC0,0XCDC1,0XCDC2,0XCDC3,0XCDC4,0XCDC5,0XCDC6,0XCDC7,0XCDC8,0XCDC9,0XCDCA,0XCDCB,0XCDCC,0XCDCD,0XCDCE,0XCDCF,
-0XCDD0,0XCDD1,0XCDD2,0XCDD3,0XCDD4,0XCDD5,0XCDD6,0XCDD7,0XCDD8,0XCDD9,0XCDDA,0XCDDB,0XCDDC,0XCDDD,0XCDDE,0XCDDF,
-0XCDE0,0XCDE1,0XCDE2,0XCDE3,0XCDE4,0XCDE5,0XCDE6,0XCDE7,0XCDE8,0XCDE9,0XCDEA,0XCDEB,0XCDEC,0XCDED,0XCDEE,0XCDEF,
-0XCDF0,0XCDF1,0XCDF2,0XCDF3,0XCDF4,0XCDF5,0XCDF6,0XCDF7,0XCDF8,0XCDF9,0XCDFA,0XCDFB,0XCDFC,0XCDFD,0XCDFE,0XCDFF,
-0XCE40,0XCE41,0XCE42,0XCE43,0XCE44,0XCE45,0XCE46,0XCE47,0XCE48,0XCE49,0XCE4A,0XCE4B,0XCE4C,0XCE4D,0XCE4E,0XCE4F,
-0XCE50,0XCE51,0XCE52,0XCE53,0XCE54,0XCE55,0XCE56,0XCE57,0XCE58,0XCE59,0XCE5A,0XCE5B,0XCE5C,0XCE5D,0XCE5E,0XCE5F,
-0XCE60,0XCE61,0XCE62,0XCE63,0XCE64,0XCE65,0XCE66,0XCE67,0XCE68,0XCE69,0XCE6A,0XCE6B,0XCE6C,0XCE6D,0XCE6E,0XCE6F,
-0XCE70,0XCE71,0XCE72,0XCE73,0XCE74,0XCE75,0XCE76,0XCE77,0XCE78,0XCE79,0XCE7A,0XCE7B,0XCE7C,0XCE7D,0XCE7E,0XCE7F,
-0XCE80,0XCE81,0XCE82,0XCE83,0XCE84,0XCE85,0XCE86,0XCE87,0XCE88,0XCE89,0XCE8A,0XCE8B,0XCE8C,0XCE8D,0XCE8E,0XCE8F,
-0XCE90,0XCE91,0XCE92,0XCE93,0XCE94,0XCE95,0XCE96,0XCE97,0XCE98,0XCE99,0XCE9A,0XCE9B,0XCE9C,0XCE9D,0XCE9E,0XCE9F,
-0XCEA0,0XCEA1,0XCEA2,0XCEA3,0XCEA4,0XCEA5,0XCEA6,0XCEA7,0XCEA8,0XCEA9,0XCEAA,0XCEAB,0XCEAC,0XCEAD,0XCEAE,0XCEAF,
-0XCEB0,0XCEB1,0XCEB2,0XCEB3,0XCEB4,0XCEB5,0XCEB6,0XCEB7,0XCEB8,0XCEB9,0XCEBA,0XCEBB,0XCEBC,0XCEBD,0XCEBE,0XCEBF,
-0XCEC0,0XCEC1,0XCEC2,0XCEC3,0XCEC4,0XCEC5,0XCEC6,0XCEC7,0XCEC8,0XCEC9,0XCECA,0XCECB,0XCECC,0XCECD,0XCECE,0XCECF,
-0XCED0,0XCED1,0XCED2,0XCED3,0XCED4,0XCED5,0XCED6,0XCED7,0XCED8,0XCED9,0XCEDA,0XCEDB,0XCEDC,0XCEDD,0XCEDE,0XCEDF,
-0XCEE0,0XCEE1,0XCEE2,0XCEE3,0XCEE4,0XCEE5,0XCEE6,0XCEE7,0XCEE8,0XCEE9,0XCEEA,0XCEEB,0XCEEC,0XCEED,0XCEEE,0XCEEF,
-0XCEF0,0XCEF1,0XCEF2,0XCEF3,0XCEF4,0XCEF5,0XCEF6,0XCEF7,0XCEF8,0XCEF9,0XCEFA,0XCEFB,0XCEFC,0XCEFD,0XCEFE,0XCEFF,
-0XCF40,0XCF41,0XCF42,0XCF43,0XCF44,0XCF45,0XCF46,0XCF47,0XCF48,0XCF49,0XCF4A,0XCF4B,0XCF4C,0XCF4D,0XCF4E,0XCF4F,
-0XCF50,0XCF51,0XCF52,0XCF53,0XCF54,0XCF55,0XCF56,0XCF57,0XCF58,0XCF59,0XCF5A,0XCF5B,0XCF5C,0XCF5D,0XCF5E,0XCF5F,
-0XCF60,0XCF61,0XCF62,0XCF63,0XCF64,0XCF65,0XCF66,0XCF67,0XCF68,0XCF69,0XCF6A,0XCF6B,0XCF6C,0XCF6D,0XCF6E,0XCF6F,
-0XCF70,0XCF71,0XCF72,0XCF73,0XCF74,0XCF75,0XCF76,0XCF77,0XCF78,0XCF79,0XCF7A,0XCF7B,0XCF7C,0XCF7D,0XCF7E,0XCF7F,
-0XCF80,0XCF81,0XCF82,0XCF83,0XCF84,0XCF85,0XCF86,0XCF87,0XCF88,0XCF89,0XCF8A,0XCF8B,0XCF8C,0XCF8D,0XCF8E,0XCF8F,
-0XCF90,0XCF91,0XCF92,0XCF93,0XCF94,0XCF95,0XCF96,0XCF97,0XCF98,0XCF99,0XCF9A,0XCF9B,0XCF9C,0XCF9D,0XCF9E,0XCF9F,
-0XCFA0,0XCFA1,0XCFA2,0XCFA3,0XCFA4,0XCFA5,0XCFA6,0XCFA7,0XCFA8,0XCFA9,0XCFAA,0XCFAB,0XCFAC,0XCFAD,0XCFAE,0XCFAF,
-0XCFB0,0XCFB1,0XCFB2,0XCFB3,0XCFB4,0XCFB5,0XCFB6,0XCFB7,0XCFB8,0XCFB9,0XCFBA,0XCFBB,0XCFBC,0XCFBD,0XCFBE,0XCFBF,
-0XCFC0,0XCFC1,0XCFC2,0XCFC3,0XCFC4,0XCFC5,0XCFC6,0XCFC7,0XCFC8,0XCFC9,0XCFCA,0XCFCB,0XCFCC,0XCFCD,0XCFCE,0XCFCF,
-0XCFD0,0XCFD1,0XCFD2,0XCFD3,0XCFD4,0XCFD5,0XCFD6,0XCFD7,0XCFD8,0XCFD9,0XCFDA,0XCFDB,0XCFDC,0XCFDD,0XCFDE,0XCFDF,
-0XCFE0,0XCFE1,0XCFE2,0XCFE3,0XCFE4,0XCFE5,0XCFE6,0XCFE7,0XCFE8,0XCFE9,0XCFEA,0XCFEB,0XCFEC,0XCFED,0XCFEE,0XCFEF,
-0XCFF0,0XCFF1,0XCFF2,0XCFF3,0XCFF4,0XCFF5,0XCFF6,0XCFF7,0XCFF8,0XCFF9,0XCFFA,0XCFFB,0XCFFC,0XCFFD,0XCFFE,0XCFFF,
-0XD040,0XD041,0XD042,0XD043,0XD044,0XD045,0XD046,0XD047,0XD048,0XD049,0XD04A,0XD04B,0XD04C,0XD04D,0XD04E,0XD04F,
-0XD050,0XD051,0XD052,0XD053,0XD054,0XD055,0XD056,0XD057,0XD058,0XD059,0XD05A,0XD05B,0XD05C,0XD05D,0XD05E,0XD05F,
-0XD060,0XD061,0XD062,0XD063,0XD064,0XD065,0XD066,0XD067,0XD068,0XD069,0XD06A,0XD06B,0XD06C,0XD06D,0XD06E,0XD06F,
-0XD070,0XD071,0XD072,0XD073,0XD074,0XD075,0XD076,0XD077,0XD078,0XD079,0XD07A,0XD07B,0XD07C,0XD07D,0XD07E,0XD07F,
-0XD080,0XD081,0XD082,0XD083,0XD084,0XD085,0XD086,0XD087,0XD088,0XD089,0XD08A,0XD08B,0XD08C,0XD08D,0XD08E,0XD08F,
-0XD090,0XD091,0XD092,0XD093,0XD094,0XD095,0XD096,0XD097,0XD098,0XD099,0XD09A,0XD09B,0XD09C,0XD09D,0XD09E,0XD09F,
-0XD0A0,0XD0A1,0XD0A2,0XD0A3,0XD0A4,0XD0A5,0XD0A6,0XD0A7,0XD0A8,0XD0A9,0XD0AA,0XD0AB,0XD0AC,0XD0AD,0XD0AE,0XD0AF,
-0XD0B0,0XD0B1,0XD0B2,0XD0B3,0XD0B4,0XD0B5,0XD0B6,0XD0B7,0XD0B8,0XD0B9,0XD0BA,0XD0BB,0XD0BC,0XD0BD,0XD0BE,0XD0BF,
-0XD0C0,0XD0C1,0XD0C2,0XD0C3,0XD0C4,0XD0C5,0XD0C6,0XD0C7,0XD0C8,0XD0C9,0XD0CA,0XD0CB,0XD0CC,0XD0CD,0XD0CE,0XD0CF,
-0XD0D0,0XD0D1,0XD0D2,0XD0D3,0XD0D4,0XD0D5,0XD0D6,0XD0D7,0XD0D8,0XD0D9,0XD0DA,0XD0DB,0XD0DC,0XD0DD,0XD0DE,0XD0DF,
-0XD0E0,0XD0E1,0XD0E2,0XD0E3,0XD0E4,0XD0E5,0XD0E6,0XD0E7,0XD0E8,0XD0E9,0XD0EA,0XD0EB,0XD0EC,0XD0ED,0XD0EE,0XD0EF,
-0XD0F0,0XD0F1,0XD0F2,0XD0F3,0XD0F4,0XD0F5,0XD0F6,0XD0F7,0XD0F8,0XD0F9,0XD0FA,0XD0FB,0XD0FC,0XD0FD,0XD0FE,0XD0FF,
-0XD140,0XD141,0XD142,0XD143,0XD144,0XD145,0XD146,0XD147,0XD148,0XD149,0XD14A,0XD14B,0XD14C,0XD14D,0XD14E,0XD14F,
-0XD150,0XD151,0XD152,0XD153,0XD154,0XD155,0XD156,0XD157,0XD158,0XD159,0XD15A,0XD15B,0XD15C,0XD15D,0XD15E,0XD15F,
-0XD160,0XD161,0XD162,0XD163,0XD164,0XD165,0XD166,0XD167,0XD168,0XD169,0XD16A,0XD16B,0XD16C,0XD16D,0XD16E,0XD16F,
-0XD170,0XD171,0XD172,0XD173,0XD174,0XD175,0XD176,0XD177,0XD178,0XD179,0XD17A,0XD17B,0XD17C,0XD17D,0XD17E,0XD17F,
-0XD180,0XD181,0XD182,0XD183,0XD184,0XD185,0XD186,0XD187,0XD188,0XD189,0XD18A,0XD18B,0XD18C,0XD18D,0XD18E,0XD18F,
-0XD190,0XD191,0XD192,0XD193,0XD194,0XD195,0XD196,0XD197,0XD198,0XD199,0XD19A,0XD19B,0XD19C,0XD19D,0XD19E,0XD19F,
-0XD1A0,0XD1A1,0XD1A2,0XD1A3,0XD1A4,0XD1A5,0XD1A6,0XD1A7,0XD1A8,0XD1A9,0XD1AA,0XD1AB,0XD1AC,0XD1AD,0XD1AE,0XD1AF,
-0XD1B0,0XD1B1,0XD1B2,0XD1B3,0XD1B4,0XD1B5,0XD1B6,0XD1B7,0XD1B8,0XD1B9,0XD1BA,0XD1BB,0XD1BC,0XD1BD,0XD1BE,0XD1BF,
-0XD1C0,0XD1C1,0XD1C2,0XD1C3,0XD1C4,0XD1C5,0XD1C6,0XD1C7,0XD1C8,0XD1C9,0XD1CA,0XD1CB,0XD1CC,0XD1CD,0XD1CE,0XD1CF,
-0XD1D0,0XD1D1,0XD1D2,0XD1D3,0XD1D4,0XD1D5,0XD1D6,0XD1D7,0XD1D8,0XD1D9,0XD1DA,0XD1DB,0XD1DC,0XD1DD,0XD1DE,0XD1DF,
-0XD1E0,0XD1E1,0XD1E2,0XD1E3,0XD1E4,0XD1E5,0XD1E6,0XD1E7,0XD1E8,0XD1E9,0XD1EA,0XD1EB,0XD1EC,0XD1ED,0XD1EE,0XD1EF,
-0XD1F0,0XD1F1,0XD1F2,0XD1F3,0XD1F4,0XD1F5,0XD1F6,0XD1F7,0XD1F8,0XD1F9,0XD1FA,0XD1FB,0XD1FC,0XD1FD,0XD1FE,0XD1FF,
-0XD240,0XD241,0XD242,0XD243,0XD244,0XD245,0XD246,0XD247,0XD248,0XD249,0XD24A,0XD24B,0XD24C,0XD24D,0XD24E,0XD24F,
-0XD250,0XD251,0XD252,0XD253,0XD254,0XD255,0XD256,0XD257,0XD258,0XD259,0XD25A,0XD25B,0XD25C,0XD25D,0XD25E,0XD25F,
-0XD260,0XD261,0XD262,0XD263,0XD264,0XD265,0XD266,0XD267,0XD268,0XD269,0XD26A,0XD26B,0XD26C,0XD26D,0XD26E,0XD26F,
-0XD270,0XD271,0XD272,0XD273,0XD274,0XD275,0XD276,0XD277,0XD278,0XD279,0XD27A,0XD27B,0XD27C,0XD27D,0XD27E,0XD27F,
-0XD280,0XD281,0XD282,0XD283,0XD284,0XD285,0XD286,0XD287,0XD288,0XD289,0XD28A,0XD28B,0XD28C,0XD28D,0XD28E,0XD28F,
-0XD290,0XD291,0XD292,0XD293,0XD294,0XD295,0XD296,0XD297,0XD298,0XD299,0XD29A,0XD29B,0XD29C,0XD29D,0XD29E,0XD29F,
-0XD2A0,0XD2A1,0XD2A2,0XD2A3,0XD2A4,0XD2A5,0XD2A6,0XD2A7,0XD2A8,0XD2A9,0XD2AA,0XD2AB,0XD2AC,0XD2AD,0XD2AE,0XD2AF,
-0XD2B0,0XD2B1,0XD2B2,0XD2B3,0XD2B4,0XD2B5,0XD2B6,0XD2B7,0XD2B8,0XD2B9,0XD2BA,0XD2BB,0XD2BC,0XD2BD,0XD2BE,0XD2BF,
-0XD2C0,0XD2C1,0XD2C2,0XD2C3,0XD2C4,0XD2C5,0XD2C6,0XD2C7,0XD2C8,0XD2C9,0XD2CA,0XD2CB,0XD2CC,0XD2CD,0XD2CE,0XD2CF,
-0XD2D0,0XD2D1,0XD2D2,0XD2D3,0XD2D4,0XD2D5,0XD2D6,0XD2D7,0XD2D8,0XD2D9,0XD2DA,0XD2DB,0XD2DC,0XD2DD,0XD2DE,0XD2DF,
-0XD2E0,0XD2E1,0XD2E2,0XD2E3,0XD2E4,0XD2E5,0XD2E6,0XD2E7,0XD2E8,0XD2E9,0XD2EA,0XD2EB,0XD2EC,0XD2ED,0XD2EE,0XD2EF,
-0XD2F0,0XD2F1,0XD2F2,0XD2F3,0XD2F4,0XD2F5,0XD2F6,0XD2F7,0XD2F8,0XD2F9,0XD2FA,0XD2FB,0XD2FC,0XD2FD,0XD2FE,0XD2FF,
-0XD340,0XD341,0XD342,0XD343,0XD344,0XD345,0XD346,0XD347,0XD348,0XD349,0XD34A,0XD34B,0XD34C,0XD34D,0XD34E,0XD34F,
-0XD350,0XD351,0XD352,0XD353,0XD354,0XD355,0XD356,0XD357,0XD358,0XD359,0XD35A,0XD35B,0XD35C,0XD35D,0XD35E,0XD35F,
-0XD360,0XD361,0XD362,0XD363,0XD364,0XD365,0XD366,0XD367,0XD368,0XD369,0XD36A,0XD36B,0XD36C,0XD36D,0XD36E,0XD36F,
-0XD370,0XD371,0XD372,0XD373,0XD374,0XD375,0XD376,0XD377,0XD378,0XD379,0XD37A,0XD37B,0XD37C,0XD37D,0XD37E,0XD37F,
-0XD380,0XD381,0XD382,0XD383,0XD384,0XD385,0XD386,0XD387,0XD388,0XD389,0XD38A,0XD38B,0XD38C,0XD38D,0XD38E,0XD38F,
-0XD390,0XD391,0XD392,0XD393,0XD394,0XD395,0XD396,0XD397,0XD398,0XD399,0XD39A,0XD39B,0XD39C,0XD39D,0XD39E,0XD39F,
-0XD3A0,0XD3A1,0XD3A2,0XD3A3,0XD3A4,0XD3A5,0XD3A6,0XD3A7,0XD3A8,0XD3A9,0XD3AA,0XD3AB,0XD3AC,0XD3AD,0XD3AE,0XD3AF,
-0XD3B0,0XD3B1,0XD3B2,0XD3B3,0XD3B4,0XD3B5,0XD3B6,0XD3B7,0XD3B8,0XD3B9,0XD3BA,0XD3BB,0XD3BC,0XD3BD,0XD3BE,0XD3BF,
-0XD3C0,0XD3C1,0XD3C2,0XD3C3,0XD3C4,0XD3C5,0XD3C6,0XD3C7,0XD3C8,0XD3C9,0XD3CA,0XD3CB,0XD3CC,0XD3CD,0XD3CE,0XD3CF,
-0XD3D0,0XD3D1,0XD3D2,0XD3D3,0XD3D4,0XD3D5,0XD3D6,0XD3D7,0XD3D8,0XD3D9,0XD3DA,0XD3DB,0XD3DC,0XD3DD,0XD3DE,0XD3DF,
-0XD3E0,0XD3E1,0XD3E2,0XD3E3,0XD3E4,0XD3E5,0XD3E6,0XD3E7,0XD3E8,0XD3E9,0XD3EA,0XD3EB,0XD3EC,0XD3ED,0XD3EE,0XD3EF,
-0XD3F0,0XD3F1,0XD3F2,0XD3F3,0XD3F4,0XD3F5,0XD3F6,0XD3F7,0XD3F8,0XD3F9,0XD3FA,0XD3FB,0XD3FC,0XD3FD,0XD3FE,0XD3FF,
-0XD440,0XD441,0XD442,0XD443,0XD444,0XD445,0XD446,0XD447,0XD448,0XD449,0XD44A,0XD44B,0XD44C,0XD44D,0XD44E,0XD44F,
-0XD450,0XD451,0XD452,0XD453,0XD454,0XD455,0XD456,0XD457,0XD458,0XD459,0XD45A,0XD45B,0XD45C,0XD45D,0XD45E,0XD45F,
-0XD460,0XD461,0XD462,0XD463,0XD464,0XD465,0XD466,0XD467,0XD468,0XD469,0XD46A,0XD46B,0XD46C,0XD46D,0XD46E,0XD46F,
-0XD470,0XD471,0XD472,0XD473,0XD474,0XD475,0XD476,0XD477,0XD478,0XD479,0XD47A,0XD47B,0XD47C,0XD47D,0XD47E,0XD47F,
-0XD480,0XD481,0XD482,0XD483,0XD484,0XD485,0XD486,0XD487,0XD488,0XD489,0XD48A,0XD48B,0XD48C,0XD48D,0XD48E,0XD48F,
-0XD490,0XD491,0XD492,0XD493,0XD494,0XD495,0XD496,0XD497,0XD498,0XD499,0XD49A,0XD49B,0XD49C,0XD49D,0XD49E,0XD49F,
-0XD4A0,0XD4A1,0XD4A2,0XD4A3,0XD4A4,0XD4A5,0XD4A6,0XD4A7,0XD4A8,0XD4A9,0XD4AA,0XD4AB,0XD4AC,0XD4AD,0XD4AE,0XD4AF,
-0XD4B0,0XD4B1,0XD4B2,0XD4B3,0XD4B4,0XD4B5,0XD4B6,0XD4B7,0XD4B8,0XD4B9,0XD4BA,0XD4BB,0XD4BC,0XD4BD,0XD4BE,0XD4BF,
-0XD4C0,0XD4C1,0XD4C2,0XD4C3,0XD4C4,0XD4C5,0XD4C6,0XD4C7,0XD4C8,0XD4C9,0XD4CA,0XD4CB,0XD4CC,0XD4CD,0XD4CE,0XD4CF,
-0XD4D0,0XD4D1,0XD4D2,0XD4D3,0XD4D4,0XD4D5,0XD4D6,0XD4D7,0XD4D8,0XD4D9,0XD4DA,0XD4DB,0XD4DC,0XD4DD,0XD4DE,0XD4DF,
-0XD4E0,0XD4E1,0XD4E2,0XD4E3,0XD4E4,0XD4E5,0XD4E6,0XD4E7,0XD4E8,0XD4E9,0XD4EA,0XD4EB,0XD4EC,0XD4ED,0XD4EE,0XD4EF,
-0XD4F0,0XD4F1,0XD4F2,0XD4F3,0XD4F4,0XD4F5,0XD4F6,0XD4F7,0XD4F8,0XD4F9,0XD4FA,0XD4FB,0XD4FC,0XD4FD,0XD4FE,0XD4FF,
-0XD540,0XD541,0XD542,0XD543,0XD544,0XD545,0XD546,0XD547,0XD548,0XD549,0XD54A,0XD54B,0XD54C,0XD54D,0XD54E,0XD54F,
-0XD550,0XD551,0XD552,0XD553,0XD554,0XD555,0XD556,0XD557,0XD558,0XD559,0XD55A,0XD55B,0XD55C,0XD55D,0XD55E,0XD55F,
-0XD560,0XD561,0XD562,0XD563,0XD564,0XD565,0XD566,0XD567,0XD568,0XD569,0XD56A,0XD56B,0XD56C,0XD56D,0XD56E,0XD56F,
-0XD570,0XD571,0XD572,0XD573,0XD574,0XD575,0XD576,0XD577,0XD578,0XD579,0XD57A,0XD57B,0XD57C,0XD57D,0XD57E,0XD57F,
-0XD580,0XD581,0XD582,0XD583,0XD584,0XD585,0XD586,0XD587,0XD588,0XD589,0XD58A,0XD58B,0XD58C,0XD58D,0XD58E,0XD58F,
-0XD590,0XD591,0XD592,0XD593,0XD594,0XD595,0XD596,0XD597,0XD598,0XD599,0XD59A,0XD59B,0XD59C,0XD59D,0XD59E,0XD59F,
-0XD5A0,0XD5A1,0XD5A2,0XD5A3,0XD5A4,0XD5A5,0XD5A6,0XD5A7,0XD5A8,0XD5A9,0XD5AA,0XD5AB,0XD5AC,0XD5AD,0XD5AE,0XD5AF,
-0XD5B0,0XD5B1,0XD5B2,0XD5B3,0XD5B4,0XD5B5,0XD5B6,0XD5B7,0XD5B8,0XD5B9,0XD5BA,0XD5BB,0XD5BC,0XD5BD,0XD5BE,0XD5BF,
-0XD5C0,0XD5C1,0XD5C2,0XD5C3,0XD5C4,0XD5C5,0XD5C6,0XD5C7,0XD5C8,0XD5C9,0XD5CA,0XD5CB,0XD5CC,0XD5CD,0XD5CE,0XD5CF,
-0XD5D0,0XD5D1,0XD5D2,0XD5D3,0XD5D4,0XD5D5,0XD5D6,0XD5D7,0XD5D8,0XD5D9,0XD5DA,0XD5DB,0XD5DC,0XD5DD,0XD5DE,0XD5DF,
-0XD5E0,0XD5E1,0XD5E2,0XD5E3,0XD5E4,0XD5E5,0XD5E6,0XD5E7,0XD5E8,0XD5E9,0XD5EA,0XD5EB,0XD5EC,0XD5ED,0XD5EE,0XD5EF,
-0XD5F0,0XD5F1,0XD5F2,0XD5F3,0XD5F4,0XD5F5,0XD5F6,0XD5F7,0XD5F8,0XD5F9,0XD5FA,0XD5FB,0XD5FC,0XD5FD,0XD5FE,0XD5FF,
-0XD640,0XD641,0XD642,0XD643,0XD644,0XD645,0XD646,0XD647,0XD648,0XD649,0XD64A,0XD64B,0XD64C,0XD64D,0XD64E,0XD64F,
-0XD650,0XD651,0XD652,0XD653,0XD654,0XD655,0XD656,0XD657,0XD658,0XD659,0XD65A,0XD65B,0XD65C,0XD65D,0XD65E,0XD65F,
-0XD660,0XD661,0XD662,0XD663,0XD664,0XD665,0XD666,0XD667,0XD668,0XD669,0XD66A,0XD66B,0XD66C,0XD66D,0XD66E,0XD66F,
-0XD670,0XD671,0XD672,0XD673,0XD674,0XD675,0XD676,0XD677,0XD678,0XD679,0XD67A,0XD67B,0XD67C,0XD67D,0XD67E,0XD67F,
-0XD680,0XD681,0XD682,0XD683,0XD684,0XD685,0XD686,0XD687,0XD688,0XD689,0XD68A,0XD68B,0XD68C,0XD68D,0XD68E,0XD68F,
-0XD690,0XD691,0XD692,0XD693,0XD694,0XD695,0XD696,0XD697,0XD698,0XD699,0XD69A,0XD69B,0XD69C,0XD69D,0XD69E,0XD69F,
-0XD6A0,0XD6A1,0XD6A2,0XD6A3,0XD6A4,0XD6A5,0XD6A6,0XD6A7,0XD6A8,0XD6A9,0XD6AA,0XD6AB,0XD6AC,0XD6AD,0XD6AE,0XD6AF,
-0XD6B0,0XD6B1,0XD6B2,0XD6B3,0XD6B4,0XD6B5,0XD6B6,0XD6B7,0XD6B8,0XD6B9,0XD6BA,0XD6BB,0XD6BC,0XD6BD,0XD6BE,0XD6BF,
-0XD6C0,0XD6C1,0XD6C2,0XD6C3,0XD6C4,0XD6C5,0XD6C6,0XD6C7,0XD6C8,0XD6C9,0XD6CA,0XD6CB,0XD6CC,0XD6CD,0XD6CE,0XD6CF,
-0XD6D0,0XD6D1,0XD6D2,0XD6D3,0XD6D4,0XD6D5,0XD6D6,0XD6D7,0XD6D8,0XD6D9,0XD6DA,0XD6DB,0XD6DC,0XD6DD,0XD6DE,0XD6DF,
-0XD6E0,0XD6E1,0XD6E2,0XD6E3,0XD6E4,0XD6E5,0XD6E6,0XD6E7,0XD6E8,0XD6E9,0XD6EA,0XD6EB,0XD6EC,0XD6ED,0XD6EE,0XD6EF,
-0XD6F0,0XD6F1,0XD6F2,0XD6F3,0XD6F4,0XD6F5,0XD6F6,0XD6F7,0XD6F8,0XD6F9,0XD6FA,0XD6FB,0XD6FC,0XD6FD,0XD6FE,0XD6FF,
-0XD740,0XD741,0XD742,0XD743,0XD744,0XD745,0XD746,0XD747,0XD748,0XD749,0XD74A,0XD74B,0XD74C,0XD74D,0XD74E,0XD74F,
-0XD750,0XD751,0XD752,0XD753,0XD754,0XD755,0XD756,0XD757,0XD758,0XD759,0XD75A,0XD75B,0XD75C,0XD75D,0XD75E,0XD75F,
-0XD760,0XD761,0XD762,0XD763,0XD764,0XD765,0XD766,0XD767,0XD768,0XD769,0XD76A,0XD76B,0XD76C,0XD76D,0XD76E,0XD76F,
-0XD770,0XD771,0XD772,0XD773,0XD774,0XD775,0XD776,0XD777,0XD778,0XD779,0XD77A,0XD77B,0XD77C,0XD77D,0XD77E,0XD77F,
-0XD780,0XD781,0XD782,0XD783,0XD784,0XD785,0XD786,0XD787,0XD788,0XD789,0XD78A,0XD78B,0XD78C,0XD78D,0XD78E,0XD78F,
-0XD790,0XD791,0XD792,0XD793,0XD794,0XD795,0XD796,0XD797,0XD798,0XD799,0XD79A,0XD79B,0XD79C,0XD79D,0XD79E,0XD79F,
-0XD7A0,0XD7A1,0XD7A2,0XD7A3,0XD7A4,0XD7A5,0XD7A6,0XD7A7,0XD7A8,0XD7A9,0XD7AA,0XD7AB,0XD7AC,0XD7AD,0XD7AE,0XD7AF,
-0XD7B0,0XD7B1,0XD7B2,0XD7B3,0XD7B4,0XD7B5,0XD7B6,0XD7B7,0XD7B8,0XD7B9,0XD7BA,0XD7BB,0XD7BC,0XD7BD,0XD7BE,0XD7BF,
-0XD7C0,0XD7C1,0XD7C2,0XD7C3,0XD7C4,0XD7C5,0XD7C6,0XD7C7,0XD7C8,0XD7C9,0XD7CA,0XD7CB,0XD7CC,0XD7CD,0XD7CE,0XD7CF,
-0XD7D0,0XD7D1,0XD7D2,0XD7D3,0XD7D4,0XD7D5,0XD7D6,0XD7D7,0XD7D8,0XD7D9,0XD7DA,0XD7DB,0XD7DC,0XD7DD,0XD7DE,0XD7DF,
-0XD7E0,0XD7E1,0XD7E2,0XD7E3,0XD7E4,0XD7E5,0XD7E6,0XD7E7,0XD7E8,0XD7E9,0XD7EA,0XD7EB,0XD7EC,0XD7ED,0XD7EE,0XD7EF,
-0XD7F0,0XD7F1,0XD7F2,0XD7F3,0XD7F4,0XD7F5,0XD7F6,0XD7F7,0XD7F8,0XD7F9,0XD7FA,0XD7FB,0XD7FC,0XD7FD,0XD7FE,0XD7FF,
-0XD840,0XD841,0XD842,0XD843,0XD844,0XD845,0XD846,0XD847,0XD848,0XD849,0XD84A,0XD84B,0XD84C,0XD84D,0XD84E,0XD84F,
-0XD850,0XD851,0XD852,0XD853,0XD854,0XD855,0XD856,0XD857,0XD858,0XD859,0XD85A,0XD85B,0XD85C,0XD85D,0XD85E,0XD85F,
-0XD860,0XD861,0XD862,0XD863,0XD864,0XD865,0XD866,0XD867,0XD868,0XD869,0XD86A,0XD86B,0XD86C,0XD86D,0XD86E,0XD86F,
-0XD870,0XD871,0XD872,0XD873,0XD874,0XD875,0XD876,0XD877,0XD878,0XD879,0XD87A,0XD87B,0XD87C,0XD87D,0XD87E,0XD87F,
-0XD880,0XD881,0XD882,0XD883,0XD884,0XD885,0XD886,0XD887,0XD888,0XD889,0XD88A,0XD88B,0XD88C,0XD88D,0XD88E,0XD88F,
-0XD890,0XD891,0XD892,0XD893,0XD894,0XD895,0XD896,0XD897,0XD898,0XD899,0XD89A,0XD89B,0XD89C,0XD89D,0XD89E,0XD89F,
-0XD8A0,0XD8A1,0XD8A2,0XD8A3,0XD8A4,0XD8A5,0XD8A6,0XD8A7,0XD8A8,0XD8A9,0XD8AA,0XD8AB,0XD8AC,0XD8AD,0XD8AE,0XD8AF,
-0XD8B0,0XD8B1,0XD8B2,0XD8B3,0XD8B4,0XD8B5,0XD8B6,0XD8B7,0XD8B8,0XD8B9,0XD8BA,0XD8BB,0XD8BC,0XD8BD,0XD8BE,0XD8BF,
-0XD8C0,0XD8C1,0XD8C2,0XD8C3,0XD8C4,0XD8C5,0XD8C6,0XD8C7,0XD8C8,0XD8C9,0XD8CA,0XD8CB,0XD8CC,0XD8CD,0XD8CE,0XD8CF,
-0XD8D0,0XD8D1,0XD8D2,0XD8D3,0XD8D4,0XD8D5,0XD8D6,0XD8D7,0XD8D8,0XD8D9,0XD8DA,0XD8DB,0XD8DC,0XD8DD,0XD8DE,0XD8DF,
-0XD8E0,0XD8E1,0XD8E2,0XD8E3,0XD8E4,0XD8E5,0XD8E6,0XD8E7,0XD8E8,0XD8E9,0XD8EA,0XD8EB,0XD8EC,0XD8ED,0XD8EE,0XD8EF,
-0XD8F0,0XD8F1,0XD8F2,0XD8F3,0XD8F4,0XD8F5,0XD8F6,0XD8F7,0XD8F8,0XD8F9,0XD8FA,0XD8FB,0XD8FC,0XD8FD,0XD8FE,0XD8FF,
-0XD940,0XD941,0XD942,0XD943,0XD944,0XD945,0XD946,0XD947,0XD948,0XD949,0XD94A,0XD94B,0XD94C,0XD94D,0XD94E,0XD94F,
-0XD950,0XD951,0XD952,0XD953,0XD954,0XD955,0XD956,0XD957,0XD958,0XD959,0XD95A,0XD95B,0XD95C,0XD95D,0XD95E,0XD95F,
-0XD960,0XD961,0XD962,0XD963,0XD964,0XD965,0XD966,0XD967,0XD968,0XD969,0XD96A,0XD96B,0XD96C,0XD96D,0XD96E,0XD96F,
-0XD970,0XD971,0XD972,0XD973,0XD974,0XD975,0XD976,0XD977,0XD978,0XD979,0XD97A,0XD97B,0XD97C,0XD97D,0XD97E,0XD97F,
-0XD980,0XD981,0XD982,0XD983,0XD984,0XD985,0XD986,0XD987,0XD988,0XD989,0XD98A,0XD98B,0XD98C,0XD98D,0XD98E,0XD98F,
-0XD990,0XD991,0XD992,0XD993,0XD994,0XD995,0XD996,0XD997,0XD998,0XD999,0XD99A,0XD99B,0XD99C,0XD99D,0XD99E,0XD99F,
-0XD9A0,0XD9A1,0XD9A2,0XD9A3,0XD9A4,0XD9A5,0XD9A6,0XD9A7,0XD9A8,0XD9A9,0XD9AA,0XD9AB,0XD9AC,0XD9AD,0XD9AE,0XD9AF,
-0XD9B0,0XD9B1,0XD9B2,0XD9B3,0XD9B4,0XD9B5,0XD9B6,0XD9B7,0XD9B8,0XD9B9,0XD9BA,0XD9BB,0XD9BC,0XD9BD,0XD9BE,0XD9BF,
-0XD9C0,0XD9C1,0XD9C2,0XD9C3,0XD9C4,0XD9C5,0XD9C6,0XD9C7,0XD9C8,0XD9C9,0XD9CA,0XD9CB,0XD9CC,0XD9CD,0XD9CE,0XD9CF,
-0XD9D0,0XD9D1,0XD9D2,0XD9D3,0XD9D4,0XD9D5,0XD9D6,0XD9D7,0XD9D8,0XD9D9,0XD9DA,0XD9DB,0XD9DC,0XD9DD,0XD9DE,0XD9DF,
-0XD9E0,0XD9E1,0XD9E2,0XD9E3,0XD9E4,0XD9E5,0XD9E6,0XD9E7,0XD9E8,0XD9E9,0XD9EA,0XD9EB,0XD9EC,0XD9ED,0XD9EE,0XD9EF,
-0XD9F0,0XD9F1,0XD9F2,0XD9F3,0XD9F4,0XD9F5,0XD9F6,0XD9F7,0XD9F8,0XD9F9,0XD9FA,0XD9FB,0XD9FC,0XD9FD,0XD9FE,0XD9FF,
-0XDA40,0XDA41,0XDA42,0XDA43,0XDA44,0XDA45,0XDA46,0XDA47,0XDA48,0XDA49,0XDA4A,0XDA4B,0XDA4C,0XDA4D,0XDA4E,0XDA4F,
-0XDA50,0XDA51,0XDA52,0XDA53,0XDA54,0XDA55,0XDA56,0XDA57,0XDA58,0XDA59,0XDA5A,0XDA5B,0XDA5C,0XDA5D,0XDA5E,0XDA5F,
-0XDA60,0XDA61,0XDA62,0XDA63,0XDA64,0XDA65,0XDA66,0XDA67,0XDA68,0XDA69,0XDA6A,0XDA6B,0XDA6C,0XDA6D,0XDA6E,0XDA6F,
-0XDA70,0XDA71,0XDA72,0XDA73,0XDA74,0XDA75,0XDA76,0XDA77,0XDA78,0XDA79,0XDA7A,0XDA7B,0XDA7C,0XDA7D,0XDA7E,0XDA7F,
-0XDA80,0XDA81,0XDA82,0XDA83,0XDA84,0XDA85,0XDA86,0XDA87,0XDA88,0XDA89,0XDA8A,0XDA8B,0XDA8C,0XDA8D,0XDA8E,0XDA8F,
-0XDA90,0XDA91,0XDA92,0XDA93,0XDA94,0XDA95,0XDA96,0XDA97,0XDA98,0XDA99,0XDA9A,0XDA9B,0XDA9C,0XDA9D,0XDA9E,0XDA9F,
-0XDAA0,0XDAA1,0XDAA2,0XDAA3,0XDAA4,0XDAA5,0XDAA6,0XDAA7,0XDAA8,0XDAA9,0XDAAA,0XDAAB,0XDAAC,0XDAAD,0XDAAE,0XDAAF,
-0XDAB0,0XDAB1,0XDAB2,0XDAB3,0XDAB4,0XDAB5,0XDAB6,0XDAB7,0XDAB8,0XDAB9,0XDABA,0XDABB,0XDABC,0XDABD,0XDABE,0XDABF,
-0XDAC0,0XDAC1,0XDAC2,0XDAC3,0XDAC4,0XDAC5,0XDAC6,0XDAC7,0XDAC8,0XDAC9,0XDACA,0XDACB,0XDACC,0XDACD,0XDACE,0XDACF,
-0XDAD0,0XDAD1,0XDAD2,0XDAD3,0XDAD4,0XDAD5,0XDAD6,0XDAD7,0XDAD8,0XDAD9,0XDADA,0XDADB,0XDADC,0XDADD,0XDADE,0XDADF,
-0XDAE0,0XDAE1,0XDAE2,0XDAE3,0XDAE4,0XDAE5,0XDAE6,0XDAE7,0XDAE8,0XDAE9,0XDAEA,0XDAEB,0XDAEC,0XDAED,0XDAEE,0XDAEF,
-0XDAF0,0XDAF1,0XDAF2,0XDAF3,0XDAF4,0XDAF5,0XDAF6,0XDAF7,0XDAF8,0XDAF9,0XDAFA,0XDAFB,0XDAFC,0XDAFD,0XDAFE,0XDAFF,
-0XDB40,0XDB41,0XDB42,0XDB43,0XDB44,0XDB45,0XDB46,0XDB47,0XDB48,0XDB49,0XDB4A,0XDB4B,0XDB4C,0XDB4D,0XDB4E,0XDB4F,
-0XDB50,0XDB51,0XDB52,0XDB53,0XDB54,0XDB55,0XDB56,0XDB57,0XDB58,0XDB59,0XDB5A,0XDB5B,0XDB5C,0XDB5D,0XDB5E,0XDB5F,
-0XDB60,0XDB61,0XDB62,0XDB63,0XDB64,0XDB65,0XDB66,0XDB67,0XDB68,0XDB69,0XDB6A,0XDB6B,0XDB6C,0XDB6D,0XDB6E,0XDB6F,
-0XDB70,0XDB71,0XDB72,0XDB73,0XDB74,0XDB75,0XDB76,0XDB77,0XDB78,0XDB79,0XDB7A,0XDB7B,0XDB7C,0XDB7D,0XDB7E,0XDB7F,
-0XDB80,0XDB81,0XDB82,0XDB83,0XDB84,0XDB85,0XDB86,0XDB87,0XDB88,0XDB89,0XDB8A,0XDB8B,0XDB8C,0XDB8D,0XDB8E,0XDB8F,
-0XDB90,0XDB91,0XDB92,0XDB93,0XDB94,0XDB95,0XDB96,0XDB97,0XDB98,0XDB99,0XDB9A,0XDB9B,0XDB9C,0XDB9D,0XDB9E,0XDB9F,
-0XDBA0,0XDBA1,0XDBA2,0XDBA3,0XDBA4,0XDBA5,0XDBA6,0XDBA7,0XDBA8,0XDBA9,0XDBAA,0XDBAB,0XDBAC,0XDBAD,0XDBAE,0XDBAF,
-0XDBB0,0XDBB1,0XDBB2,0XDBB3,0XDBB4,0XDBB5,0XDBB6,0XDBB7,0XDBB8,0XDBB9,0XDBBA,0XDBBB,0XDBBC,0XDBBD,0XDBBE,0XDBBF,
-0XDBC0,0XDBC1,0XDBC2,0XDBC3,0XDBC4,0XDBC5,0XDBC6,0XDBC7,0XDBC8,0XDBC9,0XDBCA,0XDBCB,0XDBCC,0XDBCD,0XDBCE,0XDBCF,
-0XDBD0,0XDBD1,0XDBD2,0XDBD3,0XDBD4,0XDBD5,0XDBD6,0XDBD7,0XDBD8,0XDBD9,0XDBDA,0XDBDB,0XDBDC,0XDBDD,0XDBDE,0XDBDF,
-0XDBE0,0XDBE1,0XDBE2,0XDBE3,0XDBE4,0XDBE5,0XDBE6,0XDBE7,0XDBE8,0XDBE9,0XDBEA,0XDBEB,0XDBEC,0XDBED,0XDBEE,0XDBEF,
-0XDBF0,0XDBF1,0XDBF2,0XDBF3,0XDBF4,0XDBF5,0XDBF6,0XDBF7,0XDBF8,0XDBF9,0XDBFA,0XDBFB,0XDBFC,0XDBFD,0XDBFE,0XDBFF,
-0XDC40,0XDC41,0XDC42,0XDC43,0XDC44,0XDC45,0XDC46,0XDC47,0XDC48,0XDC49,0XDC4A,0XDC4B,0XDC4C,0XDC4D,0XDC4E,0XDC4F,
-0XDC50,0XDC51,0XDC52,0XDC53,0XDC54,0XDC55,0XDC56,0XDC57,0XDC58,0XDC59,0XDC5A,0XDC5B,0XDC5C,0XDC5D,0XDC5E,0XDC5F,
-0XDC60,0XDC61,0XDC62,0XDC63,0XDC64,0XDC65,0XDC66,0XDC67,0XDC68,0XDC69,0XDC6A,0XDC6B,0XDC6C,0XDC6D,0XDC6E,0XDC6F,
-0XDC70,0XDC71,0XDC72,0XDC73,0XDC74,0XDC75,0XDC76,0XDC77,0XDC78,0XDC79,0XDC7A,0XDC7B,0XDC7C,0XDC7D,0XDC7E,0XDC7F,
-0XDC80,0XDC81,0XDC82,0XDC83,0XDC84,0XDC85,0XDC86,0XDC87,0XDC88,0XDC89,0XDC8A,0XDC8B,0XDC8C,0XDC8D,0XDC8E,0XDC8F,
-0XDC90,0XDC91,0XDC92,0XDC93,0XDC94,0XDC95,0XDC96,0XDC97,0XDC98,0XDC99,0XDC9A,0XDC9B,0XDC9C,0XDC9D,0XDC9E,0XDC9F,
-0XDCA0,0XDCA1,0XDCA2,0XDCA3,0XDCA4,0XDCA5,0XDCA6,0XDCA7,0XDCA8,0XDCA9,0XDCAA,0XDCAB,0XDCAC,0XDCAD,0XDCAE,0XDCAF,
-0XDCB0,0XDCB1,0XDCB2,0XDCB3,0XDCB4,0XDCB5,0XDCB6,0XDCB7,0XDCB8,0XDCB9,0XDCBA,0XDCBB,0XDCBC,0XDCBD,0XDCBE,0XDCBF,
-0XDCC0,0XDCC1,0XDCC2,0XDCC3,0XDCC4,0XDCC5,0XDCC6,0XDCC7,0XDCC8,0XDCC9,0XDCCA,0XDCCB,0XDCCC,0XDCCD,0XDCCE,0XDCCF,
-0XDCD0,0XDCD1,0XDCD2,0XDCD3,0XDCD4,0XDCD5,0XDCD6,0XDCD7,0XDCD8,0XDCD9,0XDCDA,0XDCDB,0XDCDC,0XDCDD,0XDCDE,0XDCDF,
-0XDCE0,0XDCE1,0XDCE2,0XDCE3,0XDCE4,0XDCE5,0XDCE6,0XDCE7,0XDCE8,0XDCE9,0XDCEA,0XDCEB,0XDCEC,0XDCED,0XDCEE,0XDCEF,
-0XDCF0,0XDCF1,0XDCF2,0XDCF3,0XDCF4,0XDCF5,0XDCF6,0XDCF7,0XDCF8,0XDCF9,0XDCFA,0XDCFB,0XDCFC,0XDCFD,0XDCFE,0XDCFF,
-0XDD40,0XDD41,0XDD42,0XDD43,0XDD44,0XDD45,0XDD46,0XDD47,0XDD48,0XDD49,0XDD4A,0XDD4B,0XDD4C,0XDD4D,0XDD4E,0XDD4F,
-0XDD50,0XDD51,0XDD52,0XDD53,0XDD54,0XDD55,0XDD56,0XDD57,0XDD58,0XDD59,0XDD5A,0XDD5B,0XDD5C,0XDD5D,0XDD5E,0XDD5F,
-0XDD60,0XDD61,0XDD62,0XDD63,0XDD64,0XDD65,0XDD66,0XDD67,0XDD68,0XDD69,0XDD6A,0XDD6B,0XDD6C,0XDD6D,0XDD6E,0XDD6F,
-0XDD70,0XDD71,0XDD72,0XDD73,0XDD74,0XDD75,0XDD76,0XDD77,0XDD78,0XDD79,0XDD7A,0XDD7B,0XDD7C,0XDD7D,0XDD7E,0XDD7F,
-0XDD80,0XDD81,0XDD82,0XDD83,0XDD84,0XDD85,0XDD86,0XDD87,0XDD88,0XDD89,0XDD8A,0XDD8B,0XDD8C,0XDD8D,0XDD8E,0XDD8F,
-0XDD90,0XDD91,0XDD92,0XDD93,0XDD94,0XDD95,0XDD96,0XDD97,0XDD98,0XDD99,0XDD9A,0XDD9B,0XDD9C,0XDD9D,0XDD9E,0XDD9F,
-0XDDA0,0XDDA1,0XDDA2,0XDDA3,0XDDA4,0XDDA5,0XDDA6,0XDDA7,0XDDA8,0XDDA9,0XDDAA,0XDDAB,0XDDAC,0XDDAD,0XDDAE,0XDDAF,
-0XDDB0,0XDDB1,0XDDB2,0XDDB3,0XDDB4,0XDDB5,0XDDB6,0XDDB7,0XDDB8,0XDDB9,0XDDBA,0XDDBB,0XDDBC,0XDDBD,0XDDBE,0XDDBF,
-0XDDC0,0XDDC1,0XDDC2,0XDDC3,0XDDC4,0XDDC5,0XDDC6,0XDDC7,0XDDC8,0XDDC9,0XDDCA,0XDDCB,0XDDCC,0XDDCD,0XDDCE,0XDDCF,
-0XDDD0,0XDDD1,0XDDD2,0XDDD3,0XDDD4,0XDDD5,0XDDD6,0XDDD7,0XDDD8,0XDDD9,0XDDDA,0XDDDB,0XDDDC,0XDDDD,0XDDDE,0XDDDF,
-0XDDE0,0XDDE1,0XDDE2,0XDDE3,0XDDE4,0XDDE5,0XDDE6,0XDDE7,0XDDE8,0XDDE9,0XDDEA,0XDDEB,0XDDEC,0XDDED,0XDDEE,0XDDEF,
-0XDDF0,0XDDF1,0XDDF2,0XDDF3,0XDDF4,0XDDF5,0XDDF6,0XDDF7,0XDDF8,0XDDF9,0XDDFA,0XDDFB,0XDDFC,0XDDFD,0XDDFE,0XDDFF,
-0XDE40,0XDE41,0XDE42,0XDE43,0XDE44,0XDE45,0XDE46,0XDE47,0XDE48,0XDE49,0XDE4A,0XDE4B,0XDE4C,0XDE4D,0XDE4E,0XDE4F,
-0XDE50,0XDE51,0XDE52,0XDE53,0XDE54,0XDE55,0XDE56,0XDE57,0XDE58,0XDE59,0XDE5A,0XDE5B,0XDE5C,0XDE5D,0XDE5E,0XDE5F,
-0XDE60,0XDE61,0XDE62,0XDE63,0XDE64,0XDE65,0XDE66,0XDE67,0XDE68,0XDE69,0XDE6A,0XDE6B,0XDE6C,0XDE6D,0XDE6E,0XDE6F,
-0XDE70,0XDE71,0XDE72,0XDE73,0XDE74,0XDE75,0XDE76,0XDE77,0XDE78,0XDE79,0XDE7A,0XDE7B,0XDE7C,0XDE7D,0XDE7E,0XDE7F,
-0XDE80,0XDE81,0XDE82,0XDE83,0XDE84,0XDE85,0XDE86,0XDE87,0XDE88,0XDE89,0XDE8A,0XDE8B,0XDE8C,0XDE8D,0XDE8E,0XDE8F,
-0XDE90,0XDE91,0XDE92,0XDE93,0XDE94,0XDE95,0XDE96,0XDE97,0XDE98,0XDE99,0XDE9A,0XDE9B,0XDE9C,0XDE9D,0XDE9E,0XDE9F,
-0XDEA0,0XDEA1,0XDEA2,0XDEA3,0XDEA4,0XDEA5,0XDEA6,0XDEA7,0XDEA8,0XDEA9,0XDEAA,0XDEAB,0XDEAC,0XDEAD,0XDEAE,0XDEAF,
-0XDEB0,0XDEB1,0XDEB2,0XDEB3,0XDEB4,0XDEB5,0XDEB6,0XDEB7,0XDEB8,0XDEB9,0XDEBA,0XDEBB,0XDEBC,0XDEBD,0XDEBE,0XDEBF,
-0XDEC0,0XDEC1,0XDEC2,0XDEC3,0XDEC4,0XDEC5,0XDEC6,0XDEC7,0XDEC8,0XDEC9,0XDECA,0XDECB,0XDECC,0XDECD,0XDECE,0XDECF,
-0XDED0,0XDED1,0XDED2,0XDED3,0XDED4,0XDED5,0XDED6,0XDED7,0XDED8,0XDED9,0XDEDA,0XDEDB,0XDEDC,0XDEDD,0XDEDE,0XDEDF,
-0XDEE0,0XDEE1,0XDEE2,0XDEE3,0XDEE4,0XDEE5,0XDEE6,0XDEE7,0XDEE8,0XDEE9,0XDEEA,0XDEEB,0XDEEC,0XDEED,0XDEEE,0XDEEF,
-0XDEF0,0XDEF1,0XDEF2,0XDEF3,0XDEF4,0XDEF5,0XDEF6,0XDEF7,0XDEF8,0XDEF9,0XDEFA,0XDEFB,0XDEFC,0XDEFD,0XDEFE,0XDEFF,
-0XDF40,0XDF41,0XDF42,0XDF43,0XDF44,0XDF45,0XDF46,0XDF47,0XDF48,0XDF49,0XDF4A,0XDF4B,0XDF4C,0XDF4D,0XDF4E,0XDF4F,
-0XDF50,0XDF51,0XDF52,0XDF53,0XDF54,0XDF55,0XDF56,0XDF57,0XDF58,0XDF59,0XDF5A,0XDF5B,0XDF5C,0XDF5D,0XDF5E,0XDF5F,
-0XDF60,0XDF61,0XDF62,0XDF63,0XDF64,0XDF65,0XDF66,0XDF67,0XDF68,0XDF69,0XDF6A,0XDF6B,0XDF6C,0XDF6D,0XDF6E,0XDF6F,
-0XDF70,0XDF71,0XDF72,0XDF73,0XDF74,0XDF75,0XDF76,0XDF77,0XDF78,0XDF79,0XDF7A,0XDF7B,0XDF7C,0XDF7D,0XDF7E,0XDF7F,
-0XDF80,0XDF81,0XDF82,0XDF83,0XDF84,0XDF85,0XDF86,0XDF87,0XDF88,0XDF89,0XDF8A,0XDF8B,0XDF8C,0XDF8D,0XDF8E,0XDF8F,
-0XDF90,0XDF91,0XDF92,0XDF93,0XDF94,0XDF95,0XDF96,0XDF97,0XDF98,0XDF99,0XDF9A,0XDF9B,0XDF9C,0XDF9D,0XDF9E,0XDF9F,
-0XDFA0,0XDFA1,0XDFA2,0XDFA3,0XDFA4,0XDFA5,0XDFA6,0XDFA7,0XDFA8,0XDFA9,0XDFAA,0XDFAB,0XDFAC,0XDFAD,0XDFAE,0XDFAF,
-0XDFB0,0XDFB1,0XDFB2,0XDFB3,0XDFB4,0XDFB5,0XDFB6,0XDFB7,0XDFB8,0XDFB9,0XDFBA,0XDFBB,0XDFBC,0XDFBD,0XDFBE,0XDFBF,
-0XDFC0,0XDFC1,0XDFC2,0XDFC3,0XDFC4,0XDFC5,0XDFC6,0XDFC7,0XDFC8,0XDFC9,0XDFCA,0XDFCB,0XDFCC,0XDFCD,0XDFCE,0XDFCF,
-0XDFD0,0XDFD1,0XDFD2,0XDFD3,0XDFD4,0XDFD5,0XDFD6,0XDFD7,0XDFD8,0XDFD9,0XDFDA,0XDFDB,0XDFDC,0XDFDD,0XDFDE,0XDFDF,
-0XDFE0,0XDFE1,0XDFE2,0XDFE3,0XDFE4,0XDFE5,0XDFE6,0XDFE7,0XDFE8,0XDFE9,0XDFEA,0XDFEB,0XDFEC,0XDFED,0XDFEE,0XDFEF,
-0XDFF0,0XDFF1,0XDFF2,0XDFF3,0XDFF4,0XDFF5,0XDFF6,0XDFF7,0XDFF8,0XDFF9,0XDFFA,0XDFFB,0XDFFC,0XDFFD,0XDFFE,0XDFFF,
-0XE040,0XE041,0XE042,0XE043,0XE044,0XE045,0XE046,0XE047,0XE048,0XE049,0XE04A,0XE04B,0XE04C,0XE04D,0XE04E,0XE04F,
-0XE050,0XE051,0XE052,0XE053,0XE054,0XE055,0XE056,0XE057,0XE058,0XE059,0XE05A,0XE05B,0XE05C,0XE05D,0XE05E,0XE05F,
-0XE060,0XE061,0XE062,0XE063,0XE064,0XE065,0XE066,0XE067,0XE068,0XE069,0XE06A,0XE06B,0XE06C,0XE06D,0XE06E,0XE06F,
-0XE070,0XE071,0XE072,0XE073,0XE074,0XE075,0XE076,0XE077,0XE078,0XE079,0XE07A,0XE07B,0XE07C,0XE07D,0XE07E,0XE07F,
-0XE080,0XE081,0XE082,0XE083,0XE084,0XE085,0XE086,0XE087,0XE088,0XE089,0XE08A,0XE08B,0XE08C,0XE08D,0XE08E,0XE08F,
-0XE090,0XE091,0XE092,0XE093,0XE094,0XE095,0XE096,0XE097,0XE098,0XE099,0XE09A,0XE09B,0XE09C,0XE09D,0XE09E,0XE09F,
-0XE0A0,0XE0A1,0XE0A2,0XE0A3,0XE0A4,0XE0A5,0XE0A6,0XE0A7,0XE0A8,0XE0A9,0XE0AA,0XE0AB,0XE0AC,0XE0AD,0XE0AE,0XE0AF,
-0XE0B0,0XE0B1,0XE0B2,0XE0B3,0XE0B4,0XE0B5,0XE0B6,0XE0B7,0XE0B8,0XE0B9,0XE0BA,0XE0BB,0XE0BC,0XE0BD,0XE0BE,0XE0BF,
-0XE0C0,0XE0C1,0XE0C2,0XE0C3,0XE0C4,0XE0C5,0XE0C6,0XE0C7,0XE0C8,0XE0C9,0XE0CA,0XE0CB,0XE0CC,0XE0CD,0XE0CE,0XE0CF,
-0XE0D0,0XE0D1,0XE0D2,0XE0D3,0XE0D4,0XE0D5,0XE0D6,0XE0D7,0XE0D8,0XE0D9,0XE0DA,0XE0DB,0XE0DC,0XE0DD,0XE0DE,0XE0DF,
-0XE0E0,0XE0E1,0XE0E2,0XE0E3,0XE0E4,0XE0E5,0XE0E6,0XE0E7,0XE0E8,0XE0E9,0XE0EA,0XE0EB,0XE0EC,0XE0ED,0XE0EE,0XE0EF,
-0XE0F0,0XE0F1,0XE0F2,0XE0F3,0XE0F4,0XE0F5,0XE0F6,0XE0F7,0XE0F8,0XE0F9,0XE0FA,0XE0FB,0XE0FC,0XE0FD,0XE0FE,0XE0FF,
-0XE140,0XE141,0XE142,0XE143,0XE144,0XE145,0XE146,0XE147,0XE148,0XE149,0XE14A,0XE14B,0XE14C,0XE14D,0XE14E,0XE14F,
-0XE150,0XE151,0XE152,0XE153,0XE154,0XE155,0XE156,0XE157,0XE158,0XE159,0XE15A,0XE15B,0XE15C,0XE15D,0XE15E,0XE15F,
-0XE160,0XE161,0XE162,0XE163,0XE164,0XE165,0XE166,0XE167,0XE168,0XE169,0XE16A,0XE16B,0XE16C,0XE16D,0XE16E,0XE16F,
-0XE170,0XE171,0XE172,0XE173,0XE174,0XE175,0XE176,0XE177,0XE178,0XE179,0XE17A,0XE17B,0XE17C,0XE17D,0XE17E,0XE17F,
-0XE180,0XE181,0XE182,0XE183,0XE184,0XE185,0XE186,0XE187,0XE188,0XE189,0XE18A,0XE18B,0XE18C,0XE18D,0XE18E,0XE18F,
-0XE190,0XE191,0XE192,0XE193,0XE194,0XE195,0XE196,0XE197,0XE198,0XE199,0XE19A,0XE19B,0XE19C,0XE19D,0XE19E,0XE19F,
-0XE1A0,0XE1A1,0XE1A2,0XE1A3,0XE1A4,0XE1A5,0XE1A6,0XE1A7,0XE1A8,0XE1A9,0XE1AA,0XE1AB,0XE1AC,0XE1AD,0XE1AE,0XE1AF,
-0XE1B0,0XE1B1,0XE1B2,0XE1B3,0XE1B4,0XE1B5,0XE1B6,0XE1B7,0XE1B8,0XE1B9,0XE1BA,0XE1BB,0XE1BC,0XE1BD,0XE1BE,0XE1BF,
-0XE1C0,0XE1C1,0XE1C2,0XE1C3,0XE1C4,0XE1C5,0XE1C6,0XE1C7,0XE1C8,0XE1C9,0XE1CA,0XE1CB,0XE1CC,0XE1CD,0XE1CE,0XE1CF,
-0XE1D0,0XE1D1,0XE1D2,0XE1D3,0XE1D4,0XE1D5,0XE1D6,0XE1D7,0XE1D8,0XE1D9,0XE1DA,0XE1DB,0XE1DC,0XE1DD,0XE1DE,0XE1DF,
-0XE1E0,0XE1E1,0XE1E2,0XE1E3,0XE1E4,0XE1E5,0XE1E6,0XE1E7,0XE1E8,0XE1E9,0XE1EA,0XE1EB,0XE1EC,0XE1ED,0XE1EE,0XE1EF,
-0XE1F0,0XE1F1,0XE1F2,0XE1F3,0XE1F4,0XE1F5,0XE1F6,0XE1F7,0XE1F8,0XE1F9,0XE1FA,0XE1FB,0XE1FC,0XE1FD,0XE1FE,0XE1FF,
-0XE240,0XE241,0XE242,0XE243,0XE244,0XE245,0XE246,0XE247,0XE248,0XE249,0XE24A,0XE24B,0XE24C,0XE24D,0XE24E,0XE24F,
-0XE250,0XE251,0XE252,0XE253,0XE254,0XE255,0XE256,0XE257,0XE258,0XE259,0XE25A,0XE25B,0XE25C,0XE25D,0XE25E,0XE25F,
-0XE260,0XE261,0XE262,0XE263,0XE264,0XE265,0XE266,0XE267,0XE268,0XE269,0XE26A,0XE26B,0XE26C,0XE26D,0XE26E,0XE26F,
-0XE270,0XE271,0XE272,0XE273,0XE274,0XE275,0XE276,0XE277,0XE278,0XE279,0XE27A,0XE27B,0XE27C,0XE27D,0XE27E,0XE27F,
-0XE280,0XE281,0XE282,0XE283,0XE284,0XE285,0XE286,0XE287,0XE288,0XE289,0XE28A,0XE28B,0XE28C,0XE28D,0XE28E,0XE28F,
-0XE290,0XE291,0XE292,0XE293,0XE294,0XE295,0XE296,0XE297,0XE298,0XE299,0XE29A,0XE29B,0XE29C,0XE29D,0XE29E,0XE29F,
-0XE2A0,0XE2A1,0XE2A2,0XE2A3,0XE2A4,0XE2A5,0XE2A6,0XE2A7,0XE2A8,0XE2A9,0XE2AA,0XE2AB,0XE2AC,0XE2AD,0XE2AE,0XE2AF,
-0XE2B0,0XE2B1,0XE2B2,0XE2B3,0XE2B4,0XE2B5,0XE2B6,0XE2B7,0XE2B8,0XE2B9,0XE2BA,0XE2BB,0XE2BC,0XE2BD,0XE2BE,0XE2BF,
-0XE2C0,0XE2C1,0XE2C2,0XE2C3,0XE2C4,0XE2C5,0XE2C6,0XE2C7,0XE2C8,0XE2C9,0XE2CA,0XE2CB,0XE2CC,0XE2CD,0XE2CE,0XE2CF,
-0XE2D0,0XE2D1,0XE2D2,0XE2D3,0XE2D4,0XE2D5,0XE2D6,0XE2D7,0XE2D8,0XE2D9,0XE2DA,0XE2DB,0XE2DC,0XE2DD,0XE2DE,0XE2DF,
-0XE2E0,0XE2E1,0XE2E2,0XE2E3,0XE2E4,0XE2E5,0XE2E6,0XE2E7,0XE2E8,0XE2E9,0XE2EA,0XE2EB,0XE2EC,0XE2ED,0XE2EE,0XE2EF,
-0XE2F0,0XE2F1,0XE2F2,0XE2F3,0XE2F4,0XE2F5,0XE2F6,0XE2F7,0XE2F8,0XE2F9,0XE2FA,0XE2FB,0XE2FC,0XE2FD,0XE2FE,0XE2FF,
-0XE340,0XE341,0XE342,0XE343,0XE344,0XE345,0XE346,0XE347,0XE348,0XE349,0XE34A,0XE34B,0XE34C,0XE34D,0XE34E,0XE34F,
-0XE350,0XE351,0XE352,0XE353,0XE354,0XE355,0XE356,0XE357,0XE358,0XE359,0XE35A,0XE35B,0XE35C,0XE35D,0XE35E,0XE35F,
-0XE360,0XE361,0XE362,0XE363,0XE364,0XE365,0XE366,0XE367,0XE368,0XE369,0XE36A,0XE36B,0XE36C,0XE36D,0XE36E,0XE36F,
-0XE370,0XE371,0XE372,0XE373,0XE374,0XE375,0XE376,0XE377,0XE378,0XE379,0XE37A,0XE37B,0XE37C,0XE37D,0XE37E,0XE37F,
-0XE380,0XE381,0XE382,0XE383,0XE384,0XE385,0XE386,0XE387,0XE388,0XE389,0XE38A,0XE38B,0XE38C,0XE38D,0XE38E,0XE38F,
-0XE390,0XE391,0XE392,0XE393,0XE394,0XE395,0XE396,0XE397,0XE398,0XE399,0XE39A,0XE39B,0XE39C,0XE39D,0XE39E,0XE39F,
-0XE3A0,0XE3A1,0XE3A2,0XE3A3,0XE3A4,0XE3A5,0XE3A6,0XE3A7,0XE3A8,0XE3A9,0XE3AA,0XE3AB,0XE3AC,0XE3AD,0XE3AE,0XE3AF,
-0XE3B0,0XE3B1,0XE3B2,0XE3B3,0XE3B4,0XE3B5,0XE3B6,0XE3B7,0XE3B8,0XE3B9,0XE3BA,0XE3BB,0XE3BC,0XE3BD,0XE3BE,0XE3BF,
-0XE3C0,0XE3C1,0XE3C2,0XE3C3,0XE3C4,0XE3C5,0XE3C6,0XE3C7,0XE3C8,0XE3C9,0XE3CA,0XE3CB,0XE3CC,0XE3CD,0XE3CE,0XE3CF,
-0XE3D0,0XE3D1,0XE3D2,0XE3D3,0XE3D4,0XE3D5,0XE3D6,0XE3D7,0XE3D8,0XE3D9,0XE3DA,0XE3DB,0XE3DC,0XE3DD,0XE3DE,0XE3DF,
-0XE3E0,0XE3E1,0XE3E2,0XE3E3,0XE3E4,0XE3E5,0XE3E6,0XE3E7,0XE3E8,0XE3E9,0XE3EA,0XE3EB,0XE3EC,0XE3ED,0XE3EE,0XE3EF,
-0XE3F0,0XE3F1,0XE3F2,0XE3F3,0XE3F4,0XE3F5,0XE3F6,0XE3F7,0XE3F8,0XE3F9,0XE3FA,0XE3FB,0XE3FC,0XE3FD,0XE3FE,0XE3FF,
-0XE440,0XE441,0XE442,0XE443,0XE444,0XE445,0XE446,0XE447,0XE448,0XE449,0XE44A,0XE44B,0XE44C,0XE44D,0XE44E,0XE44F,
-0XE450,0XE451,0XE452,0XE453,0XE454,0XE455,0XE456,0XE457,0XE458,0XE459,0XE45A,0XE45B,0XE45C,0XE45D,0XE45E,0XE45F,
-0XE460,0XE461,0XE462,0XE463,0XE464,0XE465,0XE466,0XE467,0XE468,0XE469,0XE46A,0XE46B,0XE46C,0XE46D,0XE46E,0XE46F,
-0XE470,0XE471,0XE472,0XE473,0XE474,0XE475,0XE476,0XE477,0XE478,0XE479,0XE47A,0XE47B,0XE47C,0XE47D,0XE47E,0XE47F,
-0XE480,0XE481,0XE482,0XE483,0XE484,0XE485,0XE486,0XE487,0XE488,0XE489,0XE48A,0XE48B,0XE48C,0XE48D,0XE48E,0XE48F,
-0XE490,0XE491,0XE492,0XE493,0XE494,0XE495,0XE496,0XE497,0XE498,0XE499,0XE49A,0XE49B,0XE49C,0XE49D,0XE49E,0XE49F,
-0XE4A0,0XE4A1,0XE4A2,0XE4A3,0XE4A4,0XE4A5,0XE4A6,0XE4A7,0XE4A8,0XE4A9,0XE4AA,0XE4AB,0XE4AC,0XE4AD,0XE4AE,0XE4AF,
-0XE4B0,0XE4B1,0XE4B2,0XE4B3,0XE4B4,0XE4B5,0XE4B6,0XE4B7,0XE4B8,0XE4B9,0XE4BA,0XE4BB,0XE4BC,0XE4BD,0XE4BE,0XE4BF,
-0XE4C0,0XE4C1,0XE4C2,0XE4C3,0XE4C4,0XE4C5,0XE4C6,0XE4C7,0XE4C8,0XE4C9,0XE4CA,0XE4CB,0XE4CC,0XE4CD,0XE4CE,0XE4CF,
-0XE4D0,0XE4D1,0XE4D2,0XE4D3,0XE4D4,0XE4D5,0XE4D6,0XE4D7,0XE4D8,0XE4D9,0XE4DA,0XE4DB,0XE4DC,0XE4DD,0XE4DE,0XE4DF,
-0XE4E0,0XE4E1,0XE4E2,0XE4E3,0XE4E4,0XE4E5,0XE4E6,0XE4E7,0XE4E8,0XE4E9,0XE4EA,0XE4EB,0XE4EC,0XE4ED,0XE4EE,0XE4EF,
-0XE4F0,0XE4F1,0XE4F2,0XE4F3,0XE4F4,0XE4F5,0XE4F6,0XE4F7,0XE4F8,0XE4F9,0XE4FA,0XE4FB,0XE4FC,0XE4FD,0XE4FE,0XE4FF,
-0XE540,0XE541,0XE542,0XE543,0XE544,0XE545,0XE546,0XE547,0XE548,0XE549,0XE54A,0XE54B,0XE54C,0XE54D,0XE54E,0XE54F,
-0XE550,0XE551,0XE552,0XE553,0XE554,0XE555,0XE556,0XE557,0XE558,0XE559,0XE55A,0XE55B,0XE55C,0XE55D,0XE55E,0XE55F,
-0XE560,0XE561,0XE562,0XE563,0XE564,0XE565,0XE566,0XE567,0XE568,0XE569,0XE56A,0XE56B,0XE56C,0XE56D,0XE56E,0XE56F,
-0XE570,0XE571,0XE572,0XE573,0XE574,0XE575,0XE576,0XE577,0XE578,0XE579,0XE57A,0XE57B,0XE57C,0XE57D,0XE57E,0XE57F,
-0XE580,0XE581,0XE582,0XE583,0XE584,0XE585,0XE586,0XE587,0XE588,0XE589,0XE58A,0XE58B,0XE58C,0XE58D,0XE58E,0XE58F,
-0XE590,0XE591,0XE592,0XE593,0XE594,0XE595,0XE596,0XE597,0XE598,0XE599,0XE59A,0XE59B,0XE59C,0XE59D,0XE59E,0XE59F,
-0XE5A0,0XE5A1,0XE5A2,0XE5A3,0XE5A4,0XE5A5,0XE5A6,0XE5A7,0XE5A8,0XE5A9,0XE5AA,0XE5AB,0XE5AC,0XE5AD,0XE5AE,0XE5AF,
-0XE5B0,0XE5B1,0XE5B2,0XE5B3,0XE5B4,0XE5B5,0XE5B6,0XE5B7,0XE5B8,0XE5B9,0XE5BA,0XE5BB,0XE5BC,0XE5BD,0XE5BE,0XE5BF,
-0XE5C0,0XE5C1,0XE5C2,0XE5C3,0XE5C4,0XE5C5,0XE5C6,0XE5C7,0XE5C8,0XE5C9,0XE5CA,0XE5CB,0XE5CC,0XE5CD,0XE5CE,0XE5CF,
-0XE5D0,0XE5D1,0XE5D2,0XE5D3,0XE5D4,0XE5D5,0XE5D6,0XE5D7,0XE5D8,0XE5D9,0XE5DA,0XE5DB,0XE5DC,0XE5DD,0XE5DE,0XE5DF,
-0XE5E0,0XE5E1,0XE5E2,0XE5E3,0XE5E4,0XE5E5,0XE5E6,0XE5E7,0XE5E8,0XE5E9,0XE5EA,0XE5EB,0XE5EC,0XE5ED,0XE5EE,0XE5EF,
-0XE5F0,0XE5F1,0XE5F2,0XE5F3,0XE5F4,0XE5F5,0XE5F6,0XE5F7,0XE5F8,0XE5F9,0XE5FA,0XE5FB,0XE5FC,0XE5FD,0XE5FE,0XE5FF,
-0XE640,0XE641,0XE642,0XE643,0XE644,0XE645,0XE646,0XE647,0XE648,0XE649,0XE64A,0XE64B,0XE64C,0XE64D,0XE64E,0XE64F,
-0XE650,0XE651,0XE652,0XE653,0XE654,0XE655,0XE656,0XE657,0XE658,0XE659,0XE65A,0XE65B,0XE65C,0XE65D,0XE65E,0XE65F,
-0XE660,0XE661,0XE662,0XE663,0XE664,0XE665,0XE666,0XE667,0XE668,0XE669,0XE66A,0XE66B,0XE66C,0XE66D,0XE66E,0XE66F,
-0XE670,0XE671,0XE672,0XE673,0XE674,0XE675,0XE676,0XE677,0XE678,0XE679,0XE67A,0XE67B,0XE67C,0XE67D,0XE67E,0XE67F,
-0XE680,0XE681,0XE682,0XE683,0XE684,0XE685,0XE686,0XE687,0XE688,0XE689,0XE68A,0XE68B,0XE68C,0XE68D,0XE68E,0XE68F,
-0XE690,0XE691,0XE692,0XE693,0XE694,0XE695,0XE696,0XE697,0XE698,0XE699,0XE69A,0XE69B,0XE69C,0XE69D,0XE69E,0XE69F,
-0XE6A0,0XE6A1,0XE6A2,0XE6A3,0XE6A4,0XE6A5,0XE6A6,0XE6A7,0XE6A8,0XE6A9,0XE6AA,0XE6AB,0XE6AC,0XE6AD,0XE6AE,0XE6AF,
-0XE6B0,0XE6B1,0XE6B2,0XE6B3,0XE6B4,0XE6B5,0XE6B6,0XE6B7,0XE6B8,0XE6B9,0XE6BA,0XE6BB,0XE6BC,0XE6BD,0XE6BE,0XE6BF,
-0XE6C0,0XE6C1,0XE6C2,0XE6C3,0XE6C4,0XE6C5,0XE6C6,0XE6C7,0XE6C8,0XE6C9,0XE6CA,0XE6CB,0XE6CC,0XE6CD,0XE6CE,0XE6CF,
-0XE6D0,0XE6D1,0XE6D2,0XE6D3,0XE6D4,0XE6D5,0XE6D6,0XE6D7,0XE6D8,0XE6D9,0XE6DA,0XE6DB,0XE6DC,0XE6DD,0XE6DE,0XE6DF,
-0XE6E0,0XE6E1,0XE6E2,0XE6E3,0XE6E4,0XE6E5,0XE6E6,0XE6E7,0XE6E8,0XE6E9,0XE6EA,0XE6EB,0XE6EC,0XE6ED,0XE6EE,0XE6EF,
-0XE6F0,0XE6F1,0XE6F2,0XE6F3,0XE6F4,0XE6F5,0XE6F6,0XE6F7,0XE6F8,0XE6F9,0XE6FA,0XE6FB,0XE6FC,0XE6FD,0XE6FE,0XE6FF,
-0XE740,0XE741,0XE742,0XE743,0XE744,0XE745,0XE746,0XE747,0XE748,0XE749,0XE74A,0XE74B,0XE74C,0XE74D,0XE74E,0XE74F,
-0XE750,0XE751,0XE752,0XE753,0XE754,0XE755,0XE756,0XE757,0XE758,0XE759,0XE75A,0XE75B,0XE75C,0XE75D,0XE75E,0XE75F,
-0XE760,0XE761,0XE762,0XE763,0XE764,0XE765,0XE766,0XE767,0XE768,0XE769,0XE76A,0XE76B,0XE76C,0XE76D,0XE76E,0XE76F,
-0XE770,0XE771,0XE772,0XE773,0XE774,0XE775,0XE776,0XE777,0XE778,0XE779,0XE77A,0XE77B,0XE77C,0XE77D,0XE77E,0XE77F,
-0XE780,0XE781,0XE782,0XE783,0XE784,0XE785,0XE786,0XE787,0XE788,0XE789,0XE78A,0XE78B,0XE78C,0XE78D,0XE78E,0XE78F,
-0XE790,0XE791,0XE792,0XE793,0XE794,0XE795,0XE796,0XE797,0XE798,0XE799,0XE79A,0XE79B,0XE79C,0XE79D,0XE79E,0XE79F,
-0XE7A0,0XE7A1,0XE7A2,0XE7A3,0XE7A4,0XE7A5,0XE7A6,0XE7A7,0XE7A8,0XE7A9,0XE7AA,0XE7AB,0XE7AC,0XE7AD,0XE7AE,0XE7AF,
-0XE7B0,0XE7B1,0XE7B2,0XE7B3,0XE7B4,0XE7B5,0XE7B6,0XE7B7,0XE7B8,0XE7B9,0XE7BA,0XE7BB,0XE7BC,0XE7BD,0XE7BE,0XE7BF,
-0XE7C0,0XE7C1,0XE7C2,0XE7C3,0XE7C4,0XE7C5,0XE7C6,0XE7C7,0XE7C8,0XE7C9,0XE7CA,0XE7CB,0XE7CC,0XE7CD,0XE7CE,0XE7CF,
-0XE7D0,0XE7D1,0XE7D2,0XE7D3,0XE7D4,0XE7D5,0XE7D6,0XE7D7,0XE7D8,0XE7D9,0XE7DA,0XE7DB,0XE7DC,0XE7DD,0XE7DE,0XE7DF,
-0XE7E0,0XE7E1,0XE7E2,0XE7E3,0XE7E4,0XE7E5,0XE7E6,0XE7E7,0XE7E8,0XE7E9,0XE7EA,0XE7EB,0XE7EC,0XE7ED,0XE7EE,0XE7EF,
-0XE7F0,0XE7F1,0XE7F2,0XE7F3,0XE7F4,0XE7F5,0XE7F6,0XE7F7,0XE7F8,0XE7F9,0XE7FA,0XE7FB,0XE7FC,0XE7FD,0XE7FE,0XE7FF,
-0XE840,0XE841,0XE842,0XE843,0XE844,0XE845,0XE846,0XE847,0XE848,0XE849,0XE84A,0XE84B,0XE84C,0XE84D,0XE84E,0XE84F,
-0XE850,0XE851,0XE852,0XE853,0XE854,0XE855,0XE856,0XE857,0XE858,0XE859,0XE85A,0XE85B,0XE85C,0XE85D,0XE85E,0XE85F,
-0XE860,0XE861,0XE862,0XE863,0XE864,0XE865,0XE866,0XE867,0XE868,0XE869,0XE86A,0XE86B,0XE86C,0XE86D,0XE86E,0XE86F,
-0XE870,0XE871,0XE872,0XE873,0XE874,0XE875,0XE876,0XE877,0XE878,0XE879,0XE87A,0XE87B,0XE87C,0XE87D,0XE87E,0XE87F,
-0XE880,0XE881,0XE882,0XE883,0XE884,0XE885,0XE886,0XE887,0XE888,0XE889,0XE88A,0XE88B,0XE88C,0XE88D,0XE88E,0XE88F,
-0XE890,0XE891,0XE892,0XE893,0XE894,0XE895,0XE896,0XE897,0XE898,0XE899,0XE89A,0XE89B,0XE89C,0XE89D,0XE89E,0XE89F,
-0XE8A0,0XE8A1,0XE8A2,0XE8A3,0XE8A4,0XE8A5,0XE8A6,0XE8A7,0XE8A8,0XE8A9,0XE8AA,0XE8AB,0XE8AC,0XE8AD,0XE8AE,0XE8AF,
-0XE8B0,0XE8B1,0XE8B2,0XE8B3,0XE8B4,0XE8B5,0XE8B6,0XE8B7,0XE8B8,0XE8B9,0XE8BA,0XE8BB,0XE8BC,0XE8BD,0XE8BE,0XE8BF,
-0XE8C0,0XE8C1,0XE8C2,0XE8C3,0XE8C4,0XE8C5,0XE8C6,0XE8C7,0XE8C8,0XE8C9,0XE8CA,0XE8CB,0XE8CC,0XE8CD,0XE8CE,0XE8CF,
-0XE8D0,0XE8D1,0XE8D2,0XE8D3,0XE8D4,0XE8D5,0XE8D6,0XE8D7,0XE8D8,0XE8D9,0XE8DA,0XE8DB,0XE8DC,0XE8DD,0XE8DE,0XE8DF,
-0XE8E0,0XE8E1,0XE8E2,0XE8E3,0XE8E4,0XE8E5,0XE8E6,0XE8E7,0XE8E8,0XE8E9,0XE8EA,0XE8EB,0XE8EC,0XE8ED,0XE8EE,0XE8EF,
-0XE8F0,0XE8F1,0XE8F2,0XE8F3,0XE8F4,0XE8F5,0XE8F6,0XE8F7,0XE8F8,0XE8F9,0XE8FA,0XE8FB,0XE8FC,0XE8FD,0XE8FE,0XE8FF,
-0XE940,0XE941,0XE942,0XE943,0XE944,0XE945,0XE946,0XE947,0XE948,0XE949,0XE94A,0XE94B,0XE94C,0XE94D,0XE94E,0XE94F,
-0XE950,0XE951,0XE952,0XE953,0XE954,0XE955,0XE956,0XE957,0XE958,0XE959,0XE95A,0XE95B,0XE95C,0XE95D,0XE95E,0XE95F,
-0XE960,0XE961,0XE962,0XE963,0XE964,0XE965,0XE966,0XE967,0XE968,0XE969,0XE96A,0XE96B,0XE96C,0XE96D,0XE96E,0XE96F,
-0XE970,0XE971,0XE972,0XE973,0XE974,0XE975,0XE976,0XE977,0XE978,0XE979,0XE97A,0XE97B,0XE97C,0XE97D,0XE97E,0XE97F,
-0XE980,0XE981,0XE982,0XE983,0XE984,0XE985,0XE986,0XE987,0XE988,0XE989,0XE98A,0XE98B,0XE98C,0XE98D,0XE98E,0XE98F,
-0XE990,0XE991,0XE992,0XE993,0XE994,0XE995,0XE996,0XE997,0XE998,0XE999,0XE99A,0XE99B,0XE99C,0XE99D,0XE99E,0XE99F,
-0XE9A0,0XE9A1,0XE9A2,0XE9A3,0XE9A4,0XE9A5,0XE9A6,0XE9A7,0XE9A8,0XE9A9,0XE9AA,0XE9AB,0XE9AC,0XE9AD,0XE9AE,0XE9AF,
-0XE9B0,0XE9B1,0XE9B2,0XE9B3,0XE9B4,0XE9B5,0XE9B6,0XE9B7,0XE9B8,0XE9B9,0XE9BA,0XE9BB,0XE9BC,0XE9BD,0XE9BE,0XE9BF,
-0XE9C0,0XE9C1,0XE9C2,0XE9C3,0XE9C4,0XE9C5,0XE9C6,0XE9C7,0XE9C8,0XE9C9,0XE9CA,0XE9CB,0XE9CC,0XE9CD,0XE9CE,0XE9CF,
-0XE9D0,0XE9D1,0XE9D2,0XE9D3,0XE9D4,0XE9D5,0XE9D6,0XE9D7,0XE9D8,0XE9D9,0XE9DA,0XE9DB,0XE9DC,0XE9DD,0XE9DE,0XE9DF,
-0XE9E0,0XE9E1,0XE9E2,0XE9E3,0XE9E4,0XE9E5,0XE9E6,0XE9E7,0XE9E8,0XE9E9,0XE9EA,0XE9EB,0XE9EC,0XE9ED,0XE9EE,0XE9EF,
-0XE9F0,0XE9F1,0XE9F2,0XE9F3,0XE9F4,0XE9F5,0XE9F6,0XE9F7,0XE9F8,0XE9F9,0XE9FA,0XE9FB,0XE9FC,0XE9FD,0XE9FE,0XE9FF,
-0XEA40,0XEA41,0XEA42,0XEA43,0XEA44,0XEA45,0XEA46,0XEA47,0XEA48,0XEA49,0XEA4A,0XEA4B,0XEA4C,0XEA4D,0XEA4E,0XEA4F,
-0XEA50,0XEA51,0XEA52,0XEA53,0XEA54,0XEA55,0XEA56,0XEA57,0XEA58,0XEA59,0XEA5A,0XEA5B,0XEA5C,0XEA5D,0XEA5E,0XEA5F,
-0XEA60,0XEA61,0XEA62,0XEA63,0XEA64,0XEA65,0XEA66,0XEA67,0XEA68,0XEA69,0XEA6A,0XEA6B,0XEA6C,0XEA6D,0XEA6E,0XEA6F,
-0XEA70,0XEA71,0XEA72,0XEA73,0XEA74,0XEA75,0XEA76,0XEA77,0XEA78,0XEA79,0XEA7A,0XEA7B,0XEA7C,0XEA7D,0XEA7E,0XEA7F,
-0XEA80,0XEA81,0XEA82,0XEA83,0XEA84,0XEA85,0XEA86,0XEA87,0XEA88,0XEA89,0XEA8A,0XEA8B,0XEA8C,0XEA8D,0XEA8E,0XEA8F,
-0XEA90,0XEA91,0XEA92,0XEA93,0XEA94,0XEA95,0XEA96,0XEA97,0XEA98,0XEA99,0XEA9A,0XEA9B,0XEA9C,0XEA9D,0XEA9E,0XEA9F,
-0XEAA0,0XEAA1,0XEAA2,0XEAA3,0XEAA4,0XEAA5,0XEAA6,0XEAA7,0XEAA8,0XEAA9,0XEAAA,0XEAAB,0XEAAC,0XEAAD,0XEAAE,0XEAAF,
-0XEAB0,0XEAB1,0XEAB2,0XEAB3,0XEAB4,0XEAB5,0XEAB6,0XEAB7,0XEAB8,0XEAB9,0XEABA,0XEABB,0XEABC,0XEABD,0XEABE,0XEABF,
-0XEAC0,0XEAC1,0XEAC2,0XEAC3,0XEAC4,0XEAC5,0XEAC6,0XEAC7,0XEAC8,0XEAC9,0XEACA,0XEACB,0XEACC,0XEACD,0XEACE,0XEACF,
-0XEAD0,0XEAD1,0XEAD2,0XEAD3,0XEAD4,0XEAD5,0XEAD6,0XEAD7,0XEAD8,0XEAD9,0XEADA,0XEADB,0XEADC,0XEADD,0XEADE,0XEADF,
-0XEAE0,0XEAE1,0XEAE2,0XEAE3,0XEAE4,0XEAE5,0XEAE6,0XEAE7,0XEAE8,0XEAE9,0XEAEA,0XEAEB,0XEAEC,0XEAED,0XEAEE,0XEAEF,
-0XEAF0,0XEAF1,0XEAF2,0XEAF3,0XEAF4,0XEAF5,0XEAF6,0XEAF7,0XEAF8,0XEAF9,0XEAFA,0XEAFB,0XEAFC,0XEAFD,0XEAFE,0XEAFF,
-0XEB40,0XEB41,0XEB42,0XEB43,0XEB44,0XEB45,0XEB46,0XEB47,0XEB48,0XEB49,0XEB4A,0XEB4B,0XEB4C,0XEB4D,0XEB4E,0XEB4F,
-0XEB50,0XEB51,0XEB52,0XEB53,0XEB54,0XEB55,0XEB56,0XEB57,0XEB58,0XEB59,0XEB5A,0XEB5B,0XEB5C,0XEB5D,0XEB5E,0XEB5F,
-0XEB60,0XEB61,0XEB62,0XEB63,0XEB64,0XEB65,0XEB66,0XEB67,0XEB68,0XEB69,0XEB6A,0XEB6B,0XEB6C,0XEB6D,0XEB6E,0XEB6F,
-0XEB70,0XEB71,0XEB72,0XEB73,0XEB74,0XEB75,0XEB76,0XEB77,0XEB78,0XEB79,0XEB7A,0XEB7B,0XEB7C,0XEB7D,0XEB7E,0XEB7F,
-0XEB80,0XEB81,0XEB82,0XEB83,0XEB84,0XEB85,0XEB86,0XEB87,0XEB88,0XEB89,0XEB8A,0XEB8B,0XEB8C,0XEB8D,0XEB8E,0XEB8F,
-0XEB90,0XEB91,0XEB92,0XEB93,0XEB94,0XEB95,0XEB96,0XEB97,0XEB98,0XEB99,0XEB9A,0XEB9B,0XEB9C,0XEB9D,0XEB9E,0XEB9F,
-0XEBA0,0XEBA1,0XEBA2,0XEBA3,0XEBA4,0XEBA5,0XEBA6,0XEBA7,0XEBA8,0XEBA9,0XEBAA,0XEBAB,0XEBAC,0XEBAD,0XEBAE,0XEBAF,
-0XEBB0,0XEBB1,0XEBB2,0XEBB3,0XEBB4,0XEBB5,0XEBB6,0XEBB7,0XEBB8,0XEBB9,0XEBBA,0XEBBB,0XEBBC,0XEBBD,0XEBBE,0XEBBF,
-0XEBC0,0XEBC1,0XEBC2,0XEBC3,0XEBC4,0XEBC5,0XEBC6,0XEBC7,0XEBC8,0XEBC9,0XEBCA,0XEBCB,0XEBCC,0XEBCD,0XEBCE,0XEBCF,
-0XEBD0,0XEBD1,0XEBD2,0XEBD3,0XEBD4,0XEBD5,0XEBD6,0XEBD7,0XEBD8,0XEBD9,0XEBDA,0XEBDB,0XEBDC,0XEBDD,0XEBDE,0XEBDF,
-0XEBE0,0XEBE1,0XEBE2,0XEBE3,0XEBE4,0XEBE5,0XEBE6,0XEBE7,0XEBE8,0XEBE9,0XEBEA,0XEBEB,0XEBEC,0XEBED,0XEBEE,0XEBEF,
-0XEBF0,0XEBF1,0XEBF2,0XEBF3,0XEBF4,0XEBF5,0XEBF6,0XEBF7,0XEBF8,0XEBF9,0XEBFA,0XEBFB,0XEBFC,0XEBFD,0XEBFE,0XEBFF,
-0XEC40,0XEC41,0XEC42,0XEC43,0XEC44,0XEC45,0XEC46,0XEC47,0XEC48,0XEC49,0XEC4A,0XEC4B,0XEC4C,0XEC4D,0XEC4E,0XEC4F,
-0XEC50,0XEC51,0XEC52,0XEC53,0XEC54,0XEC55,0XEC56,0XEC57,0XEC58,0XEC59,0XEC5A,0XEC5B,0XEC5C,0XEC5D,0XEC5E,0XEC5F,
-0XEC60,0XEC61,0XEC62,0XEC63,0XEC64,0XEC65,0XEC66,0XEC67,0XEC68,0XEC69,0XEC6A,0XEC6B,0XEC6C,0XEC6D,0XEC6E,0XEC6F,
-0XEC70,0XEC71,0XEC72,0XEC73,0XEC74,0XEC75,0XEC76,0XEC77,0XEC78,0XEC79,0XEC7A,0XEC7B,0XEC7C,0XEC7D,0XEC7E,0XEC7F,
-0XEC80,0XEC81,0XEC82,0XEC83,0XEC84,0XEC85,0XEC86,0XEC87,0XEC88,0XEC89,0XEC8A,0XEC8B,0XEC8C,0XEC8D,0XEC8E,0XEC8F,
-0XEC90,0XEC91,0XEC92,0XEC93,0XEC94,0XEC95,0XEC96,0XEC97,0XEC98,0XEC99,0XEC9A,0XEC9B,0XEC9C,0XEC9D,0XEC9E,0XEC9F,
-0XECA0,0XECA1,0XECA2,0XECA3,0XECA4,0XECA5,0XECA6,0XECA7,0XECA8,0XECA9,0XECAA,0XECAB,0XECAC,0XECAD,0XECAE,0XECAF,
-0XECB0,0XECB1,0XECB2,0XECB3,0XECB4,0XECB5,0XECB6,0XECB7,0XECB8,0XECB9,0XECBA,0XECBB,0XECBC,0XECBD,0XECBE,0XECBF,
-0XECC0,0XECC1,0XECC2,0XECC3,0XECC4,0XECC5,0XECC6,0XECC7,0XECC8,0XECC9,0XECCA,0XECCB,0XECCC,0XECCD,0XECCE,0XECCF,
-0XECD0,0XECD1,0XECD2,0XECD3,0XECD4,0XECD5,0XECD6,0XECD7,0XECD8,0XECD9,0XECDA,0XECDB,0XECDC,0XECDD,0XECDE,0XECDF,
-0XECE0,0XECE1,0XECE2,0XECE3,0XECE4,0XECE5,0XECE6,0XECE7,0XECE8,0XECE9,0XECEA,0XECEB,0XECEC,0XECED,0XECEE,0XECEF,
-0XECF0,0XECF1,0XECF2,0XECF3,0XECF4,0XECF5,0XECF6,0XECF7,0XECF8,0XECF9,0XECFA,0XECFB,0XECFC,0XECFD,0XECFE,0XECFF,
-0XED40,0XED41,0XED42,0XED43,0XED44,0XED45,0XED46,0XED47,0XED48,0XED49,0XED4A,0XED4B,0XED4C,0XED4D,0XED4E,0XED4F,
-0XED50,0XED51,0XED52,0XED53,0XED54,0XED55,0XED56,0XED57,0XED58,0XED59,0XED5A,0XED5B,0XED5C,0XED5D,0XED5E,0XED5F,
-0XED60,0XED61,0XED62,0XED63,0XED64,0XED65,0XED66,0XED67,0XED68,0XED69,0XED6A,0XED6B,0XED6C,0XED6D,0XED6E,0XED6F,
-0XED70,0XED71,0XED72,0XED73,0XED74,0XED75,0XED76,0XED77,0XED78,0XED79,0XED7A,0XED7B,0XED7C,0XED7D,0XED7E,0XED7F,
-0XED80,0XED81,0XED82,0XED83,0XED84,0XED85,0XED86,0XED87,0XED88,0XED89,0XED8A,0XED8B,0XED8C,0XED8D,0XED8E,0XED8F,
-0XED90,0XED91,0XED92,0XED93,0XED94,0XED95,0XED96,0XED97,0XED98,0XED99,0XED9A,0XED9B,0XED9C,0XED9D,0XED9E,0XED9F,
-0XEDA0,0XEDA1,0XEDA2,0XEDA3,0XEDA4,0XEDA5,0XEDA6,0XEDA7,0XEDA8,0XEDA9,0XEDAA,0XEDAB,0XEDAC,0XEDAD,0XEDAE,0XEDAF,
-0XEDB0,0XEDB1,0XEDB2,0XEDB3,0XEDB4,0XEDB5,0XEDB6,0XEDB7,0XEDB8,0XEDB9,0XEDBA,0XEDBB,0XEDBC,0XEDBD,0XEDBE,0XEDBF,
-0XEDC0,0XEDC1,0XEDC2,0XEDC3,0XEDC4,0XEDC5,0XEDC6,0XEDC7,0XEDC8,0XEDC9,0XEDCA,0XEDCB,0XEDCC,0XEDCD,0XEDCE,0XEDCF,
-0XEDD0,0XEDD1,0XEDD2,0XEDD3,0XEDD4,0XEDD5,0XEDD6,0XEDD7,0XEDD8,0XEDD9,0XEDDA,0XEDDB,0XEDDC,0XEDDD,0XEDDE,0XEDDF,
-0XEDE0,0XEDE1,0XEDE2,0XEDE3,0XEDE4,0XEDE5,0XEDE6,0XEDE7,0XEDE8,0XEDE9,0XEDEA,0XEDEB,0XEDEC,0XEDED,0XEDEE,0XEDEF,
-0XEDF0,0XEDF1,0XEDF2,0XEDF3,0XEDF4,0XEDF5,0XEDF6,0XEDF7,0XEDF8,0XEDF9,0XEDFA,0XEDFB,0XEDFC,0XEDFD,0XEDFE,0XEDFF,
-0XEE40,0XEE41,0XEE42,0XEE43,0XEE44,0XEE45,0XEE46,0XEE47,0XEE48,0XEE49,0XEE4A,0XEE4B,0XEE4C,0XEE4D,0XEE4E,0XEE4F,
-0XEE50,0XEE51,0XEE52,0XEE53,0XEE54,0XEE55,0XEE56,0XEE57,0XEE58,0XEE59,0XEE5A,0XEE5B,0XEE5C,0XEE5D,0XEE5E,0XEE5F,
-0XEE60,0XEE61,0XEE62,0XEE63,0XEE64,0XEE65,0XEE66,0XEE67,0XEE68,0XEE69,0XEE6A,0XEE6B,0XEE6C,0XEE6D,0XEE6E,0XEE6F,
-0XEE70,0XEE71,0XEE72,0XEE73,0XEE74,0XEE75,0XEE76,0XEE77,0XEE78,0XEE79,0XEE7A,0XEE7B,0XEE7C,0XEE7D,0XEE7E,0XEE7F,
-0XEE80,0XEE81,0XEE82,0XEE83,0XEE84,0XEE85,0XEE86,0XEE87,0XEE88,0XEE89,0XEE8A,0XEE8B,0XEE8C,0XEE8D,0XEE8E,0XEE8F,
-0XEE90,0XEE91,0XEE92,0XEE93,0XEE94,0XEE95,0XEE96,0XEE97,0XEE98,0XEE99,0XEE9A,0XEE9B,0XEE9C,0XEE9D,0XEE9E,0XEE9F,
-0XEEA0,0XEEA1,0XEEA2,0XEEA3,0XEEA4,0XEEA5,0XEEA6,0XEEA7,0XEEA8,0XEEA9,0XEEAA,0XEEAB,0XEEAC,0XEEAD,0XEEAE,0XEEAF,
-0XEEB0,0XEEB1,0XEEB2,0XEEB3,0XEEB4,0XEEB5,0XEEB6,0XEEB7,0XEEB8,0XEEB9,0XEEBA,0XEEBB,0XEEBC,0XEEBD,0XEEBE,0XEEBF,
-0XEEC0,0XEEC1,0XEEC2,0XEEC3,0XEEC4,0XEEC5,0XEEC6,0XEEC7,0XEEC8,0XEEC9,0XEECA,0XEECB,0XEECC,0XEECD,0XEECE,0XEECF,
-0XEED0,0XEED1,0XEED2,0XEED3,0XEED4,0XEED5,0XEED6,0XEED7,0XEED8,0XEED9,0XEEDA,0XEEDB,0XEEDC,0XEEDD,0XEEDE,0XEEDF,
-0XEEE0,0XEEE1,0XEEE2,0XEEE3,0XEEE4,0XEEE5,0XEEE6,0XEEE7,0XEEE8,0XEEE9,0XEEEA,0XEEEB,0XEEEC,0XEEED,0XEEEE,0XEEEF,
-0XEEF0,0XEEF1,0XEEF2,0XEEF3,0XEEF4,0XEEF5,0XEEF6,0XEEF7,0XEEF8,0XEEF9,0XEEFA,0XEEFB,0XEEFC,0XEEFD,0XEEFE,0XEEFF,
-0XEF40,0XEF41,0XEF42,0XEF43,0XEF44,0XEF45,0XEF46,0XEF47,0XEF48,0XEF49,0XEF4A,0XEF4B,0XEF4C,0XEF4D,0XEF4E,0XEF4F,
-0XEF50,0XEF51,0XEF52,0XEF53,0XEF54,0XEF55,0XEF56,0XEF57,0XEF58,0XEF59,0XEF5A,0XEF5B,0XEF5C,0XEF5D,0XEF5E,0XEF5F,
-0XEF60,0XEF61,0XEF62,0XEF63,0XEF64,0XEF65,0XEF66,0XEF67,0XEF68,0XEF69,0XEF6A,0XEF6B,0XEF6C,0XEF6D,0XEF6E,0XEF6F,
-0XEF70,0XEF71,0XEF72,0XEF73,0XEF74,0XEF75,0XEF76,0XEF77,0XEF78,0XEF79,0XEF7A,0XEF7B,0XEF7C,0XEF7D,0XEF7E,0XEF7F,
-0XEF80,0XEF81,0XEF82,0XEF83,0XEF84,0XEF85,0XEF86,0XEF87,0XEF88,0XEF89,0XEF8A,0XEF8B,0XEF8C,0XEF8D,0XEF8E,0XEF8F,
-0XEF90,0XEF91,0XEF92,0XEF93,0XEF94,0XEF95,0XEF96,0XEF97,0XEF98,0XEF99,0XEF9A,0XEF9B,0XEF9C,0XEF9D,0XEF9E,0XEF9F,
-0XEFA0,0XEFA1,0XEFA2,0XEFA3,0XEFA4,0XEFA5,0XEFA6,0XEFA7,0XEFA8,0XEFA9,0XEFAA,0XEFAB,0XEFAC,0XEFAD,0XEFAE,0XEFAF,
-0XEFB0,0XEFB1,0XEFB2,0XEFB3,0XEFB4,0XEFB5,0XEFB6,0XEFB7,0XEFB8,0XEFB9,0XEFBA,0XEFBB,0XEFBC,0XEFBD,0XEFBE,0XEFBF,
-0XEFC0,0XEFC1,0XEFC2,0XEFC3,0XEFC4,0XEFC5,0XEFC6,0XEFC7,0XEFC8,0XEFC9,0XEFCA,0XEFCB,0XEFCC,0XEFCD,0XEFCE,0XEFCF,
-0XEFD0,0XEFD1,0XEFD2,0XEFD3,0XEFD4,0XEFD5,0XEFD6,0XEFD7,0XEFD8,0XEFD9,0XEFDA,0XEFDB,0XEFDC,0XEFDD,0XEFDE,0XEFDF,
-0XEFE0,0XEFE1,0XEFE2,0XEFE3,0XEFE4,0XEFE5,0XEFE6,0XEFE7,0XEFE8,0XEFE9,0XEFEA,0XEFEB,0XEFEC,0XEFED,0XEFEE,0XEFEF,
-0XEFF0,0XEFF1,0XEFF2,0XEFF3,0XEFF4,0XEFF5,0XEFF6,0XEFF7,0XEFF8,0XEFF9,0XEFFA,0XEFFB,0XEFFC,0XEFFD,0XEFFE,0XEFFF,
-0XF040,0XF041,0XF042,0XF043,0XF044,0XF045,0XF046,0XF047,0XF048,0XF049,0XF04A,0XF04B,0XF04C,0XF04D,0XF04E,0XF04F,
-0XF050,0XF051,0XF052,0XF053,0XF054,0XF055,0XF056,0XF057,0XF058,0XF059,0XF05A,0XF05B,0XF05C,0XF05D,0XF05E,0XF05F,
-0XF060,0XF061,0XF062,0XF063,0XF064,0XF065,0XF066,0XF067,0XF068,0XF069,0XF06A,0XF06B,0XF06C,0XF06D,0XF06E,0XF06F,
-0XF070,0XF071,0XF072,0XF073,0XF074,0XF075,0XF076,0XF077,0XF078,0XF079,0XF07A,0XF07B,0XF07C,0XF07D,0XF07E,0XF07F,
-0XF080,0XF081,0XF082,0XF083,0XF084,0XF085,0XF086,0XF087,0XF088,0XF089,0XF08A,0XF08B,0XF08C,0XF08D,0XF08E,0XF08F,
-0XF090,0XF091,0XF092,0XF093,0XF094,0XF095,0XF096,0XF097,0XF098,0XF099,0XF09A,0XF09B,0XF09C,0XF09D,0XF09E,0XF09F,
-0XF0A0,0XF0A1,0XF0A2,0XF0A3,0XF0A4,0XF0A5,0XF0A6,0XF0A7,0XF0A8,0XF0A9,0XF0AA,0XF0AB,0XF0AC,0XF0AD,0XF0AE,0XF0AF,
-0XF0B0,0XF0B1,0XF0B2,0XF0B3,0XF0B4,0XF0B5,0XF0B6,0XF0B7,0XF0B8,0XF0B9,0XF0BA,0XF0BB,0XF0BC,0XF0BD,0XF0BE,0XF0BF,
-0XF0C0,0XF0C1,0XF0C2,0XF0C3,0XF0C4,0XF0C5,0XF0C6,0XF0C7,0XF0C8,0XF0C9,0XF0CA,0XF0CB,0XF0CC,0XF0CD,0XF0CE,0XF0CF,
-0XF0D0,0XF0D1,0XF0D2,0XF0D3,0XF0D4,0XF0D5,0XF0D6,0XF0D7,0XF0D8,0XF0D9,0XF0DA,0XF0DB,0XF0DC,0XF0DD,0XF0DE,0XF0DF,
-0XF0E0,0XF0E1,0XF0E2,0XF0E3,0XF0E4,0XF0E5,0XF0E6,0XF0E7,0XF0E8,0XF0E9,0XF0EA,0XF0EB,0XF0EC,0XF0ED,0XF0EE,0XF0EF,
-0XF0F0,0XF0F1,0XF0F2,0XF0F3,0XF0F4,0XF0F5,0XF0F6,0XF0F7,0XF0F8,0XF0F9,0XF0FA,0XF0FB,0XF0FC,0XF0FD,0XF0FE,0XF0FF,
-0XF140,0XF141,0XF142,0XF143,0XF144,0XF145,0XF146,0XF147,0XF148,0XF149,0XF14A,0XF14B,0XF14C,0XF14D,0XF14E,0XF14F,
-0XF150,0XF151,0XF152,0XF153,0XF154,0XF155,0XF156,0XF157,0XF158,0XF159,0XF15A,0XF15B,0XF15C,0XF15D,0XF15E,0XF15F,
-0XF160,0XF161,0XF162,0XF163,0XF164,0XF165,0XF166,0XF167,0XF168,0XF169,0XF16A,0XF16B,0XF16C,0XF16D,0XF16E,0XF16F,
-0XF170,0XF171,0XF172,0XF173,0XF174,0XF175,0XF176,0XF177,0XF178,0XF179,0XF17A,0XF17B,0XF17C,0XF17D,0XF17E,0XF17F,
-0XF180,0XF181,0XF182,0XF183,0XF184,0XF185,0XF186,0XF187,0XF188,0XF189,0XF18A,0XF18B,0XF18C,0XF18D,0XF18E,0XF18F,
-0XF190,0XF191,0XF192,0XF193,0XF194,0XF195,0XF196,0XF197,0XF198,0XF199,0XF19A,0XF19B,0XF19C,0XF19D,0XF19E,0XF19F,
-0XF1A0,0XF1A1,0XF1A2,0XF1A3,0XF1A4,0XF1A5,0XF1A6,0XF1A7,0XF1A8,0XF1A9,0XF1AA,0XF1AB,0XF1AC,0XF1AD,0XF1AE,0XF1AF,
-0XF1B0,0XF1B1,0XF1B2,0XF1B3,0XF1B4,0XF1B5,0XF1B6,0XF1B7,0XF1B8,0XF1B9,0XF1BA,0XF1BB,0XF1BC,0XF1BD,0XF1BE,0XF1BF,
-0XF1C0,0XF1C1,0XF1C2,0XF1C3,0XF1C4,0XF1C5,0XF1C6,0XF1C7,0XF1C8,0XF1C9,0XF1CA,0XF1CB,0XF1CC,0XF1CD,0XF1CE,0XF1CF,
-0XF1D0,0XF1D1,0XF1D2,0XF1D3,0XF1D4,0XF1D5,0XF1D6,0XF1D7,0XF1D8,0XF1D9,0XF1DA,0XF1DB,0XF1DC,0XF1DD,0XF1DE,0XF1DF,
-0XF1E0,0XF1E1,0XF1E2,0XF1E3,0XF1E4,0XF1E5,0XF1E6,0XF1E7,0XF1E8,0XF1E9,0XF1EA,0XF1EB,0XF1EC,0XF1ED,0XF1EE,0XF1EF,
-0XF1F0,0XF1F1,0XF1F2,0XF1F3,0XF1F4,0XF1F5,0XF1F6,0XF1F7,0XF1F8,0XF1F9,0XF1FA,0XF1FB,0XF1FC,0XF1FD,0XF1FE,0XF1FF,
-0XF240,0XF241,0XF242,0XF243,0XF244,0XF245,0XF246,0XF247,0XF248,0XF249,0XF24A,0XF24B,0XF24C,0XF24D,0XF24E,0XF24F,
-0XF250,0XF251,0XF252,0XF253,0XF254,0XF255,0XF256,0XF257,0XF258,0XF259,0XF25A,0XF25B,0XF25C,0XF25D,0XF25E,0XF25F,
-0XF260,0XF261,0XF262,0XF263,0XF264,0XF265,0XF266,0XF267,0XF268,0XF269,0XF26A,0XF26B,0XF26C,0XF26D,0XF26E,0XF26F,
-0XF270,0XF271,0XF272,0XF273,0XF274,0XF275,0XF276,0XF277,0XF278,0XF279,0XF27A,0XF27B,0XF27C,0XF27D,0XF27E,0XF27F,
-0XF280,0XF281,0XF282,0XF283,0XF284,0XF285,0XF286,0XF287,0XF288,0XF289,0XF28A,0XF28B,0XF28C,0XF28D,0XF28E,0XF28F,
-0XF290,0XF291,0XF292,0XF293,0XF294,0XF295,0XF296,0XF297,0XF298,0XF299,0XF29A,0XF29B,0XF29C,0XF29D,0XF29E,0XF29F,
-0XF2A0,0XF2A1,0XF2A2,0XF2A3,0XF2A4,0XF2A5,0XF2A6,0XF2A7,0XF2A8,0XF2A9,0XF2AA,0XF2AB,0XF2AC,0XF2AD,0XF2AE,0XF2AF,
-0XF2B0,0XF2B1,0XF2B2,0XF2B3,0XF2B4,0XF2B5,0XF2B6,0XF2B7,0XF2B8,0XF2B9,0XF2BA,0XF2BB,0XF2BC,0XF2BD,0XF2BE,0XF2BF,
-0XF2C0,0XF2C1,0XF2C2,0XF2C3,0XF2C4,0XF2C5,0XF2C6,0XF2C7,0XF2C8,0XF2C9,0XF2CA,0XF2CB,0XF2CC,0XF2CD,0XF2CE,0XF2CF,
-0XF2D0,0XF2D1,0XF2D2,0XF2D3,0XF2D4,0XF2D5,0XF2D6,0XF2D7,0XF2D8,0XF2D9,0XF2DA,0XF2DB,0XF2DC,0XF2DD,0XF2DE,0XF2DF,
-0XF2E0,0XF2E1,0XF2E2,0XF2E3,0XF2E4,0XF2E5,0XF2E6,0XF2E7,0XF2E8,0XF2E9,0XF2EA,0XF2EB,0XF2EC,0XF2ED,0XF2EE,0XF2EF,
-0XF2F0,0XF2F1,0XF2F2,0XF2F3,0XF2F4,0XF2F5,0XF2F6,0XF2F7,0XF2F8,0XF2F9,0XF2FA,0XF2FB,0XF2FC,0XF2FD,0XF2FE,0XF2FF,
-0XF340,0XF341,0XF342,0XF343,0XF344,0XF345,0XF346,0XF347,0XF348,0XF349,0XF34A,0XF34B,0XF34C,0XF34D,0XF34E,0XF34F,
-0XF350,0XF351,0XF352,0XF353,0XF354,0XF355,0XF356,0XF357,0XF358,0XF359,0XF35A,0XF35B,0XF35C,0XF35D,0XF35E,0XF35F,
-0XF360,0XF361,0XF362,0XF363,0XF364,0XF365,0XF366,0XF367,0XF368,0XF369,0XF36A,0XF36B,0XF36C,0XF36D,0XF36E,0XF36F,
-0XF370,0XF371,0XF372,0XF373,0XF374,0XF375,0XF376,0XF377,0XF378,0XF379,0XF37A,0XF37B,0XF37C,0XF37D,0XF37E,0XF37F,
-0XF380,0XF381,0XF382,0XF383,0XF384,0XF385,0XF386,0XF387,0XF388,0XF389,0XF38A,0XF38B,0XF38C,0XF38D,0XF38E,0XF38F,
-0XF390,0XF391,0XF392,0XF393,0XF394,0XF395,0XF396,0XF397,0XF398,0XF399,0XF39A,0XF39B,0XF39C,0XF39D,0XF39E,0XF39F,
-0XF3A0,0XF3A1,0XF3A2,0XF3A3,0XF3A4,0XF3A5,0XF3A6,0XF3A7,0XF3A8,0XF3A9,0XF3AA,0XF3AB,0XF3AC,0XF3AD,0XF3AE,0XF3AF,
-0XF3B0,0XF3B1,0XF3B2,0XF3B3,0XF3B4,0XF3B5,0XF3B6,0XF3B7,0XF3B8,0XF3B9,0XF3BA,0XF3BB,0XF3BC,0XF3BD,0XF3BE,0XF3BF,
-0XF3C0,0XF3C1,0XF3C2,0XF3C3,0XF3C4,0XF3C5,0XF3C6,0XF3C7,0XF3C8,0XF3C9,0XF3CA,0XF3CB,0XF3CC,0XF3CD,0XF3CE,0XF3CF,
-0XF3D0,0XF3D1,0XF3D2,0XF3D3,0XF3D4,0XF3D5,0XF3D6,0XF3D7,0XF3D8,0XF3D9,0XF3DA,0XF3DB,0XF3DC,0XF3DD,0XF3DE,0XF3DF,
-0XF3E0,0XF3E1,0XF3E2,0XF3E3,0XF3E4,0XF3E5,0XF3E6,0XF3E7,0XF3E8,0XF3E9,0XF3EA,0XF3EB,0XF3EC,0XF3ED,0XF3EE,0XF3EF,
-0XF3F0,0XF3F1,0XF3F2,0XF3F3,0XF3F4,0XF3F5,0XF3F6,0XF3F7,0XF3F8,0XF3F9,0XF3FA,0XF3FB,0XF3FC,0XF3FD,0XF3FE,0XF3FF,
-0XF440,0XF441,0XF442,0XF443,0XF444,0XF445,0XF446,0XF447,0XF448,0XF449,0XF44A,0XF44B,0XF44C,0XF44D,0XF44E,0XF44F,
-0XF450,0XF451,0XF452,0XF453,0XF454,0XF455,0XF456,0XF457,0XF458,0XF459,0XF45A,0XF45B,0XF45C,0XF45D,0XF45E,0XF45F,
-0XF460,0XF461,0XF462,0XF463,0XF464,0XF465,0XF466,0XF467,0XF468,0XF469,0XF46A,0XF46B,0XF46C,0XF46D,0XF46E,0XF46F,
-0XF470,0XF471,0XF472,0XF473,0XF474,0XF475,0XF476,0XF477,0XF478,0XF479,0XF47A,0XF47B,0XF47C,0XF47D,0XF47E,0XF47F,
-0XF480,0XF481,0XF482,0XF483,0XF484,0XF485,0XF486,0XF487,0XF488,0XF489,0XF48A,0XF48B,0XF48C,0XF48D,0XF48E,0XF48F,
-0XF490,0XF491,0XF492,0XF493,0XF494,0XF495,0XF496,0XF497,0XF498,0XF499,0XF49A,0XF49B,0XF49C,0XF49D,0XF49E,0XF49F,
-0XF4A0,0XF4A1,0XF4A2,0XF4A3,0XF4A4,0XF4A5,0XF4A6,0XF4A7,0XF4A8,0XF4A9,0XF4AA,0XF4AB,0XF4AC,0XF4AD,0XF4AE,0XF4AF,
-0XF4B0,0XF4B1,0XF4B2,0XF4B3,0XF4B4,0XF4B5,0XF4B6,0XF4B7,0XF4B8,0XF4B9,0XF4BA,0XF4BB,0XF4BC,0XF4BD,0XF4BE,0XF4BF,
-0XF4C0,0XF4C1,0XF4C2,0XF4C3,0XF4C4,0XF4C5,0XF4C6,0XF4C7,0XF4C8,0XF4C9,0XF4CA,0XF4CB,0XF4CC,0XF4CD,0XF4CE,0XF4CF,
-0XF4D0,0XF4D1,0XF4D2,0XF4D3,0XF4D4,0XF4D5,0XF4D6,0XF4D7,0XF4D8,0XF4D9,0XF4DA,0XF4DB,0XF4DC,0XF4DD,0XF4DE,0XF4DF,
-0XF4E0,0XF4E1,0XF4E2,0XF4E3,0XF4E4,0XF4E5,0XF4E6,0XF4E7,0XF4E8,0XF4E9,0XF4EA,0XF4EB,0XF4EC,0XF4ED,0XF4EE,0XF4EF,
-0XF4F0,0XF4F1,0XF4F2,0XF4F3,0XF4F4,0XF4F5,0XF4F6,0XF4F7,0XF4F8,0XF4F9,0XF4FA,0XF4FB,0XF4FC,0XF4FD,0XF4FE,0XF4FF,
-0XF540,0XF541,0XF542,0XF543,0XF544,0XF545,0XF546,0XF547,0XF548,0XF549,0XF54A,0XF54B,0XF54C,0XF54D,0XF54E,0XF54F,
-0XF550,0XF551,0XF552,0XF553,0XF554,0XF555,0XF556,0XF557,0XF558,0XF559,0XF55A,0XF55B,0XF55C,0XF55D,0XF55E,0XF55F,
-0XF560,0XF561,0XF562,0XF563,0XF564,0XF565,0XF566,0XF567,0XF568,0XF569,0XF56A,0XF56B,0XF56C,0XF56D,0XF56E,0XF56F,
-0XF570,0XF571,0XF572,0XF573,0XF574,0XF575,0XF576,0XF577,0XF578,0XF579,0XF57A,0XF57B,0XF57C,0XF57D,0XF57E,0XF57F,
-0XF580,0XF581,0XF582,0XF583,0XF584,0XF585,0XF586,0XF587,0XF588,0XF589,0XF58A,0XF58B,0XF58C,0XF58D,0XF58E,0XF58F,
-0XF590,0XF591,0XF592,0XF593,0XF594,0XF595,0XF596,0XF597,0XF598,0XF599,0XF59A,0XF59B,0XF59C,0XF59D,0XF59E,0XF59F,
-0XF5A0,0XF5A1,0XF5A2,0XF5A3,0XF5A4,0XF5A5,0XF5A6,0XF5A7,0XF5A8,0XF5A9,0XF5AA,0XF5AB,0XF5AC,0XF5AD,0XF5AE,0XF5AF,
-0XF5B0,0XF5B1,0XF5B2,0XF5B3,0XF5B4,0XF5B5,0XF5B6,0XF5B7,0XF5B8,0XF5B9,0XF5BA,0XF5BB,0XF5BC,0XF5BD,0XF5BE,0XF5BF,
-0XF5C0,0XF5C1,0XF5C2,0XF5C3,0XF5C4,0XF5C5,0XF5C6,0XF5C7,0XF5C8,0XF5C9,0XF5CA,0XF5CB,0XF5CC,0XF5CD,0XF5CE,0XF5CF,
-0XF5D0,0XF5D1,0XF5D2,0XF5D3,0XF5D4,0XF5D5,0XF5D6,0XF5D7,0XF5D8,0XF5D9,0XF5DA,0XF5DB,0XF5DC,0XF5DD,0XF5DE,0XF5DF,
-0XF5E0,0XF5E1,0XF5E2,0XF5E3,0XF5E4,0XF5E5,0XF5E6,0XF5E7,0XF5E8,0XF5E9,0XF5EA,0XF5EB,0XF5EC,0XF5ED,0XF5EE,0XF5EF,
-0XF5F0,0XF5F1,0XF5F2,0XF5F3,0XF5F4,0XF5F5,0XF5F6,0XF5F7,0XF5F8,0XF5F9,0XF5FA,0XF5FB,0XF5FC,0XF5FD,0XF5FE,0XF5FF,
-0XF640,0XF641,0XF642,0XF643,0XF644,0XF645,0XF646,0XF647,0XF648,0XF649,0XF64A,0XF64B,0XF64C,0XF64D,0XF64E,0XF64F,
-0XF650,0XF651,0XF652,0XF653,0XF654,0XF655,0XF656,0XF657,0XF658,0XF659,0XF65A,0XF65B,0XF65C,0XF65D,0XF65E,0XF65F,
-0XF660,0XF661,0XF662,0XF663,0XF664,0XF665,0XF666,0XF667,0XF668,0XF669,0XF66A,0XF66B,0XF66C,0XF66D,0XF66E,0XF66F,
-0XF670,0XF671,0XF672,0XF673,0XF674,0XF675,0XF676,0XF677,0XF678,0XF679,0XF67A,0XF67B,0XF67C,0XF67D,0XF67E,0XF67F,
-0XF680,0XF681,0XF682,0XF683,0XF684,0XF685,0XF686,0XF687,0XF688,0XF689,0XF68A,0XF68B,0XF68C,0XF68D,0XF68E,0XF68F,
-0XF690,0XF691,0XF692,0XF693,0XF694,0XF695,0XF696,0XF697,0XF698,0XF699,0XF69A,0XF69B,0XF69C,0XF69D,0XF69E,0XF69F,
-0XF6A0,0XF6A1,0XF6A2,0XF6A3,0XF6A4,0XF6A5,0XF6A6,0XF6A7,0XF6A8,0XF6A9,0XF6AA,0XF6AB,0XF6AC,0XF6AD,0XF6AE,0XF6AF,
-0XF6B0,0XF6B1,0XF6B2,0XF6B3,0XF6B4,0XF6B5,0XF6B6,0XF6B7,0XF6B8,0XF6B9,0XF6BA,0XF6BB,0XF6BC,0XF6BD,0XF6BE,0XF6BF,
-0XF6C0,0XF6C1,0XF6C2,0XF6C3,0XF6C4,0XF6C5,0XF6C6,0XF6C7,0XF6C8,0XF6C9,0XF6CA,0XF6CB,0XF6CC,0XF6CD,0XF6CE,0XF6CF,
-0XF6D0,0XF6D1,0XF6D2,0XF6D3,0XF6D4,0XF6D5,0XF6D6,0XF6D7,0XF6D8,0XF6D9,0XF6DA,0XF6DB,0XF6DC,0XF6DD,0XF6DE,0XF6DF,
-0XF6E0,0XF6E1,0XF6E2,0XF6E3,0XF6E4,0XF6E5,0XF6E6,0XF6E7,0XF6E8,0XF6E9,0XF6EA,0XF6EB,0XF6EC,0XF6ED,0XF6EE,0XF6EF,
-0XF6F0,0XF6F1,0XF6F2,0XF6F3,0XF6F4,0XF6F5,0XF6F6,0XF6F7,0XF6F8,0XF6F9,0XF6FA,0XF6FB,0XF6FC,0XF6FD,0XF6FE,0XF6FF,
-0XF740,0XF741,0XF742,0XF743,0XF744,0XF745,0XF746,0XF747,0XF748,0XF749,0XF74A,0XF74B,0XF74C,0XF74D,0XF74E,0XF74F,
-0XF750,0XF751,0XF752,0XF753,0XF754,0XF755,0XF756,0XF757,0XF758,0XF759,0XF75A,0XF75B,0XF75C,0XF75D,0XF75E,0XF75F,
-0XF760,0XF761,0XF762,0XF763,0XF764,0XF765,0XF766,0XF767,0XF768,0XF769,0XF76A,0XF76B,0XF76C,0XF76D,0XF76E,0XF76F,
-0XF770,0XF771,0XF772,0XF773,0XF774,0XF775,0XF776,0XF777,0XF778,0XF779,0XF77A,0XF77B,0XF77C,0XF77D,0XF77E,0XF77F,
-0XF780,0XF781,0XF782,0XF783,0XF784,0XF785,0XF786,0XF787,0XF788,0XF789,0XF78A,0XF78B,0XF78C,0XF78D,0XF78E,0XF78F,
-0XF790,0XF791,0XF792,0XF793,0XF794,0XF795,0XF796,0XF797,0XF798,0XF799,0XF79A,0XF79B,0XF79C,0XF79D,0XF79E,0XF79F,
-0XF7A0,0XF7A1,0XF7A2,0XF7A3,0XF7A4,0XF7A5,0XF7A6,0XF7A7,0XF7A8,0XF7A9,0XF7AA,0XF7AB,0XF7AC,0XF7AD,0XF7AE,0XF7AF,
-0XF7B0,0XF7B1,0XF7B2,0XF7B3,0XF7B4,0XF7B5,0XF7B6,0XF7B7,0XF7B8,0XF7B9,0XF7BA,0XF7BB,0XF7BC,0XF7BD,0XF7BE,0XF7BF,
-0XF7C0,0XF7C1,0XF7C2,0XF7C3,0XF7C4,0XF7C5,0XF7C6,0XF7C7,0XF7C8,0XF7C9,0XF7CA,0XF7CB,0XF7CC,0XF7CD,0XF7CE,0XF7CF,
-0XF7D0,0XF7D1,0XF7D2,0XF7D3,0XF7D4,0XF7D5,0XF7D6,0XF7D7,0XF7D8,0XF7D9,0XF7DA,0XF7DB,0XF7DC,0XF7DD,0XF7DE,0XF7DF,
-0XF7E0,0XF7E1,0XF7E2,0XF7E3,0XF7E4,0XF7E5,0XF7E6,0XF7E7,0XF7E8,0XF7E9,0XF7EA,0XF7EB,0XF7EC,0XF7ED,0XF7EE,0XF7EF,
-0XF7F0,0XF7F1,0XF7F2,0XF7F3,0XF7F4,0XF7F5,0XF7F6,0XF7F7,0XF7F8,0XF7F9,0XF7FA,0XF7FB,0XF7FC,0XF7FD,0XF7FE,0XF7FF,
-0XF840,0XF841,0XF842,0XF843,0XF844,0XF845,0XF846,0XF847,0XF848,0XF849,0XF84A,0XF84B,0XF84C,0XF84D,0XF84E,0XF84F,
-0XF850,0XF851,0XF852,0XF853,0XF854,0XF855,0XF856,0XF857,0XF858,0XF859,0XF85A,0XF85B,0XF85C,0XF85D,0XF85E,0XF85F,
-0XF860,0XF861,0XF862,0XF863,0XF864,0XF865,0XF866,0XF867,0XF868,0XF869,0XF86A,0XF86B,0XF86C,0XF86D,0XF86E,0XF86F,
-0XF870,0XF871,0XF872,0XF873,0XF874,0XF875,0XF876,0XF877,0XF878,0XF879,0XF87A,0XF87B,0XF87C,0XF87D,0XF87E,0XF87F,
-0XF880,0XF881,0XF882,0XF883,0XF884,0XF885,0XF886,0XF887,0XF888,0XF889,0XF88A,0XF88B,0XF88C,0XF88D,0XF88E,0XF88F,
-0XF890,0XF891,0XF892,0XF893,0XF894,0XF895,0XF896,0XF897,0XF898,0XF899,0XF89A,0XF89B,0XF89C,0XF89D,0XF89E,0XF89F,
-0XF8A0,0XF8A1,0XF8A2,0XF8A3,0XF8A4,0XF8A5,0XF8A6,0XF8A7,0XF8A8,0XF8A9,0XF8AA,0XF8AB,0XF8AC,0XF8AD,0XF8AE,0XF8AF,
-0XF8B0,0XF8B1,0XF8B2,0XF8B3,0XF8B4,0XF8B5,0XF8B6,0XF8B7,0XF8B8,0XF8B9,0XF8BA,0XF8BB,0XF8BC,0XF8BD,0XF8BE,0XF8BF,
-0XF8C0,0XF8C1,0XF8C2,0XF8C3,0XF8C4,0XF8C5,0XF8C6,0XF8C7,0XF8C8,0XF8C9,0XF8CA,0XF8CB,0XF8CC,0XF8CD,0XF8CE,0XF8CF,
-0XF8D0,0XF8D1,0XF8D2,0XF8D3,0XF8D4,0XF8D5,0XF8D6,0XF8D7,0XF8D8,0XF8D9,0XF8DA,0XF8DB,0XF8DC,0XF8DD,0XF8DE,0XF8DF,
-0XF8E0,0XF8E1,0XF8E2,0XF8E3,0XF8E4,0XF8E5,0XF8E6,0XF8E7,0XF8E8,0XF8E9,0XF8EA,0XF8EB,0XF8EC,0XF8ED,0XF8EE,0XF8EF,
-0XF8F0,0XF8F1,0XF8F2,0XF8F3,0XF8F4,0XF8F5,0XF8F6,0XF8F7,0XF8F8,0XF8F9,0XF8FA,0XF8FB,0XF8FC,0XF8FD,0XF8FE,0XF8FF,
-0XF940,0XF941,0XF942,0XF943,0XF944,0XF945,0XF946,0XF947,0XF948,0XF949,0XF94A,0XF94B,0XF94C,0XF94D,0XF94E,0XF94F,
-0XF950,0XF951,0XF952,0XF953,0XF954,0XF955,0XF956,0XF957,0XF958,0XF959,0XF95A,0XF95B,0XF95C,0XF95D,0XF95E,0XF95F,
-0XF960,0XF961,0XF962,0XF963,0XF964,0XF965,0XF966,0XF967,0XF968,0XF969,0XF96A,0XF96B,0XF96C,0XF96D,0XF96E,0XF96F,
-0XF970,0XF971,0XF972,0XF973,0XF974,0XF975,0XF976,0XF977,0XF978,0XF979,0XF97A,0XF97B,0XF97C,0XF97D,0XF97E,0XF97F,
-0XF980,0XF981,0XF982,0XF983,0XF984,0XF985,0XF986,0XF987,0XF988,0XF989,0XF98A,0XF98B,0XF98C,0XF98D,0XF98E,0XF98F,
-0XF990,0XF991,0XF992,0XF993,0XF994,0XF995,0XF996,0XF997,0XF998,0XF999,0XF99A,0XF99B,0XF99C,0XF99D,0XF99E,0XF99F,
-0XF9A0,0XF9A1,0XF9A2,0XF9A3,0XF9A4,0XF9A5,0XF9A6,0XF9A7,0XF9A8,0XF9A9,0XF9AA,0XF9AB,0XF9AC,0XF9AD,0XF9AE,0XF9AF,
-0XF9B0,0XF9B1,0XF9B2,0XF9B3,0XF9B4,0XF9B5,0XF9B6,0XF9B7,0XF9B8,0XF9B9,0XF9BA,0XF9BB,0XF9BC,0XF9BD,0XF9BE,0XF9BF,
-0XF9C0,0XF9C1,0XF9C2,0XF9C3,0XF9C4,0XF9C5,0XF9C6,0XF9C7,0XF9C8,0XF9C9,0XF9CA,0XF9CB,0XF9CC,0XF9CD,0XF9CE,0XF9CF,
-0XF9D0,0XF9D1,0XF9D2,0XF9D3,0XF9D4,0XF9D5,0XF9D6,0XF9D7,0XF9D8,0XF9D9,0XF9DA,0XF9DB,0XF9DC,0XF9DD,0XF9DE,0XF9DF,
-0XF9E0,0XF9E1,0XF9E2,0XF9E3,0XF9E4,0XF9E5,0XF9E6,0XF9E7,0XF9E8,0XF9E9,0XF9EA,0XF9EB,0XF9EC,0XF9ED,0XF9EE,0XF9EF,
-0XF9F0,0XF9F1,0XF9F2,0XF9F3,0XF9F4,0XF9F5,0XF9F6,0XF9F7,0XF9F8,0XF9F9,0XF9FA,0XF9FB,0XF9FC,0XF9FD,0XF9FE,0XF9FF,
-0XFA40,0XFA41,0XFA42,0XFA43,0XFA44,0XFA45,0XFA46,0XFA47,0XFA48,0XFA49,0XFA4A,0XFA4B,0XFA4C,0XFA4D,0XFA4E,0XFA4F,
-0XFA50,0XFA51,0XFA52,0XFA53,0XFA54,0XFA55,0XFA56,0XFA57,0XFA58,0XFA59,0XFA5A,0XFA5B,0XFA5C,0XFA5D,0XFA5E,0XFA5F,
-0XFA60,0XFA61,0XFA62,0XFA63,0XFA64,0XFA65,0XFA66,0XFA67,0XFA68,0XFA69,0XFA6A,0XFA6B,0XFA6C,0XFA6D,0XFA6E,0XFA6F,
-0XFA70,0XFA71,0XFA72,0XFA73,0XFA74,0XFA75,0XFA76,0XFA77,0XFA78,0XFA79,0XFA7A,0XFA7B,0XFA7C,0XFA7D,0XFA7E,0XFA7F,
-0XFA80,0XFA81,0XFA82,0XFA83,0XFA84,0XFA85,0XFA86,0XFA87,0XFA88,0XFA89,0XFA8A,0XFA8B,0XFA8C,0XFA8D,0XFA8E,0XFA8F,
-0XFA90,0XFA91,0XFA92,0XFA93,0XFA94,0XFA95,0XFA96,0XFA97,0XFA98,0XFA99,0XFA9A,0XFA9B,0XFA9C,0XFA9D,0XFA9E,0XFA9F,
-0XFAA0,0XFAA1,0XFAA2,0XFAA3,0XFAA4,0XFAA5,0XFAA6,0XFAA7,0XFAA8,0XFAA9,0XFAAA,0XFAAB,0XFAAC,0XFAAD,0XFAAE,0XFAAF,
-0XFAB0,0XFAB1,0XFAB2,0XFAB3,0XFAB4,0XFAB5,0XFAB6,0XFAB7,0XFAB8,0XFAB9,0XFABA,0XFABB,0XFABC,0XFABD,0XFABE,0XFABF,
-0XFAC0,0XFAC1,0XFAC2,0XFAC3,0XFAC4,0XFAC5,0XFAC6,0XFAC7,0XFAC8,0XFAC9,0XFACA,0XFACB,0XFACC,0XFACD,0XFACE,0XFACF,
-0XFAD0,0XFAD1,0XFAD2,0XFAD3,0XFAD4,0XFAD5,0XFAD6,0XFAD7,0XFAD8,0XFAD9,0XFADA,0XFADB,0XFADC,0XFADD,0XFADE,0XFADF,
-0XFAE0,0XFAE1,0XFAE2,0XFAE3,0XFAE4,0XFAE5,0XFAE6,0XFAE7,0XFAE8,0XFAE9,0XFAEA,0XFAEB,0XFAEC,0XFAED,0XFAEE,0XFAEF,
-0XFAF0,0XFAF1,0XFAF2,0XFAF3,0XFAF4,0XFAF5,0XFAF6,0XFAF7,0XFAF8,0XFAF9,0XFAFA,0XFAFB,0XFAFC,0XFAFD,0XFAFE,0XFAFF,
-0XFB40,0XFB41,0XFB42,0XFB43,0XFB44,0XFB45,0XFB46,0XFB47,0XFB48,0XFB49,0XFB4A,0XFB4B,0XFB4C,0XFB4D,0XFB4E,0XFB4F,
-0XFB50,0XFB51,0XFB52,0XFB53,0XFB54,0XFB55,0XFB56,0XFB57,0XFB58,0XFB59,0XFB5A,0XFB5B,0XFB5C,0XFB5D,0XFB5E,0XFB5F,
-0XFB60,0XFB61,0XFB62,0XFB63,0XFB64,0XFB65,0XFB66,0XFB67,0XFB68,0XFB69,0XFB6A,0XFB6B,0XFB6C,0XFB6D,0XFB6E,0XFB6F,
-0XFB70,0XFB71,0XFB72,0XFB73,0XFB74,0XFB75,0XFB76,0XFB77,0XFB78,0XFB79,0XFB7A,0XFB7B,0XFB7C,0XFB7D,0XFB7E,0XFB7F,
-0XFB80,0XFB81,0XFB82,0XFB83,0XFB84,0XFB85,0XFB86,0XFB87,0XFB88,0XFB89,0XFB8A,0XFB8B,0XFB8C,0XFB8D,0XFB8E,0XFB8F,
-0XFB90,0XFB91,0XFB92,0XFB93,0XFB94,0XFB95,0XFB96,0XFB97,0XFB98,0XFB99,0XFB9A,0XFB9B,0XFB9C,0XFB9D,0XFB9E,0XFB9F,
-0XFBA0,0XFBA1,0XFBA2,0XFBA3,0XFBA4,0XFBA5,0XFBA6,0XFBA7,0XFBA8,0XFBA9,0XFBAA,0XFBAB,0XFBAC,0XFBAD,0XFBAE,0XFBAF,
-0XFBB0,0XFBB1,0XFBB2,0XFBB3,0XFBB4,0XFBB5,0XFBB6,0XFBB7,0XFBB8,0XFBB9,0XFBBA,0XFBBB,0XFBBC,0XFBBD,0XFBBE,0XFBBF,
-0XFBC0,0XFBC1,0XFBC2,0XFBC3,0XFBC4,0XFBC5,0XFBC6,0XFBC7,0XFBC8,0XFBC9,0XFBCA,0XFBCB,0XFBCC,0XFBCD,0XFBCE,0XFBCF,
-0XFBD0,0XFBD1,0XFBD2,0XFBD3,0XFBD4,0XFBD5,0XFBD6,0XFBD7,0XFBD8,0XFBD9,0XFBDA,0XFBDB,0XFBDC,0XFBDD,0XFBDE,0XFBDF,
-0XFBE0,0XFBE1,0XFBE2,0XFBE3,0XFBE4,0XFBE5,0XFBE6,0XFBE7,0XFBE8,0XFBE9,0XFBEA,0XFBEB,0XFBEC,0XFBED,0XFBEE,0XFBEF,
-0XFBF0,0XFBF1,0XFBF2,0XFBF3,0XFBF4,0XFBF5,0XFBF6,0XFBF7,0XFBF8,0XFBF9,0XFBFA,0XFBFB,0XFBFC,0XFBFD,0XFBFE,0XFBFF,
-0XFC40,0XFC41,0XFC42,0XFC43,0XFC44,0XFC45,0XFC46,0XFC47,0XFC48,0XFC49,0XFC4A,0XFC4B,0XFC4C,0XFC4D,0XFC4E,0XFC4F,
-0XFC50,0XFC51,0XFC52,0XFC53,0XFC54,0XFC55,0XFC56,0XFC57,0XFC58,0XFC59,0XFC5A,0XFC5B,0XFC5C,0XFC5D,0XFC5E,0XFC5F,
-0XFC60,0XFC61,0XFC62,0XFC63,0XFC64,0XFC65,0XFC66,0XFC67,0XFC68,0XFC69,0XFC6A,0XFC6B,0XFC6C,0XFC6D,0XFC6E,0XFC6F,
-0XFC70,0XFC71,0XFC72,0XFC73,0XFC74,0XFC75,0XFC76,0XFC77,0XFC78,0XFC79,0XFC7A,0XFC7B,0XFC7C,0XFC7D,0XFC7E,0XFC7F,
-0XFC80,0XFC81,0XFC82,0XFC83,0XFC84,0XFC85,0XFC86,0XFC87,0XFC88,0XFC89,0XFC8A,0XFC8B,0XFC8C,0XFC8D,0XFC8E,0XFC8F,
-0XFC90,0XFC91,0XFC92,0XFC93,0XFC94,0XFC95,0XFC96,0XFC97,0XFC98,0XFC99,0XFC9A,0XFC9B,0XFC9C,0XFC9D,0XFC9E,0XFC9F,
-0XFCA0,0XFCA1,0XFCA2,0XFCA3,0XFCA4,0XFCA5,0XFCA6,0XFCA7,0XFCA8,0XFCA9,0XFCAA,0XFCAB,0XFCAC,0XFCAD,0XFCAE,0XFCAF,
-0XFCB0,0XFCB1,0XFCB2,0XFCB3,0XFCB4,0XFCB5,0XFCB6,0XFCB7,0XFCB8,0XFCB9,0XFCBA,0XFCBB,0XFCBC,0XFCBD,0XFCBE,0XFCBF,
-0XFCC0,0XFCC1,0XFCC2,0XFCC3,0XFCC4,0XFCC5,0XFCC6,0XFCC7,0XFCC8,0XFCC9,0XFCCA,0XFCCB,0XFCCC,0XFCCD,0XFCCE,0XFCCF,
-0XFCD0,0XFCD1,0XFCD2,0XFCD3,0XFCD4,0XFCD5,0XFCD6,0XFCD7,0XFCD8,0XFCD9,0XFCDA,0XFCDB,0XFCDC,0XFCDD,0XFCDE,0XFCDF,
-0XFCE0,0XFCE1,0XFCE2,0XFCE3,0XFCE4,0XFCE5,0XFCE6,0XFCE7,0XFCE8,0XFCE9,0XFCEA,0XFCEB,0XFCEC,0XFCED,0XFCEE,0XFCEF,
-0XFCF0,0XFCF1,0XFCF2,0XFCF3,0XFCF4,0XFCF5,0XFCF6,0XFCF7,0XFCF8,0XFCF9,0XFCFA,0XFCFB,0XFCFC,0XFCFD,0XFCFE,0XFCFF,
-0XFD40,0XFD41,0XFD42,0XFD43,0XFD44,0XFD45,0XFD46,0XFD47,0XFD48,0XFD49,0XFD4A,0XFD4B,0XFD4C,0XFD4D,0XFD4E,0XFD4F,
-0XFD50,0XFD51,0XFD52,0XFD53,0XFD54,0XFD55,0XFD56,0XFD57,0XFD58,0XFD59,0XFD5A,0XFD5B,0XFD5C,0XFD5D,0XFD5E,0XFD5F,
-0XFD60,0XFD61,0XFD62,0XFD63,0XFD64,0XFD65,0XFD66,0XFD67,0XFD68,0XFD69,0XFD6A,0XFD6B,0XFD6C,0XFD6D,0XFD6E,0XFD6F,
-0XFD70,0XFD71,0XFD72,0XFD73,0XFD74,0XFD75,0XFD76,0XFD77,0XFD78,0XFD79,0XFD7A,0XFD7B,0XFD7C,0XFD7D,0XFD7E,0XFD7F,
-0XFD80,0XFD81,0XFD82,0XFD83,0XFD84,0XFD85,0XFD86,0XFD87,0XFD88,0XFD89,0XFD8A,0XFD8B,0XFD8C,0XFD8D,0XFD8E,0XFD8F,
-0XFD90,0XFD91,0XFD92,0XFD93,0XFD94,0XFD95,0XFD96,0XFD97,0XFD98,0XFD99,0XFD9A,0XFD9B,0XFD9C,0XFD9D,0XFD9E,0XFD9F,
-0XFDA0,0XFDA1,0XFDA2,0XFDA3,0XFDA4,0XFDA5,0XFDA6,0XFDA7,0XFDA8,0XFDA9,0XFDAA,0XFDAB,0XFDAC,0XFDAD,0XFDAE,0XFDAF,
-0XFDB0,0XFDB1,0XFDB2,0XFDB3,0XFDB4,0XFDB5,0XFDB6,0XFDB7,0XFDB8,0XFDB9,0XFDBA,0XFDBB,0XFDBC,0XFDBD,0XFDBE,0XFDBF,
-0XFDC0,0XFDC1,0XFDC2,0XFDC3,0XFDC4,0XFDC5,0XFDC6,0XFDC7,0XFDC8,0XFDC9,0XFDCA,0XFDCB,0XFDCC,0XFDCD,0XFDCE,0XFDCF,
-0XFDD0,0XFDD1,0XFDD2,0XFDD3,0XFDD4,0XFDD5,0XFDD6,0XFDD7,0XFDD8,0XFDD9,0XFDDA,0XFDDB,0XFDDC,0XFDDD,0XFDDE,0XFDDF,
-0XFDE0,0XFDE1,0XFDE2,0XFDE3,0XFDE4,0XFDE5,0XFDE6,0XFDE7,0XFDE8,0XFDE9,0XFDEA,0XFDEB,0XFDEC,0XFDED,0XFDEE,0XFDEF,
-0XFDF0,0XFDF1,0XFDF2,0XFDF3,0XFDF4,0XFDF5,0XFDF6,0XFDF7,0XFDF8,0XFDF9,0XFDFA,0XFDFB,0XFDFC,0XFDFD,0XFDFE,0XFDFF,
-0XFE40,0XFE41,0XFE42,0XFE43,0XFE44,0XFE45,0XFE46,0XFE47,0XFE48,0XFE49,0XFE4A,0XFE4B,0XFE4C,0XFE4D,0XFE4E,0XFE4F,
-0XFE50,0XFE51,0XFE52,0XFE53,0XFE54,0XFE55,0XFE56,0XFE57,0XFE58,0XFE59,0XFE5A,0XFE5B,0XFE5C,0XFE5D,0XFE5E,0XFE5F,
-0XFE60,0XFE61,0XFE62,0XFE63,0XFE64,0XFE65,0XFE66,0XFE67,0XFE68,0XFE69,0XFE6A,0XFE6B,0XFE6C,0XFE6D,0XFE6E,0XFE6F,
-0XFE70,0XFE71,0XFE72,0XFE73,0XFE74,0XFE75,0XFE76,0XFE77,0XFE78,0XFE79,0XFE7A,0XFE7B,0XFE7C,0XFE7D,0XFE7E,0XFE7F,
-0XFE80,0XFE81,0XFE82,0XFE83,0XFE84,0XFE85,0XFE86,0XFE87,0XFE88,0XFE89,0XFE8A,0XFE8B,0XFE8C,0XFE8D,0XFE8E,0XFE8F,
-0XFE90,0XFE91,0XFE92,0XFE93,0XFE94,0XFE95,0XFE96,0XFE97,0XFE98,0XFE99,0XFE9A,0XFE9B,0XFE9C,0XFE9D,0XFE9E,0XFE9F,
-0XFEA0,0XFEA1,0XFEA2,0XFEA3,0XFEA4,0XFEA5,0XFEA6,0XFEA7,0XFEA8,0XFEA9,0XFEAA,0XFEAB,0XFEAC,0XFEAD,0XFEAE,0XFEAF,
-0XFEB0,0XFEB1,0XFEB2,0XFEB3,0XFEB4,0XFEB5,0XFEB6,0XFEB7,0XFEB8,0XFEB9,0XFEBA,0XFEBB,0XFEBC,0XFEBD,0XFEBE,0XFEBF,
-0XFEC0,0XFEC1,0XFEC2,0XFEC3,0XFEC4,0XFEC5,0XFEC6,0XFEC7,0XFEC8,0XFEC9,0XFECA,0XFECB,0XFECC,0XFECD,0XFECE,0XFECF,
-0XFED0,0XFED1,0XFED2,0XFED3,0XFED4,0XFED5,0XFED6,0XFED7,0XFED8,0XFED9,0XFEDA,0XFEDB,0XFEDC,0XFEDD,0XFEDE,0XFEDF,
-0XFEE0,0XFEE1,0XFEE2,0XFEE3,0XFEE4,0XFEE5,0XFEE6,0XFEE7,0XFEE8,0XFEE9,0XFEEA,0XFEEB,0XFEEC,0XFEED,0XFEEE,0XFEEF,
-0XFEF0,0XFEF1,0XFEF2,0XFEF3,0XFEF4,0XFEF5,0XFEF6,0XFEF7,0XFEF8,0XFEF9,0XFEFA,0XFEFB,0XFEFC,0XFEFD,0XFEFE,0XFEFF,
-
-};
-
-//=====================
-//=====================
-//=====================
-
-
-static const unsigned short tab_uni_contents[] = {
-0X4E02,0X4E04,0X4E05,0X4E06,0X4E0F,0X4E12,0X4E17,0X4E1F,0X4E20,0X4E21,0X4E23,0X4E26,0X4E29,0X4E2E,0X4E2F,0X4E31,
-0X4E33,0X4E35,0X4E37,0X4E3C,0X4E40,0X4E41,0X4E42,0X4E44,0X4E46,0X4E4A,0X4E51,0X4E55,0X4E57,0X4E5A,0X4E5B,0X4E62,
-0X4E63,0X4E64,0X4E65,0X4E67,0X4E68,0X4E6A,0X4E6B,0X4E6C,0X4E6D,0X4E6E,0X4E6F,0X4E72,0X4E74,0X4E75,0X4E76,0X4E77,
-0X4E78,0X4E79,0X4E7A,0X4E7B,0X4E7C,0X4E7D,0X4E7F,0X4E80,0X4E81,0X4E82,0X4E83,0X4E84,0X4E85,0X4E87,0X4E8A,0X0001,
-0X4E90,0X4E96,0X4E97,0X4E99,0X4E9C,0X4E9D,0X4E9E,0X4EA3,0X4EAA,0X4EAF,0X4EB0,0X4EB1,0X4EB4,0X4EB6,0X4EB7,0X4EB8,
-0X4EB9,0X4EBC,0X4EBD,0X4EBE,0X4EC8,0X4ECC,0X4ECF,0X4ED0,0X4ED2,0X4EDA,0X4EDB,0X4EDC,0X4EE0,0X4EE2,0X4EE6,0X4EE7,
-0X4EE9,0X4EED,0X4EEE,0X4EEF,0X4EF1,0X4EF4,0X4EF8,0X4EF9,0X4EFA,0X4EFC,0X4EFE,0X4F00,0X4F02,0X4F03,0X4F04,0X4F05,
-0X4F06,0X4F07,0X4F08,0X4F0B,0X4F0C,0X4F12,0X4F13,0X4F14,0X4F15,0X4F16,0X4F1C,0X4F1D,0X4F21,0X4F23,0X4F28,0X4F29,
-0X4F2C,0X4F2D,0X4F2E,0X4F31,0X4F33,0X4F35,0X4F37,0X4F39,0X4F3B,0X4F3E,0X4F3F,0X4F40,0X4F41,0X4F42,0X4F44,0X4F45,
-0X4F47,0X4F48,0X4F49,0X4F4A,0X4F4B,0X4F4C,0X4F52,0X4F54,0X4F56,0X4F61,0X4F62,0X4F66,0X4F68,0X4F6A,0X4F6B,0X4F6D,
-0X4F6E,0X4F71,0X4F72,0X4F75,0X4F77,0X4F78,0X4F79,0X4F7A,0X4F7D,0X4F80,0X4F81,0X4F82,0X4F85,0X4F86,0X4F87,0X4F8A,
-0X4F8C,0X4F8E,0X4F90,0X4F92,0X4F93,0X4F95,0X4F96,0X4F98,0X4F99,0X4F9A,0X4F9C,0X4F9E,0X4F9F,0X4FA1,0X4FA2,0X0001,
-0X4FA4,0X4FAB,0X4FAD,0X4FB0,0X4FB1,0X4FB2,0X4FB3,0X4FB4,0X4FB6,0X4FB7,0X4FB8,0X4FB9,0X4FBA,0X4FBB,0X4FBC,0X4FBD,
-0X4FBE,0X4FC0,0X4FC1,0X4FC2,0X4FC6,0X4FC7,0X4FC8,0X4FC9,0X4FCB,0X4FCC,0X4FCD,0X4FD2,0X4FD3,0X4FD4,0X4FD5,0X4FD6,
-0X4FD9,0X4FDB,0X4FE0,0X4FE2,0X4FE4,0X4FE5,0X4FE7,0X4FEB,0X4FEC,0X4FF0,0X4FF2,0X4FF4,0X4FF5,0X4FF6,0X4FF7,0X4FF9,
-0X4FFB,0X4FFC,0X4FFD,0X4FFF,0X5000,0X5001,0X5002,0X5003,0X5004,0X5005,0X5006,0X5007,0X5008,0X5009,0X500A,0X0001,
-0X500B,0X500E,0X5010,0X5011,0X5013,0X5015,0X5016,0X5017,0X501B,0X501D,0X501E,0X5020,0X5022,0X5023,0X5024,0X5027,
-0X502B,0X502F,0X5030,0X5031,0X5032,0X5033,0X5034,0X5035,0X5036,0X5037,0X5038,0X5039,0X503B,0X503D,0X503F,0X5040,
-0X5041,0X5042,0X5044,0X5045,0X5046,0X5049,0X504A,0X504B,0X504D,0X5050,0X5051,0X5052,0X5053,0X5054,0X5056,0X5057,
-0X5058,0X5059,0X505B,0X505D,0X505E,0X505F,0X5060,0X5061,0X5062,0X5063,0X5064,0X5066,0X5067,0X5068,0X5069,0X506A,
-0X506B,0X506D,0X506E,0X506F,0X5070,0X5071,0X5072,0X5073,0X5074,0X5075,0X5078,0X5079,0X507A,0X507C,0X507D,0X5081,
-0X5082,0X5083,0X5084,0X5086,0X5087,0X5089,0X508A,0X508B,0X508C,0X508E,0X508F,0X5090,0X5091,0X5092,0X5093,0X5094,
-0X5095,0X5096,0X5097,0X5098,0X5099,0X509A,0X509B,0X509C,0X509D,0X509E,0X509F,0X50A0,0X50A1,0X50A2,0X50A4,0X50A6,
-0X50AA,0X50AB,0X50AD,0X50AE,0X50AF,0X50B0,0X50B1,0X50B3,0X50B4,0X50B5,0X50B6,0X50B7,0X50B8,0X50B9,0X50BC,0X0001,
-0X50BD,0X50BE,0X50BF,0X50C0,0X50C1,0X50C2,0X50C3,0X50C4,0X50C5,0X50C6,0X50C7,0X50C8,0X50C9,0X50CA,0X50CB,0X50CC,
-0X50CD,0X50CE,0X50D0,0X50D1,0X50D2,0X50D3,0X50D4,0X50D5,0X50D7,0X50D8,0X50D9,0X50DB,0X50DC,0X50DD,0X50DE,0X50DF,
-0X50E0,0X50E1,0X50E2,0X50E3,0X50E4,0X50E5,0X50E8,0X50E9,0X50EA,0X50EB,0X50EF,0X50F0,0X50F1,0X50F2,0X50F4,0X50F6,
-0X50F7,0X50F8,0X50F9,0X50FA,0X50FC,0X50FD,0X50FE,0X50FF,0X5100,0X5101,0X5102,0X5103,0X5104,0X5105,0X5108,0X0001,
-0X5109,0X510A,0X510C,0X510D,0X510E,0X510F,0X5110,0X5111,0X5113,0X5114,0X5115,0X5116,0X5117,0X5118,0X5119,0X511A,
-0X511B,0X511C,0X511D,0X511E,0X511F,0X5120,0X5122,0X5123,0X5124,0X5125,0X5126,0X5127,0X5128,0X5129,0X512A,0X512B,
-0X512C,0X512D,0X512E,0X512F,0X5130,0X5131,0X5132,0X5133,0X5134,0X5135,0X5136,0X5137,0X5138,0X5139,0X513A,0X513B,
-0X513C,0X513D,0X513E,0X5142,0X5147,0X514A,0X514C,0X514E,0X514F,0X5150,0X5152,0X5153,0X5157,0X5158,0X5159,0X515B,
-0X515D,0X515E,0X515F,0X5160,0X5161,0X5163,0X5164,0X5166,0X5167,0X5169,0X516A,0X516F,0X5172,0X517A,0X517E,0X517F,
-0X5183,0X5184,0X5186,0X5187,0X518A,0X518B,0X518E,0X518F,0X5190,0X5191,0X5193,0X5194,0X5198,0X519A,0X519D,0X519E,
-0X519F,0X51A1,0X51A3,0X51A6,0X51A7,0X51A8,0X51A9,0X51AA,0X51AD,0X51AE,0X51B4,0X51B8,0X51B9,0X51BA,0X51BE,0X51BF,
-0X51C1,0X51C2,0X51C3,0X51C5,0X51C8,0X51CA,0X51CD,0X51CE,0X51D0,0X51D2,0X51D3,0X51D4,0X51D5,0X51D6,0X51D7,0X0001,
-0X51D8,0X51D9,0X51DA,0X51DC,0X51DE,0X51DF,0X51E2,0X51E3,0X51E5,0X51E6,0X51E7,0X51E8,0X51E9,0X51EA,0X51EC,0X51EE,
-0X51F1,0X51F2,0X51F4,0X51F7,0X51FE,0X5204,0X5205,0X5209,0X520B,0X520C,0X520F,0X5210,0X5213,0X5214,0X5215,0X521C,
-0X521E,0X521F,0X5221,0X5222,0X5223,0X5225,0X5226,0X5227,0X522A,0X522C,0X522F,0X5231,0X5232,0X5234,0X5235,0X523C,
-0X523E,0X5244,0X5245,0X5246,0X5247,0X5248,0X5249,0X524B,0X524E,0X524F,0X5252,0X5253,0X5255,0X5257,0X5258,0X0001,
-0X5259,0X525A,0X525B,0X525D,0X525F,0X5260,0X5262,0X5263,0X5264,0X5266,0X5268,0X526B,0X526C,0X526D,0X526E,0X5270,
-0X5271,0X5273,0X5274,0X5275,0X5276,0X5277,0X5278,0X5279,0X527A,0X527B,0X527C,0X527E,0X5280,0X5283,0X5284,0X5285,
-0X5286,0X5287,0X5289,0X528A,0X528B,0X528C,0X528D,0X528E,0X528F,0X5291,0X5292,0X5294,0X5295,0X5296,0X5297,0X5298,
-0X5299,0X529A,0X529C,0X52A4,0X52A5,0X52A6,0X52A7,0X52AE,0X52AF,0X52B0,0X52B4,0X52B5,0X52B6,0X52B7,0X52B8,0X52B9,
-0X52BA,0X52BB,0X52BC,0X52BD,0X52C0,0X52C1,0X52C2,0X52C4,0X52C5,0X52C6,0X52C8,0X52CA,0X52CC,0X52CD,0X52CE,0X52CF,
-0X52D1,0X52D3,0X52D4,0X52D5,0X52D7,0X52D9,0X52DA,0X52DB,0X52DC,0X52DD,0X52DE,0X52E0,0X52E1,0X52E2,0X52E3,0X52E5,
-0X52E6,0X52E7,0X52E8,0X52E9,0X52EA,0X52EB,0X52EC,0X52ED,0X52EE,0X52EF,0X52F1,0X52F2,0X52F3,0X52F4,0X52F5,0X52F6,
-0X52F7,0X52F8,0X52FB,0X52FC,0X52FD,0X5301,0X5302,0X5303,0X5304,0X5307,0X5309,0X530A,0X530B,0X530C,0X530E,0X0001,
-0X5311,0X5312,0X5313,0X5314,0X5318,0X531B,0X531C,0X531E,0X531F,0X5322,0X5324,0X5325,0X5327,0X5328,0X5329,0X532B,
-0X532C,0X532D,0X532F,0X5330,0X5331,0X5332,0X5333,0X5334,0X5335,0X5336,0X5337,0X5338,0X533C,0X533D,0X5340,0X5342,
-0X5344,0X5346,0X534B,0X534C,0X534D,0X5350,0X5354,0X5358,0X5359,0X535B,0X535D,0X5365,0X5368,0X536A,0X536C,0X536D,
-0X5372,0X5376,0X5379,0X537B,0X537C,0X537D,0X537E,0X5380,0X5381,0X5383,0X5387,0X5388,0X538A,0X538E,0X538F,0X0001,
-0X5390,0X5391,0X5392,0X5393,0X5394,0X5396,0X5397,0X5399,0X539B,0X539C,0X539E,0X53A0,0X53A1,0X53A4,0X53A7,0X53AA,
-0X53AB,0X53AC,0X53AD,0X53AF,0X53B0,0X53B1,0X53B2,0X53B3,0X53B4,0X53B5,0X53B7,0X53B8,0X53B9,0X53BA,0X53BC,0X53BD,
-0X53BE,0X53C0,0X53C3,0X53C4,0X53C5,0X53C6,0X53C7,0X53CE,0X53CF,0X53D0,0X53D2,0X53D3,0X53D5,0X53DA,0X53DC,0X53DD,
-0X53DE,0X53E1,0X53E2,0X53E7,0X53F4,0X53FA,0X53FE,0X53FF,0X5400,0X5402,0X5405,0X5407,0X540B,0X5414,0X5418,0X5419,
-0X541A,0X541C,0X5422,0X5424,0X5425,0X542A,0X5430,0X5433,0X5436,0X5437,0X543A,0X543D,0X543F,0X5441,0X5442,0X5444,
-0X5445,0X5447,0X5449,0X544C,0X544D,0X544E,0X544F,0X5451,0X545A,0X545D,0X545E,0X545F,0X5460,0X5461,0X5463,0X5465,
-0X5467,0X5469,0X546A,0X546B,0X546C,0X546D,0X546E,0X546F,0X5470,0X5474,0X5479,0X547A,0X547E,0X547F,0X5481,0X5483,
-0X5485,0X5487,0X5488,0X5489,0X548A,0X548D,0X5491,0X5493,0X5497,0X5498,0X549C,0X549E,0X549F,0X54A0,0X54A1,0X0001,
-0X54A2,0X54A5,0X54AE,0X54B0,0X54B2,0X54B5,0X54B6,0X54B7,0X54B9,0X54BA,0X54BC,0X54BE,0X54C3,0X54C5,0X54CA,0X54CB,
-0X54D6,0X54D8,0X54DB,0X54E0,0X54E1,0X54E2,0X54E3,0X54E4,0X54EB,0X54EC,0X54EF,0X54F0,0X54F1,0X54F4,0X54F5,0X54F6,
-0X54F7,0X54F8,0X54F9,0X54FB,0X54FE,0X5500,0X5502,0X5503,0X5504,0X5505,0X5508,0X550A,0X550B,0X550C,0X550D,0X550E,
-0X5512,0X5513,0X5515,0X5516,0X5517,0X5518,0X5519,0X551A,0X551C,0X551D,0X551E,0X551F,0X5521,0X5525,0X5526,0X0001,
-0X5528,0X5529,0X552B,0X552D,0X5532,0X5534,0X5535,0X5536,0X5538,0X5539,0X553A,0X553B,0X553D,0X5540,0X5542,0X5545,
-0X5547,0X5548,0X554B,0X554C,0X554D,0X554E,0X554F,0X5551,0X5552,0X5553,0X5554,0X5557,0X5558,0X5559,0X555A,0X555B,
-0X555D,0X555E,0X555F,0X5560,0X5562,0X5563,0X5568,0X5569,0X556B,0X556F,0X5570,0X5571,0X5572,0X5573,0X5574,0X5579,
-0X557A,0X557D,0X557F,0X5585,0X5586,0X558C,0X558D,0X558E,0X5590,0X5592,0X5593,0X5595,0X5596,0X5597,0X559A,0X559B,
-0X559E,0X55A0,0X55A1,0X55A2,0X55A3,0X55A4,0X55A5,0X55A6,0X55A8,0X55A9,0X55AA,0X55AB,0X55AC,0X55AD,0X55AE,0X55AF,
-0X55B0,0X55B2,0X55B4,0X55B6,0X55B8,0X55BA,0X55BC,0X55BF,0X55C0,0X55C1,0X55C2,0X55C3,0X55C6,0X55C7,0X55C8,0X55CA,
-0X55CB,0X55CE,0X55CF,0X55D0,0X55D5,0X55D7,0X55D8,0X55D9,0X55DA,0X55DB,0X55DE,0X55E0,0X55E2,0X55E7,0X55E9,0X55ED,
-0X55EE,0X55F0,0X55F1,0X55F4,0X55F6,0X55F8,0X55F9,0X55FA,0X55FB,0X55FC,0X55FF,0X5602,0X5603,0X5604,0X5605,0X0001,
-0X5606,0X5607,0X560A,0X560B,0X560D,0X5610,0X5611,0X5612,0X5613,0X5614,0X5615,0X5616,0X5617,0X5619,0X561A,0X561C,
-0X561D,0X5620,0X5621,0X5622,0X5625,0X5626,0X5628,0X5629,0X562A,0X562B,0X562E,0X562F,0X5630,0X5633,0X5635,0X5637,
-0X5638,0X563A,0X563C,0X563D,0X563E,0X5640,0X5641,0X5642,0X5643,0X5644,0X5645,0X5646,0X5647,0X5648,0X5649,0X564A,
-0X564B,0X564F,0X5650,0X5651,0X5652,0X5653,0X5655,0X5656,0X565A,0X565B,0X565D,0X565E,0X565F,0X5660,0X5661,0X0001,
-0X5663,0X5665,0X5666,0X5667,0X566D,0X566E,0X566F,0X5670,0X5672,0X5673,0X5674,0X5675,0X5677,0X5678,0X5679,0X567A,
-0X567D,0X567E,0X567F,0X5680,0X5681,0X5682,0X5683,0X5684,0X5687,0X5688,0X5689,0X568A,0X568B,0X568C,0X568D,0X5690,
-0X5691,0X5692,0X5694,0X5695,0X5696,0X5697,0X5698,0X5699,0X569A,0X569B,0X569C,0X569D,0X569E,0X569F,0X56A0,0X56A1,
-0X56A2,0X56A4,0X56A5,0X56A6,0X56A7,0X56A8,0X56A9,0X56AA,0X56AB,0X56AC,0X56AD,0X56AE,0X56B0,0X56B1,0X56B2,0X56B3,
-0X56B4,0X56B5,0X56B6,0X56B8,0X56B9,0X56BA,0X56BB,0X56BD,0X56BE,0X56BF,0X56C0,0X56C1,0X56C2,0X56C3,0X56C4,0X56C5,
-0X56C6,0X56C7,0X56C8,0X56C9,0X56CB,0X56CC,0X56CD,0X56CE,0X56CF,0X56D0,0X56D1,0X56D2,0X56D3,0X56D5,0X56D6,0X56D8,
-0X56D9,0X56DC,0X56E3,0X56E5,0X56E6,0X56E7,0X56E8,0X56E9,0X56EA,0X56EC,0X56EE,0X56EF,0X56F2,0X56F3,0X56F6,0X56F7,
-0X56F8,0X56FB,0X56FC,0X5700,0X5701,0X5702,0X5705,0X5707,0X570B,0X570C,0X570D,0X570E,0X570F,0X5710,0X5711,0X0001,
-0X5712,0X5713,0X5714,0X5715,0X5716,0X5717,0X5718,0X5719,0X571A,0X571B,0X571D,0X571E,0X5720,0X5721,0X5722,0X5724,
-0X5725,0X5726,0X5727,0X572B,0X5731,0X5732,0X5734,0X5735,0X5736,0X5737,0X5738,0X573C,0X573D,0X573F,0X5741,0X5743,
-0X5744,0X5745,0X5746,0X5748,0X5749,0X574B,0X5752,0X5753,0X5754,0X5755,0X5756,0X5758,0X5759,0X5762,0X5763,0X5765,
-0X5767,0X576C,0X576E,0X5770,0X5771,0X5772,0X5774,0X5775,0X5778,0X5779,0X577A,0X577D,0X577E,0X577F,0X5780,0X0001,
-0X5781,0X5787,0X5788,0X5789,0X578A,0X578D,0X578E,0X578F,0X5790,0X5791,0X5794,0X5795,0X5796,0X5797,0X5798,0X5799,
-0X579A,0X579C,0X579D,0X579E,0X579F,0X57A5,0X57A8,0X57AA,0X57AC,0X57AF,0X57B0,0X57B1,0X57B3,0X57B5,0X57B6,0X57B7,
-0X57B9,0X57BA,0X57BB,0X57BC,0X57BD,0X57BE,0X57BF,0X57C0,0X57C1,0X57C4,0X57C5,0X57C6,0X57C7,0X57C8,0X57C9,0X57CA,
-0X57CC,0X57CD,0X57D0,0X57D1,0X57D3,0X57D6,0X57D7,0X57DB,0X57DC,0X57DE,0X57E1,0X57E2,0X57E3,0X57E5,0X57E6,0X57E7,
-0X57E8,0X57E9,0X57EA,0X57EB,0X57EC,0X57EE,0X57F0,0X57F1,0X57F2,0X57F3,0X57F5,0X57F6,0X57F7,0X57FB,0X57FC,0X57FE,
-0X57FF,0X5801,0X5803,0X5804,0X5805,0X5808,0X5809,0X580A,0X580C,0X580E,0X580F,0X5810,0X5812,0X5813,0X5814,0X5816,
-0X5817,0X5818,0X581A,0X581B,0X581C,0X581D,0X581F,0X5822,0X5823,0X5825,0X5826,0X5827,0X5828,0X5829,0X582B,0X582C,
-0X582D,0X582E,0X582F,0X5831,0X5832,0X5833,0X5834,0X5836,0X5837,0X5838,0X5839,0X583A,0X583B,0X583C,0X583D,0X0001,
-0X583E,0X583F,0X5840,0X5841,0X5842,0X5843,0X5845,0X5846,0X5847,0X5848,0X5849,0X584A,0X584B,0X584E,0X584F,0X5850,
-0X5852,0X5853,0X5855,0X5856,0X5857,0X5859,0X585A,0X585B,0X585C,0X585D,0X585F,0X5860,0X5861,0X5862,0X5863,0X5864,
-0X5866,0X5867,0X5868,0X5869,0X586A,0X586D,0X586E,0X586F,0X5870,0X5871,0X5872,0X5873,0X5874,0X5875,0X5876,0X5877,
-0X5878,0X5879,0X587A,0X587B,0X587C,0X587D,0X587F,0X5882,0X5884,0X5886,0X5887,0X5888,0X588A,0X588B,0X588C,0X0001,
-0X588D,0X588E,0X588F,0X5890,0X5891,0X5894,0X5895,0X5896,0X5897,0X5898,0X589B,0X589C,0X589D,0X58A0,0X58A1,0X58A2,
-0X58A3,0X58A4,0X58A5,0X58A6,0X58A7,0X58AA,0X58AB,0X58AC,0X58AD,0X58AE,0X58AF,0X58B0,0X58B1,0X58B2,0X58B3,0X58B4,
-0X58B5,0X58B6,0X58B7,0X58B8,0X58B9,0X58BA,0X58BB,0X58BD,0X58BE,0X58BF,0X58C0,0X58C2,0X58C3,0X58C4,0X58C6,0X58C7,
-0X58C8,0X58C9,0X58CA,0X58CB,0X58CC,0X58CD,0X58CE,0X58CF,0X58D0,0X58D2,0X58D3,0X58D4,0X58D6,0X58D7,0X58D8,0X58D9,
-0X58DA,0X58DB,0X58DC,0X58DD,0X58DE,0X58DF,0X58E0,0X58E1,0X58E2,0X58E3,0X58E5,0X58E6,0X58E7,0X58E8,0X58E9,0X58EA,
-0X58ED,0X58EF,0X58F1,0X58F2,0X58F4,0X58F5,0X58F7,0X58F8,0X58FA,0X58FB,0X58FC,0X58FD,0X58FE,0X58FF,0X5900,0X5901,
-0X5903,0X5905,0X5906,0X5908,0X5909,0X590A,0X590B,0X590C,0X590E,0X5910,0X5911,0X5912,0X5913,0X5917,0X5918,0X591B,
-0X591D,0X591E,0X5920,0X5921,0X5922,0X5923,0X5926,0X5928,0X592C,0X5930,0X5932,0X5933,0X5935,0X5936,0X593B,0X0001,
-0X593D,0X593E,0X593F,0X5940,0X5943,0X5945,0X5946,0X594A,0X594C,0X594D,0X5950,0X5952,0X5953,0X5959,0X595B,0X595C,
-0X595D,0X595E,0X595F,0X5961,0X5963,0X5964,0X5966,0X5967,0X5968,0X5969,0X596A,0X596B,0X596C,0X596D,0X596E,0X596F,
-0X5970,0X5971,0X5972,0X5975,0X5977,0X597A,0X597B,0X597C,0X597E,0X597F,0X5980,0X5985,0X5989,0X598B,0X598C,0X598E,
-0X598F,0X5990,0X5991,0X5994,0X5995,0X5998,0X599A,0X599B,0X599C,0X599D,0X599F,0X59A0,0X59A1,0X59A2,0X59A6,0X0001,
-0X59A7,0X59AC,0X59AD,0X59B0,0X59B1,0X59B3,0X59B4,0X59B5,0X59B6,0X59B7,0X59B8,0X59BA,0X59BC,0X59BD,0X59BF,0X59C0,
-0X59C1,0X59C2,0X59C3,0X59C4,0X59C5,0X59C7,0X59C8,0X59C9,0X59CC,0X59CD,0X59CE,0X59CF,0X59D5,0X59D6,0X59D9,0X59DB,
-0X59DE,0X59DF,0X59E0,0X59E1,0X59E2,0X59E4,0X59E6,0X59E7,0X59E9,0X59EA,0X59EB,0X59ED,0X59EE,0X59EF,0X59F0,0X59F1,
-0X59F2,0X59F3,0X59F4,0X59F5,0X59F6,0X59F7,0X59F8,0X59FA,0X59FC,0X59FD,0X59FE,0X5A00,0X5A02,0X5A0A,0X5A0B,0X5A0D,
-0X5A0E,0X5A0F,0X5A10,0X5A12,0X5A14,0X5A15,0X5A16,0X5A17,0X5A19,0X5A1A,0X5A1B,0X5A1D,0X5A1E,0X5A21,0X5A22,0X5A24,
-0X5A26,0X5A27,0X5A28,0X5A2A,0X5A2B,0X5A2C,0X5A2D,0X5A2E,0X5A2F,0X5A30,0X5A33,0X5A35,0X5A37,0X5A38,0X5A39,0X5A3A,
-0X5A3B,0X5A3D,0X5A3E,0X5A3F,0X5A41,0X5A42,0X5A43,0X5A44,0X5A45,0X5A47,0X5A48,0X5A4B,0X5A4C,0X5A4D,0X5A4E,0X5A4F,
-0X5A50,0X5A51,0X5A52,0X5A53,0X5A54,0X5A56,0X5A57,0X5A58,0X5A59,0X5A5B,0X5A5C,0X5A5D,0X5A5E,0X5A5F,0X5A60,0X0001,
-0X5A61,0X5A63,0X5A64,0X5A65,0X5A66,0X5A68,0X5A69,0X5A6B,0X5A6C,0X5A6D,0X5A6E,0X5A6F,0X5A70,0X5A71,0X5A72,0X5A73,
-0X5A78,0X5A79,0X5A7B,0X5A7C,0X5A7D,0X5A7E,0X5A80,0X5A81,0X5A82,0X5A83,0X5A84,0X5A85,0X5A86,0X5A87,0X5A88,0X5A89,
-0X5A8A,0X5A8B,0X5A8C,0X5A8D,0X5A8E,0X5A8F,0X5A90,0X5A91,0X5A93,0X5A94,0X5A95,0X5A96,0X5A97,0X5A98,0X5A99,0X5A9C,
-0X5A9D,0X5A9E,0X5A9F,0X5AA0,0X5AA1,0X5AA2,0X5AA3,0X5AA4,0X5AA5,0X5AA6,0X5AA7,0X5AA8,0X5AA9,0X5AAB,0X5AAC,0X0001,
-0X5AAD,0X5AAE,0X5AAF,0X5AB0,0X5AB1,0X5AB4,0X5AB6,0X5AB7,0X5AB9,0X5ABA,0X5ABB,0X5ABC,0X5ABD,0X5ABF,0X5AC0,0X5AC3,
-0X5AC4,0X5AC5,0X5AC6,0X5AC7,0X5AC8,0X5ACA,0X5ACB,0X5ACD,0X5ACE,0X5ACF,0X5AD0,0X5AD1,0X5AD3,0X5AD5,0X5AD7,0X5AD9,
-0X5ADA,0X5ADB,0X5ADD,0X5ADE,0X5ADF,0X5AE2,0X5AE4,0X5AE5,0X5AE7,0X5AE8,0X5AEA,0X5AEC,0X5AED,0X5AEE,0X5AEF,0X5AF0,
-0X5AF2,0X5AF3,0X5AF4,0X5AF5,0X5AF6,0X5AF7,0X5AF8,0X5AF9,0X5AFA,0X5AFB,0X5AFC,0X5AFD,0X5AFE,0X5AFF,0X5B00,0X5B01,
-0X5B02,0X5B03,0X5B04,0X5B05,0X5B06,0X5B07,0X5B08,0X5B0A,0X5B0B,0X5B0C,0X5B0D,0X5B0E,0X5B0F,0X5B10,0X5B11,0X5B12,
-0X5B13,0X5B14,0X5B15,0X5B18,0X5B19,0X5B1A,0X5B1B,0X5B1C,0X5B1D,0X5B1E,0X5B1F,0X5B20,0X5B21,0X5B22,0X5B23,0X5B24,
-0X5B25,0X5B26,0X5B27,0X5B28,0X5B29,0X5B2A,0X5B2B,0X5B2C,0X5B2D,0X5B2E,0X5B2F,0X5B30,0X5B31,0X5B33,0X5B35,0X5B36,
-0X5B38,0X5B39,0X5B3A,0X5B3B,0X5B3C,0X5B3D,0X5B3E,0X5B3F,0X5B41,0X5B42,0X5B43,0X5B44,0X5B45,0X5B46,0X5B47,0X0001,
-0X5B48,0X5B49,0X5B4A,0X5B4B,0X5B4C,0X5B4D,0X5B4E,0X5B4F,0X5B52,0X5B56,0X5B5E,0X5B60,0X5B61,0X5B67,0X5B68,0X5B6B,
-0X5B6D,0X5B6E,0X5B6F,0X5B72,0X5B74,0X5B76,0X5B77,0X5B78,0X5B79,0X5B7B,0X5B7C,0X5B7E,0X5B7F,0X5B82,0X5B86,0X5B8A,
-0X5B8D,0X5B8E,0X5B90,0X5B91,0X5B92,0X5B94,0X5B96,0X5B9F,0X5BA7,0X5BA8,0X5BA9,0X5BAC,0X5BAD,0X5BAE,0X5BAF,0X5BB1,
-0X5BB2,0X5BB7,0X5BBA,0X5BBB,0X5BBC,0X5BC0,0X5BC1,0X5BC3,0X5BC8,0X5BC9,0X5BCA,0X5BCB,0X5BCD,0X5BCE,0X5BCF,0X0001,
-0X5BD1,0X5BD4,0X5BD5,0X5BD6,0X5BD7,0X5BD8,0X5BD9,0X5BDA,0X5BDB,0X5BDC,0X5BE0,0X5BE2,0X5BE3,0X5BE6,0X5BE7,0X5BE9,
-0X5BEA,0X5BEB,0X5BEC,0X5BED,0X5BEF,0X5BF1,0X5BF2,0X5BF3,0X5BF4,0X5BF5,0X5BF6,0X5BF7,0X5BFD,0X5BFE,0X5C00,0X5C02,
-0X5C03,0X5C05,0X5C07,0X5C08,0X5C0B,0X5C0C,0X5C0D,0X5C0E,0X5C10,0X5C12,0X5C13,0X5C17,0X5C19,0X5C1B,0X5C1E,0X5C1F,
-0X5C20,0X5C21,0X5C23,0X5C26,0X5C28,0X5C29,0X5C2A,0X5C2B,0X5C2D,0X5C2E,0X5C2F,0X5C30,0X5C32,0X5C33,0X5C35,0X5C36,
-0X5C37,0X5C43,0X5C44,0X5C46,0X5C47,0X5C4C,0X5C4D,0X5C52,0X5C53,0X5C54,0X5C56,0X5C57,0X5C58,0X5C5A,0X5C5B,0X5C5C,
-0X5C5D,0X5C5F,0X5C62,0X5C64,0X5C67,0X5C68,0X5C69,0X5C6A,0X5C6B,0X5C6C,0X5C6D,0X5C70,0X5C72,0X5C73,0X5C74,0X5C75,
-0X5C76,0X5C77,0X5C78,0X5C7B,0X5C7C,0X5C7D,0X5C7E,0X5C80,0X5C83,0X5C84,0X5C85,0X5C86,0X5C87,0X5C89,0X5C8A,0X5C8B,
-0X5C8E,0X5C8F,0X5C92,0X5C93,0X5C95,0X5C9D,0X5C9E,0X5C9F,0X5CA0,0X5CA1,0X5CA4,0X5CA5,0X5CA6,0X5CA7,0X5CA8,0X0001,
-0X5CAA,0X5CAE,0X5CAF,0X5CB0,0X5CB2,0X5CB4,0X5CB6,0X5CB9,0X5CBA,0X5CBB,0X5CBC,0X5CBE,0X5CC0,0X5CC2,0X5CC3,0X5CC5,
-0X5CC6,0X5CC7,0X5CC8,0X5CC9,0X5CCA,0X5CCC,0X5CCD,0X5CCE,0X5CCF,0X5CD0,0X5CD1,0X5CD3,0X5CD4,0X5CD5,0X5CD6,0X5CD7,
-0X5CD8,0X5CDA,0X5CDB,0X5CDC,0X5CDD,0X5CDE,0X5CDF,0X5CE0,0X5CE2,0X5CE3,0X5CE7,0X5CE9,0X5CEB,0X5CEC,0X5CEE,0X5CEF,
-0X5CF1,0X5CF2,0X5CF3,0X5CF4,0X5CF5,0X5CF6,0X5CF7,0X5CF8,0X5CF9,0X5CFA,0X5CFC,0X5CFD,0X5CFE,0X5CFF,0X5D00,0X0001,
-0X5D01,0X5D04,0X5D05,0X5D08,0X5D09,0X5D0A,0X5D0B,0X5D0C,0X5D0D,0X5D0F,0X5D10,0X5D11,0X5D12,0X5D13,0X5D15,0X5D17,
-0X5D18,0X5D19,0X5D1A,0X5D1C,0X5D1D,0X5D1F,0X5D20,0X5D21,0X5D22,0X5D23,0X5D25,0X5D28,0X5D2A,0X5D2B,0X5D2C,0X5D2F,
-0X5D30,0X5D31,0X5D32,0X5D33,0X5D35,0X5D36,0X5D37,0X5D38,0X5D39,0X5D3A,0X5D3B,0X5D3C,0X5D3F,0X5D40,0X5D41,0X5D42,
-0X5D43,0X5D44,0X5D45,0X5D46,0X5D48,0X5D49,0X5D4D,0X5D4E,0X5D4F,0X5D50,0X5D51,0X5D52,0X5D53,0X5D54,0X5D55,0X5D56,
-0X5D57,0X5D59,0X5D5A,0X5D5C,0X5D5E,0X5D5F,0X5D60,0X5D61,0X5D62,0X5D63,0X5D64,0X5D65,0X5D66,0X5D67,0X5D68,0X5D6A,
-0X5D6D,0X5D6E,0X5D70,0X5D71,0X5D72,0X5D73,0X5D75,0X5D76,0X5D77,0X5D78,0X5D79,0X5D7A,0X5D7B,0X5D7C,0X5D7D,0X5D7E,
-0X5D7F,0X5D80,0X5D81,0X5D83,0X5D84,0X5D85,0X5D86,0X5D87,0X5D88,0X5D89,0X5D8A,0X5D8B,0X5D8C,0X5D8D,0X5D8E,0X5D8F,
-0X5D90,0X5D91,0X5D92,0X5D93,0X5D94,0X5D95,0X5D96,0X5D97,0X5D98,0X5D9A,0X5D9B,0X5D9C,0X5D9E,0X5D9F,0X5DA0,0X0001,
-0X5DA1,0X5DA2,0X5DA3,0X5DA4,0X5DA5,0X5DA6,0X5DA7,0X5DA8,0X5DA9,0X5DAA,0X5DAB,0X5DAC,0X5DAD,0X5DAE,0X5DAF,0X5DB0,
-0X5DB1,0X5DB2,0X5DB3,0X5DB4,0X5DB5,0X5DB6,0X5DB8,0X5DB9,0X5DBA,0X5DBB,0X5DBC,0X5DBD,0X5DBE,0X5DBF,0X5DC0,0X5DC1,
-0X5DC2,0X5DC3,0X5DC4,0X5DC6,0X5DC7,0X5DC8,0X5DC9,0X5DCA,0X5DCB,0X5DCC,0X5DCE,0X5DCF,0X5DD0,0X5DD1,0X5DD2,0X5DD3,
-0X5DD4,0X5DD5,0X5DD6,0X5DD7,0X5DD8,0X5DD9,0X5DDA,0X5DDC,0X5DDF,0X5DE0,0X5DE3,0X5DE4,0X5DEA,0X5DEC,0X5DED,0X0001,
-0X5DF0,0X5DF5,0X5DF6,0X5DF8,0X5DF9,0X5DFA,0X5DFB,0X5DFC,0X5DFF,0X5E00,0X5E04,0X5E07,0X5E09,0X5E0A,0X5E0B,0X5E0D,
-0X5E0E,0X5E12,0X5E13,0X5E17,0X5E1E,0X5E1F,0X5E20,0X5E21,0X5E22,0X5E23,0X5E24,0X5E25,0X5E28,0X5E29,0X5E2A,0X5E2B,
-0X5E2C,0X5E2F,0X5E30,0X5E32,0X5E33,0X5E34,0X5E35,0X5E36,0X5E39,0X5E3A,0X5E3E,0X5E3F,0X5E40,0X5E41,0X5E43,0X5E46,
-0X5E47,0X5E48,0X5E49,0X5E4A,0X5E4B,0X5E4D,0X5E4E,0X5E4F,0X5E50,0X5E51,0X5E52,0X5E53,0X5E56,0X5E57,0X5E58,0X5E59,
-0X5E5A,0X5E5C,0X5E5D,0X5E5F,0X5E60,0X5E63,0X5E64,0X5E65,0X5E66,0X5E67,0X5E68,0X5E69,0X5E6A,0X5E6B,0X5E6C,0X5E6D,
-0X5E6E,0X5E6F,0X5E70,0X5E71,0X5E75,0X5E77,0X5E79,0X5E7E,0X5E81,0X5E82,0X5E83,0X5E85,0X5E88,0X5E89,0X5E8C,0X5E8D,
-0X5E8E,0X5E92,0X5E98,0X5E9B,0X5E9D,0X5EA1,0X5EA2,0X5EA3,0X5EA4,0X5EA8,0X5EA9,0X5EAA,0X5EAB,0X5EAC,0X5EAE,0X5EAF,
-0X5EB0,0X5EB1,0X5EB2,0X5EB4,0X5EBA,0X5EBB,0X5EBC,0X5EBD,0X5EBF,0X5EC0,0X5EC1,0X5EC2,0X5EC3,0X5EC4,0X5EC5,0X0001,
-0X5EC6,0X5EC7,0X5EC8,0X5ECB,0X5ECC,0X5ECD,0X5ECE,0X5ECF,0X5ED0,0X5ED4,0X5ED5,0X5ED7,0X5ED8,0X5ED9,0X5EDA,0X5EDC,
-0X5EDD,0X5EDE,0X5EDF,0X5EE0,0X5EE1,0X5EE2,0X5EE3,0X5EE4,0X5EE5,0X5EE6,0X5EE7,0X5EE9,0X5EEB,0X5EEC,0X5EED,0X5EEE,
-0X5EEF,0X5EF0,0X5EF1,0X5EF2,0X5EF3,0X5EF5,0X5EF8,0X5EF9,0X5EFB,0X5EFC,0X5EFD,0X5F05,0X5F06,0X5F07,0X5F09,0X5F0C,
-0X5F0D,0X5F0E,0X5F10,0X5F12,0X5F14,0X5F16,0X5F19,0X5F1A,0X5F1C,0X5F1D,0X5F1E,0X5F21,0X5F22,0X5F23,0X5F24,0X0001,
-0X5F28,0X5F2B,0X5F2C,0X5F2E,0X5F30,0X5F32,0X5F33,0X5F34,0X5F35,0X5F36,0X5F37,0X5F38,0X5F3B,0X5F3D,0X5F3E,0X5F3F,
-0X5F41,0X5F42,0X5F43,0X5F44,0X5F45,0X5F46,0X5F47,0X5F48,0X5F49,0X5F4A,0X5F4B,0X5F4C,0X5F4D,0X5F4E,0X5F4F,0X5F51,
-0X5F54,0X5F59,0X5F5A,0X5F5B,0X5F5C,0X5F5E,0X5F5F,0X5F60,0X5F63,0X5F65,0X5F67,0X5F68,0X5F6B,0X5F6E,0X5F6F,0X5F72,
-0X5F74,0X5F75,0X5F76,0X5F78,0X5F7A,0X5F7D,0X5F7E,0X5F7F,0X5F83,0X5F86,0X5F8D,0X5F8E,0X5F8F,0X5F91,0X5F93,0X5F94,
-0X5F96,0X5F9A,0X5F9B,0X5F9D,0X5F9E,0X5F9F,0X5FA0,0X5FA2,0X5FA3,0X5FA4,0X5FA5,0X5FA6,0X5FA7,0X5FA9,0X5FAB,0X5FAC,
-0X5FAF,0X5FB0,0X5FB1,0X5FB2,0X5FB3,0X5FB4,0X5FB6,0X5FB8,0X5FB9,0X5FBA,0X5FBB,0X5FBE,0X5FBF,0X5FC0,0X5FC1,0X5FC2,
-0X5FC7,0X5FC8,0X5FCA,0X5FCB,0X5FCE,0X5FD3,0X5FD4,0X5FD5,0X5FDA,0X5FDB,0X5FDC,0X5FDE,0X5FDF,0X5FE2,0X5FE3,0X5FE5,
-0X5FE6,0X5FE8,0X5FE9,0X5FEC,0X5FEF,0X5FF0,0X5FF2,0X5FF3,0X5FF4,0X5FF6,0X5FF7,0X5FF9,0X5FFA,0X5FFC,0X6007,0X0001,
-0X6008,0X6009,0X600B,0X600C,0X6010,0X6011,0X6013,0X6017,0X6018,0X601A,0X601E,0X601F,0X6022,0X6023,0X6024,0X602C,
-0X602D,0X602E,0X6030,0X6031,0X6032,0X6033,0X6034,0X6036,0X6037,0X6038,0X6039,0X603A,0X603D,0X603E,0X6040,0X6044,
-0X6045,0X6046,0X6047,0X6048,0X6049,0X604A,0X604C,0X604E,0X604F,0X6051,0X6053,0X6054,0X6056,0X6057,0X6058,0X605B,
-0X605C,0X605E,0X605F,0X6060,0X6061,0X6065,0X6066,0X606E,0X6071,0X6072,0X6074,0X6075,0X6077,0X607E,0X6080,0X0001,
-0X6081,0X6082,0X6085,0X6086,0X6087,0X6088,0X608A,0X608B,0X608E,0X608F,0X6090,0X6091,0X6093,0X6095,0X6097,0X6098,
-0X6099,0X609C,0X609E,0X60A1,0X60A2,0X60A4,0X60A5,0X60A7,0X60A9,0X60AA,0X60AE,0X60B0,0X60B3,0X60B5,0X60B6,0X60B7,
-0X60B9,0X60BA,0X60BD,0X60BE,0X60BF,0X60C0,0X60C1,0X60C2,0X60C3,0X60C4,0X60C7,0X60C8,0X60C9,0X60CC,0X60CD,0X60CE,
-0X60CF,0X60D0,0X60D2,0X60D3,0X60D4,0X60D6,0X60D7,0X60D9,0X60DB,0X60DE,0X60E1,0X60E2,0X60E3,0X60E4,0X60E5,0X60EA,
-0X60F1,0X60F2,0X60F5,0X60F7,0X60F8,0X60FB,0X60FC,0X60FD,0X60FE,0X60FF,0X6102,0X6103,0X6104,0X6105,0X6107,0X610A,
-0X610B,0X610C,0X6110,0X6111,0X6112,0X6113,0X6114,0X6116,0X6117,0X6118,0X6119,0X611B,0X611C,0X611D,0X611E,0X6121,
-0X6122,0X6125,0X6128,0X6129,0X612A,0X612C,0X612D,0X612E,0X612F,0X6130,0X6131,0X6132,0X6133,0X6134,0X6135,0X6136,
-0X6137,0X6138,0X6139,0X613A,0X613B,0X613C,0X613D,0X613E,0X6140,0X6141,0X6142,0X6143,0X6144,0X6145,0X6146,0X0001,
-0X6147,0X6149,0X614B,0X614D,0X614F,0X6150,0X6152,0X6153,0X6154,0X6156,0X6157,0X6158,0X6159,0X615A,0X615B,0X615C,
-0X615E,0X615F,0X6160,0X6161,0X6163,0X6164,0X6165,0X6166,0X6169,0X616A,0X616B,0X616C,0X616D,0X616E,0X616F,0X6171,
-0X6172,0X6173,0X6174,0X6176,0X6178,0X6179,0X617A,0X617B,0X617C,0X617D,0X617E,0X617F,0X6180,0X6181,0X6182,0X6183,
-0X6184,0X6185,0X6186,0X6187,0X6188,0X6189,0X618A,0X618C,0X618D,0X618F,0X6190,0X6191,0X6192,0X6193,0X6195,0X0001,
-0X6196,0X6197,0X6198,0X6199,0X619A,0X619B,0X619C,0X619E,0X619F,0X61A0,0X61A1,0X61A2,0X61A3,0X61A4,0X61A5,0X61A6,
-0X61AA,0X61AB,0X61AD,0X61AE,0X61AF,0X61B0,0X61B1,0X61B2,0X61B3,0X61B4,0X61B5,0X61B6,0X61B8,0X61B9,0X61BA,0X61BB,
-0X61BC,0X61BD,0X61BF,0X61C0,0X61C1,0X61C3,0X61C4,0X61C5,0X61C6,0X61C7,0X61C9,0X61CC,0X61CD,0X61CE,0X61CF,0X61D0,
-0X61D3,0X61D5,0X61D6,0X61D7,0X61D8,0X61D9,0X61DA,0X61DB,0X61DC,0X61DD,0X61DE,0X61DF,0X61E0,0X61E1,0X61E2,0X61E3,
-0X61E4,0X61E5,0X61E7,0X61E8,0X61E9,0X61EA,0X61EB,0X61EC,0X61ED,0X61EE,0X61EF,0X61F0,0X61F1,0X61F2,0X61F3,0X61F4,
-0X61F6,0X61F7,0X61F8,0X61F9,0X61FA,0X61FB,0X61FC,0X61FD,0X61FE,0X6200,0X6201,0X6202,0X6203,0X6204,0X6205,0X6207,
-0X6209,0X6213,0X6214,0X6219,0X621C,0X621D,0X621E,0X6220,0X6223,0X6226,0X6227,0X6228,0X6229,0X622B,0X622D,0X622F,
-0X6230,0X6231,0X6232,0X6235,0X6236,0X6238,0X6239,0X623A,0X623B,0X623C,0X6242,0X6244,0X6245,0X6246,0X624A,0X0001,
-0X624F,0X6250,0X6255,0X6256,0X6257,0X6259,0X625A,0X625C,0X625D,0X625E,0X625F,0X6260,0X6261,0X6262,0X6264,0X6265,
-0X6268,0X6271,0X6272,0X6274,0X6275,0X6277,0X6278,0X627A,0X627B,0X627D,0X6281,0X6282,0X6283,0X6285,0X6286,0X6287,
-0X6288,0X628B,0X628C,0X628D,0X628E,0X628F,0X6290,0X6294,0X6299,0X629C,0X629D,0X629E,0X62A3,0X62A6,0X62A7,0X62A9,
-0X62AA,0X62AD,0X62AE,0X62AF,0X62B0,0X62B2,0X62B3,0X62B4,0X62B6,0X62B7,0X62B8,0X62BA,0X62BE,0X62C0,0X62C1,0X0001,
-0X62C3,0X62CB,0X62CF,0X62D1,0X62D5,0X62DD,0X62DE,0X62E0,0X62E1,0X62E4,0X62EA,0X62EB,0X62F0,0X62F2,0X62F5,0X62F8,
-0X62F9,0X62FA,0X62FB,0X6300,0X6303,0X6304,0X6305,0X6306,0X630A,0X630B,0X630C,0X630D,0X630F,0X6310,0X6312,0X6313,
-0X6314,0X6315,0X6317,0X6318,0X6319,0X631C,0X6326,0X6327,0X6329,0X632C,0X632D,0X632E,0X6330,0X6331,0X6333,0X6334,
-0X6335,0X6336,0X6337,0X6338,0X633B,0X633C,0X633E,0X633F,0X6340,0X6341,0X6344,0X6347,0X6348,0X634A,0X6351,0X6352,
-0X6353,0X6354,0X6356,0X6357,0X6358,0X6359,0X635A,0X635B,0X635C,0X635D,0X6360,0X6364,0X6365,0X6366,0X6368,0X636A,
-0X636B,0X636C,0X636F,0X6370,0X6372,0X6373,0X6374,0X6375,0X6378,0X6379,0X637C,0X637D,0X637E,0X637F,0X6381,0X6383,
-0X6384,0X6385,0X6386,0X638B,0X638D,0X6391,0X6393,0X6394,0X6395,0X6397,0X6399,0X639A,0X639B,0X639C,0X639D,0X639E,
-0X639F,0X63A1,0X63A4,0X63A6,0X63AB,0X63AF,0X63B1,0X63B2,0X63B5,0X63B6,0X63B9,0X63BB,0X63BD,0X63BF,0X63C0,0X0001,
-0X63C1,0X63C2,0X63C3,0X63C5,0X63C7,0X63C8,0X63CA,0X63CB,0X63CC,0X63D1,0X63D3,0X63D4,0X63D5,0X63D7,0X63D8,0X63D9,
-0X63DA,0X63DB,0X63DC,0X63DD,0X63DF,0X63E2,0X63E4,0X63E5,0X63E6,0X63E7,0X63E8,0X63EB,0X63EC,0X63EE,0X63EF,0X63F0,
-0X63F1,0X63F3,0X63F5,0X63F7,0X63F9,0X63FA,0X63FB,0X63FC,0X63FE,0X6403,0X6404,0X6406,0X6407,0X6408,0X6409,0X640A,
-0X640D,0X640E,0X6411,0X6412,0X6415,0X6416,0X6417,0X6418,0X6419,0X641A,0X641D,0X641F,0X6422,0X6423,0X6424,0X0001,
-0X6425,0X6427,0X6428,0X6429,0X642B,0X642E,0X642F,0X6430,0X6431,0X6432,0X6433,0X6435,0X6436,0X6437,0X6438,0X6439,
-0X643B,0X643C,0X643E,0X6440,0X6442,0X6443,0X6449,0X644B,0X644C,0X644D,0X644E,0X644F,0X6450,0X6451,0X6453,0X6455,
-0X6456,0X6457,0X6459,0X645A,0X645B,0X645C,0X645D,0X645F,0X6460,0X6461,0X6462,0X6463,0X6464,0X6465,0X6466,0X6468,
-0X646A,0X646B,0X646C,0X646E,0X646F,0X6470,0X6471,0X6472,0X6473,0X6474,0X6475,0X6476,0X6477,0X647B,0X647C,0X647D,
-0X647E,0X647F,0X6480,0X6481,0X6483,0X6486,0X6488,0X6489,0X648A,0X648B,0X648C,0X648D,0X648E,0X648F,0X6490,0X6493,
-0X6494,0X6497,0X6498,0X649A,0X649B,0X649C,0X649D,0X649F,0X64A0,0X64A1,0X64A2,0X64A3,0X64A5,0X64A6,0X64A7,0X64A8,
-0X64AA,0X64AB,0X64AF,0X64B1,0X64B2,0X64B3,0X64B4,0X64B6,0X64B9,0X64BB,0X64BD,0X64BE,0X64BF,0X64C1,0X64C3,0X64C4,
-0X64C6,0X64C7,0X64C8,0X64C9,0X64CA,0X64CB,0X64CC,0X64CF,0X64D1,0X64D3,0X64D4,0X64D5,0X64D6,0X64D9,0X64DA,0X0001,
-0X64DB,0X64DC,0X64DD,0X64DF,0X64E0,0X64E1,0X64E3,0X64E5,0X64E7,0X64E8,0X64E9,0X64EA,0X64EB,0X64EC,0X64ED,0X64EE,
-0X64EF,0X64F0,0X64F1,0X64F2,0X64F3,0X64F4,0X64F5,0X64F6,0X64F7,0X64F8,0X64F9,0X64FA,0X64FB,0X64FC,0X64FD,0X64FE,
-0X64FF,0X6501,0X6502,0X6503,0X6504,0X6505,0X6506,0X6507,0X6508,0X650A,0X650B,0X650C,0X650D,0X650E,0X650F,0X6510,
-0X6511,0X6513,0X6514,0X6515,0X6516,0X6517,0X6519,0X651A,0X651B,0X651C,0X651D,0X651E,0X651F,0X6520,0X6521,0X0001,
-0X6522,0X6523,0X6524,0X6526,0X6527,0X6528,0X6529,0X652A,0X652C,0X652D,0X6530,0X6531,0X6532,0X6533,0X6537,0X653A,
-0X653C,0X653D,0X6540,0X6541,0X6542,0X6543,0X6544,0X6546,0X6547,0X654A,0X654B,0X654D,0X654E,0X6550,0X6552,0X6553,
-0X6554,0X6557,0X6558,0X655A,0X655C,0X655F,0X6560,0X6561,0X6564,0X6565,0X6567,0X6568,0X6569,0X656A,0X656D,0X656E,
-0X656F,0X6571,0X6573,0X6575,0X6576,0X6578,0X6579,0X657A,0X657B,0X657C,0X657D,0X657E,0X657F,0X6580,0X6581,0X6582,
-0X6583,0X6584,0X6585,0X6586,0X6588,0X6589,0X658A,0X658D,0X658E,0X658F,0X6592,0X6594,0X6595,0X6596,0X6598,0X659A,
-0X659D,0X659E,0X65A0,0X65A2,0X65A3,0X65A6,0X65A8,0X65AA,0X65AC,0X65AE,0X65B1,0X65B2,0X65B3,0X65B4,0X65B5,0X65B6,
-0X65B7,0X65B8,0X65BA,0X65BB,0X65BE,0X65BF,0X65C0,0X65C2,0X65C7,0X65C8,0X65C9,0X65CA,0X65CD,0X65D0,0X65D1,0X65D3,
-0X65D4,0X65D5,0X65D8,0X65D9,0X65DA,0X65DB,0X65DC,0X65DD,0X65DE,0X65DF,0X65E1,0X65E3,0X65E4,0X65EA,0X65EB,0X0001,
-0X65F2,0X65F3,0X65F4,0X65F5,0X65F8,0X65F9,0X65FB,0X65FC,0X65FD,0X65FE,0X65FF,0X6601,0X6604,0X6605,0X6607,0X6608,
-0X6609,0X660B,0X660D,0X6610,0X6611,0X6612,0X6616,0X6617,0X6618,0X661A,0X661B,0X661C,0X661E,0X6621,0X6622,0X6623,
-0X6624,0X6626,0X6629,0X662A,0X662B,0X662C,0X662E,0X6630,0X6632,0X6633,0X6637,0X6638,0X6639,0X663A,0X663B,0X663D,
-0X663F,0X6640,0X6642,0X6644,0X6645,0X6646,0X6647,0X6648,0X6649,0X664A,0X664D,0X664E,0X6650,0X6651,0X6658,0X0001,
-0X6659,0X665B,0X665C,0X665D,0X665E,0X6660,0X6662,0X6663,0X6665,0X6667,0X6669,0X666A,0X666B,0X666C,0X666D,0X6671,
-0X6672,0X6673,0X6675,0X6678,0X6679,0X667B,0X667C,0X667D,0X667F,0X6680,0X6681,0X6683,0X6685,0X6686,0X6688,0X6689,
-0X668A,0X668B,0X668D,0X668E,0X668F,0X6690,0X6692,0X6693,0X6694,0X6695,0X6698,0X6699,0X669A,0X669B,0X669C,0X669E,
-0X669F,0X66A0,0X66A1,0X66A2,0X66A3,0X66A4,0X66A5,0X66A6,0X66A9,0X66AA,0X66AB,0X66AC,0X66AD,0X66AF,0X66B0,0X66B1,
-0X66B2,0X66B3,0X66B5,0X66B6,0X66B7,0X66B8,0X66BA,0X66BB,0X66BC,0X66BD,0X66BF,0X66C0,0X66C1,0X66C2,0X66C3,0X66C4,
-0X66C5,0X66C6,0X66C7,0X66C8,0X66C9,0X66CA,0X66CB,0X66CC,0X66CD,0X66CE,0X66CF,0X66D0,0X66D1,0X66D2,0X66D3,0X66D4,
-0X66D5,0X66D6,0X66D7,0X66D8,0X66DA,0X66DE,0X66DF,0X66E0,0X66E1,0X66E2,0X66E3,0X66E4,0X66E5,0X66E7,0X66E8,0X66EA,
-0X66EB,0X66EC,0X66ED,0X66EE,0X66EF,0X66F1,0X66F5,0X66F6,0X66F8,0X66FA,0X66FB,0X66FD,0X6701,0X6702,0X6703,0X0001,
-0X6704,0X6705,0X6706,0X6707,0X670C,0X670E,0X670F,0X6711,0X6712,0X6713,0X6716,0X6718,0X6719,0X671A,0X671C,0X671E,
-0X6720,0X6721,0X6722,0X6723,0X6724,0X6725,0X6727,0X6729,0X672E,0X6730,0X6732,0X6733,0X6736,0X6737,0X6738,0X6739,
-0X673B,0X673C,0X673E,0X673F,0X6741,0X6744,0X6745,0X6747,0X674A,0X674B,0X674D,0X6752,0X6754,0X6755,0X6757,0X6758,
-0X6759,0X675A,0X675B,0X675D,0X6762,0X6763,0X6764,0X6766,0X6767,0X676B,0X676C,0X676E,0X6771,0X6774,0X6776,0X0001,
-0X6778,0X6779,0X677A,0X677B,0X677D,0X6780,0X6782,0X6783,0X6785,0X6786,0X6788,0X678A,0X678C,0X678D,0X678E,0X678F,
-0X6791,0X6792,0X6793,0X6794,0X6796,0X6799,0X679B,0X679F,0X67A0,0X67A1,0X67A4,0X67A6,0X67A9,0X67AC,0X67AE,0X67B1,
-0X67B2,0X67B4,0X67B9,0X67BA,0X67BB,0X67BC,0X67BD,0X67BE,0X67BF,0X67C0,0X67C2,0X67C5,0X67C6,0X67C7,0X67C8,0X67C9,
-0X67CA,0X67CB,0X67CC,0X67CD,0X67CE,0X67D5,0X67D6,0X67D7,0X67DB,0X67DF,0X67E1,0X67E3,0X67E4,0X67E6,0X67E7,0X67E8,
-0X67EA,0X67EB,0X67ED,0X67EE,0X67F2,0X67F5,0X67F6,0X67F7,0X67F8,0X67F9,0X67FA,0X67FB,0X67FC,0X67FE,0X6801,0X6802,
-0X6803,0X6804,0X6806,0X680D,0X6810,0X6812,0X6814,0X6815,0X6818,0X6819,0X681A,0X681B,0X681C,0X681E,0X681F,0X6820,
-0X6822,0X6823,0X6824,0X6825,0X6826,0X6827,0X6828,0X682B,0X682C,0X682D,0X682E,0X682F,0X6830,0X6831,0X6834,0X6835,
-0X6836,0X683A,0X683B,0X683F,0X6847,0X684B,0X684D,0X684F,0X6852,0X6856,0X6857,0X6858,0X6859,0X685A,0X685B,0X0001,
-0X685C,0X685D,0X685E,0X685F,0X686A,0X686C,0X686D,0X686E,0X686F,0X6870,0X6871,0X6872,0X6873,0X6875,0X6878,0X6879,
-0X687A,0X687B,0X687C,0X687D,0X687E,0X687F,0X6880,0X6882,0X6884,0X6887,0X6888,0X6889,0X688A,0X688B,0X688C,0X688D,
-0X688E,0X6890,0X6891,0X6892,0X6894,0X6895,0X6896,0X6898,0X6899,0X689A,0X689B,0X689C,0X689D,0X689E,0X689F,0X68A0,
-0X68A1,0X68A3,0X68A4,0X68A5,0X68A9,0X68AA,0X68AB,0X68AC,0X68AE,0X68B1,0X68B2,0X68B4,0X68B6,0X68B7,0X68B8,0X0001,
-0X68B9,0X68BA,0X68BB,0X68BC,0X68BD,0X68BE,0X68BF,0X68C1,0X68C3,0X68C4,0X68C5,0X68C6,0X68C7,0X68C8,0X68CA,0X68CC,
-0X68CE,0X68CF,0X68D0,0X68D1,0X68D3,0X68D4,0X68D6,0X68D7,0X68D9,0X68DB,0X68DC,0X68DD,0X68DE,0X68DF,0X68E1,0X68E2,
-0X68E4,0X68E5,0X68E6,0X68E7,0X68E8,0X68E9,0X68EA,0X68EB,0X68EC,0X68ED,0X68EF,0X68F2,0X68F3,0X68F4,0X68F6,0X68F7,
-0X68F8,0X68FB,0X68FD,0X68FE,0X68FF,0X6900,0X6902,0X6903,0X6904,0X6906,0X6907,0X6908,0X6909,0X690A,0X690C,0X690F,
-0X6911,0X6913,0X6914,0X6915,0X6916,0X6917,0X6918,0X6919,0X691A,0X691B,0X691C,0X691D,0X691E,0X6921,0X6922,0X6923,
-0X6925,0X6926,0X6927,0X6928,0X6929,0X692A,0X692B,0X692C,0X692E,0X692F,0X6931,0X6932,0X6933,0X6935,0X6936,0X6937,
-0X6938,0X693A,0X693B,0X693C,0X693E,0X6940,0X6941,0X6943,0X6944,0X6945,0X6946,0X6947,0X6948,0X6949,0X694A,0X694B,
-0X694C,0X694D,0X694E,0X694F,0X6950,0X6951,0X6952,0X6953,0X6955,0X6956,0X6958,0X6959,0X695B,0X695C,0X695F,0X0001,
-0X6961,0X6962,0X6964,0X6965,0X6967,0X6968,0X6969,0X696A,0X696C,0X696D,0X696F,0X6970,0X6972,0X6973,0X6974,0X6975,
-0X6976,0X697A,0X697B,0X697D,0X697E,0X697F,0X6981,0X6983,0X6985,0X698A,0X698B,0X698C,0X698E,0X698F,0X6990,0X6991,
-0X6992,0X6993,0X6996,0X6997,0X6999,0X699A,0X699D,0X699E,0X699F,0X69A0,0X69A1,0X69A2,0X69A3,0X69A4,0X69A5,0X69A6,
-0X69A9,0X69AA,0X69AC,0X69AE,0X69AF,0X69B0,0X69B2,0X69B3,0X69B5,0X69B6,0X69B8,0X69B9,0X69BA,0X69BC,0X69BD,0X0001,
-0X69BE,0X69BF,0X69C0,0X69C2,0X69C3,0X69C4,0X69C5,0X69C6,0X69C7,0X69C8,0X69C9,0X69CB,0X69CD,0X69CF,0X69D1,0X69D2,
-0X69D3,0X69D5,0X69D6,0X69D7,0X69D8,0X69D9,0X69DA,0X69DC,0X69DD,0X69DE,0X69E1,0X69E2,0X69E3,0X69E4,0X69E5,0X69E6,
-0X69E7,0X69E8,0X69E9,0X69EA,0X69EB,0X69EC,0X69EE,0X69EF,0X69F0,0X69F1,0X69F3,0X69F4,0X69F5,0X69F6,0X69F7,0X69F8,
-0X69F9,0X69FA,0X69FB,0X69FC,0X69FE,0X6A00,0X6A01,0X6A02,0X6A03,0X6A04,0X6A05,0X6A06,0X6A07,0X6A08,0X6A09,0X6A0B,
-0X6A0C,0X6A0D,0X6A0E,0X6A0F,0X6A10,0X6A11,0X6A12,0X6A13,0X6A14,0X6A15,0X6A16,0X6A19,0X6A1A,0X6A1B,0X6A1C,0X6A1D,
-0X6A1E,0X6A20,0X6A22,0X6A23,0X6A24,0X6A25,0X6A26,0X6A27,0X6A29,0X6A2B,0X6A2C,0X6A2D,0X6A2E,0X6A30,0X6A32,0X6A33,
-0X6A34,0X6A36,0X6A37,0X6A38,0X6A39,0X6A3A,0X6A3B,0X6A3C,0X6A3F,0X6A40,0X6A41,0X6A42,0X6A43,0X6A45,0X6A46,0X6A48,
-0X6A49,0X6A4A,0X6A4B,0X6A4C,0X6A4D,0X6A4E,0X6A4F,0X6A51,0X6A52,0X6A53,0X6A54,0X6A55,0X6A56,0X6A57,0X6A5A,0X0001,
-0X6A5C,0X6A5D,0X6A5E,0X6A5F,0X6A60,0X6A62,0X6A63,0X6A64,0X6A66,0X6A67,0X6A68,0X6A69,0X6A6A,0X6A6B,0X6A6C,0X6A6D,
-0X6A6E,0X6A6F,0X6A70,0X6A72,0X6A73,0X6A74,0X6A75,0X6A76,0X6A77,0X6A78,0X6A7A,0X6A7B,0X6A7D,0X6A7E,0X6A7F,0X6A81,
-0X6A82,0X6A83,0X6A85,0X6A86,0X6A87,0X6A88,0X6A89,0X6A8A,0X6A8B,0X6A8C,0X6A8D,0X6A8F,0X6A92,0X6A93,0X6A94,0X6A95,
-0X6A96,0X6A98,0X6A99,0X6A9A,0X6A9B,0X6A9C,0X6A9D,0X6A9E,0X6A9F,0X6AA1,0X6AA2,0X6AA3,0X6AA4,0X6AA5,0X6AA6,0X0001,
-0X6AA7,0X6AA8,0X6AAA,0X6AAD,0X6AAE,0X6AAF,0X6AB0,0X6AB1,0X6AB2,0X6AB3,0X6AB4,0X6AB5,0X6AB6,0X6AB7,0X6AB8,0X6AB9,
-0X6ABA,0X6ABB,0X6ABC,0X6ABD,0X6ABE,0X6ABF,0X6AC0,0X6AC1,0X6AC2,0X6AC3,0X6AC4,0X6AC5,0X6AC6,0X6AC7,0X6AC8,0X6AC9,
-0X6ACA,0X6ACB,0X6ACC,0X6ACD,0X6ACE,0X6ACF,0X6AD0,0X6AD1,0X6AD2,0X6AD3,0X6AD4,0X6AD5,0X6AD6,0X6AD7,0X6AD8,0X6AD9,
-0X6ADA,0X6ADB,0X6ADC,0X6ADD,0X6ADE,0X6ADF,0X6AE0,0X6AE1,0X6AE2,0X6AE3,0X6AE4,0X6AE5,0X6AE6,0X6AE7,0X6AE8,0X6AE9,
-0X6AEA,0X6AEB,0X6AEC,0X6AED,0X6AEE,0X6AEF,0X6AF0,0X6AF1,0X6AF2,0X6AF3,0X6AF4,0X6AF5,0X6AF6,0X6AF7,0X6AF8,0X6AF9,
-0X6AFA,0X6AFB,0X6AFC,0X6AFD,0X6AFE,0X6AFF,0X6B00,0X6B01,0X6B02,0X6B03,0X6B04,0X6B05,0X6B06,0X6B07,0X6B08,0X6B09,
-0X6B0A,0X6B0B,0X6B0C,0X6B0D,0X6B0E,0X6B0F,0X6B10,0X6B11,0X6B12,0X6B13,0X6B14,0X6B15,0X6B16,0X6B17,0X6B18,0X6B19,
-0X6B1A,0X6B1B,0X6B1C,0X6B1D,0X6B1E,0X6B1F,0X6B25,0X6B26,0X6B28,0X6B29,0X6B2A,0X6B2B,0X6B2C,0X6B2D,0X6B2E,0X0001,
-0X6B2F,0X6B30,0X6B31,0X6B33,0X6B34,0X6B35,0X6B36,0X6B38,0X6B3B,0X6B3C,0X6B3D,0X6B3F,0X6B40,0X6B41,0X6B42,0X6B44,
-0X6B45,0X6B48,0X6B4A,0X6B4B,0X6B4D,0X6B4E,0X6B4F,0X6B50,0X6B51,0X6B52,0X6B53,0X6B54,0X6B55,0X6B56,0X6B57,0X6B58,
-0X6B5A,0X6B5B,0X6B5C,0X6B5D,0X6B5E,0X6B5F,0X6B60,0X6B61,0X6B68,0X6B69,0X6B6B,0X6B6C,0X6B6D,0X6B6E,0X6B6F,0X6B70,
-0X6B71,0X6B72,0X6B73,0X6B74,0X6B75,0X6B76,0X6B77,0X6B78,0X6B7A,0X6B7D,0X6B7E,0X6B7F,0X6B80,0X6B85,0X6B88,0X0001,
-0X6B8C,0X6B8E,0X6B8F,0X6B90,0X6B91,0X6B94,0X6B95,0X6B97,0X6B98,0X6B99,0X6B9C,0X6B9D,0X6B9E,0X6B9F,0X6BA0,0X6BA2,
-0X6BA3,0X6BA4,0X6BA5,0X6BA6,0X6BA7,0X6BA8,0X6BA9,0X6BAB,0X6BAC,0X6BAD,0X6BAE,0X6BAF,0X6BB0,0X6BB1,0X6BB2,0X6BB6,
-0X6BB8,0X6BB9,0X6BBA,0X6BBB,0X6BBC,0X6BBD,0X6BBE,0X6BC0,0X6BC3,0X6BC4,0X6BC6,0X6BC7,0X6BC8,0X6BC9,0X6BCA,0X6BCC,
-0X6BCE,0X6BD0,0X6BD1,0X6BD8,0X6BDA,0X6BDC,0X6BDD,0X6BDE,0X6BDF,0X6BE0,0X6BE2,0X6BE3,0X6BE4,0X6BE5,0X6BE6,0X6BE7,
-0X6BE8,0X6BE9,0X6BEC,0X6BED,0X6BEE,0X6BF0,0X6BF1,0X6BF2,0X6BF4,0X6BF6,0X6BF7,0X6BF8,0X6BFA,0X6BFB,0X6BFC,0X6BFE,
-0X6BFF,0X6C00,0X6C01,0X6C02,0X6C03,0X6C04,0X6C08,0X6C09,0X6C0A,0X6C0B,0X6C0C,0X6C0E,0X6C12,0X6C17,0X6C1C,0X6C1D,
-0X6C1E,0X6C20,0X6C23,0X6C25,0X6C2B,0X6C2C,0X6C2D,0X6C31,0X6C33,0X6C36,0X6C37,0X6C39,0X6C3A,0X6C3B,0X6C3C,0X6C3E,
-0X6C3F,0X6C43,0X6C44,0X6C45,0X6C48,0X6C4B,0X6C4C,0X6C4D,0X6C4E,0X6C4F,0X6C51,0X6C52,0X6C53,0X6C56,0X6C58,0X0001,
-0X6C59,0X6C5A,0X6C62,0X6C63,0X6C65,0X6C66,0X6C67,0X6C6B,0X6C6C,0X6C6D,0X6C6E,0X6C6F,0X6C71,0X6C73,0X6C75,0X6C77,
-0X6C78,0X6C7A,0X6C7B,0X6C7C,0X6C7F,0X6C80,0X6C84,0X6C87,0X6C8A,0X6C8B,0X6C8D,0X6C8E,0X6C91,0X6C92,0X6C95,0X6C96,
-0X6C97,0X6C98,0X6C9A,0X6C9C,0X6C9D,0X6C9E,0X6CA0,0X6CA2,0X6CA8,0X6CAC,0X6CAF,0X6CB0,0X6CB4,0X6CB5,0X6CB6,0X6CB7,
-0X6CBA,0X6CC0,0X6CC1,0X6CC2,0X6CC3,0X6CC6,0X6CC7,0X6CC8,0X6CCB,0X6CCD,0X6CCE,0X6CCF,0X6CD1,0X6CD2,0X6CD8,0X0001,
-0X6CD9,0X6CDA,0X6CDC,0X6CDD,0X6CDF,0X6CE4,0X6CE6,0X6CE7,0X6CE9,0X6CEC,0X6CED,0X6CF2,0X6CF4,0X6CF9,0X6CFF,0X6D00,
-0X6D02,0X6D03,0X6D05,0X6D06,0X6D08,0X6D09,0X6D0A,0X6D0D,0X6D0F,0X6D10,0X6D11,0X6D13,0X6D14,0X6D15,0X6D16,0X6D18,
-0X6D1C,0X6D1D,0X6D1F,0X6D20,0X6D21,0X6D22,0X6D23,0X6D24,0X6D26,0X6D28,0X6D29,0X6D2C,0X6D2D,0X6D2F,0X6D30,0X6D34,
-0X6D36,0X6D37,0X6D38,0X6D3A,0X6D3F,0X6D40,0X6D42,0X6D44,0X6D49,0X6D4C,0X6D50,0X6D55,0X6D56,0X6D57,0X6D58,0X6D5B,
-0X6D5D,0X6D5F,0X6D61,0X6D62,0X6D64,0X6D65,0X6D67,0X6D68,0X6D6B,0X6D6C,0X6D6D,0X6D70,0X6D71,0X6D72,0X6D73,0X6D75,
-0X6D76,0X6D79,0X6D7A,0X6D7B,0X6D7D,0X6D7E,0X6D7F,0X6D80,0X6D81,0X6D83,0X6D84,0X6D86,0X6D87,0X6D8A,0X6D8B,0X6D8D,
-0X6D8F,0X6D90,0X6D92,0X6D96,0X6D97,0X6D98,0X6D99,0X6D9A,0X6D9C,0X6DA2,0X6DA5,0X6DAC,0X6DAD,0X6DB0,0X6DB1,0X6DB3,
-0X6DB4,0X6DB6,0X6DB7,0X6DB9,0X6DBA,0X6DBB,0X6DBC,0X6DBD,0X6DBE,0X6DC1,0X6DC2,0X6DC3,0X6DC8,0X6DC9,0X6DCA,0X0001,
-0X6DCD,0X6DCE,0X6DCF,0X6DD0,0X6DD2,0X6DD3,0X6DD4,0X6DD5,0X6DD7,0X6DDA,0X6DDB,0X6DDC,0X6DDF,0X6DE2,0X6DE3,0X6DE5,
-0X6DE7,0X6DE8,0X6DE9,0X6DEA,0X6DED,0X6DEF,0X6DF0,0X6DF2,0X6DF4,0X6DF5,0X6DF6,0X6DF8,0X6DFA,0X6DFD,0X6DFE,0X6DFF,
-0X6E00,0X6E01,0X6E02,0X6E03,0X6E04,0X6E06,0X6E07,0X6E08,0X6E09,0X6E0B,0X6E0F,0X6E12,0X6E13,0X6E15,0X6E18,0X6E19,
-0X6E1B,0X6E1C,0X6E1E,0X6E1F,0X6E22,0X6E26,0X6E27,0X6E28,0X6E2A,0X6E2C,0X6E2E,0X6E30,0X6E31,0X6E33,0X6E35,0X0001,
-0X6E36,0X6E37,0X6E39,0X6E3B,0X6E3C,0X6E3D,0X6E3E,0X6E3F,0X6E40,0X6E41,0X6E42,0X6E45,0X6E46,0X6E47,0X6E48,0X6E49,
-0X6E4A,0X6E4B,0X6E4C,0X6E4F,0X6E50,0X6E51,0X6E52,0X6E55,0X6E57,0X6E59,0X6E5A,0X6E5C,0X6E5D,0X6E5E,0X6E60,0X6E61,
-0X6E62,0X6E63,0X6E64,0X6E65,0X6E66,0X6E67,0X6E68,0X6E69,0X6E6A,0X6E6C,0X6E6D,0X6E6F,0X6E70,0X6E71,0X6E72,0X6E73,
-0X6E74,0X6E75,0X6E76,0X6E77,0X6E78,0X6E79,0X6E7A,0X6E7B,0X6E7C,0X6E7D,0X6E80,0X6E81,0X6E82,0X6E84,0X6E87,0X6E88,
-0X6E8A,0X6E8B,0X6E8C,0X6E8D,0X6E8E,0X6E91,0X6E92,0X6E93,0X6E94,0X6E95,0X6E96,0X6E97,0X6E99,0X6E9A,0X6E9B,0X6E9D,
-0X6E9E,0X6EA0,0X6EA1,0X6EA3,0X6EA4,0X6EA6,0X6EA8,0X6EA9,0X6EAB,0X6EAC,0X6EAD,0X6EAE,0X6EB0,0X6EB3,0X6EB5,0X6EB8,
-0X6EB9,0X6EBC,0X6EBE,0X6EBF,0X6EC0,0X6EC3,0X6EC4,0X6EC5,0X6EC6,0X6EC8,0X6EC9,0X6ECA,0X6ECC,0X6ECD,0X6ECE,0X6ED0,
-0X6ED2,0X6ED6,0X6ED8,0X6ED9,0X6EDB,0X6EDC,0X6EDD,0X6EE3,0X6EE7,0X6EEA,0X6EEB,0X6EEC,0X6EED,0X6EEE,0X6EEF,0X0001,
-0X6EF0,0X6EF1,0X6EF2,0X6EF3,0X6EF5,0X6EF6,0X6EF7,0X6EF8,0X6EFA,0X6EFB,0X6EFC,0X6EFD,0X6EFE,0X6EFF,0X6F00,0X6F01,
-0X6F03,0X6F04,0X6F05,0X6F07,0X6F08,0X6F0A,0X6F0B,0X6F0C,0X6F0D,0X6F0E,0X6F10,0X6F11,0X6F12,0X6F16,0X6F17,0X6F18,
-0X6F19,0X6F1A,0X6F1B,0X6F1C,0X6F1D,0X6F1E,0X6F1F,0X6F21,0X6F22,0X6F23,0X6F25,0X6F26,0X6F27,0X6F28,0X6F2C,0X6F2E,
-0X6F30,0X6F32,0X6F34,0X6F35,0X6F37,0X6F38,0X6F39,0X6F3A,0X6F3B,0X6F3C,0X6F3D,0X6F3F,0X6F40,0X6F41,0X6F42,0X0001,
-0X6F43,0X6F44,0X6F45,0X6F48,0X6F49,0X6F4A,0X6F4C,0X6F4E,0X6F4F,0X6F50,0X6F51,0X6F52,0X6F53,0X6F54,0X6F55,0X6F56,
-0X6F57,0X6F59,0X6F5A,0X6F5B,0X6F5D,0X6F5F,0X6F60,0X6F61,0X6F63,0X6F64,0X6F65,0X6F67,0X6F68,0X6F69,0X6F6A,0X6F6B,
-0X6F6C,0X6F6F,0X6F70,0X6F71,0X6F73,0X6F75,0X6F76,0X6F77,0X6F79,0X6F7B,0X6F7D,0X6F7E,0X6F7F,0X6F80,0X6F81,0X6F82,
-0X6F83,0X6F85,0X6F86,0X6F87,0X6F8A,0X6F8B,0X6F8F,0X6F90,0X6F91,0X6F92,0X6F93,0X6F94,0X6F95,0X6F96,0X6F97,0X6F98,
-0X6F99,0X6F9A,0X6F9B,0X6F9D,0X6F9E,0X6F9F,0X6FA0,0X6FA2,0X6FA3,0X6FA4,0X6FA5,0X6FA6,0X6FA8,0X6FA9,0X6FAA,0X6FAB,
-0X6FAC,0X6FAD,0X6FAE,0X6FAF,0X6FB0,0X6FB1,0X6FB2,0X6FB4,0X6FB5,0X6FB7,0X6FB8,0X6FBA,0X6FBB,0X6FBC,0X6FBD,0X6FBE,
-0X6FBF,0X6FC1,0X6FC3,0X6FC4,0X6FC5,0X6FC6,0X6FC7,0X6FC8,0X6FCA,0X6FCB,0X6FCC,0X6FCD,0X6FCE,0X6FCF,0X6FD0,0X6FD3,
-0X6FD4,0X6FD5,0X6FD6,0X6FD7,0X6FD8,0X6FD9,0X6FDA,0X6FDB,0X6FDC,0X6FDD,0X6FDF,0X6FE2,0X6FE3,0X6FE4,0X6FE5,0X0001,
-0X6FE6,0X6FE7,0X6FE8,0X6FE9,0X6FEA,0X6FEB,0X6FEC,0X6FED,0X6FF0,0X6FF1,0X6FF2,0X6FF3,0X6FF4,0X6FF5,0X6FF6,0X6FF7,
-0X6FF8,0X6FF9,0X6FFA,0X6FFB,0X6FFC,0X6FFD,0X6FFE,0X6FFF,0X7000,0X7001,0X7002,0X7003,0X7004,0X7005,0X7006,0X7007,
-0X7008,0X7009,0X700A,0X700B,0X700C,0X700D,0X700E,0X700F,0X7010,0X7012,0X7013,0X7014,0X7015,0X7016,0X7017,0X7018,
-0X7019,0X701C,0X701D,0X701E,0X701F,0X7020,0X7021,0X7022,0X7024,0X7025,0X7026,0X7027,0X7028,0X7029,0X702A,0X0001,
-0X702B,0X702C,0X702D,0X702E,0X702F,0X7030,0X7031,0X7032,0X7033,0X7034,0X7036,0X7037,0X7038,0X703A,0X703B,0X703C,
-0X703D,0X703E,0X703F,0X7040,0X7041,0X7042,0X7043,0X7044,0X7045,0X7046,0X7047,0X7048,0X7049,0X704A,0X704B,0X704D,
-0X704E,0X7050,0X7051,0X7052,0X7053,0X7054,0X7055,0X7056,0X7057,0X7058,0X7059,0X705A,0X705B,0X705C,0X705D,0X705F,
-0X7060,0X7061,0X7062,0X7063,0X7064,0X7065,0X7066,0X7067,0X7068,0X7069,0X706A,0X706E,0X7071,0X7072,0X7073,0X7074,
-0X7077,0X7079,0X707A,0X707B,0X707D,0X7081,0X7082,0X7083,0X7084,0X7086,0X7087,0X7088,0X708B,0X708C,0X708D,0X708F,
-0X7090,0X7091,0X7093,0X7097,0X7098,0X709A,0X709B,0X709E,0X709F,0X70A0,0X70A1,0X70A2,0X70A3,0X70A4,0X70A5,0X70A6,
-0X70A7,0X70A8,0X70A9,0X70AA,0X70B0,0X70B2,0X70B4,0X70B5,0X70B6,0X70BA,0X70BE,0X70BF,0X70C4,0X70C5,0X70C6,0X70C7,
-0X70C9,0X70CB,0X70CC,0X70CD,0X70CE,0X70CF,0X70D0,0X70D1,0X70D2,0X70D3,0X70D4,0X70D5,0X70D6,0X70D7,0X70DA,0X0001,
-0X70DC,0X70DD,0X70DE,0X70E0,0X70E1,0X70E2,0X70E3,0X70E5,0X70EA,0X70EE,0X70F0,0X70F1,0X70F2,0X70F3,0X70F4,0X70F5,
-0X70F6,0X70F8,0X70FA,0X70FB,0X70FC,0X70FE,0X70FF,0X7100,0X7101,0X7102,0X7103,0X7104,0X7105,0X7106,0X7107,0X7108,
-0X710B,0X710C,0X710D,0X710E,0X710F,0X7111,0X7112,0X7114,0X7117,0X711B,0X711C,0X711D,0X711E,0X711F,0X7120,0X7121,
-0X7122,0X7123,0X7124,0X7125,0X7127,0X7128,0X7129,0X712A,0X712B,0X712C,0X712D,0X712E,0X7132,0X7133,0X7134,0X0001,
-0X7135,0X7137,0X7138,0X7139,0X713A,0X713B,0X713C,0X713D,0X713E,0X713F,0X7140,0X7141,0X7142,0X7143,0X7144,0X7146,
-0X7147,0X7148,0X7149,0X714B,0X714D,0X714F,0X7150,0X7151,0X7152,0X7153,0X7154,0X7155,0X7156,0X7157,0X7158,0X7159,
-0X715A,0X715B,0X715D,0X715F,0X7160,0X7161,0X7162,0X7163,0X7165,0X7169,0X716A,0X716B,0X716C,0X716D,0X716F,0X7170,
-0X7171,0X7174,0X7175,0X7176,0X7177,0X7179,0X717B,0X717C,0X717E,0X717F,0X7180,0X7181,0X7182,0X7183,0X7185,0X7186,
-0X7187,0X7188,0X7189,0X718B,0X718C,0X718D,0X718E,0X7190,0X7191,0X7192,0X7193,0X7195,0X7196,0X7197,0X719A,0X719B,
-0X719C,0X719D,0X719E,0X71A1,0X71A2,0X71A3,0X71A4,0X71A5,0X71A6,0X71A7,0X71A9,0X71AA,0X71AB,0X71AD,0X71AE,0X71AF,
-0X71B0,0X71B1,0X71B2,0X71B4,0X71B6,0X71B7,0X71B8,0X71BA,0X71BB,0X71BC,0X71BD,0X71BE,0X71BF,0X71C0,0X71C1,0X71C2,
-0X71C4,0X71C5,0X71C6,0X71C7,0X71C8,0X71C9,0X71CA,0X71CB,0X71CC,0X71CD,0X71CF,0X71D0,0X71D1,0X71D2,0X71D3,0X0001,
-0X71D6,0X71D7,0X71D8,0X71D9,0X71DA,0X71DB,0X71DC,0X71DD,0X71DE,0X71DF,0X71E1,0X71E2,0X71E3,0X71E4,0X71E6,0X71E8,
-0X71E9,0X71EA,0X71EB,0X71EC,0X71ED,0X71EF,0X71F0,0X71F1,0X71F2,0X71F3,0X71F4,0X71F5,0X71F6,0X71F7,0X71F8,0X71FA,
-0X71FB,0X71FC,0X71FD,0X71FE,0X71FF,0X7200,0X7201,0X7202,0X7203,0X7204,0X7205,0X7207,0X7208,0X7209,0X720A,0X720B,
-0X720C,0X720D,0X720E,0X720F,0X7210,0X7211,0X7212,0X7213,0X7214,0X7215,0X7216,0X7217,0X7218,0X7219,0X721A,0X0001,
-0X721B,0X721C,0X721E,0X721F,0X7220,0X7221,0X7222,0X7223,0X7224,0X7225,0X7226,0X7227,0X7229,0X722B,0X722D,0X722E,
-0X722F,0X7232,0X7233,0X7234,0X723A,0X723C,0X723E,0X7240,0X7241,0X7242,0X7243,0X7244,0X7245,0X7246,0X7249,0X724A,
-0X724B,0X724E,0X724F,0X7250,0X7251,0X7253,0X7254,0X7255,0X7257,0X7258,0X725A,0X725C,0X725E,0X7260,0X7263,0X7264,
-0X7265,0X7268,0X726A,0X726B,0X726C,0X726D,0X7270,0X7271,0X7273,0X7274,0X7276,0X7277,0X7278,0X727B,0X727C,0X727D,
-0X7282,0X7283,0X7285,0X7286,0X7287,0X7288,0X7289,0X728C,0X728E,0X7290,0X7291,0X7293,0X7294,0X7295,0X7296,0X7297,
-0X7298,0X7299,0X729A,0X729B,0X729C,0X729D,0X729E,0X72A0,0X72A1,0X72A2,0X72A3,0X72A4,0X72A5,0X72A6,0X72A7,0X72A8,
-0X72A9,0X72AA,0X72AB,0X72AE,0X72B1,0X72B2,0X72B3,0X72B5,0X72BA,0X72BB,0X72BC,0X72BD,0X72BE,0X72BF,0X72C0,0X72C5,
-0X72C6,0X72C7,0X72C9,0X72CA,0X72CB,0X72CC,0X72CF,0X72D1,0X72D3,0X72D4,0X72D5,0X72D6,0X72D8,0X72DA,0X72DB,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X3000,0X3001,0X3002,0X00B7,0X02C9,0X02C7,0X00A8,0X3003,0X3005,0X2014,0XFF5E,0X2016,0X2026,0X2018,0X2019,
-0X201C,0X201D,0X3014,0X3015,0X3008,0X3009,0X300A,0X300B,0X300C,0X300D,0X300E,0X300F,0X3016,0X3017,0X3010,0X3011,
-0X00B1,0X00D7,0X00F7,0X2236,0X2227,0X2228,0X2211,0X220F,0X222A,0X2229,0X2208,0X2237,0X221A,0X22A5,0X2225,0X2220,
-0X2312,0X2299,0X222B,0X222E,0X2261,0X224C,0X2248,0X223D,0X221D,0X2260,0X226E,0X226F,0X2264,0X2265,0X221E,0X2235,
-0X2234,0X2642,0X2640,0X00B0,0X2032,0X2033,0X2103,0XFF04,0X00A4,0XFFE0,0XFFE1,0X2030,0X00A7,0X2116,0X2606,0X2605,
-0X25CB,0X25CF,0X25CE,0X25C7,0X25C6,0X25A1,0X25A0,0X25B3,0X25B2,0X203B,0X2192,0X2190,0X2191,0X2193,0X3013,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X2170,0X2171,0X2172,0X2173,0X2174,0X2175,0X2176,0X2177,0X2178,0X2179,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X2488,0X2489,0X248A,0X248B,0X248C,0X248D,0X248E,0X248F,0X2490,0X2491,0X2492,0X2493,0X2494,0X2495,0X2496,
-0X2497,0X2498,0X2499,0X249A,0X249B,0X2474,0X2475,0X2476,0X2477,0X2478,0X2479,0X247A,0X247B,0X247C,0X247D,0X247E,
-0X247F,0X2480,0X2481,0X2482,0X2483,0X2484,0X2485,0X2486,0X2487,0X2460,0X2461,0X2462,0X2463,0X2464,0X2465,0X2466,
-0X2467,0X2468,0X2469,0X0001,0X0001,0X3220,0X3221,0X3222,0X3223,0X3224,0X3225,0X3226,0X3227,0X3228,0X3229,0X0001,
-0X0001,0X2160,0X2161,0X2162,0X2163,0X2164,0X2165,0X2166,0X2167,0X2168,0X2169,0X216A,0X216B,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0XFF01,0XFF02,0XFF03,0XFFE5,0XFF05,0XFF06,0XFF07,0XFF08,0XFF09,0XFF0A,0XFF0B,0XFF0C,0XFF0D,0XFF0E,0XFF0F,
-0XFF10,0XFF11,0XFF12,0XFF13,0XFF14,0XFF15,0XFF16,0XFF17,0XFF18,0XFF19,0XFF1A,0XFF1B,0XFF1C,0XFF1D,0XFF1E,0XFF1F,
-0XFF20,0XFF21,0XFF22,0XFF23,0XFF24,0XFF25,0XFF26,0XFF27,0XFF28,0XFF29,0XFF2A,0XFF2B,0XFF2C,0XFF2D,0XFF2E,0XFF2F,
-0XFF30,0XFF31,0XFF32,0XFF33,0XFF34,0XFF35,0XFF36,0XFF37,0XFF38,0XFF39,0XFF3A,0XFF3B,0XFF3C,0XFF3D,0XFF3E,0XFF3F,
-0XFF40,0XFF41,0XFF42,0XFF43,0XFF44,0XFF45,0XFF46,0XFF47,0XFF48,0XFF49,0XFF4A,0XFF4B,0XFF4C,0XFF4D,0XFF4E,0XFF4F,
-0XFF50,0XFF51,0XFF52,0XFF53,0XFF54,0XFF55,0XFF56,0XFF57,0XFF58,0XFF59,0XFF5A,0XFF5B,0XFF5C,0XFF5D,0XFFE3,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X3041,0X3042,0X3043,0X3044,0X3045,0X3046,0X3047,0X3048,0X3049,0X304A,0X304B,0X304C,0X304D,0X304E,0X304F,
-0X3050,0X3051,0X3052,0X3053,0X3054,0X3055,0X3056,0X3057,0X3058,0X3059,0X305A,0X305B,0X305C,0X305D,0X305E,0X305F,
-0X3060,0X3061,0X3062,0X3063,0X3064,0X3065,0X3066,0X3067,0X3068,0X3069,0X306A,0X306B,0X306C,0X306D,0X306E,0X306F,
-0X3070,0X3071,0X3072,0X3073,0X3074,0X3075,0X3076,0X3077,0X3078,0X3079,0X307A,0X307B,0X307C,0X307D,0X307E,0X307F,
-0X3080,0X3081,0X3082,0X3083,0X3084,0X3085,0X3086,0X3087,0X3088,0X3089,0X308A,0X308B,0X308C,0X308D,0X308E,0X308F,
-0X3090,0X3091,0X3092,0X3093,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X30A1,0X30A2,0X30A3,0X30A4,0X30A5,0X30A6,0X30A7,0X30A8,0X30A9,0X30AA,0X30AB,0X30AC,0X30AD,0X30AE,0X30AF,
-0X30B0,0X30B1,0X30B2,0X30B3,0X30B4,0X30B5,0X30B6,0X30B7,0X30B8,0X30B9,0X30BA,0X30BB,0X30BC,0X30BD,0X30BE,0X30BF,
-0X30C0,0X30C1,0X30C2,0X30C3,0X30C4,0X30C5,0X30C6,0X30C7,0X30C8,0X30C9,0X30CA,0X30CB,0X30CC,0X30CD,0X30CE,0X30CF,
-0X30D0,0X30D1,0X30D2,0X30D3,0X30D4,0X30D5,0X30D6,0X30D7,0X30D8,0X30D9,0X30DA,0X30DB,0X30DC,0X30DD,0X30DE,0X30DF,
-0X30E0,0X30E1,0X30E2,0X30E3,0X30E4,0X30E5,0X30E6,0X30E7,0X30E8,0X30E9,0X30EA,0X30EB,0X30EC,0X30ED,0X30EE,0X30EF,
-0X30F0,0X30F1,0X30F2,0X30F3,0X30F4,0X30F5,0X30F6,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0391,0X0392,0X0393,0X0394,0X0395,0X0396,0X0397,0X0398,0X0399,0X039A,0X039B,0X039C,0X039D,0X039E,0X039F,
-0X03A0,0X03A1,0X03A3,0X03A4,0X03A5,0X03A6,0X03A7,0X03A8,0X03A9,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X03B1,0X03B2,0X03B3,0X03B4,0X03B5,0X03B6,0X03B7,0X03B8,0X03B9,0X03BA,0X03BB,0X03BC,0X03BD,0X03BE,0X03BF,
-0X03C0,0X03C1,0X03C3,0X03C4,0X03C5,0X03C6,0X03C7,0X03C8,0X03C9,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0XFE35,0XFE36,0XFE39,0XFE3A,0XFE3F,0XFE40,0XFE3D,0XFE3E,0XFE41,0XFE42,0XFE43,0XFE44,0X0001,0X0001,0XFE3B,0XFE3C,
-0XFE37,0XFE38,0XFE31,0X0001,0XFE33,0XFE34,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0410,0X0411,0X0412,0X0413,0X0414,0X0415,0X0401,0X0416,0X0417,0X0418,0X0419,0X041A,0X041B,0X041C,0X041D,
-0X041E,0X041F,0X0420,0X0421,0X0422,0X0423,0X0424,0X0425,0X0426,0X0427,0X0428,0X0429,0X042A,0X042B,0X042C,0X042D,
-0X042E,0X042F,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0430,0X0431,0X0432,0X0433,0X0434,0X0435,0X0451,0X0436,0X0437,0X0438,0X0439,0X043A,0X043B,0X043C,0X043D,
-0X043E,0X043F,0X0440,0X0441,0X0442,0X0443,0X0444,0X0445,0X0446,0X0447,0X0448,0X0449,0X044A,0X044B,0X044C,0X044D,
-0X044E,0X044F,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X02CA,0X02CB,0X02D9,0X2013,0X2015,0X2025,0X2035,0X2105,0X2109,0X2196,0X2197,0X2198,0X2199,0X2215,0X221F,0X2223,
-0X2252,0X2266,0X2267,0X22BF,0X2550,0X2551,0X2552,0X2553,0X2554,0X2555,0X2556,0X2557,0X2558,0X2559,0X255A,0X255B,
-0X255C,0X255D,0X255E,0X255F,0X2560,0X2561,0X2562,0X2563,0X2564,0X2565,0X2566,0X2567,0X2568,0X2569,0X256A,0X256B,
-0X256C,0X256D,0X256E,0X256F,0X2570,0X2571,0X2572,0X2573,0X2581,0X2582,0X2583,0X2584,0X2585,0X2586,0X2587,0X0001,
-0X2588,0X2589,0X258A,0X258B,0X258C,0X258D,0X258E,0X258F,0X2593,0X2594,0X2595,0X25BC,0X25BD,0X25E2,0X25E3,0X25E4,
-0X25E5,0X2609,0X2295,0X3012,0X301D,0X301E,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0101,0X00E1,0X01CE,0X00E0,0X0113,0X00E9,0X011B,0X00E8,0X012B,0X00ED,0X01D0,0X00EC,0X014D,0X00F3,0X01D2,
-0X00F2,0X016B,0X00FA,0X01D4,0X00F9,0X01D6,0X01D8,0X01DA,0X01DC,0X00FC,0X00EA,0X0251,0X0001,0X0144,0X0148,0X0001,
-0X0261,0X0001,0X0001,0X0001,0X0001,0X3105,0X3106,0X3107,0X3108,0X3109,0X310A,0X310B,0X310C,0X310D,0X310E,0X310F,
-0X3110,0X3111,0X3112,0X3113,0X3114,0X3115,0X3116,0X3117,0X3118,0X3119,0X311A,0X311B,0X311C,0X311D,0X311E,0X311F,
-0X3120,0X3121,0X3122,0X3123,0X3124,0X3125,0X3126,0X3127,0X3128,0X3129,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X3021,0X3022,0X3023,0X3024,0X3025,0X3026,0X3027,0X3028,0X3029,0X32A3,0X338E,0X338F,0X339C,0X339D,0X339E,0X33A1,
-0X33C4,0X33CE,0X33D1,0X33D2,0X33D5,0XFE30,0XFFE2,0XFFE4,0X0001,0X2121,0X3231,0X0001,0X2010,0X0001,0X0001,0X0001,
-0X30FC,0X309B,0X309C,0X30FD,0X30FE,0X3006,0X309D,0X309E,0XFE49,0XFE4A,0XFE4B,0XFE4C,0XFE4D,0XFE4E,0XFE4F,0XFE50,
-0XFE51,0XFE52,0XFE54,0XFE55,0XFE56,0XFE57,0XFE59,0XFE5A,0XFE5B,0XFE5C,0XFE5D,0XFE5E,0XFE5F,0XFE60,0XFE61,0X0001,
-0XFE62,0XFE63,0XFE64,0XFE65,0XFE66,0XFE68,0XFE69,0XFE6A,0XFE6B,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X3007,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X2500,0X2501,0X2502,0X2503,0X2504,0X2505,0X2506,0X2507,0X2508,0X2509,0X250A,0X250B,
-0X250C,0X250D,0X250E,0X250F,0X2510,0X2511,0X2512,0X2513,0X2514,0X2515,0X2516,0X2517,0X2518,0X2519,0X251A,0X251B,
-0X251C,0X251D,0X251E,0X251F,0X2520,0X2521,0X2522,0X2523,0X2524,0X2525,0X2526,0X2527,0X2528,0X2529,0X252A,0X252B,
-0X252C,0X252D,0X252E,0X252F,0X2530,0X2531,0X2532,0X2533,0X2534,0X2535,0X2536,0X2537,0X2538,0X2539,0X253A,0X253B,
-0X253C,0X253D,0X253E,0X253F,0X2540,0X2541,0X2542,0X2543,0X2544,0X2545,0X2546,0X2547,0X2548,0X2549,0X254A,0X254B,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X72DC,0X72DD,0X72DF,0X72E2,0X72E3,0X72E4,0X72E5,0X72E6,0X72E7,0X72EA,0X72EB,0X72F5,0X72F6,0X72F9,0X72FD,0X72FE,
-0X72FF,0X7300,0X7302,0X7304,0X7305,0X7306,0X7307,0X7308,0X7309,0X730B,0X730C,0X730D,0X730F,0X7310,0X7311,0X7312,
-0X7314,0X7318,0X7319,0X731A,0X731F,0X7320,0X7323,0X7324,0X7326,0X7327,0X7328,0X732D,0X732F,0X7330,0X7332,0X7333,
-0X7335,0X7336,0X733A,0X733B,0X733C,0X733D,0X7340,0X7341,0X7342,0X7343,0X7344,0X7345,0X7346,0X7347,0X7348,0X0001,
-0X7349,0X734A,0X734B,0X734C,0X734E,0X734F,0X7351,0X7353,0X7354,0X7355,0X7356,0X7358,0X7359,0X735A,0X735B,0X735C,
-0X735D,0X735E,0X735F,0X7361,0X7362,0X7363,0X7364,0X7365,0X7366,0X7367,0X7368,0X7369,0X736A,0X736B,0X736E,0X7370,
-0X7371,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X7372,0X7373,0X7374,0X7375,0X7376,0X7377,0X7378,0X7379,0X737A,0X737B,0X737C,0X737D,0X737F,0X7380,0X7381,0X7382,
-0X7383,0X7385,0X7386,0X7388,0X738A,0X738C,0X738D,0X738F,0X7390,0X7392,0X7393,0X7394,0X7395,0X7397,0X7398,0X7399,
-0X739A,0X739C,0X739D,0X739E,0X73A0,0X73A1,0X73A3,0X73A4,0X73A5,0X73A6,0X73A7,0X73A8,0X73AA,0X73AC,0X73AD,0X73B1,
-0X73B4,0X73B5,0X73B6,0X73B8,0X73B9,0X73BC,0X73BD,0X73BE,0X73BF,0X73C1,0X73C3,0X73C4,0X73C5,0X73C6,0X73C7,0X0001,
-0X73CB,0X73CC,0X73CE,0X73D2,0X73D3,0X73D4,0X73D5,0X73D6,0X73D7,0X73D8,0X73DA,0X73DB,0X73DC,0X73DD,0X73DF,0X73E1,
-0X73E2,0X73E3,0X73E4,0X73E6,0X73E8,0X73EA,0X73EB,0X73EC,0X73EE,0X73EF,0X73F0,0X73F1,0X73F3,0X73F4,0X73F5,0X73F6,
-0X73F7,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X73F8,0X73F9,0X73FA,0X73FB,0X73FC,0X73FD,0X73FE,0X73FF,0X7400,0X7401,0X7402,0X7404,0X7407,0X7408,0X740B,0X740C,
-0X740D,0X740E,0X7411,0X7412,0X7413,0X7414,0X7415,0X7416,0X7417,0X7418,0X7419,0X741C,0X741D,0X741E,0X741F,0X7420,
-0X7421,0X7423,0X7424,0X7427,0X7429,0X742B,0X742D,0X742F,0X7431,0X7432,0X7437,0X7438,0X7439,0X743A,0X743B,0X743D,
-0X743E,0X743F,0X7440,0X7442,0X7443,0X7444,0X7445,0X7446,0X7447,0X7448,0X7449,0X744A,0X744B,0X744C,0X744D,0X0001,
-0X744E,0X744F,0X7450,0X7451,0X7452,0X7453,0X7454,0X7456,0X7458,0X745D,0X7460,0X7461,0X7462,0X7463,0X7464,0X7465,
-0X7466,0X7467,0X7468,0X7469,0X746A,0X746B,0X746C,0X746E,0X746F,0X7471,0X7472,0X7473,0X7474,0X7475,0X7478,0X7479,
-0X747A,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X747B,0X747C,0X747D,0X747F,0X7482,0X7484,0X7485,0X7486,0X7488,0X7489,0X748A,0X748C,0X748D,0X748F,0X7491,0X7492,
-0X7493,0X7494,0X7495,0X7496,0X7497,0X7498,0X7499,0X749A,0X749B,0X749D,0X749F,0X74A0,0X74A1,0X74A2,0X74A3,0X74A4,
-0X74A5,0X74A6,0X74AA,0X74AB,0X74AC,0X74AD,0X74AE,0X74AF,0X74B0,0X74B1,0X74B2,0X74B3,0X74B4,0X74B5,0X74B6,0X74B7,
-0X74B8,0X74B9,0X74BB,0X74BC,0X74BD,0X74BE,0X74BF,0X74C0,0X74C1,0X74C2,0X74C3,0X74C4,0X74C5,0X74C6,0X74C7,0X0001,
-0X74C8,0X74C9,0X74CA,0X74CB,0X74CC,0X74CD,0X74CE,0X74CF,0X74D0,0X74D1,0X74D3,0X74D4,0X74D5,0X74D6,0X74D7,0X74D8,
-0X74D9,0X74DA,0X74DB,0X74DD,0X74DF,0X74E1,0X74E5,0X74E7,0X74E8,0X74E9,0X74EA,0X74EB,0X74EC,0X74ED,0X74F0,0X74F1,
-0X74F2,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X74F3,0X74F5,0X74F8,0X74F9,0X74FA,0X74FB,0X74FC,0X74FD,0X74FE,0X7500,0X7501,0X7502,0X7503,0X7505,0X7506,0X7507,
-0X7508,0X7509,0X750A,0X750B,0X750C,0X750E,0X7510,0X7512,0X7514,0X7515,0X7516,0X7517,0X751B,0X751D,0X751E,0X7520,
-0X7521,0X7522,0X7523,0X7524,0X7526,0X7527,0X752A,0X752E,0X7534,0X7536,0X7539,0X753C,0X753D,0X753F,0X7541,0X7542,
-0X7543,0X7544,0X7546,0X7547,0X7549,0X754A,0X754D,0X7550,0X7551,0X7552,0X7553,0X7555,0X7556,0X7557,0X7558,0X0001,
-0X755D,0X755E,0X755F,0X7560,0X7561,0X7562,0X7563,0X7564,0X7567,0X7568,0X7569,0X756B,0X756C,0X756D,0X756E,0X756F,
-0X7570,0X7571,0X7573,0X7575,0X7576,0X7577,0X757A,0X757B,0X757C,0X757D,0X757E,0X7580,0X7581,0X7582,0X7584,0X7585,
-0X7587,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X7588,0X7589,0X758A,0X758C,0X758D,0X758E,0X7590,0X7593,0X7595,0X7598,0X759B,0X759C,0X759E,0X75A2,0X75A6,0X75A7,
-0X75A8,0X75A9,0X75AA,0X75AD,0X75B6,0X75B7,0X75BA,0X75BB,0X75BF,0X75C0,0X75C1,0X75C6,0X75CB,0X75CC,0X75CE,0X75CF,
-0X75D0,0X75D1,0X75D3,0X75D7,0X75D9,0X75DA,0X75DC,0X75DD,0X75DF,0X75E0,0X75E1,0X75E5,0X75E9,0X75EC,0X75ED,0X75EE,
-0X75EF,0X75F2,0X75F3,0X75F5,0X75F6,0X75F7,0X75F8,0X75FA,0X75FB,0X75FD,0X75FE,0X7602,0X7604,0X7606,0X7607,0X0001,
-0X7608,0X7609,0X760B,0X760D,0X760E,0X760F,0X7611,0X7612,0X7613,0X7614,0X7616,0X761A,0X761C,0X761D,0X761E,0X7621,
-0X7623,0X7627,0X7628,0X762C,0X762E,0X762F,0X7631,0X7632,0X7636,0X7637,0X7639,0X763A,0X763B,0X763D,0X7641,0X7642,
-0X7644,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X7645,0X7646,0X7647,0X7648,0X7649,0X764A,0X764B,0X764E,0X764F,0X7650,0X7651,0X7652,0X7653,0X7655,0X7657,0X7658,
-0X7659,0X765A,0X765B,0X765D,0X765F,0X7660,0X7661,0X7662,0X7664,0X7665,0X7666,0X7667,0X7668,0X7669,0X766A,0X766C,
-0X766D,0X766E,0X7670,0X7671,0X7672,0X7673,0X7674,0X7675,0X7676,0X7677,0X7679,0X767A,0X767C,0X767F,0X7680,0X7681,
-0X7683,0X7685,0X7689,0X768A,0X768C,0X768D,0X768F,0X7690,0X7692,0X7694,0X7695,0X7697,0X7698,0X769A,0X769B,0X0001,
-0X769C,0X769D,0X769E,0X769F,0X76A0,0X76A1,0X76A2,0X76A3,0X76A5,0X76A6,0X76A7,0X76A8,0X76A9,0X76AA,0X76AB,0X76AC,
-0X76AD,0X76AF,0X76B0,0X76B3,0X76B5,0X76B6,0X76B7,0X76B8,0X76B9,0X76BA,0X76BB,0X76BC,0X76BD,0X76BE,0X76C0,0X76C1,
-0X76C3,0X554A,0X963F,0X57C3,0X6328,0X54CE,0X5509,0X54C0,0X7691,0X764C,0X853C,0X77EE,0X827E,0X788D,0X7231,0X9698,
-0X978D,0X6C28,0X5B89,0X4FFA,0X6309,0X6697,0X5CB8,0X80FA,0X6848,0X80AE,0X6602,0X76CE,0X51F9,0X6556,0X71AC,0X7FF1,
-0X8884,0X50B2,0X5965,0X61CA,0X6FB3,0X82AD,0X634C,0X6252,0X53ED,0X5427,0X7B06,0X516B,0X75A4,0X5DF4,0X62D4,0X8DCB,
-0X9776,0X628A,0X8019,0X575D,0X9738,0X7F62,0X7238,0X767D,0X67CF,0X767E,0X6446,0X4F70,0X8D25,0X62DC,0X7A17,0X6591,
-0X73ED,0X642C,0X6273,0X822C,0X9881,0X677F,0X7248,0X626E,0X62CC,0X4F34,0X74E3,0X534A,0X529E,0X7ECA,0X90A6,0X5E2E,
-0X6886,0X699C,0X8180,0X7ED1,0X68D2,0X78C5,0X868C,0X9551,0X508D,0X8C24,0X82DE,0X80DE,0X5305,0X8912,0X5265,0X0001,
-0X76C4,0X76C7,0X76C9,0X76CB,0X76CC,0X76D3,0X76D5,0X76D9,0X76DA,0X76DC,0X76DD,0X76DE,0X76E0,0X76E1,0X76E2,0X76E3,
-0X76E4,0X76E6,0X76E7,0X76E8,0X76E9,0X76EA,0X76EB,0X76EC,0X76ED,0X76F0,0X76F3,0X76F5,0X76F6,0X76F7,0X76FA,0X76FB,
-0X76FD,0X76FF,0X7700,0X7702,0X7703,0X7705,0X7706,0X770A,0X770C,0X770E,0X770F,0X7710,0X7711,0X7712,0X7713,0X7714,
-0X7715,0X7716,0X7717,0X7718,0X771B,0X771C,0X771D,0X771E,0X7721,0X7723,0X7724,0X7725,0X7727,0X772A,0X772B,0X0001,
-0X772C,0X772E,0X7730,0X7731,0X7732,0X7733,0X7734,0X7739,0X773B,0X773D,0X773E,0X773F,0X7742,0X7744,0X7745,0X7746,
-0X7748,0X7749,0X774A,0X774B,0X774C,0X774D,0X774E,0X774F,0X7752,0X7753,0X7754,0X7755,0X7756,0X7757,0X7758,0X7759,
-0X775C,0X8584,0X96F9,0X4FDD,0X5821,0X9971,0X5B9D,0X62B1,0X62A5,0X66B4,0X8C79,0X9C8D,0X7206,0X676F,0X7891,0X60B2,
-0X5351,0X5317,0X8F88,0X80CC,0X8D1D,0X94A1,0X500D,0X72C8,0X5907,0X60EB,0X7119,0X88AB,0X5954,0X82EF,0X672C,0X7B28,
-0X5D29,0X7EF7,0X752D,0X6CF5,0X8E66,0X8FF8,0X903C,0X9F3B,0X6BD4,0X9119,0X7B14,0X5F7C,0X78A7,0X84D6,0X853D,0X6BD5,
-0X6BD9,0X6BD6,0X5E01,0X5E87,0X75F9,0X95ED,0X655D,0X5F0A,0X5FC5,0X8F9F,0X58C1,0X81C2,0X907F,0X965B,0X97AD,0X8FB9,
-0X7F16,0X8D2C,0X6241,0X4FBF,0X53D8,0X535E,0X8FA8,0X8FA9,0X8FAB,0X904D,0X6807,0X5F6A,0X8198,0X8868,0X9CD6,0X618B,
-0X522B,0X762A,0X5F6C,0X658C,0X6FD2,0X6EE8,0X5BBE,0X6448,0X5175,0X51B0,0X67C4,0X4E19,0X79C9,0X997C,0X70B3,0X0001,
-0X775D,0X775E,0X775F,0X7760,0X7764,0X7767,0X7769,0X776A,0X776D,0X776E,0X776F,0X7770,0X7771,0X7772,0X7773,0X7774,
-0X7775,0X7776,0X7777,0X7778,0X777A,0X777B,0X777C,0X7781,0X7782,0X7783,0X7786,0X7787,0X7788,0X7789,0X778A,0X778B,
-0X778F,0X7790,0X7793,0X7794,0X7795,0X7796,0X7797,0X7798,0X7799,0X779A,0X779B,0X779C,0X779D,0X779E,0X77A1,0X77A3,
-0X77A4,0X77A6,0X77A8,0X77AB,0X77AD,0X77AE,0X77AF,0X77B1,0X77B2,0X77B4,0X77B6,0X77B7,0X77B8,0X77B9,0X77BA,0X0001,
-0X77BC,0X77BE,0X77C0,0X77C1,0X77C2,0X77C3,0X77C4,0X77C5,0X77C6,0X77C7,0X77C8,0X77C9,0X77CA,0X77CB,0X77CC,0X77CE,
-0X77CF,0X77D0,0X77D1,0X77D2,0X77D3,0X77D4,0X77D5,0X77D6,0X77D8,0X77D9,0X77DA,0X77DD,0X77DE,0X77DF,0X77E0,0X77E1,
-0X77E4,0X75C5,0X5E76,0X73BB,0X83E0,0X64AD,0X62E8,0X94B5,0X6CE2,0X535A,0X52C3,0X640F,0X94C2,0X7B94,0X4F2F,0X5E1B,
-0X8236,0X8116,0X818A,0X6E24,0X6CCA,0X9A73,0X6355,0X535C,0X54FA,0X8865,0X57E0,0X4E0D,0X5E03,0X6B65,0X7C3F,0X90E8,
-0X6016,0X64E6,0X731C,0X88C1,0X6750,0X624D,0X8D22,0X776C,0X8E29,0X91C7,0X5F69,0X83DC,0X8521,0X9910,0X53C2,0X8695,
-0X6B8B,0X60ED,0X60E8,0X707F,0X82CD,0X8231,0X4ED3,0X6CA7,0X85CF,0X64CD,0X7CD9,0X69FD,0X66F9,0X8349,0X5395,0X7B56,
-0X4FA7,0X518C,0X6D4B,0X5C42,0X8E6D,0X63D2,0X53C9,0X832C,0X8336,0X67E5,0X78B4,0X643D,0X5BDF,0X5C94,0X5DEE,0X8BE7,
-0X62C6,0X67F4,0X8C7A,0X6400,0X63BA,0X8749,0X998B,0X8C17,0X7F20,0X94F2,0X4EA7,0X9610,0X98A4,0X660C,0X7316,0X0001,
-0X77E6,0X77E8,0X77EA,0X77EF,0X77F0,0X77F1,0X77F2,0X77F4,0X77F5,0X77F7,0X77F9,0X77FA,0X77FB,0X77FC,0X7803,0X7804,
-0X7805,0X7806,0X7807,0X7808,0X780A,0X780B,0X780E,0X780F,0X7810,0X7813,0X7815,0X7819,0X781B,0X781E,0X7820,0X7821,
-0X7822,0X7824,0X7828,0X782A,0X782B,0X782E,0X782F,0X7831,0X7832,0X7833,0X7835,0X7836,0X783D,0X783F,0X7841,0X7842,
-0X7843,0X7844,0X7846,0X7848,0X7849,0X784A,0X784B,0X784D,0X784F,0X7851,0X7853,0X7854,0X7858,0X7859,0X785A,0X0001,
-0X785B,0X785C,0X785E,0X785F,0X7860,0X7861,0X7862,0X7863,0X7864,0X7865,0X7866,0X7867,0X7868,0X7869,0X786F,0X7870,
-0X7871,0X7872,0X7873,0X7874,0X7875,0X7876,0X7878,0X7879,0X787A,0X787B,0X787D,0X787E,0X787F,0X7880,0X7881,0X7882,
-0X7883,0X573A,0X5C1D,0X5E38,0X957F,0X507F,0X80A0,0X5382,0X655E,0X7545,0X5531,0X5021,0X8D85,0X6284,0X949E,0X671D,
-0X5632,0X6F6E,0X5DE2,0X5435,0X7092,0X8F66,0X626F,0X64A4,0X63A3,0X5F7B,0X6F88,0X90F4,0X81E3,0X8FB0,0X5C18,0X6668,
-0X5FF1,0X6C89,0X9648,0X8D81,0X886C,0X6491,0X79F0,0X57CE,0X6A59,0X6210,0X5448,0X4E58,0X7A0B,0X60E9,0X6F84,0X8BDA,
-0X627F,0X901E,0X9A8B,0X79E4,0X5403,0X75F4,0X6301,0X5319,0X6C60,0X8FDF,0X5F1B,0X9A70,0X803B,0X9F7F,0X4F88,0X5C3A,
-0X8D64,0X7FC5,0X65A5,0X70BD,0X5145,0X51B2,0X866B,0X5D07,0X5BA0,0X62BD,0X916C,0X7574,0X8E0C,0X7A20,0X6101,0X7B79,
-0X4EC7,0X7EF8,0X7785,0X4E11,0X81ED,0X521D,0X51FA,0X6A71,0X53A8,0X8E87,0X9504,0X96CF,0X6EC1,0X9664,0X695A,0X0001,
-0X7884,0X7885,0X7886,0X7888,0X788A,0X788B,0X788F,0X7890,0X7892,0X7894,0X7895,0X7896,0X7899,0X789D,0X789E,0X78A0,
-0X78A2,0X78A4,0X78A6,0X78A8,0X78A9,0X78AA,0X78AB,0X78AC,0X78AD,0X78AE,0X78AF,0X78B5,0X78B6,0X78B7,0X78B8,0X78BA,
-0X78BB,0X78BC,0X78BD,0X78BF,0X78C0,0X78C2,0X78C3,0X78C4,0X78C6,0X78C7,0X78C8,0X78CC,0X78CD,0X78CE,0X78CF,0X78D1,
-0X78D2,0X78D3,0X78D6,0X78D7,0X78D8,0X78DA,0X78DB,0X78DC,0X78DD,0X78DE,0X78DF,0X78E0,0X78E1,0X78E2,0X78E3,0X0001,
-0X78E4,0X78E5,0X78E6,0X78E7,0X78E9,0X78EA,0X78EB,0X78ED,0X78EE,0X78EF,0X78F0,0X78F1,0X78F3,0X78F5,0X78F6,0X78F8,
-0X78F9,0X78FB,0X78FC,0X78FD,0X78FE,0X78FF,0X7900,0X7902,0X7903,0X7904,0X7906,0X7907,0X7908,0X7909,0X790A,0X790B,
-0X790C,0X7840,0X50A8,0X77D7,0X6410,0X89E6,0X5904,0X63E3,0X5DDD,0X7A7F,0X693D,0X4F20,0X8239,0X5598,0X4E32,0X75AE,
-0X7A97,0X5E62,0X5E8A,0X95EF,0X521B,0X5439,0X708A,0X6376,0X9524,0X5782,0X6625,0X693F,0X9187,0X5507,0X6DF3,0X7EAF,
-0X8822,0X6233,0X7EF0,0X75B5,0X8328,0X78C1,0X96CC,0X8F9E,0X6148,0X74F7,0X8BCD,0X6B64,0X523A,0X8D50,0X6B21,0X806A,
-0X8471,0X56F1,0X5306,0X4ECE,0X4E1B,0X51D1,0X7C97,0X918B,0X7C07,0X4FC3,0X8E7F,0X7BE1,0X7A9C,0X6467,0X5D14,0X50AC,
-0X8106,0X7601,0X7CB9,0X6DEC,0X7FE0,0X6751,0X5B58,0X5BF8,0X78CB,0X64AE,0X6413,0X63AA,0X632B,0X9519,0X642D,0X8FBE,
-0X7B54,0X7629,0X6253,0X5927,0X5446,0X6B79,0X50A3,0X6234,0X5E26,0X6B86,0X4EE3,0X8D37,0X888B,0X5F85,0X902E,0X0001,
-0X790D,0X790E,0X790F,0X7910,0X7911,0X7912,0X7914,0X7915,0X7916,0X7917,0X7918,0X7919,0X791A,0X791B,0X791C,0X791D,
-0X791F,0X7920,0X7921,0X7922,0X7923,0X7925,0X7926,0X7927,0X7928,0X7929,0X792A,0X792B,0X792C,0X792D,0X792E,0X792F,
-0X7930,0X7931,0X7932,0X7933,0X7935,0X7936,0X7937,0X7938,0X7939,0X793D,0X793F,0X7942,0X7943,0X7944,0X7945,0X7947,
-0X794A,0X794B,0X794C,0X794D,0X794E,0X794F,0X7950,0X7951,0X7952,0X7954,0X7955,0X7958,0X7959,0X7961,0X7963,0X0001,
-0X7964,0X7966,0X7969,0X796A,0X796B,0X796C,0X796E,0X7970,0X7971,0X7972,0X7973,0X7974,0X7975,0X7976,0X7979,0X797B,
-0X797C,0X797D,0X797E,0X797F,0X7982,0X7983,0X7986,0X7987,0X7988,0X7989,0X798B,0X798C,0X798D,0X798E,0X7990,0X7991,
-0X7992,0X6020,0X803D,0X62C5,0X4E39,0X5355,0X90F8,0X63B8,0X80C6,0X65E6,0X6C2E,0X4F46,0X60EE,0X6DE1,0X8BDE,0X5F39,
-0X86CB,0X5F53,0X6321,0X515A,0X8361,0X6863,0X5200,0X6363,0X8E48,0X5012,0X5C9B,0X7977,0X5BFC,0X5230,0X7A3B,0X60BC,
-0X9053,0X76D7,0X5FB7,0X5F97,0X7684,0X8E6C,0X706F,0X767B,0X7B49,0X77AA,0X51F3,0X9093,0X5824,0X4F4E,0X6EF4,0X8FEA,
-0X654C,0X7B1B,0X72C4,0X6DA4,0X7FDF,0X5AE1,0X62B5,0X5E95,0X5730,0X8482,0X7B2C,0X5E1D,0X5F1F,0X9012,0X7F14,0X98A0,
-0X6382,0X6EC7,0X7898,0X70B9,0X5178,0X975B,0X57AB,0X7535,0X4F43,0X7538,0X5E97,0X60E6,0X5960,0X6DC0,0X6BBF,0X7889,
-0X53FC,0X96D5,0X51CB,0X5201,0X6389,0X540A,0X9493,0X8C03,0X8DCC,0X7239,0X789F,0X8776,0X8FED,0X8C0D,0X53E0,0X0001,
-0X7993,0X7994,0X7995,0X7996,0X7997,0X7998,0X7999,0X799B,0X799C,0X799D,0X799E,0X799F,0X79A0,0X79A1,0X79A2,0X79A3,
-0X79A4,0X79A5,0X79A6,0X79A8,0X79A9,0X79AA,0X79AB,0X79AC,0X79AD,0X79AE,0X79AF,0X79B0,0X79B1,0X79B2,0X79B4,0X79B5,
-0X79B6,0X79B7,0X79B8,0X79BC,0X79BF,0X79C2,0X79C4,0X79C5,0X79C7,0X79C8,0X79CA,0X79CC,0X79CE,0X79CF,0X79D0,0X79D3,
-0X79D4,0X79D6,0X79D7,0X79D9,0X79DA,0X79DB,0X79DC,0X79DD,0X79DE,0X79E0,0X79E1,0X79E2,0X79E5,0X79E8,0X79EA,0X0001,
-0X79EC,0X79EE,0X79F1,0X79F2,0X79F3,0X79F4,0X79F5,0X79F6,0X79F7,0X79F9,0X79FA,0X79FC,0X79FE,0X79FF,0X7A01,0X7A04,
-0X7A05,0X7A07,0X7A08,0X7A09,0X7A0A,0X7A0C,0X7A0F,0X7A10,0X7A11,0X7A12,0X7A13,0X7A15,0X7A16,0X7A18,0X7A19,0X7A1B,
-0X7A1C,0X4E01,0X76EF,0X53EE,0X9489,0X9876,0X9F0E,0X952D,0X5B9A,0X8BA2,0X4E22,0X4E1C,0X51AC,0X8463,0X61C2,0X52A8,
-0X680B,0X4F97,0X606B,0X51BB,0X6D1E,0X515C,0X6296,0X6597,0X9661,0X8C46,0X9017,0X75D8,0X90FD,0X7763,0X6BD2,0X728A,
-0X72EC,0X8BFB,0X5835,0X7779,0X8D4C,0X675C,0X9540,0X809A,0X5EA6,0X6E21,0X5992,0X7AEF,0X77ED,0X953B,0X6BB5,0X65AD,
-0X7F0E,0X5806,0X5151,0X961F,0X5BF9,0X58A9,0X5428,0X8E72,0X6566,0X987F,0X56E4,0X949D,0X76FE,0X9041,0X6387,0X54C6,
-0X591A,0X593A,0X579B,0X8EB2,0X6735,0X8DFA,0X8235,0X5241,0X60F0,0X5815,0X86FE,0X5CE8,0X9E45,0X4FC4,0X989D,0X8BB9,
-0X5A25,0X6076,0X5384,0X627C,0X904F,0X9102,0X997F,0X6069,0X800C,0X513F,0X8033,0X5C14,0X9975,0X6D31,0X4E8C,0X0001,
-0X7A1D,0X7A1F,0X7A21,0X7A22,0X7A24,0X7A25,0X7A26,0X7A27,0X7A28,0X7A29,0X7A2A,0X7A2B,0X7A2C,0X7A2D,0X7A2E,0X7A2F,
-0X7A30,0X7A31,0X7A32,0X7A34,0X7A35,0X7A36,0X7A38,0X7A3A,0X7A3E,0X7A40,0X7A41,0X7A42,0X7A43,0X7A44,0X7A45,0X7A47,
-0X7A48,0X7A49,0X7A4A,0X7A4B,0X7A4C,0X7A4D,0X7A4E,0X7A4F,0X7A50,0X7A52,0X7A53,0X7A54,0X7A55,0X7A56,0X7A58,0X7A59,
-0X7A5A,0X7A5B,0X7A5C,0X7A5D,0X7A5E,0X7A5F,0X7A60,0X7A61,0X7A62,0X7A63,0X7A64,0X7A65,0X7A66,0X7A67,0X7A68,0X0001,
-0X7A69,0X7A6A,0X7A6B,0X7A6C,0X7A6D,0X7A6E,0X7A6F,0X7A71,0X7A72,0X7A73,0X7A75,0X7A7B,0X7A7C,0X7A7D,0X7A7E,0X7A82,
-0X7A85,0X7A87,0X7A89,0X7A8A,0X7A8B,0X7A8C,0X7A8E,0X7A8F,0X7A90,0X7A93,0X7A94,0X7A99,0X7A9A,0X7A9B,0X7A9E,0X7AA1,
-0X7AA2,0X8D30,0X53D1,0X7F5A,0X7B4F,0X4F10,0X4E4F,0X9600,0X6CD5,0X73D0,0X85E9,0X5E06,0X756A,0X7FFB,0X6A0A,0X77FE,
-0X9492,0X7E41,0X51E1,0X70E6,0X53CD,0X8FD4,0X8303,0X8D29,0X72AF,0X996D,0X6CDB,0X574A,0X82B3,0X65B9,0X80AA,0X623F,
-0X9632,0X59A8,0X4EFF,0X8BBF,0X7EBA,0X653E,0X83F2,0X975E,0X5561,0X98DE,0X80A5,0X532A,0X8BFD,0X5420,0X80BA,0X5E9F,
-0X6CB8,0X8D39,0X82AC,0X915A,0X5429,0X6C1B,0X5206,0X7EB7,0X575F,0X711A,0X6C7E,0X7C89,0X594B,0X4EFD,0X5FFF,0X6124,
-0X7CAA,0X4E30,0X5C01,0X67AB,0X8702,0X5CF0,0X950B,0X98CE,0X75AF,0X70FD,0X9022,0X51AF,0X7F1D,0X8BBD,0X5949,0X51E4,
-0X4F5B,0X5426,0X592B,0X6577,0X80A4,0X5B75,0X6276,0X62C2,0X8F90,0X5E45,0X6C1F,0X7B26,0X4F0F,0X4FD8,0X670D,0X0001,
-0X7AA3,0X7AA4,0X7AA7,0X7AA9,0X7AAA,0X7AAB,0X7AAE,0X7AAF,0X7AB0,0X7AB1,0X7AB2,0X7AB4,0X7AB5,0X7AB6,0X7AB7,0X7AB8,
-0X7AB9,0X7ABA,0X7ABB,0X7ABC,0X7ABD,0X7ABE,0X7AC0,0X7AC1,0X7AC2,0X7AC3,0X7AC4,0X7AC5,0X7AC6,0X7AC7,0X7AC8,0X7AC9,
-0X7ACA,0X7ACC,0X7ACD,0X7ACE,0X7ACF,0X7AD0,0X7AD1,0X7AD2,0X7AD3,0X7AD4,0X7AD5,0X7AD7,0X7AD8,0X7ADA,0X7ADB,0X7ADC,
-0X7ADD,0X7AE1,0X7AE2,0X7AE4,0X7AE7,0X7AE8,0X7AE9,0X7AEA,0X7AEB,0X7AEC,0X7AEE,0X7AF0,0X7AF1,0X7AF2,0X7AF3,0X0001,
-0X7AF4,0X7AF5,0X7AF6,0X7AF7,0X7AF8,0X7AFB,0X7AFC,0X7AFE,0X7B00,0X7B01,0X7B02,0X7B05,0X7B07,0X7B09,0X7B0C,0X7B0D,
-0X7B0E,0X7B10,0X7B12,0X7B13,0X7B16,0X7B17,0X7B18,0X7B1A,0X7B1C,0X7B1D,0X7B1F,0X7B21,0X7B22,0X7B23,0X7B27,0X7B29,
-0X7B2D,0X6D6E,0X6DAA,0X798F,0X88B1,0X5F17,0X752B,0X629A,0X8F85,0X4FEF,0X91DC,0X65A7,0X812F,0X8151,0X5E9C,0X8150,
-0X8D74,0X526F,0X8986,0X8D4B,0X590D,0X5085,0X4ED8,0X961C,0X7236,0X8179,0X8D1F,0X5BCC,0X8BA3,0X9644,0X5987,0X7F1A,
-0X5490,0X5676,0X560E,0X8BE5,0X6539,0X6982,0X9499,0X76D6,0X6E89,0X5E72,0X7518,0X6746,0X67D1,0X7AFF,0X809D,0X8D76,
-0X611F,0X79C6,0X6562,0X8D63,0X5188,0X521A,0X94A2,0X7F38,0X809B,0X7EB2,0X5C97,0X6E2F,0X6760,0X7BD9,0X768B,0X9AD8,
-0X818F,0X7F94,0X7CD5,0X641E,0X9550,0X7A3F,0X544A,0X54E5,0X6B4C,0X6401,0X6208,0X9E3D,0X80F3,0X7599,0X5272,0X9769,
-0X845B,0X683C,0X86E4,0X9601,0X9694,0X94EC,0X4E2A,0X5404,0X7ED9,0X6839,0X8DDF,0X8015,0X66F4,0X5E9A,0X7FB9,0X0001,
-0X7B2F,0X7B30,0X7B32,0X7B34,0X7B35,0X7B36,0X7B37,0X7B39,0X7B3B,0X7B3D,0X7B3F,0X7B40,0X7B41,0X7B42,0X7B43,0X7B44,
-0X7B46,0X7B48,0X7B4A,0X7B4D,0X7B4E,0X7B53,0X7B55,0X7B57,0X7B59,0X7B5C,0X7B5E,0X7B5F,0X7B61,0X7B63,0X7B64,0X7B65,
-0X7B66,0X7B67,0X7B68,0X7B69,0X7B6A,0X7B6B,0X7B6C,0X7B6D,0X7B6F,0X7B70,0X7B73,0X7B74,0X7B76,0X7B78,0X7B7A,0X7B7C,
-0X7B7D,0X7B7F,0X7B81,0X7B82,0X7B83,0X7B84,0X7B86,0X7B87,0X7B88,0X7B89,0X7B8A,0X7B8B,0X7B8C,0X7B8E,0X7B8F,0X0001,
-0X7B91,0X7B92,0X7B93,0X7B96,0X7B98,0X7B99,0X7B9A,0X7B9B,0X7B9E,0X7B9F,0X7BA0,0X7BA3,0X7BA4,0X7BA5,0X7BAE,0X7BAF,
-0X7BB0,0X7BB2,0X7BB3,0X7BB5,0X7BB6,0X7BB7,0X7BB9,0X7BBA,0X7BBB,0X7BBC,0X7BBD,0X7BBE,0X7BBF,0X7BC0,0X7BC2,0X7BC3,
-0X7BC4,0X57C2,0X803F,0X6897,0X5DE5,0X653B,0X529F,0X606D,0X9F9A,0X4F9B,0X8EAC,0X516C,0X5BAB,0X5F13,0X5DE9,0X6C5E,
-0X62F1,0X8D21,0X5171,0X94A9,0X52FE,0X6C9F,0X82DF,0X72D7,0X57A2,0X6784,0X8D2D,0X591F,0X8F9C,0X83C7,0X5495,0X7B8D,
-0X4F30,0X6CBD,0X5B64,0X59D1,0X9F13,0X53E4,0X86CA,0X9AA8,0X8C37,0X80A1,0X6545,0X987E,0X56FA,0X96C7,0X522E,0X74DC,
-0X5250,0X5BE1,0X6302,0X8902,0X4E56,0X62D0,0X602A,0X68FA,0X5173,0X5B98,0X51A0,0X89C2,0X7BA1,0X9986,0X7F50,0X60EF,
-0X704C,0X8D2F,0X5149,0X5E7F,0X901B,0X7470,0X89C4,0X572D,0X7845,0X5F52,0X9F9F,0X95FA,0X8F68,0X9B3C,0X8BE1,0X7678,
-0X6842,0X67DC,0X8DEA,0X8D35,0X523D,0X8F8A,0X6EDA,0X68CD,0X9505,0X90ED,0X56FD,0X679C,0X88F9,0X8FC7,0X54C8,0X0001,
-0X7BC5,0X7BC8,0X7BC9,0X7BCA,0X7BCB,0X7BCD,0X7BCE,0X7BCF,0X7BD0,0X7BD2,0X7BD4,0X7BD5,0X7BD6,0X7BD7,0X7BD8,0X7BDB,
-0X7BDC,0X7BDE,0X7BDF,0X7BE0,0X7BE2,0X7BE3,0X7BE4,0X7BE7,0X7BE8,0X7BE9,0X7BEB,0X7BEC,0X7BED,0X7BEF,0X7BF0,0X7BF2,
-0X7BF3,0X7BF4,0X7BF5,0X7BF6,0X7BF8,0X7BF9,0X7BFA,0X7BFB,0X7BFD,0X7BFF,0X7C00,0X7C01,0X7C02,0X7C03,0X7C04,0X7C05,
-0X7C06,0X7C08,0X7C09,0X7C0A,0X7C0D,0X7C0E,0X7C10,0X7C11,0X7C12,0X7C13,0X7C14,0X7C15,0X7C17,0X7C18,0X7C19,0X0001,
-0X7C1A,0X7C1B,0X7C1C,0X7C1D,0X7C1E,0X7C20,0X7C21,0X7C22,0X7C23,0X7C24,0X7C25,0X7C28,0X7C29,0X7C2B,0X7C2C,0X7C2D,
-0X7C2E,0X7C2F,0X7C30,0X7C31,0X7C32,0X7C33,0X7C34,0X7C35,0X7C36,0X7C37,0X7C39,0X7C3A,0X7C3B,0X7C3C,0X7C3D,0X7C3E,
-0X7C42,0X9AB8,0X5B69,0X6D77,0X6C26,0X4EA5,0X5BB3,0X9A87,0X9163,0X61A8,0X90AF,0X97E9,0X542B,0X6DB5,0X5BD2,0X51FD,
-0X558A,0X7F55,0X7FF0,0X64BC,0X634D,0X65F1,0X61BE,0X608D,0X710A,0X6C57,0X6C49,0X592F,0X676D,0X822A,0X58D5,0X568E,
-0X8C6A,0X6BEB,0X90DD,0X597D,0X8017,0X53F7,0X6D69,0X5475,0X559D,0X8377,0X83CF,0X6838,0X79BE,0X548C,0X4F55,0X5408,
-0X76D2,0X8C89,0X9602,0X6CB3,0X6DB8,0X8D6B,0X8910,0X9E64,0X8D3A,0X563F,0X9ED1,0X75D5,0X5F88,0X72E0,0X6068,0X54FC,
-0X4EA8,0X6A2A,0X8861,0X6052,0X8F70,0X54C4,0X70D8,0X8679,0X9E3F,0X6D2A,0X5B8F,0X5F18,0X7EA2,0X5589,0X4FAF,0X7334,
-0X543C,0X539A,0X5019,0X540E,0X547C,0X4E4E,0X5FFD,0X745A,0X58F6,0X846B,0X80E1,0X8774,0X72D0,0X7CCA,0X6E56,0X0001,
-0X7C43,0X7C44,0X7C45,0X7C46,0X7C47,0X7C48,0X7C49,0X7C4A,0X7C4B,0X7C4C,0X7C4E,0X7C4F,0X7C50,0X7C51,0X7C52,0X7C53,
-0X7C54,0X7C55,0X7C56,0X7C57,0X7C58,0X7C59,0X7C5A,0X7C5B,0X7C5C,0X7C5D,0X7C5E,0X7C5F,0X7C60,0X7C61,0X7C62,0X7C63,
-0X7C64,0X7C65,0X7C66,0X7C67,0X7C68,0X7C69,0X7C6A,0X7C6B,0X7C6C,0X7C6D,0X7C6E,0X7C6F,0X7C70,0X7C71,0X7C72,0X7C75,
-0X7C76,0X7C77,0X7C78,0X7C79,0X7C7A,0X7C7E,0X7C7F,0X7C80,0X7C81,0X7C82,0X7C83,0X7C84,0X7C85,0X7C86,0X7C87,0X0001,
-0X7C88,0X7C8A,0X7C8B,0X7C8C,0X7C8D,0X7C8E,0X7C8F,0X7C90,0X7C93,0X7C94,0X7C96,0X7C99,0X7C9A,0X7C9B,0X7CA0,0X7CA1,
-0X7CA3,0X7CA6,0X7CA7,0X7CA8,0X7CA9,0X7CAB,0X7CAC,0X7CAD,0X7CAF,0X7CB0,0X7CB4,0X7CB5,0X7CB6,0X7CB7,0X7CB8,0X7CBA,
-0X7CBB,0X5F27,0X864E,0X552C,0X62A4,0X4E92,0X6CAA,0X6237,0X82B1,0X54D7,0X534E,0X733E,0X6ED1,0X753B,0X5212,0X5316,
-0X8BDD,0X69D0,0X5F8A,0X6000,0X6DEE,0X574F,0X6B22,0X73AF,0X6853,0X8FD8,0X7F13,0X6362,0X60A3,0X5524,0X75EA,0X8C62,
-0X7115,0X6DA3,0X5BA6,0X5E7B,0X8352,0X614C,0X9EC4,0X78FA,0X8757,0X7C27,0X7687,0X51F0,0X60F6,0X714C,0X6643,0X5E4C,
-0X604D,0X8C0E,0X7070,0X6325,0X8F89,0X5FBD,0X6062,0X86D4,0X56DE,0X6BC1,0X6094,0X6167,0X5349,0X60E0,0X6666,0X8D3F,
-0X79FD,0X4F1A,0X70E9,0X6C47,0X8BB3,0X8BF2,0X7ED8,0X8364,0X660F,0X5A5A,0X9B42,0X6D51,0X6DF7,0X8C41,0X6D3B,0X4F19,
-0X706B,0X83B7,0X6216,0X60D1,0X970D,0X8D27,0X7978,0X51FB,0X573E,0X57FA,0X673A,0X7578,0X7A3D,0X79EF,0X7B95,0X0001,
-0X7CBF,0X7CC0,0X7CC2,0X7CC3,0X7CC4,0X7CC6,0X7CC9,0X7CCB,0X7CCE,0X7CCF,0X7CD0,0X7CD1,0X7CD2,0X7CD3,0X7CD4,0X7CD8,
-0X7CDA,0X7CDB,0X7CDD,0X7CDE,0X7CE1,0X7CE2,0X7CE3,0X7CE4,0X7CE5,0X7CE6,0X7CE7,0X7CE9,0X7CEA,0X7CEB,0X7CEC,0X7CED,
-0X7CEE,0X7CF0,0X7CF1,0X7CF2,0X7CF3,0X7CF4,0X7CF5,0X7CF6,0X7CF7,0X7CF9,0X7CFA,0X7CFC,0X7CFD,0X7CFE,0X7CFF,0X7D00,
-0X7D01,0X7D02,0X7D03,0X7D04,0X7D05,0X7D06,0X7D07,0X7D08,0X7D09,0X7D0B,0X7D0C,0X7D0D,0X7D0E,0X7D0F,0X7D10,0X0001,
-0X7D11,0X7D12,0X7D13,0X7D14,0X7D15,0X7D16,0X7D17,0X7D18,0X7D19,0X7D1A,0X7D1B,0X7D1C,0X7D1D,0X7D1E,0X7D1F,0X7D21,
-0X7D23,0X7D24,0X7D25,0X7D26,0X7D28,0X7D29,0X7D2A,0X7D2C,0X7D2D,0X7D2E,0X7D30,0X7D31,0X7D32,0X7D33,0X7D34,0X7D35,
-0X7D36,0X808C,0X9965,0X8FF9,0X6FC0,0X8BA5,0X9E21,0X59EC,0X7EE9,0X7F09,0X5409,0X6781,0X68D8,0X8F91,0X7C4D,0X96C6,
-0X53CA,0X6025,0X75BE,0X6C72,0X5373,0X5AC9,0X7EA7,0X6324,0X51E0,0X810A,0X5DF1,0X84DF,0X6280,0X5180,0X5B63,0X4F0E,
-0X796D,0X5242,0X60B8,0X6D4E,0X5BC4,0X5BC2,0X8BA1,0X8BB0,0X65E2,0X5FCC,0X9645,0X5993,0X7EE7,0X7EAA,0X5609,0X67B7,
-0X5939,0X4F73,0X5BB6,0X52A0,0X835A,0X988A,0X8D3E,0X7532,0X94BE,0X5047,0X7A3C,0X4EF7,0X67B6,0X9A7E,0X5AC1,0X6B7C,
-0X76D1,0X575A,0X5C16,0X7B3A,0X95F4,0X714E,0X517C,0X80A9,0X8270,0X5978,0X7F04,0X8327,0X68C0,0X67EC,0X78B1,0X7877,
-0X62E3,0X6361,0X7B80,0X4FED,0X526A,0X51CF,0X8350,0X69DB,0X9274,0X8DF5,0X8D31,0X89C1,0X952E,0X7BAD,0X4EF6,0X0001,
-0X7D37,0X7D38,0X7D39,0X7D3A,0X7D3B,0X7D3C,0X7D3D,0X7D3E,0X7D3F,0X7D40,0X7D41,0X7D42,0X7D43,0X7D44,0X7D45,0X7D46,
-0X7D47,0X7D48,0X7D49,0X7D4A,0X7D4B,0X7D4C,0X7D4D,0X7D4E,0X7D4F,0X7D50,0X7D51,0X7D52,0X7D53,0X7D54,0X7D55,0X7D56,
-0X7D57,0X7D58,0X7D59,0X7D5A,0X7D5B,0X7D5C,0X7D5D,0X7D5E,0X7D5F,0X7D60,0X7D61,0X7D62,0X7D63,0X7D64,0X7D65,0X7D66,
-0X7D67,0X7D68,0X7D69,0X7D6A,0X7D6B,0X7D6C,0X7D6D,0X7D6F,0X7D70,0X7D71,0X7D72,0X7D73,0X7D74,0X7D75,0X7D76,0X0001,
-0X7D78,0X7D79,0X7D7A,0X7D7B,0X7D7C,0X7D7D,0X7D7E,0X7D7F,0X7D80,0X7D81,0X7D82,0X7D83,0X7D84,0X7D85,0X7D86,0X7D87,
-0X7D88,0X7D89,0X7D8A,0X7D8B,0X7D8C,0X7D8D,0X7D8E,0X7D8F,0X7D90,0X7D91,0X7D92,0X7D93,0X7D94,0X7D95,0X7D96,0X7D97,
-0X7D98,0X5065,0X8230,0X5251,0X996F,0X6E10,0X6E85,0X6DA7,0X5EFA,0X50F5,0X59DC,0X5C06,0X6D46,0X6C5F,0X7586,0X848B,
-0X6868,0X5956,0X8BB2,0X5320,0X9171,0X964D,0X8549,0X6912,0X7901,0X7126,0X80F6,0X4EA4,0X90CA,0X6D47,0X9A84,0X5A07,
-0X56BC,0X6405,0X94F0,0X77EB,0X4FA5,0X811A,0X72E1,0X89D2,0X997A,0X7F34,0X7EDE,0X527F,0X6559,0X9175,0X8F7F,0X8F83,
-0X53EB,0X7A96,0X63ED,0X63A5,0X7686,0X79F8,0X8857,0X9636,0X622A,0X52AB,0X8282,0X6854,0X6770,0X6377,0X776B,0X7AED,
-0X6D01,0X7ED3,0X89E3,0X59D0,0X6212,0X85C9,0X82A5,0X754C,0X501F,0X4ECB,0X75A5,0X8BEB,0X5C4A,0X5DFE,0X7B4B,0X65A4,
-0X91D1,0X4ECA,0X6D25,0X895F,0X7D27,0X9526,0X4EC5,0X8C28,0X8FDB,0X9773,0X664B,0X7981,0X8FD1,0X70EC,0X6D78,0X0001,
-0X7D99,0X7D9A,0X7D9B,0X7D9C,0X7D9D,0X7D9E,0X7D9F,0X7DA0,0X7DA1,0X7DA2,0X7DA3,0X7DA4,0X7DA5,0X7DA7,0X7DA8,0X7DA9,
-0X7DAA,0X7DAB,0X7DAC,0X7DAD,0X7DAF,0X7DB0,0X7DB1,0X7DB2,0X7DB3,0X7DB4,0X7DB5,0X7DB6,0X7DB7,0X7DB8,0X7DB9,0X7DBA,
-0X7DBB,0X7DBC,0X7DBD,0X7DBE,0X7DBF,0X7DC0,0X7DC1,0X7DC2,0X7DC3,0X7DC4,0X7DC5,0X7DC6,0X7DC7,0X7DC8,0X7DC9,0X7DCA,
-0X7DCB,0X7DCC,0X7DCD,0X7DCE,0X7DCF,0X7DD0,0X7DD1,0X7DD2,0X7DD3,0X7DD4,0X7DD5,0X7DD6,0X7DD7,0X7DD8,0X7DD9,0X0001,
-0X7DDA,0X7DDB,0X7DDC,0X7DDD,0X7DDE,0X7DDF,0X7DE0,0X7DE1,0X7DE2,0X7DE3,0X7DE4,0X7DE5,0X7DE6,0X7DE7,0X7DE8,0X7DE9,
-0X7DEA,0X7DEB,0X7DEC,0X7DED,0X7DEE,0X7DEF,0X7DF0,0X7DF1,0X7DF2,0X7DF3,0X7DF4,0X7DF5,0X7DF6,0X7DF7,0X7DF8,0X7DF9,
-0X7DFA,0X5C3D,0X52B2,0X8346,0X5162,0X830E,0X775B,0X6676,0X9CB8,0X4EAC,0X60CA,0X7CBE,0X7CB3,0X7ECF,0X4E95,0X8B66,
-0X666F,0X9888,0X9759,0X5883,0X656C,0X955C,0X5F84,0X75C9,0X9756,0X7ADF,0X7ADE,0X51C0,0X70AF,0X7A98,0X63EA,0X7A76,
-0X7EA0,0X7396,0X97ED,0X4E45,0X7078,0X4E5D,0X9152,0X53A9,0X6551,0X65E7,0X81FC,0X8205,0X548E,0X5C31,0X759A,0X97A0,
-0X62D8,0X72D9,0X75BD,0X5C45,0X9A79,0X83CA,0X5C40,0X5480,0X77E9,0X4E3E,0X6CAE,0X805A,0X62D2,0X636E,0X5DE8,0X5177,
-0X8DDD,0X8E1E,0X952F,0X4FF1,0X53E5,0X60E7,0X70AC,0X5267,0X6350,0X9E43,0X5A1F,0X5026,0X7737,0X5377,0X7EE2,0X6485,
-0X652B,0X6289,0X6398,0X5014,0X7235,0X89C9,0X51B3,0X8BC0,0X7EDD,0X5747,0X83CC,0X94A7,0X519B,0X541B,0X5CFB,0X0001,
-0X7DFB,0X7DFC,0X7DFD,0X7DFE,0X7DFF,0X7E00,0X7E01,0X7E02,0X7E03,0X7E04,0X7E05,0X7E06,0X7E07,0X7E08,0X7E09,0X7E0A,
-0X7E0B,0X7E0C,0X7E0D,0X7E0E,0X7E0F,0X7E10,0X7E11,0X7E12,0X7E13,0X7E14,0X7E15,0X7E16,0X7E17,0X7E18,0X7E19,0X7E1A,
-0X7E1B,0X7E1C,0X7E1D,0X7E1E,0X7E1F,0X7E20,0X7E21,0X7E22,0X7E23,0X7E24,0X7E25,0X7E26,0X7E27,0X7E28,0X7E29,0X7E2A,
-0X7E2B,0X7E2C,0X7E2D,0X7E2E,0X7E2F,0X7E30,0X7E31,0X7E32,0X7E33,0X7E34,0X7E35,0X7E36,0X7E37,0X7E38,0X7E39,0X0001,
-0X7E3A,0X7E3C,0X7E3D,0X7E3E,0X7E3F,0X7E40,0X7E42,0X7E43,0X7E44,0X7E45,0X7E46,0X7E48,0X7E49,0X7E4A,0X7E4B,0X7E4C,
-0X7E4D,0X7E4E,0X7E4F,0X7E50,0X7E51,0X7E52,0X7E53,0X7E54,0X7E55,0X7E56,0X7E57,0X7E58,0X7E59,0X7E5A,0X7E5B,0X7E5C,
-0X7E5D,0X4FCA,0X7AE3,0X6D5A,0X90E1,0X9A8F,0X5580,0X5496,0X5361,0X54AF,0X5F00,0X63E9,0X6977,0X51EF,0X6168,0X520A,
-0X582A,0X52D8,0X574E,0X780D,0X770B,0X5EB7,0X6177,0X7CE0,0X625B,0X6297,0X4EA2,0X7095,0X8003,0X62F7,0X70E4,0X9760,
-0X5777,0X82DB,0X67EF,0X68F5,0X78D5,0X9897,0X79D1,0X58F3,0X54B3,0X53EF,0X6E34,0X514B,0X523B,0X5BA2,0X8BFE,0X80AF,
-0X5543,0X57A6,0X6073,0X5751,0X542D,0X7A7A,0X6050,0X5B54,0X63A7,0X62A0,0X53E3,0X6263,0X5BC7,0X67AF,0X54ED,0X7A9F,
-0X82E6,0X9177,0X5E93,0X88E4,0X5938,0X57AE,0X630E,0X8DE8,0X80EF,0X5757,0X7B77,0X4FA9,0X5FEB,0X5BBD,0X6B3E,0X5321,
-0X7B50,0X72C2,0X6846,0X77FF,0X7736,0X65F7,0X51B5,0X4E8F,0X76D4,0X5CBF,0X7AA5,0X8475,0X594E,0X9B41,0X5080,0X0001,
-0X7E5E,0X7E5F,0X7E60,0X7E61,0X7E62,0X7E63,0X7E64,0X7E65,0X7E66,0X7E67,0X7E68,0X7E69,0X7E6A,0X7E6B,0X7E6C,0X7E6D,
-0X7E6E,0X7E6F,0X7E70,0X7E71,0X7E72,0X7E73,0X7E74,0X7E75,0X7E76,0X7E77,0X7E78,0X7E79,0X7E7A,0X7E7B,0X7E7C,0X7E7D,
-0X7E7E,0X7E7F,0X7E80,0X7E81,0X7E83,0X7E84,0X7E85,0X7E86,0X7E87,0X7E88,0X7E89,0X7E8A,0X7E8B,0X7E8C,0X7E8D,0X7E8E,
-0X7E8F,0X7E90,0X7E91,0X7E92,0X7E93,0X7E94,0X7E95,0X7E96,0X7E97,0X7E98,0X7E99,0X7E9A,0X7E9C,0X7E9D,0X7E9E,0X0001,
-0X7EAE,0X7EB4,0X7EBB,0X7EBC,0X7ED6,0X7EE4,0X7EEC,0X7EF9,0X7F0A,0X7F10,0X7F1E,0X7F37,0X7F39,0X7F3B,0X7F3C,0X7F3D,
-0X7F3E,0X7F3F,0X7F40,0X7F41,0X7F43,0X7F46,0X7F47,0X7F48,0X7F49,0X7F4A,0X7F4B,0X7F4C,0X7F4D,0X7F4E,0X7F4F,0X7F52,
-0X7F53,0X9988,0X6127,0X6E83,0X5764,0X6606,0X6346,0X56F0,0X62EC,0X6269,0X5ED3,0X9614,0X5783,0X62C9,0X5587,0X8721,
-0X814A,0X8FA3,0X5566,0X83B1,0X6765,0X8D56,0X84DD,0X5A6A,0X680F,0X62E6,0X7BEE,0X9611,0X5170,0X6F9C,0X8C30,0X63FD,
-0X89C8,0X61D2,0X7F06,0X70C2,0X6EE5,0X7405,0X6994,0X72FC,0X5ECA,0X90CE,0X6717,0X6D6A,0X635E,0X52B3,0X7262,0X8001,
-0X4F6C,0X59E5,0X916A,0X70D9,0X6D9D,0X52D2,0X4E50,0X96F7,0X956D,0X857E,0X78CA,0X7D2F,0X5121,0X5792,0X64C2,0X808B,
-0X7C7B,0X6CEA,0X68F1,0X695E,0X51B7,0X5398,0X68A8,0X7281,0X9ECE,0X7BF1,0X72F8,0X79BB,0X6F13,0X7406,0X674E,0X91CC,
-0X9CA4,0X793C,0X8389,0X8354,0X540F,0X6817,0X4E3D,0X5389,0X52B1,0X783E,0X5386,0X5229,0X5088,0X4F8B,0X4FD0,0X0001,
-0X7F56,0X7F59,0X7F5B,0X7F5C,0X7F5D,0X7F5E,0X7F60,0X7F63,0X7F64,0X7F65,0X7F66,0X7F67,0X7F6B,0X7F6C,0X7F6D,0X7F6F,
-0X7F70,0X7F73,0X7F75,0X7F76,0X7F77,0X7F78,0X7F7A,0X7F7B,0X7F7C,0X7F7D,0X7F7F,0X7F80,0X7F82,0X7F83,0X7F84,0X7F85,
-0X7F86,0X7F87,0X7F88,0X7F89,0X7F8B,0X7F8D,0X7F8F,0X7F90,0X7F91,0X7F92,0X7F93,0X7F95,0X7F96,0X7F97,0X7F98,0X7F99,
-0X7F9B,0X7F9C,0X7FA0,0X7FA2,0X7FA3,0X7FA5,0X7FA6,0X7FA8,0X7FA9,0X7FAA,0X7FAB,0X7FAC,0X7FAD,0X7FAE,0X7FB1,0X0001,
-0X7FB3,0X7FB4,0X7FB5,0X7FB6,0X7FB7,0X7FBA,0X7FBB,0X7FBE,0X7FC0,0X7FC2,0X7FC3,0X7FC4,0X7FC6,0X7FC7,0X7FC8,0X7FC9,
-0X7FCB,0X7FCD,0X7FCF,0X7FD0,0X7FD1,0X7FD2,0X7FD3,0X7FD6,0X7FD7,0X7FD9,0X7FDA,0X7FDB,0X7FDC,0X7FDD,0X7FDE,0X7FE2,
-0X7FE3,0X75E2,0X7ACB,0X7C92,0X6CA5,0X96B6,0X529B,0X7483,0X54E9,0X4FE9,0X8054,0X83B2,0X8FDE,0X9570,0X5EC9,0X601C,
-0X6D9F,0X5E18,0X655B,0X8138,0X94FE,0X604B,0X70BC,0X7EC3,0X7CAE,0X51C9,0X6881,0X7CB1,0X826F,0X4E24,0X8F86,0X91CF,
-0X667E,0X4EAE,0X8C05,0X64A9,0X804A,0X50DA,0X7597,0X71CE,0X5BE5,0X8FBD,0X6F66,0X4E86,0X6482,0X9563,0X5ED6,0X6599,
-0X5217,0X88C2,0X70C8,0X52A3,0X730E,0X7433,0X6797,0X78F7,0X9716,0X4E34,0X90BB,0X9CDE,0X6DCB,0X51DB,0X8D41,0X541D,
-0X62CE,0X73B2,0X83F1,0X96F6,0X9F84,0X94C3,0X4F36,0X7F9A,0X51CC,0X7075,0X9675,0X5CAD,0X9886,0X53E6,0X4EE4,0X6E9C,
-0X7409,0X69B4,0X786B,0X998F,0X7559,0X5218,0X7624,0X6D41,0X67F3,0X516D,0X9F99,0X804B,0X5499,0X7B3C,0X7ABF,0X0001,
-0X7FE4,0X7FE7,0X7FE8,0X7FEA,0X7FEB,0X7FEC,0X7FED,0X7FEF,0X7FF2,0X7FF4,0X7FF5,0X7FF6,0X7FF7,0X7FF8,0X7FF9,0X7FFA,
-0X7FFD,0X7FFE,0X7FFF,0X8002,0X8007,0X8008,0X8009,0X800A,0X800E,0X800F,0X8011,0X8013,0X801A,0X801B,0X801D,0X801E,
-0X801F,0X8021,0X8023,0X8024,0X802B,0X802C,0X802D,0X802E,0X802F,0X8030,0X8032,0X8034,0X8039,0X803A,0X803C,0X803E,
-0X8040,0X8041,0X8044,0X8045,0X8047,0X8048,0X8049,0X804E,0X804F,0X8050,0X8051,0X8053,0X8055,0X8056,0X8057,0X0001,
-0X8059,0X805B,0X805C,0X805D,0X805E,0X805F,0X8060,0X8061,0X8062,0X8063,0X8064,0X8065,0X8066,0X8067,0X8068,0X806B,
-0X806C,0X806D,0X806E,0X806F,0X8070,0X8072,0X8073,0X8074,0X8075,0X8076,0X8077,0X8078,0X8079,0X807A,0X807B,0X807C,
-0X807D,0X9686,0X5784,0X62E2,0X9647,0X697C,0X5A04,0X6402,0X7BD3,0X6F0F,0X964B,0X82A6,0X5362,0X9885,0X5E90,0X7089,
-0X63B3,0X5364,0X864F,0X9C81,0X9E93,0X788C,0X9732,0X8DEF,0X8D42,0X9E7F,0X6F5E,0X7984,0X5F55,0X9646,0X622E,0X9A74,
-0X5415,0X94DD,0X4FA3,0X65C5,0X5C65,0X5C61,0X7F15,0X8651,0X6C2F,0X5F8B,0X7387,0X6EE4,0X7EFF,0X5CE6,0X631B,0X5B6A,
-0X6EE6,0X5375,0X4E71,0X63A0,0X7565,0X62A1,0X8F6E,0X4F26,0X4ED1,0X6CA6,0X7EB6,0X8BBA,0X841D,0X87BA,0X7F57,0X903B,
-0X9523,0X7BA9,0X9AA1,0X88F8,0X843D,0X6D1B,0X9A86,0X7EDC,0X5988,0X9EBB,0X739B,0X7801,0X8682,0X9A6C,0X9A82,0X561B,
-0X5417,0X57CB,0X4E70,0X9EA6,0X5356,0X8FC8,0X8109,0X7792,0X9992,0X86EE,0X6EE1,0X8513,0X66FC,0X6162,0X6F2B,0X0001,
-0X807E,0X8081,0X8082,0X8085,0X8088,0X808A,0X808D,0X808E,0X808F,0X8090,0X8091,0X8092,0X8094,0X8095,0X8097,0X8099,
-0X809E,0X80A3,0X80A6,0X80A7,0X80A8,0X80AC,0X80B0,0X80B3,0X80B5,0X80B6,0X80B8,0X80B9,0X80BB,0X80C5,0X80C7,0X80C8,
-0X80C9,0X80CA,0X80CB,0X80CF,0X80D0,0X80D1,0X80D2,0X80D3,0X80D4,0X80D5,0X80D8,0X80DF,0X80E0,0X80E2,0X80E3,0X80E6,
-0X80EE,0X80F5,0X80F7,0X80F9,0X80FB,0X80FE,0X80FF,0X8100,0X8101,0X8103,0X8104,0X8105,0X8107,0X8108,0X810B,0X0001,
-0X810C,0X8115,0X8117,0X8119,0X811B,0X811C,0X811D,0X811F,0X8120,0X8121,0X8122,0X8123,0X8124,0X8125,0X8126,0X8127,
-0X8128,0X8129,0X812A,0X812B,0X812D,0X812E,0X8130,0X8133,0X8134,0X8135,0X8137,0X8139,0X813A,0X813B,0X813C,0X813D,
-0X813F,0X8C29,0X8292,0X832B,0X76F2,0X6C13,0X5FD9,0X83BD,0X732B,0X8305,0X951A,0X6BDB,0X77DB,0X94C6,0X536F,0X8302,
-0X5192,0X5E3D,0X8C8C,0X8D38,0X4E48,0X73AB,0X679A,0X6885,0X9176,0X9709,0X7164,0X6CA1,0X7709,0X5A92,0X9541,0X6BCF,
-0X7F8E,0X6627,0X5BD0,0X59B9,0X5A9A,0X95E8,0X95F7,0X4EEC,0X840C,0X8499,0X6AAC,0X76DF,0X9530,0X731B,0X68A6,0X5B5F,
-0X772F,0X919A,0X9761,0X7CDC,0X8FF7,0X8C1C,0X5F25,0X7C73,0X79D8,0X89C5,0X6CCC,0X871C,0X5BC6,0X5E42,0X68C9,0X7720,
-0X7EF5,0X5195,0X514D,0X52C9,0X5A29,0X7F05,0X9762,0X82D7,0X63CF,0X7784,0X85D0,0X79D2,0X6E3A,0X5E99,0X5999,0X8511,
-0X706D,0X6C11,0X62BF,0X76BF,0X654F,0X60AF,0X95FD,0X660E,0X879F,0X9E23,0X94ED,0X540D,0X547D,0X8C2C,0X6478,0X0001,
-0X8140,0X8141,0X8142,0X8143,0X8144,0X8145,0X8147,0X8149,0X814D,0X814E,0X814F,0X8152,0X8156,0X8157,0X8158,0X815B,
-0X815C,0X815D,0X815E,0X815F,0X8161,0X8162,0X8163,0X8164,0X8166,0X8168,0X816A,0X816B,0X816C,0X816F,0X8172,0X8173,
-0X8175,0X8176,0X8177,0X8178,0X8181,0X8183,0X8184,0X8185,0X8186,0X8187,0X8189,0X818B,0X818C,0X818D,0X818E,0X8190,
-0X8192,0X8193,0X8194,0X8195,0X8196,0X8197,0X8199,0X819A,0X819E,0X819F,0X81A0,0X81A1,0X81A2,0X81A4,0X81A5,0X0001,
-0X81A7,0X81A9,0X81AB,0X81AC,0X81AD,0X81AE,0X81AF,0X81B0,0X81B1,0X81B2,0X81B4,0X81B5,0X81B6,0X81B7,0X81B8,0X81B9,
-0X81BC,0X81BD,0X81BE,0X81BF,0X81C4,0X81C5,0X81C7,0X81C8,0X81C9,0X81CB,0X81CD,0X81CE,0X81CF,0X81D0,0X81D1,0X81D2,
-0X81D3,0X6479,0X8611,0X6A21,0X819C,0X78E8,0X6469,0X9B54,0X62B9,0X672B,0X83AB,0X58A8,0X9ED8,0X6CAB,0X6F20,0X5BDE,
-0X964C,0X8C0B,0X725F,0X67D0,0X62C7,0X7261,0X4EA9,0X59C6,0X6BCD,0X5893,0X66AE,0X5E55,0X52DF,0X6155,0X6728,0X76EE,
-0X7766,0X7267,0X7A46,0X62FF,0X54EA,0X5450,0X94A0,0X90A3,0X5A1C,0X7EB3,0X6C16,0X4E43,0X5976,0X8010,0X5948,0X5357,
-0X7537,0X96BE,0X56CA,0X6320,0X8111,0X607C,0X95F9,0X6DD6,0X5462,0X9981,0X5185,0X5AE9,0X80FD,0X59AE,0X9713,0X502A,
-0X6CE5,0X5C3C,0X62DF,0X4F60,0X533F,0X817B,0X9006,0X6EBA,0X852B,0X62C8,0X5E74,0X78BE,0X64B5,0X637B,0X5FF5,0X5A18,
-0X917F,0X9E1F,0X5C3F,0X634F,0X8042,0X5B7D,0X556E,0X954A,0X954D,0X6D85,0X60A8,0X67E0,0X72DE,0X51DD,0X5B81,0X0001,
-0X81D4,0X81D5,0X81D6,0X81D7,0X81D8,0X81D9,0X81DA,0X81DB,0X81DC,0X81DD,0X81DE,0X81DF,0X81E0,0X81E1,0X81E2,0X81E4,
-0X81E5,0X81E6,0X81E8,0X81E9,0X81EB,0X81EE,0X81EF,0X81F0,0X81F1,0X81F2,0X81F5,0X81F6,0X81F7,0X81F8,0X81F9,0X81FA,
-0X81FD,0X81FF,0X8203,0X8207,0X8208,0X8209,0X820A,0X820B,0X820E,0X820F,0X8211,0X8213,0X8215,0X8216,0X8217,0X8218,
-0X8219,0X821A,0X821D,0X8220,0X8224,0X8225,0X8226,0X8227,0X8229,0X822E,0X8232,0X823A,0X823C,0X823D,0X823F,0X0001,
-0X8240,0X8241,0X8242,0X8243,0X8245,0X8246,0X8248,0X824A,0X824C,0X824D,0X824E,0X8250,0X8251,0X8252,0X8253,0X8254,
-0X8255,0X8256,0X8257,0X8259,0X825B,0X825C,0X825D,0X825E,0X8260,0X8261,0X8262,0X8263,0X8264,0X8265,0X8266,0X8267,
-0X8269,0X62E7,0X6CDE,0X725B,0X626D,0X94AE,0X7EBD,0X8113,0X6D53,0X519C,0X5F04,0X5974,0X52AA,0X6012,0X5973,0X6696,
-0X8650,0X759F,0X632A,0X61E6,0X7CEF,0X8BFA,0X54E6,0X6B27,0X9E25,0X6BB4,0X85D5,0X5455,0X5076,0X6CA4,0X556A,0X8DB4,
-0X722C,0X5E15,0X6015,0X7436,0X62CD,0X6392,0X724C,0X5F98,0X6E43,0X6D3E,0X6500,0X6F58,0X76D8,0X78D0,0X76FC,0X7554,
-0X5224,0X53DB,0X4E53,0X5E9E,0X65C1,0X802A,0X80D6,0X629B,0X5486,0X5228,0X70AE,0X888D,0X8DD1,0X6CE1,0X5478,0X80DA,
-0X57F9,0X88F4,0X8D54,0X966A,0X914D,0X4F69,0X6C9B,0X55B7,0X76C6,0X7830,0X62A8,0X70F9,0X6F8E,0X5F6D,0X84EC,0X68DA,
-0X787C,0X7BF7,0X81A8,0X670B,0X9E4F,0X6367,0X78B0,0X576F,0X7812,0X9739,0X6279,0X62AB,0X5288,0X7435,0X6BD7,0X0001,
-0X826A,0X826B,0X826C,0X826D,0X8271,0X8275,0X8276,0X8277,0X8278,0X827B,0X827C,0X8280,0X8281,0X8283,0X8285,0X8286,
-0X8287,0X8289,0X828C,0X8290,0X8293,0X8294,0X8295,0X8296,0X829A,0X829B,0X829E,0X82A0,0X82A2,0X82A3,0X82A7,0X82B2,
-0X82B5,0X82B6,0X82BA,0X82BB,0X82BC,0X82BF,0X82C0,0X82C2,0X82C3,0X82C5,0X82C6,0X82C9,0X82D0,0X82D6,0X82D9,0X82DA,
-0X82DD,0X82E2,0X82E7,0X82E8,0X82E9,0X82EA,0X82EC,0X82ED,0X82EE,0X82F0,0X82F2,0X82F3,0X82F5,0X82F6,0X82F8,0X0001,
-0X82FA,0X82FC,0X82FD,0X82FE,0X82FF,0X8300,0X830A,0X830B,0X830D,0X8310,0X8312,0X8313,0X8316,0X8318,0X8319,0X831D,
-0X831E,0X831F,0X8320,0X8321,0X8322,0X8323,0X8324,0X8325,0X8326,0X8329,0X832A,0X832E,0X8330,0X8332,0X8337,0X833B,
-0X833D,0X5564,0X813E,0X75B2,0X76AE,0X5339,0X75DE,0X50FB,0X5C41,0X8B6C,0X7BC7,0X504F,0X7247,0X9A97,0X98D8,0X6F02,
-0X74E2,0X7968,0X6487,0X77A5,0X62FC,0X9891,0X8D2B,0X54C1,0X8058,0X4E52,0X576A,0X82F9,0X840D,0X5E73,0X51ED,0X74F6,
-0X8BC4,0X5C4F,0X5761,0X6CFC,0X9887,0X5A46,0X7834,0X9B44,0X8FEB,0X7C95,0X5256,0X6251,0X94FA,0X4EC6,0X8386,0X8461,
-0X83E9,0X84B2,0X57D4,0X6734,0X5703,0X666E,0X6D66,0X8C31,0X66DD,0X7011,0X671F,0X6B3A,0X6816,0X621A,0X59BB,0X4E03,
-0X51C4,0X6F06,0X67D2,0X6C8F,0X5176,0X68CB,0X5947,0X6B67,0X7566,0X5D0E,0X8110,0X9F50,0X65D7,0X7948,0X7941,0X9A91,
-0X8D77,0X5C82,0X4E5E,0X4F01,0X542F,0X5951,0X780C,0X5668,0X6C14,0X8FC4,0X5F03,0X6C7D,0X6CE3,0X8BAB,0X6390,0X0001,
-0X833E,0X833F,0X8341,0X8342,0X8344,0X8345,0X8348,0X834A,0X834B,0X834C,0X834D,0X834E,0X8353,0X8355,0X8356,0X8357,
-0X8358,0X8359,0X835D,0X8362,0X8370,0X8371,0X8372,0X8373,0X8374,0X8375,0X8376,0X8379,0X837A,0X837E,0X837F,0X8380,
-0X8381,0X8382,0X8383,0X8384,0X8387,0X8388,0X838A,0X838B,0X838C,0X838D,0X838F,0X8390,0X8391,0X8394,0X8395,0X8396,
-0X8397,0X8399,0X839A,0X839D,0X839F,0X83A1,0X83A2,0X83A3,0X83A4,0X83A5,0X83A6,0X83A7,0X83AC,0X83AD,0X83AE,0X0001,
-0X83AF,0X83B5,0X83BB,0X83BE,0X83BF,0X83C2,0X83C3,0X83C4,0X83C6,0X83C8,0X83C9,0X83CB,0X83CD,0X83CE,0X83D0,0X83D1,
-0X83D2,0X83D3,0X83D5,0X83D7,0X83D9,0X83DA,0X83DB,0X83DE,0X83E2,0X83E3,0X83E4,0X83E6,0X83E7,0X83E8,0X83EB,0X83EC,
-0X83ED,0X6070,0X6D3D,0X7275,0X6266,0X948E,0X94C5,0X5343,0X8FC1,0X7B7E,0X4EDF,0X8C26,0X4E7E,0X9ED4,0X94B1,0X94B3,
-0X524D,0X6F5C,0X9063,0X6D45,0X8C34,0X5811,0X5D4C,0X6B20,0X6B49,0X67AA,0X545B,0X8154,0X7F8C,0X5899,0X8537,0X5F3A,
-0X62A2,0X6A47,0X9539,0X6572,0X6084,0X6865,0X77A7,0X4E54,0X4FA8,0X5DE7,0X9798,0X64AC,0X7FD8,0X5CED,0X4FCF,0X7A8D,
-0X5207,0X8304,0X4E14,0X602F,0X7A83,0X94A6,0X4FB5,0X4EB2,0X79E6,0X7434,0X52E4,0X82B9,0X64D2,0X79BD,0X5BDD,0X6C81,
-0X9752,0X8F7B,0X6C22,0X503E,0X537F,0X6E05,0X64CE,0X6674,0X6C30,0X60C5,0X9877,0X8BF7,0X5E86,0X743C,0X7A77,0X79CB,
-0X4E18,0X90B1,0X7403,0X6C42,0X56DA,0X914B,0X6CC5,0X8D8B,0X533A,0X86C6,0X66F2,0X8EAF,0X5C48,0X9A71,0X6E20,0X0001,
-0X83EE,0X83EF,0X83F3,0X83F4,0X83F5,0X83F6,0X83F7,0X83FA,0X83FB,0X83FC,0X83FE,0X83FF,0X8400,0X8402,0X8405,0X8407,
-0X8408,0X8409,0X840A,0X8410,0X8412,0X8413,0X8414,0X8415,0X8416,0X8417,0X8419,0X841A,0X841B,0X841E,0X841F,0X8420,
-0X8421,0X8422,0X8423,0X8429,0X842A,0X842B,0X842C,0X842D,0X842E,0X842F,0X8430,0X8432,0X8433,0X8434,0X8435,0X8436,
-0X8437,0X8439,0X843A,0X843B,0X843E,0X843F,0X8440,0X8441,0X8442,0X8443,0X8444,0X8445,0X8447,0X8448,0X8449,0X0001,
-0X844A,0X844B,0X844C,0X844D,0X844E,0X844F,0X8450,0X8452,0X8453,0X8454,0X8455,0X8456,0X8458,0X845D,0X845E,0X845F,
-0X8460,0X8462,0X8464,0X8465,0X8466,0X8467,0X8468,0X846A,0X846E,0X846F,0X8470,0X8472,0X8474,0X8477,0X8479,0X847B,
-0X847C,0X53D6,0X5A36,0X9F8B,0X8DA3,0X53BB,0X5708,0X98A7,0X6743,0X919B,0X6CC9,0X5168,0X75CA,0X62F3,0X72AC,0X5238,
-0X529D,0X7F3A,0X7094,0X7638,0X5374,0X9E4A,0X69B7,0X786E,0X96C0,0X88D9,0X7FA4,0X7136,0X71C3,0X5189,0X67D3,0X74E4,
-0X58E4,0X6518,0X56B7,0X8BA9,0X9976,0X6270,0X7ED5,0X60F9,0X70ED,0X58EC,0X4EC1,0X4EBA,0X5FCD,0X97E7,0X4EFB,0X8BA4,
-0X5203,0X598A,0X7EAB,0X6254,0X4ECD,0X65E5,0X620E,0X8338,0X84C9,0X8363,0X878D,0X7194,0X6EB6,0X5BB9,0X7ED2,0X5197,
-0X63C9,0X67D4,0X8089,0X8339,0X8815,0X5112,0X5B7A,0X5982,0X8FB1,0X4E73,0X6C5D,0X5165,0X8925,0X8F6F,0X962E,0X854A,
-0X745E,0X9510,0X95F0,0X6DA6,0X82E5,0X5F31,0X6492,0X6D12,0X8428,0X816E,0X9CC3,0X585E,0X8D5B,0X4E09,0X53C1,0X0001,
-0X847D,0X847E,0X847F,0X8480,0X8481,0X8483,0X8484,0X8485,0X8486,0X848A,0X848D,0X848F,0X8490,0X8491,0X8492,0X8493,
-0X8494,0X8495,0X8496,0X8498,0X849A,0X849B,0X849D,0X849E,0X849F,0X84A0,0X84A2,0X84A3,0X84A4,0X84A5,0X84A6,0X84A7,
-0X84A8,0X84A9,0X84AA,0X84AB,0X84AC,0X84AD,0X84AE,0X84B0,0X84B1,0X84B3,0X84B5,0X84B6,0X84B7,0X84BB,0X84BC,0X84BE,
-0X84C0,0X84C2,0X84C3,0X84C5,0X84C6,0X84C7,0X84C8,0X84CB,0X84CC,0X84CE,0X84CF,0X84D2,0X84D4,0X84D5,0X84D7,0X0001,
-0X84D8,0X84D9,0X84DA,0X84DB,0X84DC,0X84DE,0X84E1,0X84E2,0X84E4,0X84E7,0X84E8,0X84E9,0X84EA,0X84EB,0X84ED,0X84EE,
-0X84EF,0X84F1,0X84F2,0X84F3,0X84F4,0X84F5,0X84F6,0X84F7,0X84F8,0X84F9,0X84FA,0X84FB,0X84FD,0X84FE,0X8500,0X8501,
-0X8502,0X4F1E,0X6563,0X6851,0X55D3,0X4E27,0X6414,0X9A9A,0X626B,0X5AC2,0X745F,0X8272,0X6DA9,0X68EE,0X50E7,0X838E,
-0X7802,0X6740,0X5239,0X6C99,0X7EB1,0X50BB,0X5565,0X715E,0X7B5B,0X6652,0X73CA,0X82EB,0X6749,0X5C71,0X5220,0X717D,
-0X886B,0X95EA,0X9655,0X64C5,0X8D61,0X81B3,0X5584,0X6C55,0X6247,0X7F2E,0X5892,0X4F24,0X5546,0X8D4F,0X664C,0X4E0A,
-0X5C1A,0X88F3,0X68A2,0X634E,0X7A0D,0X70E7,0X828D,0X52FA,0X97F6,0X5C11,0X54E8,0X90B5,0X7ECD,0X5962,0X8D4A,0X86C7,
-0X820C,0X820D,0X8D66,0X6444,0X5C04,0X6151,0X6D89,0X793E,0X8BBE,0X7837,0X7533,0X547B,0X4F38,0X8EAB,0X6DF1,0X5A20,
-0X7EC5,0X795E,0X6C88,0X5BA1,0X5A76,0X751A,0X80BE,0X614E,0X6E17,0X58F0,0X751F,0X7525,0X7272,0X5347,0X7EF3,0X0001,
-0X8503,0X8504,0X8505,0X8506,0X8507,0X8508,0X8509,0X850A,0X850B,0X850D,0X850E,0X850F,0X8510,0X8512,0X8514,0X8515,
-0X8516,0X8518,0X8519,0X851B,0X851C,0X851D,0X851E,0X8520,0X8522,0X8523,0X8524,0X8525,0X8526,0X8527,0X8528,0X8529,
-0X852A,0X852D,0X852E,0X852F,0X8530,0X8531,0X8532,0X8533,0X8534,0X8535,0X8536,0X853E,0X853F,0X8540,0X8541,0X8542,
-0X8544,0X8545,0X8546,0X8547,0X854B,0X854C,0X854D,0X854E,0X854F,0X8550,0X8551,0X8552,0X8553,0X8554,0X8555,0X0001,
-0X8557,0X8558,0X855A,0X855B,0X855C,0X855D,0X855F,0X8560,0X8561,0X8562,0X8563,0X8565,0X8566,0X8567,0X8569,0X856A,
-0X856B,0X856C,0X856D,0X856E,0X856F,0X8570,0X8571,0X8573,0X8575,0X8576,0X8577,0X8578,0X857C,0X857D,0X857F,0X8580,
-0X8581,0X7701,0X76DB,0X5269,0X80DC,0X5723,0X5E08,0X5931,0X72EE,0X65BD,0X6E7F,0X8BD7,0X5C38,0X8671,0X5341,0X77F3,
-0X62FE,0X65F6,0X4EC0,0X98DF,0X8680,0X5B9E,0X8BC6,0X53F2,0X77E2,0X4F7F,0X5C4E,0X9A76,0X59CB,0X5F0F,0X793A,0X58EB,
-0X4E16,0X67FF,0X4E8B,0X62ED,0X8A93,0X901D,0X52BF,0X662F,0X55DC,0X566C,0X9002,0X4ED5,0X4F8D,0X91CA,0X9970,0X6C0F,
-0X5E02,0X6043,0X5BA4,0X89C6,0X8BD5,0X6536,0X624B,0X9996,0X5B88,0X5BFF,0X6388,0X552E,0X53D7,0X7626,0X517D,0X852C,
-0X67A2,0X68B3,0X6B8A,0X6292,0X8F93,0X53D4,0X8212,0X6DD1,0X758F,0X4E66,0X8D4E,0X5B70,0X719F,0X85AF,0X6691,0X66D9,
-0X7F72,0X8700,0X9ECD,0X9F20,0X5C5E,0X672F,0X8FF0,0X6811,0X675F,0X620D,0X7AD6,0X5885,0X5EB6,0X6570,0X6F31,0X0001,
-0X8582,0X8583,0X8586,0X8588,0X8589,0X858A,0X858B,0X858C,0X858D,0X858E,0X8590,0X8591,0X8592,0X8593,0X8594,0X8595,
-0X8596,0X8597,0X8598,0X8599,0X859A,0X859D,0X859E,0X859F,0X85A0,0X85A1,0X85A2,0X85A3,0X85A5,0X85A6,0X85A7,0X85A9,
-0X85AB,0X85AC,0X85AD,0X85B1,0X85B2,0X85B3,0X85B4,0X85B5,0X85B6,0X85B8,0X85BA,0X85BB,0X85BC,0X85BD,0X85BE,0X85BF,
-0X85C0,0X85C2,0X85C3,0X85C4,0X85C5,0X85C6,0X85C7,0X85C8,0X85CA,0X85CB,0X85CC,0X85CD,0X85CE,0X85D1,0X85D2,0X0001,
-0X85D4,0X85D6,0X85D7,0X85D8,0X85D9,0X85DA,0X85DB,0X85DD,0X85DE,0X85DF,0X85E0,0X85E1,0X85E2,0X85E3,0X85E5,0X85E6,
-0X85E7,0X85E8,0X85EA,0X85EB,0X85EC,0X85ED,0X85EE,0X85EF,0X85F0,0X85F1,0X85F2,0X85F3,0X85F4,0X85F5,0X85F6,0X85F7,
-0X85F8,0X6055,0X5237,0X800D,0X6454,0X8870,0X7529,0X5E05,0X6813,0X62F4,0X971C,0X53CC,0X723D,0X8C01,0X6C34,0X7761,
-0X7A0E,0X542E,0X77AC,0X987A,0X821C,0X8BF4,0X7855,0X6714,0X70C1,0X65AF,0X6495,0X5636,0X601D,0X79C1,0X53F8,0X4E1D,
-0X6B7B,0X8086,0X5BFA,0X55E3,0X56DB,0X4F3A,0X4F3C,0X9972,0X5DF3,0X677E,0X8038,0X6002,0X9882,0X9001,0X5B8B,0X8BBC,
-0X8BF5,0X641C,0X8258,0X64DE,0X55FD,0X82CF,0X9165,0X4FD7,0X7D20,0X901F,0X7C9F,0X50F3,0X5851,0X6EAF,0X5BBF,0X8BC9,
-0X8083,0X9178,0X849C,0X7B97,0X867D,0X968B,0X968F,0X7EE5,0X9AD3,0X788E,0X5C81,0X7A57,0X9042,0X96A7,0X795F,0X5B59,
-0X635F,0X7B0B,0X84D1,0X68AD,0X5506,0X7F29,0X7410,0X7D22,0X9501,0X6240,0X584C,0X4ED6,0X5B83,0X5979,0X5854,0X0001,
-0X85F9,0X85FA,0X85FC,0X85FD,0X85FE,0X8600,0X8601,0X8602,0X8603,0X8604,0X8606,0X8607,0X8608,0X8609,0X860A,0X860B,
-0X860C,0X860D,0X860E,0X860F,0X8610,0X8612,0X8613,0X8614,0X8615,0X8617,0X8618,0X8619,0X861A,0X861B,0X861C,0X861D,
-0X861E,0X861F,0X8620,0X8621,0X8622,0X8623,0X8624,0X8625,0X8626,0X8628,0X862A,0X862B,0X862C,0X862D,0X862E,0X862F,
-0X8630,0X8631,0X8632,0X8633,0X8634,0X8635,0X8636,0X8637,0X8639,0X863A,0X863B,0X863D,0X863E,0X863F,0X8640,0X0001,
-0X8641,0X8642,0X8643,0X8644,0X8645,0X8646,0X8647,0X8648,0X8649,0X864A,0X864B,0X864C,0X8652,0X8653,0X8655,0X8656,
-0X8657,0X8658,0X8659,0X865B,0X865C,0X865D,0X865F,0X8660,0X8661,0X8663,0X8664,0X8665,0X8666,0X8667,0X8668,0X8669,
-0X866A,0X736D,0X631E,0X8E4B,0X8E0F,0X80CE,0X82D4,0X62AC,0X53F0,0X6CF0,0X915E,0X592A,0X6001,0X6C70,0X574D,0X644A,
-0X8D2A,0X762B,0X6EE9,0X575B,0X6A80,0X75F0,0X6F6D,0X8C2D,0X8C08,0X5766,0X6BEF,0X8892,0X78B3,0X63A2,0X53F9,0X70AD,
-0X6C64,0X5858,0X642A,0X5802,0X68E0,0X819B,0X5510,0X7CD6,0X5018,0X8EBA,0X6DCC,0X8D9F,0X70EB,0X638F,0X6D9B,0X6ED4,
-0X7EE6,0X8404,0X6843,0X9003,0X6DD8,0X9676,0X8BA8,0X5957,0X7279,0X85E4,0X817E,0X75BC,0X8A8A,0X68AF,0X5254,0X8E22,
-0X9511,0X63D0,0X9898,0X8E44,0X557C,0X4F53,0X66FF,0X568F,0X60D5,0X6D95,0X5243,0X5C49,0X5929,0X6DFB,0X586B,0X7530,
-0X751C,0X606C,0X8214,0X8146,0X6311,0X6761,0X8FE2,0X773A,0X8DF3,0X8D34,0X94C1,0X5E16,0X5385,0X542C,0X70C3,0X0001,
-0X866D,0X866F,0X8670,0X8672,0X8673,0X8674,0X8675,0X8676,0X8677,0X8678,0X8683,0X8684,0X8685,0X8686,0X8687,0X8688,
-0X8689,0X868E,0X868F,0X8690,0X8691,0X8692,0X8694,0X8696,0X8697,0X8698,0X8699,0X869A,0X869B,0X869E,0X869F,0X86A0,
-0X86A1,0X86A2,0X86A5,0X86A6,0X86AB,0X86AD,0X86AE,0X86B2,0X86B3,0X86B7,0X86B8,0X86B9,0X86BB,0X86BC,0X86BD,0X86BE,
-0X86BF,0X86C1,0X86C2,0X86C3,0X86C5,0X86C8,0X86CC,0X86CD,0X86D2,0X86D3,0X86D5,0X86D6,0X86D7,0X86DA,0X86DC,0X0001,
-0X86DD,0X86E0,0X86E1,0X86E2,0X86E3,0X86E5,0X86E6,0X86E7,0X86E8,0X86EA,0X86EB,0X86EC,0X86EF,0X86F5,0X86F6,0X86F7,
-0X86FA,0X86FB,0X86FC,0X86FD,0X86FF,0X8701,0X8704,0X8705,0X8706,0X870B,0X870C,0X870E,0X870F,0X8710,0X8711,0X8714,
-0X8716,0X6C40,0X5EF7,0X505C,0X4EAD,0X5EAD,0X633A,0X8247,0X901A,0X6850,0X916E,0X77B3,0X540C,0X94DC,0X5F64,0X7AE5,
-0X6876,0X6345,0X7B52,0X7EDF,0X75DB,0X5077,0X6295,0X5934,0X900F,0X51F8,0X79C3,0X7A81,0X56FE,0X5F92,0X9014,0X6D82,
-0X5C60,0X571F,0X5410,0X5154,0X6E4D,0X56E2,0X63A8,0X9893,0X817F,0X8715,0X892A,0X9000,0X541E,0X5C6F,0X81C0,0X62D6,
-0X6258,0X8131,0X9E35,0X9640,0X9A6E,0X9A7C,0X692D,0X59A5,0X62D3,0X553E,0X6316,0X54C7,0X86D9,0X6D3C,0X5A03,0X74E6,
-0X889C,0X6B6A,0X5916,0X8C4C,0X5F2F,0X6E7E,0X73A9,0X987D,0X4E38,0X70F7,0X5B8C,0X7897,0X633D,0X665A,0X7696,0X60CB,
-0X5B9B,0X5A49,0X4E07,0X8155,0X6C6A,0X738B,0X4EA1,0X6789,0X7F51,0X5F80,0X65FA,0X671B,0X5FD8,0X5984,0X5A01,0X0001,
-0X8719,0X871B,0X871D,0X871F,0X8720,0X8724,0X8726,0X8727,0X8728,0X872A,0X872B,0X872C,0X872D,0X872F,0X8730,0X8732,
-0X8733,0X8735,0X8736,0X8738,0X8739,0X873A,0X873C,0X873D,0X8740,0X8741,0X8742,0X8743,0X8744,0X8745,0X8746,0X874A,
-0X874B,0X874D,0X874F,0X8750,0X8751,0X8752,0X8754,0X8755,0X8756,0X8758,0X875A,0X875B,0X875C,0X875D,0X875E,0X875F,
-0X8761,0X8762,0X8766,0X8767,0X8768,0X8769,0X876A,0X876B,0X876C,0X876D,0X876F,0X8771,0X8772,0X8773,0X8775,0X0001,
-0X8777,0X8778,0X8779,0X877A,0X877F,0X8780,0X8781,0X8784,0X8786,0X8787,0X8789,0X878A,0X878C,0X878E,0X878F,0X8790,
-0X8791,0X8792,0X8794,0X8795,0X8796,0X8798,0X8799,0X879A,0X879B,0X879C,0X879D,0X879E,0X87A0,0X87A1,0X87A2,0X87A3,
-0X87A4,0X5DCD,0X5FAE,0X5371,0X97E6,0X8FDD,0X6845,0X56F4,0X552F,0X60DF,0X4E3A,0X6F4D,0X7EF4,0X82C7,0X840E,0X59D4,
-0X4F1F,0X4F2A,0X5C3E,0X7EAC,0X672A,0X851A,0X5473,0X754F,0X80C3,0X5582,0X9B4F,0X4F4D,0X6E2D,0X8C13,0X5C09,0X6170,
-0X536B,0X761F,0X6E29,0X868A,0X6587,0X95FB,0X7EB9,0X543B,0X7A33,0X7D0A,0X95EE,0X55E1,0X7FC1,0X74EE,0X631D,0X8717,
-0X6DA1,0X7A9D,0X6211,0X65A1,0X5367,0X63E1,0X6C83,0X5DEB,0X545C,0X94A8,0X4E4C,0X6C61,0X8BEC,0X5C4B,0X65E0,0X829C,
-0X68A7,0X543E,0X5434,0X6BCB,0X6B66,0X4E94,0X6342,0X5348,0X821E,0X4F0D,0X4FAE,0X575E,0X620A,0X96FE,0X6664,0X7269,
-0X52FF,0X52A1,0X609F,0X8BEF,0X6614,0X7199,0X6790,0X897F,0X7852,0X77FD,0X6670,0X563B,0X5438,0X9521,0X727A,0X0001,
-0X87A5,0X87A6,0X87A7,0X87A9,0X87AA,0X87AE,0X87B0,0X87B1,0X87B2,0X87B4,0X87B6,0X87B7,0X87B8,0X87B9,0X87BB,0X87BC,
-0X87BE,0X87BF,0X87C1,0X87C2,0X87C3,0X87C4,0X87C5,0X87C7,0X87C8,0X87C9,0X87CC,0X87CD,0X87CE,0X87CF,0X87D0,0X87D4,
-0X87D5,0X87D6,0X87D7,0X87D8,0X87D9,0X87DA,0X87DC,0X87DD,0X87DE,0X87DF,0X87E1,0X87E2,0X87E3,0X87E4,0X87E6,0X87E7,
-0X87E8,0X87E9,0X87EB,0X87EC,0X87ED,0X87EF,0X87F0,0X87F1,0X87F2,0X87F3,0X87F4,0X87F5,0X87F6,0X87F7,0X87F8,0X0001,
-0X87FA,0X87FB,0X87FC,0X87FD,0X87FF,0X8800,0X8801,0X8802,0X8804,0X8805,0X8806,0X8807,0X8808,0X8809,0X880B,0X880C,
-0X880D,0X880E,0X880F,0X8810,0X8811,0X8812,0X8814,0X8817,0X8818,0X8819,0X881A,0X881C,0X881D,0X881E,0X881F,0X8820,
-0X8823,0X7A00,0X606F,0X5E0C,0X6089,0X819D,0X5915,0X60DC,0X7184,0X70EF,0X6EAA,0X6C50,0X7280,0X6A84,0X88AD,0X5E2D,
-0X4E60,0X5AB3,0X559C,0X94E3,0X6D17,0X7CFB,0X9699,0X620F,0X7EC6,0X778E,0X867E,0X5323,0X971E,0X8F96,0X6687,0X5CE1,
-0X4FA0,0X72ED,0X4E0B,0X53A6,0X590F,0X5413,0X6380,0X9528,0X5148,0X4ED9,0X9C9C,0X7EA4,0X54B8,0X8D24,0X8854,0X8237,
-0X95F2,0X6D8E,0X5F26,0X5ACC,0X663E,0X9669,0X73B0,0X732E,0X53BF,0X817A,0X9985,0X7FA1,0X5BAA,0X9677,0X9650,0X7EBF,
-0X76F8,0X53A2,0X9576,0X9999,0X7BB1,0X8944,0X6E58,0X4E61,0X7FD4,0X7965,0X8BE6,0X60F3,0X54CD,0X4EAB,0X9879,0X5DF7,
-0X6A61,0X50CF,0X5411,0X8C61,0X8427,0X785D,0X9704,0X524A,0X54EE,0X56A3,0X9500,0X6D88,0X5BB5,0X6DC6,0X6653,0X0001,
-0X8824,0X8825,0X8826,0X8827,0X8828,0X8829,0X882A,0X882B,0X882C,0X882D,0X882E,0X882F,0X8830,0X8831,0X8833,0X8834,
-0X8835,0X8836,0X8837,0X8838,0X883A,0X883B,0X883D,0X883E,0X883F,0X8841,0X8842,0X8843,0X8846,0X8847,0X8848,0X8849,
-0X884A,0X884B,0X884E,0X884F,0X8850,0X8851,0X8852,0X8853,0X8855,0X8856,0X8858,0X885A,0X885B,0X885C,0X885D,0X885E,
-0X885F,0X8860,0X8866,0X8867,0X886A,0X886D,0X886F,0X8871,0X8873,0X8874,0X8875,0X8876,0X8878,0X8879,0X887A,0X0001,
-0X887B,0X887C,0X8880,0X8883,0X8886,0X8887,0X8889,0X888A,0X888C,0X888E,0X888F,0X8890,0X8891,0X8893,0X8894,0X8895,
-0X8897,0X8898,0X8899,0X889A,0X889B,0X889D,0X889E,0X889F,0X88A0,0X88A1,0X88A3,0X88A5,0X88A6,0X88A7,0X88A8,0X88A9,
-0X88AA,0X5C0F,0X5B5D,0X6821,0X8096,0X5578,0X7B11,0X6548,0X6954,0X4E9B,0X6B47,0X874E,0X978B,0X534F,0X631F,0X643A,
-0X90AA,0X659C,0X80C1,0X8C10,0X5199,0X68B0,0X5378,0X87F9,0X61C8,0X6CC4,0X6CFB,0X8C22,0X5C51,0X85AA,0X82AF,0X950C,
-0X6B23,0X8F9B,0X65B0,0X5FFB,0X5FC3,0X4FE1,0X8845,0X661F,0X8165,0X7329,0X60FA,0X5174,0X5211,0X578B,0X5F62,0X90A2,
-0X884C,0X9192,0X5E78,0X674F,0X6027,0X59D3,0X5144,0X51F6,0X80F8,0X5308,0X6C79,0X96C4,0X718A,0X4F11,0X4FEE,0X7F9E,
-0X673D,0X55C5,0X9508,0X79C0,0X8896,0X7EE3,0X589F,0X620C,0X9700,0X865A,0X5618,0X987B,0X5F90,0X8BB8,0X84C4,0X9157,
-0X53D9,0X65ED,0X5E8F,0X755C,0X6064,0X7D6E,0X5A7F,0X7EEA,0X7EED,0X8F69,0X55A7,0X5BA3,0X60AC,0X65CB,0X7384,0X0001,
-0X88AC,0X88AE,0X88AF,0X88B0,0X88B2,0X88B3,0X88B4,0X88B5,0X88B6,0X88B8,0X88B9,0X88BA,0X88BB,0X88BD,0X88BE,0X88BF,
-0X88C0,0X88C3,0X88C4,0X88C7,0X88C8,0X88CA,0X88CB,0X88CC,0X88CD,0X88CF,0X88D0,0X88D1,0X88D3,0X88D6,0X88D7,0X88DA,
-0X88DB,0X88DC,0X88DD,0X88DE,0X88E0,0X88E1,0X88E6,0X88E7,0X88E9,0X88EA,0X88EB,0X88EC,0X88ED,0X88EE,0X88EF,0X88F2,
-0X88F5,0X88F6,0X88F7,0X88FA,0X88FB,0X88FD,0X88FF,0X8900,0X8901,0X8903,0X8904,0X8905,0X8906,0X8907,0X8908,0X0001,
-0X8909,0X890B,0X890C,0X890D,0X890E,0X890F,0X8911,0X8914,0X8915,0X8916,0X8917,0X8918,0X891C,0X891D,0X891E,0X891F,
-0X8920,0X8922,0X8923,0X8924,0X8926,0X8927,0X8928,0X8929,0X892C,0X892D,0X892E,0X892F,0X8931,0X8932,0X8933,0X8935,
-0X8937,0X9009,0X7663,0X7729,0X7EDA,0X9774,0X859B,0X5B66,0X7A74,0X96EA,0X8840,0X52CB,0X718F,0X5FAA,0X65EC,0X8BE2,
-0X5BFB,0X9A6F,0X5DE1,0X6B89,0X6C5B,0X8BAD,0X8BAF,0X900A,0X8FC5,0X538B,0X62BC,0X9E26,0X9E2D,0X5440,0X4E2B,0X82BD,
-0X7259,0X869C,0X5D16,0X8859,0X6DAF,0X96C5,0X54D1,0X4E9A,0X8BB6,0X7109,0X54BD,0X9609,0X70DF,0X6DF9,0X76D0,0X4E25,
-0X7814,0X8712,0X5CA9,0X5EF6,0X8A00,0X989C,0X960E,0X708E,0X6CBF,0X5944,0X63A9,0X773C,0X884D,0X6F14,0X8273,0X5830,
-0X71D5,0X538C,0X781A,0X96C1,0X5501,0X5F66,0X7130,0X5BB4,0X8C1A,0X9A8C,0X6B83,0X592E,0X9E2F,0X79E7,0X6768,0X626C,
-0X4F6F,0X75A1,0X7F8A,0X6D0B,0X9633,0X6C27,0X4EF0,0X75D2,0X517B,0X6837,0X6F3E,0X9080,0X8170,0X5996,0X7476,0X0001,
-0X8938,0X8939,0X893A,0X893B,0X893C,0X893D,0X893E,0X893F,0X8940,0X8942,0X8943,0X8945,0X8946,0X8947,0X8948,0X8949,
-0X894A,0X894B,0X894C,0X894D,0X894E,0X894F,0X8950,0X8951,0X8952,0X8953,0X8954,0X8955,0X8956,0X8957,0X8958,0X8959,
-0X895A,0X895B,0X895C,0X895D,0X8960,0X8961,0X8962,0X8963,0X8964,0X8965,0X8967,0X8968,0X8969,0X896A,0X896B,0X896C,
-0X896D,0X896E,0X896F,0X8970,0X8971,0X8972,0X8973,0X8974,0X8975,0X8976,0X8977,0X8978,0X8979,0X897A,0X897C,0X0001,
-0X897D,0X897E,0X8980,0X8982,0X8984,0X8985,0X8987,0X8988,0X8989,0X898A,0X898B,0X898C,0X898D,0X898E,0X898F,0X8990,
-0X8991,0X8992,0X8993,0X8994,0X8995,0X8996,0X8997,0X8998,0X8999,0X899A,0X899B,0X899C,0X899D,0X899E,0X899F,0X89A0,
-0X89A1,0X6447,0X5C27,0X9065,0X7A91,0X8C23,0X59DA,0X54AC,0X8200,0X836F,0X8981,0X8000,0X6930,0X564E,0X8036,0X7237,
-0X91CE,0X51B6,0X4E5F,0X9875,0X6396,0X4E1A,0X53F6,0X66F3,0X814B,0X591C,0X6DB2,0X4E00,0X58F9,0X533B,0X63D6,0X94F1,
-0X4F9D,0X4F0A,0X8863,0X9890,0X5937,0X9057,0X79FB,0X4EEA,0X80F0,0X7591,0X6C82,0X5B9C,0X59E8,0X5F5D,0X6905,0X8681,
-0X501A,0X5DF2,0X4E59,0X77E3,0X4EE5,0X827A,0X6291,0X6613,0X9091,0X5C79,0X4EBF,0X5F79,0X81C6,0X9038,0X8084,0X75AB,
-0X4EA6,0X88D4,0X610F,0X6BC5,0X5FC6,0X4E49,0X76CA,0X6EA2,0X8BE3,0X8BAE,0X8C0A,0X8BD1,0X5F02,0X7FFC,0X7FCC,0X7ECE,
-0X8335,0X836B,0X56E0,0X6BB7,0X97F3,0X9634,0X59FB,0X541F,0X94F6,0X6DEB,0X5BC5,0X996E,0X5C39,0X5F15,0X9690,0X0001,
-0X89A2,0X89A3,0X89A4,0X89A5,0X89A6,0X89A7,0X89A8,0X89A9,0X89AA,0X89AB,0X89AC,0X89AD,0X89AE,0X89AF,0X89B0,0X89B1,
-0X89B2,0X89B3,0X89B4,0X89B5,0X89B6,0X89B7,0X89B8,0X89B9,0X89BA,0X89BB,0X89BC,0X89BD,0X89BE,0X89BF,0X89C0,0X89C3,
-0X89CD,0X89D3,0X89D4,0X89D5,0X89D7,0X89D8,0X89D9,0X89DB,0X89DD,0X89DF,0X89E0,0X89E1,0X89E2,0X89E4,0X89E7,0X89E8,
-0X89E9,0X89EA,0X89EC,0X89ED,0X89EE,0X89F0,0X89F1,0X89F2,0X89F4,0X89F5,0X89F6,0X89F7,0X89F8,0X89F9,0X89FA,0X0001,
-0X89FB,0X89FC,0X89FD,0X89FE,0X89FF,0X8A01,0X8A02,0X8A03,0X8A04,0X8A05,0X8A06,0X8A08,0X8A09,0X8A0A,0X8A0B,0X8A0C,
-0X8A0D,0X8A0E,0X8A0F,0X8A10,0X8A11,0X8A12,0X8A13,0X8A14,0X8A15,0X8A16,0X8A17,0X8A18,0X8A19,0X8A1A,0X8A1B,0X8A1C,
-0X8A1D,0X5370,0X82F1,0X6A31,0X5A74,0X9E70,0X5E94,0X7F28,0X83B9,0X8424,0X8425,0X8367,0X8747,0X8FCE,0X8D62,0X76C8,
-0X5F71,0X9896,0X786C,0X6620,0X54DF,0X62E5,0X4F63,0X81C3,0X75C8,0X5EB8,0X96CD,0X8E0A,0X86F9,0X548F,0X6CF3,0X6D8C,
-0X6C38,0X607F,0X52C7,0X7528,0X5E7D,0X4F18,0X60A0,0X5FE7,0X5C24,0X7531,0X90AE,0X94C0,0X72B9,0X6CB9,0X6E38,0X9149,
-0X6709,0X53CB,0X53F3,0X4F51,0X91C9,0X8BF1,0X53C8,0X5E7C,0X8FC2,0X6DE4,0X4E8E,0X76C2,0X6986,0X865E,0X611A,0X8206,
-0X4F59,0X4FDE,0X903E,0X9C7C,0X6109,0X6E1D,0X6E14,0X9685,0X4E88,0X5A31,0X96E8,0X4E0E,0X5C7F,0X79B9,0X5B87,0X8BED,
-0X7FBD,0X7389,0X57DF,0X828B,0X90C1,0X5401,0X9047,0X55BB,0X5CEA,0X5FA1,0X6108,0X6B32,0X72F1,0X80B2,0X8A89,0X0001,
-0X8A1E,0X8A1F,0X8A20,0X8A21,0X8A22,0X8A23,0X8A24,0X8A25,0X8A26,0X8A27,0X8A28,0X8A29,0X8A2A,0X8A2B,0X8A2C,0X8A2D,
-0X8A2E,0X8A2F,0X8A30,0X8A31,0X8A32,0X8A33,0X8A34,0X8A35,0X8A36,0X8A37,0X8A38,0X8A39,0X8A3A,0X8A3B,0X8A3C,0X8A3D,
-0X8A3F,0X8A40,0X8A41,0X8A42,0X8A43,0X8A44,0X8A45,0X8A46,0X8A47,0X8A49,0X8A4A,0X8A4B,0X8A4C,0X8A4D,0X8A4E,0X8A4F,
-0X8A50,0X8A51,0X8A52,0X8A53,0X8A54,0X8A55,0X8A56,0X8A57,0X8A58,0X8A59,0X8A5A,0X8A5B,0X8A5C,0X8A5D,0X8A5E,0X0001,
-0X8A5F,0X8A60,0X8A61,0X8A62,0X8A63,0X8A64,0X8A65,0X8A66,0X8A67,0X8A68,0X8A69,0X8A6A,0X8A6B,0X8A6C,0X8A6D,0X8A6E,
-0X8A6F,0X8A70,0X8A71,0X8A72,0X8A73,0X8A74,0X8A75,0X8A76,0X8A77,0X8A78,0X8A7A,0X8A7B,0X8A7C,0X8A7D,0X8A7E,0X8A7F,
-0X8A80,0X6D74,0X5BD3,0X88D5,0X9884,0X8C6B,0X9A6D,0X9E33,0X6E0A,0X51A4,0X5143,0X57A3,0X8881,0X539F,0X63F4,0X8F95,
-0X56ED,0X5458,0X5706,0X733F,0X6E90,0X7F18,0X8FDC,0X82D1,0X613F,0X6028,0X9662,0X66F0,0X7EA6,0X8D8A,0X8DC3,0X94A5,
-0X5CB3,0X7CA4,0X6708,0X60A6,0X9605,0X8018,0X4E91,0X90E7,0X5300,0X9668,0X5141,0X8FD0,0X8574,0X915D,0X6655,0X97F5,
-0X5B55,0X531D,0X7838,0X6742,0X683D,0X54C9,0X707E,0X5BB0,0X8F7D,0X518D,0X5728,0X54B1,0X6512,0X6682,0X8D5E,0X8D43,
-0X810F,0X846C,0X906D,0X7CDF,0X51FF,0X85FB,0X67A3,0X65E9,0X6FA1,0X86A4,0X8E81,0X566A,0X9020,0X7682,0X7076,0X71E5,
-0X8D23,0X62E9,0X5219,0X6CFD,0X8D3C,0X600E,0X589E,0X618E,0X66FE,0X8D60,0X624E,0X55B3,0X6E23,0X672D,0X8F67,0X0001,
-0X8A81,0X8A82,0X8A83,0X8A84,0X8A85,0X8A86,0X8A87,0X8A88,0X8A8B,0X8A8C,0X8A8D,0X8A8E,0X8A8F,0X8A90,0X8A91,0X8A92,
-0X8A94,0X8A95,0X8A96,0X8A97,0X8A98,0X8A99,0X8A9A,0X8A9B,0X8A9C,0X8A9D,0X8A9E,0X8A9F,0X8AA0,0X8AA1,0X8AA2,0X8AA3,
-0X8AA4,0X8AA5,0X8AA6,0X8AA7,0X8AA8,0X8AA9,0X8AAA,0X8AAB,0X8AAC,0X8AAD,0X8AAE,0X8AAF,0X8AB0,0X8AB1,0X8AB2,0X8AB3,
-0X8AB4,0X8AB5,0X8AB6,0X8AB7,0X8AB8,0X8AB9,0X8ABA,0X8ABB,0X8ABC,0X8ABD,0X8ABE,0X8ABF,0X8AC0,0X8AC1,0X8AC2,0X0001,
-0X8AC3,0X8AC4,0X8AC5,0X8AC6,0X8AC7,0X8AC8,0X8AC9,0X8ACA,0X8ACB,0X8ACC,0X8ACD,0X8ACE,0X8ACF,0X8AD0,0X8AD1,0X8AD2,
-0X8AD3,0X8AD4,0X8AD5,0X8AD6,0X8AD7,0X8AD8,0X8AD9,0X8ADA,0X8ADB,0X8ADC,0X8ADD,0X8ADE,0X8ADF,0X8AE0,0X8AE1,0X8AE2,
-0X8AE3,0X94E1,0X95F8,0X7728,0X6805,0X69A8,0X548B,0X4E4D,0X70B8,0X8BC8,0X6458,0X658B,0X5B85,0X7A84,0X503A,0X5BE8,
-0X77BB,0X6BE1,0X8A79,0X7C98,0X6CBE,0X76CF,0X65A9,0X8F97,0X5D2D,0X5C55,0X8638,0X6808,0X5360,0X6218,0X7AD9,0X6E5B,
-0X7EFD,0X6A1F,0X7AE0,0X5F70,0X6F33,0X5F20,0X638C,0X6DA8,0X6756,0X4E08,0X5E10,0X8D26,0X4ED7,0X80C0,0X7634,0X969C,
-0X62DB,0X662D,0X627E,0X6CBC,0X8D75,0X7167,0X7F69,0X5146,0X8087,0X53EC,0X906E,0X6298,0X54F2,0X86F0,0X8F99,0X8005,
-0X9517,0X8517,0X8FD9,0X6D59,0X73CD,0X659F,0X771F,0X7504,0X7827,0X81FB,0X8D1E,0X9488,0X4FA6,0X6795,0X75B9,0X8BCA,
-0X9707,0X632F,0X9547,0X9635,0X84B8,0X6323,0X7741,0X5F81,0X72F0,0X4E89,0X6014,0X6574,0X62EF,0X6B63,0X653F,0X0001,
-0X8AE4,0X8AE5,0X8AE6,0X8AE7,0X8AE8,0X8AE9,0X8AEA,0X8AEB,0X8AEC,0X8AED,0X8AEE,0X8AEF,0X8AF0,0X8AF1,0X8AF2,0X8AF3,
-0X8AF4,0X8AF5,0X8AF6,0X8AF7,0X8AF8,0X8AF9,0X8AFA,0X8AFB,0X8AFC,0X8AFD,0X8AFE,0X8AFF,0X8B00,0X8B01,0X8B02,0X8B03,
-0X8B04,0X8B05,0X8B06,0X8B08,0X8B09,0X8B0A,0X8B0B,0X8B0C,0X8B0D,0X8B0E,0X8B0F,0X8B10,0X8B11,0X8B12,0X8B13,0X8B14,
-0X8B15,0X8B16,0X8B17,0X8B18,0X8B19,0X8B1A,0X8B1B,0X8B1C,0X8B1D,0X8B1E,0X8B1F,0X8B20,0X8B21,0X8B22,0X8B23,0X0001,
-0X8B24,0X8B25,0X8B27,0X8B28,0X8B29,0X8B2A,0X8B2B,0X8B2C,0X8B2D,0X8B2E,0X8B2F,0X8B30,0X8B31,0X8B32,0X8B33,0X8B34,
-0X8B35,0X8B36,0X8B37,0X8B38,0X8B39,0X8B3A,0X8B3B,0X8B3C,0X8B3D,0X8B3E,0X8B3F,0X8B40,0X8B41,0X8B42,0X8B43,0X8B44,
-0X8B45,0X5E27,0X75C7,0X90D1,0X8BC1,0X829D,0X679D,0X652F,0X5431,0X8718,0X77E5,0X80A2,0X8102,0X6C41,0X4E4B,0X7EC7,
-0X804C,0X76F4,0X690D,0X6B96,0X6267,0X503C,0X4F84,0X5740,0X6307,0X6B62,0X8DBE,0X53EA,0X65E8,0X7EB8,0X5FD7,0X631A,
-0X63B7,0X81F3,0X81F4,0X7F6E,0X5E1C,0X5CD9,0X5236,0X667A,0X79E9,0X7A1A,0X8D28,0X7099,0X75D4,0X6EDE,0X6CBB,0X7A92,
-0X4E2D,0X76C5,0X5FE0,0X949F,0X8877,0X7EC8,0X79CD,0X80BF,0X91CD,0X4EF2,0X4F17,0X821F,0X5468,0X5DDE,0X6D32,0X8BCC,
-0X7CA5,0X8F74,0X8098,0X5E1A,0X5492,0X76B1,0X5B99,0X663C,0X9AA4,0X73E0,0X682A,0X86DB,0X6731,0X732A,0X8BF8,0X8BDB,
-0X9010,0X7AF9,0X70DB,0X716E,0X62C4,0X77A9,0X5631,0X4E3B,0X8457,0X67F1,0X52A9,0X86C0,0X8D2E,0X94F8,0X7B51,0X0001,
-0X8B46,0X8B47,0X8B48,0X8B49,0X8B4A,0X8B4B,0X8B4C,0X8B4D,0X8B4E,0X8B4F,0X8B50,0X8B51,0X8B52,0X8B53,0X8B54,0X8B55,
-0X8B56,0X8B57,0X8B58,0X8B59,0X8B5A,0X8B5B,0X8B5C,0X8B5D,0X8B5E,0X8B5F,0X8B60,0X8B61,0X8B62,0X8B63,0X8B64,0X8B65,
-0X8B67,0X8B68,0X8B69,0X8B6A,0X8B6B,0X8B6D,0X8B6E,0X8B6F,0X8B70,0X8B71,0X8B72,0X8B73,0X8B74,0X8B75,0X8B76,0X8B77,
-0X8B78,0X8B79,0X8B7A,0X8B7B,0X8B7C,0X8B7D,0X8B7E,0X8B7F,0X8B80,0X8B81,0X8B82,0X8B83,0X8B84,0X8B85,0X8B86,0X0001,
-0X8B87,0X8B88,0X8B89,0X8B8A,0X8B8B,0X8B8C,0X8B8D,0X8B8E,0X8B8F,0X8B90,0X8B91,0X8B92,0X8B93,0X8B94,0X8B95,0X8B96,
-0X8B97,0X8B98,0X8B99,0X8B9A,0X8B9B,0X8B9C,0X8B9D,0X8B9E,0X8B9F,0X8BAC,0X8BB1,0X8BBB,0X8BC7,0X8BD0,0X8BEA,0X8C09,
-0X8C1E,0X4F4F,0X6CE8,0X795D,0X9A7B,0X6293,0X722A,0X62FD,0X4E13,0X7816,0X8F6C,0X64B0,0X8D5A,0X7BC6,0X6869,0X5E84,
-0X88C5,0X5986,0X649E,0X58EE,0X72B6,0X690E,0X9525,0X8FFD,0X8D58,0X5760,0X7F00,0X8C06,0X51C6,0X6349,0X62D9,0X5353,
-0X684C,0X7422,0X8301,0X914C,0X5544,0X7740,0X707C,0X6D4A,0X5179,0X54A8,0X8D44,0X59FF,0X6ECB,0X6DC4,0X5B5C,0X7D2B,
-0X4ED4,0X7C7D,0X6ED3,0X5B50,0X81EA,0X6E0D,0X5B57,0X9B03,0X68D5,0X8E2A,0X5B97,0X7EFC,0X603B,0X7EB5,0X90B9,0X8D70,
-0X594F,0X63CD,0X79DF,0X8DB3,0X5352,0X65CF,0X7956,0X8BC5,0X963B,0X7EC4,0X94BB,0X7E82,0X5634,0X9189,0X6700,0X7F6A,
-0X5C0A,0X9075,0X6628,0X5DE6,0X4F50,0X67DE,0X505A,0X4F5C,0X5750,0X5EA7,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X8C38,0X8C39,0X8C3A,0X8C3B,0X8C3C,0X8C3D,0X8C3E,0X8C3F,0X8C40,0X8C42,0X8C43,0X8C44,0X8C45,0X8C48,0X8C4A,0X8C4B,
-0X8C4D,0X8C4E,0X8C4F,0X8C50,0X8C51,0X8C52,0X8C53,0X8C54,0X8C56,0X8C57,0X8C58,0X8C59,0X8C5B,0X8C5C,0X8C5D,0X8C5E,
-0X8C5F,0X8C60,0X8C63,0X8C64,0X8C65,0X8C66,0X8C67,0X8C68,0X8C69,0X8C6C,0X8C6D,0X8C6E,0X8C6F,0X8C70,0X8C71,0X8C72,
-0X8C74,0X8C75,0X8C76,0X8C77,0X8C7B,0X8C7C,0X8C7D,0X8C7E,0X8C7F,0X8C80,0X8C81,0X8C83,0X8C84,0X8C86,0X8C87,0X0001,
-0X8C88,0X8C8B,0X8C8D,0X8C8E,0X8C8F,0X8C90,0X8C91,0X8C92,0X8C93,0X8C95,0X8C96,0X8C97,0X8C99,0X8C9A,0X8C9B,0X8C9C,
-0X8C9D,0X8C9E,0X8C9F,0X8CA0,0X8CA1,0X8CA2,0X8CA3,0X8CA4,0X8CA5,0X8CA6,0X8CA7,0X8CA8,0X8CA9,0X8CAA,0X8CAB,0X8CAC,
-0X8CAD,0X4E8D,0X4E0C,0X5140,0X4E10,0X5EFF,0X5345,0X4E15,0X4E98,0X4E1E,0X9B32,0X5B6C,0X5669,0X4E28,0X79BA,0X4E3F,
-0X5315,0X4E47,0X592D,0X723B,0X536E,0X6C10,0X56DF,0X80E4,0X9997,0X6BD3,0X777E,0X9F17,0X4E36,0X4E9F,0X9F10,0X4E5C,
-0X4E69,0X4E93,0X8288,0X5B5B,0X556C,0X560F,0X4EC4,0X538D,0X539D,0X53A3,0X53A5,0X53AE,0X9765,0X8D5D,0X531A,0X53F5,
-0X5326,0X532E,0X533E,0X8D5C,0X5366,0X5363,0X5202,0X5208,0X520E,0X522D,0X5233,0X523F,0X5240,0X524C,0X525E,0X5261,
-0X525C,0X84AF,0X527D,0X5282,0X5281,0X5290,0X5293,0X5182,0X7F54,0X4EBB,0X4EC3,0X4EC9,0X4EC2,0X4EE8,0X4EE1,0X4EEB,
-0X4EDE,0X4F1B,0X4EF3,0X4F22,0X4F64,0X4EF5,0X4F25,0X4F27,0X4F09,0X4F2B,0X4F5E,0X4F67,0X6538,0X4F5A,0X4F5D,0X0001,
-0X8CAE,0X8CAF,0X8CB0,0X8CB1,0X8CB2,0X8CB3,0X8CB4,0X8CB5,0X8CB6,0X8CB7,0X8CB8,0X8CB9,0X8CBA,0X8CBB,0X8CBC,0X8CBD,
-0X8CBE,0X8CBF,0X8CC0,0X8CC1,0X8CC2,0X8CC3,0X8CC4,0X8CC5,0X8CC6,0X8CC7,0X8CC8,0X8CC9,0X8CCA,0X8CCB,0X8CCC,0X8CCD,
-0X8CCE,0X8CCF,0X8CD0,0X8CD1,0X8CD2,0X8CD3,0X8CD4,0X8CD5,0X8CD6,0X8CD7,0X8CD8,0X8CD9,0X8CDA,0X8CDB,0X8CDC,0X8CDD,
-0X8CDE,0X8CDF,0X8CE0,0X8CE1,0X8CE2,0X8CE3,0X8CE4,0X8CE5,0X8CE6,0X8CE7,0X8CE8,0X8CE9,0X8CEA,0X8CEB,0X8CEC,0X0001,
-0X8CED,0X8CEE,0X8CEF,0X8CF0,0X8CF1,0X8CF2,0X8CF3,0X8CF4,0X8CF5,0X8CF6,0X8CF7,0X8CF8,0X8CF9,0X8CFA,0X8CFB,0X8CFC,
-0X8CFD,0X8CFE,0X8CFF,0X8D00,0X8D01,0X8D02,0X8D03,0X8D04,0X8D05,0X8D06,0X8D07,0X8D08,0X8D09,0X8D0A,0X8D0B,0X8D0C,
-0X8D0D,0X4F5F,0X4F57,0X4F32,0X4F3D,0X4F76,0X4F74,0X4F91,0X4F89,0X4F83,0X4F8F,0X4F7E,0X4F7B,0X4FAA,0X4F7C,0X4FAC,
-0X4F94,0X4FE6,0X4FE8,0X4FEA,0X4FC5,0X4FDA,0X4FE3,0X4FDC,0X4FD1,0X4FDF,0X4FF8,0X5029,0X504C,0X4FF3,0X502C,0X500F,
-0X502E,0X502D,0X4FFE,0X501C,0X500C,0X5025,0X5028,0X507E,0X5043,0X5055,0X5048,0X504E,0X506C,0X507B,0X50A5,0X50A7,
-0X50A9,0X50BA,0X50D6,0X5106,0X50ED,0X50EC,0X50E6,0X50EE,0X5107,0X510B,0X4EDD,0X6C3D,0X4F58,0X4F65,0X4FCE,0X9FA0,
-0X6C46,0X7C74,0X516E,0X5DFD,0X9EC9,0X9998,0X5181,0X5914,0X52F9,0X530D,0X8A07,0X5310,0X51EB,0X5919,0X5155,0X4EA0,
-0X5156,0X4EB3,0X886E,0X88A4,0X4EB5,0X8114,0X88D2,0X7980,0X5B34,0X8803,0X7FB8,0X51AB,0X51B1,0X51BD,0X51BC,0X0001,
-0X8D0E,0X8D0F,0X8D10,0X8D11,0X8D12,0X8D13,0X8D14,0X8D15,0X8D16,0X8D17,0X8D18,0X8D19,0X8D1A,0X8D1B,0X8D1C,0X8D20,
-0X8D51,0X8D52,0X8D57,0X8D5F,0X8D65,0X8D68,0X8D69,0X8D6A,0X8D6C,0X8D6E,0X8D6F,0X8D71,0X8D72,0X8D78,0X8D79,0X8D7A,
-0X8D7B,0X8D7C,0X8D7D,0X8D7E,0X8D7F,0X8D80,0X8D82,0X8D83,0X8D86,0X8D87,0X8D88,0X8D89,0X8D8C,0X8D8D,0X8D8E,0X8D8F,
-0X8D90,0X8D92,0X8D93,0X8D95,0X8D96,0X8D97,0X8D98,0X8D99,0X8D9A,0X8D9B,0X8D9C,0X8D9D,0X8D9E,0X8DA0,0X8DA1,0X0001,
-0X8DA2,0X8DA4,0X8DA5,0X8DA6,0X8DA7,0X8DA8,0X8DA9,0X8DAA,0X8DAB,0X8DAC,0X8DAD,0X8DAE,0X8DAF,0X8DB0,0X8DB2,0X8DB6,
-0X8DB7,0X8DB9,0X8DBB,0X8DBD,0X8DC0,0X8DC1,0X8DC2,0X8DC5,0X8DC7,0X8DC8,0X8DC9,0X8DCA,0X8DCD,0X8DD0,0X8DD2,0X8DD3,
-0X8DD4,0X51C7,0X5196,0X51A2,0X51A5,0X8BA0,0X8BA6,0X8BA7,0X8BAA,0X8BB4,0X8BB5,0X8BB7,0X8BC2,0X8BC3,0X8BCB,0X8BCF,
-0X8BCE,0X8BD2,0X8BD3,0X8BD4,0X8BD6,0X8BD8,0X8BD9,0X8BDC,0X8BDF,0X8BE0,0X8BE4,0X8BE8,0X8BE9,0X8BEE,0X8BF0,0X8BF3,
-0X8BF6,0X8BF9,0X8BFC,0X8BFF,0X8C00,0X8C02,0X8C04,0X8C07,0X8C0C,0X8C0F,0X8C11,0X8C12,0X8C14,0X8C15,0X8C16,0X8C19,
-0X8C1B,0X8C18,0X8C1D,0X8C1F,0X8C20,0X8C21,0X8C25,0X8C27,0X8C2A,0X8C2B,0X8C2E,0X8C2F,0X8C32,0X8C33,0X8C35,0X8C36,
-0X5369,0X537A,0X961D,0X9622,0X9621,0X9631,0X962A,0X963D,0X963C,0X9642,0X9649,0X9654,0X965F,0X9667,0X966C,0X9672,
-0X9674,0X9688,0X968D,0X9697,0X96B0,0X9097,0X909B,0X909D,0X9099,0X90AC,0X90A1,0X90B4,0X90B3,0X90B6,0X90BA,0X0001,
-0X8DD5,0X8DD8,0X8DD9,0X8DDC,0X8DE0,0X8DE1,0X8DE2,0X8DE5,0X8DE6,0X8DE7,0X8DE9,0X8DED,0X8DEE,0X8DF0,0X8DF1,0X8DF2,
-0X8DF4,0X8DF6,0X8DFC,0X8DFE,0X8DFF,0X8E00,0X8E01,0X8E02,0X8E03,0X8E04,0X8E06,0X8E07,0X8E08,0X8E0B,0X8E0D,0X8E0E,
-0X8E10,0X8E11,0X8E12,0X8E13,0X8E15,0X8E16,0X8E17,0X8E18,0X8E19,0X8E1A,0X8E1B,0X8E1C,0X8E20,0X8E21,0X8E24,0X8E25,
-0X8E26,0X8E27,0X8E28,0X8E2B,0X8E2D,0X8E30,0X8E32,0X8E33,0X8E34,0X8E36,0X8E37,0X8E38,0X8E3B,0X8E3C,0X8E3E,0X0001,
-0X8E3F,0X8E43,0X8E45,0X8E46,0X8E4C,0X8E4D,0X8E4E,0X8E4F,0X8E50,0X8E53,0X8E54,0X8E55,0X8E56,0X8E57,0X8E58,0X8E5A,
-0X8E5B,0X8E5C,0X8E5D,0X8E5E,0X8E5F,0X8E60,0X8E61,0X8E62,0X8E63,0X8E64,0X8E65,0X8E67,0X8E68,0X8E6A,0X8E6B,0X8E6E,
-0X8E71,0X90B8,0X90B0,0X90CF,0X90C5,0X90BE,0X90D0,0X90C4,0X90C7,0X90D3,0X90E6,0X90E2,0X90DC,0X90D7,0X90DB,0X90EB,
-0X90EF,0X90FE,0X9104,0X9122,0X911E,0X9123,0X9131,0X912F,0X9139,0X9143,0X9146,0X520D,0X5942,0X52A2,0X52AC,0X52AD,
-0X52BE,0X54FF,0X52D0,0X52D6,0X52F0,0X53DF,0X71EE,0X77CD,0X5EF4,0X51F5,0X51FC,0X9B2F,0X53B6,0X5F01,0X755A,0X5DEF,
-0X574C,0X57A9,0X57A1,0X587E,0X58BC,0X58C5,0X58D1,0X5729,0X572C,0X572A,0X5733,0X5739,0X572E,0X572F,0X575C,0X573B,
-0X5742,0X5769,0X5785,0X576B,0X5786,0X577C,0X577B,0X5768,0X576D,0X5776,0X5773,0X57AD,0X57A4,0X578C,0X57B2,0X57CF,
-0X57A7,0X57B4,0X5793,0X57A0,0X57D5,0X57D8,0X57DA,0X57D9,0X57D2,0X57B8,0X57F4,0X57EF,0X57F8,0X57E4,0X57DD,0X0001,
-0X8E73,0X8E75,0X8E77,0X8E78,0X8E79,0X8E7A,0X8E7B,0X8E7D,0X8E7E,0X8E80,0X8E82,0X8E83,0X8E84,0X8E86,0X8E88,0X8E89,
-0X8E8A,0X8E8B,0X8E8C,0X8E8D,0X8E8E,0X8E91,0X8E92,0X8E93,0X8E95,0X8E96,0X8E97,0X8E98,0X8E99,0X8E9A,0X8E9B,0X8E9D,
-0X8E9F,0X8EA0,0X8EA1,0X8EA2,0X8EA3,0X8EA4,0X8EA5,0X8EA6,0X8EA7,0X8EA8,0X8EA9,0X8EAA,0X8EAD,0X8EAE,0X8EB0,0X8EB1,
-0X8EB3,0X8EB4,0X8EB5,0X8EB6,0X8EB7,0X8EB8,0X8EB9,0X8EBB,0X8EBC,0X8EBD,0X8EBE,0X8EBF,0X8EC0,0X8EC1,0X8EC2,0X0001,
-0X8EC3,0X8EC4,0X8EC5,0X8EC6,0X8EC7,0X8EC8,0X8EC9,0X8ECA,0X8ECB,0X8ECC,0X8ECD,0X8ECF,0X8ED0,0X8ED1,0X8ED2,0X8ED3,
-0X8ED4,0X8ED5,0X8ED6,0X8ED7,0X8ED8,0X8ED9,0X8EDA,0X8EDB,0X8EDC,0X8EDD,0X8EDE,0X8EDF,0X8EE0,0X8EE1,0X8EE2,0X8EE3,
-0X8EE4,0X580B,0X580D,0X57FD,0X57ED,0X5800,0X581E,0X5819,0X5844,0X5820,0X5865,0X586C,0X5881,0X5889,0X589A,0X5880,
-0X99A8,0X9F19,0X61FF,0X8279,0X827D,0X827F,0X828F,0X828A,0X82A8,0X8284,0X828E,0X8291,0X8297,0X8299,0X82AB,0X82B8,
-0X82BE,0X82B0,0X82C8,0X82CA,0X82E3,0X8298,0X82B7,0X82AE,0X82CB,0X82CC,0X82C1,0X82A9,0X82B4,0X82A1,0X82AA,0X829F,
-0X82C4,0X82CE,0X82A4,0X82E1,0X8309,0X82F7,0X82E4,0X830F,0X8307,0X82DC,0X82F4,0X82D2,0X82D8,0X830C,0X82FB,0X82D3,
-0X8311,0X831A,0X8306,0X8314,0X8315,0X82E0,0X82D5,0X831C,0X8351,0X835B,0X835C,0X8308,0X8392,0X833C,0X8334,0X8331,
-0X839B,0X835E,0X832F,0X834F,0X8347,0X8343,0X835F,0X8340,0X8317,0X8360,0X832D,0X833A,0X8333,0X8366,0X8365,0X0001,
-0X8EE5,0X8EE6,0X8EE7,0X8EE8,0X8EE9,0X8EEA,0X8EEB,0X8EEC,0X8EED,0X8EEE,0X8EEF,0X8EF0,0X8EF1,0X8EF2,0X8EF3,0X8EF4,
-0X8EF5,0X8EF6,0X8EF7,0X8EF8,0X8EF9,0X8EFA,0X8EFB,0X8EFC,0X8EFD,0X8EFE,0X8EFF,0X8F00,0X8F01,0X8F02,0X8F03,0X8F04,
-0X8F05,0X8F06,0X8F07,0X8F08,0X8F09,0X8F0A,0X8F0B,0X8F0C,0X8F0D,0X8F0E,0X8F0F,0X8F10,0X8F11,0X8F12,0X8F13,0X8F14,
-0X8F15,0X8F16,0X8F17,0X8F18,0X8F19,0X8F1A,0X8F1B,0X8F1C,0X8F1D,0X8F1E,0X8F1F,0X8F20,0X8F21,0X8F22,0X8F23,0X0001,
-0X8F24,0X8F25,0X8F26,0X8F27,0X8F28,0X8F29,0X8F2A,0X8F2B,0X8F2C,0X8F2D,0X8F2E,0X8F2F,0X8F30,0X8F31,0X8F32,0X8F33,
-0X8F34,0X8F35,0X8F36,0X8F37,0X8F38,0X8F39,0X8F3A,0X8F3B,0X8F3C,0X8F3D,0X8F3E,0X8F3F,0X8F40,0X8F41,0X8F42,0X8F43,
-0X8F44,0X8368,0X831B,0X8369,0X836C,0X836A,0X836D,0X836E,0X83B0,0X8378,0X83B3,0X83B4,0X83A0,0X83AA,0X8393,0X839C,
-0X8385,0X837C,0X83B6,0X83A9,0X837D,0X83B8,0X837B,0X8398,0X839E,0X83A8,0X83BA,0X83BC,0X83C1,0X8401,0X83E5,0X83D8,
-0X5807,0X8418,0X840B,0X83DD,0X83FD,0X83D6,0X841C,0X8438,0X8411,0X8406,0X83D4,0X83DF,0X840F,0X8403,0X83F8,0X83F9,
-0X83EA,0X83C5,0X83C0,0X8426,0X83F0,0X83E1,0X845C,0X8451,0X845A,0X8459,0X8473,0X8487,0X8488,0X847A,0X8489,0X8478,
-0X843C,0X8446,0X8469,0X8476,0X848C,0X848E,0X8431,0X846D,0X84C1,0X84CD,0X84D0,0X84E6,0X84BD,0X84D3,0X84CA,0X84BF,
-0X84BA,0X84E0,0X84A1,0X84B9,0X84B4,0X8497,0X84E5,0X84E3,0X850C,0X750D,0X8538,0X84F0,0X8539,0X851F,0X853A,0X0001,
-0X8F45,0X8F46,0X8F47,0X8F48,0X8F49,0X8F4A,0X8F4B,0X8F4C,0X8F4D,0X8F4E,0X8F4F,0X8F50,0X8F51,0X8F52,0X8F53,0X8F54,
-0X8F55,0X8F56,0X8F57,0X8F58,0X8F59,0X8F5A,0X8F5B,0X8F5C,0X8F5D,0X8F5E,0X8F5F,0X8F60,0X8F61,0X8F62,0X8F63,0X8F64,
-0X8F65,0X8F6A,0X8F80,0X8F8C,0X8F92,0X8F9D,0X8FA0,0X8FA1,0X8FA2,0X8FA4,0X8FA5,0X8FA6,0X8FA7,0X8FAA,0X8FAC,0X8FAD,
-0X8FAE,0X8FAF,0X8FB2,0X8FB3,0X8FB4,0X8FB5,0X8FB7,0X8FB8,0X8FBA,0X8FBB,0X8FBC,0X8FBF,0X8FC0,0X8FC3,0X8FC6,0X0001,
-0X8FC9,0X8FCA,0X8FCB,0X8FCC,0X8FCD,0X8FCF,0X8FD2,0X8FD6,0X8FD7,0X8FDA,0X8FE0,0X8FE1,0X8FE3,0X8FE7,0X8FEC,0X8FEF,
-0X8FF1,0X8FF2,0X8FF4,0X8FF5,0X8FF6,0X8FFA,0X8FFB,0X8FFC,0X8FFE,0X8FFF,0X9007,0X9008,0X900C,0X900E,0X9013,0X9015,
-0X9018,0X8556,0X853B,0X84FF,0X84FC,0X8559,0X8548,0X8568,0X8564,0X855E,0X857A,0X77A2,0X8543,0X8572,0X857B,0X85A4,
-0X85A8,0X8587,0X858F,0X8579,0X85AE,0X859C,0X8585,0X85B9,0X85B7,0X85B0,0X85D3,0X85C1,0X85DC,0X85FF,0X8627,0X8605,
-0X8629,0X8616,0X863C,0X5EFE,0X5F08,0X593C,0X5941,0X8037,0X5955,0X595A,0X5958,0X530F,0X5C22,0X5C25,0X5C2C,0X5C34,
-0X624C,0X626A,0X629F,0X62BB,0X62CA,0X62DA,0X62D7,0X62EE,0X6322,0X62F6,0X6339,0X634B,0X6343,0X63AD,0X63F6,0X6371,
-0X637A,0X638E,0X63B4,0X636D,0X63AC,0X638A,0X6369,0X63AE,0X63BC,0X63F2,0X63F8,0X63E0,0X63FF,0X63C4,0X63DE,0X63CE,
-0X6452,0X63C6,0X63BE,0X6445,0X6441,0X640B,0X641B,0X6420,0X640C,0X6426,0X6421,0X645E,0X6484,0X646D,0X6496,0X0001,
-0X9019,0X901C,0X9023,0X9024,0X9025,0X9027,0X9028,0X9029,0X902A,0X902B,0X902C,0X9030,0X9031,0X9032,0X9033,0X9034,
-0X9037,0X9039,0X903A,0X903D,0X903F,0X9040,0X9043,0X9045,0X9046,0X9048,0X9049,0X904A,0X904B,0X904C,0X904E,0X9054,
-0X9055,0X9056,0X9059,0X905A,0X905C,0X905D,0X905E,0X905F,0X9060,0X9061,0X9064,0X9066,0X9067,0X9069,0X906A,0X906B,
-0X906C,0X906F,0X9070,0X9071,0X9072,0X9073,0X9076,0X9077,0X9078,0X9079,0X907A,0X907B,0X907C,0X907E,0X9081,0X0001,
-0X9084,0X9085,0X9086,0X9087,0X9089,0X908A,0X908C,0X908D,0X908E,0X908F,0X9090,0X9092,0X9094,0X9096,0X9098,0X909A,
-0X909C,0X909E,0X909F,0X90A0,0X90A4,0X90A5,0X90A7,0X90A8,0X90A9,0X90AB,0X90AD,0X90B2,0X90B7,0X90BC,0X90BD,0X90BF,
-0X90C0,0X647A,0X64B7,0X64B8,0X6499,0X64BA,0X64C0,0X64D0,0X64D7,0X64E4,0X64E2,0X6509,0X6525,0X652E,0X5F0B,0X5FD2,
-0X7519,0X5F11,0X535F,0X53F1,0X53FD,0X53E9,0X53E8,0X53FB,0X5412,0X5416,0X5406,0X544B,0X5452,0X5453,0X5454,0X5456,
-0X5443,0X5421,0X5457,0X5459,0X5423,0X5432,0X5482,0X5494,0X5477,0X5471,0X5464,0X549A,0X549B,0X5484,0X5476,0X5466,
-0X549D,0X54D0,0X54AD,0X54C2,0X54B4,0X54D2,0X54A7,0X54A6,0X54D3,0X54D4,0X5472,0X54A3,0X54D5,0X54BB,0X54BF,0X54CC,
-0X54D9,0X54DA,0X54DC,0X54A9,0X54AA,0X54A4,0X54DD,0X54CF,0X54DE,0X551B,0X54E7,0X5520,0X54FD,0X5514,0X54F3,0X5522,
-0X5523,0X550F,0X5511,0X5527,0X552A,0X5567,0X558F,0X55B5,0X5549,0X556D,0X5541,0X5555,0X553F,0X5550,0X553C,0X0001,
-0X90C2,0X90C3,0X90C6,0X90C8,0X90C9,0X90CB,0X90CC,0X90CD,0X90D2,0X90D4,0X90D5,0X90D6,0X90D8,0X90D9,0X90DA,0X90DE,
-0X90DF,0X90E0,0X90E3,0X90E4,0X90E5,0X90E9,0X90EA,0X90EC,0X90EE,0X90F0,0X90F1,0X90F2,0X90F3,0X90F5,0X90F6,0X90F7,
-0X90F9,0X90FA,0X90FB,0X90FC,0X90FF,0X9100,0X9101,0X9103,0X9105,0X9106,0X9107,0X9108,0X9109,0X910A,0X910B,0X910C,
-0X910D,0X910E,0X910F,0X9110,0X9111,0X9112,0X9113,0X9114,0X9115,0X9116,0X9117,0X9118,0X911A,0X911B,0X911C,0X0001,
-0X911D,0X911F,0X9120,0X9121,0X9124,0X9125,0X9126,0X9127,0X9128,0X9129,0X912A,0X912B,0X912C,0X912D,0X912E,0X9130,
-0X9132,0X9133,0X9134,0X9135,0X9136,0X9137,0X9138,0X913A,0X913B,0X913C,0X913D,0X913E,0X913F,0X9140,0X9141,0X9142,
-0X9144,0X5537,0X5556,0X5575,0X5576,0X5577,0X5533,0X5530,0X555C,0X558B,0X55D2,0X5583,0X55B1,0X55B9,0X5588,0X5581,
-0X559F,0X557E,0X55D6,0X5591,0X557B,0X55DF,0X55BD,0X55BE,0X5594,0X5599,0X55EA,0X55F7,0X55C9,0X561F,0X55D1,0X55EB,
-0X55EC,0X55D4,0X55E6,0X55DD,0X55C4,0X55EF,0X55E5,0X55F2,0X55F3,0X55CC,0X55CD,0X55E8,0X55F5,0X55E4,0X8F94,0X561E,
-0X5608,0X560C,0X5601,0X5624,0X5623,0X55FE,0X5600,0X5627,0X562D,0X5658,0X5639,0X5657,0X562C,0X564D,0X5662,0X5659,
-0X565C,0X564C,0X5654,0X5686,0X5664,0X5671,0X566B,0X567B,0X567C,0X5685,0X5693,0X56AF,0X56D4,0X56D7,0X56DD,0X56E1,
-0X56F5,0X56EB,0X56F9,0X56FF,0X5704,0X570A,0X5709,0X571C,0X5E0F,0X5E19,0X5E14,0X5E11,0X5E31,0X5E3B,0X5E3C,0X0001,
-0X9145,0X9147,0X9148,0X9151,0X9153,0X9154,0X9155,0X9156,0X9158,0X9159,0X915B,0X915C,0X915F,0X9160,0X9166,0X9167,
-0X9168,0X916B,0X916D,0X9173,0X917A,0X917B,0X917C,0X9180,0X9181,0X9182,0X9183,0X9184,0X9186,0X9188,0X918A,0X918E,
-0X918F,0X9193,0X9194,0X9195,0X9196,0X9197,0X9198,0X9199,0X919C,0X919D,0X919E,0X919F,0X91A0,0X91A1,0X91A4,0X91A5,
-0X91A6,0X91A7,0X91A8,0X91A9,0X91AB,0X91AC,0X91B0,0X91B1,0X91B2,0X91B3,0X91B6,0X91B7,0X91B8,0X91B9,0X91BB,0X0001,
-0X91BC,0X91BD,0X91BE,0X91BF,0X91C0,0X91C1,0X91C2,0X91C3,0X91C4,0X91C5,0X91C6,0X91C8,0X91CB,0X91D0,0X91D2,0X91D3,
-0X91D4,0X91D5,0X91D6,0X91D7,0X91D8,0X91D9,0X91DA,0X91DB,0X91DD,0X91DE,0X91DF,0X91E0,0X91E1,0X91E2,0X91E3,0X91E4,
-0X91E5,0X5E37,0X5E44,0X5E54,0X5E5B,0X5E5E,0X5E61,0X5C8C,0X5C7A,0X5C8D,0X5C90,0X5C96,0X5C88,0X5C98,0X5C99,0X5C91,
-0X5C9A,0X5C9C,0X5CB5,0X5CA2,0X5CBD,0X5CAC,0X5CAB,0X5CB1,0X5CA3,0X5CC1,0X5CB7,0X5CC4,0X5CD2,0X5CE4,0X5CCB,0X5CE5,
-0X5D02,0X5D03,0X5D27,0X5D26,0X5D2E,0X5D24,0X5D1E,0X5D06,0X5D1B,0X5D58,0X5D3E,0X5D34,0X5D3D,0X5D6C,0X5D5B,0X5D6F,
-0X5D5D,0X5D6B,0X5D4B,0X5D4A,0X5D69,0X5D74,0X5D82,0X5D99,0X5D9D,0X8C73,0X5DB7,0X5DC5,0X5F73,0X5F77,0X5F82,0X5F87,
-0X5F89,0X5F8C,0X5F95,0X5F99,0X5F9C,0X5FA8,0X5FAD,0X5FB5,0X5FBC,0X8862,0X5F61,0X72AD,0X72B0,0X72B4,0X72B7,0X72B8,
-0X72C3,0X72C1,0X72CE,0X72CD,0X72D2,0X72E8,0X72EF,0X72E9,0X72F2,0X72F4,0X72F7,0X7301,0X72F3,0X7303,0X72FA,0X0001,
-0X91E6,0X91E7,0X91E8,0X91E9,0X91EA,0X91EB,0X91EC,0X91ED,0X91EE,0X91EF,0X91F0,0X91F1,0X91F2,0X91F3,0X91F4,0X91F5,
-0X91F6,0X91F7,0X91F8,0X91F9,0X91FA,0X91FB,0X91FC,0X91FD,0X91FE,0X91FF,0X9200,0X9201,0X9202,0X9203,0X9204,0X9205,
-0X9206,0X9207,0X9208,0X9209,0X920A,0X920B,0X920C,0X920D,0X920E,0X920F,0X9210,0X9211,0X9212,0X9213,0X9214,0X9215,
-0X9216,0X9217,0X9218,0X9219,0X921A,0X921B,0X921C,0X921D,0X921E,0X921F,0X9220,0X9221,0X9222,0X9223,0X9224,0X0001,
-0X9225,0X9226,0X9227,0X9228,0X9229,0X922A,0X922B,0X922C,0X922D,0X922E,0X922F,0X9230,0X9231,0X9232,0X9233,0X9234,
-0X9235,0X9236,0X9237,0X9238,0X9239,0X923A,0X923B,0X923C,0X923D,0X923E,0X923F,0X9240,0X9241,0X9242,0X9243,0X9244,
-0X9245,0X72FB,0X7317,0X7313,0X7321,0X730A,0X731E,0X731D,0X7315,0X7322,0X7339,0X7325,0X732C,0X7338,0X7331,0X7350,
-0X734D,0X7357,0X7360,0X736C,0X736F,0X737E,0X821B,0X5925,0X98E7,0X5924,0X5902,0X9963,0X9967,0X9968,0X9969,0X996A,
-0X996B,0X996C,0X9974,0X9977,0X997D,0X9980,0X9984,0X9987,0X998A,0X998D,0X9990,0X9991,0X9993,0X9994,0X9995,0X5E80,
-0X5E91,0X5E8B,0X5E96,0X5EA5,0X5EA0,0X5EB9,0X5EB5,0X5EBE,0X5EB3,0X8D53,0X5ED2,0X5ED1,0X5EDB,0X5EE8,0X5EEA,0X81BA,
-0X5FC4,0X5FC9,0X5FD6,0X5FCF,0X6003,0X5FEE,0X6004,0X5FE1,0X5FE4,0X5FFE,0X6005,0X6006,0X5FEA,0X5FED,0X5FF8,0X6019,
-0X6035,0X6026,0X601B,0X600F,0X600D,0X6029,0X602B,0X600A,0X603F,0X6021,0X6078,0X6079,0X607B,0X607A,0X6042,0X0001,
-0X9246,0X9247,0X9248,0X9249,0X924A,0X924B,0X924C,0X924D,0X924E,0X924F,0X9250,0X9251,0X9252,0X9253,0X9254,0X9255,
-0X9256,0X9257,0X9258,0X9259,0X925A,0X925B,0X925C,0X925D,0X925E,0X925F,0X9260,0X9261,0X9262,0X9263,0X9264,0X9265,
-0X9266,0X9267,0X9268,0X9269,0X926A,0X926B,0X926C,0X926D,0X926E,0X926F,0X9270,0X9271,0X9272,0X9273,0X9275,0X9276,
-0X9277,0X9278,0X9279,0X927A,0X927B,0X927C,0X927D,0X927E,0X927F,0X9280,0X9281,0X9282,0X9283,0X9284,0X9285,0X0001,
-0X9286,0X9287,0X9288,0X9289,0X928A,0X928B,0X928C,0X928D,0X928F,0X9290,0X9291,0X9292,0X9293,0X9294,0X9295,0X9296,
-0X9297,0X9298,0X9299,0X929A,0X929B,0X929C,0X929D,0X929E,0X929F,0X92A0,0X92A1,0X92A2,0X92A3,0X92A4,0X92A5,0X92A6,
-0X92A7,0X606A,0X607D,0X6096,0X609A,0X60AD,0X609D,0X6083,0X6092,0X608C,0X609B,0X60EC,0X60BB,0X60B1,0X60DD,0X60D8,
-0X60C6,0X60DA,0X60B4,0X6120,0X6126,0X6115,0X6123,0X60F4,0X6100,0X610E,0X612B,0X614A,0X6175,0X61AC,0X6194,0X61A7,
-0X61B7,0X61D4,0X61F5,0X5FDD,0X96B3,0X95E9,0X95EB,0X95F1,0X95F3,0X95F5,0X95F6,0X95FC,0X95FE,0X9603,0X9604,0X9606,
-0X9608,0X960A,0X960B,0X960C,0X960D,0X960F,0X9612,0X9615,0X9616,0X9617,0X9619,0X961A,0X4E2C,0X723F,0X6215,0X6C35,
-0X6C54,0X6C5C,0X6C4A,0X6CA3,0X6C85,0X6C90,0X6C94,0X6C8C,0X6C68,0X6C69,0X6C74,0X6C76,0X6C86,0X6CA9,0X6CD0,0X6CD4,
-0X6CAD,0X6CF7,0X6CF8,0X6CF1,0X6CD7,0X6CB2,0X6CE0,0X6CD6,0X6CFA,0X6CEB,0X6CEE,0X6CB1,0X6CD3,0X6CEF,0X6CFE,0X0001,
-0X92A8,0X92A9,0X92AA,0X92AB,0X92AC,0X92AD,0X92AF,0X92B0,0X92B1,0X92B2,0X92B3,0X92B4,0X92B5,0X92B6,0X92B7,0X92B8,
-0X92B9,0X92BA,0X92BB,0X92BC,0X92BD,0X92BE,0X92BF,0X92C0,0X92C1,0X92C2,0X92C3,0X92C4,0X92C5,0X92C6,0X92C7,0X92C9,
-0X92CA,0X92CB,0X92CC,0X92CD,0X92CE,0X92CF,0X92D0,0X92D1,0X92D2,0X92D3,0X92D4,0X92D5,0X92D6,0X92D7,0X92D8,0X92D9,
-0X92DA,0X92DB,0X92DC,0X92DD,0X92DE,0X92DF,0X92E0,0X92E1,0X92E2,0X92E3,0X92E4,0X92E5,0X92E6,0X92E7,0X92E8,0X0001,
-0X92E9,0X92EA,0X92EB,0X92EC,0X92ED,0X92EE,0X92EF,0X92F0,0X92F1,0X92F2,0X92F3,0X92F4,0X92F5,0X92F6,0X92F7,0X92F8,
-0X92F9,0X92FA,0X92FB,0X92FC,0X92FD,0X92FE,0X92FF,0X9300,0X9301,0X9302,0X9303,0X9304,0X9305,0X9306,0X9307,0X9308,
-0X9309,0X6D39,0X6D27,0X6D0C,0X6D43,0X6D48,0X6D07,0X6D04,0X6D19,0X6D0E,0X6D2B,0X6D4D,0X6D2E,0X6D35,0X6D1A,0X6D4F,
-0X6D52,0X6D54,0X6D33,0X6D91,0X6D6F,0X6D9E,0X6DA0,0X6D5E,0X6D93,0X6D94,0X6D5C,0X6D60,0X6D7C,0X6D63,0X6E1A,0X6DC7,
-0X6DC5,0X6DDE,0X6E0E,0X6DBF,0X6DE0,0X6E11,0X6DE6,0X6DDD,0X6DD9,0X6E16,0X6DAB,0X6E0C,0X6DAE,0X6E2B,0X6E6E,0X6E4E,
-0X6E6B,0X6EB2,0X6E5F,0X6E86,0X6E53,0X6E54,0X6E32,0X6E25,0X6E44,0X6EDF,0X6EB1,0X6E98,0X6EE0,0X6F2D,0X6EE2,0X6EA5,
-0X6EA7,0X6EBD,0X6EBB,0X6EB7,0X6ED7,0X6EB4,0X6ECF,0X6E8F,0X6EC2,0X6E9F,0X6F62,0X6F46,0X6F47,0X6F24,0X6F15,0X6EF9,
-0X6F2F,0X6F36,0X6F4B,0X6F74,0X6F2A,0X6F09,0X6F29,0X6F89,0X6F8D,0X6F8C,0X6F78,0X6F72,0X6F7C,0X6F7A,0X6FD1,0X0001,
-0X930A,0X930B,0X930C,0X930D,0X930E,0X930F,0X9310,0X9311,0X9312,0X9313,0X9314,0X9315,0X9316,0X9317,0X9318,0X9319,
-0X931A,0X931B,0X931C,0X931D,0X931E,0X931F,0X9320,0X9321,0X9322,0X9323,0X9324,0X9325,0X9326,0X9327,0X9328,0X9329,
-0X932A,0X932B,0X932C,0X932D,0X932E,0X932F,0X9330,0X9331,0X9332,0X9333,0X9334,0X9335,0X9336,0X9337,0X9338,0X9339,
-0X933A,0X933B,0X933C,0X933D,0X933F,0X9340,0X9341,0X9342,0X9343,0X9344,0X9345,0X9346,0X9347,0X9348,0X9349,0X0001,
-0X934A,0X934B,0X934C,0X934D,0X934E,0X934F,0X9350,0X9351,0X9352,0X9353,0X9354,0X9355,0X9356,0X9357,0X9358,0X9359,
-0X935A,0X935B,0X935C,0X935D,0X935E,0X935F,0X9360,0X9361,0X9362,0X9363,0X9364,0X9365,0X9366,0X9367,0X9368,0X9369,
-0X936B,0X6FC9,0X6FA7,0X6FB9,0X6FB6,0X6FC2,0X6FE1,0X6FEE,0X6FDE,0X6FE0,0X6FEF,0X701A,0X7023,0X701B,0X7039,0X7035,
-0X704F,0X705E,0X5B80,0X5B84,0X5B95,0X5B93,0X5BA5,0X5BB8,0X752F,0X9A9E,0X6434,0X5BE4,0X5BEE,0X8930,0X5BF0,0X8E47,
-0X8B07,0X8FB6,0X8FD3,0X8FD5,0X8FE5,0X8FEE,0X8FE4,0X8FE9,0X8FE6,0X8FF3,0X8FE8,0X9005,0X9004,0X900B,0X9026,0X9011,
-0X900D,0X9016,0X9021,0X9035,0X9036,0X902D,0X902F,0X9044,0X9051,0X9052,0X9050,0X9068,0X9058,0X9062,0X905B,0X66B9,
-0X9074,0X907D,0X9082,0X9088,0X9083,0X908B,0X5F50,0X5F57,0X5F56,0X5F58,0X5C3B,0X54AB,0X5C50,0X5C59,0X5B71,0X5C63,
-0X5C66,0X7FBC,0X5F2A,0X5F29,0X5F2D,0X8274,0X5F3C,0X9B3B,0X5C6E,0X5981,0X5983,0X598D,0X59A9,0X59AA,0X59A3,0X0001,
-0X936C,0X936D,0X936E,0X936F,0X9370,0X9371,0X9372,0X9373,0X9374,0X9375,0X9376,0X9377,0X9378,0X9379,0X937A,0X937B,
-0X937C,0X937D,0X937E,0X937F,0X9380,0X9381,0X9382,0X9383,0X9384,0X9385,0X9386,0X9387,0X9388,0X9389,0X938A,0X938B,
-0X938C,0X938D,0X938E,0X9390,0X9391,0X9392,0X9393,0X9394,0X9395,0X9396,0X9397,0X9398,0X9399,0X939A,0X939B,0X939C,
-0X939D,0X939E,0X939F,0X93A0,0X93A1,0X93A2,0X93A3,0X93A4,0X93A5,0X93A6,0X93A7,0X93A8,0X93A9,0X93AA,0X93AB,0X0001,
-0X93AC,0X93AD,0X93AE,0X93AF,0X93B0,0X93B1,0X93B2,0X93B3,0X93B4,0X93B5,0X93B6,0X93B7,0X93B8,0X93B9,0X93BA,0X93BB,
-0X93BC,0X93BD,0X93BE,0X93BF,0X93C0,0X93C1,0X93C2,0X93C3,0X93C4,0X93C5,0X93C6,0X93C7,0X93C8,0X93C9,0X93CB,0X93CC,
-0X93CD,0X5997,0X59CA,0X59AB,0X599E,0X59A4,0X59D2,0X59B2,0X59AF,0X59D7,0X59BE,0X5A05,0X5A06,0X59DD,0X5A08,0X59E3,
-0X59D8,0X59F9,0X5A0C,0X5A09,0X5A32,0X5A34,0X5A11,0X5A23,0X5A13,0X5A40,0X5A67,0X5A4A,0X5A55,0X5A3C,0X5A62,0X5A75,
-0X80EC,0X5AAA,0X5A9B,0X5A77,0X5A7A,0X5ABE,0X5AEB,0X5AB2,0X5AD2,0X5AD4,0X5AB8,0X5AE0,0X5AE3,0X5AF1,0X5AD6,0X5AE6,
-0X5AD8,0X5ADC,0X5B09,0X5B17,0X5B16,0X5B32,0X5B37,0X5B40,0X5C15,0X5C1C,0X5B5A,0X5B65,0X5B73,0X5B51,0X5B53,0X5B62,
-0X9A75,0X9A77,0X9A78,0X9A7A,0X9A7F,0X9A7D,0X9A80,0X9A81,0X9A85,0X9A88,0X9A8A,0X9A90,0X9A92,0X9A93,0X9A96,0X9A98,
-0X9A9B,0X9A9C,0X9A9D,0X9A9F,0X9AA0,0X9AA2,0X9AA3,0X9AA5,0X9AA7,0X7E9F,0X7EA1,0X7EA3,0X7EA5,0X7EA8,0X7EA9,0X0001,
-0X93CE,0X93CF,0X93D0,0X93D1,0X93D2,0X93D3,0X93D4,0X93D5,0X93D7,0X93D8,0X93D9,0X93DA,0X93DB,0X93DC,0X93DD,0X93DE,
-0X93DF,0X93E0,0X93E1,0X93E2,0X93E3,0X93E4,0X93E5,0X93E6,0X93E7,0X93E8,0X93E9,0X93EA,0X93EB,0X93EC,0X93ED,0X93EE,
-0X93EF,0X93F0,0X93F1,0X93F2,0X93F3,0X93F4,0X93F5,0X93F6,0X93F7,0X93F8,0X93F9,0X93FA,0X93FB,0X93FC,0X93FD,0X93FE,
-0X93FF,0X9400,0X9401,0X9402,0X9403,0X9404,0X9405,0X9406,0X9407,0X9408,0X9409,0X940A,0X940B,0X940C,0X940D,0X0001,
-0X940E,0X940F,0X9410,0X9411,0X9412,0X9413,0X9414,0X9415,0X9416,0X9417,0X9418,0X9419,0X941A,0X941B,0X941C,0X941D,
-0X941E,0X941F,0X9420,0X9421,0X9422,0X9423,0X9424,0X9425,0X9426,0X9427,0X9428,0X9429,0X942A,0X942B,0X942C,0X942D,
-0X942E,0X7EAD,0X7EB0,0X7EBE,0X7EC0,0X7EC1,0X7EC2,0X7EC9,0X7ECB,0X7ECC,0X7ED0,0X7ED4,0X7ED7,0X7EDB,0X7EE0,0X7EE1,
-0X7EE8,0X7EEB,0X7EEE,0X7EEF,0X7EF1,0X7EF2,0X7F0D,0X7EF6,0X7EFA,0X7EFB,0X7EFE,0X7F01,0X7F02,0X7F03,0X7F07,0X7F08,
-0X7F0B,0X7F0C,0X7F0F,0X7F11,0X7F12,0X7F17,0X7F19,0X7F1C,0X7F1B,0X7F1F,0X7F21,0X7F22,0X7F23,0X7F24,0X7F25,0X7F26,
-0X7F27,0X7F2A,0X7F2B,0X7F2C,0X7F2D,0X7F2F,0X7F30,0X7F31,0X7F32,0X7F33,0X7F35,0X5E7A,0X757F,0X5DDB,0X753E,0X9095,
-0X738E,0X7391,0X73AE,0X73A2,0X739F,0X73CF,0X73C2,0X73D1,0X73B7,0X73B3,0X73C0,0X73C9,0X73C8,0X73E5,0X73D9,0X987C,
-0X740A,0X73E9,0X73E7,0X73DE,0X73BA,0X73F2,0X740F,0X742A,0X745B,0X7426,0X7425,0X7428,0X7430,0X742E,0X742C,0X0001,
-0X942F,0X9430,0X9431,0X9432,0X9433,0X9434,0X9435,0X9436,0X9437,0X9438,0X9439,0X943A,0X943B,0X943C,0X943D,0X943F,
-0X9440,0X9441,0X9442,0X9443,0X9444,0X9445,0X9446,0X9447,0X9448,0X9449,0X944A,0X944B,0X944C,0X944D,0X944E,0X944F,
-0X9450,0X9451,0X9452,0X9453,0X9454,0X9455,0X9456,0X9457,0X9458,0X9459,0X945A,0X945B,0X945C,0X945D,0X945E,0X945F,
-0X9460,0X9461,0X9462,0X9463,0X9464,0X9465,0X9466,0X9467,0X9468,0X9469,0X946A,0X946C,0X946D,0X946E,0X946F,0X0001,
-0X9470,0X9471,0X9472,0X9473,0X9474,0X9475,0X9476,0X9477,0X9478,0X9479,0X947A,0X947B,0X947C,0X947D,0X947E,0X947F,
-0X9480,0X9481,0X9482,0X9483,0X9484,0X9491,0X9496,0X9498,0X94C7,0X94CF,0X94D3,0X94D4,0X94DA,0X94E6,0X94FB,0X951C,
-0X9520,0X741B,0X741A,0X7441,0X745C,0X7457,0X7455,0X7459,0X7477,0X746D,0X747E,0X749C,0X748E,0X7480,0X7481,0X7487,
-0X748B,0X749E,0X74A8,0X74A9,0X7490,0X74A7,0X74D2,0X74BA,0X97EA,0X97EB,0X97EC,0X674C,0X6753,0X675E,0X6748,0X6769,
-0X67A5,0X6787,0X676A,0X6773,0X6798,0X67A7,0X6775,0X67A8,0X679E,0X67AD,0X678B,0X6777,0X677C,0X67F0,0X6809,0X67D8,
-0X680A,0X67E9,0X67B0,0X680C,0X67D9,0X67B5,0X67DA,0X67B3,0X67DD,0X6800,0X67C3,0X67B8,0X67E2,0X680E,0X67C1,0X67FD,
-0X6832,0X6833,0X6860,0X6861,0X684E,0X6862,0X6844,0X6864,0X6883,0X681D,0X6855,0X6866,0X6841,0X6867,0X6840,0X683E,
-0X684A,0X6849,0X6829,0X68B5,0X688F,0X6874,0X6877,0X6893,0X686B,0X68C2,0X696E,0X68FC,0X691F,0X6920,0X68F9,0X0001,
-0X9527,0X9533,0X953D,0X9543,0X9548,0X954B,0X9555,0X955A,0X9560,0X956E,0X9574,0X9575,0X9577,0X9578,0X9579,0X957A,
-0X957B,0X957C,0X957D,0X957E,0X9580,0X9581,0X9582,0X9583,0X9584,0X9585,0X9586,0X9587,0X9588,0X9589,0X958A,0X958B,
-0X958C,0X958D,0X958E,0X958F,0X9590,0X9591,0X9592,0X9593,0X9594,0X9595,0X9596,0X9597,0X9598,0X9599,0X959A,0X959B,
-0X959C,0X959D,0X959E,0X959F,0X95A0,0X95A1,0X95A2,0X95A3,0X95A4,0X95A5,0X95A6,0X95A7,0X95A8,0X95A9,0X95AA,0X0001,
-0X95AB,0X95AC,0X95AD,0X95AE,0X95AF,0X95B0,0X95B1,0X95B2,0X95B3,0X95B4,0X95B5,0X95B6,0X95B7,0X95B8,0X95B9,0X95BA,
-0X95BB,0X95BC,0X95BD,0X95BE,0X95BF,0X95C0,0X95C1,0X95C2,0X95C3,0X95C4,0X95C5,0X95C6,0X95C7,0X95C8,0X95C9,0X95CA,
-0X95CB,0X6924,0X68F0,0X690B,0X6901,0X6957,0X68E3,0X6910,0X6971,0X6939,0X6960,0X6942,0X695D,0X6984,0X696B,0X6980,
-0X6998,0X6978,0X6934,0X69CC,0X6987,0X6988,0X69CE,0X6989,0X6966,0X6963,0X6979,0X699B,0X69A7,0X69BB,0X69AB,0X69AD,
-0X69D4,0X69B1,0X69C1,0X69CA,0X69DF,0X6995,0X69E0,0X698D,0X69FF,0X6A2F,0X69ED,0X6A17,0X6A18,0X6A65,0X69F2,0X6A44,
-0X6A3E,0X6AA0,0X6A50,0X6A5B,0X6A35,0X6A8E,0X6A79,0X6A3D,0X6A28,0X6A58,0X6A7C,0X6A91,0X6A90,0X6AA9,0X6A97,0X6AAB,
-0X7337,0X7352,0X6B81,0X6B82,0X6B87,0X6B84,0X6B92,0X6B93,0X6B8D,0X6B9A,0X6B9B,0X6BA1,0X6BAA,0X8F6B,0X8F6D,0X8F71,
-0X8F72,0X8F73,0X8F75,0X8F76,0X8F78,0X8F77,0X8F79,0X8F7A,0X8F7C,0X8F7E,0X8F81,0X8F82,0X8F84,0X8F87,0X8F8B,0X0001,
-0X95CC,0X95CD,0X95CE,0X95CF,0X95D0,0X95D1,0X95D2,0X95D3,0X95D4,0X95D5,0X95D6,0X95D7,0X95D8,0X95D9,0X95DA,0X95DB,
-0X95DC,0X95DD,0X95DE,0X95DF,0X95E0,0X95E1,0X95E2,0X95E3,0X95E4,0X95E5,0X95E6,0X95E7,0X95EC,0X95FF,0X9607,0X9613,
-0X9618,0X961B,0X961E,0X9620,0X9623,0X9624,0X9625,0X9626,0X9627,0X9628,0X9629,0X962B,0X962C,0X962D,0X962F,0X9630,
-0X9637,0X9638,0X9639,0X963A,0X963E,0X9641,0X9643,0X964A,0X964E,0X964F,0X9651,0X9652,0X9653,0X9656,0X9657,0X0001,
-0X9658,0X9659,0X965A,0X965C,0X965D,0X965E,0X9660,0X9663,0X9665,0X9666,0X966B,0X966D,0X966E,0X966F,0X9670,0X9671,
-0X9673,0X9678,0X9679,0X967A,0X967B,0X967C,0X967D,0X967E,0X967F,0X9680,0X9681,0X9682,0X9683,0X9684,0X9687,0X9689,
-0X968A,0X8F8D,0X8F8E,0X8F8F,0X8F98,0X8F9A,0X8ECE,0X620B,0X6217,0X621B,0X621F,0X6222,0X6221,0X6225,0X6224,0X622C,
-0X81E7,0X74EF,0X74F4,0X74FF,0X750F,0X7511,0X7513,0X6534,0X65EE,0X65EF,0X65F0,0X660A,0X6619,0X6772,0X6603,0X6615,
-0X6600,0X7085,0X66F7,0X661D,0X6634,0X6631,0X6636,0X6635,0X8006,0X665F,0X6654,0X6641,0X664F,0X6656,0X6661,0X6657,
-0X6677,0X6684,0X668C,0X66A7,0X669D,0X66BE,0X66DB,0X66DC,0X66E6,0X66E9,0X8D32,0X8D33,0X8D36,0X8D3B,0X8D3D,0X8D40,
-0X8D45,0X8D46,0X8D48,0X8D49,0X8D47,0X8D4D,0X8D55,0X8D59,0X89C7,0X89CA,0X89CB,0X89CC,0X89CE,0X89CF,0X89D0,0X89D1,
-0X726E,0X729F,0X725D,0X7266,0X726F,0X727E,0X727F,0X7284,0X728B,0X728D,0X728F,0X7292,0X6308,0X6332,0X63B0,0X0001,
-0X968C,0X968E,0X9691,0X9692,0X9693,0X9695,0X9696,0X969A,0X969B,0X969D,0X969E,0X969F,0X96A0,0X96A1,0X96A2,0X96A3,
-0X96A4,0X96A5,0X96A6,0X96A8,0X96A9,0X96AA,0X96AB,0X96AC,0X96AD,0X96AE,0X96AF,0X96B1,0X96B2,0X96B4,0X96B5,0X96B7,
-0X96B8,0X96BA,0X96BB,0X96BF,0X96C2,0X96C3,0X96C8,0X96CA,0X96CB,0X96D0,0X96D1,0X96D3,0X96D4,0X96D6,0X96D7,0X96D8,
-0X96D9,0X96DA,0X96DB,0X96DC,0X96DD,0X96DE,0X96DF,0X96E1,0X96E2,0X96E3,0X96E4,0X96E5,0X96E6,0X96E7,0X96EB,0X0001,
-0X96EC,0X96ED,0X96EE,0X96F0,0X96F1,0X96F2,0X96F4,0X96F5,0X96F8,0X96FA,0X96FB,0X96FC,0X96FD,0X96FF,0X9702,0X9703,
-0X9705,0X970A,0X970B,0X970C,0X9710,0X9711,0X9712,0X9714,0X9715,0X9717,0X9718,0X9719,0X971A,0X971B,0X971D,0X971F,
-0X9720,0X643F,0X64D8,0X8004,0X6BEA,0X6BF3,0X6BFD,0X6BF5,0X6BF9,0X6C05,0X6C07,0X6C06,0X6C0D,0X6C15,0X6C18,0X6C19,
-0X6C1A,0X6C21,0X6C29,0X6C24,0X6C2A,0X6C32,0X6535,0X6555,0X656B,0X724D,0X7252,0X7256,0X7230,0X8662,0X5216,0X809F,
-0X809C,0X8093,0X80BC,0X670A,0X80BD,0X80B1,0X80AB,0X80AD,0X80B4,0X80B7,0X80E7,0X80E8,0X80E9,0X80EA,0X80DB,0X80C2,
-0X80C4,0X80D9,0X80CD,0X80D7,0X6710,0X80DD,0X80EB,0X80F1,0X80F4,0X80ED,0X810D,0X810E,0X80F2,0X80FC,0X6715,0X8112,
-0X8C5A,0X8136,0X811E,0X812C,0X8118,0X8132,0X8148,0X814C,0X8153,0X8174,0X8159,0X815A,0X8171,0X8160,0X8169,0X817C,
-0X817D,0X816D,0X8167,0X584D,0X5AB5,0X8188,0X8182,0X8191,0X6ED5,0X81A3,0X81AA,0X81CC,0X6726,0X81CA,0X81BB,0X0001,
-0X9721,0X9722,0X9723,0X9724,0X9725,0X9726,0X9727,0X9728,0X9729,0X972B,0X972C,0X972E,0X972F,0X9731,0X9733,0X9734,
-0X9735,0X9736,0X9737,0X973A,0X973B,0X973C,0X973D,0X973F,0X9740,0X9741,0X9742,0X9743,0X9744,0X9745,0X9746,0X9747,
-0X9748,0X9749,0X974A,0X974B,0X974C,0X974D,0X974E,0X974F,0X9750,0X9751,0X9754,0X9755,0X9757,0X9758,0X975A,0X975C,
-0X975D,0X975F,0X9763,0X9764,0X9766,0X9767,0X9768,0X976A,0X976B,0X976C,0X976D,0X976E,0X976F,0X9770,0X9771,0X0001,
-0X9772,0X9775,0X9777,0X9778,0X9779,0X977A,0X977B,0X977D,0X977E,0X977F,0X9780,0X9781,0X9782,0X9783,0X9784,0X9786,
-0X9787,0X9788,0X9789,0X978A,0X978C,0X978E,0X978F,0X9790,0X9793,0X9795,0X9796,0X9797,0X9799,0X979A,0X979B,0X979C,
-0X979D,0X81C1,0X81A6,0X6B24,0X6B37,0X6B39,0X6B43,0X6B46,0X6B59,0X98D1,0X98D2,0X98D3,0X98D5,0X98D9,0X98DA,0X6BB3,
-0X5F40,0X6BC2,0X89F3,0X6590,0X9F51,0X6593,0X65BC,0X65C6,0X65C4,0X65C3,0X65CC,0X65CE,0X65D2,0X65D6,0X7080,0X709C,
-0X7096,0X709D,0X70BB,0X70C0,0X70B7,0X70AB,0X70B1,0X70E8,0X70CA,0X7110,0X7113,0X7116,0X712F,0X7131,0X7173,0X715C,
-0X7168,0X7145,0X7172,0X714A,0X7178,0X717A,0X7198,0X71B3,0X71B5,0X71A8,0X71A0,0X71E0,0X71D4,0X71E7,0X71F9,0X721D,
-0X7228,0X706C,0X7118,0X7166,0X71B9,0X623E,0X623D,0X6243,0X6248,0X6249,0X793B,0X7940,0X7946,0X7949,0X795B,0X795C,
-0X7953,0X795A,0X7962,0X7957,0X7960,0X796F,0X7967,0X797A,0X7985,0X798A,0X799A,0X79A7,0X79B3,0X5FD1,0X5FD0,0X0001,
-0X979E,0X979F,0X97A1,0X97A2,0X97A4,0X97A5,0X97A6,0X97A7,0X97A8,0X97A9,0X97AA,0X97AC,0X97AE,0X97B0,0X97B1,0X97B3,
-0X97B5,0X97B6,0X97B7,0X97B8,0X97B9,0X97BA,0X97BB,0X97BC,0X97BD,0X97BE,0X97BF,0X97C0,0X97C1,0X97C2,0X97C3,0X97C4,
-0X97C5,0X97C6,0X97C7,0X97C8,0X97C9,0X97CA,0X97CB,0X97CC,0X97CD,0X97CE,0X97CF,0X97D0,0X97D1,0X97D2,0X97D3,0X97D4,
-0X97D5,0X97D6,0X97D7,0X97D8,0X97D9,0X97DA,0X97DB,0X97DC,0X97DD,0X97DE,0X97DF,0X97E0,0X97E1,0X97E2,0X97E3,0X0001,
-0X97E4,0X97E5,0X97E8,0X97EE,0X97EF,0X97F0,0X97F1,0X97F2,0X97F4,0X97F7,0X97F8,0X97F9,0X97FA,0X97FB,0X97FC,0X97FD,
-0X97FE,0X97FF,0X9800,0X9801,0X9802,0X9803,0X9804,0X9805,0X9806,0X9807,0X9808,0X9809,0X980A,0X980B,0X980C,0X980D,
-0X980E,0X603C,0X605D,0X605A,0X6067,0X6041,0X6059,0X6063,0X60AB,0X6106,0X610D,0X615D,0X61A9,0X619D,0X61CB,0X61D1,
-0X6206,0X8080,0X807F,0X6C93,0X6CF6,0X6DFC,0X77F6,0X77F8,0X7800,0X7809,0X7817,0X7818,0X7811,0X65AB,0X782D,0X781C,
-0X781D,0X7839,0X783A,0X783B,0X781F,0X783C,0X7825,0X782C,0X7823,0X7829,0X784E,0X786D,0X7856,0X7857,0X7826,0X7850,
-0X7847,0X784C,0X786A,0X789B,0X7893,0X789A,0X7887,0X789C,0X78A1,0X78A3,0X78B2,0X78B9,0X78A5,0X78D4,0X78D9,0X78C9,
-0X78EC,0X78F2,0X7905,0X78F4,0X7913,0X7924,0X791E,0X7934,0X9F9B,0X9EF9,0X9EFB,0X9EFC,0X76F1,0X7704,0X770D,0X76F9,
-0X7707,0X7708,0X771A,0X7722,0X7719,0X772D,0X7726,0X7735,0X7738,0X7750,0X7751,0X7747,0X7743,0X775A,0X7768,0X0001,
-0X980F,0X9810,0X9811,0X9812,0X9813,0X9814,0X9815,0X9816,0X9817,0X9818,0X9819,0X981A,0X981B,0X981C,0X981D,0X981E,
-0X981F,0X9820,0X9821,0X9822,0X9823,0X9824,0X9825,0X9826,0X9827,0X9828,0X9829,0X982A,0X982B,0X982C,0X982D,0X982E,
-0X982F,0X9830,0X9831,0X9832,0X9833,0X9834,0X9835,0X9836,0X9837,0X9838,0X9839,0X983A,0X983B,0X983C,0X983D,0X983E,
-0X983F,0X9840,0X9841,0X9842,0X9843,0X9844,0X9845,0X9846,0X9847,0X9848,0X9849,0X984A,0X984B,0X984C,0X984D,0X0001,
-0X984E,0X984F,0X9850,0X9851,0X9852,0X9853,0X9854,0X9855,0X9856,0X9857,0X9858,0X9859,0X985A,0X985B,0X985C,0X985D,
-0X985E,0X985F,0X9860,0X9861,0X9862,0X9863,0X9864,0X9865,0X9866,0X9867,0X9868,0X9869,0X986A,0X986B,0X986C,0X986D,
-0X986E,0X7762,0X7765,0X777F,0X778D,0X777D,0X7780,0X778C,0X7791,0X779F,0X77A0,0X77B0,0X77B5,0X77BD,0X753A,0X7540,
-0X754E,0X754B,0X7548,0X755B,0X7572,0X7579,0X7583,0X7F58,0X7F61,0X7F5F,0X8A48,0X7F68,0X7F74,0X7F71,0X7F79,0X7F81,
-0X7F7E,0X76CD,0X76E5,0X8832,0X9485,0X9486,0X9487,0X948B,0X948A,0X948C,0X948D,0X948F,0X9490,0X9494,0X9497,0X9495,
-0X949A,0X949B,0X949C,0X94A3,0X94A4,0X94AB,0X94AA,0X94AD,0X94AC,0X94AF,0X94B0,0X94B2,0X94B4,0X94B6,0X94B7,0X94B8,
-0X94B9,0X94BA,0X94BC,0X94BD,0X94BF,0X94C4,0X94C8,0X94C9,0X94CA,0X94CB,0X94CC,0X94CD,0X94CE,0X94D0,0X94D1,0X94D2,
-0X94D5,0X94D6,0X94D7,0X94D9,0X94D8,0X94DB,0X94DE,0X94DF,0X94E0,0X94E2,0X94E4,0X94E5,0X94E7,0X94E8,0X94EA,0X0001,
-0X986F,0X9870,0X9871,0X9872,0X9873,0X9874,0X988B,0X988E,0X9892,0X9895,0X9899,0X98A3,0X98A8,0X98A9,0X98AA,0X98AB,
-0X98AC,0X98AD,0X98AE,0X98AF,0X98B0,0X98B1,0X98B2,0X98B3,0X98B4,0X98B5,0X98B6,0X98B7,0X98B8,0X98B9,0X98BA,0X98BB,
-0X98BC,0X98BD,0X98BE,0X98BF,0X98C0,0X98C1,0X98C2,0X98C3,0X98C4,0X98C5,0X98C6,0X98C7,0X98C8,0X98C9,0X98CA,0X98CB,
-0X98CC,0X98CD,0X98CF,0X98D0,0X98D4,0X98D6,0X98D7,0X98DB,0X98DC,0X98DD,0X98E0,0X98E1,0X98E2,0X98E3,0X98E4,0X0001,
-0X98E5,0X98E6,0X98E9,0X98EA,0X98EB,0X98EC,0X98ED,0X98EE,0X98EF,0X98F0,0X98F1,0X98F2,0X98F3,0X98F4,0X98F5,0X98F6,
-0X98F7,0X98F8,0X98F9,0X98FA,0X98FB,0X98FC,0X98FD,0X98FE,0X98FF,0X9900,0X9901,0X9902,0X9903,0X9904,0X9905,0X9906,
-0X9907,0X94E9,0X94EB,0X94EE,0X94EF,0X94F3,0X94F4,0X94F5,0X94F7,0X94F9,0X94FC,0X94FD,0X94FF,0X9503,0X9502,0X9506,
-0X9507,0X9509,0X950A,0X950D,0X950E,0X950F,0X9512,0X9513,0X9514,0X9515,0X9516,0X9518,0X951B,0X951D,0X951E,0X951F,
-0X9522,0X952A,0X952B,0X9529,0X952C,0X9531,0X9532,0X9534,0X9536,0X9537,0X9538,0X953C,0X953E,0X953F,0X9542,0X9535,
-0X9544,0X9545,0X9546,0X9549,0X954C,0X954E,0X954F,0X9552,0X9553,0X9554,0X9556,0X9557,0X9558,0X9559,0X955B,0X955E,
-0X955F,0X955D,0X9561,0X9562,0X9564,0X9565,0X9566,0X9567,0X9568,0X9569,0X956A,0X956B,0X956C,0X956F,0X9571,0X9572,
-0X9573,0X953A,0X77E7,0X77EC,0X96C9,0X79D5,0X79ED,0X79E3,0X79EB,0X7A06,0X5D47,0X7A03,0X7A02,0X7A1E,0X7A14,0X0001,
-0X9908,0X9909,0X990A,0X990B,0X990C,0X990E,0X990F,0X9911,0X9912,0X9913,0X9914,0X9915,0X9916,0X9917,0X9918,0X9919,
-0X991A,0X991B,0X991C,0X991D,0X991E,0X991F,0X9920,0X9921,0X9922,0X9923,0X9924,0X9925,0X9926,0X9927,0X9928,0X9929,
-0X992A,0X992B,0X992C,0X992D,0X992F,0X9930,0X9931,0X9932,0X9933,0X9934,0X9935,0X9936,0X9937,0X9938,0X9939,0X993A,
-0X993B,0X993C,0X993D,0X993E,0X993F,0X9940,0X9941,0X9942,0X9943,0X9944,0X9945,0X9946,0X9947,0X9948,0X9949,0X0001,
-0X994A,0X994B,0X994C,0X994D,0X994E,0X994F,0X9950,0X9951,0X9952,0X9953,0X9956,0X9957,0X9958,0X9959,0X995A,0X995B,
-0X995C,0X995D,0X995E,0X995F,0X9960,0X9961,0X9962,0X9964,0X9966,0X9973,0X9978,0X9979,0X997B,0X997E,0X9982,0X9983,
-0X9989,0X7A39,0X7A37,0X7A51,0X9ECF,0X99A5,0X7A70,0X7688,0X768E,0X7693,0X7699,0X76A4,0X74DE,0X74E0,0X752C,0X9E20,
-0X9E22,0X9E28,0X9E29,0X9E2A,0X9E2B,0X9E2C,0X9E32,0X9E31,0X9E36,0X9E38,0X9E37,0X9E39,0X9E3A,0X9E3E,0X9E41,0X9E42,
-0X9E44,0X9E46,0X9E47,0X9E48,0X9E49,0X9E4B,0X9E4C,0X9E4E,0X9E51,0X9E55,0X9E57,0X9E5A,0X9E5B,0X9E5C,0X9E5E,0X9E63,
-0X9E66,0X9E67,0X9E68,0X9E69,0X9E6A,0X9E6B,0X9E6C,0X9E71,0X9E6D,0X9E73,0X7592,0X7594,0X7596,0X75A0,0X759D,0X75AC,
-0X75A3,0X75B3,0X75B4,0X75B8,0X75C4,0X75B1,0X75B0,0X75C3,0X75C2,0X75D6,0X75CD,0X75E3,0X75E8,0X75E6,0X75E4,0X75EB,
-0X75E7,0X7603,0X75F1,0X75FC,0X75FF,0X7610,0X7600,0X7605,0X760C,0X7617,0X760A,0X7625,0X7618,0X7615,0X7619,0X0001,
-0X998C,0X998E,0X999A,0X999B,0X999C,0X999D,0X999E,0X999F,0X99A0,0X99A1,0X99A2,0X99A3,0X99A4,0X99A6,0X99A7,0X99A9,
-0X99AA,0X99AB,0X99AC,0X99AD,0X99AE,0X99AF,0X99B0,0X99B1,0X99B2,0X99B3,0X99B4,0X99B5,0X99B6,0X99B7,0X99B8,0X99B9,
-0X99BA,0X99BB,0X99BC,0X99BD,0X99BE,0X99BF,0X99C0,0X99C1,0X99C2,0X99C3,0X99C4,0X99C5,0X99C6,0X99C7,0X99C8,0X99C9,
-0X99CA,0X99CB,0X99CC,0X99CD,0X99CE,0X99CF,0X99D0,0X99D1,0X99D2,0X99D3,0X99D4,0X99D5,0X99D6,0X99D7,0X99D8,0X0001,
-0X99D9,0X99DA,0X99DB,0X99DC,0X99DD,0X99DE,0X99DF,0X99E0,0X99E1,0X99E2,0X99E3,0X99E4,0X99E5,0X99E6,0X99E7,0X99E8,
-0X99E9,0X99EA,0X99EB,0X99EC,0X99ED,0X99EE,0X99EF,0X99F0,0X99F1,0X99F2,0X99F3,0X99F4,0X99F5,0X99F6,0X99F7,0X99F8,
-0X99F9,0X761B,0X763C,0X7622,0X7620,0X7640,0X762D,0X7630,0X763F,0X7635,0X7643,0X763E,0X7633,0X764D,0X765E,0X7654,
-0X765C,0X7656,0X766B,0X766F,0X7FCA,0X7AE6,0X7A78,0X7A79,0X7A80,0X7A86,0X7A88,0X7A95,0X7AA6,0X7AA0,0X7AAC,0X7AA8,
-0X7AAD,0X7AB3,0X8864,0X8869,0X8872,0X887D,0X887F,0X8882,0X88A2,0X88C6,0X88B7,0X88BC,0X88C9,0X88E2,0X88CE,0X88E3,
-0X88E5,0X88F1,0X891A,0X88FC,0X88E8,0X88FE,0X88F0,0X8921,0X8919,0X8913,0X891B,0X890A,0X8934,0X892B,0X8936,0X8941,
-0X8966,0X897B,0X758B,0X80E5,0X76B2,0X76B4,0X77DC,0X8012,0X8014,0X8016,0X801C,0X8020,0X8022,0X8025,0X8026,0X8027,
-0X8029,0X8028,0X8031,0X800B,0X8035,0X8043,0X8046,0X804D,0X8052,0X8069,0X8071,0X8983,0X9878,0X9880,0X9883,0X0001,
-0X99FA,0X99FB,0X99FC,0X99FD,0X99FE,0X99FF,0X9A00,0X9A01,0X9A02,0X9A03,0X9A04,0X9A05,0X9A06,0X9A07,0X9A08,0X9A09,
-0X9A0A,0X9A0B,0X9A0C,0X9A0D,0X9A0E,0X9A0F,0X9A10,0X9A11,0X9A12,0X9A13,0X9A14,0X9A15,0X9A16,0X9A17,0X9A18,0X9A19,
-0X9A1A,0X9A1B,0X9A1C,0X9A1D,0X9A1E,0X9A1F,0X9A20,0X9A21,0X9A22,0X9A23,0X9A24,0X9A25,0X9A26,0X9A27,0X9A28,0X9A29,
-0X9A2A,0X9A2B,0X9A2C,0X9A2D,0X9A2E,0X9A2F,0X9A30,0X9A31,0X9A32,0X9A33,0X9A34,0X9A35,0X9A36,0X9A37,0X9A38,0X0001,
-0X9A39,0X9A3A,0X9A3B,0X9A3C,0X9A3D,0X9A3E,0X9A3F,0X9A40,0X9A41,0X9A42,0X9A43,0X9A44,0X9A45,0X9A46,0X9A47,0X9A48,
-0X9A49,0X9A4A,0X9A4B,0X9A4C,0X9A4D,0X9A4E,0X9A4F,0X9A50,0X9A51,0X9A52,0X9A53,0X9A54,0X9A55,0X9A56,0X9A57,0X9A58,
-0X9A59,0X9889,0X988C,0X988D,0X988F,0X9894,0X989A,0X989B,0X989E,0X989F,0X98A1,0X98A2,0X98A5,0X98A6,0X864D,0X8654,
-0X866C,0X866E,0X867F,0X867A,0X867C,0X867B,0X86A8,0X868D,0X868B,0X86AC,0X869D,0X86A7,0X86A3,0X86AA,0X8693,0X86A9,
-0X86B6,0X86C4,0X86B5,0X86CE,0X86B0,0X86BA,0X86B1,0X86AF,0X86C9,0X86CF,0X86B4,0X86E9,0X86F1,0X86F2,0X86ED,0X86F3,
-0X86D0,0X8713,0X86DE,0X86F4,0X86DF,0X86D8,0X86D1,0X8703,0X8707,0X86F8,0X8708,0X870A,0X870D,0X8709,0X8723,0X873B,
-0X871E,0X8725,0X872E,0X871A,0X873E,0X8748,0X8734,0X8731,0X8729,0X8737,0X873F,0X8782,0X8722,0X877D,0X877E,0X877B,
-0X8760,0X8770,0X874C,0X876E,0X878B,0X8753,0X8763,0X877C,0X8764,0X8759,0X8765,0X8793,0X87AF,0X87A8,0X87D2,0X0001,
-0X9A5A,0X9A5B,0X9A5C,0X9A5D,0X9A5E,0X9A5F,0X9A60,0X9A61,0X9A62,0X9A63,0X9A64,0X9A65,0X9A66,0X9A67,0X9A68,0X9A69,
-0X9A6A,0X9A6B,0X9A72,0X9A83,0X9A89,0X9A8D,0X9A8E,0X9A94,0X9A95,0X9A99,0X9AA6,0X9AA9,0X9AAA,0X9AAB,0X9AAC,0X9AAD,
-0X9AAE,0X9AAF,0X9AB2,0X9AB3,0X9AB4,0X9AB5,0X9AB9,0X9ABB,0X9ABD,0X9ABE,0X9ABF,0X9AC3,0X9AC4,0X9AC6,0X9AC7,0X9AC8,
-0X9AC9,0X9ACA,0X9ACD,0X9ACE,0X9ACF,0X9AD0,0X9AD2,0X9AD4,0X9AD5,0X9AD6,0X9AD7,0X9AD9,0X9ADA,0X9ADB,0X9ADC,0X0001,
-0X9ADD,0X9ADE,0X9AE0,0X9AE2,0X9AE3,0X9AE4,0X9AE5,0X9AE7,0X9AE8,0X9AE9,0X9AEA,0X9AEC,0X9AEE,0X9AF0,0X9AF1,0X9AF2,
-0X9AF3,0X9AF4,0X9AF5,0X9AF6,0X9AF7,0X9AF8,0X9AFA,0X9AFC,0X9AFD,0X9AFE,0X9AFF,0X9B00,0X9B01,0X9B02,0X9B04,0X9B05,
-0X9B06,0X87C6,0X8788,0X8785,0X87AD,0X8797,0X8783,0X87AB,0X87E5,0X87AC,0X87B5,0X87B3,0X87CB,0X87D3,0X87BD,0X87D1,
-0X87C0,0X87CA,0X87DB,0X87EA,0X87E0,0X87EE,0X8816,0X8813,0X87FE,0X880A,0X881B,0X8821,0X8839,0X883C,0X7F36,0X7F42,
-0X7F44,0X7F45,0X8210,0X7AFA,0X7AFD,0X7B08,0X7B03,0X7B04,0X7B15,0X7B0A,0X7B2B,0X7B0F,0X7B47,0X7B38,0X7B2A,0X7B19,
-0X7B2E,0X7B31,0X7B20,0X7B25,0X7B24,0X7B33,0X7B3E,0X7B1E,0X7B58,0X7B5A,0X7B45,0X7B75,0X7B4C,0X7B5D,0X7B60,0X7B6E,
-0X7B7B,0X7B62,0X7B72,0X7B71,0X7B90,0X7BA6,0X7BA7,0X7BB8,0X7BAC,0X7B9D,0X7BA8,0X7B85,0X7BAA,0X7B9C,0X7BA2,0X7BAB,
-0X7BB4,0X7BD1,0X7BC1,0X7BCC,0X7BDD,0X7BDA,0X7BE5,0X7BE6,0X7BEA,0X7C0C,0X7BFE,0X7BFC,0X7C0F,0X7C16,0X7C0B,0X0001,
-0X9B07,0X9B09,0X9B0A,0X9B0B,0X9B0C,0X9B0D,0X9B0E,0X9B10,0X9B11,0X9B12,0X9B14,0X9B15,0X9B16,0X9B17,0X9B18,0X9B19,
-0X9B1A,0X9B1B,0X9B1C,0X9B1D,0X9B1E,0X9B20,0X9B21,0X9B22,0X9B24,0X9B25,0X9B26,0X9B27,0X9B28,0X9B29,0X9B2A,0X9B2B,
-0X9B2C,0X9B2D,0X9B2E,0X9B30,0X9B31,0X9B33,0X9B34,0X9B35,0X9B36,0X9B37,0X9B38,0X9B39,0X9B3A,0X9B3D,0X9B3E,0X9B3F,
-0X9B40,0X9B46,0X9B4A,0X9B4B,0X9B4C,0X9B4E,0X9B50,0X9B52,0X9B53,0X9B55,0X9B56,0X9B57,0X9B58,0X9B59,0X9B5A,0X0001,
-0X9B5B,0X9B5C,0X9B5D,0X9B5E,0X9B5F,0X9B60,0X9B61,0X9B62,0X9B63,0X9B64,0X9B65,0X9B66,0X9B67,0X9B68,0X9B69,0X9B6A,
-0X9B6B,0X9B6C,0X9B6D,0X9B6E,0X9B6F,0X9B70,0X9B71,0X9B72,0X9B73,0X9B74,0X9B75,0X9B76,0X9B77,0X9B78,0X9B79,0X9B7A,
-0X9B7B,0X7C1F,0X7C2A,0X7C26,0X7C38,0X7C41,0X7C40,0X81FE,0X8201,0X8202,0X8204,0X81EC,0X8844,0X8221,0X8222,0X8223,
-0X822D,0X822F,0X8228,0X822B,0X8238,0X823B,0X8233,0X8234,0X823E,0X8244,0X8249,0X824B,0X824F,0X825A,0X825F,0X8268,
-0X887E,0X8885,0X8888,0X88D8,0X88DF,0X895E,0X7F9D,0X7F9F,0X7FA7,0X7FAF,0X7FB0,0X7FB2,0X7C7C,0X6549,0X7C91,0X7C9D,
-0X7C9C,0X7C9E,0X7CA2,0X7CB2,0X7CBC,0X7CBD,0X7CC1,0X7CC7,0X7CCC,0X7CCD,0X7CC8,0X7CC5,0X7CD7,0X7CE8,0X826E,0X66A8,
-0X7FBF,0X7FCE,0X7FD5,0X7FE5,0X7FE1,0X7FE6,0X7FE9,0X7FEE,0X7FF3,0X7CF8,0X7D77,0X7DA6,0X7DAE,0X7E47,0X7E9B,0X9EB8,
-0X9EB4,0X8D73,0X8D84,0X8D94,0X8D91,0X8DB1,0X8D67,0X8D6D,0X8C47,0X8C49,0X914A,0X9150,0X914E,0X914F,0X9164,0X0001,
-0X9B7C,0X9B7D,0X9B7E,0X9B7F,0X9B80,0X9B81,0X9B82,0X9B83,0X9B84,0X9B85,0X9B86,0X9B87,0X9B88,0X9B89,0X9B8A,0X9B8B,
-0X9B8C,0X9B8D,0X9B8E,0X9B8F,0X9B90,0X9B91,0X9B92,0X9B93,0X9B94,0X9B95,0X9B96,0X9B97,0X9B98,0X9B99,0X9B9A,0X9B9B,
-0X9B9C,0X9B9D,0X9B9E,0X9B9F,0X9BA0,0X9BA1,0X9BA2,0X9BA3,0X9BA4,0X9BA5,0X9BA6,0X9BA7,0X9BA8,0X9BA9,0X9BAA,0X9BAB,
-0X9BAC,0X9BAD,0X9BAE,0X9BAF,0X9BB0,0X9BB1,0X9BB2,0X9BB3,0X9BB4,0X9BB5,0X9BB6,0X9BB7,0X9BB8,0X9BB9,0X9BBA,0X0001,
-0X9BBB,0X9BBC,0X9BBD,0X9BBE,0X9BBF,0X9BC0,0X9BC1,0X9BC2,0X9BC3,0X9BC4,0X9BC5,0X9BC6,0X9BC7,0X9BC8,0X9BC9,0X9BCA,
-0X9BCB,0X9BCC,0X9BCD,0X9BCE,0X9BCF,0X9BD0,0X9BD1,0X9BD2,0X9BD3,0X9BD4,0X9BD5,0X9BD6,0X9BD7,0X9BD8,0X9BD9,0X9BDA,
-0X9BDB,0X9162,0X9161,0X9170,0X9169,0X916F,0X917D,0X917E,0X9172,0X9174,0X9179,0X918C,0X9185,0X9190,0X918D,0X9191,
-0X91A2,0X91A3,0X91AA,0X91AD,0X91AE,0X91AF,0X91B5,0X91B4,0X91BA,0X8C55,0X9E7E,0X8DB8,0X8DEB,0X8E05,0X8E59,0X8E69,
-0X8DB5,0X8DBF,0X8DBC,0X8DBA,0X8DC4,0X8DD6,0X8DD7,0X8DDA,0X8DDE,0X8DCE,0X8DCF,0X8DDB,0X8DC6,0X8DEC,0X8DF7,0X8DF8,
-0X8DE3,0X8DF9,0X8DFB,0X8DE4,0X8E09,0X8DFD,0X8E14,0X8E1D,0X8E1F,0X8E2C,0X8E2E,0X8E23,0X8E2F,0X8E3A,0X8E40,0X8E39,
-0X8E35,0X8E3D,0X8E31,0X8E49,0X8E41,0X8E42,0X8E51,0X8E52,0X8E4A,0X8E70,0X8E76,0X8E7C,0X8E6F,0X8E74,0X8E85,0X8E8F,
-0X8E94,0X8E90,0X8E9C,0X8E9E,0X8C78,0X8C82,0X8C8A,0X8C85,0X8C98,0X8C94,0X659B,0X89D6,0X89DE,0X89DA,0X89DC,0X0001,
-0X9BDC,0X9BDD,0X9BDE,0X9BDF,0X9BE0,0X9BE1,0X9BE2,0X9BE3,0X9BE4,0X9BE5,0X9BE6,0X9BE7,0X9BE8,0X9BE9,0X9BEA,0X9BEB,
-0X9BEC,0X9BED,0X9BEE,0X9BEF,0X9BF0,0X9BF1,0X9BF2,0X9BF3,0X9BF4,0X9BF5,0X9BF6,0X9BF7,0X9BF8,0X9BF9,0X9BFA,0X9BFB,
-0X9BFC,0X9BFD,0X9BFE,0X9BFF,0X9C00,0X9C01,0X9C02,0X9C03,0X9C04,0X9C05,0X9C06,0X9C07,0X9C08,0X9C09,0X9C0A,0X9C0B,
-0X9C0C,0X9C0D,0X9C0E,0X9C0F,0X9C10,0X9C11,0X9C12,0X9C13,0X9C14,0X9C15,0X9C16,0X9C17,0X9C18,0X9C19,0X9C1A,0X0001,
-0X9C1B,0X9C1C,0X9C1D,0X9C1E,0X9C1F,0X9C20,0X9C21,0X9C22,0X9C23,0X9C24,0X9C25,0X9C26,0X9C27,0X9C28,0X9C29,0X9C2A,
-0X9C2B,0X9C2C,0X9C2D,0X9C2E,0X9C2F,0X9C30,0X9C31,0X9C32,0X9C33,0X9C34,0X9C35,0X9C36,0X9C37,0X9C38,0X9C39,0X9C3A,
-0X9C3B,0X89E5,0X89EB,0X89EF,0X8A3E,0X8B26,0X9753,0X96E9,0X96F3,0X96EF,0X9706,0X9701,0X9708,0X970F,0X970E,0X972A,
-0X972D,0X9730,0X973E,0X9F80,0X9F83,0X9F85,0X9F86,0X9F87,0X9F88,0X9F89,0X9F8A,0X9F8C,0X9EFE,0X9F0B,0X9F0D,0X96B9,
-0X96BC,0X96BD,0X96CE,0X96D2,0X77BF,0X96E0,0X928E,0X92AE,0X92C8,0X933E,0X936A,0X93CA,0X938F,0X943E,0X946B,0X9C7F,
-0X9C82,0X9C85,0X9C86,0X9C87,0X9C88,0X7A23,0X9C8B,0X9C8E,0X9C90,0X9C91,0X9C92,0X9C94,0X9C95,0X9C9A,0X9C9B,0X9C9E,
-0X9C9F,0X9CA0,0X9CA1,0X9CA2,0X9CA3,0X9CA5,0X9CA6,0X9CA7,0X9CA8,0X9CA9,0X9CAB,0X9CAD,0X9CAE,0X9CB0,0X9CB1,0X9CB2,
-0X9CB3,0X9CB4,0X9CB5,0X9CB6,0X9CB7,0X9CBA,0X9CBB,0X9CBC,0X9CBD,0X9CC4,0X9CC5,0X9CC6,0X9CC7,0X9CCA,0X9CCB,0X0001,
-0X9C3C,0X9C3D,0X9C3E,0X9C3F,0X9C40,0X9C41,0X9C42,0X9C43,0X9C44,0X9C45,0X9C46,0X9C47,0X9C48,0X9C49,0X9C4A,0X9C4B,
-0X9C4C,0X9C4D,0X9C4E,0X9C4F,0X9C50,0X9C51,0X9C52,0X9C53,0X9C54,0X9C55,0X9C56,0X9C57,0X9C58,0X9C59,0X9C5A,0X9C5B,
-0X9C5C,0X9C5D,0X9C5E,0X9C5F,0X9C60,0X9C61,0X9C62,0X9C63,0X9C64,0X9C65,0X9C66,0X9C67,0X9C68,0X9C69,0X9C6A,0X9C6B,
-0X9C6C,0X9C6D,0X9C6E,0X9C6F,0X9C70,0X9C71,0X9C72,0X9C73,0X9C74,0X9C75,0X9C76,0X9C77,0X9C78,0X9C79,0X9C7A,0X0001,
-0X9C7B,0X9C7D,0X9C7E,0X9C80,0X9C83,0X9C84,0X9C89,0X9C8A,0X9C8C,0X9C8F,0X9C93,0X9C96,0X9C97,0X9C98,0X9C99,0X9C9D,
-0X9CAA,0X9CAC,0X9CAF,0X9CB9,0X9CBE,0X9CBF,0X9CC0,0X9CC1,0X9CC2,0X9CC8,0X9CC9,0X9CD1,0X9CD2,0X9CDA,0X9CDB,0X9CE0,
-0X9CE1,0X9CCC,0X9CCD,0X9CCE,0X9CCF,0X9CD0,0X9CD3,0X9CD4,0X9CD5,0X9CD7,0X9CD8,0X9CD9,0X9CDC,0X9CDD,0X9CDF,0X9CE2,
-0X977C,0X9785,0X9791,0X9792,0X9794,0X97AF,0X97AB,0X97A3,0X97B2,0X97B4,0X9AB1,0X9AB0,0X9AB7,0X9E58,0X9AB6,0X9ABA,
-0X9ABC,0X9AC1,0X9AC0,0X9AC5,0X9AC2,0X9ACB,0X9ACC,0X9AD1,0X9B45,0X9B43,0X9B47,0X9B49,0X9B48,0X9B4D,0X9B51,0X98E8,
-0X990D,0X992E,0X9955,0X9954,0X9ADF,0X9AE1,0X9AE6,0X9AEF,0X9AEB,0X9AFB,0X9AED,0X9AF9,0X9B08,0X9B0F,0X9B13,0X9B1F,
-0X9B23,0X9EBD,0X9EBE,0X7E3B,0X9E82,0X9E87,0X9E88,0X9E8B,0X9E92,0X93D6,0X9E9D,0X9E9F,0X9EDB,0X9EDC,0X9EDD,0X9EE0,
-0X9EDF,0X9EE2,0X9EE9,0X9EE7,0X9EE5,0X9EEA,0X9EEF,0X9F22,0X9F2C,0X9F2F,0X9F39,0X9F37,0X9F3D,0X9F3E,0X9F44,0X0001,
-0X9CE3,0X9CE4,0X9CE5,0X9CE6,0X9CE7,0X9CE8,0X9CE9,0X9CEA,0X9CEB,0X9CEC,0X9CED,0X9CEE,0X9CEF,0X9CF0,0X9CF1,0X9CF2,
-0X9CF3,0X9CF4,0X9CF5,0X9CF6,0X9CF7,0X9CF8,0X9CF9,0X9CFA,0X9CFB,0X9CFC,0X9CFD,0X9CFE,0X9CFF,0X9D00,0X9D01,0X9D02,
-0X9D03,0X9D04,0X9D05,0X9D06,0X9D07,0X9D08,0X9D09,0X9D0A,0X9D0B,0X9D0C,0X9D0D,0X9D0E,0X9D0F,0X9D10,0X9D11,0X9D12,
-0X9D13,0X9D14,0X9D15,0X9D16,0X9D17,0X9D18,0X9D19,0X9D1A,0X9D1B,0X9D1C,0X9D1D,0X9D1E,0X9D1F,0X9D20,0X9D21,0X0001,
-0X9D22,0X9D23,0X9D24,0X9D25,0X9D26,0X9D27,0X9D28,0X9D29,0X9D2A,0X9D2B,0X9D2C,0X9D2D,0X9D2E,0X9D2F,0X9D30,0X9D31,
-0X9D32,0X9D33,0X9D34,0X9D35,0X9D36,0X9D37,0X9D38,0X9D39,0X9D3A,0X9D3B,0X9D3C,0X9D3D,0X9D3E,0X9D3F,0X9D40,0X9D41,
-0X9D42,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X9D43,0X9D44,0X9D45,0X9D46,0X9D47,0X9D48,0X9D49,0X9D4A,0X9D4B,0X9D4C,0X9D4D,0X9D4E,0X9D4F,0X9D50,0X9D51,0X9D52,
-0X9D53,0X9D54,0X9D55,0X9D56,0X9D57,0X9D58,0X9D59,0X9D5A,0X9D5B,0X9D5C,0X9D5D,0X9D5E,0X9D5F,0X9D60,0X9D61,0X9D62,
-0X9D63,0X9D64,0X9D65,0X9D66,0X9D67,0X9D68,0X9D69,0X9D6A,0X9D6B,0X9D6C,0X9D6D,0X9D6E,0X9D6F,0X9D70,0X9D71,0X9D72,
-0X9D73,0X9D74,0X9D75,0X9D76,0X9D77,0X9D78,0X9D79,0X9D7A,0X9D7B,0X9D7C,0X9D7D,0X9D7E,0X9D7F,0X9D80,0X9D81,0X0001,
-0X9D82,0X9D83,0X9D84,0X9D85,0X9D86,0X9D87,0X9D88,0X9D89,0X9D8A,0X9D8B,0X9D8C,0X9D8D,0X9D8E,0X9D8F,0X9D90,0X9D91,
-0X9D92,0X9D93,0X9D94,0X9D95,0X9D96,0X9D97,0X9D98,0X9D99,0X9D9A,0X9D9B,0X9D9C,0X9D9D,0X9D9E,0X9D9F,0X9DA0,0X9DA1,
-0X9DA2,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X9DA3,0X9DA4,0X9DA5,0X9DA6,0X9DA7,0X9DA8,0X9DA9,0X9DAA,0X9DAB,0X9DAC,0X9DAD,0X9DAE,0X9DAF,0X9DB0,0X9DB1,0X9DB2,
-0X9DB3,0X9DB4,0X9DB5,0X9DB6,0X9DB7,0X9DB8,0X9DB9,0X9DBA,0X9DBB,0X9DBC,0X9DBD,0X9DBE,0X9DBF,0X9DC0,0X9DC1,0X9DC2,
-0X9DC3,0X9DC4,0X9DC5,0X9DC6,0X9DC7,0X9DC8,0X9DC9,0X9DCA,0X9DCB,0X9DCC,0X9DCD,0X9DCE,0X9DCF,0X9DD0,0X9DD1,0X9DD2,
-0X9DD3,0X9DD4,0X9DD5,0X9DD6,0X9DD7,0X9DD8,0X9DD9,0X9DDA,0X9DDB,0X9DDC,0X9DDD,0X9DDE,0X9DDF,0X9DE0,0X9DE1,0X0001,
-0X9DE2,0X9DE3,0X9DE4,0X9DE5,0X9DE6,0X9DE7,0X9DE8,0X9DE9,0X9DEA,0X9DEB,0X9DEC,0X9DED,0X9DEE,0X9DEF,0X9DF0,0X9DF1,
-0X9DF2,0X9DF3,0X9DF4,0X9DF5,0X9DF6,0X9DF7,0X9DF8,0X9DF9,0X9DFA,0X9DFB,0X9DFC,0X9DFD,0X9DFE,0X9DFF,0X9E00,0X9E01,
-0X9E02,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X9E03,0X9E04,0X9E05,0X9E06,0X9E07,0X9E08,0X9E09,0X9E0A,0X9E0B,0X9E0C,0X9E0D,0X9E0E,0X9E0F,0X9E10,0X9E11,0X9E12,
-0X9E13,0X9E14,0X9E15,0X9E16,0X9E17,0X9E18,0X9E19,0X9E1A,0X9E1B,0X9E1C,0X9E1D,0X9E1E,0X9E24,0X9E27,0X9E2E,0X9E30,
-0X9E34,0X9E3B,0X9E3C,0X9E40,0X9E4D,0X9E50,0X9E52,0X9E53,0X9E54,0X9E56,0X9E59,0X9E5D,0X9E5F,0X9E60,0X9E61,0X9E62,
-0X9E65,0X9E6E,0X9E6F,0X9E72,0X9E74,0X9E75,0X9E76,0X9E77,0X9E78,0X9E79,0X9E7A,0X9E7B,0X9E7C,0X9E7D,0X9E80,0X0001,
-0X9E81,0X9E83,0X9E84,0X9E85,0X9E86,0X9E89,0X9E8A,0X9E8C,0X9E8D,0X9E8E,0X9E8F,0X9E90,0X9E91,0X9E94,0X9E95,0X9E96,
-0X9E97,0X9E98,0X9E99,0X9E9A,0X9E9B,0X9E9C,0X9E9E,0X9EA0,0X9EA1,0X9EA2,0X9EA3,0X9EA4,0X9EA5,0X9EA7,0X9EA8,0X9EA9,
-0X9EAA,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X9EAB,0X9EAC,0X9EAD,0X9EAE,0X9EAF,0X9EB0,0X9EB1,0X9EB2,0X9EB3,0X9EB5,0X9EB6,0X9EB7,0X9EB9,0X9EBA,0X9EBC,0X9EBF,
-0X9EC0,0X9EC1,0X9EC2,0X9EC3,0X9EC5,0X9EC6,0X9EC7,0X9EC8,0X9ECA,0X9ECB,0X9ECC,0X9ED0,0X9ED2,0X9ED3,0X9ED5,0X9ED6,
-0X9ED7,0X9ED9,0X9EDA,0X9EDE,0X9EE1,0X9EE3,0X9EE4,0X9EE6,0X9EE8,0X9EEB,0X9EEC,0X9EED,0X9EEE,0X9EF0,0X9EF1,0X9EF2,
-0X9EF3,0X9EF4,0X9EF5,0X9EF6,0X9EF7,0X9EF8,0X9EFA,0X9EFD,0X9EFF,0X9F00,0X9F01,0X9F02,0X9F03,0X9F04,0X9F05,0X0001,
-0X9F06,0X9F07,0X9F08,0X9F09,0X9F0A,0X9F0C,0X9F0F,0X9F11,0X9F12,0X9F14,0X9F15,0X9F16,0X9F18,0X9F1A,0X9F1B,0X9F1C,
-0X9F1D,0X9F1E,0X9F1F,0X9F21,0X9F23,0X9F24,0X9F25,0X9F26,0X9F27,0X9F28,0X9F29,0X9F2A,0X9F2B,0X9F2D,0X9F2E,0X9F30,
-0X9F31,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X9F32,0X9F33,0X9F34,0X9F35,0X9F36,0X9F38,0X9F3A,0X9F3C,0X9F3F,0X9F40,0X9F41,0X9F42,0X9F43,0X9F45,0X9F46,0X9F47,
-0X9F48,0X9F49,0X9F4A,0X9F4B,0X9F4C,0X9F4D,0X9F4E,0X9F4F,0X9F52,0X9F53,0X9F54,0X9F55,0X9F56,0X9F57,0X9F58,0X9F59,
-0X9F5A,0X9F5B,0X9F5C,0X9F5D,0X9F5E,0X9F5F,0X9F60,0X9F61,0X9F62,0X9F63,0X9F64,0X9F65,0X9F66,0X9F67,0X9F68,0X9F69,
-0X9F6A,0X9F6B,0X9F6C,0X9F6D,0X9F6E,0X9F6F,0X9F70,0X9F71,0X9F72,0X9F73,0X9F74,0X9F75,0X9F76,0X9F77,0X9F78,0X0001,
-0X9F79,0X9F7A,0X9F7B,0X9F7C,0X9F7D,0X9F7E,0X9F81,0X9F82,0X9F8D,0X9F8E,0X9F8F,0X9F90,0X9F91,0X9F92,0X9F93,0X9F94,
-0X9F95,0X9F96,0X9F97,0X9F98,0X9F9C,0X9F9D,0X9F9E,0X9FA1,0X9FA2,0X9FA3,0X9FA4,0X9FA5,0XF92C,0XF979,0XF995,0XF9E7,
-0XF9F1,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0XFA0C,0XFA0D,0XFA0E,0XFA0F,0XFA11,0XFA13,0XFA14,0XFA18,0XFA1F,0XFA20,0XFA21,0XFA23,0XFA24,0XFA27,0XFA28,0XFA29,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-};
-
-#endif /*end of __TAB_GBK2UNI__H__D76B1C4F_4C55_4497_AA37_CE482DC90E19 */
-
-
-
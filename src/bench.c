@@ -0,0 +1,736 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+// Benchmark the conversion kernels with hardware performance counters (perf_event_open).
+
+// memmem() for the gbk2utf8_buf+memmem kernel.
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+#include "gbk2uni.h"
+#include "gbk2utf16.h"
+#include "gbkgrep.h"
+#include "gbkintern.h"
+#include "gbkcsv.h"
+#include "log.h"
+// gbk2utf8_iconv(), libiconv's loop for comparison.
+#define CONVERTERS_API_ONLY
+#include "converters.h"
+
+#define BENCH_MIN_BYTES (256UL << 20)
+#define BENCH_PIECE 48
+#define BENCH_REQUEST 1024
+// Distinct values of the low cardinality column the intern kernels convert.
+#define BENCH_VALUES 256
+// gbkgrep needle, "\u7f16\u7801" (encoding) in utf8.
+#define BENCH_NEEDLE "\xe7\xbc\x96\xe7\xa0\x81"
+// Records of the csv kernels: twelve ascii columns, then the gbk text quoted in column 13.
+#define BENCH_CSV_COLUMNS 12
+#define BENCH_CSV_FIELDS "13"
+#define BENCH_FILTERS (GBK2UTF8_FILTER_C0 | GBK2UTF8_FILTER_CRLF | GBK2UTF8_FILTER_JSON)
+#define BENCH_CALIBRATE_BYTES (1UL << 20)
+#define BENCH_CALIBRATE_LOOPS 16
+#define BENCH_CALIBRATE_STEP 5
+
+enum {
+    BENCH_CYCLES = 0,
+    BENCH_INSTRUCTIONS,
+    BENCH_BRANCH_MISSES,
+    BENCH_L1D_MISSES,
+    BENCH_LLC_MISSES,
+    BENCH_DTLB_MISSES,
+    BENCH_COUNTERS,
+};
+
+typedef struct bench_counter {
+    const char *name;
+    uint32_t type;
+    uint64_t config;
+} bench_counter_t;
+
+#define BENCH_CACHE(_cache, _op, _result) \
+    ((_cache) | ((PERF_COUNT_HW_CACHE_OP_##_op) << 8) | ((PERF_COUNT_HW_CACHE_RESULT_##_result) << 16))
+
+static const bench_counter_t bench_counters[BENCH_COUNTERS] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"L1d-misses", PERF_TYPE_HW_CACHE, BENCH_CACHE(PERF_COUNT_HW_CACHE_L1D, READ, MISS)},
+    {"LLC-misses", PERF_TYPE_HW_CACHE, BENCH_CACHE(PERF_COUNT_HW_CACHE_LL, READ, MISS)},
+    {"dTLB-misses", PERF_TYPE_HW_CACHE, BENCH_CACHE(PERF_COUNT_HW_CACHE_DTLB, READ, MISS)},
+};
+
+typedef struct bench_perf {
+    int fd[BENCH_COUNTERS];
+    uint64_t value[BENCH_COUNTERS];
+    bool valid[BENCH_COUNTERS];
+} bench_perf_t;
+
+typedef struct bench_data {
+    const uint8_t *gbk;
+    size_t gbk_len;
+    const uint8_t *utf8;
+    size_t utf8_len;
+    uint8_t *out;
+    size_t out_len;
+    // Short strings for the allocator kernels, piece i is [pieces[i], pieces[i + 1]).
+    size_t *pieces;
+    size_t npieces;
+    gbk_arena_t *arena;
+    gbk_pool_t *pool;
+    gbkgrep_t *grep;
+    gbkintern_t *intern;
+    // The corpus as delimited records, as long as the corpus itself.
+    uint8_t *csv;
+    gbkcsv_t *fields;
+    // Filtered output, GBK2UTF8_FILTER_MAX_LEN() of the corpus, only the pages written are touched.
+    uint8_t *filtered;
+    size_t filtered_len;
+} bench_data_t;
+
+typedef struct bench_kernel {
+    const char *name;
+    bool utf8_input;
+    size_t (*run)(bench_data_t *data);
+} bench_kernel_t;
+
+static size_t run_gbk2utf8(bench_data_t *data) {
+    char *out = gbk2utf8(data->gbk, data->gbk_len);
+    size_t len = ((out != NULL) ? strlen(out) : 0);
+
+    free(out);
+    return len;
+}
+
+static size_t run_pieces(bench_data_t *data, const gbk_allocator_t *a) {
+    size_t i = 0, len = 0;
+    char *out = NULL;
+
+    for (i = 0; i < data->npieces; i++) {
+        out = gbk2utf8_with(data->gbk + data->pieces[i], data->pieces[i + 1] - data->pieces[i], a, NULL);
+        len += ((out != NULL) ? 1 : 0);
+        gbk_free(a, out);
+    }
+    return len;
+}
+
+static size_t run_pieces_libc(bench_data_t *data) {
+    return run_pieces(data, NULL);
+}
+
+// One arena backs BENCH_REQUEST pieces, a request, and is released by one reset.
+static size_t run_pieces_arena(bench_data_t *data) {
+    gbk_allocator_t a = gbk_arena_allocator(data->arena);
+    size_t i = 0, len = 0;
+
+    for (i = 0; i < data->npieces; i++) {
+        len += (gbk2utf8_with(data->gbk + data->pieces[i], data->pieces[i + 1] - data->pieces[i], &a, NULL) != NULL);
+        if ((i % BENCH_REQUEST) == (BENCH_REQUEST - 1)) {
+            gbk_arena_reset(data->arena);
+        }
+    }
+    gbk_arena_reset(data->arena);
+    return len;
+}
+
+static size_t run_pieces_pool(bench_data_t *data) {
+    gbk_allocator_t a = gbk_pool_allocator(data->pool);
+    return run_pieces(data, &a);
+}
+
+// As many pieces as the corpus has, cycling through the first BENCH_VALUES of them.
+static size_t run_values(bench_data_t *data, gbkintern_t *intern) {
+    size_t i = 0, j = 0, len = 0;
+    ssize_t ret = 0;
+
+    for (i = 0; i < data->npieces; i++) {
+        j = i % ((data->npieces < BENCH_VALUES) ? data->npieces : BENCH_VALUES);
+        ret = gbkintern_convert(intern, data->gbk + data->pieces[j], data->pieces[j + 1] - data->pieces[j], data->out,
+                                data->out_len);
+        len += ((ret >= 0) ? ret : 0);
+    }
+    return len;
+}
+
+static size_t run_values_buf(bench_data_t *data) {
+    return run_values(data, NULL);
+}
+
+static size_t run_values_intern(bench_data_t *data) {
+    return run_values(data, data->intern);
+}
+
+static size_t run_gbk2utf8_buf(bench_data_t *data) {
+    return gbk2utf8_buf(data->gbk, data->gbk_len, data->out, data->out_len);
+}
+
+static size_t run_gbk2utf16(bench_data_t *data) {
+    return gbk2utf16(data->gbk, data->gbk_len, (uint16_t *)data->out, data->out_len / sizeof(uint16_t), false);
+}
+
+static size_t run_iconv(bench_data_t *data) {
+    return gbk2utf8_iconv(data->gbk, data->gbk_len, data->out, data->out_len);
+}
+
+static size_t run_is_valid_gbk(bench_data_t *data) {
+    return is_valid_gbk(data->gbk, data->gbk_len);
+}
+
+static size_t run_is_valid_utf8(bench_data_t *data) {
+    return is_valid_utf8(data->utf8, data->utf8_len);
+}
+
+static size_t run_gbk_valid_len(bench_data_t *data) {
+    return gbk_valid_len(data->gbk, data->gbk_len);
+}
+
+static size_t run_utf8_valid_len(bench_data_t *data) {
+    return utf8_valid_len(data->utf8, data->utf8_len);
+}
+
+static size_t run_gbkgrep(bench_data_t *data) {
+    return gbkgrep_search(data->grep, data->gbk, data->gbk_len, NULL, NULL);
+}
+
+// What gbkgrep saves: converting everything, then searching the utf8.
+static size_t run_gbk2utf8_memmem(bench_data_t *data) {
+    ssize_t len = gbk2utf8_buf(data->gbk, data->gbk_len, data->out, data->out_len);
+    const uint8_t *p = data->out, *end = data->out + ((len > 0) ? len : 0);
+    size_t count = 0;
+
+    while ((p = (const uint8_t *)memmem(p, end - p, BENCH_NEEDLE, sizeof(BENCH_NEEDLE) - 1)) != NULL) {
+        p += sizeof(BENCH_NEEDLE) - 1;
+        count++;
+    }
+    return count;
+}
+
+static size_t run_csv_buf(bench_data_t *data) {
+    return gbk2utf8_buf(data->csv, data->gbk_len, data->out, data->out_len);
+}
+
+static size_t run_gbkcsv(bench_data_t *data) {
+    return gbkcsv_convert(data->fields, data->csv, data->gbk_len, data->out, data->out_len, NULL);
+}
+
+static size_t run_gbk2utf8_filter(bench_data_t *data) {
+    return gbk2utf8_buf_filter(data->gbk, data->gbk_len, data->filtered, data->filtered_len, BENCH_FILTERS, NULL);
+}
+
+// What the fused filters save: a second pass over the output.
+static size_t run_gbk2utf8_then_filter(bench_data_t *data) {
+    ssize_t len = gbk2utf8_buf(data->gbk, data->gbk_len, data->out, data->out_len);
+
+    return ((len >= 0) ? utf8_filter_buf(data->out, len, data->filtered, data->filtered_len, BENCH_FILTERS) : -1);
+}
+
+static const bench_kernel_t bench_kernels[] = {
+    {"gbk2utf8", false, run_gbk2utf8},
+    {"gbk2utf8_buf", false, run_gbk2utf8_buf},
+    {"gbk2utf8/48B", false, run_pieces_libc},
+    {"gbk2utf8/48B arena", false, run_pieces_arena},
+    {"gbk2utf8/48B pool", false, run_pieces_pool},
+    {"gbk2utf8/48B x256", false, run_values_buf},
+    {"gbk2utf8/48B x256 intern", false, run_values_intern},
+    {"gbk2utf8_buf csv", false, run_csv_buf},
+    {"gbkcsv", false, run_gbkcsv},
+    {"gbk2utf8_buf filter", false, run_gbk2utf8_filter},
+    {"gbk2utf8_buf+filter", false, run_gbk2utf8_then_filter},
+    {"gbk2utf16", false, run_gbk2utf16},
+    {"gbkgrep", false, run_gbkgrep},
+    {"gbk2utf8_buf+memmem", false, run_gbk2utf8_memmem},
+    {"unicode_loop_convert", false, run_iconv},
+    {"is_valid_gbk", false, run_is_valid_gbk},
+    {"is_valid_utf8", true, run_is_valid_utf8},
+    {"gbk_valid_len", false, run_gbk_valid_len},
+    {"utf8_valid_len", true, run_utf8_valid_len},
+};
+
+static int perf_open(const bench_counter_t *counter) {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counter->type;
+    attr.config = counter->config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/*
+ * Counters are opened one by one rather than as a group, so a PMU with fewer slots multiplexes
+ * them; values are scaled by time_enabled / time_running. Missing counters are reported as n/a.
+ */
+static void perf_init(bench_perf_t *perf) {
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_COUNTERS; i++) {
+        perf->fd[i] = perf_open(&bench_counters[i]);
+        if (perf->fd[i] < 0) {
+            LOGW("Counter [%s] is not available, errno [%d]", bench_counters[i].name, errno);
+        }
+    }
+}
+
+static void perf_start(bench_perf_t *perf) {
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_COUNTERS; i++) {
+        if (perf->fd[i] >= 0) {
+            ioctl(perf->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+static void perf_stop(bench_perf_t *perf) {
+    uint32_t i = 0;
+    uint64_t buf[3] = {0};
+
+    for (i = 0; i < BENCH_COUNTERS; i++) {
+        perf->valid[i] = false;
+        if (perf->fd[i] < 0) {
+            continue;
+        }
+        ioctl(perf->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        if ((read(perf->fd[i], buf, sizeof(buf)) != sizeof(buf)) || (buf[2] == 0)) {
+            continue;
+        }
+        perf->value[i] = ((buf[2] < buf[1]) ? (uint64_t)((double)buf[0] * buf[1] / buf[2]) : buf[0]);
+        perf->valid[i] = true;
+    }
+}
+
+static void perf_close(bench_perf_t *perf) {
+    uint32_t i = 0;
+
+    for (i = 0; i < BENCH_COUNTERS; i++) {
+        if (perf->fd[i] >= 0) {
+            close(perf->fd[i]);
+        }
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void print_ratio(const bench_perf_t *perf, uint32_t num, uint32_t den, double scale) {
+    if (perf->valid[num] && ((den >= BENCH_COUNTERS) || (perf->valid[den] && (perf->value[den] > 0)))) {
+        printf(" %10.3f", perf->value[num] * scale / ((den >= BENCH_COUNTERS) ? 1.0 : perf->value[den]));
+    } else {
+        printf(" %10s", "n/a");
+    }
+}
+
+static void bench_kernel(const bench_kernel_t *kernel, bench_data_t *data, bench_perf_t *perf, uint32_t loops) {
+    uint32_t i = 0;
+    size_t bytes = (kernel->utf8_input ? data->utf8_len : data->gbk_len);
+    double total = (double)bytes * loops;
+    volatile size_t sink = 0;
+    double ns = 0;
+
+    // One untimed pass to fault in the output buffer and the tables.
+    if (kernel->run(data) == (size_t)-1) {
+        LOGW("Kernel [%s] failed on this input, its numbers are meaningless!", kernel->name);
+    }
+
+    ns = now_ns();
+    perf_start(perf);
+    for (i = 0; i < loops; i++) {
+        sink += kernel->run(data);
+    }
+    perf_stop(perf);
+    ns = now_ns() - ns;
+
+    printf("%-22s %10.1f %10.3f", kernel->name, total / ns * 1e3, ns / total);
+    print_ratio(perf, BENCH_INSTRUCTIONS, BENCH_COUNTERS, 1.0 / total);
+    print_ratio(perf, BENCH_INSTRUCTIONS, BENCH_CYCLES, 1.0);
+    print_ratio(perf, BENCH_BRANCH_MISSES, BENCH_COUNTERS, 1024.0 / total);
+    print_ratio(perf, BENCH_L1D_MISSES, BENCH_COUNTERS, 1024.0 / total);
+    print_ratio(perf, BENCH_LLC_MISSES, BENCH_COUNTERS, 1024.0 / total);
+    print_ratio(perf, BENCH_DTLB_MISSES, BENCH_COUNTERS, 1024.0 / total);
+    printf("\n");
+    (void)sink;
+}
+
+// Each gbk2utf8_buf() kernel forced through the thresholds, in the order of the density ranges they serve.
+static const struct {
+    const char *name;
+    gbk2utf8_tune_t tune;
+} bench_forced[] = {
+    {"ascii", {100, 101}},
+    {"mixed", {-1, 101}},
+    {"dense", {-1, 0}},
+};
+
+#define BENCH_FORCED (sizeof(bench_forced) / sizeof(bench_forced[0]))
+
+// Collects the double-byte codes of the corpus that convert, the raw material of the synthetic blocks.
+static size_t collect_chars(const uint8_t *gbk, size_t len, uint8_t *chars, size_t max) {
+    size_t i = 0, n = 0;
+    uint8_t tmp[4];
+
+    while ((i < len) && (n + 2 <= max)) {
+        if ((gbk[i] & 0x80) == 0) {
+            i++;
+            continue;
+        }
+        if ((i + 1 < len) && (gbk2utf8_buf(gbk + i, 2, tmp, sizeof(tmp)) > 0)) {
+            chars[n++] = gbk[i];
+            chars[n++] = gbk[i + 1];
+        }
+        i += 2;
+    }
+    return n / 2;
+}
+
+/*
+ * Fills buf with ascii letters and corpus characters at random, percent of the bytes having the
+ * high bit set. A code is two high bytes, so it is picked with probability percent / (200 - percent).
+ */
+static size_t synth_fill(uint8_t *buf, size_t len, const uint8_t *chars, size_t nchars, uint32_t percent) {
+    size_t i = 0, k = 0;
+    uint32_t seed = 0x9E3779B9u + percent;
+    uint32_t pick = percent * 1000 / (200 - percent);
+
+    while (i + 2 <= len) {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        if ((seed % 1000) < pick) {
+            k = (seed >> 10) % nchars;
+            buf[i++] = chars[k * 2];
+            buf[i++] = chars[k * 2 + 1];
+        } else {
+            buf[i++] = 'a' + (seed >> 10) % 26;
+        }
+    }
+    return i;
+}
+
+/*
+ * Times every forced kernel on synthetic input of rising density and suggests the thresholds:
+ * ascii_max ends the leading densities the ascii kernel wins, dense_min starts the trailing
+ * ones the dense kernel wins.
+ */
+static int32_t calibrate(const uint8_t *gbk, size_t gbk_len) {
+    int32_t ret = -1;
+    uint8_t *chars = NULL, *in = NULL, *out = NULL;
+    size_t nchars = 0, in_len = 0, out_len = GBK2UTF8_MAX_LEN(BENCH_CALIBRATE_BYTES);
+    uint32_t percent = 0, k = 0, loop = 0, best = 0;
+    int32_t ascii_max = -1, dense_min = 101;
+    bool ascii_run = true;
+    double ns = 0, rate[BENCH_FORCED];
+    volatile ssize_t sink = 0;
+    gbk2utf8_tune_t saved;
+
+    gbk2utf8_get_tune(&saved);
+    chars = (uint8_t *)malloc(gbk_len + 2);
+    in = (uint8_t *)malloc(BENCH_CALIBRATE_BYTES);
+    out = (uint8_t *)malloc(out_len);
+    if ((chars == NULL) || (in == NULL) || (out == NULL)) {
+        LOGE("Failed to malloc calibration buffers!");
+        goto __oops;
+    }
+    nchars = collect_chars(gbk, gbk_len, chars, gbk_len + 2);
+    if (nchars == 0) {
+        LOGE("No convertible double-byte code in the input!");
+        goto __oops;
+    }
+
+    printf("%-8s", "high%");
+    for (k = 0; k < BENCH_FORCED; k++) {
+        printf(" %10s", bench_forced[k].name);
+    }
+    printf("   (MB/s)\n");
+    for (percent = 0; percent <= 100; percent += BENCH_CALIBRATE_STEP) {
+        in_len = synth_fill(in, BENCH_CALIBRATE_BYTES, chars, nchars, percent);
+        best = 0;
+        printf("%-8u", percent);
+        for (k = 0; k < BENCH_FORCED; k++) {
+            gbk2utf8_set_tune(&bench_forced[k].tune);
+            sink += gbk2utf8_buf(in, in_len, out, out_len);
+            ns = now_ns();
+            for (loop = 0; loop < BENCH_CALIBRATE_LOOPS; loop++) {
+                sink += gbk2utf8_buf(in, in_len, out, out_len);
+            }
+            rate[k] = (double)in_len * BENCH_CALIBRATE_LOOPS / (now_ns() - ns) * 1e3;
+            best = ((rate[k] > rate[best]) ? k : best);
+            printf(" %10.1f", rate[k]);
+        }
+        printf("\n");
+        ascii_run = (ascii_run && (best == 0));
+        ascii_max = (ascii_run ? (int32_t)percent : ascii_max);
+        if (best != BENCH_FORCED - 1) {
+            dense_min = 101;
+        } else if (dense_min > 100) {
+            dense_min = percent;
+        }
+    }
+    printf("suggested --tune=%d,%d\n", ascii_max, dense_min);
+    (void)sink;
+    ret = 0;
+
+__oops:
+    gbk2utf8_set_tune(&saved);
+    free(out);
+    free(in);
+    free(chars);
+    return ret;
+}
+
+// Cuts the input into pieces of about BENCH_PIECE bytes, never inside a double-byte code.
+static int32_t split_pieces(bench_data_t *data) {
+    size_t i = 0, n = 0;
+
+    data->pieces = (size_t *)malloc((data->gbk_len / BENCH_PIECE + 2) * sizeof(size_t));
+    if (data->pieces == NULL) {
+        return -1;
+    }
+    data->pieces[0] = 0;
+    while (i < data->gbk_len) {
+        if (i >= data->pieces[n] + BENCH_PIECE) {
+            data->pieces[++n] = i;
+        }
+        i += (((data->gbk[i] & 0x80) != 0) ? 2 : 1);
+    }
+    data->npieces = n + 1;
+    data->pieces[data->npieces] = data->gbk_len;
+    return 0;
+}
+
+/*
+ * One record per piece, its text quoted after BENCH_CSV_COLUMNS ascii columns. Records are
+ * added while they fit in the corpus size, newlines pad the rest.
+ */
+static int32_t build_csv(bench_data_t *data) {
+    size_t i = 0, j = 0, o = 0, len = 0;
+    uint32_t k = 0;
+    char head[BENCH_CSV_COLUMNS * 12];
+    int n = 0;
+
+    data->csv = (uint8_t *)malloc(data->gbk_len);
+    if (data->csv == NULL) {
+        return -1;
+    }
+    for (i = 0; i < data->npieces; i++) {
+        for (k = 0, n = 0; k < BENCH_CSV_COLUMNS; k++) {
+            n += snprintf(head + n, sizeof(head) - n, "%zu,", (i * 2654435761UL + k * 40503UL) % 100000);
+        }
+        len = data->pieces[i + 1] - data->pieces[i];
+        if (o + n + len * 2 + 3 > data->gbk_len) {
+            break;
+        }
+        memcpy(data->csv + o, head, n);
+        o += n;
+        data->csv[o++] = '"';
+        for (j = data->pieces[i]; j < data->pieces[i + 1]; j++) {
+            if (data->gbk[j] == '"') {
+                data->csv[o++] = '"';
+            }
+            data->csv[o++] = data->gbk[j];
+        }
+        data->csv[o++] = '"';
+        data->csv[o++] = '\n';
+    }
+    memset(data->csv + o, '\n', data->gbk_len - o);
+    data->fields = gbkcsv_create(GBKCSV_DELIMITER, GBKCSV_QUOTE, BENCH_CSV_FIELDS);
+    return ((data->fields != NULL) ? 0 : -1);
+}
+
+static int32_t read_file(const char *file, uint8_t **buff, size_t *len) {
+    FILE *fp = NULL;
+    long size = 0;
+
+    fp = fopen(file, "rb");
+    if (fp == NULL) {
+        LOGE("Failed to open file [%s]", file);
+        return -1;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    *buff = ((size > 0) ? (uint8_t *)malloc(size) : NULL);
+    if ((*buff == NULL) || (fread(*buff, 1, size, fp) != (size_t)size)) {
+        LOGE("Failed to read file [%s]", file);
+        free(*buff);
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+    *len = size;
+    return 0;
+}
+
+static void usage(const char *exe_name) {
+    printf("Usage: %s [OPTIONS] <GBK_FILE>\n", exe_name);
+    printf("  -n, --loops=N     iterations per kernel, default enough for %lu MB\n", BENCH_MIN_BYTES >> 20);
+    printf("  -k, --kernel=NAME run only this kernel\n");
+    printf("  -T, --tune=A,D    gbk2utf8_buf kernel thresholds, ascii up to A%%, dense from D%% high bytes\n");
+    printf("  -c, --calibrate   time the gbk2utf8_buf kernels by density and suggest --tune\n");
+}
+
+static const struct option long_options[] = {
+    {"loops", required_argument, NULL, 'n'},
+    {"kernel", required_argument, NULL, 'k'},
+    {"tune", required_argument, NULL, 'T'},
+    {"calibrate", no_argument, NULL, 'c'},
+    {"help", no_argument, NULL, 'h'},
+    {NULL, 0, NULL, 0},
+};
+
+int main(int argc, char *argv[]) {
+    int32_t ret = 0;
+    int opt = 0;
+    uint32_t i = 0, loops = 0;
+    const char *only = NULL;
+    bool calib = false;
+    gbk2utf8_tune_t tune;
+    uint8_t *gbk = NULL;
+    ssize_t utf8_len = 0;
+    double cold = 0, warm = 0;
+    bench_data_t data;
+    bench_perf_t perf;
+    gbkintern_stats_t istats;
+
+    while ((opt = getopt_long(argc, argv, "n:k:T:ch", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'n':
+                loops = strtoul(optarg, NULL, 0);
+                break;
+            case 'k':
+                only = optarg;
+                break;
+            case 'T':
+                if (sscanf(optarg, "%d,%d", &tune.ascii_max, &tune.dense_min) != 2) {
+                    usage(argv[0]);
+                    return 1;
+                }
+                gbk2utf8_set_tune(&tune);
+                break;
+            case 'c':
+                calib = true;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (optind >= argc) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    memset(&data, 0, sizeof(data));
+    memset(&perf, 0, sizeof(perf));
+    if ((read_file(argv[optind], &gbk, &data.gbk_len) != 0) || !is_valid_gbk(gbk, data.gbk_len)) {
+        LOGE("Invalid gbk input [%s]!", argv[optind]);
+        ret = -1;
+        goto __oops;
+    }
+    data.gbk = gbk;
+
+    if (calib) {
+        ret = calibrate(data.gbk, data.gbk_len);
+        goto __oops;
+    }
+
+    // Room for utf8 output, or one utf16 unit per input byte.
+    data.out_len = GBK2UTF8_MAX_LEN(data.gbk_len) + data.gbk_len * sizeof(uint16_t);
+    data.out = (uint8_t *)malloc(data.out_len);
+    data.filtered_len = GBK2UTF8_FILTER_MAX_LEN(data.gbk_len);
+    data.filtered = (uint8_t *)malloc(data.filtered_len);
+    if ((data.out == NULL) || (data.filtered == NULL)) {
+        LOGE("Failed to malloc size [%zu]!", data.out_len);
+        ret = -1;
+        goto __oops;
+    }
+
+    /*
+     * The utf8 kernels run on the converted corpus, kept apart from the output buffer. This is
+     * the first conversion of the process: with the output already faulted in, its cost over a
+     * warm one is the table warm-up, paging in the flat table or expanding the COMPACT rows.
+     */
+    memset(data.out, 0, data.out_len);
+    cold = now_ns();
+    utf8_len = gbk2utf8_buf(data.gbk, data.gbk_len, data.out, data.out_len);
+    cold = now_ns() - cold;
+    if (utf8_len < 0) {
+        LOGE("Failed to convert [%s]!", argv[optind]);
+        ret = -1;
+        goto __oops;
+    }
+    warm = now_ns();
+    gbk2utf8_buf(data.gbk, data.gbk_len, data.out, data.out_len);
+    warm = now_ns() - warm;
+    data.utf8 = (const uint8_t *)malloc(utf8_len);
+    if (data.utf8 == NULL) {
+        ret = -1;
+        goto __oops;
+    }
+    memcpy((uint8_t *)data.utf8, data.out, utf8_len);
+    data.utf8_len = utf8_len;
+
+    data.arena = gbk_arena_create(0);
+    data.pool = gbk_pool_create();
+    data.grep = gbkgrep_create((const uint8_t *)BENCH_NEEDLE, sizeof(BENCH_NEEDLE) - 1);
+    data.intern = gbkintern_create(0, 0);
+    if ((split_pieces(&data) != 0) || (build_csv(&data) != 0) || (data.arena == NULL) || (data.pool == NULL) || (data.grep == NULL) ||
+        (data.intern == NULL)) {
+        LOGE("Failed to set up the allocator kernels!");
+        ret = -1;
+        goto __oops;
+    }
+
+    if (loops == 0) {
+        loops = BENCH_MIN_BYTES / data.gbk_len + 1;
+    }
+
+    perf_init(&perf);
+    printf("input [%s] gbk [%zu] utf8 [%zu] loops [%u]\n", argv[optind], data.gbk_len, data.utf8_len, loops);
+    printf("first gbk2utf8_buf [%.1f] us, warm [%.1f] us\n", cold / 1e3, warm / 1e3);
+    printf("%-22s %10s %10s %10s %10s %10s %10s %10s %10s\n", "kernel", "MB/s", "ns/B", "insn/B", "IPC", "brmiss/KB",
+           "L1Dmiss/KB", "LLCmiss/KB", "dTLB/KB");
+    for (i = 0; i < sizeof(bench_kernels) / sizeof(bench_kernels[0]); i++) {
+        if ((only == NULL) || (strcmp(only, bench_kernels[i].name) == 0)) {
+            bench_kernel(&bench_kernels[i], &data, &perf, loops);
+        }
+    }
+    perf_close(&perf);
+
+    gbkintern_get_stats(data.intern, &istats);
+    if ((istats.hits + istats.misses) > 0) {
+        printf("intern: hits [%llu] misses [%llu] evictions [%llu] entries [%llu] bytes [%llu] hit rate [%.2f%%]\n",
+               (unsigned long long)istats.hits, (unsigned long long)istats.misses,
+               (unsigned long long)istats.evictions, (unsigned long long)istats.entries,
+               (unsigned long long)istats.bytes, istats.hits * 100.0 / (istats.hits + istats.misses));
+    }
+
+__oops:
+    gbkcsv_destroy(data.fields);
+    free(data.csv);
+    gbkintern_destroy(data.intern);
+    gbkgrep_destroy(data.grep);
+    gbk_pool_destroy(data.pool);
+    gbk_arena_destroy(data.arena);
+    free(data.pieces);
+    free((void *)data.utf8);
+    free(data.filtered);
+    free(data.out);
+    free(gbk);
+    return ret;
+}
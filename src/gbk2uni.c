@@ -6,3082 +6,32 @@
 // https://github.com/yeahlouis/GBK2UTF8
 
 #include "gbk2uni.h"
+#include "gbktab.h"
 #include "log.h"
 
 #define GBK2UNI_ICONV 1
 
-// clang-format off
-#ifdef GBK2UNI_ICONV
-#warning "Use iconv gbk2uni table!"
-// size: 49023
-static const uint16_t GBK2UNI_TABLE[] = {
-    0x4E02, 0x4FA4, 0x50BD, 0x51D8, 0x5311, 0x54A2, 0x5606, 0x5712, 0x583E, 0x593D, 0x5A61, 0x5B48, 0x5CAA, 0x5DA1, 0x5EC6, 0x6008, 
-    0x6147, 0x624F, 0x63C1, 0x64DB, 0x65F2, 0x6704, 0x685C, 0x6961, 0x6A5C, 0x6B2F, 0x6C59, 0x6DCD, 0x6EF0, 0x6FE6, 0x70DC, 0x71D6, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02CA, 0x3021, 0x72DC, 0x7372, 0x73F8, 0x747B, 0x74F3, 0x7588, 0x7645, 
-    0x76C4, 0x775D, 0x77E6, 0x7884, 0x790D, 0x7993, 0x7A1D, 0x7AA3, 0x7B2F, 0x7BC5, 0x7C43, 0x7CBF, 0x7D37, 0x7D99, 0x7DFB, 0x7E5E, 
-    0x7F56, 0x7FE4, 0x807E, 0x8140, 0x81D4, 0x826A, 0x833E, 0x83EE, 0x847D, 0x8503, 0x8582, 0x85F9, 0x866D, 0x8719, 0x87A5, 0x8824, 
-    0x88AC, 0x8938, 0x89A2, 0x8A1E, 0x8A81, 0x8AE4, 0x8B46, 0x8C38, 0x8CAE, 0x8D0E, 0x8DD5, 0x8E73, 0x8EE5, 0x8F45, 0x9019, 0x90C2, 
-    0x9145, 0x91E6, 0x9246, 0x92A8, 0x930A, 0x936C, 0x93CE, 0x942F, 0x9527, 0x95CC, 0x968C, 0x9721, 0x979E, 0x980F, 0x986F, 0x9908, 
-    0x998C, 0x99FA, 0x9A5A, 0x9B07, 0x9B7C, 0x9BDC, 0x9C3C, 0x9CE3, 0x9D43, 0x9DA3, 0x9E03, 0x9EAB, 0x9F32, 0xFA0C, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E04, 0x4FAB, 0x50BE, 0x51D9, 0x5312, 0x54A5, 0x5607, 0x5713, 0x583F, 0x593E, 0x5A63, 0x5B49, 0x5CAE, 0x5DA2, 0x5EC7, 0x6009, 
-    0x6149, 0x6250, 0x63C2, 0x64DC, 0x65F3, 0x6705, 0x685D, 0x6962, 0x6A5D, 0x6B30, 0x6C5A, 0x6DCE, 0x6EF1, 0x6FE7, 0x70DD, 0x71D7, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02CB, 0x3022, 0x72DD, 0x7373, 0x73F9, 0x747C, 0x74F5, 0x7589, 0x7646, 
-    0x76C7, 0x775E, 0x77E8, 0x7885, 0x790E, 0x7994, 0x7A1F, 0x7AA4, 0x7B30, 0x7BC8, 0x7C44, 0x7CC0, 0x7D38, 0x7D9A, 0x7DFC, 0x7E5F, 
-    0x7F59, 0x7FE7, 0x8081, 0x8141, 0x81D5, 0x826B, 0x833F, 0x83EF, 0x847E, 0x8504, 0x8583, 0x85FA, 0x866F, 0x871B, 0x87A6, 0x8825, 
-    0x88AE, 0x8939, 0x89A3, 0x8A1F, 0x8A82, 0x8AE5, 0x8B47, 0x8C39, 0x8CAF, 0x8D0F, 0x8DD8, 0x8E75, 0x8EE6, 0x8F46, 0x901C, 0x90C3, 
-    0x9147, 0x91E7, 0x9247, 0x92A9, 0x930B, 0x936D, 0x93CF, 0x9430, 0x9533, 0x95CD, 0x968E, 0x9722, 0x979F, 0x9810, 0x9870, 0x9909, 
-    0x998E, 0x99FB, 0x9A5B, 0x9B09, 0x9B7D, 0x9BDD, 0x9C3D, 0x9CE4, 0x9D44, 0x9DA4, 0x9E04, 0x9EAC, 0x9F33, 0xFA0D, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E05, 0x4FAD, 0x50BF, 0x51DA, 0x5313, 0x54AE, 0x560A, 0x5714, 0x5840, 0x593F, 0x5A64, 0x5B4A, 0x5CAF, 0x5DA3, 0x5EC8, 0x600B, 
-    0x614B, 0x6255, 0x63C3, 0x64DD, 0x65F4, 0x6706, 0x685E, 0x6964, 0x6A5E, 0x6B31, 0x6C62, 0x6DCF, 0x6EF2, 0x6FE8, 0x70DE, 0x71D8, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02D9, 0x3023, 0x72DF, 0x7374, 0x73FA, 0x747D, 0x74F8, 0x758A, 0x7647, 
-    0x76C9, 0x775F, 0x77EA, 0x7886, 0x790F, 0x7995, 0x7A21, 0x7AA7, 0x7B32, 0x7BC9, 0x7C45, 0x7CC2, 0x7D39, 0x7D9B, 0x7DFD, 0x7E60, 
-    0x7F5B, 0x7FE8, 0x8082, 0x8142, 0x81D6, 0x826C, 0x8341, 0x83F3, 0x847F, 0x8505, 0x8586, 0x85FC, 0x8670, 0x871D, 0x87A7, 0x8826, 
-    0x88AF, 0x893A, 0x89A4, 0x8A20, 0x8A83, 0x8AE6, 0x8B48, 0x8C3A, 0x8CB0, 0x8D10, 0x8DD9, 0x8E77, 0x8EE7, 0x8F47, 0x9023, 0x90C6, 
-    0x9148, 0x91E8, 0x9248, 0x92AA, 0x930C, 0x936E, 0x93D0, 0x9431, 0x953D, 0x95CE, 0x9691, 0x9723, 0x97A1, 0x9811, 0x9871, 0x990A, 
-    0x999A, 0x99FC, 0x9A5C, 0x9B0A, 0x9B7E, 0x9BDE, 0x9C3E, 0x9CE5, 0x9D45, 0x9DA5, 0x9E05, 0x9EAD, 0x9F34, 0xFA0E, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E06, 0x4FB0, 0x50C0, 0x51DC, 0x5314, 0x54B0, 0x560B, 0x5715, 0x5841, 0x5940, 0x5A65, 0x5B4B, 0x5CB0, 0x5DA4, 0x5ECB, 0x600C, 
-    0x614D, 0x6256, 0x63C5, 0x64DF, 0x65F5, 0x6707, 0x685F, 0x6965, 0x6A5F, 0x6B33, 0x6C63, 0x6DD0, 0x6EF3, 0x6FE9, 0x70E0, 0x71D9, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2013, 0x3024, 0x72E2, 0x7375, 0x73FB, 0x747F, 0x74F9, 0x758C, 0x7648, 
-    0x76CB, 0x7760, 0x77EF, 0x7888, 0x7910, 0x7996, 0x7A22, 0x7AA9, 0x7B34, 0x7BCA, 0x7C46, 0x7CC3, 0x7D3A, 0x7D9C, 0x7DFE, 0x7E61, 
-    0x7F5C, 0x7FEA, 0x8085, 0x8143, 0x81D7, 0x826D, 0x8342, 0x83F4, 0x8480, 0x8506, 0x8588, 0x85FD, 0x8672, 0x871F, 0x87A9, 0x8827, 
-    0x88B0, 0x893B, 0x89A5, 0x8A21, 0x8A84, 0x8AE7, 0x8B49, 0x8C3B, 0x8CB1, 0x8D11, 0x8DDC, 0x8E78, 0x8EE8, 0x8F48, 0x9024, 0x90C8, 
-    0x9151, 0x91E9, 0x9249, 0x92AB, 0x930D, 0x936F, 0x93D1, 0x9432, 0x9543, 0x95CF, 0x9692, 0x9724, 0x97A2, 0x9812, 0x9872, 0x990B, 
-    0x999B, 0x99FD, 0x9A5D, 0x9B0B, 0x9B7F, 0x9BDF, 0x9C3F, 0x9CE6, 0x9D46, 0x9DA6, 0x9E06, 0x9EAE, 0x9F35, 0xFA0F, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E0F, 0x4FB1, 0x50C1, 0x51DE, 0x5318, 0x54B2, 0x560D, 0x5716, 0x5842, 0x5943, 0x5A66, 0x5B4C, 0x5CB2, 0x5DA5, 0x5ECC, 0x6010, 
-    0x614F, 0x6257, 0x63C7, 0x64E0, 0x65F8, 0x670C, 0x686A, 0x6967, 0x6A60, 0x6B34, 0x6C65, 0x6DD2, 0x6EF5, 0x6FEA, 0x70E1, 0x71DA, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2015, 0x3025, 0x72E3, 0x7376, 0x73FC, 0x7482, 0x74FA, 0x758D, 0x7649, 
-    0x76CC, 0x7764, 0x77F0, 0x788A, 0x7911, 0x7997, 0x7A24, 0x7AAA, 0x7B35, 0x7BCB, 0x7C47, 0x7CC4, 0x7D3B, 0x7D9D, 0x7DFF, 0x7E62, 
-    0x7F5D, 0x7FEB, 0x8088, 0x8144, 0x81D8, 0x8271, 0x8344, 0x83F5, 0x8481, 0x8507, 0x8589, 0x85FE, 0x8673, 0x8720, 0x87AA, 0x8828, 
-    0x88B2, 0x893C, 0x89A6, 0x8A22, 0x8A85, 0x8AE8, 0x8B4A, 0x8C3C, 0x8CB2, 0x8D12, 0x8DE0, 0x8E79, 0x8EE9, 0x8F49, 0x9025, 0x90C9, 
-    0x9153, 0x91EA, 0x924A, 0x92AC, 0x930E, 0x9370, 0x93D2, 0x9433, 0x9548, 0x95D0, 0x9693, 0x9725, 0x97A4, 0x9813, 0x9873, 0x990C, 
-    0x999C, 0x99FE, 0x9A5E, 0x9B0C, 0x9B80, 0x9BE0, 0x9C40, 0x9CE7, 0x9D47, 0x9DA7, 0x9E07, 0x9EAF, 0x9F36, 0xFA11, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E12, 0x4FB2, 0x50C2, 0x51DF, 0x531B, 0x54B5, 0x5610, 0x5717, 0x5843, 0x5945, 0x5A68, 0x5B4D, 0x5CB4, 0x5DA6, 0x5ECD, 0x6011, 
-    0x6150, 0x6259, 0x63C8, 0x64E1, 0x65F9, 0x670E, 0x686C, 0x6968, 0x6A62, 0x6B35, 0x6C66, 0x6DD3, 0x6EF6, 0x6FEB, 0x70E2, 0x71DB, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2025, 0x3026, 0x72E4, 0x7377, 0x73FD, 0x7484, 0x74FB, 0x758E, 0x764A, 
-    0x76D3, 0x7767, 0x77F1, 0x788B, 0x7912, 0x7998, 0x7A25, 0x7AAB, 0x7B36, 0x7BCD, 0x7C48, 0x7CC6, 0x7D3C, 0x7D9E, 0x7E00, 0x7E63, 
-    0x7F5E, 0x7FEC, 0x808A, 0x8145, 0x81D9, 0x8275, 0x8345, 0x83F6, 0x8483, 0x8508, 0x858A, 0x8600, 0x8674, 0x8724, 0x87AE, 0x8829, 
-    0x88B3, 0x893D, 0x89A7, 0x8A23, 0x8A86, 0x8AE9, 0x8B4B, 0x8C3D, 0x8CB3, 0x8D13, 0x8DE1, 0x8E7A, 0x8EEA, 0x8F4A, 0x9027, 0x90CB, 
-    0x9154, 0x91EB, 0x924B, 0x92AD, 0x930F, 0x9371, 0x93D3, 0x9434, 0x954B, 0x95D1, 0x9695, 0x9726, 0x97A5, 0x9814, 0x9874, 0x990E, 
-    0x999D, 0x99FF, 0x9A5F, 0x9B0D, 0x9B81, 0x9BE1, 0x9C41, 0x9CE8, 0x9D48, 0x9DA8, 0x9E08, 0x9EB0, 0x9F38, 0xFA13, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E17, 0x4FB3, 0x50C3, 0x51E2, 0x531C, 0x54B6, 0x5611, 0x5718, 0x5845, 0x5946, 0x5A69, 0x5B4E, 0x5CB6, 0x5DA7, 0x5ECE, 0x6013, 
-    0x6152, 0x625A, 0x63CA, 0x64E3, 0x65FB, 0x670F, 0x686D, 0x6969, 0x6A63, 0x6B36, 0x6C67, 0x6DD4, 0x6EF7, 0x6FEC, 0x70E3, 0x71DC, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2035, 0x3027, 0x72E5, 0x7378, 0x73FE, 0x7485, 0x74FC, 0x7590, 0x764B, 
-    0x76D5, 0x7769, 0x77F2, 0x788F, 0x7914, 0x7999, 0x7A26, 0x7AAE, 0x7B37, 0x7BCE, 0x7C49, 0x7CC9, 0x7D3D, 0x7D9F, 0x7E01, 0x7E64, 
-    0x7F60, 0x7FED, 0x808D, 0x8147, 0x81DA, 0x8276, 0x8348, 0x83F7, 0x8484, 0x8509, 0x858B, 0x8601, 0x8675, 0x8726, 0x87B0, 0x882A, 
-    0x88B4, 0x893E, 0x89A8, 0x8A24, 0x8A87, 0x8AEA, 0x8B4C, 0x8C3E, 0x8CB4, 0x8D14, 0x8DE2, 0x8E7B, 0x8EEB, 0x8F4B, 0x9028, 0x90CC, 
-    0x9155, 0x91EC, 0x924C, 0x92AF, 0x9310, 0x9372, 0x93D4, 0x9435, 0x9555, 0x95D2, 0x9696, 0x9727, 0x97A6, 0x9815, 0x988B, 0x990F, 
-    0x999E, 0x9A00, 0x9A60, 0x9B0E, 0x9B82, 0x9BE2, 0x9C42, 0x9CE9, 0x9D49, 0x9DA9, 0x9E09, 0x9EB1, 0x9F3A, 0xFA14, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E1F, 0x4FB4, 0x50C4, 0x51E3, 0x531E, 0x54B7, 0x5612, 0x5719, 0x5846, 0x594A, 0x5A6B, 0x5B4F, 0x5CB9, 0x5DA8, 0x5ECF, 0x6017, 
-    0x6153, 0x625C, 0x63CB, 0x64E5, 0x65FC, 0x6711, 0x686E, 0x696A, 0x6A64, 0x6B38, 0x6C6B, 0x6DD5, 0x6EF8, 0x6FED, 0x70E5, 0x71DD, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2105, 0x3028, 0x72E6, 0x7379, 0x73FF, 0x7486, 0x74FD, 0x7593, 0x764E, 
-    0x76D9, 0x776A, 0x77F4, 0x7890, 0x7915, 0x799B, 0x7A27, 0x7AAF, 0x7B39, 0x7BCF, 0x7C4A, 0x7CCB, 0x7D3E, 0x7DA0, 0x7E02, 0x7E65, 
-    0x7F63, 0x7FEF, 0x808E, 0x8149, 0x81DB, 0x8277, 0x834A, 0x83FA, 0x8485, 0x850A, 0x858C, 0x8602, 0x8676, 0x8727, 0x87B1, 0x882B, 
-    0x88B5, 0x893F, 0x89A9, 0x8A25, 0x8A88, 0x8AEB, 0x8B4D, 0x8C3F, 0x8CB5, 0x8D15, 0x8DE5, 0x8E7D, 0x8EEC, 0x8F4C, 0x9029, 0x90CD, 
-    0x9156, 0x91ED, 0x924D, 0x92B0, 0x9311, 0x9373, 0x93D5, 0x9436, 0x955A, 0x95D3, 0x969A, 0x9728, 0x97A7, 0x9816, 0x988E, 0x9911, 
-    0x999F, 0x9A01, 0x9A61, 0x9B10, 0x9B83, 0x9BE3, 0x9C43, 0x9CEA, 0x9D4A, 0x9DAA, 0x9E0A, 0x9EB2, 0x9F3C, 0xFA18, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E20, 0x4FB6, 0x50C5, 0x51E5, 0x531F, 0x54B9, 0x5613, 0x571A, 0x5847, 0x594C, 0x5A6C, 0x5B52, 0x5CBA, 0x5DA9, 0x5ED0, 0x6018, 
-    0x6154, 0x625D, 0x63CC, 0x64E7, 0x65FD, 0x6712, 0x686F, 0x696C, 0x6A66, 0x6B3B, 0x6C6C, 0x6DD7, 0x6EFA, 0x6FF0, 0x70EA, 0x71DE, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2109, 0x3029, 0x72E7, 0x737A, 0x7400, 0x7488, 0x74FE, 0x7595, 0x764F, 
-    0x76DA, 0x776D, 0x77F5, 0x7892, 0x7916, 0x799C, 0x7A28, 0x7AB0, 0x7B3B, 0x7BD0, 0x7C4B, 0x7CCE, 0x7D3F, 0x7DA1, 0x7E03, 0x7E66, 
-    0x7F64, 0x7FF2, 0x808F, 0x814D, 0x81DC, 0x8278, 0x834B, 0x83FB, 0x8486, 0x850B, 0x858D, 0x8603, 0x8677, 0x8728, 0x87B2, 0x882C, 
-    0x88B6, 0x8940, 0x89AA, 0x8A26, 0x8A8B, 0x8AEC, 0x8B4E, 0x8C40, 0x8CB6, 0x8D16, 0x8DE6, 0x8E7E, 0x8EED, 0x8F4D, 0x902A, 0x90D2, 
-    0x9158, 0x91EE, 0x924E, 0x92B1, 0x9312, 0x9374, 0x93D7, 0x9437, 0x9560, 0x95D4, 0x969B, 0x9729, 0x97A8, 0x9817, 0x9892, 0x9912, 
-    0x99A0, 0x9A02, 0x9A62, 0x9B11, 0x9B84, 0x9BE4, 0x9C44, 0x9CEB, 0x9D4B, 0x9DAB, 0x9E0B, 0x9EB3, 0x9F3F, 0xFA1F, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E21, 0x4FB7, 0x50C6, 0x51E6, 0x5322, 0x54BA, 0x5614, 0x571B, 0x5848, 0x594D, 0x5A6D, 0x5B56, 0x5CBB, 0x5DAA, 0x5ED4, 0x601A, 
-    0x6156, 0x625E, 0x63D1, 0x64E8, 0x65FE, 0x6713, 0x6870, 0x696D, 0x6A67, 0x6B3C, 0x6C6D, 0x6DDA, 0x6EFB, 0x6FF1, 0x70EE, 0x71DF, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2196, 0x32A3, 0x72EA, 0x737B, 0x7401, 0x7489, 0x7500, 0x7598, 0x7650, 
-    0x76DC, 0x776E, 0x77F7, 0x7894, 0x7917, 0x799D, 0x7A29, 0x7AB1, 0x7B3D, 0x7BD2, 0x7C4C, 0x7CCF, 0x7D40, 0x7DA2, 0x7E04, 0x7E67, 
-    0x7F65, 0x7FF4, 0x8090, 0x814E, 0x81DD, 0x827B, 0x834C, 0x83FC, 0x848A, 0x850D, 0x858E, 0x8604, 0x8678, 0x872A, 0x87B4, 0x882D, 
-    0x88B8, 0x8942, 0x89AB, 0x8A27, 0x8A8C, 0x8AED, 0x8B4F, 0x8C42, 0x8CB7, 0x8D17, 0x8DE7, 0x8E80, 0x8EEE, 0x8F4E, 0x902B, 0x90D4, 
-    0x9159, 0x91EF, 0x924F, 0x92B2, 0x9313, 0x9375, 0x93D8, 0x9438, 0x956E, 0x95D5, 0x969D, 0x972B, 0x97A9, 0x9818, 0x9895, 0x9913, 
-    0x99A1, 0x9A03, 0x9A63, 0x9B12, 0x9B85, 0x9BE5, 0x9C45, 0x9CEC, 0x9D4C, 0x9DAC, 0x9E0C, 0x9EB5, 0x9F40, 0xFA20, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E23, 0x4FB8, 0x50C7, 0x51E7, 0x5324, 0x54BC, 0x5615, 0x571D, 0x5849, 0x5950, 0x5A6E, 0x5B5E, 0x5CBC, 0x5DAB, 0x5ED5, 0x601E, 
-    0x6157, 0x625F, 0x63D3, 0x64E9, 0x65FF, 0x6716, 0x6871, 0x696F, 0x6A68, 0x6B3D, 0x6C6E, 0x6DDB, 0x6EFC, 0x6FF2, 0x70F0, 0x71E1, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2197, 0x338E, 0x72EB, 0x737C, 0x7402, 0x748A, 0x7501, 0x759B, 0x7651, 
-    0x76DD, 0x776F, 0x77F9, 0x7895, 0x7918, 0x799E, 0x7A2A, 0x7AB2, 0x7B3F, 0x7BD4, 0x7C4E, 0x7CD0, 0x7D41, 0x7DA3, 0x7E05, 0x7E68, 
-    0x7F66, 0x7FF5, 0x8091, 0x814F, 0x81DE, 0x827C, 0x834D, 0x83FE, 0x848D, 0x850E, 0x8590, 0x8606, 0x8683, 0x872B, 0x87B6, 0x882E, 
-    0x88B9, 0x8943, 0x89AC, 0x8A28, 0x8A8D, 0x8AEE, 0x8B50, 0x8C43, 0x8CB8, 0x8D18, 0x8DE9, 0x8E82, 0x8EEF, 0x8F4F, 0x902C, 0x90D5, 
-    0x915B, 0x91F0, 0x9250, 0x92B3, 0x9314, 0x9376, 0x93D9, 0x9439, 0x9574, 0x95D6, 0x969E, 0x972C, 0x97AA, 0x9819, 0x9899, 0x9914, 
-    0x99A2, 0x9A04, 0x9A64, 0x9B14, 0x9B86, 0x9BE6, 0x9C46, 0x9CED, 0x9D4D, 0x9DAD, 0x9E0D, 0x9EB6, 0x9F41, 0xFA21, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E26, 0x4FB9, 0x50C8, 0x51E8, 0x5325, 0x54BE, 0x5616, 0x571E, 0x584A, 0x5952, 0x5A6F, 0x5B60, 0x5CBE, 0x5DAC, 0x5ED7, 0x601F, 
-    0x6158, 0x6260, 0x63D4, 0x64EA, 0x6601, 0x6718, 0x6872, 0x6970, 0x6A69, 0x6B3F, 0x6C6F, 0x6DDC, 0x6EFD, 0x6FF3, 0x70F1, 0x71E2, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2198, 0x338F, 0x72F5, 0x737D, 0x7404, 0x748C, 0x7502, 0x759C, 0x7652, 
-    0x76DE, 0x7770, 0x77FA, 0x7896, 0x7919, 0x799F, 0x7A2B, 0x7AB4, 0x7B40, 0x7BD5, 0x7C4F, 0x7CD1, 0x7D42, 0x7DA4, 0x7E06, 0x7E69, 
-    0x7F67, 0x7FF6, 0x8092, 0x8152, 0x81DF, 0x8280, 0x834E, 0x83FF, 0x848F, 0x850F, 0x8591, 0x8607, 0x8684, 0x872C, 0x87B7, 0x882F, 
-    0x88BA, 0x8945, 0x89AD, 0x8A29, 0x8A8E, 0x8AEF, 0x8B51, 0x8C44, 0x8CB9, 0x8D19, 0x8DED, 0x8E83, 0x8EF0, 0x8F50, 0x9030, 0x90D6, 
-    0x915C, 0x91F1, 0x9251, 0x92B4, 0x9315, 0x9377, 0x93DA, 0x943A, 0x9575, 0x95D7, 0x969F, 0x972E, 0x97AC, 0x981A, 0x98A3, 0x9915, 
-    0x99A3, 0x9A05, 0x9A65, 0x9B15, 0x9B87, 0x9BE7, 0x9C47, 0x9CEE, 0x9D4E, 0x9DAE, 0x9E0E, 0x9EB7, 0x9F42, 0xFA23, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E29, 0x4FBA, 0x50C9, 0x51E9, 0x5327, 0x54C3, 0x5617, 0x5720, 0x584B, 0x5953, 0x5A70, 0x5B61, 0x5CC0, 0x5DAD, 0x5ED8, 0x6022, 
-    0x6159, 0x6261, 0x63D5, 0x64EB, 0x6604, 0x6719, 0x6873, 0x6972, 0x6A6A, 0x6B40, 0x6C71, 0x6DDF, 0x6EFE, 0x6FF4, 0x70F2, 0x71E3, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2199, 0x339C, 0x72F6, 0x737F, 0x7407, 0x748D, 0x7503, 0x759E, 0x7653, 
-    0x76E0, 0x7771, 0x77FB, 0x7899, 0x791A, 0x79A0, 0x7A2C, 0x7AB5, 0x7B41, 0x7BD6, 0x7C50, 0x7CD2, 0x7D43, 0x7DA5, 0x7E07, 0x7E6A, 
-    0x7F6B, 0x7FF7, 0x8094, 0x8156, 0x81E0, 0x8281, 0x8353, 0x8400, 0x8490, 0x8510, 0x8592, 0x8608, 0x8685, 0x872D, 0x87B8, 0x8830, 
-    0x88BB, 0x8946, 0x89AE, 0x8A2A, 0x8A8F, 0x8AF0, 0x8B52, 0x8C45, 0x8CBA, 0x8D1A, 0x8DEE, 0x8E84, 0x8EF1, 0x8F51, 0x9031, 0x90D8, 
-    0x915F, 0x91F2, 0x9252, 0x92B5, 0x9316, 0x9378, 0x93DB, 0x943B, 0x9577, 0x95D8, 0x96A0, 0x972F, 0x97AE, 0x981B, 0x98A8, 0x9916, 
-    0x99A4, 0x9A06, 0x9A66, 0x9B16, 0x9B88, 0x9BE8, 0x9C48, 0x9CEF, 0x9D4F, 0x9DAF, 0x9E0F, 0x9EB9, 0x9F43, 0xFA24, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E2E, 0x4FBB, 0x50CA, 0x51EA, 0x5328, 0x54C5, 0x5619, 0x5721, 0x584E, 0x5959, 0x5A71, 0x5B67, 0x5CC2, 0x5DAE, 0x5ED9, 0x6023, 
-    0x615A, 0x6262, 0x63D7, 0x64EC, 0x6605, 0x671A, 0x6875, 0x6973, 0x6A6B, 0x6B41, 0x6C73, 0x6DE2, 0x6EFF, 0x6FF5, 0x70F3, 0x71E4, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2215, 0x339D, 0x72F9, 0x7380, 0x7408, 0x748F, 0x7505, 0x75A2, 0x7655, 
-    0x76E1, 0x7772, 0x77FC, 0x789D, 0x791B, 0x79A1, 0x7A2D, 0x7AB6, 0x7B42, 0x7BD7, 0x7C51, 0x7CD3, 0x7D44, 0x7DA7, 0x7E08, 0x7E6B, 
-    0x7F6C, 0x7FF8, 0x8095, 0x8157, 0x81E1, 0x8283, 0x8355, 0x8402, 0x8491, 0x8512, 0x8593, 0x8609, 0x8686, 0x872F, 0x87B9, 0x8831, 
-    0x88BD, 0x8947, 0x89AF, 0x8A2B, 0x8A90, 0x8AF1, 0x8B53, 0x8C48, 0x8CBB, 0x8D1B, 0x8DF0, 0x8E86, 0x8EF2, 0x8F52, 0x9032, 0x90D9, 
-    0x9160, 0x91F3, 0x9253, 0x92B6, 0x9317, 0x9379, 0x93DC, 0x943C, 0x9578, 0x95D9, 0x96A1, 0x9731, 0x97B0, 0x981C, 0x98A9, 0x9917, 
-    0x99A6, 0x9A07, 0x9A67, 0x9B17, 0x9B89, 0x9BE9, 0x9C49, 0x9CF0, 0x9D50, 0x9DB0, 0x9E10, 0x9EBA, 0x9F45, 0xFA27, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E2F, 0x4FBC, 0x50CB, 0x51EC, 0x5329, 0x54CA, 0x561A, 0x5722, 0x584F, 0x595B, 0x5A72, 0x5B68, 0x5CC3, 0x5DAF, 0x5EDA, 0x6024, 
-    0x615B, 0x6264, 0x63D8, 0x64ED, 0x6607, 0x671C, 0x6878, 0x6974, 0x6A6C, 0x6B42, 0x6C75, 0x6DE3, 0x6F00, 0x6FF6, 0x70F4, 0x71E6, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221F, 0x339E, 0x72FD, 0x7381, 0x740B, 0x7491, 0x7506, 0x75A6, 0x7657, 
-    0x76E2, 0x7773, 0x7803, 0x789E, 0x791C, 0x79A2, 0x7A2E, 0x7AB7, 0x7B43, 0x7BD8, 0x7C52, 0x7CD4, 0x7D45, 0x7DA8, 0x7E09, 0x7E6C, 
-    0x7F6D, 0x7FF9, 0x8097, 0x8158, 0x81E2, 0x8285, 0x8356, 0x8405, 0x8492, 0x8514, 0x8594, 0x860A, 0x8687, 0x8730, 0x87BB, 0x8833, 
-    0x88BE, 0x8948, 0x89B0, 0x8A2C, 0x8A91, 0x8AF2, 0x8B54, 0x8C4A, 0x8CBC, 0x8D1C, 0x8DF1, 0x8E88, 0x8EF3, 0x8F53, 0x9033, 0x90DA, 
-    0x9166, 0x91F4, 0x9254, 0x92B7, 0x9318, 0x937A, 0x93DD, 0x943D, 0x9579, 0x95DA, 0x96A2, 0x9733, 0x97B1, 0x981D, 0x98AA, 0x9918, 
-    0x99A7, 0x9A08, 0x9A68, 0x9B18, 0x9B8A, 0x9BEA, 0x9C4A, 0x9CF1, 0x9D51, 0x9DB1, 0x9E11, 0x9EBC, 0x9F46, 0xFA28, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E31, 0x4FBD, 0x50CC, 0x51EE, 0x532B, 0x54CB, 0x561C, 0x5724, 0x5850, 0x595C, 0x5A73, 0x5B6B, 0x5CC5, 0x5DB0, 0x5EDC, 0x602C, 
-    0x615C, 0x6265, 0x63D9, 0x64EE, 0x6608, 0x671E, 0x6879, 0x6975, 0x6A6D, 0x6B44, 0x6C77, 0x6DE5, 0x6F01, 0x6FF7, 0x70F5, 0x71E8, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2223, 0x33A1, 0x72FE, 0x7382, 0x740C, 0x7492, 0x7507, 0x75A7, 0x7658, 
-    0x76E3, 0x7774, 0x7804, 0x78A0, 0x791D, 0x79A3, 0x7A2F, 0x7AB8, 0x7B44, 0x7BDB, 0x7C53, 0x7CD8, 0x7D46, 0x7DA9, 0x7E0A, 0x7E6D, 
-    0x7F6F, 0x7FFA, 0x8099, 0x815B, 0x81E4, 0x8286, 0x8357, 0x8407, 0x8493, 0x8515, 0x8595, 0x860B, 0x8688, 0x8732, 0x87BC, 0x8834, 
-    0x88BF, 0x8949, 0x89B1, 0x8A2D, 0x8A92, 0x8AF3, 0x8B55, 0x8C4B, 0x8CBD, 0x8D20, 0x8DF2, 0x8E89, 0x8EF4, 0x8F54, 0x9034, 0x90DE, 
-    0x9167, 0x91F5, 0x9255, 0x92B8, 0x9319, 0x937B, 0x93DE, 0x943F, 0x957A, 0x95DB, 0x96A3, 0x9734, 0x97B3, 0x981E, 0x98AB, 0x9919, 
-    0x99A9, 0x9A09, 0x9A69, 0x9B19, 0x9B8B, 0x9BEB, 0x9C4B, 0x9CF2, 0x9D52, 0x9DB2, 0x9E12, 0x9EBF, 0x9F47, 0xFA29, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E33, 0x4FBE, 0x50CD, 0x51F1, 0x532C, 0x54D6, 0x561D, 0x5725, 0x5852, 0x595D, 0x5A78, 0x5B6D, 0x5CC6, 0x5DB1, 0x5EDD, 0x602D, 
-    0x615E, 0x6268, 0x63DA, 0x64EF, 0x6609, 0x6720, 0x687A, 0x6976, 0x6A6E, 0x6B45, 0x6C78, 0x6DE7, 0x6F03, 0x6FF8, 0x70F6, 0x71E9, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2252, 0x33C4, 0x72FF, 0x7383, 0x740D, 0x7493, 0x7508, 0x75A8, 0x7659, 
-    0x76E4, 0x7775, 0x7805, 0x78A2, 0x791F, 0x79A4, 0x7A30, 0x7AB9, 0x7B46, 0x7BDC, 0x7C54, 0x7CDA, 0x7D47, 0x7DAA, 0x7E0B, 0x7E6E, 
-    0x7F70, 0x7FFD, 0x809E, 0x815C, 0x81E5, 0x8287, 0x8358, 0x8408, 0x8494, 0x8516, 0x8596, 0x860C, 0x8689, 0x8733, 0x87BE, 0x8835, 
-    0x88C0, 0x894A, 0x89B2, 0x8A2E, 0x8A94, 0x8AF4, 0x8B56, 0x8C4D, 0x8CBE, 0x8D51, 0x8DF4, 0x8E8A, 0x8EF5, 0x8F55, 0x9037, 0x90DF, 
-    0x9168, 0x91F6, 0x9256, 0x92B9, 0x931A, 0x937C, 0x93DF, 0x9440, 0x957B, 0x95DC, 0x96A4, 0x9735, 0x97B5, 0x981F, 0x98AC, 0x991A, 
-    0x99AA, 0x9A0A, 0x9A6A, 0x9B1A, 0x9B8C, 0x9BEC, 0x9C4C, 0x9CF3, 0x9D53, 0x9DB3, 0x9E13, 0x9EC0, 0x9F48, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E35, 0x4FC0, 0x50CE, 0x51F2, 0x532D, 0x54D8, 0x5620, 0x5726, 0x5853, 0x595E, 0x5A79, 0x5B6E, 0x5CC7, 0x5DB2, 0x5EDE, 0x602E, 
-    0x615F, 0x6271, 0x63DB, 0x64F0, 0x660B, 0x6721, 0x687B, 0x697A, 0x6A6F, 0x6B48, 0x6C7A, 0x6DE8, 0x6F04, 0x6FF9, 0x70F8, 0x71EA, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2266, 0x33CE, 0x7300, 0x7385, 0x740E, 0x7494, 0x7509, 0x75A9, 0x765A, 
-    0x76E6, 0x7776, 0x7806, 0x78A4, 0x7920, 0x79A5, 0x7A31, 0x7ABA, 0x7B48, 0x7BDE, 0x7C55, 0x7CDB, 0x7D48, 0x7DAB, 0x7E0C, 0x7E6F, 
-    0x7F73, 0x7FFE, 0x80A3, 0x815D, 0x81E6, 0x8289, 0x8359, 0x8409, 0x8495, 0x8518, 0x8597, 0x860D, 0x868E, 0x8735, 0x87BF, 0x8836, 
-    0x88C3, 0x894B, 0x89B3, 0x8A2F, 0x8A95, 0x8AF5, 0x8B57, 0x8C4E, 0x8CBF, 0x8D52, 0x8DF6, 0x8E8B, 0x8EF6, 0x8F56, 0x9039, 0x90E0, 
-    0x916B, 0x91F7, 0x9257, 0x92BA, 0x931B, 0x937D, 0x93E0, 0x9441, 0x957C, 0x95DD, 0x96A5, 0x9736, 0x97B6, 0x9820, 0x98AD, 0x991B, 
-    0x99AB, 0x9A0B, 0x9A6B, 0x9B1B, 0x9B8D, 0x9BED, 0x9C4D, 0x9CF4, 0x9D54, 0x9DB4, 0x9E14, 0x9EC1, 0x9F49, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E37, 0x4FC1, 0x50D0, 0x51F4, 0x532F, 0x54DB, 0x5621, 0x5727, 0x5855, 0x595F, 0x5A7B, 0x5B6F, 0x5CC8, 0x5DB3, 0x5EDF, 0x6030, 
-    0x6160, 0x6272, 0x63DC, 0x64F1, 0x660D, 0x6722, 0x687C, 0x697B, 0x6A70, 0x6B4A, 0x6C7B, 0x6DE9, 0x6F05, 0x6FFA, 0x70FA, 0x71EB, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2267, 0x33D1, 0x7302, 0x7386, 0x7411, 0x7495, 0x750A, 0x75AA, 0x765B, 
-    0x76E7, 0x7777, 0x7807, 0x78A6, 0x7921, 0x79A6, 0x7A32, 0x7ABB, 0x7B4A, 0x7BDF, 0x7C56, 0x7CDD, 0x7D49, 0x7DAC, 0x7E0D, 0x7E70, 
-    0x7F75, 0x7FFF, 0x80A6, 0x815E, 0x81E8, 0x828C, 0x835D, 0x840A, 0x8496, 0x8519, 0x8598, 0x860E, 0x868F, 0x8736, 0x87C1, 0x8837, 
-    0x88C4, 0x894C, 0x89B4, 0x8A30, 0x8A96, 0x8AF6, 0x8B58, 0x8C4F, 0x8CC0, 0x8D57, 0x8DFC, 0x8E8C, 0x8EF7, 0x8F57, 0x903A, 0x90E3, 
-    0x916D, 0x91F8, 0x9258, 0x92BB, 0x931C, 0x937E, 0x93E1, 0x9442, 0x957D, 0x95DE, 0x96A6, 0x9737, 0x97B7, 0x9821, 0x98AE, 0x991C, 
-    0x99AC, 0x9A0C, 0x9A72, 0x9B1C, 0x9B8E, 0x9BEE, 0x9C4E, 0x9CF5, 0x9D55, 0x9DB5, 0x9E15, 0x9EC2, 0x9F4A, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E3C, 0x4FC2, 0x50D1, 0x51F7, 0x5330, 0x54E0, 0x5622, 0x572B, 0x5856, 0x5961, 0x5A7C, 0x5B72, 0x5CC9, 0x5DB4, 0x5EE0, 0x6031, 
-    0x6161, 0x6274, 0x63DD, 0x64F2, 0x6610, 0x6723, 0x687D, 0x697D, 0x6A72, 0x6B4B, 0x6C7C, 0x6DEA, 0x6F07, 0x6FFB, 0x70FB, 0x71EC, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22BF, 0x33D2, 0x7304, 0x7388, 0x7412, 0x7496, 0x750B, 0x75AD, 0x765D, 
-    0x76E8, 0x7778, 0x7808, 0x78A8, 0x7922, 0x79A8, 0x7A34, 0x7ABC, 0x7B4D, 0x7BE0, 0x7C57, 0x7CDE, 0x7D4A, 0x7DAD, 0x7E0E, 0x7E71, 
-    0x7F76, 0x8002, 0x80A7, 0x815F, 0x81E9, 0x8290, 0x8362, 0x8410, 0x8498, 0x851B, 0x8599, 0x860F, 0x8690, 0x8738, 0x87C2, 0x8838, 
-    0x88C7, 0x894D, 0x89B5, 0x8A31, 0x8A97, 0x8AF7, 0x8B59, 0x8C50, 0x8CC1, 0x8D5F, 0x8DFE, 0x8E8D, 0x8EF8, 0x8F58, 0x903D, 0x90E4, 
-    0x9173, 0x91F9, 0x9259, 0x92BC, 0x931D, 0x937F, 0x93E2, 0x9443, 0x957E, 0x95DF, 0x96A8, 0x973A, 0x97B8, 0x9822, 0x98AF, 0x991D, 
-    0x99AD, 0x9A0D, 0x9A83, 0x9B1D, 0x9B8F, 0x9BEF, 0x9C4F, 0x9CF6, 0x9D56, 0x9DB6, 0x9E16, 0x9EC3, 0x9F4B, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E40, 0x4FC6, 0x50D2, 0x51FE, 0x5331, 0x54E1, 0x5625, 0x5731, 0x5857, 0x5963, 0x5A7D, 0x5B74, 0x5CCA, 0x5DB5, 0x5EE1, 0x6032, 
-    0x6163, 0x6275, 0x63DF, 0x64F3, 0x6611, 0x6724, 0x687E, 0x697E, 0x6A73, 0x6B4D, 0x6C7F, 0x6DED, 0x6F08, 0x6FFC, 0x70FC, 0x71ED, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2550, 0x33D5, 0x7305, 0x738A, 0x7413, 0x7497, 0x750C, 0x75B6, 0x765F, 
-    0x76E9, 0x777A, 0x780A, 0x78A9, 0x7923, 0x79A9, 0x7A35, 0x7ABD, 0x7B4E, 0x7BE2, 0x7C58, 0x7CE1, 0x7D4B, 0x7DAF, 0x7E0F, 0x7E72, 
-    0x7F77, 0x8007, 0x80A8, 0x8161, 0x81EB, 0x8293, 0x8370, 0x8412, 0x849A, 0x851C, 0x859A, 0x8610, 0x8691, 0x8739, 0x87C3, 0x883A, 
-    0x88C8, 0x894E, 0x89B6, 0x8A32, 0x8A98, 0x8AF8, 0x8B5A, 0x8C51, 0x8CC2, 0x8D65, 0x8DFF, 0x8E8E, 0x8EF9, 0x8F59, 0x903F, 0x90E5, 
-    0x917A, 0x91FA, 0x925A, 0x92BD, 0x931E, 0x9380, 0x93E3, 0x9444, 0x9580, 0x95E0, 0x96A9, 0x973B, 0x97B9, 0x9823, 0x98B0, 0x991E, 
-    0x99AE, 0x9A0E, 0x9A89, 0x9B1E, 0x9B90, 0x9BF0, 0x9C50, 0x9CF7, 0x9D57, 0x9DB7, 0x9E17, 0x9EC5, 0x9F4C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E41, 0x4FC7, 0x50D3, 0x5204, 0x5332, 0x54E2, 0x5626, 0x5732, 0x5859, 0x5964, 0x5A7E, 0x5B76, 0x5CCC, 0x5DB6, 0x5EE2, 0x6033, 
-    0x6164, 0x6277, 0x63E2, 0x64F4, 0x6612, 0x6725, 0x687F, 0x697F, 0x6A74, 0x6B4E, 0x6C80, 0x6DEF, 0x6F0A, 0x6FFD, 0x70FE, 0x71EF, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2551, 0xFE30, 0x7306, 0x738C, 0x7414, 0x7498, 0x750E, 0x75B7, 0x7660, 
-    0x76EA, 0x777B, 0x780B, 0x78AA, 0x7925, 0x79AA, 0x7A36, 0x7ABE, 0x7B53, 0x7BE3, 0x7C59, 0x7CE2, 0x7D4C, 0x7DB0, 0x7E10, 0x7E73, 
-    0x7F78, 0x8008, 0x80AC, 0x8162, 0x81EE, 0x8294, 0x8371, 0x8413, 0x849B, 0x851D, 0x859D, 0x8612, 0x8692, 0x873A, 0x87C4, 0x883B, 
-    0x88CA, 0x894F, 0x89B7, 0x8A33, 0x8A99, 0x8AF9, 0x8B5B, 0x8C52, 0x8CC3, 0x8D68, 0x8E00, 0x8E91, 0x8EFA, 0x8F5A, 0x9040, 0x90E9, 
-    0x917B, 0x91FB, 0x925B, 0x92BE, 0x931F, 0x9381, 0x93E4, 0x9445, 0x9581, 0x95E1, 0x96AA, 0x973C, 0x97BA, 0x9824, 0x98B1, 0x991F, 
-    0x99AF, 0x9A0F, 0x9A8D, 0x9B20, 0x9B91, 0x9BF1, 0x9C51, 0x9CF8, 0x9D58, 0x9DB8, 0x9E18, 0x9EC6, 0x9F4D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E42, 0x4FC8, 0x50D4, 0x5205, 0x5333, 0x54E3, 0x5628, 0x5734, 0x585A, 0x5966, 0x5A80, 0x5B77, 0x5CCD, 0x5DB8, 0x5EE3, 0x6034, 
-    0x6165, 0x6278, 0x63E4, 0x64F5, 0x6616, 0x6727, 0x6880, 0x6981, 0x6A75, 0x6B4F, 0x6C84, 0x6DF0, 0x6F0B, 0x6FFE, 0x70FF, 0x71F0, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2552, 0xFFE2, 0x7307, 0x738D, 0x7415, 0x7499, 0x7510, 0x75BA, 0x7661, 
-    0x76EB, 0x777C, 0x780E, 0x78AB, 0x7926, 0x79AB, 0x7A38, 0x7AC0, 0x7B55, 0x7BE4, 0x7C5A, 0x7CE3, 0x7D4D, 0x7DB1, 0x7E11, 0x7E74, 
-    0x7F7A, 0x8009, 0x80B0, 0x8163, 0x81EF, 0x8295, 0x8372, 0x8414, 0x849D, 0x851E, 0x859E, 0x8613, 0x8694, 0x873C, 0x87C5, 0x883D, 
-    0x88CB, 0x8950, 0x89B8, 0x8A34, 0x8A9A, 0x8AFA, 0x8B5C, 0x8C53, 0x8CC4, 0x8D69, 0x8E01, 0x8E92, 0x8EFB, 0x8F5B, 0x9043, 0x90EA, 
-    0x917C, 0x91FC, 0x925C, 0x92BF, 0x9320, 0x9382, 0x93E5, 0x9446, 0x9582, 0x95E2, 0x96AB, 0x973D, 0x97BB, 0x9825, 0x98B2, 0x9920, 
-    0x99B0, 0x9A10, 0x9A8E, 0x9B21, 0x9B92, 0x9BF2, 0x9C52, 0x9CF9, 0x9D59, 0x9DB9, 0x9E19, 0x9EC7, 0x9F4E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E44, 0x4FC9, 0x50D5, 0x5209, 0x5334, 0x54E4, 0x5629, 0x5735, 0x585B, 0x5967, 0x5A81, 0x5B78, 0x5CCE, 0x5DB9, 0x5EE4, 0x6036, 
-    0x6166, 0x627A, 0x63E5, 0x64F6, 0x6617, 0x6729, 0x6882, 0x6983, 0x6A76, 0x6B50, 0x6C87, 0x6DF2, 0x6F0C, 0x6FFF, 0x7100, 0x71F1, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2553, 0xFFE4, 0x7308, 0x738F, 0x7416, 0x749A, 0x7512, 0x75BB, 0x7662, 
-    0x76EC, 0x7781, 0x780F, 0x78AC, 0x7927, 0x79AC, 0x7A3A, 0x7AC1, 0x7B57, 0x7BE7, 0x7C5B, 0x7CE4, 0x7D4E, 0x7DB2, 0x7E12, 0x7E75, 
-    0x7F7B, 0x800A, 0x80B3, 0x8164, 0x81F0, 0x8296, 0x8373, 0x8415, 0x849E, 0x8520, 0x859F, 0x8614, 0x8696, 0x873D, 0x87C7, 0x883E, 
-    0x88CC, 0x8951, 0x89B9, 0x8A35, 0x8A9B, 0x8AFB, 0x8B5D, 0x8C54, 0x8CC5, 0x8D6A, 0x8E02, 0x8E93, 0x8EFC, 0x8F5C, 0x9045, 0x90EC, 
-    0x9180, 0x91FD, 0x925D, 0x92C0, 0x9321, 0x9383, 0x93E6, 0x9447, 0x9583, 0x95E3, 0x96AC, 0x973F, 0x97BC, 0x9826, 0x98B3, 0x9921, 
-    0x99B1, 0x9A11, 0x9A94, 0x9B22, 0x9B93, 0x9BF3, 0x9C53, 0x9CFA, 0x9D5A, 0x9DBA, 0x9E1A, 0x9EC8, 0x9F4F, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E46, 0x4FCB, 0x50D7, 0x520B, 0x5335, 0x54EB, 0x562A, 0x5736, 0x585C, 0x5968, 0x5A82, 0x5B79, 0x5CCF, 0x5DBA, 0x5EE5, 0x6037, 
-    0x6169, 0x627B, 0x63E6, 0x64F7, 0x6618, 0x672E, 0x6884, 0x6985, 0x6A77, 0x6B51, 0x6C8A, 0x6DF4, 0x6F0D, 0x7000, 0x7101, 0x71F2, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2554, 0x0000, 0x7309, 0x7390, 0x7417, 0x749B, 0x7514, 0x75BF, 0x7664, 
-    0x76ED, 0x7782, 0x7810, 0x78AD, 0x7928, 0x79AD, 0x7A3E, 0x7AC2, 0x7B59, 0x7BE8, 0x7C5C, 0x7CE5, 0x7D4F, 0x7DB3, 0x7E13, 0x7E76, 
-    0x7F7C, 0x800E, 0x80B5, 0x8166, 0x81F1, 0x829A, 0x8374, 0x8416, 0x849F, 0x8522, 0x85A0, 0x8615, 0x8697, 0x8740, 0x87C8, 0x883F, 
-    0x88CD, 0x8952, 0x89BA, 0x8A36, 0x8A9C, 0x8AFC, 0x8B5E, 0x8C56, 0x8CC6, 0x8D6C, 0x8E03, 0x8E95, 0x8EFD, 0x8F5D, 0x9046, 0x90EE, 
-    0x9181, 0x91FE, 0x925E, 0x92C1, 0x9322, 0x9384, 0x93E7, 0x9448, 0x9584, 0x95E4, 0x96AD, 0x9740, 0x97BD, 0x9827, 0x98B4, 0x9922, 
-    0x99B2, 0x9A12, 0x9A95, 0x9B24, 0x9B94, 0x9BF4, 0x9C54, 0x9CFB, 0x9D5B, 0x9DBB, 0x9E1B, 0x9ECA, 0x9F52, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E4A, 0x4FCC, 0x50D8, 0x520C, 0x5336, 0x54EC, 0x562B, 0x5737, 0x585D, 0x5969, 0x5A83, 0x5B7B, 0x5CD0, 0x5DBB, 0x5EE6, 0x6038, 
-    0x616A, 0x627D, 0x63E7, 0x64F8, 0x661A, 0x6730, 0x6887, 0x698A, 0x6A78, 0x6B52, 0x6C8B, 0x6DF5, 0x6F0E, 0x7001, 0x7102, 0x71F3, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2555, 0x2121, 0x730B, 0x7392, 0x7418, 0x749D, 0x7515, 0x75C0, 0x7665, 
-    0x76F0, 0x7783, 0x7813, 0x78AE, 0x7929, 0x79AE, 0x7A40, 0x7AC3, 0x7B5C, 0x7BE9, 0x7C5D, 0x7CE6, 0x7D50, 0x7DB4, 0x7E14, 0x7E77, 
-    0x7F7D, 0x800F, 0x80B6, 0x8168, 0x81F2, 0x829B, 0x8375, 0x8417, 0x84A0, 0x8523, 0x85A1, 0x8617, 0x8698, 0x8741, 0x87C9, 0x8841, 
-    0x88CF, 0x8953, 0x89BB, 0x8A37, 0x8A9D, 0x8AFD, 0x8B5F, 0x8C57, 0x8CC7, 0x8D6E, 0x8E04, 0x8E96, 0x8EFE, 0x8F5E, 0x9048, 0x90F0, 
-    0x9182, 0x91FF, 0x925F, 0x92C2, 0x9323, 0x9385, 0x93E8, 0x9449, 0x9585, 0x95E5, 0x96AE, 0x9741, 0x97BE, 0x9828, 0x98B5, 0x9923, 
-    0x99B3, 0x9A13, 0x9A99, 0x9B25, 0x9B95, 0x9BF5, 0x9C55, 0x9CFC, 0x9D5C, 0x9DBC, 0x9E1C, 0x9ECB, 0x9F53, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E51, 0x4FCD, 0x50D9, 0x520F, 0x5337, 0x54EF, 0x562E, 0x5738, 0x585F, 0x596A, 0x5A84, 0x5B7C, 0x5CD1, 0x5DBC, 0x5EE7, 0x6039, 
-    0x616B, 0x6281, 0x63E8, 0x64F9, 0x661B, 0x6732, 0x6888, 0x698B, 0x6A7A, 0x6B53, 0x6C8D, 0x6DF6, 0x6F10, 0x7002, 0x7103, 0x71F4, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2556, 0x3231, 0x730C, 0x7393, 0x7419, 0x749F, 0x7516, 0x75C1, 0x7666, 
-    0x76F3, 0x7786, 0x7815, 0x78AF, 0x792A, 0x79AF, 0x7A41, 0x7AC4, 0x7B5E, 0x7BEB, 0x7C5E, 0x7CE7, 0x7D51, 0x7DB5, 0x7E15, 0x7E78, 
-    0x7F7F, 0x8011, 0x80B8, 0x816A, 0x81F5, 0x829E, 0x8376, 0x8419, 0x84A2, 0x8524, 0x85A2, 0x8618, 0x8699, 0x8742, 0x87CC, 0x8842, 
-    0x88D0, 0x8954, 0x89BC, 0x8A38, 0x8A9E, 0x8AFE, 0x8B60, 0x8C58, 0x8CC8, 0x8D6F, 0x8E06, 0x8E97, 0x8EFF, 0x8F5F, 0x9049, 0x90F1, 
-    0x9183, 0x9200, 0x9260, 0x92C3, 0x9324, 0x9386, 0x93E9, 0x944A, 0x9586, 0x95E6, 0x96AF, 0x9742, 0x97BF, 0x9829, 0x98B6, 0x9924, 
-    0x99B4, 0x9A14, 0x9AA6, 0x9B26, 0x9B96, 0x9BF6, 0x9C56, 0x9CFD, 0x9D5D, 0x9DBD, 0x9E1D, 0x9ECC, 0x9F54, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E55, 0x4FD2, 0x50DB, 0x5210, 0x5338, 0x54F0, 0x562F, 0x573C, 0x5860, 0x596B, 0x5A85, 0x5B7E, 0x5CD3, 0x5DBD, 0x5EE9, 0x603A, 
-    0x616C, 0x6282, 0x63EB, 0x64FA, 0x661C, 0x6733, 0x6889, 0x698C, 0x6A7B, 0x6B54, 0x6C8E, 0x6DF8, 0x6F11, 0x7003, 0x7104, 0x71F5, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2557, 0x0000, 0x730D, 0x7394, 0x741C, 0x74A0, 0x7517, 0x75C6, 0x7667, 
-    0x76F5, 0x7787, 0x7819, 0x78B5, 0x792B, 0x79B0, 0x7A42, 0x7AC5, 0x7B5F, 0x7BEC, 0x7C5F, 0x7CE9, 0x7D52, 0x7DB6, 0x7E16, 0x7E79, 
-    0x7F80, 0x8013, 0x80B9, 0x816B, 0x81F6, 0x82A0, 0x8379, 0x841A, 0x84A3, 0x8525, 0x85A3, 0x8619, 0x869A, 0x8743, 0x87CD, 0x8843, 
-    0x88D1, 0x8955, 0x89BD, 0x8A39, 0x8A9F, 0x8AFF, 0x8B61, 0x8C59, 0x8CC9, 0x8D71, 0x8E07, 0x8E98, 0x8F00, 0x8F60, 0x904A, 0x90F2, 
-    0x9184, 0x9201, 0x9261, 0x92C4, 0x9325, 0x9387, 0x93EA, 0x944B, 0x9587, 0x95E7, 0x96B1, 0x9743, 0x97C0, 0x982A, 0x98B7, 0x9925, 
-    0x99B5, 0x9A15, 0x9AA9, 0x9B27, 0x9B97, 0x9BF7, 0x9C57, 0x9CFE, 0x9D5E, 0x9DBE, 0x9E1E, 0x9ED0, 0x9F55, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E57, 0x4FD3, 0x50DC, 0x5213, 0x533C, 0x54F1, 0x5630, 0x573D, 0x5861, 0x596C, 0x5A86, 0x5B7F, 0x5CD4, 0x5DBE, 0x5EEB, 0x603D, 
-    0x616D, 0x6283, 0x63EC, 0x64FB, 0x661E, 0x6736, 0x688A, 0x698E, 0x6A7D, 0x6B55, 0x6C91, 0x6DFA, 0x6F12, 0x7004, 0x7105, 0x71F6, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2558, 0x2010, 0x730F, 0x7395, 0x741D, 0x74A1, 0x751B, 0x75CB, 0x7668, 
-    0x76F6, 0x7788, 0x781B, 0x78B6, 0x792C, 0x79B1, 0x7A43, 0x7AC6, 0x7B61, 0x7BED, 0x7C60, 0x7CEA, 0x7D53, 0x7DB7, 0x7E17, 0x7E7A, 
-    0x7F82, 0x801A, 0x80BB, 0x816C, 0x81F7, 0x82A2, 0x837A, 0x841B, 0x84A4, 0x8526, 0x85A5, 0x861A, 0x869B, 0x8744, 0x87CE, 0x8846, 
-    0x88D3, 0x8956, 0x89BE, 0x8A3A, 0x8AA0, 0x8B00, 0x8B62, 0x8C5B, 0x8CCA, 0x8D72, 0x8E08, 0x8E99, 0x8F01, 0x8F61, 0x904B, 0x90F3, 
-    0x9186, 0x9202, 0x9262, 0x92C5, 0x9326, 0x9388, 0x93EB, 0x944C, 0x9588, 0x95EC, 0x96B2, 0x9744, 0x97C1, 0x982B, 0x98B8, 0x9926, 
-    0x99B6, 0x9A16, 0x9AAA, 0x9B28, 0x9B98, 0x9BF8, 0x9C58, 0x9CFF, 0x9D5F, 0x9DBF, 0x9E24, 0x9ED2, 0x9F56, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E5A, 0x4FD4, 0x50DD, 0x5214, 0x533D, 0x54F4, 0x5633, 0x573F, 0x5862, 0x596D, 0x5A87, 0x5B82, 0x5CD5, 0x5DBF, 0x5EEC, 0x603E, 
-    0x616E, 0x6285, 0x63EE, 0x64FC, 0x6621, 0x6737, 0x688B, 0x698F, 0x6A7E, 0x6B56, 0x6C92, 0x6DFD, 0x6F16, 0x7005, 0x7106, 0x71F7, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2559, 0x0000, 0x7310, 0x7397, 0x741E, 0x74A2, 0x751D, 0x75CC, 0x7669, 
-    0x76F7, 0x7789, 0x781E, 0x78B7, 0x792D, 0x79B2, 0x7A44, 0x7AC7, 0x7B63, 0x7BEF, 0x7C61, 0x7CEB, 0x7D54, 0x7DB8, 0x7E18, 0x7E7B, 
-    0x7F83, 0x801B, 0x80C5, 0x816F, 0x81F8, 0x82A3, 0x837E, 0x841E, 0x84A5, 0x8527, 0x85A6, 0x861B, 0x869E, 0x8745, 0x87CF, 0x8847, 
-    0x88D6, 0x8957, 0x89BF, 0x8A3B, 0x8AA1, 0x8B01, 0x8B63, 0x8C5C, 0x8CCB, 0x8D78, 0x8E0B, 0x8E9A, 0x8F02, 0x8F62, 0x904C, 0x90F5, 
-    0x9188, 0x9203, 0x9263, 0x92C6, 0x9327, 0x9389, 0x93EC, 0x944D, 0x9589, 0x95FF, 0x96B4, 0x9745, 0x97C2, 0x982C, 0x98B9, 0x9927, 
-    0x99B7, 0x9A17, 0x9AAB, 0x9B29, 0x9B99, 0x9BF9, 0x9C59, 0x9D00, 0x9D60, 0x9DC0, 0x9E27, 0x9ED3, 0x9F57, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E5B, 0x4FD5, 0x50DE, 0x5215, 0x5340, 0x54F5, 0x5635, 0x5741, 0x5863, 0x596E, 0x5A88, 0x5B86, 0x5CD6, 0x5DC0, 0x5EED, 0x6040, 
-    0x616F, 0x6286, 0x63EF, 0x64FD, 0x6622, 0x6738, 0x688C, 0x6990, 0x6A7F, 0x6B57, 0x6C95, 0x6DFE, 0x6F17, 0x7006, 0x7107, 0x71F8, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255A, 0x0000, 0x7311, 0x7398, 0x741F, 0x74A3, 0x751E, 0x75CE, 0x766A, 
-    0x76FA, 0x778A, 0x7820, 0x78B8, 0x792E, 0x79B4, 0x7A45, 0x7AC8, 0x7B64, 0x7BF0, 0x7C62, 0x7CEC, 0x7D55, 0x7DB9, 0x7E19, 0x7E7C, 
-    0x7F84, 0x801D, 0x80C7, 0x8172, 0x81F9, 0x82A7, 0x837F, 0x841F, 0x84A6, 0x8528, 0x85A7, 0x861C, 0x869F, 0x8746, 0x87D0, 0x8848, 
-    0x88D7, 0x8958, 0x89C0, 0x8A3C, 0x8AA2, 0x8B02, 0x8B64, 0x8C5D, 0x8CCC, 0x8D79, 0x8E0D, 0x8E9B, 0x8F03, 0x8F63, 0x904E, 0x90F6, 
-    0x918A, 0x9204, 0x9264, 0x92C7, 0x9328, 0x938A, 0x93ED, 0x944E, 0x958A, 0x9607, 0x96B5, 0x9746, 0x97C3, 0x982D, 0x98BA, 0x9928, 
-    0x99B8, 0x9A18, 0x9AAC, 0x9B2A, 0x9B9A, 0x9BFA, 0x9C5A, 0x9D01, 0x9D61, 0x9DC1, 0x9E2E, 0x9ED5, 0x9F58, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E62, 0x4FD6, 0x50DF, 0x521C, 0x5342, 0x54F6, 0x5637, 0x5743, 0x5864, 0x596F, 0x5A89, 0x5B8A, 0x5CD7, 0x5DC1, 0x5EEE, 0x6044, 
-    0x6171, 0x6287, 0x63F0, 0x64FE, 0x6623, 0x6739, 0x688D, 0x6991, 0x6A81, 0x6B58, 0x6C96, 0x6DFF, 0x6F18, 0x7007, 0x7108, 0x71FA, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255B, 0x0000, 0x7312, 0x7399, 0x7420, 0x74A4, 0x7520, 0x75CF, 0x766C, 
-    0x76FB, 0x778B, 0x7821, 0x78BA, 0x792F, 0x79B5, 0x7A47, 0x7AC9, 0x7B65, 0x7BF2, 0x7C63, 0x7CED, 0x7D56, 0x7DBA, 0x7E1A, 0x7E7D, 
-    0x7F85, 0x801E, 0x80C8, 0x8173, 0x81FA, 0x82B2, 0x8380, 0x8420, 0x84A7, 0x8529, 0x85A9, 0x861D, 0x86A0, 0x874A, 0x87D4, 0x8849, 
-    0x88DA, 0x8959, 0x89C3, 0x8A3D, 0x8AA3, 0x8B03, 0x8B65, 0x8C5E, 0x8CCD, 0x8D7A, 0x8E0E, 0x8E9D, 0x8F04, 0x8F64, 0x9054, 0x90F7, 
-    0x918E, 0x9205, 0x9265, 0x92C9, 0x9329, 0x938B, 0x93EE, 0x944F, 0x958B, 0x9613, 0x96B7, 0x9747, 0x97C4, 0x982E, 0x98BB, 0x9929, 
-    0x99B9, 0x9A19, 0x9AAD, 0x9B2B, 0x9B9B, 0x9BFB, 0x9C5B, 0x9D02, 0x9D62, 0x9DC2, 0x9E30, 0x9ED6, 0x9F59, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E63, 0x4FD9, 0x50E0, 0x521E, 0x5344, 0x54F7, 0x5638, 0x5744, 0x5866, 0x5970, 0x5A8A, 0x5B8D, 0x5CD8, 0x5DC2, 0x5EEF, 0x6045, 
-    0x6172, 0x6288, 0x63F1, 0x64FF, 0x6624, 0x673B, 0x688E, 0x6992, 0x6A82, 0x6B5A, 0x6C97, 0x6E00, 0x6F19, 0x7008, 0x710B, 0x71FB, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255C, 0x30FC, 0x7314, 0x739A, 0x7421, 0x74A5, 0x7521, 0x75D0, 0x766D, 
-    0x76FD, 0x778F, 0x7822, 0x78BB, 0x7930, 0x79B6, 0x7A48, 0x7ACA, 0x7B66, 0x7BF3, 0x7C64, 0x7CEE, 0x7D57, 0x7DBB, 0x7E1B, 0x7E7E, 
-    0x7F86, 0x801F, 0x80C9, 0x8175, 0x81FD, 0x82B5, 0x8381, 0x8421, 0x84A8, 0x852A, 0x85AB, 0x861E, 0x86A1, 0x874B, 0x87D5, 0x884A, 
-    0x88DB, 0x895A, 0x89CD, 0x8A3F, 0x8AA4, 0x8B04, 0x8B67, 0x8C5F, 0x8CCE, 0x8D7B, 0x8E10, 0x8E9F, 0x8F05, 0x8F65, 0x9055, 0x90F9, 
-    0x918F, 0x9206, 0x9266, 0x92CA, 0x932A, 0x938C, 0x93EF, 0x9450, 0x958C, 0x9618, 0x96B8, 0x9748, 0x97C5, 0x982F, 0x98BC, 0x992A, 
-    0x99BA, 0x9A1A, 0x9AAE, 0x9B2C, 0x9B9C, 0x9BFC, 0x9C5C, 0x9D03, 0x9D63, 0x9DC3, 0x9E34, 0x9ED7, 0x9F5A, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E64, 0x4FDB, 0x50E1, 0x521F, 0x5346, 0x54F8, 0x563A, 0x5745, 0x5867, 0x5971, 0x5A8B, 0x5B8E, 0x5CDA, 0x5DC3, 0x5EF0, 0x6046, 
-    0x6173, 0x628B, 0x63F3, 0x6501, 0x6626, 0x673C, 0x6890, 0x6993, 0x6A83, 0x6B5B, 0x6C98, 0x6E01, 0x6F1A, 0x7009, 0x710C, 0x71FC, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255D, 0x309B, 0x7318, 0x739C, 0x7423, 0x74A6, 0x7522, 0x75D1, 0x766E, 
-    0x76FF, 0x7790, 0x7824, 0x78BC, 0x7931, 0x79B7, 0x7A49, 0x7ACC, 0x7B67, 0x7BF4, 0x7C65, 0x7CF0, 0x7D58, 0x7DBC, 0x7E1C, 0x7E7F, 
-    0x7F87, 0x8021, 0x80CA, 0x8176, 0x81FF, 0x82B6, 0x8382, 0x8422, 0x84A9, 0x852D, 0x85AC, 0x861F, 0x86A2, 0x874D, 0x87D6, 0x884B, 
-    0x88DC, 0x895B, 0x89D3, 0x8A40, 0x8AA5, 0x8B05, 0x8B68, 0x8C60, 0x8CCF, 0x8D7C, 0x8E11, 0x8EA0, 0x8F06, 0x8F6A, 0x9056, 0x90FA, 
-    0x9193, 0x9207, 0x9267, 0x92CB, 0x932B, 0x938D, 0x93F0, 0x9451, 0x958D, 0x961B, 0x96BA, 0x9749, 0x97C6, 0x9830, 0x98BD, 0x992B, 
-    0x99BB, 0x9A1B, 0x9AAF, 0x9B2D, 0x9B9D, 0x9BFD, 0x9C5D, 0x9D04, 0x9D64, 0x9DC4, 0x9E3B, 0x9ED9, 0x9F5B, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E65, 0x4FE0, 0x50E2, 0x5221, 0x534B, 0x54F9, 0x563C, 0x5746, 0x5868, 0x5972, 0x5A8C, 0x5B90, 0x5CDB, 0x5DC4, 0x5EF1, 0x6047, 
-    0x6174, 0x628C, 0x63F5, 0x6502, 0x6629, 0x673E, 0x6891, 0x6996, 0x6A85, 0x6B5C, 0x6C9A, 0x6E02, 0x6F1B, 0x700A, 0x710D, 0x71FD, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255E, 0x309C, 0x7319, 0x739D, 0x7424, 0x74AA, 0x7523, 0x75D3, 0x7670, 
-    0x7700, 0x7793, 0x7828, 0x78BD, 0x7932, 0x79B8, 0x7A4A, 0x7ACD, 0x7B68, 0x7BF5, 0x7C66, 0x7CF1, 0x7D59, 0x7DBD, 0x7E1D, 0x7E80, 
-    0x7F88, 0x8023, 0x80CB, 0x8177, 0x8203, 0x82BA, 0x8383, 0x8423, 0x84AA, 0x852E, 0x85AD, 0x8620, 0x86A5, 0x874F, 0x87D7, 0x884E, 
-    0x88DD, 0x895C, 0x89D4, 0x8A41, 0x8AA6, 0x8B06, 0x8B69, 0x8C63, 0x8CD0, 0x8D7D, 0x8E12, 0x8EA1, 0x8F07, 0x8F80, 0x9059, 0x90FB, 
-    0x9194, 0x9208, 0x9268, 0x92CC, 0x932C, 0x938E, 0x93F1, 0x9452, 0x958E, 0x961E, 0x96BB, 0x974A, 0x97C7, 0x9831, 0x98BE, 0x992C, 
-    0x99BC, 0x9A1C, 0x9AB2, 0x9B2E, 0x9B9E, 0x9BFE, 0x9C5E, 0x9D05, 0x9D65, 0x9DC5, 0x9E3C, 0x9EDA, 0x9F5C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E67, 0x4FE2, 0x50E3, 0x5222, 0x534C, 0x54FB, 0x563D, 0x5748, 0x5869, 0x5975, 0x5A8D, 0x5B91, 0x5CDC, 0x5DC6, 0x5EF2, 0x6048, 
-    0x6176, 0x628D, 0x63F7, 0x6503, 0x662A, 0x673F, 0x6892, 0x6997, 0x6A86, 0x6B5D, 0x6C9C, 0x6E03, 0x6F1C, 0x700B, 0x710E, 0x71FE, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x255F, 0x30FD, 0x731A, 0x739E, 0x7427, 0x74AB, 0x7524, 0x75D7, 0x7671, 
-    0x7702, 0x7794, 0x782A, 0x78BF, 0x7933, 0x79BC, 0x7A4B, 0x7ACE, 0x7B69, 0x7BF6, 0x7C67, 0x7CF2, 0x7D5A, 0x7DBE, 0x7E1E, 0x7E81, 
-    0x7F89, 0x8024, 0x80CF, 0x8178, 0x8207, 0x82BB, 0x8384, 0x8429, 0x84AB, 0x852F, 0x85B1, 0x8621, 0x86A6, 0x8750, 0x87D8, 0x884F, 
-    0x88DE, 0x895D, 0x89D5, 0x8A42, 0x8AA7, 0x8B08, 0x8B6A, 0x8C64, 0x8CD1, 0x8D7E, 0x8E13, 0x8EA2, 0x8F08, 0x8F8C, 0x905A, 0x90FC, 
-    0x9195, 0x9209, 0x9269, 0x92CD, 0x932D, 0x9390, 0x93F2, 0x9453, 0x958F, 0x9620, 0x96BF, 0x974B, 0x97C8, 0x9832, 0x98BF, 0x992D, 
-    0x99BD, 0x9A1D, 0x9AB3, 0x9B30, 0x9B9F, 0x9BFF, 0x9C5F, 0x9D06, 0x9D66, 0x9DC6, 0x9E40, 0x9EDE, 0x9F5D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E68, 0x4FE4, 0x50E4, 0x5223, 0x534D, 0x54FE, 0x563E, 0x5749, 0x586A, 0x5977, 0x5A8E, 0x5B92, 0x5CDD, 0x5DC7, 0x5EF3, 0x6049, 
-    0x6178, 0x628E, 0x63F9, 0x6504, 0x662B, 0x6741, 0x6894, 0x6999, 0x6A87, 0x6B5E, 0x6C9D, 0x6E04, 0x6F1D, 0x700C, 0x710F, 0x71FF, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2560, 0x30FE, 0x731F, 0x73A0, 0x7429, 0x74AC, 0x7526, 0x75D9, 0x7672, 
-    0x7703, 0x7795, 0x782B, 0x78C0, 0x7935, 0x79BF, 0x7A4C, 0x7ACF, 0x7B6A, 0x7BF8, 0x7C68, 0x7CF3, 0x7D5B, 0x7DBF, 0x7E1F, 0x7E83, 
-    0x7F8B, 0x802B, 0x80D0, 0x8181, 0x8208, 0x82BC, 0x8387, 0x842A, 0x84AC, 0x8530, 0x85B2, 0x8622, 0x86AB, 0x8751, 0x87D9, 0x8850, 
-    0x88E0, 0x8960, 0x89D7, 0x8A43, 0x8AA8, 0x8B09, 0x8B6B, 0x8C65, 0x8CD2, 0x8D7F, 0x8E15, 0x8EA3, 0x8F09, 0x8F92, 0x905C, 0x90FF, 
-    0x9196, 0x920A, 0x926A, 0x92CE, 0x932E, 0x9391, 0x93F3, 0x9454, 0x9590, 0x9623, 0x96C2, 0x974C, 0x97C9, 0x9833, 0x98C0, 0x992F, 
-    0x99BE, 0x9A1E, 0x9AB4, 0x9B31, 0x9BA0, 0x9C00, 0x9C60, 0x9D07, 0x9D67, 0x9DC7, 0x9E4D, 0x9EE1, 0x9F5E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6A, 0x4FE5, 0x50E5, 0x5225, 0x5350, 0x5500, 0x5640, 0x574B, 0x586D, 0x597A, 0x5A8F, 0x5B94, 0x5CDE, 0x5DC8, 0x5EF5, 0x604A, 
-    0x6179, 0x628F, 0x63FA, 0x6505, 0x662C, 0x6744, 0x6895, 0x699A, 0x6A88, 0x6B5F, 0x6C9E, 0x6E06, 0x6F1E, 0x700D, 0x7111, 0x7200, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2561, 0x3006, 0x7320, 0x73A1, 0x742B, 0x74AD, 0x7527, 0x75DA, 0x7673, 
-    0x7705, 0x7796, 0x782E, 0x78C2, 0x7936, 0x79C2, 0x7A4D, 0x7AD0, 0x7B6B, 0x7BF9, 0x7C69, 0x7CF4, 0x7D5C, 0x7DC0, 0x7E20, 0x7E84, 
-    0x7F8D, 0x802C, 0x80D1, 0x8183, 0x8209, 0x82BF, 0x8388, 0x842B, 0x84AD, 0x8531, 0x85B3, 0x8623, 0x86AD, 0x8752, 0x87DA, 0x8851, 
-    0x88E1, 0x8961, 0x89D8, 0x8A44, 0x8AA9, 0x8B0A, 0x8B6D, 0x8C66, 0x8CD3, 0x8D80, 0x8E16, 0x8EA4, 0x8F0A, 0x8F9D, 0x905D, 0x9100, 
-    0x9197, 0x920B, 0x926B, 0x92CF, 0x932F, 0x9392, 0x93F4, 0x9455, 0x9591, 0x9624, 0x96C3, 0x974D, 0x97CA, 0x9834, 0x98C1, 0x9930, 
-    0x99BF, 0x9A1F, 0x9AB5, 0x9B33, 0x9BA1, 0x9C01, 0x9C61, 0x9D08, 0x9D68, 0x9DC8, 0x9E50, 0x9EE3, 0x9F5F, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6B, 0x4FE7, 0x50E8, 0x5226, 0x5354, 0x5502, 0x5641, 0x5752, 0x586E, 0x597B, 0x5A90, 0x5B96, 0x5CDF, 0x5DC9, 0x5EF8, 0x604C, 
-    0x617A, 0x6290, 0x63FB, 0x6506, 0x662E, 0x6745, 0x6896, 0x699D, 0x6A89, 0x6B60, 0x6CA0, 0x6E07, 0x6F1F, 0x700E, 0x7112, 0x7201, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2562, 0x309D, 0x7323, 0x73A3, 0x742D, 0x74AE, 0x752A, 0x75DC, 0x7674, 
-    0x7706, 0x7797, 0x782F, 0x78C3, 0x7937, 0x79C4, 0x7A4E, 0x7AD1, 0x7B6C, 0x7BFA, 0x7C6A, 0x7CF5, 0x7D5D, 0x7DC1, 0x7E21, 0x7E85, 
-    0x7F8F, 0x802D, 0x80D2, 0x8184, 0x820A, 0x82C0, 0x838A, 0x842C, 0x84AE, 0x8532, 0x85B4, 0x8624, 0x86AE, 0x8754, 0x87DC, 0x8852, 
-    0x88E6, 0x8962, 0x89D9, 0x8A45, 0x8AAA, 0x8B0B, 0x8B6E, 0x8C67, 0x8CD4, 0x8D82, 0x8E17, 0x8EA5, 0x8F0B, 0x8FA0, 0x905E, 0x9101, 
-    0x9198, 0x920C, 0x926C, 0x92D0, 0x9330, 0x9393, 0x93F5, 0x9456, 0x9592, 0x9625, 0x96C8, 0x974E, 0x97CB, 0x9835, 0x98C2, 0x9931, 
-    0x99C0, 0x9A20, 0x9AB9, 0x9B34, 0x9BA2, 0x9C02, 0x9C62, 0x9D09, 0x9D69, 0x9DC9, 0x9E52, 0x9EE4, 0x9F60, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6C, 0x4FEB, 0x50E9, 0x5227, 0x5358, 0x5503, 0x5642, 0x5753, 0x586F, 0x597C, 0x5A91, 0x5B9F, 0x5CE0, 0x5DCA, 0x5EF9, 0x604E, 
-    0x617B, 0x6294, 0x63FC, 0x6507, 0x6630, 0x6747, 0x6898, 0x699E, 0x6A8A, 0x6B61, 0x6CA2, 0x6E08, 0x6F21, 0x700F, 0x7114, 0x7202, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2563, 0x309E, 0x7324, 0x73A4, 0x742F, 0x74AF, 0x752E, 0x75DD, 0x7675, 
-    0x770A, 0x7798, 0x7831, 0x78C4, 0x7938, 0x79C5, 0x7A4F, 0x7AD2, 0x7B6D, 0x7BFB, 0x7C6B, 0x7CF6, 0x7D5E, 0x7DC2, 0x7E22, 0x7E86, 
-    0x7F90, 0x802E, 0x80D3, 0x8185, 0x820B, 0x82C2, 0x838B, 0x842D, 0x84B0, 0x8533, 0x85B5, 0x8625, 0x86B2, 0x8755, 0x87DD, 0x8853, 
-    0x88E7, 0x8963, 0x89DB, 0x8A46, 0x8AAB, 0x8B0C, 0x8B6F, 0x8C68, 0x8CD5, 0x8D83, 0x8E18, 0x8EA6, 0x8F0C, 0x8FA1, 0x905F, 0x9103, 
-    0x9199, 0x920D, 0x926D, 0x92D1, 0x9331, 0x9394, 0x93F6, 0x9457, 0x9593, 0x9626, 0x96CA, 0x974F, 0x97CC, 0x9836, 0x98C3, 0x9932, 
-    0x99C1, 0x9A21, 0x9ABB, 0x9B35, 0x9BA3, 0x9C03, 0x9C63, 0x9D0A, 0x9D6A, 0x9DCA, 0x9E53, 0x9EE6, 0x9F61, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6D, 0x4FEC, 0x50EA, 0x522A, 0x5359, 0x5504, 0x5643, 0x5754, 0x5870, 0x597E, 0x5A93, 0x5BA7, 0x5CE2, 0x5DCB, 0x5EFB, 0x604F, 
-    0x617C, 0x6299, 0x63FE, 0x6508, 0x6632, 0x674A, 0x6899, 0x699F, 0x6A8B, 0x6B68, 0x6CA8, 0x6E09, 0x6F22, 0x7010, 0x7117, 0x7203, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2564, 0xFE49, 0x7326, 0x73A5, 0x7431, 0x74B0, 0x7534, 0x75DF, 0x7676, 
-    0x770C, 0x7799, 0x7832, 0x78C6, 0x7939, 0x79C7, 0x7A50, 0x7AD3, 0x7B6F, 0x7BFD, 0x7C6C, 0x7CF7, 0x7D5F, 0x7DC3, 0x7E23, 0x7E87, 
-    0x7F91, 0x802F, 0x80D4, 0x8186, 0x820E, 0x82C3, 0x838C, 0x842E, 0x84B1, 0x8534, 0x85B6, 0x8626, 0x86B3, 0x8756, 0x87DE, 0x8855, 
-    0x88E9, 0x8964, 0x89DD, 0x8A47, 0x8AAC, 0x8B0D, 0x8B70, 0x8C69, 0x8CD6, 0x8D86, 0x8E19, 0x8EA7, 0x8F0D, 0x8FA2, 0x9060, 0x9105, 
-    0x919C, 0x920E, 0x926E, 0x92D2, 0x9332, 0x9395, 0x93F7, 0x9458, 0x9594, 0x9627, 0x96CB, 0x9750, 0x97CD, 0x9837, 0x98C4, 0x9933, 
-    0x99C2, 0x9A22, 0x9ABD, 0x9B36, 0x9BA4, 0x9C04, 0x9C64, 0x9D0B, 0x9D6B, 0x9DCB, 0x9E54, 0x9EE8, 0x9F62, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6E, 0x4FF0, 0x50EB, 0x522C, 0x535B, 0x5505, 0x5644, 0x5755, 0x5871, 0x597F, 0x5A94, 0x5BA8, 0x5CE3, 0x5DCC, 0x5EFC, 0x6051, 
-    0x617D, 0x629C, 0x6403, 0x650A, 0x6633, 0x674B, 0x689A, 0x69A0, 0x6A8C, 0x6B69, 0x6CAC, 0x6E0B, 0x6F23, 0x7012, 0x711B, 0x7204, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2565, 0xFE4A, 0x7327, 0x73A6, 0x7432, 0x74B1, 0x7536, 0x75E0, 0x7677, 
-    0x770E, 0x779A, 0x7833, 0x78C7, 0x793D, 0x79C8, 0x7A52, 0x7AD4, 0x7B70, 0x7BFF, 0x7C6D, 0x7CF9, 0x7D60, 0x7DC4, 0x7E24, 0x7E88, 
-    0x7F92, 0x8030, 0x80D5, 0x8187, 0x820F, 0x82C5, 0x838D, 0x842F, 0x84B3, 0x8535, 0x85B8, 0x8628, 0x86B7, 0x8758, 0x87DF, 0x8856, 
-    0x88EA, 0x8965, 0x89DF, 0x8A49, 0x8AAD, 0x8B0E, 0x8B71, 0x8C6C, 0x8CD7, 0x8D87, 0x8E1A, 0x8EA8, 0x8F0E, 0x8FA4, 0x9061, 0x9106, 
-    0x919D, 0x920F, 0x926F, 0x92D3, 0x9333, 0x9396, 0x93F8, 0x9459, 0x9595, 0x9628, 0x96D0, 0x9751, 0x97CE, 0x9838, 0x98C5, 0x9934, 
-    0x99C3, 0x9A23, 0x9ABE, 0x9B37, 0x9BA5, 0x9C05, 0x9C65, 0x9D0C, 0x9D6C, 0x9DCC, 0x9E56, 0x9EEB, 0x9F63, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E6F, 0x4FF2, 0x50EF, 0x522F, 0x535D, 0x5508, 0x5645, 0x5756, 0x5872, 0x5980, 0x5A95, 0x5BA9, 0x5CE7, 0x5DCE, 0x5EFD, 0x6053, 
-    0x617E, 0x629D, 0x6404, 0x650B, 0x6637, 0x674D, 0x689B, 0x69A1, 0x6A8D, 0x6B6B, 0x6CAF, 0x6E0F, 0x6F25, 0x7013, 0x711C, 0x7205, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2566, 0xFE4B, 0x7328, 0x73A7, 0x7437, 0x74B2, 0x7539, 0x75E1, 0x7679, 
-    0x770F, 0x779B, 0x7835, 0x78C8, 0x793F, 0x79CA, 0x7A53, 0x7AD5, 0x7B73, 0x7C00, 0x7C6E, 0x7CFA, 0x7D61, 0x7DC5, 0x7E25, 0x7E89, 
-    0x7F93, 0x8032, 0x80D8, 0x8189, 0x8211, 0x82C6, 0x838F, 0x8430, 0x84B5, 0x8536, 0x85BA, 0x862A, 0x86B8, 0x875A, 0x87E1, 0x8858, 
-    0x88EB, 0x8967, 0x89E0, 0x8A4A, 0x8AAE, 0x8B0F, 0x8B72, 0x8C6D, 0x8CD8, 0x8D88, 0x8E1B, 0x8EA9, 0x8F0F, 0x8FA5, 0x9064, 0x9107, 
-    0x919E, 0x9210, 0x9270, 0x92D4, 0x9334, 0x9397, 0x93F9, 0x945A, 0x9596, 0x9629, 0x96D1, 0x9754, 0x97CF, 0x9839, 0x98C6, 0x9935, 
-    0x99C4, 0x9A24, 0x9ABF, 0x9B38, 0x9BA6, 0x9C06, 0x9C66, 0x9D0D, 0x9D6D, 0x9DCD, 0x9E59, 0x9EEC, 0x9F64, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E72, 0x4FF4, 0x50F0, 0x5231, 0x5365, 0x550A, 0x5646, 0x5758, 0x5873, 0x5985, 0x5A96, 0x5BAC, 0x5CE9, 0x5DCF, 0x5F05, 0x6054, 
-    0x617F, 0x629E, 0x6406, 0x650C, 0x6638, 0x6752, 0x689C, 0x69A2, 0x6A8F, 0x6B6C, 0x6CB0, 0x6E12, 0x6F26, 0x7014, 0x711D, 0x7207, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2567, 0xFE4C, 0x732D, 0x73A8, 0x7438, 0x74B3, 0x753C, 0x75E5, 0x767A, 
-    0x7710, 0x779C, 0x7836, 0x78CC, 0x7942, 0x79CC, 0x7A54, 0x7AD7, 0x7B74, 0x7C01, 0x7C6F, 0x7CFC, 0x7D62, 0x7DC6, 0x7E26, 0x7E8A, 
-    0x7F95, 0x8034, 0x80DF, 0x818B, 0x8213, 0x82C9, 0x8390, 0x8432, 0x84B6, 0x853E, 0x85BB, 0x862B, 0x86B9, 0x875B, 0x87E2, 0x885A, 
-    0x88EC, 0x8968, 0x89E1, 0x8A4B, 0x8AAF, 0x8B10, 0x8B73, 0x8C6E, 0x8CD9, 0x8D89, 0x8E1C, 0x8EAA, 0x8F10, 0x8FA6, 0x9066, 0x9108, 
-    0x919F, 0x9211, 0x9271, 0x92D5, 0x9335, 0x9398, 0x93FA, 0x945B, 0x9597, 0x962B, 0x96D3, 0x9755, 0x97D0, 0x983A, 0x98C7, 0x9936, 
-    0x99C5, 0x9A25, 0x9AC3, 0x9B39, 0x9BA7, 0x9C07, 0x9C67, 0x9D0E, 0x9D6E, 0x9DCE, 0x9E5D, 0x9EED, 0x9F65, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E74, 0x4FF5, 0x50F1, 0x5232, 0x5368, 0x550B, 0x5647, 0x5759, 0x5874, 0x5989, 0x5A97, 0x5BAD, 0x5CEB, 0x5DD0, 0x5F06, 0x6056, 
-    0x6180, 0x62A3, 0x6407, 0x650D, 0x6639, 0x6754, 0x689D, 0x69A3, 0x6A92, 0x6B6D, 0x6CB4, 0x6E13, 0x6F27, 0x7015, 0x711E, 0x7208, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2568, 0xFE4D, 0x732F, 0x73AA, 0x7439, 0x74B4, 0x753D, 0x75E9, 0x767C, 
-    0x7711, 0x779D, 0x783D, 0x78CD, 0x7943, 0x79CE, 0x7A55, 0x7AD8, 0x7B76, 0x7C02, 0x7C70, 0x7CFD, 0x7D63, 0x7DC7, 0x7E27, 0x7E8B, 
-    0x7F96, 0x8039, 0x80E0, 0x818C, 0x8215, 0x82D0, 0x8391, 0x8433, 0x84B7, 0x853F, 0x85BC, 0x862C, 0x86BB, 0x875C, 0x87E3, 0x885B, 
-    0x88ED, 0x8969, 0x89E2, 0x8A4C, 0x8AB0, 0x8B11, 0x8B74, 0x8C6F, 0x8CDA, 0x8D8C, 0x8E20, 0x8EAD, 0x8F11, 0x8FA7, 0x9067, 0x9109, 
-    0x91A0, 0x9212, 0x9272, 0x92D6, 0x9336, 0x9399, 0x93FB, 0x945C, 0x9598, 0x962C, 0x96D4, 0x9757, 0x97D1, 0x983B, 0x98C8, 0x9937, 
-    0x99C6, 0x9A26, 0x9AC4, 0x9B3A, 0x9BA8, 0x9C08, 0x9C68, 0x9D0F, 0x9D6F, 0x9DCF, 0x9E5F, 0x9EEE, 0x9F66, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E75, 0x4FF6, 0x50F2, 0x5234, 0x536A, 0x550C, 0x5648, 0x5762, 0x5875, 0x598B, 0x5A98, 0x5BAE, 0x5CEC, 0x5DD1, 0x5F07, 0x6057, 
-    0x6181, 0x62A6, 0x6408, 0x650E, 0x663A, 0x6755, 0x689E, 0x69A4, 0x6A93, 0x6B6E, 0x6CB5, 0x6E15, 0x6F28, 0x7016, 0x711F, 0x7209, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2569, 0xFE4E, 0x7330, 0x73AC, 0x743A, 0x74B5, 0x753F, 0x75EC, 0x767F, 
-    0x7712, 0x779E, 0x783F, 0x78CE, 0x7944, 0x79CF, 0x7A56, 0x7ADA, 0x7B78, 0x7C03, 0x7C71, 0x7CFE, 0x7D64, 0x7DC8, 0x7E28, 0x7E8C, 
-    0x7F97, 0x803A, 0x80E2, 0x818D, 0x8216, 0x82D6, 0x8394, 0x8434, 0x84BB, 0x8540, 0x85BD, 0x862D, 0x86BC, 0x875D, 0x87E4, 0x885C, 
-    0x88EE, 0x896A, 0x89E4, 0x8A4D, 0x8AB1, 0x8B12, 0x8B75, 0x8C70, 0x8CDB, 0x8D8D, 0x8E21, 0x8EAE, 0x8F12, 0x8FAA, 0x9069, 0x910A, 
-    0x91A1, 0x9213, 0x9273, 0x92D7, 0x9337, 0x939A, 0x93FC, 0x945D, 0x9599, 0x962D, 0x96D6, 0x9758, 0x97D2, 0x983C, 0x98C9, 0x9938, 
-    0x99C7, 0x9A27, 0x9AC6, 0x9B3D, 0x9BA9, 0x9C09, 0x9C69, 0x9D10, 0x9D70, 0x9DD0, 0x9E60, 0x9EF0, 0x9F67, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E76, 0x4FF7, 0x50F4, 0x5235, 0x536C, 0x550D, 0x5649, 0x5763, 0x5876, 0x598C, 0x5A99, 0x5BAF, 0x5CEE, 0x5DD2, 0x5F09, 0x6058, 
-    0x6182, 0x62A7, 0x6409, 0x650F, 0x663B, 0x6757, 0x689F, 0x69A5, 0x6A94, 0x6B6F, 0x6CB6, 0x6E18, 0x6F2C, 0x7017, 0x7120, 0x720A, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256A, 0xFE4F, 0x7332, 0x73AD, 0x743B, 0x74B6, 0x7541, 0x75ED, 0x7680, 
-    0x7713, 0x77A1, 0x7841, 0x78CF, 0x7945, 0x79D0, 0x7A58, 0x7ADB, 0x7B7A, 0x7C04, 0x7C72, 0x7CFF, 0x7D65, 0x7DC9, 0x7E29, 0x7E8D, 
-    0x7F98, 0x803C, 0x80E3, 0x818E, 0x8217, 0x82D9, 0x8395, 0x8435, 0x84BC, 0x8541, 0x85BE, 0x862E, 0x86BD, 0x875E, 0x87E6, 0x885D, 
-    0x88EF, 0x896B, 0x89E7, 0x8A4E, 0x8AB2, 0x8B13, 0x8B76, 0x8C71, 0x8CDC, 0x8D8E, 0x8E24, 0x8EB0, 0x8F13, 0x8FAC, 0x906A, 0x910B, 
-    0x91A4, 0x9214, 0x9275, 0x92D8, 0x9338, 0x939B, 0x93FD, 0x945E, 0x959A, 0x962F, 0x96D7, 0x975A, 0x97D3, 0x983D, 0x98CA, 0x9939, 
-    0x99C8, 0x9A28, 0x9AC7, 0x9B3E, 0x9BAA, 0x9C0A, 0x9C6A, 0x9D11, 0x9D71, 0x9DD1, 0x9E61, 0x9EF1, 0x9F68, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E77, 0x4FF9, 0x50F6, 0x523C, 0x536D, 0x550E, 0x564A, 0x5765, 0x5877, 0x598E, 0x5A9C, 0x5BB1, 0x5CEF, 0x5DD3, 0x5F0C, 0x605B, 
-    0x6183, 0x62A9, 0x640A, 0x6510, 0x663D, 0x6758, 0x68A0, 0x69A6, 0x6A95, 0x6B70, 0x6CB7, 0x6E19, 0x6F2E, 0x7018, 0x7121, 0x720B, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256B, 0xFE50, 0x7333, 0x73B1, 0x743D, 0x74B7, 0x7542, 0x75EE, 0x7681, 
-    0x7714, 0x77A3, 0x7842, 0x78D1, 0x7947, 0x79D3, 0x7A59, 0x7ADC, 0x7B7C, 0x7C05, 0x7C75, 0x7D00, 0x7D66, 0x7DCA, 0x7E2A, 0x7E8E, 
-    0x7F99, 0x803E, 0x80E6, 0x8190, 0x8218, 0x82DA, 0x8396, 0x8436, 0x84BE, 0x8542, 0x85BF, 0x862F, 0x86BE, 0x875F, 0x87E7, 0x885E, 
-    0x88F2, 0x896C, 0x89E8, 0x8A4F, 0x8AB3, 0x8B14, 0x8B77, 0x8C72, 0x8CDD, 0x8D8F, 0x8E25, 0x8EB1, 0x8F14, 0x8FAD, 0x906B, 0x910C, 
-    0x91A5, 0x9215, 0x9276, 0x92D9, 0x9339, 0x939C, 0x93FE, 0x945F, 0x959B, 0x9630, 0x96D8, 0x975C, 0x97D4, 0x983E, 0x98CB, 0x993A, 
-    0x99C9, 0x9A29, 0x9AC8, 0x9B3F, 0x9BAB, 0x9C0B, 0x9C6B, 0x9D12, 0x9D72, 0x9DD2, 0x9E62, 0x9EF2, 0x9F69, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E78, 0x4FFB, 0x50F7, 0x523E, 0x5372, 0x5512, 0x564B, 0x5767, 0x5878, 0x598F, 0x5A9D, 0x5BB2, 0x5CF1, 0x5DD4, 0x5F0D, 0x605C, 
-    0x6184, 0x62AA, 0x640D, 0x6511, 0x663F, 0x6759, 0x68A1, 0x69A9, 0x6A96, 0x6B71, 0x6CBA, 0x6E1B, 0x6F30, 0x7019, 0x7122, 0x720C, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256C, 0xFE51, 0x7335, 0x73B4, 0x743E, 0x74B8, 0x7543, 0x75EF, 0x7683, 
-    0x7715, 0x77A4, 0x7843, 0x78D2, 0x794A, 0x79D4, 0x7A5A, 0x7ADD, 0x7B7D, 0x7C06, 0x7C76, 0x7D01, 0x7D67, 0x7DCB, 0x7E2B, 0x7E8F, 
-    0x7F9B, 0x8040, 0x80EE, 0x8192, 0x8219, 0x82DD, 0x8397, 0x8437, 0x84C0, 0x8544, 0x85C0, 0x8630, 0x86BF, 0x8761, 0x87E8, 0x885F, 
-    0x88F5, 0x896D, 0x89E9, 0x8A50, 0x8AB4, 0x8B15, 0x8B78, 0x8C74, 0x8CDE, 0x8D90, 0x8E26, 0x8EB3, 0x8F15, 0x8FAE, 0x906C, 0x910D, 
-    0x91A6, 0x9216, 0x9277, 0x92DA, 0x933A, 0x939D, 0x93FF, 0x9460, 0x959C, 0x9637, 0x96D9, 0x975D, 0x97D5, 0x983F, 0x98CC, 0x993B, 
-    0x99CA, 0x9A2A, 0x9AC9, 0x9B40, 0x9BAC, 0x9C0C, 0x9C6C, 0x9D13, 0x9D73, 0x9DD3, 0x9E65, 0x9EF3, 0x9F6A, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E79, 0x4FFC, 0x50F8, 0x5244, 0x5376, 0x5513, 0x564F, 0x576C, 0x5879, 0x5990, 0x5A9E, 0x5BB7, 0x5CF2, 0x5DD5, 0x5F0E, 0x605E, 
-    0x6185, 0x62AD, 0x640E, 0x6513, 0x6640, 0x675A, 0x68A3, 0x69AA, 0x6A98, 0x6B72, 0x6CC0, 0x6E1C, 0x6F32, 0x701C, 0x7123, 0x720D, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256D, 0xFE52, 0x7336, 0x73B5, 0x743F, 0x74B9, 0x7544, 0x75F2, 0x7685, 
-    0x7716, 0x77A6, 0x7844, 0x78D3, 0x794B, 0x79D6, 0x7A5B, 0x7AE1, 0x7B7F, 0x7C08, 0x7C77, 0x7D02, 0x7D68, 0x7DCC, 0x7E2C, 0x7E90, 
-    0x7F9C, 0x8041, 0x80F5, 0x8193, 0x821A, 0x82E2, 0x8399, 0x8439, 0x84C2, 0x8545, 0x85C2, 0x8631, 0x86C1, 0x8762, 0x87E9, 0x8860, 
-    0x88F6, 0x896E, 0x89EA, 0x8A51, 0x8AB5, 0x8B16, 0x8B79, 0x8C75, 0x8CDF, 0x8D92, 0x8E27, 0x8EB4, 0x8F16, 0x8FAF, 0x906F, 0x910E, 
-    0x91A7, 0x9217, 0x9278, 0x92DB, 0x933B, 0x939E, 0x9400, 0x9461, 0x959D, 0x9638, 0x96DA, 0x975F, 0x97D6, 0x9840, 0x98CD, 0x993C, 
-    0x99CB, 0x9A2B, 0x9ACA, 0x9B46, 0x9BAD, 0x9C0D, 0x9C6D, 0x9D14, 0x9D74, 0x9DD4, 0x9E6E, 0x9EF4, 0x9F6B, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E7A, 0x4FFD, 0x50F9, 0x5245, 0x5379, 0x5515, 0x5650, 0x576E, 0x587A, 0x5991, 0x5A9F, 0x5BBA, 0x5CF3, 0x5DD6, 0x5F10, 0x605F, 
-    0x6186, 0x62AE, 0x6411, 0x6514, 0x6642, 0x675B, 0x68A4, 0x69AC, 0x6A99, 0x6B73, 0x6CC1, 0x6E1E, 0x6F34, 0x701D, 0x7124, 0x720E, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256E, 0xFE54, 0x733A, 0x73B6, 0x7440, 0x74BB, 0x7546, 0x75F3, 0x7689, 
-    0x7717, 0x77A8, 0x7846, 0x78D6, 0x794C, 0x79D7, 0x7A5C, 0x7AE2, 0x7B81, 0x7C09, 0x7C78, 0x7D03, 0x7D69, 0x7DCD, 0x7E2D, 0x7E91, 
-    0x7FA0, 0x8044, 0x80F7, 0x8194, 0x821D, 0x82E7, 0x839A, 0x843A, 0x84C3, 0x8546, 0x85C3, 0x8632, 0x86C2, 0x8766, 0x87EB, 0x8866, 
-    0x88F7, 0x896F, 0x89EC, 0x8A52, 0x8AB6, 0x8B17, 0x8B7A, 0x8C76, 0x8CE0, 0x8D93, 0x8E28, 0x8EB5, 0x8F17, 0x8FB2, 0x9070, 0x910F, 
-    0x91A8, 0x9218, 0x9279, 0x92DC, 0x933C, 0x939F, 0x9401, 0x9462, 0x959E, 0x9639, 0x96DB, 0x9763, 0x97D7, 0x9841, 0x98CF, 0x993D, 
-    0x99CC, 0x9A2C, 0x9ACD, 0x9B4A, 0x9BAE, 0x9C0E, 0x9C6E, 0x9D15, 0x9D75, 0x9DD5, 0x9E6F, 0x9EF5, 0x9F6C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E7B, 0x4FFF, 0x50FA, 0x5246, 0x537B, 0x5516, 0x5651, 0x5770, 0x587B, 0x5994, 0x5AA0, 0x5BBB, 0x5CF4, 0x5DD7, 0x5F12, 0x6060, 
-    0x6187, 0x62AF, 0x6412, 0x6515, 0x6644, 0x675D, 0x68A5, 0x69AE, 0x6A9A, 0x6B74, 0x6CC2, 0x6E1F, 0x6F35, 0x701E, 0x7125, 0x720F, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x256F, 0xFE55, 0x733B, 0x73B8, 0x7442, 0x74BC, 0x7547, 0x75F5, 0x768A, 
-    0x7718, 0x77AB, 0x7848, 0x78D7, 0x794D, 0x79D9, 0x7A5D, 0x7AE4, 0x7B82, 0x7C0A, 0x7C79, 0x7D04, 0x7D6A, 0x7DCE, 0x7E2E, 0x7E92, 
-    0x7FA2, 0x8045, 0x80F9, 0x8195, 0x8220, 0x82E8, 0x839D, 0x843B, 0x84C5, 0x8547, 0x85C4, 0x8633, 0x86C3, 0x8767, 0x87EC, 0x8867, 
-    0x88FA, 0x8970, 0x89ED, 0x8A53, 0x8AB7, 0x8B18, 0x8B7B, 0x8C77, 0x8CE1, 0x8D95, 0x8E2B, 0x8EB6, 0x8F18, 0x8FB3, 0x9071, 0x9110, 
-    0x91A9, 0x9219, 0x927A, 0x92DD, 0x933D, 0x93A0, 0x9402, 0x9463, 0x959F, 0x963A, 0x96DC, 0x9764, 0x97D8, 0x9842, 0x98D0, 0x993E, 
-    0x99CD, 0x9A2D, 0x9ACE, 0x9B4B, 0x9BAF, 0x9C0F, 0x9C6F, 0x9D16, 0x9D76, 0x9DD6, 0x9E72, 0x9EF6, 0x9F6D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E7C, 0x5000, 0x50FC, 0x5247, 0x537C, 0x5517, 0x5652, 0x5771, 0x587C, 0x5995, 0x5AA1, 0x5BBC, 0x5CF5, 0x5DD8, 0x5F14, 0x6061, 
-    0x6188, 0x62B0, 0x6415, 0x6516, 0x6645, 0x6762, 0x68A9, 0x69AF, 0x6A9B, 0x6B75, 0x6CC3, 0x6E22, 0x6F37, 0x701F, 0x7127, 0x7210, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2570, 0xFE56, 0x733C, 0x73B9, 0x7443, 0x74BD, 0x7549, 0x75F6, 0x768C, 
-    0x771B, 0x77AD, 0x7849, 0x78D8, 0x794E, 0x79DA, 0x7A5E, 0x7AE7, 0x7B83, 0x7C0D, 0x7C7A, 0x7D05, 0x7D6B, 0x7DCF, 0x7E2F, 0x7E93, 
-    0x7FA3, 0x8047, 0x80FB, 0x8196, 0x8224, 0x82E9, 0x839F, 0x843E, 0x84C6, 0x854B, 0x85C5, 0x8634, 0x86C5, 0x8768, 0x87ED, 0x886A, 
-    0x88FB, 0x8971, 0x89EE, 0x8A54, 0x8AB8, 0x8B19, 0x8B7C, 0x8C7B, 0x8CE2, 0x8D96, 0x8E2D, 0x8EB7, 0x8F19, 0x8FB4, 0x9072, 0x9111, 
-    0x91AB, 0x921A, 0x927B, 0x92DE, 0x933F, 0x93A1, 0x9403, 0x9464, 0x95A0, 0x963E, 0x96DD, 0x9766, 0x97D9, 0x9843, 0x98D4, 0x993F, 
-    0x99CE, 0x9A2E, 0x9ACF, 0x9B4C, 0x9BB0, 0x9C10, 0x9C70, 0x9D17, 0x9D77, 0x9DD7, 0x9E74, 0x9EF7, 0x9F6E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E7D, 0x5001, 0x50FD, 0x5248, 0x537D, 0x5518, 0x5653, 0x5772, 0x587D, 0x5998, 0x5AA2, 0x5BC0, 0x5CF6, 0x5DD9, 0x5F16, 0x6065, 
-    0x6189, 0x62B2, 0x6416, 0x6517, 0x6646, 0x6763, 0x68AA, 0x69B0, 0x6A9C, 0x6B76, 0x6CC6, 0x6E26, 0x6F38, 0x7020, 0x7128, 0x7211, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2571, 0xFE57, 0x733D, 0x73BC, 0x7444, 0x74BE, 0x754A, 0x75F7, 0x768D, 
-    0x771C, 0x77AE, 0x784A, 0x78DA, 0x794F, 0x79DB, 0x7A5F, 0x7AE8, 0x7B84, 0x7C0E, 0x7C7E, 0x7D06, 0x7D6C, 0x7DD0, 0x7E30, 0x7E94, 
-    0x7FA5, 0x8048, 0x80FE, 0x8197, 0x8225, 0x82EA, 0x83A1, 0x843F, 0x84C7, 0x854C, 0x85C6, 0x8635, 0x86C8, 0x8769, 0x87EF, 0x886D, 
-    0x88FD, 0x8972, 0x89F0, 0x8A55, 0x8AB9, 0x8B1A, 0x8B7D, 0x8C7C, 0x8CE3, 0x8D97, 0x8E30, 0x8EB8, 0x8F1A, 0x8FB5, 0x9073, 0x9112, 
-    0x91AC, 0x921B, 0x927C, 0x92DF, 0x9340, 0x93A2, 0x9404, 0x9465, 0x95A1, 0x9641, 0x96DE, 0x9767, 0x97DA, 0x9844, 0x98D6, 0x9940, 
-    0x99CF, 0x9A2F, 0x9AD0, 0x9B4E, 0x9BB1, 0x9C11, 0x9C71, 0x9D18, 0x9D78, 0x9DD8, 0x9E75, 0x9EF8, 0x9F6F, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E7F, 0x5002, 0x50FE, 0x5249, 0x537E, 0x5519, 0x5655, 0x5774, 0x587F, 0x599A, 0x5AA3, 0x5BC1, 0x5CF7, 0x5DDA, 0x5F19, 0x6066, 
-    0x618A, 0x62B3, 0x6417, 0x6519, 0x6647, 0x6764, 0x68AB, 0x69B2, 0x6A9D, 0x6B77, 0x6CC7, 0x6E27, 0x6F39, 0x7021, 0x7129, 0x7212, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2572, 0xFE59, 0x7340, 0x73BD, 0x7445, 0x74BF, 0x754D, 0x75F8, 0x768F, 
-    0x771D, 0x77AF, 0x784B, 0x78DB, 0x7950, 0x79DC, 0x7A60, 0x7AE9, 0x7B86, 0x7C10, 0x7C7F, 0x7D07, 0x7D6D, 0x7DD1, 0x7E31, 0x7E95, 
-    0x7FA6, 0x8049, 0x80FF, 0x8199, 0x8226, 0x82EC, 0x83A2, 0x8440, 0x84C8, 0x854D, 0x85C7, 0x8636, 0x86CC, 0x876A, 0x87F0, 0x886F, 
-    0x88FF, 0x8973, 0x89F1, 0x8A56, 0x8ABA, 0x8B1B, 0x8B7E, 0x8C7D, 0x8CE4, 0x8D98, 0x8E32, 0x8EB9, 0x8F1B, 0x8FB7, 0x9076, 0x9113, 
-    0x91B0, 0x921C, 0x927D, 0x92E0, 0x9341, 0x93A3, 0x9405, 0x9466, 0x95A2, 0x9643, 0x96DF, 0x9768, 0x97DB, 0x9845, 0x98D7, 0x9941, 
-    0x99D0, 0x9A30, 0x9AD2, 0x9B50, 0x9BB2, 0x9C12, 0x9C72, 0x9D19, 0x9D79, 0x9DD9, 0x9E76, 0x9EFA, 0x9F70, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E80, 0x5003, 0x50FF, 0x524B, 0x5380, 0x551A, 0x5656, 0x5775, 0x5882, 0x599B, 0x5AA4, 0x5BC3, 0x5CF8, 0x5DDC, 0x5F1A, 0x606E, 
-    0x618C, 0x62B4, 0x6418, 0x651A, 0x6648, 0x6766, 0x68AC, 0x69B3, 0x6A9E, 0x6B78, 0x6CC8, 0x6E28, 0x6F3A, 0x7022, 0x712A, 0x7213, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2573, 0xFE5A, 0x7341, 0x73BE, 0x7446, 0x74C0, 0x7550, 0x75FA, 0x7690, 
-    0x771E, 0x77B1, 0x784D, 0x78DC, 0x7951, 0x79DD, 0x7A61, 0x7AEA, 0x7B87, 0x7C11, 0x7C80, 0x7D08, 0x7D6F, 0x7DD2, 0x7E32, 0x7E96, 
-    0x7FA8, 0x804E, 0x8100, 0x819A, 0x8227, 0x82ED, 0x83A3, 0x8441, 0x84CB, 0x854E, 0x85C8, 0x8637, 0x86CD, 0x876B, 0x87F1, 0x8871, 
-    0x8900, 0x8974, 0x89F2, 0x8A57, 0x8ABB, 0x8B1C, 0x8B7F, 0x8C7E, 0x8CE5, 0x8D99, 0x8E33, 0x8EBB, 0x8F1C, 0x8FB8, 0x9077, 0x9114, 
-    0x91B1, 0x921D, 0x927E, 0x92E1, 0x9342, 0x93A4, 0x9406, 0x9467, 0x95A3, 0x964A, 0x96E1, 0x976A, 0x97DC, 0x9846, 0x98DB, 0x9942, 
-    0x99D1, 0x9A31, 0x9AD4, 0x9B52, 0x9BB3, 0x9C13, 0x9C73, 0x9D1A, 0x9D7A, 0x9DDA, 0x9E77, 0x9EFD, 0x9F71, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E81, 0x5004, 0x5100, 0x524E, 0x5381, 0x551C, 0x565A, 0x5778, 0x5884, 0x599C, 0x5AA5, 0x5BC8, 0x5CF9, 0x5DDF, 0x5F1C, 0x6071, 
-    0x618D, 0x62B6, 0x6419, 0x651B, 0x6649, 0x6767, 0x68AE, 0x69B5, 0x6A9F, 0x6B7A, 0x6CCB, 0x6E2A, 0x6F3B, 0x7024, 0x712B, 0x7214, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2581, 0xFE5B, 0x7342, 0x73BF, 0x7447, 0x74C1, 0x7551, 0x75FB, 0x7692, 
-    0x7721, 0x77B2, 0x784F, 0x78DD, 0x7952, 0x79DE, 0x7A62, 0x7AEB, 0x7B88, 0x7C12, 0x7C81, 0x7D09, 0x7D70, 0x7DD3, 0x7E33, 0x7E97, 
-    0x7FA9, 0x804F, 0x8101, 0x819E, 0x8229, 0x82EE, 0x83A4, 0x8442, 0x84CC, 0x854F, 0x85CA, 0x8639, 0x86D2, 0x876C, 0x87F2, 0x8873, 
-    0x8901, 0x8975, 0x89F4, 0x8A58, 0x8ABC, 0x8B1D, 0x8B80, 0x8C7F, 0x8CE6, 0x8D9A, 0x8E34, 0x8EBC, 0x8F1D, 0x8FBA, 0x9078, 0x9115, 
-    0x91B2, 0x921E, 0x927F, 0x92E2, 0x9343, 0x93A5, 0x9407, 0x9468, 0x95A4, 0x964E, 0x96E2, 0x976B, 0x97DD, 0x9847, 0x98DC, 0x9943, 
-    0x99D2, 0x9A32, 0x9AD5, 0x9B53, 0x9BB4, 0x9C14, 0x9C74, 0x9D1B, 0x9D7B, 0x9DDB, 0x9E78, 0x9EFF, 0x9F72, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E82, 0x5005, 0x5101, 0x524F, 0x5383, 0x551D, 0x565B, 0x5779, 0x5886, 0x599D, 0x5AA6, 0x5BC9, 0x5CFA, 0x5DE0, 0x5F1D, 0x6072, 
-    0x618F, 0x62B7, 0x641A, 0x651C, 0x664A, 0x676B, 0x68B1, 0x69B6, 0x6AA1, 0x6B7D, 0x6CCD, 0x6E2C, 0x6F3C, 0x7025, 0x712C, 0x7215, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2582, 0xFE5C, 0x7343, 0x73C1, 0x7448, 0x74C2, 0x7552, 0x75FD, 0x7694, 
-    0x7723, 0x77B4, 0x7851, 0x78DE, 0x7954, 0x79E0, 0x7A63, 0x7AEC, 0x7B89, 0x7C13, 0x7C82, 0x7D0B, 0x7D71, 0x7DD4, 0x7E34, 0x7E98, 
-    0x7FAA, 0x8050, 0x8103, 0x819F, 0x822E, 0x82F0, 0x83A5, 0x8443, 0x84CE, 0x8550, 0x85CB, 0x863A, 0x86D3, 0x876D, 0x87F3, 0x8874, 
-    0x8903, 0x8976, 0x89F5, 0x8A59, 0x8ABD, 0x8B1E, 0x8B81, 0x8C80, 0x8CE7, 0x8D9B, 0x8E36, 0x8EBD, 0x8F1E, 0x8FBB, 0x9079, 0x9116, 
-    0x91B3, 0x921F, 0x9280, 0x92E3, 0x9344, 0x93A6, 0x9408, 0x9469, 0x95A5, 0x964F, 0x96E3, 0x976C, 0x97DE, 0x9848, 0x98DD, 0x9944, 
-    0x99D3, 0x9A33, 0x9AD6, 0x9B55, 0x9BB5, 0x9C15, 0x9C75, 0x9D1C, 0x9D7C, 0x9DDC, 0x9E79, 0x9F00, 0x9F73, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E83, 0x5006, 0x5102, 0x5252, 0x5387, 0x551E, 0x565D, 0x577A, 0x5887, 0x599F, 0x5AA7, 0x5BCA, 0x5CFC, 0x5DE3, 0x5F1E, 0x6074, 
-    0x6190, 0x62B8, 0x641D, 0x651D, 0x664D, 0x676C, 0x68B2, 0x69B8, 0x6AA2, 0x6B7E, 0x6CCE, 0x6E2E, 0x6F3D, 0x7026, 0x712D, 0x7216, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2583, 0xFE5D, 0x7344, 0x73C3, 0x7449, 0x74C3, 0x7553, 0x75FE, 0x7695, 
-    0x7724, 0x77B6, 0x7853, 0x78DF, 0x7955, 0x79E1, 0x7A64, 0x7AEE, 0x7B8A, 0x7C14, 0x7C83, 0x7D0C, 0x7D72, 0x7DD5, 0x7E35, 0x7E99, 
-    0x7FAB, 0x8051, 0x8104, 0x81A0, 0x8232, 0x82F2, 0x83A6, 0x8444, 0x84CF, 0x8551, 0x85CC, 0x863B, 0x86D5, 0x876F, 0x87F4, 0x8875, 
-    0x8904, 0x8977, 0x89F6, 0x8A5A, 0x8ABE, 0x8B1F, 0x8B82, 0x8C81, 0x8CE8, 0x8D9C, 0x8E37, 0x8EBE, 0x8F1F, 0x8FBC, 0x907A, 0x9117, 
-    0x91B6, 0x9220, 0x9281, 0x92E4, 0x9345, 0x93A7, 0x9409, 0x946A, 0x95A6, 0x9651, 0x96E4, 0x976D, 0x97DF, 0x9849, 0x98E0, 0x9945, 
-    0x99D4, 0x9A34, 0x9AD7, 0x9B56, 0x9BB6, 0x9C16, 0x9C76, 0x9D1D, 0x9D7D, 0x9DDD, 0x9E7A, 0x9F01, 0x9F74, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E84, 0x5007, 0x5103, 0x5253, 0x5388, 0x551F, 0x565E, 0x577D, 0x5888, 0x59A0, 0x5AA8, 0x5BCB, 0x5CFD, 0x5DE4, 0x5F21, 0x6075, 
-    0x6191, 0x62BA, 0x641F, 0x651E, 0x664E, 0x676E, 0x68B4, 0x69B9, 0x6AA3, 0x6B7F, 0x6CCF, 0x6E30, 0x6F3F, 0x7027, 0x712E, 0x7217, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2584, 0xFE5E, 0x7345, 0x73C4, 0x744A, 0x74C4, 0x7555, 0x7602, 0x7697, 
-    0x7725, 0x77B7, 0x7854, 0x78E0, 0x7958, 0x79E2, 0x7A65, 0x7AF0, 0x7B8B, 0x7C15, 0x7C84, 0x7D0D, 0x7D73, 0x7DD6, 0x7E36, 0x7E9A, 
-    0x7FAC, 0x8053, 0x8105, 0x81A1, 0x823A, 0x82F3, 0x83A7, 0x8445, 0x84D2, 0x8552, 0x85CD, 0x863D, 0x86D6, 0x8771, 0x87F5, 0x8876, 
-    0x8905, 0x8978, 0x89F7, 0x8A5B, 0x8ABF, 0x8B20, 0x8B83, 0x8C83, 0x8CE9, 0x8D9D, 0x8E38, 0x8EBF, 0x8F20, 0x8FBF, 0x907B, 0x9118, 
-    0x91B7, 0x9221, 0x9282, 0x92E5, 0x9346, 0x93A8, 0x940A, 0x946C, 0x95A7, 0x9652, 0x96E5, 0x976E, 0x97E0, 0x984A, 0x98E1, 0x9946, 
-    0x99D5, 0x9A35, 0x9AD9, 0x9B57, 0x9BB7, 0x9C17, 0x9C77, 0x9D1E, 0x9D7E, 0x9DDE, 0x9E7B, 0x9F02, 0x9F75, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E85, 0x5008, 0x5104, 0x5255, 0x538A, 0x5521, 0x565F, 0x577E, 0x588A, 0x59A1, 0x5AA9, 0x5BCD, 0x5CFE, 0x5DEA, 0x5F22, 0x6077, 
-    0x6192, 0x62BE, 0x6422, 0x651F, 0x6650, 0x6771, 0x68B6, 0x69BA, 0x6AA4, 0x6B80, 0x6CD1, 0x6E31, 0x6F40, 0x7028, 0x7132, 0x7218, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2585, 0xFE5F, 0x7346, 0x73C5, 0x744B, 0x74C5, 0x7556, 0x7604, 0x7698, 
-    0x7727, 0x77B8, 0x7858, 0x78E1, 0x7959, 0x79E5, 0x7A66, 0x7AF1, 0x7B8C, 0x7C17, 0x7C85, 0x7D0E, 0x7D74, 0x7DD7, 0x7E37, 0x7E9C, 
-    0x7FAD, 0x8055, 0x8107, 0x81A2, 0x823C, 0x82F5, 0x83AC, 0x8447, 0x84D4, 0x8553, 0x85CE, 0x863E, 0x86D7, 0x8772, 0x87F6, 0x8878, 
-    0x8906, 0x8979, 0x89F8, 0x8A5C, 0x8AC0, 0x8B21, 0x8B84, 0x8C84, 0x8CEA, 0x8D9E, 0x8E3B, 0x8EC0, 0x8F21, 0x8FC0, 0x907C, 0x911A, 
-    0x91B8, 0x9222, 0x9283, 0x92E6, 0x9347, 0x93A9, 0x940B, 0x946D, 0x95A8, 0x9653, 0x96E6, 0x976F, 0x97E1, 0x984B, 0x98E2, 0x9947, 
-    0x99D6, 0x9A36, 0x9ADA, 0x9B58, 0x9BB8, 0x9C18, 0x9C78, 0x9D1F, 0x9D7F, 0x9DDF, 0x9E7C, 0x9F03, 0x9F76, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E87, 0x5009, 0x5105, 0x5257, 0x538E, 0x5525, 0x5660, 0x577F, 0x588B, 0x59A2, 0x5AAB, 0x5BCE, 0x5CFF, 0x5DEC, 0x5F23, 0x607E, 
-    0x6193, 0x62C0, 0x6423, 0x6520, 0x6651, 0x6774, 0x68B7, 0x69BC, 0x6AA5, 0x6B85, 0x6CD2, 0x6E33, 0x6F41, 0x7029, 0x7133, 0x7219, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2586, 0xFE60, 0x7347, 0x73C6, 0x744C, 0x74C6, 0x7557, 0x7606, 0x769A, 
-    0x772A, 0x77B9, 0x7859, 0x78E2, 0x7961, 0x79E8, 0x7A67, 0x7AF2, 0x7B8E, 0x7C18, 0x7C86, 0x7D0F, 0x7D75, 0x7DD8, 0x7E38, 0x7E9D, 
-    0x7FAE, 0x8056, 0x8108, 0x81A4, 0x823D, 0x82F6, 0x83AD, 0x8448, 0x84D5, 0x8554, 0x85D1, 0x863F, 0x86DA, 0x8773, 0x87F7, 0x8879, 
-    0x8907, 0x897A, 0x89F9, 0x8A5D, 0x8AC1, 0x8B22, 0x8B85, 0x8C86, 0x8CEB, 0x8DA0, 0x8E3C, 0x8EC1, 0x8F22, 0x8FC3, 0x907E, 0x911B, 
-    0x91B9, 0x9223, 0x9284, 0x92E7, 0x9348, 0x93AA, 0x940C, 0x946E, 0x95A9, 0x9656, 0x96E7, 0x9770, 0x97E2, 0x984C, 0x98E3, 0x9948, 
-    0x99D7, 0x9A37, 0x9ADB, 0x9B59, 0x9BB9, 0x9C19, 0x9C79, 0x9D20, 0x9D80, 0x9DE0, 0x9E7D, 0x9F04, 0x9F77, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E8A, 0x500A, 0x5108, 0x5258, 0x538F, 0x5526, 0x5661, 0x5780, 0x588C, 0x59A6, 0x5AAC, 0x5BCF, 0x5D00, 0x5DED, 0x5F24, 0x6080, 
-    0x6195, 0x62C1, 0x6424, 0x6521, 0x6658, 0x6776, 0x68B8, 0x69BD, 0x6AA6, 0x6B88, 0x6CD8, 0x6E35, 0x6F42, 0x702A, 0x7134, 0x721A, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2587, 0xFE61, 0x7348, 0x73C7, 0x744D, 0x74C7, 0x7558, 0x7607, 0x769B, 
-    0x772B, 0x77BA, 0x785A, 0x78E3, 0x7963, 0x79EA, 0x7A68, 0x7AF3, 0x7B8F, 0x7C19, 0x7C87, 0x7D10, 0x7D76, 0x7DD9, 0x7E39, 0x7E9E, 
-    0x7FB1, 0x8057, 0x810B, 0x81A5, 0x823F, 0x82F8, 0x83AE, 0x8449, 0x84D7, 0x8555, 0x85D2, 0x8640, 0x86DC, 0x8775, 0x87F8, 0x887A, 
-    0x8908, 0x897C, 0x89FA, 0x8A5E, 0x8AC2, 0x8B23, 0x8B86, 0x8C87, 0x8CEC, 0x8DA1, 0x8E3E, 0x8EC2, 0x8F23, 0x8FC6, 0x9081, 0x911C, 
-    0x91BB, 0x9224, 0x9285, 0x92E8, 0x9349, 0x93AB, 0x940D, 0x946F, 0x95AA, 0x9657, 0x96EB, 0x9771, 0x97E3, 0x984D, 0x98E4, 0x9949, 
-    0x99D8, 0x9A38, 0x9ADC, 0x9B5A, 0x9BBA, 0x9C1A, 0x9C7A, 0x9D21, 0x9D81, 0x9DE1, 0x9E80, 0x9F05, 0x9F78, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E90, 0x500B, 0x5109, 0x5259, 0x5390, 0x5528, 0x5663, 0x5781, 0x588D, 0x59A7, 0x5AAD, 0x5BD1, 0x5D01, 0x5DF0, 0x5F28, 0x6081, 
-    0x6196, 0x62C3, 0x6425, 0x6522, 0x6659, 0x6778, 0x68B9, 0x69BE, 0x6AA7, 0x6B8C, 0x6CD9, 0x6E36, 0x6F43, 0x702B, 0x7135, 0x721B, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2588, 0xFE62, 0x7349, 0x73CB, 0x744E, 0x74C8, 0x755D, 0x7608, 0x769C, 
-    0x772C, 0x77BC, 0x785B, 0x78E4, 0x7964, 0x79EC, 0x7A69, 0x7AF4, 0x7B91, 0x7C1A, 0x7C88, 0x7D11, 0x7D78, 0x7DDA, 0x7E3A, 0x7EAE, 
-    0x7FB3, 0x8059, 0x810C, 0x81A7, 0x8240, 0x82FA, 0x83AF, 0x844A, 0x84D8, 0x8557, 0x85D4, 0x8641, 0x86DD, 0x8777, 0x87FA, 0x887B, 
-    0x8909, 0x897D, 0x89FB, 0x8A5F, 0x8AC3, 0x8B24, 0x8B87, 0x8C88, 0x8CED, 0x8DA2, 0x8E3F, 0x8EC3, 0x8F24, 0x8FC9, 0x9084, 0x911D, 
-    0x91BC, 0x9225, 0x9286, 0x92E9, 0x934A, 0x93AC, 0x940E, 0x9470, 0x95AB, 0x9658, 0x96EC, 0x9772, 0x97E4, 0x984E, 0x98E5, 0x994A, 
-    0x99D9, 0x9A39, 0x9ADD, 0x9B5B, 0x9BBB, 0x9C1B, 0x9C7B, 0x9D22, 0x9D82, 0x9DE2, 0x9E81, 0x9F06, 0x9F79, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E96, 0x500E, 0x510A, 0x525A, 0x5391, 0x5529, 0x5665, 0x5787, 0x588E, 0x59AC, 0x5AAE, 0x5BD4, 0x5D04, 0x5DF5, 0x5F2B, 0x6082, 
-    0x6197, 0x62CB, 0x6427, 0x6523, 0x665B, 0x6779, 0x68BA, 0x69BF, 0x6AA8, 0x6B8E, 0x6CDA, 0x6E37, 0x6F44, 0x702C, 0x7137, 0x721C, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2589, 0xFE63, 0x734A, 0x73CC, 0x744F, 0x74C9, 0x755E, 0x7609, 0x769D, 
-    0x772E, 0x77BE, 0x785C, 0x78E5, 0x7966, 0x79EE, 0x7A6A, 0x7AF5, 0x7B92, 0x7C1B, 0x7C8A, 0x7D12, 0x7D79, 0x7DDB, 0x7E3C, 0x7EB4, 
-    0x7FB4, 0x805B, 0x8115, 0x81A9, 0x8241, 0x82FC, 0x83B5, 0x844B, 0x84D9, 0x8558, 0x85D6, 0x8642, 0x86E0, 0x8778, 0x87FB, 0x887C, 
-    0x890B, 0x897E, 0x89FC, 0x8A60, 0x8AC4, 0x8B25, 0x8B88, 0x8C8B, 0x8CEE, 0x8DA4, 0x8E43, 0x8EC4, 0x8F25, 0x8FCA, 0x9085, 0x911F, 
-    0x91BD, 0x9226, 0x9287, 0x92EA, 0x934B, 0x93AD, 0x940F, 0x9471, 0x95AC, 0x9659, 0x96ED, 0x9775, 0x97E5, 0x984F, 0x98E6, 0x994B, 
-    0x99DA, 0x9A3A, 0x9ADE, 0x9B5C, 0x9BBC, 0x9C1C, 0x9C7D, 0x9D23, 0x9D83, 0x9DE3, 0x9E83, 0x9F07, 0x9F7A, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E97, 0x5010, 0x510C, 0x525B, 0x5392, 0x552B, 0x5666, 0x5788, 0x588F, 0x59AD, 0x5AAF, 0x5BD5, 0x5D05, 0x5DF6, 0x5F2C, 0x6085, 
-    0x6198, 0x62CF, 0x6428, 0x6524, 0x665C, 0x677A, 0x68BB, 0x69C0, 0x6AAA, 0x6B8F, 0x6CDC, 0x6E39, 0x6F45, 0x702D, 0x7138, 0x721E, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258A, 0xFE64, 0x734B, 0x73CE, 0x7450, 0x74CA, 0x755F, 0x760B, 0x769E, 
-    0x7730, 0x77C0, 0x785E, 0x78E6, 0x7969, 0x79F1, 0x7A6B, 0x7AF6, 0x7B93, 0x7C1C, 0x7C8B, 0x7D13, 0x7D7A, 0x7DDC, 0x7E3D, 0x7EBB, 
-    0x7FB5, 0x805C, 0x8117, 0x81AB, 0x8242, 0x82FD, 0x83BB, 0x844C, 0x84DA, 0x855A, 0x85D7, 0x8643, 0x86E1, 0x8779, 0x87FC, 0x8880, 
-    0x890C, 0x8980, 0x89FD, 0x8A61, 0x8AC5, 0x8B27, 0x8B89, 0x8C8D, 0x8CEF, 0x8DA5, 0x8E45, 0x8EC5, 0x8F26, 0x8FCB, 0x9086, 0x9120, 
-    0x91BE, 0x9227, 0x9288, 0x92EB, 0x934C, 0x93AE, 0x9410, 0x9472, 0x95AD, 0x965A, 0x96EE, 0x9777, 0x97E8, 0x9850, 0x98E9, 0x994C, 
-    0x99DB, 0x9A3B, 0x9AE0, 0x9B5D, 0x9BBD, 0x9C1D, 0x9C7E, 0x9D24, 0x9D84, 0x9DE4, 0x9E84, 0x9F08, 0x9F7B, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E99, 0x5011, 0x510D, 0x525D, 0x5393, 0x552D, 0x5667, 0x5789, 0x5890, 0x59B0, 0x5AB0, 0x5BD6, 0x5D08, 0x5DF8, 0x5F2E, 0x6086, 
-    0x6199, 0x62D1, 0x6429, 0x6526, 0x665D, 0x677B, 0x68BC, 0x69C2, 0x6AAD, 0x6B90, 0x6CDD, 0x6E3B, 0x6F48, 0x702E, 0x7139, 0x721F, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258B, 0xFE65, 0x734C, 0x73D2, 0x7451, 0x74CB, 0x7560, 0x760D, 0x769F, 
-    0x7731, 0x77C1, 0x785F, 0x78E7, 0x796A, 0x79F2, 0x7A6C, 0x7AF7, 0x7B96, 0x7C1D, 0x7C8C, 0x7D14, 0x7D7B, 0x7DDD, 0x7E3E, 0x7EBC, 
-    0x7FB6, 0x805D, 0x8119, 0x81AC, 0x8243, 0x82FE, 0x83BE, 0x844D, 0x84DB, 0x855B, 0x85D8, 0x8644, 0x86E2, 0x877A, 0x87FD, 0x8883, 
-    0x890D, 0x8982, 0x89FE, 0x8A62, 0x8AC6, 0x8B28, 0x8B8A, 0x8C8E, 0x8CF0, 0x8DA6, 0x8E46, 0x8EC6, 0x8F27, 0x8FCC, 0x9087, 0x9121, 
-    0x91BF, 0x9228, 0x9289, 0x92EC, 0x934D, 0x93AF, 0x9411, 0x9473, 0x95AE, 0x965C, 0x96F0, 0x9778, 0x97EE, 0x9851, 0x98EA, 0x994D, 
-    0x99DC, 0x9A3C, 0x9AE2, 0x9B5E, 0x9BBE, 0x9C1E, 0x9C80, 0x9D25, 0x9D85, 0x9DE5, 0x9E85, 0x9F09, 0x9F7C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E9C, 0x5013, 0x510E, 0x525F, 0x5394, 0x5532, 0x566D, 0x578A, 0x5891, 0x59B1, 0x5AB1, 0x5BD7, 0x5D09, 0x5DF9, 0x5F30, 0x6087, 
-    0x619A, 0x62D5, 0x642B, 0x6527, 0x665E, 0x677D, 0x68BD, 0x69C3, 0x6AAE, 0x6B91, 0x6CDF, 0x6E3C, 0x6F49, 0x702F, 0x713A, 0x7220, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258C, 0xFE66, 0x734E, 0x73D3, 0x7452, 0x74CC, 0x7561, 0x760E, 0x76A0, 
-    0x7732, 0x77C2, 0x7860, 0x78E9, 0x796B, 0x79F3, 0x7A6D, 0x7AF8, 0x7B98, 0x7C1E, 0x7C8D, 0x7D15, 0x7D7C, 0x7DDE, 0x7E3F, 0x7ED6, 
-    0x7FB7, 0x805E, 0x811B, 0x81AD, 0x8245, 0x82FF, 0x83BF, 0x844E, 0x84DC, 0x855C, 0x85D9, 0x8645, 0x86E3, 0x877F, 0x87FF, 0x8886, 
-    0x890E, 0x8984, 0x89FF, 0x8A63, 0x8AC7, 0x8B29, 0x8B8B, 0x8C8F, 0x8CF1, 0x8DA7, 0x8E4C, 0x8EC7, 0x8F28, 0x8FCD, 0x9089, 0x9124, 
-    0x91C0, 0x9229, 0x928A, 0x92ED, 0x934E, 0x93B0, 0x9412, 0x9474, 0x95AF, 0x965D, 0x96F1, 0x9779, 0x97EF, 0x9852, 0x98EB, 0x994E, 
-    0x99DD, 0x9A3D, 0x9AE3, 0x9B5F, 0x9BBF, 0x9C1F, 0x9C83, 0x9D26, 0x9D86, 0x9DE6, 0x9E86, 0x9F0A, 0x9F7D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E9D, 0x5015, 0x510F, 0x5260, 0x5396, 0x5534, 0x566E, 0x578D, 0x5894, 0x59B3, 0x5AB4, 0x5BD8, 0x5D0A, 0x5DFA, 0x5F32, 0x6088, 
-    0x619B, 0x62DD, 0x642E, 0x6528, 0x6660, 0x6780, 0x68BE, 0x69C4, 0x6AAF, 0x6B94, 0x6CE4, 0x6E3D, 0x6F4A, 0x7030, 0x713B, 0x7221, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258D, 0xFE68, 0x734F, 0x73D4, 0x7453, 0x74CD, 0x7562, 0x760F, 0x76A1, 
-    0x7733, 0x77C3, 0x7861, 0x78EA, 0x796C, 0x79F4, 0x7A6E, 0x7AFB, 0x7B99, 0x7C20, 0x7C8E, 0x7D16, 0x7D7D, 0x7DDF, 0x7E40, 0x7EE4, 
-    0x7FBA, 0x805F, 0x811C, 0x81AE, 0x8246, 0x8300, 0x83C2, 0x844F, 0x84DE, 0x855D, 0x85DA, 0x8646, 0x86E5, 0x8780, 0x8800, 0x8887, 
-    0x890F, 0x8985, 0x8A01, 0x8A64, 0x8AC8, 0x8B2A, 0x8B8C, 0x8C90, 0x8CF2, 0x8DA8, 0x8E4D, 0x8EC8, 0x8F29, 0x8FCF, 0x908A, 0x9125, 
-    0x91C1, 0x922A, 0x928B, 0x92EE, 0x934F, 0x93B1, 0x9413, 0x9475, 0x95B0, 0x965E, 0x96F2, 0x977A, 0x97F0, 0x9853, 0x98EC, 0x994F, 
-    0x99DE, 0x9A3E, 0x9AE4, 0x9B60, 0x9BC0, 0x9C20, 0x9C84, 0x9D27, 0x9D87, 0x9DE7, 0x9E89, 0x9F0C, 0x9F7E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4E9E, 0x5016, 0x5110, 0x5262, 0x5397, 0x5535, 0x566F, 0x578E, 0x5895, 0x59B4, 0x5AB6, 0x5BD9, 0x5D0B, 0x5DFB, 0x5F33, 0x608A, 
-    0x619C, 0x62DE, 0x642F, 0x6529, 0x6662, 0x6782, 0x68BF, 0x69C5, 0x6AB0, 0x6B95, 0x6CE6, 0x6E3E, 0x6F4C, 0x7031, 0x713C, 0x7222, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258E, 0xFE69, 0x7351, 0x73D5, 0x7454, 0x74CE, 0x7563, 0x7611, 0x76A2, 
-    0x7734, 0x77C4, 0x7862, 0x78EB, 0x796E, 0x79F5, 0x7A6F, 0x7AFC, 0x7B9A, 0x7C21, 0x7C8F, 0x7D17, 0x7D7E, 0x7DE0, 0x7E42, 0x7EEC, 
-    0x7FBB, 0x8060, 0x811D, 0x81AF, 0x8248, 0x830A, 0x83C3, 0x8450, 0x84E1, 0x855F, 0x85DB, 0x8647, 0x86E6, 0x8781, 0x8801, 0x8889, 
-    0x8911, 0x8987, 0x8A02, 0x8A65, 0x8AC9, 0x8B2B, 0x8B8D, 0x8C91, 0x8CF3, 0x8DA9, 0x8E4E, 0x8EC9, 0x8F2A, 0x8FD2, 0x908C, 0x9126, 
-    0x91C2, 0x922B, 0x928C, 0x92EF, 0x9350, 0x93B2, 0x9414, 0x9476, 0x95B1, 0x9660, 0x96F4, 0x977B, 0x97F1, 0x9854, 0x98ED, 0x9950, 
-    0x99DF, 0x9A3F, 0x9AE5, 0x9B61, 0x9BC1, 0x9C21, 0x9C89, 0x9D28, 0x9D88, 0x9DE8, 0x9E8A, 0x9F0F, 0x9F81, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EA3, 0x5017, 0x5111, 0x5263, 0x5399, 0x5536, 0x5670, 0x578F, 0x5896, 0x59B5, 0x5AB7, 0x5BDA, 0x5D0C, 0x5DFC, 0x5F34, 0x608B, 
-    0x619E, 0x62E0, 0x6430, 0x652A, 0x6663, 0x6783, 0x68C1, 0x69C6, 0x6AB1, 0x6B97, 0x6CE7, 0x6E3F, 0x6F4E, 0x7032, 0x713D, 0x7223, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x258F, 0xFE6A, 0x7353, 0x73D6, 0x7456, 0x74CF, 0x7564, 0x7612, 0x76A3, 
-    0x7739, 0x77C5, 0x7863, 0x78ED, 0x7970, 0x79F6, 0x7A71, 0x7AFE, 0x7B9B, 0x7C22, 0x7C90, 0x7D18, 0x7D7F, 0x7DE1, 0x7E43, 0x7EF9, 
-    0x7FBE, 0x8061, 0x811F, 0x81B0, 0x824A, 0x830B, 0x83C4, 0x8452, 0x84E2, 0x8560, 0x85DD, 0x8648, 0x86E7, 0x8784, 0x8802, 0x888A, 
-    0x8914, 0x8988, 0x8A03, 0x8A66, 0x8ACA, 0x8B2C, 0x8B8E, 0x8C92, 0x8CF4, 0x8DAA, 0x8E4F, 0x8ECA, 0x8F2B, 0x8FD6, 0x908D, 0x9127, 
-    0x91C3, 0x922C, 0x928D, 0x92F0, 0x9351, 0x93B3, 0x9415, 0x9477, 0x95B2, 0x9663, 0x96F5, 0x977D, 0x97F2, 0x9855, 0x98EE, 0x9951, 
-    0x99E0, 0x9A40, 0x9AE7, 0x9B62, 0x9BC2, 0x9C22, 0x9C8A, 0x9D29, 0x9D89, 0x9DE9, 0x9E8C, 0x9F11, 0x9F82, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EAA, 0x501B, 0x5113, 0x5264, 0x539B, 0x5538, 0x5672, 0x5790, 0x5897, 0x59B6, 0x5AB9, 0x5BDB, 0x5D0D, 0x5DFF, 0x5F35, 0x608E, 
-    0x619F, 0x62E1, 0x6431, 0x652C, 0x6665, 0x6785, 0x68C3, 0x69C7, 0x6AB2, 0x6B98, 0x6CE9, 0x6E40, 0x6F4F, 0x7033, 0x713E, 0x7224, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2593, 0xFE6B, 0x7354, 0x73D7, 0x7458, 0x74D0, 0x7567, 0x7613, 0x76A5, 
-    0x773B, 0x77C6, 0x7864, 0x78EE, 0x7971, 0x79F7, 0x7A72, 0x7B00, 0x7B9E, 0x7C23, 0x7C93, 0x7D19, 0x7D80, 0x7DE2, 0x7E44, 0x7F0A, 
-    0x7FC0, 0x8062, 0x8120, 0x81B1, 0x824C, 0x830D, 0x83C6, 0x8453, 0x84E4, 0x8561, 0x85DE, 0x8649, 0x86E8, 0x8786, 0x8804, 0x888C, 
-    0x8915, 0x8989, 0x8A04, 0x8A67, 0x8ACB, 0x8B2D, 0x8B8F, 0x8C93, 0x8CF5, 0x8DAB, 0x8E50, 0x8ECB, 0x8F2C, 0x8FD7, 0x908E, 0x9128, 
-    0x91C4, 0x922D, 0x928F, 0x92F1, 0x9352, 0x93B4, 0x9416, 0x9478, 0x95B3, 0x9665, 0x96F8, 0x977E, 0x97F4, 0x9856, 0x98EF, 0x9952, 
-    0x99E1, 0x9A41, 0x9AE8, 0x9B63, 0x9BC3, 0x9C23, 0x9C8C, 0x9D2A, 0x9D8A, 0x9DEA, 0x9E8D, 0x9F12, 0x9F8D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EAF, 0x501D, 0x5114, 0x5266, 0x539C, 0x5539, 0x5673, 0x5791, 0x5898, 0x59B7, 0x5ABA, 0x5BDC, 0x5D0F, 0x5E00, 0x5F36, 0x608F, 
-    0x61A0, 0x62E4, 0x6432, 0x652D, 0x6667, 0x6786, 0x68C4, 0x69C8, 0x6AB3, 0x6B99, 0x6CEC, 0x6E41, 0x6F50, 0x7034, 0x713F, 0x7225, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2594, 0x0000, 0x7355, 0x73D8, 0x745D, 0x74D1, 0x7568, 0x7614, 0x76A6, 
-    0x773D, 0x77C7, 0x7865, 0x78EF, 0x7972, 0x79F9, 0x7A73, 0x7B01, 0x7B9F, 0x7C24, 0x7C94, 0x7D1A, 0x7D81, 0x7DE3, 0x7E45, 0x7F10, 
-    0x7FC2, 0x8063, 0x8121, 0x81B2, 0x824D, 0x8310, 0x83C8, 0x8454, 0x84E7, 0x8562, 0x85DF, 0x864A, 0x86EA, 0x8787, 0x8805, 0x888E, 
-    0x8916, 0x898A, 0x8A05, 0x8A68, 0x8ACC, 0x8B2E, 0x8B90, 0x8C95, 0x8CF6, 0x8DAC, 0x8E53, 0x8ECC, 0x8F2D, 0x8FDA, 0x908F, 0x9129, 
-    0x91C5, 0x922E, 0x9290, 0x92F2, 0x9353, 0x93B5, 0x9417, 0x9479, 0x95B4, 0x9666, 0x96FA, 0x977F, 0x97F7, 0x9857, 0x98F0, 0x9953, 
-    0x99E2, 0x9A42, 0x9AE9, 0x9B64, 0x9BC4, 0x9C24, 0x9C8F, 0x9D2B, 0x9D8B, 0x9DEB, 0x9E8E, 0x9F14, 0x9F8E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB0, 0x501E, 0x5115, 0x5268, 0x539E, 0x553A, 0x5674, 0x5794, 0x589B, 0x59B8, 0x5ABB, 0x5BE0, 0x5D10, 0x5E04, 0x5F37, 0x6090, 
-    0x61A1, 0x62EA, 0x6433, 0x6530, 0x6669, 0x6788, 0x68C5, 0x69C9, 0x6AB4, 0x6B9C, 0x6CED, 0x6E42, 0x6F51, 0x7036, 0x7140, 0x7226, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2595, 0x0000, 0x7356, 0x73DA, 0x7460, 0x74D3, 0x7569, 0x7616, 0x76A7, 
-    0x773E, 0x77C8, 0x7866, 0x78F0, 0x7973, 0x79FA, 0x7A75, 0x7B02, 0x7BA0, 0x7C25, 0x7C96, 0x7D1B, 0x7D82, 0x7DE4, 0x7E46, 0x7F1E, 
-    0x7FC3, 0x8064, 0x8122, 0x81B4, 0x824E, 0x8312, 0x83C9, 0x8455, 0x84E8, 0x8563, 0x85E0, 0x864B, 0x86EB, 0x8789, 0x8806, 0x888F, 
-    0x8917, 0x898B, 0x8A06, 0x8A69, 0x8ACD, 0x8B2F, 0x8B91, 0x8C96, 0x8CF7, 0x8DAD, 0x8E54, 0x8ECD, 0x8F2E, 0x8FE0, 0x9090, 0x912A, 
-    0x91C6, 0x922F, 0x9291, 0x92F3, 0x9354, 0x93B6, 0x9418, 0x947A, 0x95B5, 0x966B, 0x96FB, 0x9780, 0x97F8, 0x9858, 0x98F1, 0x9956, 
-    0x99E3, 0x9A43, 0x9AEA, 0x9B65, 0x9BC5, 0x9C25, 0x9C93, 0x9D2C, 0x9D8C, 0x9DEC, 0x9E8F, 0x9F15, 0x9F8F, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB1, 0x5020, 0x5116, 0x526B, 0x53A0, 0x553B, 0x5675, 0x5795, 0x589C, 0x59BA, 0x5ABC, 0x5BE2, 0x5D11, 0x5E07, 0x5F38, 0x6091, 
-    0x61A2, 0x62EB, 0x6435, 0x6531, 0x666A, 0x678A, 0x68C6, 0x69CB, 0x6AB5, 0x6B9D, 0x6CF2, 0x6E45, 0x6F52, 0x7037, 0x7141, 0x7227, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25BC, 0x0000, 0x7358, 0x73DB, 0x7461, 0x74D4, 0x756B, 0x761A, 0x76A8, 
-    0x773F, 0x77C9, 0x7867, 0x78F1, 0x7974, 0x79FC, 0x7A7B, 0x7B05, 0x7BA3, 0x7C28, 0x7C99, 0x7D1C, 0x7D83, 0x7DE5, 0x7E48, 0x7F37, 
-    0x7FC4, 0x8065, 0x8123, 0x81B5, 0x8250, 0x8313, 0x83CB, 0x8456, 0x84E9, 0x8565, 0x85E1, 0x864C, 0x86EC, 0x878A, 0x8807, 0x8890, 
-    0x8918, 0x898C, 0x8A08, 0x8A6A, 0x8ACE, 0x8B30, 0x8B92, 0x8C97, 0x8CF8, 0x8DAE, 0x8E55, 0x8ECF, 0x8F2F, 0x8FE1, 0x9092, 0x912B, 
-    0x91C8, 0x9230, 0x9292, 0x92F4, 0x9355, 0x93B7, 0x9419, 0x947B, 0x95B6, 0x966D, 0x96FC, 0x9781, 0x97F9, 0x9859, 0x98F2, 0x9957, 
-    0x99E4, 0x9A44, 0x9AEC, 0x9B66, 0x9BC6, 0x9C26, 0x9C96, 0x9D2D, 0x9D8D, 0x9DED, 0x9E90, 0x9F16, 0x9F90, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB4, 0x5022, 0x5117, 0x526C, 0x53A1, 0x553D, 0x5677, 0x5796, 0x589D, 0x59BC, 0x5ABD, 0x5BE3, 0x5D12, 0x5E09, 0x5F3B, 0x6093, 
-    0x61A3, 0x62F0, 0x6436, 0x6532, 0x666B, 0x678C, 0x68C7, 0x69CD, 0x6AB6, 0x6B9E, 0x6CF4, 0x6E46, 0x6F53, 0x7038, 0x7142, 0x7229, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25BD, 0x0000, 0x7359, 0x73DC, 0x7462, 0x74D5, 0x756C, 0x761C, 0x76A9, 
-    0x7742, 0x77CA, 0x7868, 0x78F3, 0x7975, 0x79FE, 0x7A7C, 0x7B07, 0x7BA4, 0x7C29, 0x7C9A, 0x7D1D, 0x7D84, 0x7DE6, 0x7E49, 0x7F39, 
-    0x7FC6, 0x8066, 0x8124, 0x81B6, 0x8251, 0x8316, 0x83CD, 0x8458, 0x84EA, 0x8566, 0x85E2, 0x8652, 0x86EF, 0x878C, 0x8808, 0x8891, 
-    0x891C, 0x898D, 0x8A09, 0x8A6B, 0x8ACF, 0x8B31, 0x8B93, 0x8C99, 0x8CF9, 0x8DAF, 0x8E56, 0x8ED0, 0x8F30, 0x8FE3, 0x9094, 0x912C, 
-    0x91CB, 0x9231, 0x9293, 0x92F5, 0x9356, 0x93B8, 0x941A, 0x947C, 0x95B7, 0x966E, 0x96FD, 0x9782, 0x97FA, 0x985A, 0x98F3, 0x9958, 
-    0x99E5, 0x9A45, 0x9AEE, 0x9B67, 0x9BC7, 0x9C27, 0x9C97, 0x9D2E, 0x9D8E, 0x9DEE, 0x9E91, 0x9F18, 0x9F91, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB6, 0x5023, 0x5118, 0x526D, 0x53A4, 0x5540, 0x5678, 0x5797, 0x58A0, 0x59BD, 0x5ABF, 0x5BE6, 0x5D13, 0x5E0A, 0x5F3D, 0x6095, 
-    0x61A4, 0x62F2, 0x6437, 0x6533, 0x666C, 0x678D, 0x68C8, 0x69CF, 0x6AB7, 0x6B9F, 0x6CF9, 0x6E47, 0x6F54, 0x703A, 0x7143, 0x722B, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25E2, 0x0000, 0x735A, 0x73DD, 0x7463, 0x74D6, 0x756D, 0x761D, 0x76AA, 
-    0x7744, 0x77CB, 0x7869, 0x78F5, 0x7976, 0x79FF, 0x7A7D, 0x7B09, 0x7BA5, 0x7C2B, 0x7C9B, 0x7D1E, 0x7D85, 0x7DE7, 0x7E4A, 0x7F3B, 
-    0x7FC7, 0x8067, 0x8125, 0x81B7, 0x8252, 0x8318, 0x83CE, 0x845D, 0x84EB, 0x8567, 0x85E3, 0x8653, 0x86F5, 0x878E, 0x8809, 0x8893, 
-    0x891D, 0x898E, 0x8A0A, 0x8A6C, 0x8AD0, 0x8B32, 0x8B94, 0x8C9A, 0x8CFA, 0x8DB0, 0x8E57, 0x8ED1, 0x8F31, 0x8FE7, 0x9096, 0x912D, 
-    0x91D0, 0x9232, 0x9294, 0x92F6, 0x9357, 0x93B9, 0x941B, 0x947D, 0x95B8, 0x966F, 0x96FF, 0x9783, 0x97FB, 0x985B, 0x98F4, 0x9959, 
-    0x99E6, 0x9A46, 0x9AF0, 0x9B68, 0x9BC8, 0x9C28, 0x9C98, 0x9D2F, 0x9D8F, 0x9DEF, 0x9E94, 0x9F1A, 0x9F92, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB7, 0x5024, 0x5119, 0x526E, 0x53A7, 0x5542, 0x5679, 0x5798, 0x58A1, 0x59BF, 0x5AC0, 0x5BE7, 0x5D15, 0x5E0B, 0x5F3E, 0x6097, 
-    0x61A5, 0x62F5, 0x6438, 0x6537, 0x666D, 0x678E, 0x68CA, 0x69D1, 0x6AB8, 0x6BA0, 0x6CFF, 0x6E48, 0x6F55, 0x703B, 0x7144, 0x722D, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25E3, 0x0000, 0x735B, 0x73DF, 0x7464, 0x74D7, 0x756E, 0x761E, 0x76AB, 
-    0x7745, 0x77CC, 0x786F, 0x78F6, 0x7979, 0x7A01, 0x7A7E, 0x7B0C, 0x7BAE, 0x7C2C, 0x7CA0, 0x7D1F, 0x7D86, 0x7DE8, 0x7E4B, 0x7F3C, 
-    0x7FC8, 0x8068, 0x8126, 0x81B8, 0x8253, 0x8319, 0x83D0, 0x845E, 0x84ED, 0x8569, 0x85E5, 0x8655, 0x86F6, 0x878F, 0x880B, 0x8894, 
-    0x891E, 0x898F, 0x8A0B, 0x8A6D, 0x8AD1, 0x8B33, 0x8B95, 0x8C9B, 0x8CFB, 0x8DB2, 0x8E58, 0x8ED2, 0x8F32, 0x8FEC, 0x9098, 0x912E, 
-    0x91D2, 0x9233, 0x9295, 0x92F7, 0x9358, 0x93BA, 0x941C, 0x947E, 0x95B9, 0x9670, 0x9702, 0x9784, 0x97FC, 0x985C, 0x98F5, 0x995A, 
-    0x99E7, 0x9A47, 0x9AF1, 0x9B69, 0x9BC9, 0x9C29, 0x9C99, 0x9D30, 0x9D90, 0x9DF0, 0x9E95, 0x9F1B, 0x9F93, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB8, 0x5027, 0x511A, 0x5270, 0x53AA, 0x5545, 0x567A, 0x5799, 0x58A2, 0x59C0, 0x5AC3, 0x5BE9, 0x5D17, 0x5E0D, 0x5F3F, 0x6098, 
-    0x61A6, 0x62F8, 0x6439, 0x653A, 0x6671, 0x678F, 0x68CC, 0x69D2, 0x6AB9, 0x6BA2, 0x6D00, 0x6E49, 0x6F56, 0x703C, 0x7146, 0x722E, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25E4, 0x0000, 0x735C, 0x73E1, 0x7465, 0x74D8, 0x756F, 0x7621, 0x76AC, 
-    0x7746, 0x77CE, 0x7870, 0x78F8, 0x797B, 0x7A04, 0x7A82, 0x7B0D, 0x7BAF, 0x7C2D, 0x7CA1, 0x7D21, 0x7D87, 0x7DE9, 0x7E4C, 0x7F3D, 
-    0x7FC9, 0x806B, 0x8127, 0x81B9, 0x8254, 0x831D, 0x83D1, 0x845F, 0x84EE, 0x856A, 0x85E6, 0x8656, 0x86F7, 0x8790, 0x880C, 0x8895, 
-    0x891F, 0x8990, 0x8A0C, 0x8A6E, 0x8AD2, 0x8B34, 0x8B96, 0x8C9C, 0x8CFC, 0x8DB6, 0x8E5A, 0x8ED3, 0x8F33, 0x8FEF, 0x909A, 0x9130, 
-    0x91D3, 0x9234, 0x9296, 0x92F8, 0x9359, 0x93BB, 0x941D, 0x947F, 0x95BA, 0x9671, 0x9703, 0x9786, 0x97FD, 0x985D, 0x98F6, 0x995B, 
-    0x99E8, 0x9A48, 0x9AF2, 0x9B6A, 0x9BCA, 0x9C2A, 0x9C9D, 0x9D31, 0x9D91, 0x9DF1, 0x9E96, 0x9F1C, 0x9F94, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EB9, 0x502B, 0x511B, 0x5271, 0x53AB, 0x5547, 0x567D, 0x579A, 0x58A3, 0x59C1, 0x5AC4, 0x5BEA, 0x5D18, 0x5E0E, 0x5F41, 0x6099, 
-    0x61AA, 0x62F9, 0x643B, 0x653C, 0x6672, 0x6791, 0x68CE, 0x69D3, 0x6ABA, 0x6BA3, 0x6D02, 0x6E4A, 0x6F57, 0x703D, 0x7147, 0x722F, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x25E5, 0x0000, 0x735D, 0x73E2, 0x7466, 0x74D9, 0x7570, 0x7623, 0x76AD, 
-    0x7748, 0x77CF, 0x7871, 0x78F9, 0x797C, 0x7A05, 0x7A85, 0x7B0E, 0x7BB0, 0x7C2E, 0x7CA3, 0x7D23, 0x7D88, 0x7DEA, 0x7E4D, 0x7F3E, 
-    0x7FCB, 0x806C, 0x8128, 0x81BC, 0x8255, 0x831E, 0x83D2, 0x8460, 0x84EF, 0x856B, 0x85E7, 0x8657, 0x86FA, 0x8791, 0x880D, 0x8897, 
-    0x8920, 0x8991, 0x8A0D, 0x8A6F, 0x8AD3, 0x8B35, 0x8B97, 0x8C9D, 0x8CFD, 0x8DB7, 0x8E5B, 0x8ED4, 0x8F34, 0x8FF1, 0x909C, 0x9132, 
-    0x91D4, 0x9235, 0x9297, 0x92F9, 0x935A, 0x93BC, 0x941E, 0x9480, 0x95BB, 0x9673, 0x9705, 0x9787, 0x97FE, 0x985E, 0x98F7, 0x995C, 
-    0x99E9, 0x9A49, 0x9AF3, 0x9B6B, 0x9BCB, 0x9C2B, 0x9CAA, 0x9D32, 0x9D92, 0x9DF2, 0x9E97, 0x9F1D, 0x9F95, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EBC, 0x502F, 0x511C, 0x5273, 0x53AC, 0x5548, 0x567E, 0x579C, 0x58A4, 0x59C2, 0x5AC5, 0x5BEB, 0x5D19, 0x5E12, 0x5F42, 0x609C, 
-    0x61AB, 0x62FA, 0x643C, 0x653D, 0x6673, 0x6792, 0x68CF, 0x69D5, 0x6ABB, 0x6BA4, 0x6D03, 0x6E4B, 0x6F59, 0x703E, 0x7148, 0x7232, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2609, 0x0000, 0x735E, 0x73E3, 0x7467, 0x74DA, 0x7571, 0x7627, 0x76AF, 
-    0x7749, 0x77D0, 0x7872, 0x78FB, 0x797D, 0x7A07, 0x7A87, 0x7B10, 0x7BB2, 0x7C2F, 0x7CA6, 0x7D24, 0x7D89, 0x7DEB, 0x7E4E, 0x7F3F, 
-    0x7FCD, 0x806D, 0x8129, 0x81BD, 0x8256, 0x831F, 0x83D3, 0x8462, 0x84F1, 0x856C, 0x85E8, 0x8658, 0x86FB, 0x8792, 0x880E, 0x8898, 
-    0x8922, 0x8992, 0x8A0E, 0x8A70, 0x8AD4, 0x8B36, 0x8B98, 0x8C9E, 0x8CFE, 0x8DB9, 0x8E5C, 0x8ED5, 0x8F35, 0x8FF2, 0x909E, 0x9133, 
-    0x91D5, 0x9236, 0x9298, 0x92FA, 0x935B, 0x93BD, 0x941F, 0x9481, 0x95BC, 0x9678, 0x970A, 0x9788, 0x97FF, 0x985F, 0x98F8, 0x995D, 
-    0x99EA, 0x9A4A, 0x9AF4, 0x9B6C, 0x9BCC, 0x9C2C, 0x9CAC, 0x9D33, 0x9D93, 0x9DF3, 0x9E98, 0x9F1E, 0x9F96, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EBD, 0x5030, 0x511D, 0x5274, 0x53AD, 0x554B, 0x567F, 0x579D, 0x58A5, 0x59C3, 0x5AC6, 0x5BEC, 0x5D1A, 0x5E13, 0x5F43, 0x609E, 
-    0x61AD, 0x62FB, 0x643E, 0x6540, 0x6675, 0x6793, 0x68D0, 0x69D6, 0x6ABC, 0x6BA5, 0x6D05, 0x6E4C, 0x6F5A, 0x703F, 0x7149, 0x7233, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2295, 0x0000, 0x735F, 0x73E4, 0x7468, 0x74DB, 0x7573, 0x7628, 0x76B0, 
-    0x774A, 0x77D1, 0x7873, 0x78FC, 0x797E, 0x7A08, 0x7A89, 0x7B12, 0x7BB3, 0x7C30, 0x7CA7, 0x7D25, 0x7D8A, 0x7DEC, 0x7E4F, 0x7F40, 
-    0x7FCF, 0x806E, 0x812A, 0x81BE, 0x8257, 0x8320, 0x83D5, 0x8464, 0x84F2, 0x856D, 0x85EA, 0x8659, 0x86FC, 0x8794, 0x880F, 0x8899, 
-    0x8923, 0x8993, 0x8A0F, 0x8A71, 0x8AD5, 0x8B37, 0x8B99, 0x8C9F, 0x8CFF, 0x8DBB, 0x8E5D, 0x8ED6, 0x8F36, 0x8FF4, 0x909F, 0x9134, 
-    0x91D6, 0x9237, 0x9299, 0x92FB, 0x935C, 0x93BE, 0x9420, 0x9482, 0x95BD, 0x9679, 0x970B, 0x9789, 0x9800, 0x9860, 0x98F9, 0x995E, 
-    0x99EB, 0x9A4B, 0x9AF5, 0x9B6D, 0x9BCD, 0x9C2D, 0x9CAF, 0x9D34, 0x9D94, 0x9DF4, 0x9E99, 0x9F1F, 0x9F97, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EBE, 0x5031, 0x511E, 0x5275, 0x53AF, 0x554C, 0x5680, 0x579E, 0x58A6, 0x59C4, 0x5AC7, 0x5BED, 0x5D1C, 0x5E17, 0x5F44, 0x60A1, 
-    0x61AE, 0x6300, 0x6440, 0x6541, 0x6678, 0x6794, 0x68D1, 0x69D7, 0x6ABD, 0x6BA6, 0x6D06, 0x6E4F, 0x6F5B, 0x7040, 0x714B, 0x7234, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3012, 0x0000, 0x7361, 0x73E6, 0x7469, 0x74DD, 0x7575, 0x762C, 0x76B3, 
-    0x774B, 0x77D2, 0x7874, 0x78FD, 0x797F, 0x7A09, 0x7A8A, 0x7B13, 0x7BB5, 0x7C31, 0x7CA8, 0x7D26, 0x7D8B, 0x7DED, 0x7E50, 0x7F41, 
-    0x7FD0, 0x806F, 0x812B, 0x81BF, 0x8259, 0x8321, 0x83D7, 0x8465, 0x84F3, 0x856E, 0x85EB, 0x865B, 0x86FD, 0x8795, 0x8810, 0x889A, 
-    0x8924, 0x8994, 0x8A10, 0x8A72, 0x8AD6, 0x8B38, 0x8B9A, 0x8CA0, 0x8D00, 0x8DBD, 0x8E5E, 0x8ED7, 0x8F37, 0x8FF5, 0x90A0, 0x9135, 
-    0x91D7, 0x9238, 0x929A, 0x92FC, 0x935D, 0x93BF, 0x9421, 0x9483, 0x95BE, 0x967A, 0x970C, 0x978A, 0x9801, 0x9861, 0x98FA, 0x995F, 
-    0x99EC, 0x9A4C, 0x9AF6, 0x9B6E, 0x9BCE, 0x9C2E, 0x9CB9, 0x9D35, 0x9D95, 0x9DF5, 0x9E9A, 0x9F21, 0x9F98, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EC8, 0x5032, 0x511F, 0x5276, 0x53B0, 0x554D, 0x5681, 0x579F, 0x58A7, 0x59C5, 0x5AC8, 0x5BEF, 0x5D1D, 0x5E1E, 0x5F45, 0x60A2, 
-    0x61AF, 0x6303, 0x6442, 0x6542, 0x6679, 0x6796, 0x68D3, 0x69D8, 0x6ABE, 0x6BA7, 0x6D08, 0x6E50, 0x6F5D, 0x7041, 0x714D, 0x723A, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x301D, 0x0000, 0x7362, 0x73E8, 0x746A, 0x74DF, 0x7576, 0x762E, 0x76B5, 
-    0x774C, 0x77D3, 0x7875, 0x78FE, 0x7982, 0x7A0A, 0x7A8B, 0x7B16, 0x7BB6, 0x7C32, 0x7CA9, 0x7D28, 0x7D8C, 0x7DEE, 0x7E51, 0x7F43, 
-    0x7FD1, 0x8070, 0x812D, 0x81C4, 0x825B, 0x8322, 0x83D9, 0x8466, 0x84F4, 0x856F, 0x85EC, 0x865C, 0x86FF, 0x8796, 0x8811, 0x889B, 
-    0x8926, 0x8995, 0x8A11, 0x8A73, 0x8AD7, 0x8B39, 0x8B9B, 0x8CA1, 0x8D01, 0x8DC0, 0x8E5F, 0x8ED8, 0x8F38, 0x8FF6, 0x90A4, 0x9136, 
-    0x91D8, 0x9239, 0x929B, 0x92FD, 0x935E, 0x93C0, 0x9422, 0x9484, 0x95BF, 0x967B, 0x9710, 0x978C, 0x9802, 0x9862, 0x98FB, 0x9960, 
-    0x99ED, 0x9A4D, 0x9AF7, 0x9B6F, 0x9BCF, 0x9C2F, 0x9CBE, 0x9D36, 0x9D96, 0x9DF6, 0x9E9B, 0x9F23, 0x9F9C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4ECC, 0x5033, 0x5120, 0x5277, 0x53B1, 0x554E, 0x5682, 0x57A5, 0x58AA, 0x59C7, 0x5ACA, 0x5BF1, 0x5D1F, 0x5E1F, 0x5F46, 0x60A4, 
-    0x61B0, 0x6304, 0x6443, 0x6543, 0x667B, 0x6799, 0x68D4, 0x69D9, 0x6ABF, 0x6BA8, 0x6D09, 0x6E51, 0x6F5F, 0x7042, 0x714F, 0x723C, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x301E, 0x0000, 0x7363, 0x73EA, 0x746B, 0x74E1, 0x7577, 0x762F, 0x76B6, 
-    0x774D, 0x77D4, 0x7876, 0x78FF, 0x7983, 0x7A0C, 0x7A8C, 0x7B17, 0x7BB7, 0x7C33, 0x7CAB, 0x7D29, 0x7D8D, 0x7DEF, 0x7E52, 0x7F46, 
-    0x7FD2, 0x8072, 0x812E, 0x81C5, 0x825C, 0x8323, 0x83DA, 0x8467, 0x84F5, 0x8570, 0x85ED, 0x865D, 0x8701, 0x8798, 0x8812, 0x889D, 
-    0x8927, 0x8996, 0x8A12, 0x8A74, 0x8AD8, 0x8B3A, 0x8B9C, 0x8CA2, 0x8D02, 0x8DC1, 0x8E60, 0x8ED9, 0x8F39, 0x8FFA, 0x90A5, 0x9137, 
-    0x91D9, 0x923A, 0x929C, 0x92FE, 0x935F, 0x93C1, 0x9423, 0x9491, 0x95C0, 0x967C, 0x9711, 0x978E, 0x9803, 0x9863, 0x98FC, 0x9961, 
-    0x99EE, 0x9A4E, 0x9AF8, 0x9B70, 0x9BD0, 0x9C30, 0x9CBF, 0x9D37, 0x9D97, 0x9DF7, 0x9E9C, 0x9F24, 0x9F9D, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4ECF, 0x5034, 0x5122, 0x5278, 0x53B2, 0x554F, 0x5683, 0x57A8, 0x58AB, 0x59C8, 0x5ACB, 0x5BF2, 0x5D20, 0x5E20, 0x5F47, 0x60A5, 
-    0x61B1, 0x6305, 0x6449, 0x6544, 0x667C, 0x679B, 0x68D6, 0x69DA, 0x6AC0, 0x6BA9, 0x6D0A, 0x6E52, 0x6F60, 0x7043, 0x7150, 0x723E, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3007, 0x7364, 0x73EB, 0x746C, 0x74E5, 0x757A, 0x7631, 0x76B7, 
-    0x774E, 0x77D5, 0x7878, 0x7900, 0x7986, 0x7A0F, 0x7A8E, 0x7B18, 0x7BB9, 0x7C34, 0x7CAC, 0x7D2A, 0x7D8E, 0x7DF0, 0x7E53, 0x7F47, 
-    0x7FD3, 0x8073, 0x8130, 0x81C7, 0x825D, 0x8324, 0x83DB, 0x8468, 0x84F6, 0x8571, 0x85EE, 0x865F, 0x8704, 0x8799, 0x8814, 0x889E, 
-    0x8928, 0x8997, 0x8A13, 0x8A75, 0x8AD9, 0x8B3B, 0x8B9D, 0x8CA3, 0x8D03, 0x8DC2, 0x8E61, 0x8EDA, 0x8F3A, 0x8FFB, 0x90A7, 0x9138, 
-    0x91DA, 0x923B, 0x929D, 0x92FF, 0x9360, 0x93C2, 0x9424, 0x9496, 0x95C1, 0x967D, 0x9712, 0x978F, 0x9804, 0x9864, 0x98FD, 0x9962, 
-    0x99EF, 0x9A4F, 0x9AFA, 0x9B71, 0x9BD1, 0x9C31, 0x9CC0, 0x9D38, 0x9D98, 0x9DF8, 0x9E9E, 0x9F25, 0x9F9E, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4ED0, 0x5035, 0x5123, 0x5279, 0x53B3, 0x5551, 0x5684, 0x57AA, 0x58AC, 0x59C9, 0x5ACD, 0x5BF3, 0x5D21, 0x5E21, 0x5F48, 0x60A7, 
-    0x61B2, 0x6306, 0x644B, 0x6546, 0x667D, 0x679F, 0x68D7, 0x69DC, 0x6AC1, 0x6BAB, 0x6D0D, 0x6E55, 0x6F61, 0x7044, 0x7151, 0x7240, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7365, 0x73EC, 0x746E, 0x74E7, 0x757B, 0x7632, 0x76B8, 
-    0x774F, 0x77D6, 0x7879, 0x7902, 0x7987, 0x7A10, 0x7A8F, 0x7B1A, 0x7BBA, 0x7C35, 0x7CAD, 0x7D2C, 0x7D8F, 0x7DF1, 0x7E54, 0x7F48, 
-    0x7FD6, 0x8074, 0x8133, 0x81C8, 0x825E, 0x8325, 0x83DE, 0x846A, 0x84F7, 0x8573, 0x85EF, 0x8660, 0x8705, 0x879A, 0x8817, 0x889F, 
-    0x8929, 0x8998, 0x8A14, 0x8A76, 0x8ADA, 0x8B3C, 0x8B9E, 0x8CA4, 0x8D04, 0x8DC5, 0x8E62, 0x8EDB, 0x8F3B, 0x8FFC, 0x90A8, 0x913A, 
-    0x91DB, 0x923C, 0x929E, 0x9300, 0x9361, 0x93C3, 0x9425, 0x9498, 0x95C2, 0x967E, 0x9714, 0x9790, 0x9805, 0x9865, 0x98FE, 0x9964, 
-    0x99F0, 0x9A50, 0x9AFC, 0x9B72, 0x9BD2, 0x9C32, 0x9CC1, 0x9D39, 0x9D99, 0x9DF9, 0x9EA0, 0x9F26, 0x9FA1, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4ED2, 0x5036, 0x5124, 0x527A, 0x53B4, 0x5552, 0x5687, 0x57AC, 0x58AD, 0x59CC, 0x5ACE, 0x5BF4, 0x5D22, 0x5E22, 0x5F49, 0x60A9, 
-    0x61B3, 0x630A, 0x644C, 0x6547, 0x667F, 0x67A0, 0x68D9, 0x69DD, 0x6AC2, 0x6BAC, 0x6D0F, 0x6E57, 0x6F63, 0x7045, 0x7152, 0x7241, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7366, 0x73EE, 0x746F, 0x74E8, 0x757C, 0x7636, 0x76B9, 
-    0x7752, 0x77D8, 0x787A, 0x7903, 0x7988, 0x7A11, 0x7A90, 0x7B1C, 0x7BBB, 0x7C36, 0x7CAF, 0x7D2D, 0x7D90, 0x7DF2, 0x7E55, 0x7F49, 
-    0x7FD7, 0x8075, 0x8134, 0x81C9, 0x8260, 0x8326, 0x83E2, 0x846E, 0x84F8, 0x8575, 0x85F0, 0x8661, 0x8706, 0x879B, 0x8818, 0x88A0, 
-    0x892C, 0x8999, 0x8A15, 0x8A77, 0x8ADB, 0x8B3D, 0x8B9F, 0x8CA5, 0x8D05, 0x8DC7, 0x8E63, 0x8EDC, 0x8F3C, 0x8FFE, 0x90A9, 0x913B, 
-    0x91DD, 0x923D, 0x929F, 0x9301, 0x9362, 0x93C4, 0x9426, 0x94C7, 0x95C3, 0x967F, 0x9715, 0x9793, 0x9806, 0x9866, 0x98FF, 0x9966, 
-    0x99F1, 0x9A51, 0x9AFD, 0x9B73, 0x9BD3, 0x9C33, 0x9CC2, 0x9D3A, 0x9D9A, 0x9DFA, 0x9EA1, 0x9F27, 0x9FA2, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EDA, 0x5037, 0x5125, 0x527B, 0x53B5, 0x5553, 0x5688, 0x57AF, 0x58AE, 0x59CD, 0x5ACF, 0x5BF5, 0x5D23, 0x5E23, 0x5F4A, 0x60AA, 
-    0x61B4, 0x630B, 0x644D, 0x654A, 0x6680, 0x67A1, 0x68DB, 0x69DE, 0x6AC3, 0x6BAD, 0x6D10, 0x6E59, 0x6F64, 0x7046, 0x7153, 0x7242, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7367, 0x73EF, 0x7471, 0x74E9, 0x757D, 0x7637, 0x76BA, 
-    0x7753, 0x77D9, 0x787B, 0x7904, 0x7989, 0x7A12, 0x7A93, 0x7B1D, 0x7BBC, 0x7C37, 0x7CB0, 0x7D2E, 0x7D91, 0x7DF3, 0x7E56, 0x7F4A, 
-    0x7FD9, 0x8076, 0x8135, 0x81CB, 0x8261, 0x8329, 0x83E3, 0x846F, 0x84F9, 0x8576, 0x85F1, 0x8663, 0x870B, 0x879C, 0x8819, 0x88A1, 
-    0x892D, 0x899A, 0x8A16, 0x8A78, 0x8ADC, 0x8B3E, 0x8BAC, 0x8CA6, 0x8D06, 0x8DC8, 0x8E64, 0x8EDD, 0x8F3D, 0x8FFF, 0x90AB, 0x913C, 
-    0x91DE, 0x923E, 0x92A0, 0x9302, 0x9363, 0x93C5, 0x9427, 0x94CF, 0x95C4, 0x9680, 0x9717, 0x9795, 0x9807, 0x9867, 0x9900, 0x9973, 
-    0x99F2, 0x9A52, 0x9AFE, 0x9B74, 0x9BD4, 0x9C34, 0x9CC8, 0x9D3B, 0x9D9B, 0x9DFB, 0x9EA2, 0x9F28, 0x9FA3, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EDB, 0x5038, 0x5126, 0x527C, 0x53B7, 0x5554, 0x5689, 0x57B0, 0x58AF, 0x59CE, 0x5AD0, 0x5BF6, 0x5D25, 0x5E24, 0x5F4B, 0x60AE, 
-    0x61B5, 0x630C, 0x644E, 0x654B, 0x6681, 0x67A4, 0x68DC, 0x69E1, 0x6AC4, 0x6BAE, 0x6D11, 0x6E5A, 0x6F65, 0x7047, 0x7154, 0x7243, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7368, 0x73F0, 0x7472, 0x74EA, 0x757E, 0x7639, 0x76BB, 
-    0x7754, 0x77DA, 0x787D, 0x7906, 0x798B, 0x7A13, 0x7A94, 0x7B1F, 0x7BBD, 0x7C39, 0x7CB4, 0x7D30, 0x7D92, 0x7DF4, 0x7E57, 0x7F4B, 
-    0x7FDA, 0x8077, 0x8137, 0x81CD, 0x8262, 0x832A, 0x83E4, 0x8470, 0x84FA, 0x8577, 0x85F2, 0x8664, 0x870C, 0x879D, 0x881A, 0x88A3, 
-    0x892E, 0x899B, 0x8A17, 0x8A7A, 0x8ADD, 0x8B3F, 0x8BB1, 0x8CA7, 0x8D07, 0x8DC9, 0x8E65, 0x8EDE, 0x8F3E, 0x9007, 0x90AD, 0x913D, 
-    0x91DF, 0x923F, 0x92A1, 0x9303, 0x9364, 0x93C6, 0x9428, 0x94D3, 0x95C5, 0x9681, 0x9718, 0x9796, 0x9808, 0x9868, 0x9901, 0x9978, 
-    0x99F3, 0x9A53, 0x9AFF, 0x9B75, 0x9BD5, 0x9C35, 0x9CC9, 0x9D3C, 0x9D9C, 0x9DFC, 0x9EA3, 0x9F29, 0x9FA4, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EDC, 0x5039, 0x5127, 0x527E, 0x53B8, 0x5557, 0x568A, 0x57B1, 0x58B0, 0x59CF, 0x5AD1, 0x5BF7, 0x5D28, 0x5E25, 0x5F4C, 0x60B0, 
-    0x61B6, 0x630D, 0x644F, 0x654D, 0x6683, 0x67A6, 0x68DD, 0x69E2, 0x6AC5, 0x6BAF, 0x6D13, 0x6E5C, 0x6F67, 0x7048, 0x7155, 0x7244, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7369, 0x73F1, 0x7473, 0x74EB, 0x7580, 0x763A, 0x76BC, 
-    0x7755, 0x77DD, 0x787E, 0x7907, 0x798C, 0x7A15, 0x7A99, 0x7B21, 0x7BBE, 0x7C3A, 0x7CB5, 0x7D31, 0x7D93, 0x7DF5, 0x7E58, 0x7F4C, 
-    0x7FDB, 0x8078, 0x8139, 0x81CE, 0x8263, 0x832E, 0x83E6, 0x8472, 0x84FB, 0x8578, 0x85F3, 0x8665, 0x870E, 0x879E, 0x881C, 0x88A5, 
-    0x892F, 0x899C, 0x8A18, 0x8A7B, 0x8ADE, 0x8B40, 0x8BBB, 0x8CA8, 0x8D08, 0x8DCA, 0x8E67, 0x8EDF, 0x8F3F, 0x9008, 0x90B2, 0x913E, 
-    0x91E0, 0x9240, 0x92A2, 0x9304, 0x9365, 0x93C7, 0x9429, 0x94D4, 0x95C6, 0x9682, 0x9719, 0x9797, 0x9809, 0x9869, 0x9902, 0x9979, 
-    0x99F4, 0x9A54, 0x9B00, 0x9B76, 0x9BD6, 0x9C36, 0x9CD1, 0x9D3D, 0x9D9D, 0x9DFD, 0x9EA4, 0x9F2A, 0x9FA5, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EE0, 0x503B, 0x5128, 0x5280, 0x53B9, 0x5558, 0x568B, 0x57B3, 0x58B1, 0x59D5, 0x5AD3, 0x5BFD, 0x5D2A, 0x5E28, 0x5F4D, 0x60B3, 
-    0x61B8, 0x630F, 0x6450, 0x654E, 0x6685, 0x67A9, 0x68DE, 0x69E3, 0x6AC6, 0x6BB0, 0x6D14, 0x6E5D, 0x6F68, 0x7049, 0x7156, 0x7245, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x736A, 0x73F3, 0x7474, 0x74EC, 0x7581, 0x763B, 0x76BD, 
-    0x7756, 0x77DE, 0x787F, 0x7908, 0x798D, 0x7A16, 0x7A9A, 0x7B22, 0x7BBF, 0x7C3B, 0x7CB6, 0x7D32, 0x7D94, 0x7DF6, 0x7E59, 0x7F4D, 
-    0x7FDC, 0x8079, 0x813A, 0x81CF, 0x8264, 0x8330, 0x83E7, 0x8474, 0x84FD, 0x857C, 0x85F4, 0x8666, 0x870F, 0x87A0, 0x881D, 0x88A6, 
-    0x8931, 0x899D, 0x8A19, 0x8A7C, 0x8ADF, 0x8B41, 0x8BC7, 0x8CA9, 0x8D09, 0x8DCD, 0x8E68, 0x8EE0, 0x8F40, 0x900C, 0x90B7, 0x913F, 
-    0x91E1, 0x9241, 0x92A3, 0x9305, 0x9366, 0x93C8, 0x942A, 0x94DA, 0x95C7, 0x9683, 0x971A, 0x9799, 0x980A, 0x986A, 0x9903, 0x997B, 
-    0x99F5, 0x9A55, 0x9B01, 0x9B77, 0x9BD7, 0x9C37, 0x9CD2, 0x9D3E, 0x9D9E, 0x9DFE, 0x9EA5, 0x9F2B, 0xF92C, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EE2, 0x503D, 0x5129, 0x5283, 0x53BA, 0x5559, 0x568C, 0x57B5, 0x58B2, 0x59D6, 0x5AD5, 0x5BFE, 0x5D2B, 0x5E29, 0x5F4E, 0x60B5, 
-    0x61B9, 0x6310, 0x6451, 0x6550, 0x6686, 0x67AC, 0x68DF, 0x69E4, 0x6AC7, 0x6BB1, 0x6D15, 0x6E5E, 0x6F69, 0x704A, 0x7157, 0x7246, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x736B, 0x73F4, 0x7475, 0x74ED, 0x7582, 0x763D, 0x76BE, 
-    0x7757, 0x77DF, 0x7880, 0x7909, 0x798E, 0x7A18, 0x7A9B, 0x7B23, 0x7BC0, 0x7C3C, 0x7CB7, 0x7D33, 0x7D95, 0x7DF7, 0x7E5A, 0x7F4E, 
-    0x7FDD, 0x807A, 0x813B, 0x81D0, 0x8265, 0x8332, 0x83E8, 0x8477, 0x84FE, 0x857D, 0x85F5, 0x8667, 0x8710, 0x87A1, 0x881E, 0x88A7, 
-    0x8932, 0x899E, 0x8A1A, 0x8A7D, 0x8AE0, 0x8B42, 0x8BD0, 0x8CAA, 0x8D0A, 0x8DD0, 0x8E6A, 0x8EE1, 0x8F41, 0x900E, 0x90BC, 0x9140, 
-    0x91E2, 0x9242, 0x92A4, 0x9306, 0x9367, 0x93C9, 0x942B, 0x94E6, 0x95C8, 0x9684, 0x971B, 0x979A, 0x980B, 0x986B, 0x9904, 0x997E, 
-    0x99F6, 0x9A56, 0x9B02, 0x9B78, 0x9BD8, 0x9C38, 0x9CDA, 0x9D3F, 0x9D9F, 0x9DFF, 0x9EA7, 0x9F2D, 0xF979, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EE6, 0x503F, 0x512A, 0x5284, 0x53BC, 0x555A, 0x568D, 0x57B6, 0x58B3, 0x59D9, 0x5AD7, 0x5C00, 0x5D2C, 0x5E2A, 0x5F4F, 0x60B6, 
-    0x61BA, 0x6312, 0x6453, 0x6552, 0x6688, 0x67AE, 0x68E1, 0x69E5, 0x6AC8, 0x6BB2, 0x6D16, 0x6E60, 0x6F6A, 0x704B, 0x7158, 0x7249, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x736E, 0x73F5, 0x7478, 0x74F0, 0x7584, 0x7641, 0x76C0, 
-    0x7758, 0x77E0, 0x7881, 0x790A, 0x7990, 0x7A19, 0x7A9E, 0x7B27, 0x7BC2, 0x7C3D, 0x7CB8, 0x7D34, 0x7D96, 0x7DF8, 0x7E5B, 0x7F4F, 
-    0x7FDE, 0x807B, 0x813C, 0x81D1, 0x8266, 0x8337, 0x83EB, 0x8479, 0x8500, 0x857F, 0x85F6, 0x8668, 0x8711, 0x87A2, 0x881F, 0x88A8, 
-    0x8933, 0x899F, 0x8A1B, 0x8A7E, 0x8AE1, 0x8B43, 0x8BEA, 0x8CAB, 0x8D0B, 0x8DD2, 0x8E6B, 0x8EE2, 0x8F42, 0x9013, 0x90BD, 0x9141, 
-    0x91E3, 0x9243, 0x92A5, 0x9307, 0x9368, 0x93CB, 0x942C, 0x94FB, 0x95C9, 0x9687, 0x971D, 0x979B, 0x980C, 0x986C, 0x9905, 0x9982, 
-    0x99F7, 0x9A57, 0x9B04, 0x9B79, 0x9BD9, 0x9C39, 0x9CDB, 0x9D40, 0x9DA0, 0x9E00, 0x9EA8, 0x9F2E, 0xF995, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EE7, 0x5040, 0x512B, 0x5285, 0x53BD, 0x555B, 0x5690, 0x57B7, 0x58B4, 0x59DB, 0x5AD9, 0x5C02, 0x5D2F, 0x5E2B, 0x5F51, 0x60B7, 
-    0x61BB, 0x6313, 0x6455, 0x6553, 0x6689, 0x67B1, 0x68E2, 0x69E6, 0x6AC9, 0x6BB6, 0x6D18, 0x6E61, 0x6F6B, 0x704D, 0x7159, 0x724A, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7370, 0x73F6, 0x7479, 0x74F1, 0x7585, 0x7642, 0x76C1, 
-    0x7759, 0x77E1, 0x7882, 0x790B, 0x7991, 0x7A1B, 0x7AA1, 0x7B29, 0x7BC3, 0x7C3E, 0x7CBA, 0x7D35, 0x7D97, 0x7DF9, 0x7E5C, 0x7F52, 
-    0x7FE2, 0x807C, 0x813D, 0x81D2, 0x8267, 0x833B, 0x83EC, 0x847B, 0x8501, 0x8580, 0x85F7, 0x8669, 0x8714, 0x87A3, 0x8820, 0x88A9, 
-    0x8935, 0x89A0, 0x8A1C, 0x8A7F, 0x8AE2, 0x8B44, 0x8C09, 0x8CAC, 0x8D0C, 0x8DD3, 0x8E6E, 0x8EE3, 0x8F43, 0x9015, 0x90BF, 0x9142, 
-    0x91E4, 0x9244, 0x92A6, 0x9308, 0x9369, 0x93CC, 0x942D, 0x951C, 0x95CA, 0x9689, 0x971F, 0x979C, 0x980D, 0x986D, 0x9906, 0x9983, 
-    0x99F8, 0x9A58, 0x9B05, 0x9B7A, 0x9BDA, 0x9C3A, 0x9CE0, 0x9D41, 0x9DA1, 0x9E01, 0x9EA9, 0x9F30, 0xF9E7, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EE9, 0x5041, 0x512C, 0x5286, 0x53BE, 0x555D, 0x5691, 0x57B9, 0x58B5, 0x59DE, 0x5ADA, 0x5C03, 0x5D30, 0x5E2C, 0x5F54, 0x60B9, 
-    0x61BC, 0x6314, 0x6456, 0x6554, 0x668A, 0x67B2, 0x68E4, 0x69E7, 0x6ACA, 0x6BB8, 0x6D1C, 0x6E62, 0x6F6C, 0x704E, 0x715A, 0x724B, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7371, 0x73F7, 0x747A, 0x74F2, 0x7587, 0x7644, 0x76C3, 
-    0x775C, 0x77E4, 0x7883, 0x790C, 0x7992, 0x7A1C, 0x7AA2, 0x7B2D, 0x7BC4, 0x7C42, 0x7CBB, 0x7D36, 0x7D98, 0x7DFA, 0x7E5D, 0x7F53, 
-    0x7FE3, 0x807D, 0x813F, 0x81D3, 0x8269, 0x833D, 0x83ED, 0x847C, 0x8502, 0x8581, 0x85F8, 0x866A, 0x8716, 0x87A4, 0x8823, 0x88AA, 
-    0x8937, 0x89A1, 0x8A1D, 0x8A80, 0x8AE3, 0x8B45, 0x8C1E, 0x8CAD, 0x8D0D, 0x8DD4, 0x8E71, 0x8EE4, 0x8F44, 0x9018, 0x90C0, 0x9144, 
-    0x91E5, 0x9245, 0x92A7, 0x9309, 0x936B, 0x93CD, 0x942E, 0x9520, 0x95CB, 0x968A, 0x9720, 0x979D, 0x980E, 0x986E, 0x9907, 0x9989, 
-    0x99F9, 0x9A59, 0x9B06, 0x9B7B, 0x9BDB, 0x9C3B, 0x9CE1, 0x9D42, 0x9DA2, 0x9E02, 0x9EAA, 0x9F31, 0xF9F1, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EED, 0x5042, 0x512D, 0x5287, 0x53C0, 0x555E, 0x5692, 0x57BA, 0x58B6, 0x59DF, 0x5ADB, 0x5C05, 0x5D31, 0x5E2F, 0x5F59, 0x60BA, 
-    0x61BD, 0x6315, 0x6457, 0x6557, 0x668B, 0x67B4, 0x68E5, 0x69E8, 0x6ACB, 0x6BB9, 0x6D1D, 0x6E63, 0x6F6F, 0x7050, 0x715B, 0x724E, 
-    0x3000, 0x2170, 0xFF01, 0x3041, 0x30A1, 0x0391, 0x0410, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x554A, 
-    0x8584, 0x75C5, 0x573A, 0x7840, 0x6020, 0x4E01, 0x8D30, 0x6D6E, 0x57C2, 0x9AB8, 0x5F27, 0x808C, 0x5065, 0x5C3D, 0x4FCA, 0x9988, 
-    0x75E2, 0x9686, 0x8C29, 0x6479, 0x62E7, 0x5564, 0x6070, 0x53D6, 0x4F1E, 0x7701, 0x6055, 0x736D, 0x6C40, 0x5DCD, 0x7A00, 0x5C0F, 
-    0x9009, 0x6447, 0x5370, 0x6D74, 0x94E1, 0x5E27, 0x4F4F, 0x4E8D, 0x4F5F, 0x51C7, 0x90B8, 0x580B, 0x8368, 0x8556, 0x647A, 0x5537, 
-    0x5E37, 0x72FB, 0x606A, 0x6D39, 0x6FC9, 0x5997, 0x7EAD, 0x741B, 0x6924, 0x8F8D, 0x643F, 0x81C1, 0x603C, 0x7762, 0x94E9, 0x7A39, 
-    0x761B, 0x9889, 0x87C6, 0x7C1F, 0x9162, 0x89E5, 0x9CCC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EEE, 0x5044, 0x512E, 0x5289, 0x53C3, 0x555F, 0x5694, 0x57BB, 0x58B7, 0x59E0, 0x5ADD, 0x5C07, 0x5D32, 0x5E30, 0x5F5A, 0x60BD, 
-    0x61BF, 0x6317, 0x6459, 0x6558, 0x668D, 0x67B9, 0x68E6, 0x69E9, 0x6ACC, 0x6BBA, 0x6D1F, 0x6E64, 0x6F70, 0x7051, 0x715D, 0x724F, 
-    0x3001, 0x2171, 0xFF02, 0x3042, 0x30A2, 0x0392, 0x0411, 0x00E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x963F, 
-    0x96F9, 0x5E76, 0x5C1D, 0x50A8, 0x803D, 0x76EF, 0x53D1, 0x6DAA, 0x803F, 0x5B69, 0x864E, 0x9965, 0x8230, 0x52B2, 0x7AE3, 0x6127, 
-    0x7ACB, 0x5784, 0x8292, 0x8611, 0x6CDE, 0x813E, 0x6D3D, 0x5A36, 0x6563, 0x76DB, 0x5237, 0x631E, 0x5EF7, 0x5FAE, 0x606F, 0x5B5D, 
-    0x7663, 0x5C27, 0x82F1, 0x5BD3, 0x95F8, 0x75C7, 0x6CE8, 0x4E0C, 0x4F57, 0x5196, 0x90B0, 0x580D, 0x831B, 0x853B, 0x64B7, 0x5556, 
-    0x5E44, 0x7317, 0x607D, 0x6D27, 0x6FA7, 0x59CA, 0x7EB0, 0x741A, 0x68F0, 0x8F8E, 0x64D8, 0x81A6, 0x605D, 0x7765, 0x94EB, 0x7A37, 
-    0x763C, 0x988C, 0x8788, 0x7C2A, 0x9161, 0x89EB, 0x9CCD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EEF, 0x5045, 0x512F, 0x528A, 0x53C4, 0x5560, 0x5695, 0x57BC, 0x58B8, 0x59E1, 0x5ADE, 0x5C08, 0x5D33, 0x5E32, 0x5F5B, 0x60BE, 
-    0x61C0, 0x6318, 0x645A, 0x655A, 0x668E, 0x67BA, 0x68E7, 0x69EA, 0x6ACD, 0x6BBB, 0x6D20, 0x6E65, 0x6F71, 0x7052, 0x715F, 0x7250, 
-    0x3002, 0x2172, 0xFF03, 0x3043, 0x30A3, 0x0393, 0x0412, 0x01CE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x57C3, 
-    0x4FDD, 0x73BB, 0x5E38, 0x77D7, 0x62C5, 0x53EE, 0x7F5A, 0x798F, 0x6897, 0x6D77, 0x552C, 0x8FF9, 0x5251, 0x8346, 0x6D5A, 0x6E83, 
-    0x7C92, 0x62E2, 0x832B, 0x6A21, 0x725B, 0x75B2, 0x7275, 0x9F8B, 0x6851, 0x5269, 0x800D, 0x8E4B, 0x505C, 0x5371, 0x5E0C, 0x6821, 
-    0x7729, 0x9065, 0x6A31, 0x88D5, 0x7728, 0x90D1, 0x795D, 0x5140, 0x4F32, 0x51A2, 0x90CF, 0x57FD, 0x8369, 0x84FF, 0x64B8, 0x5575, 
-    0x5E54, 0x7313, 0x6096, 0x6D0C, 0x6FB9, 0x59AB, 0x7EBE, 0x7441, 0x690B, 0x8F8F, 0x8004, 0x6B24, 0x605A, 0x777F, 0x94EE, 0x7A51, 
-    0x7622, 0x988D, 0x8785, 0x7C26, 0x9170, 0x89EF, 0x9CCE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EF1, 0x5046, 0x5130, 0x528B, 0x53C5, 0x5562, 0x5696, 0x57BD, 0x58B9, 0x59E2, 0x5ADF, 0x5C0B, 0x5D35, 0x5E33, 0x5F5C, 0x60BF, 
-    0x61C1, 0x6319, 0x645B, 0x655C, 0x668F, 0x67BB, 0x68E8, 0x69EB, 0x6ACE, 0x6BBC, 0x6D21, 0x6E66, 0x6F73, 0x7053, 0x7160, 0x7251, 
-    0x00B7, 0x2173, 0xFFE5, 0x3044, 0x30A4, 0x0394, 0x0413, 0x00E0, 0x2500, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6328, 
-    0x5821, 0x83E0, 0x957F, 0x6410, 0x4E39, 0x9489, 0x7B4F, 0x88B1, 0x5DE5, 0x6C26, 0x62A4, 0x6FC0, 0x996F, 0x5162, 0x90E1, 0x5764, 
-    0x6CA5, 0x9647, 0x76F2, 0x819C, 0x626D, 0x76AE, 0x6266, 0x8DA3, 0x55D3, 0x80DC, 0x6454, 0x8E0F, 0x4EAD, 0x97E6, 0x6089, 0x8096, 
-    0x7EDA, 0x7A91, 0x5A74, 0x9884, 0x6805, 0x8BC1, 0x9A7B, 0x4E10, 0x4F3D, 0x51A5, 0x90C5, 0x57ED, 0x836C, 0x84FC, 0x6499, 0x5576, 
-    0x5E5B, 0x7321, 0x609A, 0x6D43, 0x6FB6, 0x599E, 0x7EC0, 0x745C, 0x6901, 0x8F98, 0x6BEA, 0x6B37, 0x6067, 0x778D, 0x94EF, 0x9ECF, 
-    0x7620, 0x988F, 0x87AD, 0x7C38, 0x9169, 0x8A3E, 0x9CCF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EF4, 0x5049, 0x5131, 0x528C, 0x53C6, 0x5563, 0x5697, 0x57BE, 0x58BA, 0x59E4, 0x5AE2, 0x5C0C, 0x5D36, 0x5E34, 0x5F5E, 0x60C0, 
-    0x61C3, 0x631C, 0x645C, 0x655F, 0x6690, 0x67BC, 0x68E9, 0x69EC, 0x6ACF, 0x6BBD, 0x6D22, 0x6E67, 0x6F75, 0x7054, 0x7161, 0x7253, 
-    0x02C9, 0x2174, 0xFF05, 0x3045, 0x30A5, 0x0395, 0x0414, 0x0113, 0x2501, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x54CE, 
-    0x9971, 0x64AD, 0x507F, 0x89E6, 0x5355, 0x9876, 0x4F10, 0x5F17, 0x653B, 0x4EA5, 0x4E92, 0x8BA5, 0x6E10, 0x830E, 0x9A8F, 0x6606, 
-    0x96B6, 0x697C, 0x6C13, 0x78E8, 0x94AE, 0x5339, 0x948E, 0x53BB, 0x4E27, 0x5723, 0x8870, 0x80CE, 0x5EAD, 0x8FDD, 0x819D, 0x5578, 
-    0x9774, 0x8C23, 0x9E70, 0x8C6B, 0x69A8, 0x829D, 0x6293, 0x5EFF, 0x4F76, 0x8BA0, 0x90BE, 0x5800, 0x836A, 0x8559, 0x64BA, 0x5577, 
-    0x5E5E, 0x730A, 0x60AD, 0x6D48, 0x6FC2, 0x59A4, 0x7EC1, 0x7457, 0x6957, 0x8F9A, 0x6BF3, 0x6B39, 0x6041, 0x777D, 0x94F3, 0x99A5, 
-    0x7640, 0x9894, 0x8797, 0x7C41, 0x916F, 0x8B26, 0x9CD0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EF8, 0x504A, 0x5132, 0x528D, 0x53C7, 0x5568, 0x5698, 0x57BF, 0x58BB, 0x59E6, 0x5AE4, 0x5C0D, 0x5D37, 0x5E35, 0x5F5F, 0x60C1, 
-    0x61C4, 0x6326, 0x645D, 0x6560, 0x6692, 0x67BD, 0x68EA, 0x69EE, 0x6AD0, 0x6BBE, 0x6D23, 0x6E68, 0x6F76, 0x7055, 0x7162, 0x7254, 
-    0x02C7, 0x2175, 0xFF06, 0x3046, 0x30A6, 0x0396, 0x0415, 0x00E9, 0x2502, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5509, 
-    0x5B9D, 0x62E8, 0x80A0, 0x5904, 0x90F8, 0x9F0E, 0x4E4F, 0x752B, 0x529F, 0x5BB3, 0x6CAA, 0x9E21, 0x6E85, 0x775B, 0x5580, 0x6346, 
-    0x529B, 0x5A04, 0x5FD9, 0x6469, 0x7EBD, 0x75DE, 0x94C5, 0x5708, 0x6414, 0x5E08, 0x7529, 0x82D4, 0x633A, 0x6845, 0x5915, 0x7B11, 
-    0x859B, 0x59DA, 0x5E94, 0x9A6D, 0x548B, 0x679D, 0x722A, 0x5345, 0x4F74, 0x8BA6, 0x90D0, 0x581E, 0x836D, 0x8548, 0x64C0, 0x5533, 
-    0x5E61, 0x731E, 0x609D, 0x6D07, 0x6FE1, 0x59D2, 0x7EC2, 0x7455, 0x68E3, 0x8ECE, 0x6BFD, 0x6B43, 0x6059, 0x7780, 0x94F4, 0x7A70, 
-    0x762D, 0x989A, 0x8783, 0x7C40, 0x917D, 0x9753, 0x9CD3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EF9, 0x504B, 0x5133, 0x528E, 0x53CE, 0x5569, 0x5699, 0x57C0, 0x58BD, 0x59E7, 0x5AE5, 0x5C0E, 0x5D38, 0x5E36, 0x5F60, 0x60C2, 
-    0x61C5, 0x6327, 0x645F, 0x6561, 0x6693, 0x67BE, 0x68EB, 0x69EF, 0x6AD1, 0x6BC0, 0x6D24, 0x6E69, 0x6F77, 0x7056, 0x7163, 0x7255, 
-    0x00A8, 0x2176, 0xFF07, 0x3047, 0x30A7, 0x0397, 0x0401, 0x011B, 0x2503, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x54C0, 
-    0x62B1, 0x94B5, 0x5382, 0x63E3, 0x63B8, 0x952D, 0x9600, 0x629A, 0x606D, 0x9A87, 0x6237, 0x59EC, 0x6DA7, 0x6676, 0x5496, 0x56F0, 
-    0x7483, 0x6402, 0x83BD, 0x9B54, 0x8113, 0x50FB, 0x5343, 0x98A7, 0x9A9A, 0x5931, 0x5E05, 0x62AC, 0x8247, 0x56F4, 0x60DC, 0x6548, 
-    0x5B66, 0x54AC, 0x7F28, 0x9E33, 0x4E4D, 0x652F, 0x62FD, 0x4E15, 0x4F91, 0x8BA7, 0x90C4, 0x5819, 0x836E, 0x8568, 0x64D0, 0x5530, 
-    0x5C8C, 0x731D, 0x6083, 0x6D04, 0x6FEE, 0x59B2, 0x7EC9, 0x7459, 0x6910, 0x620B, 0x6BF5, 0x6B46, 0x6063, 0x778C, 0x94F5, 0x7688, 
-    0x7630, 0x989B, 0x87AB, 0x81FE, 0x917E, 0x96E9, 0x9CD4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EFA, 0x504D, 0x5134, 0x528F, 0x53CF, 0x556B, 0x569A, 0x57C1, 0x58BE, 0x59E9, 0x5AE7, 0x5C10, 0x5D39, 0x5E39, 0x5F63, 0x60C3, 
-    0x61C6, 0x6329, 0x6460, 0x6564, 0x6694, 0x67BF, 0x68EC, 0x69F0, 0x6AD2, 0x6BC3, 0x6D26, 0x6E6A, 0x6F79, 0x7057, 0x7165, 0x7257, 
-    0x3003, 0x2177, 0xFF08, 0x3048, 0x30A8, 0x0398, 0x0416, 0x00E8, 0x2504, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7691, 
-    0x62A5, 0x6CE2, 0x655E, 0x5DDD, 0x80C6, 0x5B9A, 0x6CD5, 0x8F85, 0x9F9A, 0x9163, 0x82B1, 0x7EE9, 0x5EFA, 0x9CB8, 0x5361, 0x62EC, 
-    0x54E9, 0x7BD3, 0x732B, 0x62B9, 0x6D53, 0x5C41, 0x8FC1, 0x6743, 0x626B, 0x72EE, 0x6813, 0x53F0, 0x901A, 0x552F, 0x7184, 0x6954, 
-    0x7A74, 0x8200, 0x83B9, 0x6E0A, 0x70B8, 0x5431, 0x4E13, 0x4E98, 0x4F89, 0x8BAA, 0x90C7, 0x5844, 0x83B0, 0x8564, 0x64D7, 0x555C, 
-    0x5C7A, 0x7315, 0x6092, 0x6D19, 0x6FDE, 0x59AF, 0x7ECB, 0x7477, 0x6971, 0x6217, 0x6BF9, 0x6B59, 0x60AB, 0x7791, 0x94F7, 0x768E, 
-    0x763F, 0x989E, 0x87E5, 0x8201, 0x9172, 0x96F3, 0x9CD5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EFC, 0x5050, 0x5135, 0x5291, 0x53D0, 0x556F, 0x569B, 0x57C4, 0x58BF, 0x59EA, 0x5AE8, 0x5C12, 0x5D3A, 0x5E3A, 0x5F65, 0x60C4, 
-    0x61C7, 0x632C, 0x6461, 0x6565, 0x6695, 0x67C0, 0x68ED, 0x69F1, 0x6AD3, 0x6BC4, 0x6D28, 0x6E6C, 0x6F7B, 0x7058, 0x7169, 0x7258, 
-    0x3005, 0x2178, 0xFF09, 0x3049, 0x30A9, 0x0399, 0x0417, 0x012B, 0x2505, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x764C, 
-    0x66B4, 0x535A, 0x7545, 0x7A7F, 0x65E6, 0x8BA2, 0x73D0, 0x4FEF, 0x4F9B, 0x61A8, 0x54D7, 0x7F09, 0x50F5, 0x4EAC, 0x54AF, 0x6269, 
-    0x4FE9, 0x6F0F, 0x8305, 0x672B, 0x519C, 0x8B6C, 0x7B7E, 0x919B, 0x5AC2, 0x65BD, 0x62F4, 0x6CF0, 0x6850, 0x60DF, 0x70EF, 0x4E9B, 
-    0x96EA, 0x836F, 0x8424, 0x51A4, 0x8BC8, 0x8718, 0x7816, 0x4E1E, 0x4F83, 0x8BB4, 0x90D3, 0x5820, 0x8378, 0x855E, 0x64E4, 0x558B, 
-    0x5C8D, 0x7322, 0x608C, 0x6D0E, 0x6FE0, 0x59D7, 0x7ECC, 0x746D, 0x6939, 0x621B, 0x6C05, 0x98D1, 0x6106, 0x779F, 0x94F9, 0x7693, 
-    0x7635, 0x989F, 0x87AC, 0x8202, 0x9174, 0x96EF, 0x9CD7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4EFE, 0x5051, 0x5136, 0x5292, 0x53D2, 0x5570, 0x569C, 0x57C5, 0x58C0, 0x59EB, 0x5AEA, 0x5C13, 0x5D3B, 0x5E3E, 0x5F67, 0x60C7, 
-    0x61C9, 0x632D, 0x6462, 0x6567, 0x6698, 0x67C2, 0x68EF, 0x69F3, 0x6AD4, 0x6BC6, 0x6D29, 0x6E6D, 0x6F7D, 0x7059, 0x716A, 0x725A, 
-    0x2014, 0x2179, 0xFF0A, 0x304A, 0x30AA, 0x039A, 0x0418, 0x00ED, 0x2506, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x853C, 
-    0x8C79, 0x52C3, 0x5531, 0x693D, 0x6C2E, 0x4E22, 0x85E9, 0x91DC, 0x8EAC, 0x90AF, 0x534E, 0x5409, 0x59DC, 0x60CA, 0x5F00, 0x5ED3, 
-    0x8054, 0x964B, 0x951A, 0x83AB, 0x5F04, 0x7BC7, 0x4EDF, 0x6CC9, 0x745F, 0x6E7F, 0x971C, 0x915E, 0x916E, 0x4E3A, 0x6EAA, 0x6B47, 
-    0x8840, 0x8981, 0x8425, 0x5143, 0x6458, 0x77E5, 0x8F6C, 0x9B32, 0x4F8F, 0x8BB5, 0x90E6, 0x5865, 0x83B3, 0x857A, 0x64E2, 0x55D2, 
-    0x5C90, 0x7339, 0x609B, 0x6D2B, 0x6FEF, 0x59BE, 0x7ED0, 0x747E, 0x6960, 0x621F, 0x6C07, 0x98D2, 0x610D, 0x77A0, 0x94FC, 0x7699, 
-    0x7643, 0x98A1, 0x87B5, 0x8204, 0x9179, 0x9706, 0x9CD8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F00, 0x5052, 0x5137, 0x5294, 0x53D3, 0x5571, 0x569D, 0x57C6, 0x58C2, 0x59ED, 0x5AEC, 0x5C17, 0x5D3C, 0x5E3F, 0x5F68, 0x60C8, 
-    0x61CC, 0x632E, 0x6463, 0x6568, 0x6699, 0x67C5, 0x68F2, 0x69F4, 0x6AD5, 0x6BC7, 0x6D2C, 0x6E6F, 0x6F7E, 0x705A, 0x716B, 0x725C, 
-    0xFF5E, 0x0000, 0xFF0B, 0x304B, 0x30AB, 0x039B, 0x0419, 0x01D0, 0x2507, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x77EE, 
-    0x9C8D, 0x640F, 0x5021, 0x4F20, 0x4F46, 0x4E1C, 0x5E06, 0x65A7, 0x516C, 0x97E9, 0x733E, 0x6781, 0x5C06, 0x7CBE, 0x63E9, 0x9614, 
-    0x83B2, 0x82A6, 0x6BDB, 0x58A8, 0x5974, 0x504F, 0x8C26, 0x5168, 0x8272, 0x8BD7, 0x53CC, 0x592A, 0x77B3, 0x6F4D, 0x6C50, 0x874E, 
-    0x52CB, 0x8000, 0x8367, 0x57A3, 0x658B, 0x80A2, 0x64B0, 0x5B6C, 0x4F7E, 0x8BB7, 0x90E2, 0x586C, 0x83B4, 0x77A2, 0x6509, 0x5583, 
-    0x5C96, 0x7325, 0x60EC, 0x6D4D, 0x701A, 0x5A05, 0x7ED4, 0x749C, 0x6942, 0x6222, 0x6C06, 0x98D3, 0x615D, 0x77B0, 0x94FD, 0x76A4, 
-    0x763E, 0x98A2, 0x87B3, 0x81EC, 0x918C, 0x9701, 0x9CD9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F02, 0x5053, 0x5138, 0x5295, 0x53D5, 0x5572, 0x569E, 0x57C7, 0x58C3, 0x59EE, 0x5AED, 0x5C19, 0x5D3F, 0x5E40, 0x5F6B, 0x60C9, 
-    0x61CD, 0x6330, 0x6464, 0x6569, 0x669A, 0x67C6, 0x68F3, 0x69F5, 0x6AD6, 0x6BC8, 0x6D2D, 0x6E70, 0x6F7F, 0x705B, 0x716C, 0x725E, 
-    0x2016, 0x0000, 0xFF0C, 0x304C, 0x30AC, 0x039C, 0x041A, 0x00EC, 0x2508, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x827E, 
-    0x7206, 0x94C2, 0x8D85, 0x8239, 0x60EE, 0x51AC, 0x756A, 0x812F, 0x5BAB, 0x542B, 0x6ED1, 0x68D8, 0x6D46, 0x7CB3, 0x6977, 0x5783, 
-    0x8FDE, 0x5362, 0x77DB, 0x9ED8, 0x52AA, 0x7247, 0x4E7E, 0x75CA, 0x6DA9, 0x5C38, 0x723D, 0x6001, 0x540C, 0x7EF4, 0x7280, 0x978B, 
-    0x718F, 0x6930, 0x8747, 0x8881, 0x5B85, 0x8102, 0x8D5A, 0x5669, 0x4F7B, 0x8BC2, 0x90DC, 0x5881, 0x83A0, 0x8543, 0x6525, 0x55B1, 
-    0x5C88, 0x732C, 0x60BB, 0x6D2E, 0x7023, 0x5A06, 0x7ED7, 0x748E, 0x695D, 0x6221, 0x6C0D, 0x98D5, 0x61A9, 0x77B5, 0x94FF, 0x74DE, 
-    0x7633, 0x98A5, 0x87CB, 0x8844, 0x9185, 0x9708, 0x9CDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F03, 0x5054, 0x5139, 0x5296, 0x53DA, 0x5573, 0x569F, 0x57C8, 0x58C4, 0x59EF, 0x5AEE, 0x5C1B, 0x5D40, 0x5E41, 0x5F6E, 0x60CC, 
-    0x61CE, 0x6331, 0x6465, 0x656A, 0x669B, 0x67C7, 0x68F4, 0x69F6, 0x6AD7, 0x6BC9, 0x6D2F, 0x6E71, 0x6F80, 0x705C, 0x716D, 0x7260, 
-    0x2026, 0x0000, 0xFF0D, 0x304D, 0x30AD, 0x039D, 0x041B, 0x014D, 0x2509, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x788D, 
-    0x676F, 0x7B94, 0x6284, 0x5598, 0x6DE1, 0x8463, 0x7FFB, 0x8151, 0x5F13, 0x6DB5, 0x753B, 0x8F91, 0x6C5F, 0x7ECF, 0x51EF, 0x62C9, 
-    0x9570, 0x9885, 0x94C6, 0x6CAB, 0x6012, 0x9A97, 0x9ED4, 0x62F3, 0x68EE, 0x8671, 0x8C01, 0x6C70, 0x94DC, 0x82C7, 0x6A84, 0x534F, 
-    0x5FAA, 0x564E, 0x8FCE, 0x539F, 0x7A84, 0x6C41, 0x7BC6, 0x4E28, 0x4FAA, 0x8BC3, 0x90D7, 0x5889, 0x83AA, 0x8572, 0x652E, 0x55B9, 
-    0x5C98, 0x7338, 0x60B1, 0x6D35, 0x701B, 0x59DD, 0x7EDB, 0x7480, 0x6984, 0x6225, 0x6C15, 0x98D9, 0x619D, 0x77BD, 0x9503, 0x74E0, 
-    0x764D, 0x98A6, 0x87D3, 0x8221, 0x9190, 0x970F, 0x9CDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F04, 0x5056, 0x513A, 0x5297, 0x53DC, 0x5574, 0x56A0, 0x57C9, 0x58C6, 0x59F0, 0x5AEF, 0x5C1E, 0x5D41, 0x5E43, 0x5F6F, 0x60CD, 
-    0x61CF, 0x6333, 0x6466, 0x656D, 0x669C, 0x67C8, 0x68F6, 0x69F7, 0x6AD8, 0x6BCA, 0x6D30, 0x6E72, 0x6F81, 0x705D, 0x716F, 0x7263, 
-    0x2018, 0x0000, 0xFF0E, 0x304E, 0x30AE, 0x039E, 0x041C, 0x00F3, 0x250A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7231, 
-    0x7891, 0x4F2F, 0x949E, 0x4E32, 0x8BDE, 0x61C2, 0x6A0A, 0x5E9C, 0x5DE9, 0x5BD2, 0x5212, 0x7C4D, 0x7586, 0x4E95, 0x6168, 0x5587, 
-    0x5EC9, 0x5E90, 0x536F, 0x6F20, 0x5973, 0x98D8, 0x94B1, 0x72AC, 0x50E7, 0x5341, 0x6C34, 0x574D, 0x5F64, 0x840E, 0x88AD, 0x631F, 
-    0x65EC, 0x8036, 0x8D62, 0x63F4, 0x503A, 0x4E4B, 0x6869, 0x79BA, 0x4F7C, 0x8BCB, 0x90DB, 0x589A, 0x8393, 0x857B, 0x5F0B, 0x5588, 
-    0x5C99, 0x7331, 0x60DD, 0x6D1A, 0x7039, 0x5A08, 0x7EE0, 0x7481, 0x696B, 0x6224, 0x6C18, 0x98DA, 0x61CB, 0x753A, 0x9502, 0x752C, 
-    0x765E, 0x864D, 0x87BD, 0x8222, 0x918D, 0x970E, 0x9CDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F05, 0x5057, 0x513B, 0x5298, 0x53DD, 0x5579, 0x56A1, 0x57CA, 0x58C7, 0x59F1, 0x5AF0, 0x5C1F, 0x5D42, 0x5E46, 0x5F72, 0x60CE, 
-    0x61D0, 0x6334, 0x6468, 0x656E, 0x669E, 0x67C9, 0x68F7, 0x69F8, 0x6AD9, 0x6BCC, 0x6D34, 0x6E73, 0x6F82, 0x705F, 0x7170, 0x7264, 
-    0x2019, 0x0000, 0xFF0F, 0x304F, 0x30AF, 0x039F, 0x041D, 0x01D2, 0x250B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9698, 
-    0x60B2, 0x5E1B, 0x671D, 0x75AE, 0x5F39, 0x52A8, 0x77FE, 0x8150, 0x6C5E, 0x51FD, 0x5316, 0x96C6, 0x848B, 0x8B66, 0x520A, 0x8721, 
-    0x601C, 0x7089, 0x8302, 0x5BDE, 0x6696, 0x6F02, 0x94B3, 0x5238, 0x838E, 0x77F3, 0x7761, 0x644A, 0x7AE5, 0x59D4, 0x5E2D, 0x643A, 
-    0x8BE2, 0x7237, 0x76C8, 0x8F95, 0x5BE8, 0x7EC7, 0x5E84, 0x4E3F, 0x4FAC, 0x8BCF, 0x90EB, 0x5880, 0x839C, 0x85A4, 0x5FD2, 0x5581, 
-    0x5C91, 0x7350, 0x60D8, 0x6D4F, 0x7035, 0x59E3, 0x7EE1, 0x7487, 0x6980, 0x622C, 0x6C19, 0x6BB3, 0x61D1, 0x7540, 0x9506, 0x9E20, 
-    0x7654, 0x8654, 0x87D1, 0x8223, 0x9191, 0x972A, 0x9CE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F06, 0x5058, 0x513C, 0x5299, 0x53DE, 0x557A, 0x56A2, 0x57CC, 0x58C8, 0x59F2, 0x5AF2, 0x5C20, 0x5D43, 0x5E47, 0x5F74, 0x60CF, 
-    0x61D3, 0x6335, 0x646A, 0x656F, 0x669F, 0x67CA, 0x68F8, 0x69F9, 0x6ADA, 0x6BCE, 0x6D36, 0x6E74, 0x6F83, 0x7060, 0x7171, 0x7265, 
-    0x201C, 0x0000, 0xFF10, 0x3050, 0x30B0, 0x03A0, 0x041E, 0x00F2, 0x250C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x978D, 
-    0x5351, 0x8236, 0x5632, 0x7A97, 0x86CB, 0x680B, 0x9492, 0x8D74, 0x62F1, 0x558A, 0x8BDD, 0x53CA, 0x6868, 0x666F, 0x582A, 0x814A, 
-    0x6D9F, 0x63B3, 0x5192, 0x964C, 0x8650, 0x74E2, 0x524D, 0x529D, 0x7802, 0x62FE, 0x7A0E, 0x8D2A, 0x6876, 0x4F1F, 0x4E60, 0x90AA, 
-    0x5BFB, 0x91CE, 0x5F71, 0x56ED, 0x77BB, 0x804C, 0x88C5, 0x5315, 0x4F94, 0x8BCE, 0x90EF, 0x99A8, 0x8385, 0x85A8, 0x7519, 0x559F, 
-    0x5C9A, 0x734D, 0x60C6, 0x6D52, 0x704F, 0x59D8, 0x7EE8, 0x748B, 0x6998, 0x81E7, 0x6C1A, 0x5F40, 0x6206, 0x754E, 0x9507, 0x9E22, 
-    0x765C, 0x866C, 0x87C0, 0x822D, 0x91A2, 0x972D, 0x977C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F07, 0x5059, 0x513D, 0x529A, 0x53E1, 0x557D, 0x56A4, 0x57CD, 0x58C9, 0x59F3, 0x5AF3, 0x5C21, 0x5D44, 0x5E48, 0x5F75, 0x60D0, 
-    0x61D5, 0x6336, 0x646B, 0x6571, 0x66A0, 0x67CB, 0x68FB, 0x69FA, 0x6ADB, 0x6BD0, 0x6D37, 0x6E75, 0x6F85, 0x7061, 0x7174, 0x7268, 
-    0x201D, 0x2488, 0xFF11, 0x3051, 0x30B1, 0x03A1, 0x041F, 0x016B, 0x250D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6C28, 
-    0x5317, 0x8116, 0x6F6E, 0x5E62, 0x5F53, 0x4F97, 0x7E41, 0x526F, 0x8D21, 0x7F55, 0x69D0, 0x6025, 0x5956, 0x9888, 0x52D8, 0x8FA3, 
-    0x5E18, 0x5364, 0x5E3D, 0x8C0B, 0x759F, 0x7968, 0x6F5C, 0x7F3A, 0x6740, 0x65F6, 0x542E, 0x762B, 0x6345, 0x4F2A, 0x5AB3, 0x659C, 
-    0x9A6F, 0x51B6, 0x9896, 0x5458, 0x6BE1, 0x76F4, 0x5986, 0x4E47, 0x4FE6, 0x8BD2, 0x90FE, 0x9F19, 0x837C, 0x8587, 0x5F11, 0x557E, 
-    0x5C9C, 0x7357, 0x60DA, 0x6D54, 0x705E, 0x59F9, 0x7EEB, 0x749E, 0x6978, 0x74EF, 0x6C21, 0x6BC2, 0x8080, 0x754B, 0x9509, 0x9E28, 
-    0x7656, 0x866E, 0x87CA, 0x822F, 0x91A3, 0x9730, 0x9785, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F08, 0x505B, 0x513E, 0x529C, 0x53E2, 0x557F, 0x56A5, 0x57D0, 0x58CA, 0x59F4, 0x5AF4, 0x5C23, 0x5D45, 0x5E49, 0x5F76, 0x60D2, 
-    0x61D6, 0x6337, 0x646C, 0x6573, 0x66A1, 0x67CC, 0x68FD, 0x69FB, 0x6ADC, 0x6BD1, 0x6D38, 0x6E76, 0x6F86, 0x7062, 0x7175, 0x726A, 
-    0x3014, 0x2489, 0xFF12, 0x3052, 0x30B2, 0x03A3, 0x0420, 0x00FA, 0x250E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B89, 
-    0x8F88, 0x818A, 0x5DE2, 0x5E8A, 0x6321, 0x606B, 0x51E1, 0x8986, 0x5171, 0x7FF0, 0x5F8A, 0x75BE, 0x8BB2, 0x9759, 0x574E, 0x5566, 
-    0x655B, 0x864F, 0x8C8C, 0x725F, 0x632A, 0x6487, 0x9063, 0x7094, 0x5239, 0x4EC0, 0x77AC, 0x6EE9, 0x7B52, 0x5C3E, 0x559C, 0x80C1, 
-    0x5DE1, 0x4E5F, 0x786C, 0x5706, 0x8A79, 0x690D, 0x649E, 0x592D, 0x4FE8, 0x8BD3, 0x9104, 0x61FF, 0x83B6, 0x858F, 0x535F, 0x55D6, 
-    0x5CB5, 0x7360, 0x60B4, 0x6D33, 0x5B80, 0x5A0C, 0x7EEE, 0x74A8, 0x6934, 0x74F4, 0x6C29, 0x89F3, 0x807F, 0x7548, 0x950A, 0x9E29, 
-    0x766B, 0x867F, 0x87DB, 0x8228, 0x91AA, 0x973E, 0x9791, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F0B, 0x505D, 0x5142, 0x52A4, 0x53E7, 0x5585, 0x56A6, 0x57D1, 0x58CB, 0x59F5, 0x5AF5, 0x5C26, 0x5D46, 0x5E4A, 0x5F78, 0x60D3, 
-    0x61D7, 0x6338, 0x646E, 0x6575, 0x66A2, 0x67CD, 0x68FE, 0x69FC, 0x6ADD, 0x6BD8, 0x6D3A, 0x6E77, 0x6F87, 0x7063, 0x7176, 0x726B, 
-    0x3015, 0x248A, 0xFF13, 0x3053, 0x30B3, 0x03A4, 0x0421, 0x01D4, 0x250F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4FFA, 
-    0x80CC, 0x6E24, 0x5435, 0x95EF, 0x515A, 0x51BB, 0x70E6, 0x8D4B, 0x94A9, 0x64BC, 0x6000, 0x6C72, 0x5320, 0x5883, 0x780D, 0x83B1, 
-    0x8138, 0x9C81, 0x8D38, 0x67D0, 0x61E6, 0x77A5, 0x6D45, 0x7638, 0x6C99, 0x98DF, 0x987A, 0x575B, 0x7EDF, 0x7EAC, 0x94E3, 0x8C10, 
-    0x6B89, 0x9875, 0x6620, 0x733F, 0x7C98, 0x6B96, 0x58EE, 0x723B, 0x4FEA, 0x8BD4, 0x9122, 0x8279, 0x83A9, 0x8579, 0x53F1, 0x5591, 
-    0x5CA2, 0x736C, 0x6120, 0x6D91, 0x5B84, 0x5A09, 0x7EEF, 0x74A9, 0x69CC, 0x74FF, 0x6C24, 0x6590, 0x6C93, 0x755B, 0x950D, 0x9E2A, 
-    0x766F, 0x867A, 0x87EA, 0x822B, 0x91AD, 0x9F80, 0x9792, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F0C, 0x505E, 0x5147, 0x52A5, 0x53F4, 0x5586, 0x56A7, 0x57D3, 0x58CC, 0x59F6, 0x5AF6, 0x5C28, 0x5D48, 0x5E4B, 0x5F7A, 0x60D4, 
-    0x61D8, 0x633B, 0x646F, 0x6576, 0x66A3, 0x67CE, 0x68FF, 0x69FE, 0x6ADE, 0x6BDA, 0x6D3F, 0x6E78, 0x6F8A, 0x7064, 0x7177, 0x726C, 
-    0x3008, 0x248B, 0xFF14, 0x3054, 0x30B4, 0x03A5, 0x0422, 0x00F9, 0x2510, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6309, 
-    0x8D1D, 0x6CCA, 0x7092, 0x521B, 0x8361, 0x6D1E, 0x53CD, 0x590D, 0x52FE, 0x634D, 0x6DEE, 0x5373, 0x9171, 0x656C, 0x770B, 0x6765, 
-    0x94FE, 0x9E93, 0x4E48, 0x62C7, 0x7CEF, 0x62FC, 0x8C34, 0x5374, 0x7EB1, 0x8680, 0x821C, 0x6A80, 0x75DB, 0x672A, 0x6D17, 0x5199, 
-    0x6C5B, 0x6396, 0x54DF, 0x6E90, 0x6CBE, 0x6267, 0x72B6, 0x536E, 0x4FC5, 0x8BD6, 0x911E, 0x827D, 0x837D, 0x85AE, 0x53FD, 0x557B, 
-    0x5CBD, 0x736F, 0x6126, 0x6D6F, 0x5B95, 0x5A32, 0x7EF1, 0x7490, 0x6987, 0x750F, 0x6C2A, 0x9F51, 0x6CF6, 0x7572, 0x950E, 0x9E2B, 
-    0x7FCA, 0x867C, 0x87E0, 0x8238, 0x91AE, 0x9F83, 0x9794, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F12, 0x505F, 0x514A, 0x52A6, 0x53FA, 0x558C, 0x56A8, 0x57D6, 0x58CD, 0x59F7, 0x5AF7, 0x5C29, 0x5D49, 0x5E4D, 0x5F7D, 0x60D6, 
-    0x61D9, 0x633C, 0x6470, 0x6578, 0x66A4, 0x67D5, 0x6900, 0x6A00, 0x6ADF, 0x6BDC, 0x6D40, 0x6E79, 0x6F8B, 0x7065, 0x7179, 0x726D, 
-    0x3009, 0x248C, 0xFF15, 0x3055, 0x30B5, 0x03A6, 0x0423, 0x01D6, 0x2511, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6697, 
-    0x94A1, 0x9A73, 0x8F66, 0x5439, 0x6863, 0x515C, 0x8FD4, 0x5085, 0x6C9F, 0x65F1, 0x574F, 0x5AC9, 0x964D, 0x955C, 0x5EB7, 0x8D56, 
-    0x604B, 0x788C, 0x73AB, 0x7261, 0x8BFA, 0x9891, 0x5811, 0x9E4A, 0x50BB, 0x5B9E, 0x8BF4, 0x75F0, 0x5077, 0x851A, 0x7CFB, 0x68B0, 
-    0x8BAD, 0x4E1A, 0x62E5, 0x7F18, 0x76CF, 0x503C, 0x690E, 0x6C10, 0x4FDA, 0x8BD8, 0x9123, 0x827F, 0x83B8, 0x859C, 0x53E9, 0x55DF, 
-    0x5CAC, 0x737E, 0x6115, 0x6D9E, 0x5B93, 0x5A34, 0x7EF2, 0x74A7, 0x6988, 0x7511, 0x6C32, 0x6593, 0x6DFC, 0x7579, 0x950F, 0x9E2C, 
-    0x7AE6, 0x867B, 0x87EE, 0x823B, 0x91AF, 0x9F85, 0x97AF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F13, 0x5060, 0x514C, 0x52A7, 0x53FE, 0x558D, 0x56A9, 0x57D7, 0x58CE, 0x59F8, 0x5AF8, 0x5C2A, 0x5D4D, 0x5E4E, 0x5F7E, 0x60D7, 
-    0x61DA, 0x633E, 0x6471, 0x6579, 0x66A5, 0x67D6, 0x6902, 0x6A01, 0x6AE0, 0x6BDD, 0x6D42, 0x6E7A, 0x6F8F, 0x7066, 0x717B, 0x7270, 
-    0x300A, 0x248D, 0xFF16, 0x3056, 0x30B6, 0x03A7, 0x0424, 0x01D8, 0x2512, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5CB8, 
-    0x500D, 0x6355, 0x626F, 0x708A, 0x5200, 0x6296, 0x8303, 0x4ED8, 0x82DF, 0x61BE, 0x6B22, 0x7EA7, 0x8549, 0x5F84, 0x6177, 0x84DD, 
-    0x70BC, 0x9732, 0x679A, 0x4EA9, 0x54E6, 0x8D2B, 0x5D4C, 0x69B7, 0x5565, 0x8BC6, 0x7855, 0x6F6D, 0x6295, 0x5473, 0x9699, 0x5378, 
-    0x8BAF, 0x53F6, 0x4F63, 0x8FDC, 0x65A9, 0x4F84, 0x9525, 0x56DF, 0x4FE3, 0x8BD9, 0x9131, 0x828F, 0x837B, 0x8585, 0x53E8, 0x55BD, 
-    0x5CAB, 0x821B, 0x6123, 0x6DA0, 0x5BA5, 0x5A11, 0x7F0D, 0x74D2, 0x69CE, 0x7513, 0x6535, 0x65BC, 0x77F6, 0x7583, 0x9512, 0x9E32, 
-    0x7A78, 0x86A8, 0x8816, 0x8233, 0x91B5, 0x9F86, 0x97AB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F14, 0x5061, 0x514E, 0x52AE, 0x53FF, 0x558E, 0x56AA, 0x57DB, 0x58CF, 0x59FA, 0x5AF9, 0x5C2B, 0x5D4E, 0x5E4F, 0x5F7F, 0x60D9, 
-    0x61DB, 0x633F, 0x6472, 0x657A, 0x66A6, 0x67D7, 0x6903, 0x6A02, 0x6AE1, 0x6BDE, 0x6D44, 0x6E7B, 0x6F90, 0x7067, 0x717C, 0x7271, 
-    0x300B, 0x248E, 0xFF17, 0x3057, 0x30B7, 0x03A8, 0x0425, 0x01DA, 0x2513, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80FA, 
-    0x72C8, 0x535C, 0x64A4, 0x6376, 0x6363, 0x6597, 0x8D29, 0x961C, 0x72D7, 0x608D, 0x73AF, 0x6324, 0x6912, 0x75C9, 0x7CE0, 0x5A6A, 
-    0x7EC3, 0x8DEF, 0x6885, 0x59C6, 0x6B27, 0x54C1, 0x6B20, 0x786E, 0x715E, 0x53F2, 0x6714, 0x8C2D, 0x5934, 0x754F, 0x620F, 0x87F9, 
-    0x900A, 0x66F3, 0x81C3, 0x82D1, 0x8F97, 0x5740, 0x8FFD, 0x80E4, 0x4FDC, 0x8BDC, 0x912F, 0x828A, 0x8398, 0x85B9, 0x53FB, 0x55BE, 
-    0x5CB1, 0x5925, 0x60F4, 0x6D5E, 0x5BB8, 0x5A23, 0x7EF6, 0x74BA, 0x6989, 0x6534, 0x6555, 0x65C6, 0x77F8, 0x7F58, 0x9513, 0x9E31, 
-    0x7A79, 0x868D, 0x8813, 0x8234, 0x91B4, 0x9F87, 0x97A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F15, 0x5062, 0x514F, 0x52AF, 0x5400, 0x5590, 0x56AB, 0x57DC, 0x58D0, 0x59FC, 0x5AFA, 0x5C2D, 0x5D4F, 0x5E50, 0x5F83, 0x60DB, 
-    0x61DC, 0x6340, 0x6473, 0x657B, 0x66A9, 0x67DB, 0x6904, 0x6A03, 0x6AE2, 0x6BDF, 0x6D49, 0x6E7C, 0x6F91, 0x7068, 0x717E, 0x7273, 
-    0x300C, 0x248F, 0xFF18, 0x3058, 0x30B8, 0x03A9, 0x0426, 0x01DC, 0x2514, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6848, 
-    0x5907, 0x54FA, 0x63A3, 0x9524, 0x8E48, 0x9661, 0x72AF, 0x7236, 0x57A2, 0x710A, 0x6853, 0x51E0, 0x7901, 0x9756, 0x625B, 0x680F, 
-    0x7CAE, 0x8D42, 0x9176, 0x6BCD, 0x9E25, 0x8058, 0x6B49, 0x96C0, 0x7B5B, 0x77E2, 0x70C1, 0x8C08, 0x900F, 0x80C3, 0x7EC6, 0x61C8, 
-    0x8FC5, 0x814B, 0x75C8, 0x613F, 0x5D2D, 0x6307, 0x8D58, 0x9997, 0x4FD1, 0x8BDF, 0x9139, 0x82A8, 0x839E, 0x85B7, 0x5412, 0x5594, 
-    0x5CA3, 0x98E7, 0x6100, 0x6D93, 0x752F, 0x5A13, 0x7EFA, 0x97EA, 0x6966, 0x65EE, 0x656B, 0x65C4, 0x7800, 0x7F61, 0x9514, 0x9E36, 
-    0x7A80, 0x868B, 0x87FE, 0x823E, 0x91BA, 0x9F88, 0x97B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F16, 0x5063, 0x5150, 0x52B0, 0x5402, 0x5592, 0x56AC, 0x57DE, 0x58D2, 0x59FD, 0x5AFB, 0x5C2E, 0x5D50, 0x5E51, 0x5F86, 0x60DE, 
-    0x61DD, 0x6341, 0x6474, 0x657C, 0x66AA, 0x67DF, 0x6906, 0x6A04, 0x6AE3, 0x6BE0, 0x6D4C, 0x6E7D, 0x6F92, 0x7069, 0x717F, 0x7274, 
-    0x300D, 0x2490, 0xFF19, 0x3059, 0x30B9, 0x0000, 0x0427, 0x00FC, 0x2515, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80AE, 
-    0x60EB, 0x8865, 0x5F7B, 0x5782, 0x5012, 0x8C46, 0x996D, 0x8179, 0x6784, 0x6C57, 0x8FD8, 0x810A, 0x7126, 0x7ADF, 0x6297, 0x62E6, 
-    0x51C9, 0x9E7F, 0x9709, 0x5893, 0x6BB4, 0x4E52, 0x67AA, 0x88D9, 0x6652, 0x4F7F, 0x65AF, 0x5766, 0x51F8, 0x5582, 0x778E, 0x6CC4, 
-    0x538B, 0x591C, 0x5EB8, 0x6028, 0x5C55, 0x6B62, 0x5760, 0x6BD3, 0x4FDF, 0x8BE0, 0x9143, 0x8284, 0x83A8, 0x85B0, 0x5416, 0x5599, 
-    0x5CC1, 0x5924, 0x610E, 0x6D94, 0x9A9E, 0x5A40, 0x7EFB, 0x97EB, 0x6963, 0x65EF, 0x724D, 0x65C3, 0x7809, 0x7F5F, 0x9515, 0x9E38, 
-    0x7A86, 0x86AC, 0x880A, 0x8244, 0x8C55, 0x9F89, 0x97B4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F1C, 0x5064, 0x5152, 0x52B4, 0x5405, 0x5593, 0x56AD, 0x57E1, 0x58D3, 0x59FE, 0x5AFC, 0x5C2F, 0x5D51, 0x5E52, 0x5F8D, 0x60E1, 
-    0x61DE, 0x6344, 0x6475, 0x657D, 0x66AB, 0x67E1, 0x6907, 0x6A05, 0x6AE4, 0x6BE2, 0x6D50, 0x6E80, 0x6F93, 0x706A, 0x7180, 0x7276, 
-    0x300E, 0x2491, 0xFF1A, 0x305A, 0x30BA, 0x0000, 0x0428, 0x00EA, 0x2516, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6602, 
-    0x7119, 0x57E0, 0x6F88, 0x6625, 0x5C9B, 0x9017, 0x6CDB, 0x8D1F, 0x8D2D, 0x6C49, 0x7F13, 0x5DF1, 0x80F6, 0x7ADE, 0x4EA2, 0x7BEE, 
-    0x6881, 0x6F5E, 0x7164, 0x66AE, 0x85D5, 0x576A, 0x545B, 0x7FA4, 0x73CA, 0x5C4E, 0x6495, 0x6BEF, 0x79C3, 0x9B4F, 0x867E, 0x6CFB, 
-    0x62BC, 0x6DB2, 0x96CD, 0x9662, 0x8638, 0x8DBE, 0x7F00, 0x777E, 0x4FF8, 0x8BE4, 0x9146, 0x828E, 0x83BA, 0x85D3, 0x5406, 0x55EA, 
-    0x5CB7, 0x5902, 0x612B, 0x6D5C, 0x6434, 0x5A67, 0x7EFE, 0x97EC, 0x6979, 0x65F0, 0x7252, 0x65CC, 0x7817, 0x8A48, 0x9516, 0x9E37, 
-    0x7A88, 0x869D, 0x881B, 0x8249, 0x9E7E, 0x9F8A, 0x9AB1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F1D, 0x5066, 0x5153, 0x52B5, 0x5407, 0x5595, 0x56AE, 0x57E2, 0x58D4, 0x5A00, 0x5AFD, 0x5C30, 0x5D52, 0x5E53, 0x5F8E, 0x60E2, 
-    0x61DF, 0x6347, 0x6476, 0x657E, 0x66AC, 0x67E3, 0x6908, 0x6A06, 0x6AE5, 0x6BE3, 0x6D55, 0x6E81, 0x6F94, 0x706E, 0x7181, 0x7277, 
-    0x300F, 0x2492, 0xFF1B, 0x305B, 0x30BB, 0x0000, 0x0429, 0x0251, 0x2517, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x76CE, 
-    0x88AB, 0x4E0D, 0x90F4, 0x693F, 0x7977, 0x75D8, 0x574A, 0x5BCC, 0x591F, 0x592F, 0x6362, 0x84DF, 0x4EA4, 0x51C0, 0x7095, 0x9611, 
-    0x7CB1, 0x7984, 0x6CA1, 0x5E55, 0x5455, 0x82F9, 0x8154, 0x7136, 0x82EB, 0x9A76, 0x5636, 0x8892, 0x7A81, 0x4F4D, 0x5323, 0x8C22, 
-    0x9E26, 0x4E00, 0x8E0A, 0x66F0, 0x6808, 0x53EA, 0x8C06, 0x9F17, 0x5029, 0x8BE8, 0x520D, 0x8291, 0x83BC, 0x85C1, 0x544B, 0x55F7, 
-    0x5CC4, 0x9963, 0x614A, 0x6D60, 0x5BE4, 0x5A4A, 0x7F01, 0x674C, 0x699B, 0x660A, 0x7256, 0x65CE, 0x7818, 0x7F68, 0x9518, 0x9E39, 
-    0x7A95, 0x86A7, 0x8821, 0x824B, 0x8DB8, 0x9F8C, 0x9AB0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F21, 0x5067, 0x5157, 0x52B6, 0x540B, 0x5596, 0x56B0, 0x57E3, 0x58D6, 0x5A02, 0x5AFE, 0x5C32, 0x5D53, 0x5E56, 0x5F8F, 0x60E3, 
-    0x61E0, 0x6348, 0x6477, 0x657F, 0x66AD, 0x67E4, 0x6909, 0x6A07, 0x6AE6, 0x6BE4, 0x6D56, 0x6E82, 0x6F95, 0x7071, 0x7182, 0x7278, 
-    0x3016, 0x2493, 0xFF1C, 0x305C, 0x30BC, 0x0000, 0x042A, 0x0000, 0x2518, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x51F9, 
-    0x5954, 0x5E03, 0x81E3, 0x9187, 0x5BFC, 0x90FD, 0x82B3, 0x8BA3, 0x8F9C, 0x676D, 0x60A3, 0x6280, 0x90CA, 0x70AF, 0x8003, 0x5170, 
-    0x826F, 0x5F55, 0x7709, 0x52DF, 0x5076, 0x840D, 0x7F8C, 0x71C3, 0x6749, 0x59CB, 0x601D, 0x78B3, 0x56FE, 0x6E2D, 0x971E, 0x5C51, 
-    0x9E2D, 0x58F9, 0x86F9, 0x7EA6, 0x5360, 0x65E8, 0x51C6, 0x4E36, 0x504C, 0x8BE9, 0x5942, 0x8297, 0x83C1, 0x85DC, 0x5452, 0x55C9, 
-    0x5CD2, 0x9967, 0x6175, 0x6D7C, 0x5BEE, 0x5A55, 0x7F02, 0x6753, 0x69A7, 0x6619, 0x7230, 0x65D2, 0x7811, 0x7F74, 0x951B, 0x9E3A, 
-    0x7AA6, 0x86A3, 0x8839, 0x824F, 0x8DEB, 0x9EFE, 0x9AB7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F23, 0x5068, 0x5158, 0x52B7, 0x5414, 0x5597, 0x56B1, 0x57E5, 0x58D7, 0x5A0A, 0x5AFF, 0x5C33, 0x5D54, 0x5E57, 0x5F91, 0x60E4, 
-    0x61E1, 0x634A, 0x647B, 0x6580, 0x66AF, 0x67E6, 0x690A, 0x6A08, 0x6AE7, 0x6BE5, 0x6D57, 0x6E84, 0x6F96, 0x7072, 0x7183, 0x727B, 
-    0x3017, 0x2494, 0xFF1D, 0x305D, 0x30BD, 0x0000, 0x042B, 0x0144, 0x2519, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6556, 
-    0x82EF, 0x6B65, 0x8FB0, 0x5507, 0x5230, 0x7763, 0x65B9, 0x9644, 0x83C7, 0x822A, 0x5524, 0x5180, 0x6D47, 0x7A98, 0x62F7, 0x6F9C, 
-    0x4E24, 0x9646, 0x5A92, 0x6155, 0x6CA4, 0x5E73, 0x5899, 0x5189, 0x5C71, 0x5F0F, 0x79C1, 0x63A2, 0x5F92, 0x8C13, 0x8F96, 0x85AA, 
-    0x5440, 0x533B, 0x548F, 0x8D8A, 0x6218, 0x7EB8, 0x6349, 0x4E9F, 0x4FF3, 0x8BEE, 0x52A2, 0x8299, 0x8401, 0x85FF, 0x5453, 0x561F, 
-    0x5CE4, 0x9968, 0x61AC, 0x6D63, 0x8930, 0x5A3C, 0x7F03, 0x675E, 0x69BB, 0x6772, 0x8662, 0x65D6, 0x65AB, 0x7F71, 0x951D, 0x9E3E, 
-    0x7AA0, 0x86AA, 0x883C, 0x825A, 0x8E05, 0x9F0B, 0x9E58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F28, 0x5069, 0x5159, 0x52B8, 0x5418, 0x559A, 0x56B2, 0x57E6, 0x58D8, 0x5A0B, 0x5B00, 0x5C35, 0x5D55, 0x5E58, 0x5F93, 0x60E5, 
-    0x61E2, 0x6351, 0x647C, 0x6581, 0x66B0, 0x67E7, 0x690C, 0x6A09, 0x6AE8, 0x6BE6, 0x6D58, 0x6E87, 0x6F97, 0x7073, 0x7185, 0x727C, 
-    0x3010, 0x2495, 0xFF1E, 0x305E, 0x30BE, 0x0000, 0x042C, 0x0148, 0x251A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x71AC, 
-    0x672C, 0x7C3F, 0x5C18, 0x6DF3, 0x7A3B, 0x6BD2, 0x80AA, 0x5987, 0x5495, 0x58D5, 0x75EA, 0x5B63, 0x9A84, 0x63EA, 0x70E4, 0x8C30, 
-    0x8F86, 0x622E, 0x9541, 0x6728, 0x556A, 0x51ED, 0x8537, 0x67D3, 0x5220, 0x793A, 0x53F8, 0x53F9, 0x9014, 0x5C09, 0x6687, 0x82AF, 
-    0x4E2B, 0x63D6, 0x6CF3, 0x8DC3, 0x7AD9, 0x5FD7, 0x62D9, 0x9F10, 0x502C, 0x8BF0, 0x52AC, 0x82AB, 0x83E5, 0x8627, 0x5454, 0x55D1, 
-    0x5CCB, 0x9969, 0x6194, 0x6E1A, 0x5BF0, 0x5A62, 0x7F07, 0x6748, 0x69AB, 0x6603, 0x5216, 0x7080, 0x782D, 0x7F79, 0x951E, 0x9E41, 
-    0x7AAC, 0x8693, 0x7F36, 0x825F, 0x8E59, 0x9F0D, 0x9AB6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F29, 0x506A, 0x515B, 0x52B9, 0x5419, 0x559B, 0x56B3, 0x57E7, 0x58D9, 0x5A0D, 0x5B01, 0x5C36, 0x5D56, 0x5E59, 0x5F94, 0x60EA, 
-    0x61E3, 0x6352, 0x647D, 0x6582, 0x66B1, 0x67E8, 0x690F, 0x6A0B, 0x6AE9, 0x6BE7, 0x6D5B, 0x6E88, 0x6F98, 0x7074, 0x7186, 0x727D, 
-    0x3011, 0x2496, 0xFF1F, 0x305F, 0x30BF, 0x0000, 0x042D, 0x0000, 0x251B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7FF1, 
-    0x7B28, 0x90E8, 0x6668, 0x7EAF, 0x60BC, 0x728A, 0x623F, 0x7F1A, 0x7B8D, 0x568E, 0x8C62, 0x4F0E, 0x5A07, 0x7A76, 0x9760, 0x63FD, 
-    0x91CF, 0x9A74, 0x6BCF, 0x76EE, 0x8DB4, 0x74F6, 0x5F3A, 0x74E4, 0x717D, 0x58EB, 0x4E1D, 0x70AD, 0x6D82, 0x6170, 0x5CE1, 0x950C, 
-    0x82BD, 0x94F1, 0x6D8C, 0x94A5, 0x6E5B, 0x631A, 0x5353, 0x4E5C, 0x500F, 0x8BF3, 0x52AD, 0x82B8, 0x83D8, 0x8605, 0x5456, 0x55EB, 
-    0x5CE5, 0x996A, 0x61A7, 0x6DC7, 0x8E47, 0x5A75, 0x7F08, 0x6769, 0x69AD, 0x6615, 0x809F, 0x709C, 0x781C, 0x7F81, 0x951F, 0x9E42, 
-    0x7AA8, 0x86A9, 0x7F42, 0x8268, 0x8E69, 0x96B9, 0x9ABA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F2C, 0x506B, 0x515D, 0x52BA, 0x541A, 0x559E, 0x56B4, 0x57E8, 0x58DA, 0x5A0E, 0x5B02, 0x5C37, 0x5D57, 0x5E5A, 0x5F96, 0x60F1, 
-    0x61E4, 0x6353, 0x647E, 0x6583, 0x66B2, 0x67EA, 0x6911, 0x6A0C, 0x6AEA, 0x6BE8, 0x6D5D, 0x6E8A, 0x6F99, 0x7077, 0x7187, 0x7282, 
-    0x00B1, 0x2497, 0xFF20, 0x3060, 0x30C0, 0x0000, 0x042E, 0x0261, 0x251C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8884, 
-    0x5D29, 0x6016, 0x5FF1, 0x8822, 0x9053, 0x72EC, 0x9632, 0x5490, 0x4F30, 0x8C6A, 0x7115, 0x796D, 0x56BC, 0x7EA0, 0x5777, 0x89C8, 
-    0x667E, 0x5415, 0x7F8E, 0x7766, 0x722C, 0x8BC4, 0x62A2, 0x58E4, 0x886B, 0x4E16, 0x6B7B, 0x6C64, 0x5C60, 0x536B, 0x4FA0, 0x6B23, 
-    0x7259, 0x4F9D, 0x6C38, 0x5CB3, 0x7EFD, 0x63B7, 0x684C, 0x4E69, 0x502E, 0x8BF6, 0x52BE, 0x82BE, 0x5807, 0x8629, 0x5443, 0x55EC, 
-    0x5D02, 0x996B, 0x61B7, 0x6DC5, 0x8B07, 0x80EC, 0x7F0B, 0x67A5, 0x69D4, 0x6600, 0x809C, 0x7096, 0x781D, 0x7F7E, 0x9522, 0x9E44, 
-    0x7AAD, 0x86B6, 0x7F44, 0x887E, 0x8DB5, 0x96BC, 0x9ABC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F2D, 0x506D, 0x515E, 0x52BB, 0x541C, 0x55A0, 0x56B5, 0x57E9, 0x58DB, 0x5A0F, 0x5B03, 0x5C43, 0x5D59, 0x5E5C, 0x5F9A, 0x60F2, 
-    0x61E5, 0x6354, 0x647F, 0x6584, 0x66B3, 0x67EB, 0x6913, 0x6A0D, 0x6AEB, 0x6BE9, 0x6D5F, 0x6E8B, 0x6F9A, 0x7079, 0x7188, 0x7283, 
-    0x00D7, 0x2498, 0xFF21, 0x3061, 0x30C1, 0x03B1, 0x042F, 0x0000, 0x251D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50B2, 
-    0x7EF7, 0x64E6, 0x6C89, 0x6233, 0x76D7, 0x8BFB, 0x59A8, 0x5676, 0x6CBD, 0x6BEB, 0x6DA3, 0x5242, 0x6405, 0x7396, 0x82DB, 0x61D2, 
-    0x4EAE, 0x94DD, 0x6627, 0x7267, 0x5E15, 0x5C4F, 0x6A47, 0x6518, 0x95EA, 0x67FF, 0x8086, 0x5858, 0x571F, 0x761F, 0x72ED, 0x8F9B, 
-    0x869C, 0x4F0A, 0x607F, 0x7CA4, 0x6A1F, 0x81F3, 0x7422, 0x4E93, 0x502D, 0x8BF9, 0x54FF, 0x82B0, 0x8418, 0x8616, 0x5421, 0x55D4, 
-    0x5D03, 0x996C, 0x61D4, 0x6DDE, 0x8FB6, 0x5AAA, 0x7F0C, 0x6787, 0x69B1, 0x7085, 0x8093, 0x709D, 0x7839, 0x76CD, 0x952A, 0x9E46, 
-    0x7AB3, 0x86C4, 0x7F45, 0x8885, 0x8DBF, 0x96BD, 0x9AC1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F2E, 0x506E, 0x515F, 0x52BC, 0x5422, 0x55A1, 0x56B6, 0x57EA, 0x58DC, 0x5A10, 0x5B04, 0x5C44, 0x5D5A, 0x5E5D, 0x5F9B, 0x60F5, 
-    0x61E7, 0x6356, 0x6480, 0x6585, 0x66B5, 0x67ED, 0x6914, 0x6A0E, 0x6AEC, 0x6BEC, 0x6D61, 0x6E8C, 0x6F9B, 0x707A, 0x7189, 0x7285, 
-    0x00F7, 0x2499, 0xFF22, 0x3062, 0x30C2, 0x03B2, 0x0000, 0x0000, 0x251E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5965, 
-    0x752D, 0x731C, 0x9648, 0x7EF0, 0x5FB7, 0x5835, 0x4EFF, 0x560E, 0x5B64, 0x90DD, 0x5BA6, 0x60B8, 0x94F0, 0x97ED, 0x67EF, 0x7F06, 
-    0x8C05, 0x4FA3, 0x5BD0, 0x7A46, 0x6015, 0x5761, 0x9539, 0x56B7, 0x9655, 0x4E8B, 0x5BFA, 0x642A, 0x5410, 0x6E29, 0x4E0B, 0x65B0, 
-    0x5D16, 0x8863, 0x52C7, 0x6708, 0x7AE0, 0x81F4, 0x8301, 0x8288, 0x4FFE, 0x8BFC, 0x52D0, 0x82C8, 0x840B, 0x863C, 0x5457, 0x55E6, 
-    0x5D27, 0x9974, 0x61F5, 0x6E0E, 0x8FD3, 0x5A9B, 0x7F0F, 0x676A, 0x69C1, 0x66F7, 0x80BC, 0x70BB, 0x783A, 0x76E5, 0x952B, 0x9E47, 
-    0x8864, 0x86B5, 0x8210, 0x8888, 0x8DBC, 0x96CE, 0x9AC0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F31, 0x506F, 0x5160, 0x52BD, 0x5424, 0x55A2, 0x56B8, 0x57EB, 0x58DD, 0x5A12, 0x5B05, 0x5C46, 0x5D5C, 0x5E5F, 0x5F9D, 0x60F7, 
-    0x61E8, 0x6357, 0x6481, 0x6586, 0x66B6, 0x67EE, 0x6915, 0x6A0F, 0x6AED, 0x6BED, 0x6D62, 0x6E8D, 0x6F9D, 0x707B, 0x718B, 0x7286, 
-    0x2236, 0x249A, 0xFF23, 0x3063, 0x30C3, 0x03B3, 0x0000, 0x0000, 0x251F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x61CA, 
-    0x6CF5, 0x88C1, 0x8D81, 0x75B5, 0x5F97, 0x7779, 0x8BBF, 0x8BE5, 0x59D1, 0x597D, 0x5E7B, 0x6D4E, 0x77EB, 0x4E45, 0x68F5, 0x70C2, 
-    0x64A9, 0x65C5, 0x59B9, 0x62FF, 0x7436, 0x6CFC, 0x6572, 0x8BA9, 0x64C5, 0x62ED, 0x55E3, 0x5802, 0x5154, 0x868A, 0x53A6, 0x5FFB, 
-    0x8859, 0x9890, 0x7528, 0x60A6, 0x5F70, 0x7F6E, 0x914C, 0x5B5B, 0x501C, 0x8BFF, 0x52D6, 0x82CA, 0x83DD, 0x5EFE, 0x5459, 0x55DD, 
-    0x5D26, 0x9977, 0x5FDD, 0x6DBF, 0x8FD5, 0x5A77, 0x7F11, 0x6773, 0x69CA, 0x661D, 0x670A, 0x70C0, 0x783B, 0x8832, 0x9529, 0x9E48, 
-    0x8869, 0x86CE, 0x7AFA, 0x88D8, 0x8DBA, 0x96D2, 0x9AC5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F33, 0x5070, 0x5161, 0x52C0, 0x5425, 0x55A3, 0x56B9, 0x57EC, 0x58DE, 0x5A14, 0x5B06, 0x5C47, 0x5D5E, 0x5E60, 0x5F9E, 0x60F8, 
-    0x61E9, 0x6358, 0x6483, 0x6588, 0x66B7, 0x67F2, 0x6916, 0x6A10, 0x6AEE, 0x6BEE, 0x6D64, 0x6E8E, 0x6F9E, 0x707D, 0x718C, 0x7287, 
-    0x2227, 0x249B, 0xFF24, 0x3064, 0x30C4, 0x03B4, 0x0000, 0x0000, 0x2520, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6FB3, 
-    0x8E66, 0x6750, 0x886C, 0x8328, 0x7684, 0x8D4C, 0x7EBA, 0x6539, 0x9F13, 0x8017, 0x8352, 0x5BC4, 0x4FA5, 0x7078, 0x78D5, 0x6EE5, 
-    0x804A, 0x5C65, 0x5A9A, 0x54EA, 0x62CD, 0x9887, 0x6084, 0x9976, 0x8D61, 0x8A93, 0x56DB, 0x68E0, 0x6E4D, 0x6587, 0x590F, 0x5FC3, 
-    0x6DAF, 0x5937, 0x5E7D, 0x9605, 0x6F33, 0x5E1C, 0x5544, 0x556C, 0x500C, 0x8C00, 0x52F0, 0x82E3, 0x83FD, 0x5F08, 0x5423, 0x55C4, 
-    0x5D2E, 0x997D, 0x96B3, 0x6DE0, 0x8FE5, 0x5A7A, 0x7F12, 0x6798, 0x69DF, 0x6634, 0x80BD, 0x70B7, 0x781F, 0x9485, 0x952C, 0x9E49, 
-    0x8872, 0x86B0, 0x7AFD, 0x88DF, 0x8DC4, 0x77BF, 0x9AC2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F35, 0x5071, 0x5163, 0x52C1, 0x542A, 0x55A4, 0x56BA, 0x57EE, 0x58DF, 0x5A15, 0x5B07, 0x5C4C, 0x5D5F, 0x5E63, 0x5F9F, 0x60FB, 
-    0x61EA, 0x6359, 0x6486, 0x6589, 0x66B8, 0x67F5, 0x6917, 0x6A11, 0x6AEF, 0x6BF0, 0x6D65, 0x6E91, 0x6F9F, 0x7081, 0x718D, 0x7288, 
-    0x2228, 0x2474, 0xFF25, 0x3065, 0x30C5, 0x03B5, 0x0000, 0x3105, 0x2521, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82AD, 
-    0x8FF8, 0x624D, 0x6491, 0x78C1, 0x8E6C, 0x675C, 0x653E, 0x6982, 0x53E4, 0x53F7, 0x614C, 0x5BC2, 0x811A, 0x4E5D, 0x9897, 0x7405, 
-    0x50DA, 0x5C61, 0x95E8, 0x5450, 0x6392, 0x5A46, 0x6865, 0x6270, 0x81B3, 0x901D, 0x4F3A, 0x819B, 0x56E2, 0x95FB, 0x5413, 0x4FE1, 
-    0x96C5, 0x9057, 0x4F18, 0x8018, 0x5F20, 0x5CD9, 0x7740, 0x560F, 0x5025, 0x8C02, 0x53DF, 0x8298, 0x83D6, 0x593C, 0x5432, 0x55EF, 
-    0x5D24, 0x9980, 0x95E9, 0x6E11, 0x8FEE, 0x5ABE, 0x7F17, 0x67A7, 0x6995, 0x6631, 0x80B1, 0x70AB, 0x783C, 0x9486, 0x9531, 0x9E4B, 
-    0x887D, 0x86BA, 0x7B08, 0x895E, 0x8DD6, 0x96E0, 0x9ACB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F37, 0x5072, 0x5164, 0x52C2, 0x5430, 0x55A5, 0x56BB, 0x57F0, 0x58E0, 0x5A16, 0x5B08, 0x5C4D, 0x5D60, 0x5E64, 0x5FA0, 0x60FC, 
-    0x61EB, 0x635A, 0x6488, 0x658A, 0x66BA, 0x67F6, 0x6918, 0x6A12, 0x6AF0, 0x6BF1, 0x6D67, 0x6E92, 0x6FA0, 0x7082, 0x718E, 0x7289, 
-    0x2211, 0x2475, 0xFF26, 0x3066, 0x30C6, 0x03B6, 0x0000, 0x3106, 0x2522, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x634C, 
-    0x903C, 0x8D22, 0x79F0, 0x96CC, 0x706F, 0x9540, 0x83F2, 0x9499, 0x86CA, 0x6D69, 0x9EC4, 0x8BA1, 0x72E1, 0x9152, 0x79D1, 0x6994, 
-    0x7597, 0x7F15, 0x95F7, 0x94A0, 0x724C, 0x7834, 0x77A7, 0x7ED5, 0x5584, 0x52BF, 0x4F3C, 0x5510, 0x63A8, 0x7EB9, 0x6380, 0x8845, 
-    0x54D1, 0x79FB, 0x60A0, 0x4E91, 0x638C, 0x5236, 0x707C, 0x4EC4, 0x5028, 0x8C04, 0x71EE, 0x82B7, 0x841C, 0x5941, 0x5482, 0x55E5, 
-    0x5D1E, 0x9984, 0x95EB, 0x6DE6, 0x8FE4, 0x5AEB, 0x7F19, 0x6775, 0x69E0, 0x6636, 0x80AB, 0x70B1, 0x7825, 0x9487, 0x9532, 0x9E4C, 
-    0x887F, 0x86B1, 0x7B03, 0x7F9D, 0x8DD7, 0x928E, 0x9ACC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F39, 0x5073, 0x5166, 0x52C4, 0x5433, 0x55A6, 0x56BD, 0x57F1, 0x58E1, 0x5A17, 0x5B0A, 0x5C52, 0x5D61, 0x5E65, 0x5FA2, 0x60FD, 
-    0x61EC, 0x635B, 0x6489, 0x658D, 0x66BB, 0x67F7, 0x6919, 0x6A13, 0x6AF1, 0x6BF2, 0x6D68, 0x6E93, 0x6FA2, 0x7083, 0x7190, 0x728C, 
-    0x220F, 0x2476, 0xFF27, 0x3067, 0x30C7, 0x03B7, 0x0000, 0x3107, 0x2523, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6252, 
-    0x9F3B, 0x776C, 0x57CE, 0x8F9E, 0x767B, 0x809A, 0x975E, 0x76D6, 0x9AA8, 0x5475, 0x78FA, 0x8BB0, 0x89D2, 0x53A9, 0x58F3, 0x72FC, 
-    0x71CE, 0x8651, 0x4EEC, 0x90A3, 0x5F98, 0x9B44, 0x4E54, 0x60F9, 0x6C55, 0x662F, 0x9972, 0x7CD6, 0x9893, 0x543B, 0x9528, 0x661F, 
-    0x4E9A, 0x4EEA, 0x5FE7, 0x90E7, 0x6DA8, 0x667A, 0x6D4A, 0x538D, 0x507E, 0x8C07, 0x77CD, 0x82AE, 0x8438, 0x8037, 0x5494, 0x55F2, 
-    0x5D06, 0x9987, 0x95F1, 0x6DDD, 0x8FE9, 0x5AB2, 0x7F1C, 0x67A8, 0x698D, 0x6635, 0x80AD, 0x70E8, 0x782C, 0x948B, 0x9534, 0x9E4E, 
-    0x8882, 0x86AF, 0x7B04, 0x7F9F, 0x8DDA, 0x92AE, 0x9AD1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F3B, 0x5074, 0x5167, 0x52C5, 0x5436, 0x55A8, 0x56BE, 0x57F2, 0x58E2, 0x5A19, 0x5B0B, 0x5C53, 0x5D62, 0x5E66, 0x5FA3, 0x60FE, 
-    0x61ED, 0x635C, 0x648A, 0x658E, 0x66BC, 0x67F8, 0x691A, 0x6A14, 0x6AF2, 0x6BF4, 0x6D6B, 0x6E94, 0x6FA3, 0x7084, 0x7191, 0x728E, 
-    0x222A, 0x2477, 0xFF28, 0x3068, 0x30C8, 0x03B8, 0x0000, 0x3108, 0x2524, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x53ED, 
-    0x6BD4, 0x8E29, 0x6A59, 0x6148, 0x7B49, 0x5EA6, 0x5561, 0x6E89, 0x8C37, 0x559D, 0x8757, 0x65E2, 0x997A, 0x6551, 0x54B3, 0x5ECA, 
-    0x5BE5, 0x6C2F, 0x840C, 0x5A1C, 0x6E43, 0x8FEB, 0x4FA8, 0x70ED, 0x6247, 0x55DC, 0x5DF3, 0x5018, 0x817F, 0x7A33, 0x5148, 0x8165, 
-    0x8BB6, 0x80F0, 0x5C24, 0x5300, 0x6756, 0x79E9, 0x5179, 0x539D, 0x5043, 0x8C0C, 0x5EF4, 0x82CB, 0x8411, 0x5955, 0x5477, 0x55F3, 
-    0x5D1B, 0x998A, 0x95F3, 0x6DD9, 0x8FE6, 0x5AD2, 0x7F1B, 0x679E, 0x69FF, 0x8006, 0x80B4, 0x70CA, 0x7823, 0x948A, 0x9536, 0x9E51, 
-    0x88A2, 0x86C9, 0x7B15, 0x7FA7, 0x8DDE, 0x92C8, 0x9B45, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F3E, 0x5075, 0x5169, 0x52C6, 0x5437, 0x55A9, 0x56BF, 0x57F3, 0x58E3, 0x5A1A, 0x5B0C, 0x5C54, 0x5D63, 0x5E67, 0x5FA4, 0x60FF, 
-    0x61EE, 0x635D, 0x648B, 0x658F, 0x66BD, 0x67F9, 0x691B, 0x6A15, 0x6AF3, 0x6BF6, 0x6D6C, 0x6E95, 0x6FA4, 0x7086, 0x7192, 0x7290, 
-    0x2229, 0x2478, 0xFF29, 0x3069, 0x30C9, 0x03B9, 0x0000, 0x3109, 0x2525, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5427, 
-    0x9119, 0x91C7, 0x6210, 0x74F7, 0x77AA, 0x6E21, 0x98DE, 0x5E72, 0x80A1, 0x8377, 0x7C27, 0x5FCC, 0x7F34, 0x65E7, 0x53EF, 0x90CE, 
-    0x8FBD, 0x5F8B, 0x8499, 0x7EB3, 0x6D3E, 0x7C95, 0x5DE7, 0x58EC, 0x7F2E, 0x566C, 0x677E, 0x8EBA, 0x8715, 0x7D0A, 0x4ED9, 0x7329, 
-    0x7109, 0x7591, 0x7531, 0x9668, 0x4E08, 0x7A1A, 0x54A8, 0x53A3, 0x5055, 0x8C0F, 0x51F5, 0x82CC, 0x8406, 0x595A, 0x5471, 0x55CC, 
-    0x5D58, 0x998D, 0x95F5, 0x6E16, 0x8FF3, 0x5AD4, 0x7F1F, 0x67AD, 0x6A2F, 0x665F, 0x80B7, 0x7110, 0x7829, 0x948C, 0x9537, 0x9E55, 
-    0x88C6, 0x86CF, 0x7B0A, 0x7FAF, 0x8DCE, 0x933E, 0x9B43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F3F, 0x5078, 0x516A, 0x52C8, 0x543A, 0x55AA, 0x56C0, 0x57F5, 0x58E5, 0x5A1B, 0x5B0D, 0x5C56, 0x5D64, 0x5E68, 0x5FA5, 0x6102, 
-    0x61EF, 0x6360, 0x648C, 0x6592, 0x66BF, 0x67FA, 0x691C, 0x6A16, 0x6AF4, 0x6BF7, 0x6D6D, 0x6E96, 0x6FA5, 0x7087, 0x7193, 0x7291, 
-    0x2208, 0x2479, 0xFF2A, 0x306A, 0x30CA, 0x03BA, 0x0000, 0x310A, 0x2526, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7B06, 
-    0x7B14, 0x5F69, 0x5448, 0x8BCD, 0x51F3, 0x5992, 0x80A5, 0x7518, 0x6545, 0x83CF, 0x7687, 0x9645, 0x7EDE, 0x81FC, 0x6E34, 0x6717, 
-    0x6F66, 0x7387, 0x6AAC, 0x6C16, 0x6500, 0x5256, 0x9798, 0x4EC1, 0x5892, 0x9002, 0x8038, 0x6DCC, 0x892A, 0x95EE, 0x9C9C, 0x60FA, 
-    0x54BD, 0x6C82, 0x90AE, 0x5141, 0x5E10, 0x8D28, 0x8D44, 0x53A5, 0x5048, 0x8C11, 0x51FC, 0x82C1, 0x83D4, 0x5958, 0x5464, 0x55CD, 
-    0x5D3E, 0x9990, 0x95F6, 0x6DAB, 0x8FE8, 0x5AB8, 0x7F21, 0x678B, 0x69ED, 0x6654, 0x80E7, 0x7113, 0x784E, 0x948D, 0x9538, 0x9E57, 
-    0x88B7, 0x86B4, 0x7B2B, 0x7FB0, 0x8DCF, 0x936A, 0x9B47, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F40, 0x5079, 0x516F, 0x52CA, 0x543D, 0x55AB, 0x56C1, 0x57F6, 0x58E6, 0x5A1D, 0x5B0E, 0x5C57, 0x5D65, 0x5E69, 0x5FA6, 0x6103, 
-    0x61F0, 0x6364, 0x648D, 0x6594, 0x66C0, 0x67FB, 0x691D, 0x6A19, 0x6AF5, 0x6BF8, 0x6D70, 0x6E97, 0x6FA6, 0x7088, 0x7195, 0x7293, 
-    0x2237, 0x247A, 0xFF2B, 0x306B, 0x30CB, 0x03BB, 0x0000, 0x310B, 0x2527, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x516B, 
-    0x5F7C, 0x83DC, 0x4E58, 0x6B64, 0x9093, 0x7AEF, 0x532A, 0x6746, 0x987E, 0x6838, 0x51F0, 0x5993, 0x527F, 0x8205, 0x514B, 0x6D6A, 
-    0x4E86, 0x6EE4, 0x76DF, 0x4E43, 0x6F58, 0x6251, 0x64AC, 0x4EBA, 0x4F24, 0x4ED5, 0x6002, 0x8D9F, 0x9000, 0x55E1, 0x7EA4, 0x5174, 
-    0x9609, 0x5B9C, 0x94C0, 0x8FD0, 0x8D26, 0x7099, 0x59FF, 0x53AE, 0x504E, 0x8C12, 0x9B2F, 0x82A9, 0x83DF, 0x530F, 0x549A, 0x55E8, 
-    0x5D34, 0x9991, 0x95FC, 0x6E0C, 0x9005, 0x5AE0, 0x7F22, 0x6777, 0x6A17, 0x6641, 0x80E8, 0x7116, 0x786D, 0x948F, 0x953C, 0x9E5A, 
-    0x88BC, 0x86E9, 0x7B0F, 0x7FB2, 0x8DDB, 0x93CA, 0x9B49, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F41, 0x507A, 0x5172, 0x52CC, 0x543F, 0x55AC, 0x56C2, 0x57F7, 0x58E7, 0x5A1E, 0x5B0F, 0x5C58, 0x5D66, 0x5E6A, 0x5FA7, 0x6104, 
-    0x61F1, 0x6365, 0x648E, 0x6595, 0x66C1, 0x67FC, 0x691E, 0x6A1A, 0x6AF6, 0x6BFA, 0x6D71, 0x6E99, 0x6FA8, 0x708B, 0x7196, 0x7294, 
-    0x221A, 0x247B, 0xFF2C, 0x306C, 0x30CC, 0x03BC, 0x0000, 0x310C, 0x2528, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x75A4, 
-    0x78A7, 0x8521, 0x7A0B, 0x523A, 0x5824, 0x77ED, 0x8BFD, 0x67D1, 0x56FA, 0x79BE, 0x60F6, 0x7EE7, 0x6559, 0x548E, 0x523B, 0x635E, 
-    0x6482, 0x7EFF, 0x9530, 0x5976, 0x76D8, 0x94FA, 0x7FD8, 0x5FCD, 0x5546, 0x4F8D, 0x9882, 0x70EB, 0x541E, 0x7FC1, 0x54B8, 0x5211, 
-    0x70DF, 0x59E8, 0x72B9, 0x8574, 0x4ED7, 0x75D4, 0x6ECB, 0x9765, 0x506C, 0x8C14, 0x53B6, 0x82B4, 0x840F, 0x5C22, 0x549B, 0x55F5, 
-    0x5D3D, 0x9993, 0x95FE, 0x6DAE, 0x9004, 0x5AE3, 0x7F23, 0x677C, 0x6A18, 0x664F, 0x80E9, 0x712F, 0x7856, 0x9490, 0x953E, 0x9E5B, 
-    0x88C9, 0x86F1, 0x7B47, 0x7C7C, 0x8DC6, 0x938F, 0x9B48, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F42, 0x507C, 0x517A, 0x52CD, 0x5441, 0x55AD, 0x56C3, 0x57FB, 0x58E8, 0x5A21, 0x5B10, 0x5C5A, 0x5D67, 0x5E6B, 0x5FA9, 0x6105, 
-    0x61F2, 0x6366, 0x648F, 0x6596, 0x66C2, 0x67FE, 0x6921, 0x6A1B, 0x6AF7, 0x6BFB, 0x6D72, 0x6E9A, 0x6FA9, 0x708C, 0x7197, 0x7295, 
-    0x22A5, 0x247C, 0xFF2D, 0x306D, 0x30CD, 0x03BD, 0x0000, 0x310D, 0x2529, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5DF4, 
-    0x84D6, 0x9910, 0x60E9, 0x8D50, 0x4F4E, 0x953B, 0x5420, 0x7AFF, 0x96C7, 0x548C, 0x714C, 0x7EAA, 0x9175, 0x5C31, 0x5BA2, 0x52B3, 
-    0x9563, 0x5CE6, 0x731B, 0x8010, 0x78D0, 0x4EC6, 0x5CED, 0x97E7, 0x8D4F, 0x91CA, 0x9001, 0x638F, 0x5C6F, 0x74EE, 0x8D24, 0x578B, 
-    0x6DF9, 0x5F5D, 0x6CB9, 0x915D, 0x80C0, 0x6EDE, 0x6DC4, 0x8D5D, 0x507B, 0x8C15, 0x5F01, 0x82A1, 0x8403, 0x5C25, 0x5484, 0x55E4, 
-    0x5D6C, 0x9994, 0x9603, 0x6E2B, 0x900B, 0x5AF1, 0x7F24, 0x67F0, 0x6A65, 0x6656, 0x80EA, 0x7131, 0x7857, 0x9494, 0x953F, 0x9E5C, 
-    0x88E2, 0x86F2, 0x7B38, 0x6549, 0x8DEC, 0x943E, 0x9B4D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F44, 0x507D, 0x517E, 0x52CE, 0x5442, 0x55AE, 0x56C4, 0x57FC, 0x58E9, 0x5A22, 0x5B11, 0x5C5B, 0x5D68, 0x5E6C, 0x5FAB, 0x6107, 
-    0x61F3, 0x6368, 0x6490, 0x6598, 0x66C3, 0x6801, 0x6922, 0x6A1C, 0x6AF8, 0x6BFC, 0x6D73, 0x6E9B, 0x6FAA, 0x708D, 0x719A, 0x7296, 
-    0x2225, 0x247D, 0xFF2E, 0x306E, 0x30CE, 0x03BE, 0x0000, 0x310E, 0x252A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62D4, 
-    0x853D, 0x53C2, 0x6F84, 0x6B21, 0x6EF4, 0x6BB5, 0x80BA, 0x809D, 0x522E, 0x4F55, 0x6643, 0x5609, 0x8F7F, 0x759A, 0x8BFE, 0x7262, 
-    0x5ED6, 0x631B, 0x68A6, 0x5948, 0x76FC, 0x8386, 0x4FCF, 0x4EFB, 0x664C, 0x9970, 0x5B8B, 0x6D9B, 0x81C0, 0x631D, 0x8854, 0x5F62, 
-    0x76D0, 0x6905, 0x6E38, 0x6655, 0x7634, 0x6CBB, 0x5B5C, 0x531A, 0x50A5, 0x8C16, 0x755A, 0x82AA, 0x83F8, 0x5C2C, 0x5476, 0x8F94, 
-    0x5D5B, 0x9995, 0x9604, 0x6E6E, 0x9026, 0x5AD6, 0x7F25, 0x6809, 0x69F2, 0x6661, 0x80DB, 0x7173, 0x7826, 0x9497, 0x9542, 0x9E5E, 
-    0x88CE, 0x86ED, 0x7B2A, 0x7C91, 0x8DF7, 0x946B, 0x9B51, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F45, 0x5081, 0x517F, 0x52CF, 0x5444, 0x55AF, 0x56C5, 0x57FE, 0x58EA, 0x5A24, 0x5B12, 0x5C5C, 0x5D6A, 0x5E6D, 0x5FAC, 0x610A, 
-    0x61F4, 0x636A, 0x6493, 0x659A, 0x66C4, 0x6802, 0x6923, 0x6A1D, 0x6AF9, 0x6BFE, 0x6D75, 0x6E9D, 0x6FAB, 0x708F, 0x719B, 0x7297, 
-    0x2220, 0x247E, 0xFF2F, 0x306F, 0x30CF, 0x03BF, 0x0000, 0x310F, 0x252B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8DCB, 
-    0x6BD5, 0x8695, 0x8BDA, 0x806A, 0x8FEA, 0x65AD, 0x5E9F, 0x8D76, 0x74DC, 0x5408, 0x5E4C, 0x67B7, 0x8F83, 0x97A0, 0x80AF, 0x8001, 
-    0x6599, 0x5B6A, 0x5B5F, 0x5357, 0x7554, 0x8461, 0x7A8D, 0x8BA4, 0x4E0A, 0x6C0F, 0x8BBC, 0x6ED4, 0x62D6, 0x8717, 0x8237, 0x90A2, 
-    0x4E25, 0x8681, 0x9149, 0x97F5, 0x969C, 0x7A92, 0x7D2B, 0x53F5, 0x50A7, 0x8C19, 0x5DEF, 0x829F, 0x83F9, 0x5C34, 0x5466, 0x561E, 
-    0x5D6F, 0x5E80, 0x9606, 0x6E4E, 0x9011, 0x5AE6, 0x7F26, 0x67D8, 0x6A44, 0x6657, 0x80C2, 0x715C, 0x7850, 0x9495, 0x9535, 0x9E63, 
-    0x88E3, 0x86F3, 0x7B19, 0x7C9D, 0x8DF8, 0x9C7F, 0x98E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F47, 0x5082, 0x5183, 0x52D1, 0x5445, 0x55B0, 0x56C6, 0x57FF, 0x58ED, 0x5A26, 0x5B13, 0x5C5D, 0x5D6D, 0x5E6E, 0x5FAF, 0x610B, 
-    0x61F6, 0x636B, 0x6494, 0x659D, 0x66C5, 0x6803, 0x6925, 0x6A1E, 0x6AFA, 0x6BFF, 0x6D76, 0x6E9E, 0x6FAC, 0x7090, 0x719C, 0x7298, 
-    0x2312, 0x247F, 0xFF30, 0x3070, 0x30D0, 0x03C0, 0x0000, 0x3110, 0x252C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9776, 
-    0x6BD9, 0x6B8B, 0x627F, 0x8471, 0x654C, 0x7F0E, 0x6CB8, 0x611F, 0x5250, 0x76D2, 0x604D, 0x5939, 0x53EB, 0x62D8, 0x5543, 0x4F6C, 
-    0x5217, 0x6EE6, 0x772F, 0x7537, 0x5224, 0x83E9, 0x5207, 0x5203, 0x5C1A, 0x5E02, 0x8BF5, 0x7EE6, 0x6258, 0x6DA1, 0x95F2, 0x884C, 
-    0x7814, 0x501A, 0x6709, 0x5B55, 0x62DB, 0x4E2D, 0x4ED4, 0x5326, 0x50A9, 0x8C1B, 0x574C, 0x82C4, 0x83EA, 0x624C, 0x549D, 0x5608, 
-    0x5D5D, 0x5E91, 0x9608, 0x6E6B, 0x900D, 0x5AD8, 0x7F27, 0x680A, 0x6A3E, 0x6677, 0x80C4, 0x7168, 0x7847, 0x949A, 0x9544, 0x9E66, 
-    0x88E5, 0x86D0, 0x7B2E, 0x7C9C, 0x8DE3, 0x9C82, 0x990D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F48, 0x5083, 0x5184, 0x52D3, 0x5447, 0x55B2, 0x56C7, 0x5801, 0x58EF, 0x5A27, 0x5B14, 0x5C5F, 0x5D6E, 0x5E6F, 0x5FB0, 0x610C, 
-    0x61F7, 0x636C, 0x6497, 0x659E, 0x66C6, 0x6804, 0x6926, 0x6A20, 0x6AFB, 0x6C00, 0x6D79, 0x6EA0, 0x6FAD, 0x7091, 0x719D, 0x7299, 
-    0x2299, 0x2480, 0xFF31, 0x3071, 0x30D1, 0x03C1, 0x0430, 0x3111, 0x252D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x628A, 
-    0x6BD6, 0x60ED, 0x901E, 0x56F1, 0x7B1B, 0x5806, 0x8D39, 0x79C6, 0x5BE1, 0x8C89, 0x8C0E, 0x4F73, 0x7A96, 0x72D9, 0x57A6, 0x59E5, 
-    0x88C2, 0x5375, 0x919A, 0x96BE, 0x53DB, 0x84B2, 0x8304, 0x598A, 0x88F3, 0x6043, 0x641C, 0x8404, 0x8131, 0x7A9D, 0x6D8E, 0x9192, 
-    0x8712, 0x5DF2, 0x53CB, 0x531D, 0x662D, 0x76C5, 0x7C7D, 0x532E, 0x50BA, 0x8C18, 0x57A9, 0x82CE, 0x83C5, 0x626A, 0x54D0, 0x560C, 
-    0x5D6B, 0x5E8B, 0x960A, 0x6EB2, 0x9016, 0x5ADC, 0x7F2A, 0x67E9, 0x6AA0, 0x6684, 0x80D9, 0x7145, 0x784C, 0x949B, 0x9545, 0x9E67, 
-    0x88F1, 0x8713, 0x7B31, 0x7C9E, 0x8DF9, 0x9C85, 0x992E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F49, 0x5084, 0x5186, 0x52D4, 0x5449, 0x55B4, 0x56C8, 0x5803, 0x58F1, 0x5A28, 0x5B15, 0x5C62, 0x5D70, 0x5E70, 0x5FB1, 0x6110, 
-    0x61F8, 0x636F, 0x6498, 0x65A0, 0x66C7, 0x6806, 0x6927, 0x6A22, 0x6AFC, 0x6C01, 0x6D7A, 0x6EA1, 0x6FAE, 0x7093, 0x719E, 0x729A, 
-    0x222B, 0x2481, 0xFF32, 0x3072, 0x30D2, 0x03C3, 0x0431, 0x3112, 0x252E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8019, 
-    0x5E01, 0x60E8, 0x9A8B, 0x5306, 0x72C4, 0x5151, 0x82AC, 0x6562, 0x6302, 0x9602, 0x7070, 0x5BB6, 0x63ED, 0x75BD, 0x6073, 0x916A, 
-    0x70C8, 0x4E71, 0x9761, 0x56CA, 0x4E53, 0x57D4, 0x4E14, 0x7EAB, 0x68A2, 0x5BA4, 0x8258, 0x6843, 0x9E35, 0x6211, 0x5F26, 0x5E78, 
-    0x5CA9, 0x4E59, 0x53F3, 0x7838, 0x627E, 0x5FE0, 0x6ED3, 0x533E, 0x50D6, 0x8C1D, 0x57A1, 0x82A4, 0x83C0, 0x629F, 0x54AD, 0x5601, 
-    0x5D4B, 0x5E96, 0x960B, 0x6E5F, 0x9021, 0x5B09, 0x7F2B, 0x67B0, 0x6A50, 0x668C, 0x80CD, 0x7172, 0x786A, 0x949C, 0x9546, 0x9E68, 
-    0x891A, 0x86DE, 0x7B20, 0x7CA2, 0x8DFB, 0x9C86, 0x9955, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F4A, 0x5086, 0x5187, 0x52D5, 0x544C, 0x55B6, 0x56C9, 0x5804, 0x58F2, 0x5A2A, 0x5B18, 0x5C64, 0x5D71, 0x5E71, 0x5FB2, 0x6111, 
-    0x61F9, 0x6370, 0x649A, 0x65A2, 0x66C8, 0x680D, 0x6928, 0x6A23, 0x6AFD, 0x6C02, 0x6D7B, 0x6EA3, 0x6FAF, 0x7097, 0x71A1, 0x729B, 
-    0x222E, 0x2482, 0xFF33, 0x3073, 0x30D3, 0x03C4, 0x0432, 0x3113, 0x252F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x575D, 
-    0x5E87, 0x707F, 0x79E4, 0x4ECE, 0x6DA4, 0x961F, 0x915A, 0x8D63, 0x8902, 0x6CB3, 0x6325, 0x52A0, 0x63A5, 0x5C45, 0x5751, 0x70D9, 
-    0x52A3, 0x63A0, 0x7CDC, 0x6320, 0x5E9E, 0x6734, 0x602F, 0x6254, 0x634E, 0x89C6, 0x64DE, 0x9003, 0x9640, 0x65A1, 0x5ACC, 0x674F, 
-    0x5EF6, 0x77E3, 0x4F51, 0x6742, 0x6CBC, 0x949F, 0x5B50, 0x8D5C, 0x5106, 0x8C1F, 0x587E, 0x82E1, 0x8426, 0x62BB, 0x54C2, 0x5624, 
-    0x5D4A, 0x5EA5, 0x960C, 0x6E86, 0x9035, 0x5B17, 0x7F2C, 0x680C, 0x6A5B, 0x66A7, 0x80D7, 0x714A, 0x789B, 0x94A3, 0x9549, 0x9E69, 
-    0x88FC, 0x86F4, 0x7B25, 0x7CB2, 0x8DE4, 0x9C87, 0x9954, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F4B, 0x5087, 0x518A, 0x52D7, 0x544D, 0x55B8, 0x56CB, 0x5805, 0x58F4, 0x5A2B, 0x5B19, 0x5C67, 0x5D72, 0x5E75, 0x5FB3, 0x6112, 
-    0x61FA, 0x6372, 0x649B, 0x65A3, 0x66C9, 0x6810, 0x6929, 0x6A24, 0x6AFE, 0x6C03, 0x6D7D, 0x6EA4, 0x6FB0, 0x7098, 0x71A2, 0x729C, 
-    0x2261, 0x2483, 0xFF34, 0x3074, 0x30D4, 0x03C5, 0x0433, 0x3114, 0x2530, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9738, 
-    0x75F9, 0x82CD, 0x5403, 0x4E1B, 0x7FDF, 0x5BF9, 0x5429, 0x5188, 0x4E56, 0x6DB8, 0x8F89, 0x835A, 0x7686, 0x9A79, 0x542D, 0x6D9D, 
-    0x730E, 0x7565, 0x8FF7, 0x8111, 0x65C1, 0x5703, 0x7A83, 0x4ECD, 0x7A0D, 0x8BD5, 0x55FD, 0x6DD8, 0x9A6E, 0x5367, 0x663E, 0x6027, 
-    0x8A00, 0x4EE5, 0x91C9, 0x683D, 0x8D75, 0x8877, 0x81EA, 0x5366, 0x50ED, 0x8C20, 0x58BC, 0x8309, 0x83F0, 0x62CA, 0x54B4, 0x5623, 
-    0x5D69, 0x5EA0, 0x960D, 0x6E53, 0x9036, 0x5B16, 0x7F2D, 0x67D9, 0x6A35, 0x669D, 0x6710, 0x7178, 0x7893, 0x94A4, 0x954C, 0x9E6A, 
-    0x88E8, 0x86DF, 0x7B24, 0x7CBC, 0x8E09, 0x9C88, 0x9ADF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F4C, 0x5089, 0x518B, 0x52D9, 0x544E, 0x55BA, 0x56CC, 0x5808, 0x58F5, 0x5A2C, 0x5B1A, 0x5C68, 0x5D73, 0x5E77, 0x5FB4, 0x6113, 
-    0x61FB, 0x6373, 0x649C, 0x65A6, 0x66CA, 0x6812, 0x692A, 0x6A25, 0x6AFF, 0x6C04, 0x6D7E, 0x6EA6, 0x6FB1, 0x709A, 0x71A3, 0x729D, 
-    0x224C, 0x2484, 0xFF35, 0x3075, 0x30D5, 0x03C6, 0x0434, 0x3115, 0x2531, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7F62, 
-    0x95ED, 0x8231, 0x75F4, 0x51D1, 0x5AE1, 0x58A9, 0x6C1B, 0x521A, 0x62D0, 0x8D6B, 0x5FBD, 0x988A, 0x79F8, 0x83CA, 0x7A7A, 0x52D2, 
-    0x7433, 0x62A1, 0x8C1C, 0x607C, 0x802A, 0x666E, 0x94A6, 0x65E5, 0x70E7, 0x6536, 0x82CF, 0x9676, 0x9A7C, 0x63E1, 0x9669, 0x59D3, 
-    0x989C, 0x827A, 0x8BF1, 0x54C9, 0x7167, 0x7EC8, 0x6E0D, 0x5363, 0x50EC, 0x8C21, 0x58C5, 0x82F7, 0x83E1, 0x62DA, 0x54D2, 0x55FE, 
-    0x5D74, 0x5EB9, 0x960F, 0x6E54, 0x902D, 0x5B32, 0x7F2F, 0x67B5, 0x6A8E, 0x66BE, 0x80DD, 0x717A, 0x789A, 0x94AB, 0x954E, 0x9E6B, 
-    0x88FE, 0x86D8, 0x7B33, 0x7CBD, 0x8DFD, 0x7A23, 0x9AE1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F52, 0x508A, 0x518E, 0x52DA, 0x544F, 0x55BC, 0x56CD, 0x5809, 0x58F7, 0x5A2D, 0x5B1B, 0x5C69, 0x5D75, 0x5E79, 0x5FB6, 0x6114, 
-    0x61FC, 0x6374, 0x649D, 0x65A8, 0x66CB, 0x6814, 0x692B, 0x6A26, 0x6B00, 0x6C08, 0x6D7F, 0x6EA8, 0x6FB2, 0x709B, 0x71A4, 0x729E, 
-    0x2248, 0x2485, 0xFF36, 0x3076, 0x30D6, 0x03C7, 0x0435, 0x3116, 0x2532, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7238, 
-    0x655D, 0x4ED3, 0x6301, 0x7C97, 0x62B5, 0x5428, 0x5206, 0x94A2, 0x602A, 0x8910, 0x6062, 0x8D3E, 0x8857, 0x5C40, 0x6050, 0x4E50, 
-    0x6797, 0x8F6E, 0x5F25, 0x95F9, 0x80D6, 0x6D66, 0x4FB5, 0x620E, 0x828D, 0x624B, 0x9165, 0x8BA8, 0x692D, 0x6C83, 0x73B0, 0x5144, 
-    0x960E, 0x6291, 0x53C8, 0x707E, 0x7F69, 0x79CD, 0x5B57, 0x5202, 0x50E6, 0x8C25, 0x58D1, 0x82E4, 0x845C, 0x62D7, 0x54A7, 0x5600, 
-    0x5D82, 0x5EB5, 0x9612, 0x6E32, 0x902F, 0x5B37, 0x7F30, 0x67DA, 0x6A79, 0x66DB, 0x80EB, 0x7198, 0x7887, 0x94AA, 0x954F, 0x9E6C, 
-    0x88F0, 0x86D1, 0x7B3E, 0x7CC1, 0x8E14, 0x9C8B, 0x9AE6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F54, 0x508B, 0x518F, 0x52DB, 0x5451, 0x55BF, 0x56CE, 0x580A, 0x58F8, 0x5A2E, 0x5B1C, 0x5C6A, 0x5D76, 0x5E7E, 0x5FB8, 0x6116, 
-    0x61FD, 0x6375, 0x649F, 0x65AA, 0x66CC, 0x6815, 0x692C, 0x6A27, 0x6B01, 0x6C09, 0x6D80, 0x6EA9, 0x6FB4, 0x709E, 0x71A5, 0x72A0, 
-    0x223D, 0x2486, 0xFF37, 0x3077, 0x30D7, 0x03C8, 0x0451, 0x3117, 0x2533, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x767D, 
-    0x5F0A, 0x6CA7, 0x5319, 0x918B, 0x5E95, 0x8E72, 0x7EB7, 0x7F38, 0x68FA, 0x9E64, 0x86D4, 0x7532, 0x9636, 0x5480, 0x5B54, 0x96F7, 
-    0x78F7, 0x4F26, 0x7C73, 0x6DD6, 0x629B, 0x8C31, 0x4EB2, 0x8338, 0x52FA, 0x9996, 0x4FD7, 0x5957, 0x59A5, 0x5DEB, 0x732E, 0x51F6, 
-    0x708E, 0x6613, 0x5E7C, 0x5BB0, 0x5146, 0x80BF, 0x9B03, 0x5208, 0x50EE, 0x8C27, 0x5729, 0x830F, 0x8451, 0x62EE, 0x54A6, 0x5627, 
-    0x5D99, 0x5EBE, 0x9615, 0x6E25, 0x9044, 0x5B40, 0x7F31, 0x67B3, 0x6A3D, 0x66DC, 0x80F1, 0x71B3, 0x789C, 0x94AD, 0x9552, 0x9E71, 
-    0x8921, 0x8703, 0x7B1E, 0x7CC7, 0x8E1D, 0x9C8E, 0x9AEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F56, 0x508C, 0x5190, 0x52DC, 0x545A, 0x55C0, 0x56CF, 0x580C, 0x58FA, 0x5A2F, 0x5B1D, 0x5C6B, 0x5D77, 0x5E81, 0x5FB9, 0x6117, 
-    0x61FE, 0x6378, 0x64A0, 0x65AC, 0x66CD, 0x6818, 0x692E, 0x6A29, 0x6B02, 0x6C0A, 0x6D81, 0x6EAB, 0x6FB5, 0x709F, 0x71A6, 0x72A1, 
-    0x221D, 0x2487, 0xFF38, 0x3078, 0x30D8, 0x03C9, 0x0436, 0x3118, 0x2534, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x67CF, 
-    0x5FC5, 0x85CF, 0x6C60, 0x7C07, 0x5730, 0x6566, 0x575F, 0x809B, 0x5173, 0x8D3A, 0x56DE, 0x94BE, 0x622A, 0x77E9, 0x63A7, 0x956D, 
-    0x9716, 0x4ED1, 0x79D8, 0x5462, 0x5486, 0x66DD, 0x79E6, 0x84C9, 0x97F6, 0x5B88, 0x7D20, 0x7279, 0x62D3, 0x545C, 0x53BF, 0x80F8, 
-    0x6CBF, 0x9091, 0x8FC2, 0x8F7D, 0x8087, 0x91CD, 0x68D5, 0x520E, 0x5107, 0x8C2A, 0x572C, 0x8307, 0x845A, 0x6322, 0x54D3, 0x562D, 
-    0x5D9D, 0x5EB3, 0x9616, 0x6E44, 0x9051, 0x5C15, 0x7F32, 0x67DD, 0x6A28, 0x66E6, 0x80F4, 0x71B5, 0x78A1, 0x94AC, 0x9553, 0x9E6D, 
-    0x8919, 0x8707, 0x7B58, 0x7CCC, 0x8E1F, 0x9C90, 0x9AEB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F61, 0x508E, 0x5191, 0x52DD, 0x545D, 0x55C1, 0x56D0, 0x580E, 0x58FB, 0x5A30, 0x5B1E, 0x5C6C, 0x5D78, 0x5E82, 0x5FBA, 0x6118, 
-    0x6200, 0x6379, 0x64A1, 0x65AE, 0x66CE, 0x6819, 0x692F, 0x6A2B, 0x6B03, 0x6C0B, 0x6D83, 0x6EAC, 0x6FB7, 0x70A0, 0x71A7, 0x72A2, 
-    0x2260, 0x2460, 0xFF39, 0x3079, 0x30D9, 0x0000, 0x0437, 0x3119, 0x2535, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x767E, 
-    0x8F9F, 0x64CD, 0x8FDF, 0x4FC3, 0x8482, 0x987F, 0x711A, 0x7EB2, 0x5B98, 0x563F, 0x6BC1, 0x5047, 0x52AB, 0x4E3E, 0x62A0, 0x857E, 
-    0x4E34, 0x6CA6, 0x89C5, 0x9981, 0x5228, 0x7011, 0x7434, 0x8363, 0x5C11, 0x5BFF, 0x901F, 0x85E4, 0x553E, 0x94A8, 0x817A, 0x5308, 
-    0x5944, 0x5C79, 0x6DE4, 0x518D, 0x53EC, 0x4EF2, 0x8E2A, 0x522D, 0x510B, 0x8C2B, 0x572A, 0x82DC, 0x8459, 0x62F6, 0x54D4, 0x5658, 
-    0x8C73, 0x8D53, 0x9617, 0x6EDF, 0x9052, 0x5C1C, 0x7F33, 0x6800, 0x6A58, 0x66E9, 0x80ED, 0x71A8, 0x78A3, 0x94AF, 0x9554, 0x9E73, 
-    0x8913, 0x86F8, 0x7B5A, 0x7CCD, 0x8E2C, 0x9C91, 0x9AFB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F62, 0x508F, 0x5193, 0x52DE, 0x545E, 0x55C2, 0x56D1, 0x580F, 0x58FC, 0x5A33, 0x5B1F, 0x5C6D, 0x5D79, 0x5E83, 0x5FBB, 0x6119, 
-    0x6201, 0x637C, 0x64A2, 0x65B1, 0x66CF, 0x681A, 0x6931, 0x6A2C, 0x6B04, 0x6C0C, 0x6D84, 0x6EAD, 0x6FB8, 0x70A1, 0x71A9, 0x72A3, 
-    0x226E, 0x2461, 0xFF3A, 0x307A, 0x30DA, 0x0000, 0x0438, 0x311A, 0x2536, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6446, 
-    0x58C1, 0x7CD9, 0x5F1B, 0x8E7F, 0x7B2C, 0x56E4, 0x6C7E, 0x5C97, 0x51A0, 0x9ED1, 0x6094, 0x7A3C, 0x8282, 0x6CAE, 0x53E3, 0x78CA, 
-    0x90BB, 0x7EB6, 0x6CCC, 0x5185, 0x70AE, 0x671F, 0x52E4, 0x878D, 0x54E8, 0x6388, 0x7C9F, 0x817E, 0x6316, 0x4E4C, 0x9985, 0x6C79, 
-    0x63A9, 0x4EBF, 0x4E8E, 0x5728, 0x906E, 0x4F17, 0x5B97, 0x5233, 0x4EDD, 0x8C2E, 0x5733, 0x82F4, 0x8473, 0x6339, 0x5472, 0x5639, 
-    0x5DB7, 0x5ED2, 0x9619, 0x6EB1, 0x9050, 0x5B5A, 0x7F35, 0x67C3, 0x6A7C, 0x8D32, 0x810D, 0x71A0, 0x78B2, 0x94B0, 0x9556, 0x7592, 
-    0x891B, 0x8708, 0x7B45, 0x7CC8, 0x8E2E, 0x9C92, 0x9AED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F66, 0x5090, 0x5194, 0x52E0, 0x545F, 0x55C3, 0x56D2, 0x5810, 0x58FD, 0x5A35, 0x5B20, 0x5C70, 0x5D7A, 0x5E85, 0x5FBE, 0x611B, 
-    0x6202, 0x637D, 0x64A3, 0x65B2, 0x66D0, 0x681B, 0x6932, 0x6A2D, 0x6B05, 0x6C0E, 0x6D86, 0x6EAE, 0x6FBA, 0x70A2, 0x71AA, 0x72A4, 
-    0x226F, 0x2462, 0xFF3B, 0x307B, 0x30DB, 0x0000, 0x0439, 0x311B, 0x2537, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F70, 
-    0x81C2, 0x69FD, 0x9A70, 0x7BE1, 0x5E1D, 0x949D, 0x7C89, 0x6E2F, 0x89C2, 0x75D5, 0x6167, 0x4EF7, 0x6854, 0x805A, 0x6263, 0x7D2F, 
-    0x9CDE, 0x8BBA, 0x871C, 0x5AE9, 0x888D, 0x6B3A, 0x82B9, 0x7194, 0x90B5, 0x552E, 0x50F3, 0x75BC, 0x54C7, 0x6C61, 0x7FA1, 0x96C4, 
-    0x773C, 0x5F79, 0x76C2, 0x54B1, 0x6298, 0x821F, 0x7EFC, 0x523F, 0x6C3D, 0x8C2F, 0x5739, 0x82D2, 0x8487, 0x634B, 0x54A3, 0x5657, 
-    0x5DC5, 0x5ED1, 0x961A, 0x6E98, 0x9068, 0x5B65, 0x5E7A, 0x67B8, 0x6A91, 0x8D33, 0x810E, 0x71E0, 0x78B9, 0x94B2, 0x9557, 0x7594, 
-    0x890A, 0x870A, 0x7B75, 0x7CC5, 0x8E23, 0x9C94, 0x9AF9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F68, 0x5091, 0x5198, 0x52E1, 0x5460, 0x55C6, 0x56D3, 0x5812, 0x58FE, 0x5A37, 0x5B21, 0x5C72, 0x5D7B, 0x5E88, 0x5FBF, 0x611C, 
-    0x6203, 0x637E, 0x64A5, 0x65B3, 0x66D1, 0x681C, 0x6933, 0x6A2E, 0x6B06, 0x6C12, 0x6D87, 0x6EB0, 0x6FBB, 0x70A3, 0x71AB, 0x72A5, 
-    0x2264, 0x2463, 0xFF3C, 0x307C, 0x30DC, 0x0000, 0x043A, 0x311C, 0x2538, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8D25, 
-    0x907F, 0x66F9, 0x803B, 0x7A9C, 0x5F1F, 0x76FE, 0x594B, 0x6760, 0x7BA1, 0x5F88, 0x5349, 0x67B6, 0x6770, 0x62D2, 0x5BC7, 0x5121, 
-    0x6DCB, 0x841D, 0x5BC6, 0x80FD, 0x8DD1, 0x6816, 0x64D2, 0x6EB6, 0x7ECD, 0x53D7, 0x5851, 0x8A8A, 0x86D9, 0x8BEC, 0x5BAA, 0x718A, 
-    0x884D, 0x81C6, 0x6986, 0x6512, 0x54F2, 0x5468, 0x603B, 0x5240, 0x4F58, 0x8C32, 0x572E, 0x82D8, 0x8488, 0x6343, 0x54D5, 0x562C, 
-    0x5F73, 0x5EDB, 0x4E2C, 0x6EE0, 0x9058, 0x5B73, 0x757F, 0x67E2, 0x6A90, 0x8D36, 0x80F2, 0x71D4, 0x78A5, 0x94B4, 0x9558, 0x7596, 
-    0x8934, 0x870D, 0x7B4C, 0x7CD7, 0x8E2F, 0x9C95, 0x9B08, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F6A, 0x5092, 0x519A, 0x52E2, 0x5461, 0x55C7, 0x56D5, 0x5813, 0x58FF, 0x5A38, 0x5B22, 0x5C73, 0x5D7C, 0x5E89, 0x5FC0, 0x611D, 
-    0x6204, 0x637F, 0x64A6, 0x65B4, 0x66D2, 0x681E, 0x6935, 0x6A30, 0x6B07, 0x6C17, 0x6D8A, 0x6EB3, 0x6FBC, 0x70A4, 0x71AD, 0x72A6, 
-    0x2265, 0x2464, 0xFF3D, 0x307D, 0x30DD, 0x0000, 0x043B, 0x311D, 0x2539, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62DC, 
-    0x965B, 0x8349, 0x9F7F, 0x6467, 0x9012, 0x9041, 0x4EFD, 0x7BD9, 0x9986, 0x72E0, 0x60E0, 0x9A7E, 0x6377, 0x636E, 0x67AF, 0x5792, 
-    0x51DB, 0x87BA, 0x5E42, 0x59AE, 0x6CE1, 0x621A, 0x79BD, 0x5BB9, 0x5962, 0x7626, 0x6EAF, 0x68AF, 0x6D3C, 0x5C4B, 0x9677, 0x4F11, 
-    0x6F14, 0x9038, 0x865E, 0x6682, 0x86F0, 0x5DDE, 0x7EB5, 0x524C, 0x4F65, 0x8C33, 0x572F, 0x830C, 0x847A, 0x63AD, 0x54BB, 0x564D, 
-    0x5F77, 0x5EE8, 0x723F, 0x6F2D, 0x9062, 0x5B51, 0x5DDB, 0x680E, 0x6AA9, 0x8D3B, 0x80FC, 0x71E7, 0x78D4, 0x94B6, 0x9559, 0x75A0, 
-    0x892B, 0x8709, 0x7B5D, 0x7CE8, 0x8E3A, 0x9C9A, 0x9B0F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F6B, 0x5093, 0x519D, 0x52E3, 0x5463, 0x55C8, 0x56D6, 0x5814, 0x5900, 0x5A39, 0x5B23, 0x5C74, 0x5D7D, 0x5E8C, 0x5FC1, 0x611E, 
-    0x6205, 0x6381, 0x64A7, 0x65B5, 0x66D3, 0x681F, 0x6936, 0x6A32, 0x6B08, 0x6C1C, 0x6D8B, 0x6EB5, 0x6FBD, 0x70A5, 0x71AE, 0x72A7, 
-    0x221E, 0x2465, 0xFF3E, 0x307E, 0x30DE, 0x0000, 0x043C, 0x311E, 0x253A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7A17, 
-    0x97AD, 0x5395, 0x4F88, 0x5D14, 0x7F14, 0x6387, 0x5FFF, 0x768B, 0x7F50, 0x6068, 0x6666, 0x5AC1, 0x776B, 0x5DE8, 0x54ED, 0x64C2, 
-    0x8D41, 0x7F57, 0x68C9, 0x9713, 0x5478, 0x59BB, 0x5BDD, 0x7ED2, 0x8D4A, 0x517D, 0x5BBF, 0x5254, 0x5A03, 0x65E0, 0x9650, 0x4FEE, 
-    0x8273, 0x8084, 0x611A, 0x8D5E, 0x8F99, 0x6D32, 0x90B9, 0x525E, 0x4FCE, 0x8C35, 0x575C, 0x82FB, 0x8489, 0x63F6, 0x54BF, 0x5662, 
-    0x5F82, 0x5EEA, 0x6215, 0x6EE2, 0x905B, 0x5B53, 0x753E, 0x67C1, 0x6A97, 0x8D3D, 0x6715, 0x71F9, 0x78D9, 0x94B7, 0x955B, 0x759D, 
-    0x8936, 0x8723, 0x7B60, 0x826E, 0x8E40, 0x9C9B, 0x9B13, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F6D, 0x5094, 0x519E, 0x52E5, 0x5465, 0x55CA, 0x56D8, 0x5816, 0x5901, 0x5A3A, 0x5B24, 0x5C75, 0x5D7E, 0x5E8D, 0x5FC2, 0x6121, 
-    0x6207, 0x6383, 0x64A8, 0x65B6, 0x66D4, 0x6820, 0x6937, 0x6A33, 0x6B09, 0x6C1D, 0x6D8D, 0x6EB8, 0x6FBE, 0x70A6, 0x71AF, 0x72A8, 
-    0x2235, 0x2466, 0xFF3F, 0x307F, 0x30DF, 0x0000, 0x043D, 0x311F, 0x253B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6591, 
-    0x8FB9, 0x7B56, 0x5C3A, 0x50AC, 0x98A0, 0x54C6, 0x6124, 0x9AD8, 0x60EF, 0x54FC, 0x8D3F, 0x6B7C, 0x7AED, 0x5177, 0x7A9F, 0x808B, 
-    0x541D, 0x903B, 0x7720, 0x502A, 0x80DA, 0x4E03, 0x6C81, 0x5197, 0x86C7, 0x852C, 0x8BC9, 0x8E22, 0x74E6, 0x829C, 0x7EBF, 0x7F9E, 
-    0x5830, 0x75AB, 0x8206, 0x8D43, 0x8005, 0x8BCC, 0x8D70, 0x5261, 0x9FA0, 0x8C36, 0x573B, 0x82D3, 0x8478, 0x6371, 0x54CC, 0x5659, 
-    0x5F87, 0x81BA, 0x6C35, 0x6EA5, 0x66B9, 0x5B62, 0x9095, 0x67FD, 0x6AAB, 0x8D40, 0x8112, 0x721D, 0x78C9, 0x94B8, 0x955E, 0x75AC, 
-    0x8941, 0x873B, 0x7B6E, 0x66A8, 0x8E39, 0x9C9E, 0x9B1F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F6E, 0x5095, 0x519F, 0x52E6, 0x5467, 0x55CB, 0x56D9, 0x5817, 0x5903, 0x5A3B, 0x5B25, 0x5C76, 0x5D7F, 0x5E8E, 0x5FC7, 0x6122, 
-    0x6209, 0x6384, 0x64AA, 0x65B7, 0x66D5, 0x6822, 0x6938, 0x6A34, 0x6B0A, 0x6C1E, 0x6D8F, 0x6EB9, 0x6FBF, 0x70A7, 0x71B0, 0x72A9, 
-    0x2234, 0x2467, 0xFF40, 0x3080, 0x30E0, 0xFE35, 0x043E, 0x3120, 0x253C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ED, 
-    0x7F16, 0x4FA7, 0x8D64, 0x8106, 0x6382, 0x591A, 0x7CAA, 0x818F, 0x704C, 0x4EA8, 0x79FD, 0x76D1, 0x6D01, 0x8DDD, 0x82E6, 0x7C7B, 
-    0x62CE, 0x9523, 0x7EF5, 0x6CE5, 0x57F9, 0x51C4, 0x9752, 0x63C9, 0x820C, 0x67A2, 0x8083, 0x9511, 0x889C, 0x68A7, 0x76F8, 0x673D, 
-    0x71D5, 0x4EA6, 0x4F59, 0x810F, 0x9517, 0x7CA5, 0x594F, 0x525C, 0x6C46, 0x5369, 0x5742, 0x8311, 0x843C, 0x637A, 0x54D9, 0x565C, 
-    0x5F89, 0x5FC4, 0x6C54, 0x6EA7, 0x9074, 0x9A75, 0x738E, 0x6832, 0x7337, 0x8D45, 0x8C5A, 0x7228, 0x78EC, 0x94B9, 0x955F, 0x75A3, 
-    0x8966, 0x871E, 0x7B7B, 0x7FBF, 0x8E35, 0x9C9F, 0x9B23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F71, 0x5096, 0x51A1, 0x52E7, 0x5469, 0x55CE, 0x56DC, 0x5818, 0x5905, 0x5A3D, 0x5B26, 0x5C77, 0x5D80, 0x5E92, 0x5FC8, 0x6125, 
-    0x6213, 0x6385, 0x64AB, 0x65B8, 0x66D6, 0x6823, 0x693A, 0x6A36, 0x6B0B, 0x6C20, 0x6D90, 0x6EBC, 0x6FC1, 0x70A8, 0x71B1, 0x72AA, 
-    0x2642, 0x2468, 0xFF41, 0x3081, 0x30E1, 0xFE36, 0x043F, 0x3121, 0x253D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x642C, 
-    0x8D2C, 0x518C, 0x7FC5, 0x7601, 0x6EC7, 0x593A, 0x4E30, 0x7F94, 0x8D2F, 0x6A2A, 0x4F1A, 0x575A, 0x7ED3, 0x8E1E, 0x9177, 0x6CEA, 
-    0x73B2, 0x7BA9, 0x5195, 0x5C3C, 0x88F4, 0x6F06, 0x8F7B, 0x67D4, 0x820D, 0x68B3, 0x9178, 0x63D0, 0x6B6A, 0x543E, 0x53A2, 0x55C5, 
-    0x538C, 0x88D4, 0x4FDE, 0x846C, 0x8517, 0x8F74, 0x63CD, 0x84AF, 0x7C74, 0x537A, 0x5769, 0x831A, 0x8446, 0x638E, 0x54DA, 0x564C, 
-    0x5F8C, 0x5FC9, 0x6C5C, 0x6EBD, 0x907D, 0x9A77, 0x7391, 0x6833, 0x7352, 0x8D46, 0x8136, 0x706C, 0x78F2, 0x94BA, 0x955D, 0x75B3, 
-    0x897B, 0x8725, 0x7B62, 0x7FCE, 0x8E3D, 0x9CA0, 0x9EBD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F72, 0x5097, 0x51A3, 0x52E8, 0x546A, 0x55CF, 0x56E3, 0x581A, 0x5906, 0x5A3E, 0x5B27, 0x5C78, 0x5D81, 0x5E98, 0x5FCA, 0x6128, 
-    0x6214, 0x6386, 0x64AF, 0x65BA, 0x66D7, 0x6824, 0x693B, 0x6A37, 0x6B0C, 0x6C23, 0x6D92, 0x6EBE, 0x6FC3, 0x70A9, 0x71B2, 0x72AB, 
-    0x2640, 0x2469, 0xFF42, 0x3082, 0x30E2, 0xFE39, 0x0440, 0x3122, 0x253E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6273, 
-    0x6241, 0x6D4B, 0x65A5, 0x7CB9, 0x7898, 0x579B, 0x5C01, 0x7CD5, 0x5149, 0x8861, 0x70E9, 0x5C16, 0x89E3, 0x952F, 0x5E93, 0x68F1, 
-    0x83F1, 0x9AA1, 0x514D, 0x62DF, 0x8D54, 0x67D2, 0x6C22, 0x8089, 0x8D66, 0x6B8A, 0x849C, 0x9898, 0x5916, 0x5434, 0x9576, 0x9508, 
-    0x781A, 0x610F, 0x903E, 0x906D, 0x8FD9, 0x8098, 0x79DF, 0x527D, 0x516E, 0x961D, 0x5785, 0x8306, 0x8469, 0x63B4, 0x54DC, 0x5654, 
-    0x5F95, 0x5FD6, 0x6C4A, 0x6EBB, 0x9082, 0x9A78, 0x73AE, 0x6860, 0x6B81, 0x8D48, 0x811E, 0x7118, 0x7905, 0x94BC, 0x9561, 0x75B4, 
-    0x758B, 0x872E, 0x7B72, 0x7FD5, 0x8E31, 0x9CA1, 0x9EBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F75, 0x5098, 0x51A6, 0x52E9, 0x546B, 0x55D0, 0x56E5, 0x581B, 0x5908, 0x5A3F, 0x5B28, 0x5C7B, 0x5D83, 0x5E9B, 0x5FCB, 0x6129, 
-    0x6219, 0x638B, 0x64B1, 0x65BB, 0x66D8, 0x6825, 0x693C, 0x6A38, 0x6B0D, 0x6C25, 0x6D96, 0x6EBF, 0x6FC4, 0x70AA, 0x71B4, 0x72AE, 
-    0x00B0, 0x0000, 0xFF43, 0x3083, 0x30E3, 0xFE3A, 0x0441, 0x3123, 0x253F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x822C, 
-    0x4FBF, 0x5C42, 0x70BD, 0x6DEC, 0x70B9, 0x8EB2, 0x67AB, 0x641E, 0x5E7F, 0x6052, 0x6C47, 0x7B3A, 0x59D0, 0x4FF1, 0x88E4, 0x695E, 
-    0x96F6, 0x88F8, 0x52C9, 0x4F60, 0x966A, 0x6C8F, 0x503E, 0x8339, 0x6444, 0x6292, 0x7B97, 0x8E44, 0x8C4C, 0x6BCB, 0x9999, 0x79C0, 
-    0x96C1, 0x6BC5, 0x9C7C, 0x7CDF, 0x6D59, 0x5E1A, 0x8DB3, 0x5282, 0x5DFD, 0x9622, 0x576B, 0x8314, 0x8476, 0x636D, 0x54A9, 0x5686, 
-    0x5F99, 0x5FCF, 0x6CA3, 0x6EB7, 0x9088, 0x9A7A, 0x73A2, 0x6861, 0x6B82, 0x8D49, 0x812C, 0x7166, 0x78F4, 0x94BD, 0x9562, 0x75B8, 
-    0x80E5, 0x871A, 0x7B71, 0x7FE5, 0x8E49, 0x9CA2, 0x7E3B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F77, 0x5099, 0x51A7, 0x52EA, 0x546C, 0x55D5, 0x56E6, 0x581C, 0x5909, 0x5A41, 0x5B29, 0x5C7C, 0x5D84, 0x5E9D, 0x5FCE, 0x612A, 
-    0x621C, 0x638D, 0x64B2, 0x65BE, 0x66DA, 0x6826, 0x693E, 0x6A39, 0x6B0E, 0x6C2B, 0x6D97, 0x6EC0, 0x6FC5, 0x70B0, 0x71B6, 0x72B1, 
-    0x2032, 0x0000, 0xFF44, 0x3084, 0x30E4, 0xFE3F, 0x0442, 0x3124, 0x2540, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9881, 
-    0x53D8, 0x8E6D, 0x5145, 0x7FE0, 0x5178, 0x6735, 0x8702, 0x9550, 0x901B, 0x8F70, 0x8BB3, 0x95F4, 0x6212, 0x53E5, 0x5938, 0x51B7, 
-    0x9F84, 0x843D, 0x5A29, 0x533F, 0x914D, 0x5176, 0x537F, 0x8815, 0x5C04, 0x8F93, 0x867D, 0x557C, 0x5F2F, 0x6B66, 0x7BB1, 0x8896, 
-    0x5501, 0x5FC6, 0x6109, 0x51FF, 0x73CD, 0x5492, 0x5352, 0x5281, 0x9EC9, 0x9621, 0x5786, 0x8315, 0x848C, 0x63AC, 0x54AA, 0x5664, 
-    0x5F9C, 0x6003, 0x6C85, 0x6ED7, 0x9083, 0x9A7F, 0x739F, 0x684E, 0x6B87, 0x8D47, 0x8118, 0x71B9, 0x7913, 0x94BF, 0x9564, 0x75C4, 
-    0x76B2, 0x873E, 0x7B90, 0x7FE1, 0x8E41, 0x9CA3, 0x9E82, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F78, 0x509A, 0x51A8, 0x52EB, 0x546D, 0x55D7, 0x56E7, 0x581D, 0x590A, 0x5A42, 0x5B2A, 0x5C7D, 0x5D85, 0x5EA1, 0x5FD3, 0x612C, 
-    0x621D, 0x6391, 0x64B3, 0x65BF, 0x66DE, 0x6827, 0x6940, 0x6A3A, 0x6B0F, 0x6C2C, 0x6D98, 0x6EC3, 0x6FC6, 0x70B2, 0x71B7, 0x72B2, 
-    0x2033, 0x3220, 0xFF45, 0x3085, 0x30E5, 0xFE40, 0x0443, 0x3125, 0x2541, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x677F, 
-    0x535E, 0x63D2, 0x51B2, 0x6751, 0x975B, 0x8DFA, 0x5CF0, 0x7A3F, 0x7470, 0x54C4, 0x8BF2, 0x714E, 0x85C9, 0x60E7, 0x57AE, 0x5398, 
-    0x94C3, 0x6D1B, 0x7F05, 0x817B, 0x4F69, 0x68CB, 0x6E05, 0x5112, 0x6151, 0x53D4, 0x968B, 0x4F53, 0x6E7E, 0x4E94, 0x8944, 0x7EE3, 
-    0x5F66, 0x4E49, 0x6E1D, 0x85FB, 0x659F, 0x76B1, 0x65CF, 0x5290, 0x9998, 0x9631, 0x577C, 0x82E0, 0x848E, 0x638A, 0x54A4, 0x5671, 
-    0x5FA8, 0x5FEE, 0x6C90, 0x6EB4, 0x908B, 0x9A7D, 0x73CF, 0x6862, 0x6B84, 0x8D4D, 0x8132, 0x623E, 0x7924, 0x94C4, 0x9565, 0x75B1, 
-    0x76B4, 0x8748, 0x7BA6, 0x7FE6, 0x8E42, 0x9CA5, 0x9E87, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F79, 0x509B, 0x51A9, 0x52EC, 0x546E, 0x55D8, 0x56E8, 0x581F, 0x590B, 0x5A43, 0x5B2B, 0x5C7E, 0x5D86, 0x5EA2, 0x5FD4, 0x612D, 
-    0x621E, 0x6393, 0x64B4, 0x65C0, 0x66DF, 0x6828, 0x6941, 0x6A3B, 0x6B10, 0x6C2D, 0x6D99, 0x6EC4, 0x6FC7, 0x70B4, 0x71B8, 0x72B3, 
-    0x2103, 0x3221, 0xFF46, 0x3086, 0x30E6, 0xFE3D, 0x0444, 0x3126, 0x2542, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7248, 
-    0x8FA8, 0x53C9, 0x866B, 0x5B58, 0x57AB, 0x8235, 0x950B, 0x544A, 0x89C4, 0x70D8, 0x7ED8, 0x517C, 0x82A5, 0x70AC, 0x630E, 0x68A8, 
-    0x4F36, 0x9A86, 0x9762, 0x9006, 0x6C9B, 0x5947, 0x64CE, 0x5B7A, 0x6D89, 0x8212, 0x968F, 0x66FF, 0x73A9, 0x6342, 0x6E58, 0x589F, 
-    0x7130, 0x76CA, 0x6E14, 0x67A3, 0x771F, 0x5B99, 0x7956, 0x5293, 0x5181, 0x962A, 0x577B, 0x82D5, 0x8431, 0x6369, 0x54DD, 0x566B, 
-    0x5FAD, 0x6004, 0x6C94, 0x6ECF, 0x5F50, 0x9A80, 0x73C2, 0x6844, 0x6B92, 0x8D55, 0x8148, 0x623D, 0x791E, 0x94C8, 0x9566, 0x75B0, 
-    0x77DC, 0x8734, 0x7BA7, 0x7FE9, 0x8E51, 0x9CA6, 0x9E88, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F7A, 0x509C, 0x51AA, 0x52ED, 0x546F, 0x55D9, 0x56E9, 0x5822, 0x590C, 0x5A44, 0x5B2C, 0x5C80, 0x5D87, 0x5EA3, 0x5FD5, 0x612E, 
-    0x6220, 0x6394, 0x64B6, 0x65C2, 0x66E0, 0x682B, 0x6943, 0x6A3C, 0x6B11, 0x6C31, 0x6D9A, 0x6EC5, 0x6FC8, 0x70B5, 0x71BA, 0x72B5, 
-    0xFF04, 0x3222, 0xFF47, 0x3087, 0x30E7, 0xFE3E, 0x0445, 0x3127, 0x2543, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x626E, 
-    0x8FA9, 0x832C, 0x5D07, 0x5BF8, 0x7535, 0x5241, 0x98CE, 0x54E5, 0x572D, 0x8679, 0x8364, 0x80A9, 0x754C, 0x5267, 0x8DE8, 0x7281, 
-    0x7F9A, 0x7EDC, 0x82D7, 0x6EBA, 0x55B7, 0x6B67, 0x6674, 0x5982, 0x793E, 0x6DD1, 0x7EE5, 0x568F, 0x987D, 0x5348, 0x4E61, 0x620C, 
-    0x5BB4, 0x6EA2, 0x9685, 0x65E9, 0x7504, 0x663C, 0x8BC5, 0x5182, 0x5914, 0x963D, 0x5768, 0x831C, 0x846D, 0x63AE, 0x54CF, 0x567B, 
-    0x5FB5, 0x5FE1, 0x6C8C, 0x6E8F, 0x5F57, 0x9A81, 0x73D1, 0x6864, 0x6B93, 0x8D59, 0x814C, 0x6243, 0x7934, 0x94C9, 0x9567, 0x75C3, 
-    0x8012, 0x8731, 0x7BB8, 0x7FEE, 0x8E52, 0x9CA7, 0x9E8B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F7D, 0x509D, 0x51AD, 0x52EE, 0x5470, 0x55DA, 0x56EA, 0x5823, 0x590E, 0x5A45, 0x5B2D, 0x5C83, 0x5D88, 0x5EA4, 0x5FDA, 0x612F, 
-    0x6223, 0x6395, 0x64B9, 0x65C7, 0x66E1, 0x682C, 0x6944, 0x6A3F, 0x6B12, 0x6C33, 0x6D9C, 0x6EC6, 0x6FCA, 0x70B6, 0x71BB, 0x72BA, 
-    0x00A4, 0x3223, 0xFF48, 0x3088, 0x30E8, 0xFE41, 0x0446, 0x3128, 0x2544, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62CC, 
-    0x8FAB, 0x8336, 0x5BA0, 0x78CB, 0x4F43, 0x60F0, 0x75AF, 0x6B4C, 0x7845, 0x9E3F, 0x660F, 0x8270, 0x501F, 0x6350, 0x80EF, 0x9ECE, 
-    0x51CC, 0x5988, 0x63CF, 0x852B, 0x76C6, 0x7566, 0x6C30, 0x8FB1, 0x8BBE, 0x758F, 0x9AD3, 0x60D5, 0x4E38, 0x821E, 0x7FD4, 0x9700, 
-    0x8C1A, 0x8BE3, 0x4E88, 0x6FA1, 0x7827, 0x9AA4, 0x963B, 0x7F54, 0x52F9, 0x963C, 0x576D, 0x8351, 0x84C1, 0x63BC, 0x54DE, 0x567C, 
-    0x5FBC, 0x5FE4, 0x6C68, 0x6EC2, 0x5F56, 0x9A85, 0x73B7, 0x6883, 0x6B8D, 0x89C7, 0x8153, 0x6248, 0x9F9B, 0x94CA, 0x9568, 0x75C2, 
-    0x8014, 0x8729, 0x7BAC, 0x7FF3, 0x8E4A, 0x9CA8, 0x9E92, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F80, 0x509E, 0x51AE, 0x52EF, 0x5474, 0x55DB, 0x56EC, 0x5825, 0x5910, 0x5A47, 0x5B2E, 0x5C84, 0x5D89, 0x5EA8, 0x5FDB, 0x6130, 
-    0x6226, 0x6397, 0x64BB, 0x65C8, 0x66E2, 0x682D, 0x6945, 0x6A40, 0x6B13, 0x6C36, 0x6DA2, 0x6EC8, 0x6FCB, 0x70BA, 0x71BC, 0x72BB, 
-    0xFFE0, 0x3224, 0xFF49, 0x3089, 0x30E9, 0xFE42, 0x0447, 0x3129, 0x2545, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4F34, 
-    0x904D, 0x67E5, 0x62BD, 0x64AE, 0x7538, 0x5815, 0x70FD, 0x6401, 0x5F52, 0x6D2A, 0x5A5A, 0x5978, 0x4ECB, 0x9E43, 0x5757, 0x7BF1, 
-    0x7075, 0x9EBB, 0x7784, 0x62C8, 0x7830, 0x5D0E, 0x60C5, 0x4E73, 0x7837, 0x4E66, 0x788E, 0x6D95, 0x70F7, 0x4F0D, 0x7965, 0x865A, 
-    0x9A8C, 0x8BAE, 0x5A31, 0x86A4, 0x81FB, 0x73E0, 0x7EC4, 0x4EBB, 0x530D, 0x9642, 0x5776, 0x835B, 0x84CD, 0x63F2, 0x551B, 0x5685, 
-    0x8862, 0x5FFE, 0x6C69, 0x6E9F, 0x5F58, 0x9A88, 0x73B3, 0x681D, 0x6B9A, 0x89CA, 0x8174, 0x6249, 0x9EF9, 0x94CB, 0x9569, 0x75D6, 
-    0x8016, 0x8737, 0x7B9D, 0x7CF8, 0x8E70, 0x9CA9, 0x93D6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F81, 0x509F, 0x51B4, 0x52F1, 0x5479, 0x55DE, 0x56EE, 0x5826, 0x5911, 0x5A48, 0x5B2F, 0x5C85, 0x5D8A, 0x5EA9, 0x5FDC, 0x6131, 
-    0x6227, 0x6399, 0x64BD, 0x65C9, 0x66E3, 0x682E, 0x6946, 0x6A41, 0x6B14, 0x6C37, 0x6DA5, 0x6EC9, 0x6FCC, 0x70BE, 0x71BD, 0x72BC, 
-    0xFFE1, 0x3225, 0xFF4A, 0x308A, 0x30EA, 0xFE43, 0x0448, 0x0000, 0x2546, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x74E3, 
-    0x6807, 0x78B4, 0x916C, 0x6413, 0x5E97, 0x86FE, 0x9022, 0x6208, 0x9F9F, 0x5B8F, 0x9B42, 0x7F04, 0x75A5, 0x5A1F, 0x7B77, 0x72F8, 
-    0x9675, 0x739B, 0x85D0, 0x5E74, 0x62A8, 0x8110, 0x9877, 0x6C5D, 0x7533, 0x8D4E, 0x5C81, 0x5243, 0x5B8C, 0x4FAE, 0x8BE6, 0x5618, 
-    0x6B83, 0x8C0A, 0x96E8, 0x8E81, 0x8D1E, 0x682A, 0x94BB, 0x4EC3, 0x8A07, 0x9649, 0x5773, 0x835C, 0x84D0, 0x63F8, 0x54E7, 0x5693, 
-    0x5F61, 0x6005, 0x6C74, 0x6F62, 0x5C3B, 0x9A8A, 0x73C0, 0x6855, 0x6B9B, 0x89CB, 0x8159, 0x793B, 0x9EFB, 0x94CC, 0x956A, 0x75CD, 
-    0x801C, 0x873F, 0x7BA8, 0x7D77, 0x8E76, 0x9CAB, 0x9E9D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F82, 0x50A0, 0x51B8, 0x52F2, 0x547A, 0x55E0, 0x56EF, 0x5827, 0x5912, 0x5A4B, 0x5B30, 0x5C86, 0x5D8B, 0x5EAA, 0x5FDE, 0x6132, 
-    0x6228, 0x639A, 0x64BE, 0x65CA, 0x66E4, 0x682F, 0x6947, 0x6A42, 0x6B15, 0x6C39, 0x6DAC, 0x6ECA, 0x6FCD, 0x70BF, 0x71BE, 0x72BD, 
-    0x2030, 0x3226, 0xFF4B, 0x308B, 0x30EB, 0xFE44, 0x0449, 0x0000, 0x2547, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x534A, 
-    0x5F6A, 0x643D, 0x7574, 0x63AA, 0x60E6, 0x5CE8, 0x51AF, 0x9E3D, 0x95FA, 0x5F18, 0x6D51, 0x8327, 0x8BEB, 0x5026, 0x4FA9, 0x79BB, 
-    0x5CAD, 0x7801, 0x79D2, 0x78BE, 0x70F9, 0x9F50, 0x8BF7, 0x5165, 0x547B, 0x5B70, 0x7A57, 0x5C49, 0x7897, 0x575E, 0x60F3, 0x987B, 
-    0x592E, 0x8BD1, 0x4E0E, 0x566A, 0x9488, 0x86DB, 0x7E82, 0x4EC9, 0x5310, 0x9654, 0x57AD, 0x8308, 0x84E6, 0x63E0, 0x5520, 0x56AF, 
-    0x72AD, 0x6006, 0x6C76, 0x6F46, 0x54AB, 0x9A90, 0x73C9, 0x6866, 0x6BA1, 0x89CC, 0x815A, 0x7940, 0x9EFC, 0x94CD, 0x956B, 0x75E3, 
-    0x8020, 0x8782, 0x7B85, 0x7DA6, 0x8E7C, 0x9CAD, 0x9E9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F85, 0x50A1, 0x51B9, 0x52F3, 0x547E, 0x55E2, 0x56F2, 0x5828, 0x5913, 0x5A4C, 0x5B31, 0x5C87, 0x5D8C, 0x5EAB, 0x5FDF, 0x6133, 
-    0x6229, 0x639B, 0x64BF, 0x65CD, 0x66E5, 0x6830, 0x6948, 0x6A43, 0x6B16, 0x6C3A, 0x6DAD, 0x6ECC, 0x6FCE, 0x70C4, 0x71BF, 0x72BE, 
-    0x00A7, 0x3227, 0xFF4C, 0x308C, 0x30EC, 0x0000, 0x044A, 0x0000, 0x2548, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x529E, 
-    0x8198, 0x5BDF, 0x8E0C, 0x632B, 0x5960, 0x9E45, 0x7F1D, 0x80F3, 0x8F68, 0x7EA2, 0x6DF7, 0x68C0, 0x5C4A, 0x7737, 0x5FEB, 0x6F13, 
-    0x9886, 0x8682, 0x6E3A, 0x64B5, 0x6F8E, 0x65D7, 0x5E86, 0x8925, 0x4F38, 0x719F, 0x9042, 0x5929, 0x633D, 0x620A, 0x54CD, 0x5F90, 
-    0x9E2F, 0x5F02, 0x5C7F, 0x9020, 0x4FA6, 0x6731, 0x5634, 0x4EC2, 0x51EB, 0x965F, 0x57A4, 0x8392, 0x84BD, 0x63FF, 0x54FD, 0x56D4, 
-    0x72B0, 0x5FEA, 0x6C86, 0x6F47, 0x5C50, 0x9A92, 0x73C8, 0x6841, 0x6BAA, 0x89CE, 0x8171, 0x7946, 0x76F1, 0x94CE, 0x956C, 0x75E8, 
-    0x8022, 0x8722, 0x7BAA, 0x7DAE, 0x8E6F, 0x9CAE, 0x9EDB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F86, 0x50A2, 0x51BA, 0x52F4, 0x547F, 0x55E7, 0x56F3, 0x5829, 0x5917, 0x5A4D, 0x5B33, 0x5C89, 0x5D8D, 0x5EAC, 0x5FE2, 0x6134, 
-    0x622B, 0x639C, 0x64C1, 0x65D0, 0x66E7, 0x6831, 0x6949, 0x6A45, 0x6B17, 0x6C3B, 0x6DB0, 0x6ECD, 0x6FCF, 0x70C5, 0x71C0, 0x72BF, 
-    0x2116, 0x3228, 0xFF4D, 0x308D, 0x30ED, 0x0000, 0x044B, 0x0000, 0x2549, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7ECA, 
-    0x8868, 0x5C94, 0x7A20, 0x9519, 0x6DC0, 0x4FC4, 0x8BBD, 0x7599, 0x9B3C, 0x5589, 0x8C41, 0x67EC, 0x5DFE, 0x5377, 0x5BBD, 0x7406, 
-    0x53E6, 0x9A6C, 0x5E99, 0x637B, 0x5F6D, 0x7948, 0x743C, 0x8F6F, 0x8EAB, 0x85AF, 0x96A7, 0x6DFB, 0x665A, 0x96FE, 0x4EAB, 0x8BB8, 
-    0x79E7, 0x7FFC, 0x79B9, 0x7682, 0x6795, 0x732A, 0x9189, 0x4EE8, 0x5919, 0x9667, 0x578C, 0x833C, 0x84D3, 0x63C4, 0x5514, 0x56D7, 
-    0x72B4, 0x5FED, 0x6CA9, 0x6F24, 0x5C59, 0x9A93, 0x73E5, 0x6867, 0x8F6B, 0x89CF, 0x8160, 0x7949, 0x7704, 0x94D0, 0x956F, 0x75E6, 
-    0x8025, 0x877D, 0x7B9C, 0x7E47, 0x8E74, 0x9CB0, 0x9EDC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F87, 0x50A4, 0x51BE, 0x52F5, 0x5481, 0x55E9, 0x56F6, 0x582B, 0x5918, 0x5A4E, 0x5B35, 0x5C8A, 0x5D8E, 0x5EAE, 0x5FE3, 0x6135, 
-    0x622D, 0x639D, 0x64C3, 0x65D1, 0x66E8, 0x6834, 0x694A, 0x6A46, 0x6B18, 0x6C3C, 0x6DB1, 0x6ECE, 0x6FD0, 0x70C6, 0x71C1, 0x72C0, 
-    0x2606, 0x3229, 0xFF4E, 0x308E, 0x30EE, 0xFE3B, 0x044C, 0x0000, 0x254A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x90A6, 
-    0x9CD6, 0x5DEE, 0x6101, 0x642D, 0x6BBF, 0x989D, 0x5949, 0x5272, 0x8BE1, 0x4FAF, 0x6D3B, 0x78B1, 0x7B4B, 0x7EE2, 0x6B3E, 0x674E, 
-    0x4EE4, 0x9A82, 0x5999, 0x5FF5, 0x84EC, 0x7941, 0x7A77, 0x962E, 0x6DF1, 0x6691, 0x795F, 0x586B, 0x7696, 0x6664, 0x9879, 0x84C4, 
-    0x6768, 0x7FCC, 0x5B87, 0x7076, 0x75B9, 0x8BF8, 0x6700, 0x4EE1, 0x5155, 0x966C, 0x57B2, 0x8334, 0x84CA, 0x63DE, 0x54F3, 0x56DD, 
-    0x72B7, 0x5FF8, 0x6CD0, 0x6F15, 0x5B71, 0x9A96, 0x73D9, 0x6840, 0x8F6D, 0x89D0, 0x8169, 0x795B, 0x770D, 0x94D1, 0x9571, 0x75E4, 
-    0x8026, 0x877E, 0x7BA2, 0x7E9B, 0x8E85, 0x9CB1, 0x9EDD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F8A, 0x50A6, 0x51BF, 0x52F6, 0x5483, 0x55ED, 0x56F7, 0x582C, 0x591B, 0x5A4F, 0x5B36, 0x5C8B, 0x5D8F, 0x5EAF, 0x5FE5, 0x6136, 
-    0x622F, 0x639E, 0x64C4, 0x65D3, 0x66EA, 0x6835, 0x694B, 0x6A48, 0x6B19, 0x6C3E, 0x6DB3, 0x6ED0, 0x6FD3, 0x70C7, 0x71C2, 0x72C5, 
-    0x2605, 0x0000, 0xFF4F, 0x308F, 0x30EF, 0xFE3C, 0x044D, 0x0000, 0x254B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5E2E, 
-    0x618B, 0x8BE7, 0x7B79, 0x8FBE, 0x7889, 0x8BB9, 0x51E4, 0x9769, 0x7678, 0x7334, 0x4F19, 0x7877, 0x65A4, 0x6485, 0x5321, 0x91CC, 
-    0x6E9C, 0x561B, 0x8511, 0x5A18, 0x68DA, 0x9A91, 0x79CB, 0x854A, 0x5A20, 0x66D9, 0x5B59, 0x7530, 0x60CB, 0x7269, 0x5DF7, 0x9157, 
-    0x626C, 0x7ECE, 0x8BED, 0x71E5, 0x8BCA, 0x8BDB, 0x7F6A, 0x4EEB, 0x4EA0, 0x9672, 0x57CF, 0x8331, 0x84BF, 0x63CE, 0x5522, 0x56E1, 
-    0x72B8, 0x6019, 0x6CD4, 0x6EF9, 0x5C63, 0x9A98, 0x987C, 0x683E, 0x8F71, 0x89D1, 0x817C, 0x795C, 0x76F9, 0x94D2, 0x9572, 0x75EB, 
-    0x8027, 0x877B, 0x7BAB, 0x9EB8, 0x8E8F, 0x9CB2, 0x9EE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F8C, 0x50AA, 0x51C1, 0x52F7, 0x5485, 0x55EE, 0x56F8, 0x582D, 0x591D, 0x5A50, 0x5B38, 0x5C8E, 0x5D90, 0x5EB0, 0x5FE6, 0x6137, 
-    0x6230, 0x639F, 0x64C6, 0x65D4, 0x66EB, 0x6836, 0x694C, 0x6A49, 0x6B1A, 0x6C3F, 0x6DB4, 0x6ED2, 0x6FD4, 0x70C9, 0x71C4, 0x72C6, 
-    0x25CB, 0x0000, 0xFF50, 0x3090, 0x30F0, 0xFE37, 0x044E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6886, 
-    0x522B, 0x62C6, 0x4EC7, 0x7B54, 0x53FC, 0x5A25, 0x4F5B, 0x845B, 0x6842, 0x543C, 0x706B, 0x62E3, 0x91D1, 0x652B, 0x7B50, 0x9CA4, 
-    0x7409, 0x5417, 0x706D, 0x917F, 0x787C, 0x8D77, 0x4E18, 0x745E, 0x7EC5, 0x7F72, 0x635F, 0x751C, 0x5B9B, 0x52FF, 0x6A61, 0x53D9, 
-    0x4F6F, 0x8335, 0x7FBD, 0x8D23, 0x9707, 0x9010, 0x5C0A, 0x4EDE, 0x5156, 0x9674, 0x57A7, 0x839B, 0x84BA, 0x6452, 0x5523, 0x56F5, 
-    0x72C3, 0x6035, 0x6CAD, 0x6F2F, 0x5C66, 0x9A9B, 0x740A, 0x684A, 0x8F72, 0x726E, 0x817D, 0x7953, 0x7707, 0x94D5, 0x9573, 0x75E7, 
-    0x8029, 0x8760, 0x7BB4, 0x9EB4, 0x8E94, 0x9CB3, 0x9EDF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F8E, 0x50AB, 0x51C2, 0x52F8, 0x5487, 0x55F0, 0x56FB, 0x582E, 0x591E, 0x5A51, 0x5B39, 0x5C8F, 0x5D91, 0x5EB1, 0x5FE8, 0x6138, 
-    0x6231, 0x63A1, 0x64C7, 0x65D5, 0x66EC, 0x683A, 0x694D, 0x6A4A, 0x6B1B, 0x6C43, 0x6DB6, 0x6ED6, 0x6FD5, 0x70CB, 0x71C5, 0x72C7, 
-    0x25CF, 0x2160, 0xFF51, 0x3091, 0x30F1, 0xFE38, 0x044F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x699C, 
-    0x762A, 0x67F4, 0x7EF8, 0x7629, 0x96D5, 0x6076, 0x5426, 0x683C, 0x67DC, 0x539A, 0x83B7, 0x6361, 0x4ECA, 0x6289, 0x72C2, 0x793C, 
-    0x69B4, 0x57CB, 0x6C11, 0x9E1F, 0x7BF7, 0x5C82, 0x90B1, 0x9510, 0x795E, 0x8700, 0x7B0B, 0x606C, 0x5A49, 0x52A1, 0x50CF, 0x65ED, 
-    0x75A1, 0x836B, 0x7389, 0x62E9, 0x632F, 0x7AF9, 0x9075, 0x4F1B, 0x4EB3, 0x9688, 0x57B4, 0x835E, 0x84E0, 0x63C6, 0x550F, 0x56EB, 
-    0x72C1, 0x6026, 0x6CF7, 0x6F36, 0x7FBC, 0x9A9C, 0x73E9, 0x6849, 0x8F73, 0x729F, 0x816D, 0x795A, 0x7708, 0x94D6, 0x953A, 0x7603, 
-    0x8028, 0x8770, 0x7BD1, 0x8D73, 0x8E90, 0x9CB4, 0x9EE2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F90, 0x50AD, 0x51C3, 0x52FB, 0x5488, 0x55F1, 0x56FC, 0x582F, 0x5920, 0x5A52, 0x5B3A, 0x5C92, 0x5D92, 0x5EB2, 0x5FE9, 0x6139, 
-    0x6232, 0x63A4, 0x64C8, 0x65D8, 0x66ED, 0x683B, 0x694E, 0x6A4B, 0x6B1C, 0x6C44, 0x6DB7, 0x6ED8, 0x6FD6, 0x70CC, 0x71C6, 0x72C9, 
-    0x25CE, 0x2161, 0xFF52, 0x3092, 0x30F2, 0xFE31, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8180, 
-    0x5F6C, 0x8C7A, 0x7785, 0x6253, 0x51CB, 0x5384, 0x592B, 0x86E4, 0x8DEA, 0x5019, 0x6216, 0x7B80, 0x6D25, 0x6398, 0x6846, 0x8389, 
-    0x786B, 0x4E70, 0x62BF, 0x5C3F, 0x81A8, 0x4E5E, 0x7403, 0x95F0, 0x6C88, 0x9ECD, 0x84D1, 0x8214, 0x4E07, 0x609F, 0x5411, 0x5E8F, 
-    0x7F8A, 0x56E0, 0x57DF, 0x5219, 0x9547, 0x70DB, 0x6628, 0x4EF3, 0x886E, 0x968D, 0x5793, 0x832F, 0x84A1, 0x63BE, 0x5511, 0x56F9, 
-    0x72CE, 0x601B, 0x6CF8, 0x6F4B, 0x5F2A, 0x9A9D, 0x73E7, 0x6829, 0x8F75, 0x725D, 0x8167, 0x7962, 0x771A, 0x94D7, 0x77E7, 0x75F1, 
-    0x8031, 0x874C, 0x7BC1, 0x8D84, 0x8E9C, 0x9CB5, 0x9EE9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F92, 0x50AE, 0x51C5, 0x52FC, 0x5489, 0x55F4, 0x5700, 0x5831, 0x5921, 0x5A53, 0x5B3B, 0x5C93, 0x5D93, 0x5EB4, 0x5FEC, 0x613A, 
-    0x6235, 0x63A6, 0x64C9, 0x65D9, 0x66EE, 0x683F, 0x694F, 0x6A4C, 0x6B1D, 0x6C45, 0x6DB9, 0x6ED9, 0x6FD7, 0x70CD, 0x71C7, 0x72CA, 
-    0x25C7, 0x2162, 0xFF53, 0x3093, 0x30F3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7ED1, 
-    0x658C, 0x6400, 0x4E11, 0x5927, 0x5201, 0x627C, 0x6577, 0x9601, 0x8D35, 0x540E, 0x60D1, 0x4FED, 0x895F, 0x5014, 0x77FF, 0x8354, 
-    0x998F, 0x9EA6, 0x76BF, 0x634F, 0x670B, 0x4F01, 0x6C42, 0x6DA6, 0x5BA1, 0x9F20, 0x68AD, 0x8146, 0x8155, 0x8BEF, 0x8C61, 0x755C, 
-    0x6D0B, 0x6BB7, 0x828B, 0x6CFD, 0x9635, 0x716E, 0x5DE6, 0x4F22, 0x88A4, 0x9697, 0x57A0, 0x834F, 0x84B9, 0x6445, 0x5527, 0x56FF, 
-    0x72CD, 0x600F, 0x6CF1, 0x6F74, 0x5F29, 0x9A9F, 0x73DE, 0x68B5, 0x8F76, 0x7266, 0x584D, 0x7957, 0x7722, 0x94D9, 0x77EC, 0x75FC, 
-    0x800B, 0x876E, 0x7BCC, 0x8D94, 0x8E9E, 0x9CB6, 0x9EE7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F93, 0x50AF, 0x51C8, 0x52FD, 0x548A, 0x55F6, 0x5701, 0x5832, 0x5922, 0x5A54, 0x5B3C, 0x5C95, 0x5D94, 0x5EBA, 0x5FEF, 0x613B, 
-    0x6236, 0x63AB, 0x64CA, 0x65DA, 0x66EF, 0x6847, 0x6950, 0x6A4D, 0x6B1E, 0x6C48, 0x6DBA, 0x6EDB, 0x6FD8, 0x70CE, 0x71C8, 0x72CB, 
-    0x25C6, 0x2163, 0xFF54, 0x0000, 0x30F4, 0xFE33, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x68D2, 
-    0x6FD2, 0x63BA, 0x81ED, 0x5446, 0x6389, 0x904F, 0x80A4, 0x9694, 0x523D, 0x547C, 0x970D, 0x526A, 0x7D27, 0x7235, 0x7736, 0x540F, 
-    0x7559, 0x5356, 0x654F, 0x8042, 0x9E4F, 0x542F, 0x56DA, 0x82E5, 0x5A76, 0x5C5E, 0x5506, 0x6311, 0x6C6A, 0x6614, 0x8427, 0x6064, 
-    0x9633, 0x97F3, 0x90C1, 0x8D3C, 0x84B8, 0x62C4, 0x4F50, 0x4F64, 0x4EB5, 0x96B0, 0x57D5, 0x8347, 0x84B4, 0x6441, 0x552A, 0x5704, 
-    0x72D2, 0x600D, 0x6CD7, 0x6F2A, 0x5F2D, 0x9AA0, 0x73BA, 0x688F, 0x8F78, 0x726F, 0x5AB5, 0x7960, 0x7719, 0x94D8, 0x96C9, 0x75FF, 
-    0x8035, 0x878B, 0x7BDD, 0x8D91, 0x8C78, 0x9CB7, 0x9EE5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F95, 0x50B0, 0x51CA, 0x5301, 0x548D, 0x55F8, 0x5702, 0x5833, 0x5923, 0x5A56, 0x5B3D, 0x5C9D, 0x5D95, 0x5EBB, 0x5FF0, 0x613C, 
-    0x6238, 0x63AF, 0x64CB, 0x65DB, 0x66F1, 0x684B, 0x6951, 0x6A4E, 0x6B1F, 0x6C4B, 0x6DBB, 0x6EDC, 0x6FD9, 0x70CF, 0x71C9, 0x72CC, 
-    0x25A1, 0x2164, 0xFF55, 0x0000, 0x30F5, 0xFE34, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x78C5, 
-    0x6EE8, 0x8749, 0x521D, 0x6B79, 0x540A, 0x9102, 0x5B75, 0x94EC, 0x8F8A, 0x4E4E, 0x8D27, 0x51CF, 0x9526, 0x89C9, 0x65F7, 0x6817, 
-    0x5218, 0x8FC8, 0x60AF, 0x5B7D, 0x6367, 0x5951, 0x914B, 0x5F31, 0x751A, 0x672F, 0x7F29, 0x6761, 0x738B, 0x7199, 0x785D, 0x7D6E, 
-    0x6C27, 0x9634, 0x5401, 0x600E, 0x6323, 0x77A9, 0x67DE, 0x4EF5, 0x8114, 0x9097, 0x57D8, 0x8343, 0x8497, 0x640B, 0x5567, 0x570A, 
-    0x72E8, 0x6029, 0x6CB2, 0x6F09, 0x8274, 0x9AA2, 0x73F2, 0x6874, 0x8F77, 0x727E, 0x8188, 0x796F, 0x772D, 0x94DB, 0x79D5, 0x7610, 
-    0x8043, 0x8753, 0x7BDA, 0x8DB1, 0x8C82, 0x9CBA, 0x9EEA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F96, 0x50B1, 0x51CD, 0x5302, 0x5491, 0x55F9, 0x5705, 0x5834, 0x5926, 0x5A57, 0x5B3E, 0x5C9E, 0x5D96, 0x5EBC, 0x5FF2, 0x613D, 
-    0x6239, 0x63B1, 0x64CC, 0x65DC, 0x66F5, 0x684D, 0x6952, 0x6A4F, 0x6B25, 0x6C4C, 0x6DBC, 0x6EDD, 0x6FDA, 0x70D0, 0x71CA, 0x72CF, 
-    0x25A0, 0x2165, 0xFF56, 0x0000, 0x30F6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x868C, 
-    0x5BBE, 0x998B, 0x51FA, 0x50A3, 0x9493, 0x997F, 0x6276, 0x4E2A, 0x6EDA, 0x5FFD, 0x7978, 0x8350, 0x4EC5, 0x51B3, 0x51B5, 0x4E3D, 
-    0x7624, 0x8109, 0x95FD, 0x556E, 0x78B0, 0x780C, 0x6CC5, 0x6492, 0x80BE, 0x8FF0, 0x7410, 0x8FE2, 0x4EA1, 0x6790, 0x9704, 0x5A7F, 
-    0x4EF0, 0x59FB, 0x9047, 0x589E, 0x7741, 0x5631, 0x505A, 0x4F25, 0x88D2, 0x909B, 0x57DA, 0x835F, 0x84E5, 0x641B, 0x558F, 0x5709, 
-    0x72EF, 0x602B, 0x6CE0, 0x6F29, 0x5F3C, 0x9AA3, 0x740F, 0x6877, 0x8F79, 0x727F, 0x8182, 0x7967, 0x7726, 0x94DE, 0x79ED, 0x7600, 
-    0x8046, 0x8763, 0x7BE5, 0x8D67, 0x8C8A, 0x9CBB, 0x9EEF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F98, 0x50B3, 0x51CE, 0x5303, 0x5493, 0x55FA, 0x5707, 0x5836, 0x5928, 0x5A58, 0x5B3F, 0x5C9F, 0x5D97, 0x5EBD, 0x5FF3, 0x613E, 
-    0x623A, 0x63B2, 0x64CF, 0x65DD, 0x66F6, 0x684F, 0x6953, 0x6A51, 0x6B26, 0x6C4D, 0x6DBD, 0x6EE3, 0x6FDB, 0x70D1, 0x71CB, 0x72D1, 
-    0x25B3, 0x2166, 0xFF57, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x9551, 
-    0x6448, 0x8C17, 0x6A71, 0x6234, 0x8C03, 0x6069, 0x62C2, 0x5404, 0x68CD, 0x745A, 0x51FB, 0x69DB, 0x8C28, 0x8BC0, 0x4E8F, 0x5389, 
-    0x6D41, 0x7792, 0x660E, 0x954A, 0x576F, 0x5668, 0x8D8B, 0x6D12, 0x614E, 0x6811, 0x7D22, 0x773A, 0x6789, 0x897F, 0x524A, 0x7EEA, 
-    0x75D2, 0x541F, 0x55BB, 0x618E, 0x5F81, 0x4E3B, 0x4F5C, 0x4F27, 0x7980, 0x909D, 0x57D9, 0x8340, 0x84E3, 0x6420, 0x55B5, 0x571C, 
-    0x72E9, 0x600A, 0x6CD6, 0x6F89, 0x9B3B, 0x9AA5, 0x742A, 0x6893, 0x8F7A, 0x7284, 0x8191, 0x797A, 0x7735, 0x94DF, 0x79E3, 0x7605, 
-    0x804D, 0x877C, 0x7BE6, 0x8D6D, 0x8C85, 0x9CBC, 0x9F22, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F99, 0x50B4, 0x51D0, 0x5304, 0x5497, 0x55FB, 0x570B, 0x5837, 0x592C, 0x5A59, 0x5B41, 0x5CA0, 0x5D98, 0x5EBF, 0x5FF4, 0x6140, 
-    0x623B, 0x63B5, 0x64D1, 0x65DE, 0x66F8, 0x6852, 0x6955, 0x6A52, 0x6B28, 0x6C4E, 0x6DBE, 0x6EE7, 0x6FDC, 0x70D2, 0x71CC, 0x72D3, 
-    0x25B2, 0x2167, 0xFF58, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x508D, 
-    0x5175, 0x7F20, 0x53A8, 0x5E26, 0x8DCC, 0x800C, 0x8F90, 0x7ED9, 0x9505, 0x58F6, 0x573E, 0x9274, 0x8FDB, 0x7EDD, 0x76D4, 0x52B1, 
-    0x67F3, 0x9992, 0x879F, 0x954D, 0x7812, 0x6C14, 0x533A, 0x8428, 0x6E17, 0x675F, 0x9501, 0x8DF3, 0x7F51, 0x7852, 0x54EE, 0x7EED, 
-    0x517B, 0x94F6, 0x5CEA, 0x66FE, 0x72F0, 0x8457, 0x5750, 0x4F09, 0x5B34, 0x9099, 0x57D2, 0x8317, 0x850C, 0x640C, 0x5549, 0x5E0F, 
-    0x72F2, 0x603F, 0x6CFA, 0x6F8D, 0x5C6E, 0x9AA7, 0x745B, 0x686B, 0x8F7C, 0x728B, 0x6ED5, 0x7985, 0x7738, 0x94E0, 0x79EB, 0x760C, 
-    0x8052, 0x8764, 0x7BEA, 0x8C47, 0x8C98, 0x9CBD, 0x9F2C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F9A, 0x50B5, 0x51D2, 0x5307, 0x5498, 0x55FC, 0x570C, 0x5838, 0x5930, 0x5A5B, 0x5B42, 0x5CA1, 0x5D9A, 0x5EC0, 0x5FF6, 0x6141, 
-    0x623C, 0x63B6, 0x64D3, 0x65DF, 0x66FA, 0x6856, 0x6956, 0x6A53, 0x6B29, 0x6C4F, 0x6DC1, 0x6EEA, 0x6FDD, 0x70D3, 0x71CD, 0x72D4, 
-    0x203B, 0x2168, 0xFF59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8C24, 
-    0x51B0, 0x94F2, 0x8E87, 0x6B86, 0x7239, 0x513F, 0x5E45, 0x6839, 0x90ED, 0x846B, 0x57FA, 0x8DF5, 0x9773, 0x5747, 0x5CBF, 0x783E, 
-    0x516D, 0x86EE, 0x9E23, 0x6D85, 0x9739, 0x8FC4, 0x86C6, 0x816E, 0x58F0, 0x620D, 0x6240, 0x8D34, 0x5F80, 0x77FD, 0x56A3, 0x8F69, 
-    0x6837, 0x6DEB, 0x5FA1, 0x8D60, 0x4E89, 0x67F1, 0x5EA7, 0x4F2B, 0x8803, 0x90AC, 0x57B8, 0x8360, 0x750D, 0x6426, 0x556D, 0x5E19, 
-    0x72F4, 0x6021, 0x6CEB, 0x6F8C, 0x5981, 0x7E9F, 0x7426, 0x68C2, 0x8F7E, 0x728D, 0x81A3, 0x798A, 0x7750, 0x94E2, 0x7A06, 0x7617, 
-    0x8069, 0x8759, 0x7C0C, 0x8C49, 0x8C94, 0x9CC4, 0x9F2F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F9C, 0x50B6, 0x51D3, 0x5309, 0x549C, 0x55FF, 0x570D, 0x5839, 0x5932, 0x5A5C, 0x5B43, 0x5CA4, 0x5D9B, 0x5EC1, 0x5FF7, 0x6142, 
-    0x6242, 0x63B9, 0x64D4, 0x65E1, 0x66FB, 0x6857, 0x6958, 0x6A54, 0x6B2A, 0x6C51, 0x6DC2, 0x6EEB, 0x6FDF, 0x70D4, 0x71CF, 0x72D5, 
-    0x2192, 0x2169, 0xFF5A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x82DE, 
-    0x67C4, 0x4EA7, 0x9504, 0x4EE3, 0x789F, 0x8033, 0x6C1F, 0x8DDF, 0x56FD, 0x80E1, 0x673A, 0x8D31, 0x664B, 0x83CC, 0x7AA5, 0x5386, 
-    0x9F99, 0x6EE1, 0x94ED, 0x60A8, 0x6279, 0x5F03, 0x66F2, 0x9CC3, 0x751F, 0x7AD6, 0x584C, 0x94C1, 0x65FA, 0x6670, 0x9500, 0x55A7, 
-    0x6F3E, 0x5BC5, 0x6108, 0x624E, 0x6014, 0x52A9, 0x0000, 0x4F5E, 0x7FB8, 0x90A1, 0x57F4, 0x832D, 0x8538, 0x6421, 0x5541, 0x5E14, 
-    0x72F7, 0x6078, 0x6CEE, 0x6F78, 0x5983, 0x7EA1, 0x7425, 0x696E, 0x8F81, 0x728F, 0x81AA, 0x799A, 0x7751, 0x94E4, 0x5D47, 0x760A, 
-    0x8071, 0x8765, 0x7BFE, 0x914A, 0x659B, 0x9CC5, 0x9F39, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F9E, 0x50B7, 0x51D4, 0x530A, 0x549E, 0x5602, 0x570E, 0x583A, 0x5933, 0x5A5D, 0x5B44, 0x5CA5, 0x5D9C, 0x5EC2, 0x5FF9, 0x6143, 
-    0x6244, 0x63BB, 0x64D5, 0x65E3, 0x66FD, 0x6858, 0x6959, 0x6A55, 0x6B2B, 0x6C52, 0x6DC3, 0x6EEC, 0x6FE2, 0x70D5, 0x71D0, 0x72D6, 
-    0x2190, 0x216A, 0xFF5B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x80DE, 
-    0x4E19, 0x9610, 0x96CF, 0x8D37, 0x8776, 0x5C14, 0x7B26, 0x8015, 0x679C, 0x8774, 0x7578, 0x89C1, 0x7981, 0x94A7, 0x8475, 0x5229, 
-    0x804B, 0x8513, 0x540D, 0x67E0, 0x62AB, 0x6C7D, 0x8EAF, 0x585E, 0x7525, 0x5885, 0x4ED6, 0x5E16, 0x671B, 0x563B, 0x6D88, 0x5BA3, 
-    0x9080, 0x996E, 0x6B32, 0x55B3, 0x6574, 0x86C0, 0x0000, 0x4F67, 0x51AB, 0x90B4, 0x57EF, 0x833A, 0x84F0, 0x645E, 0x5555, 0x5E11, 
-    0x7301, 0x6079, 0x6CB1, 0x6F72, 0x598D, 0x7EA3, 0x7428, 0x68FC, 0x8F82, 0x7292, 0x81CC, 0x79A7, 0x7747, 0x94E5, 0x7A03, 0x7625, 
-    0x8983, 0x8793, 0x7BFC, 0x9150, 0x89D6, 0x9CC6, 0x9F37, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4F9F, 0x50B8, 0x51D5, 0x530B, 0x549F, 0x5603, 0x570F, 0x583B, 0x5935, 0x5A5E, 0x5B45, 0x5CA6, 0x5D9E, 0x5EC3, 0x5FFA, 0x6144, 
-    0x6245, 0x63BD, 0x64D6, 0x65E4, 0x6701, 0x6859, 0x695B, 0x6A56, 0x6B2C, 0x6C53, 0x6DC8, 0x6EED, 0x6FE3, 0x70D6, 0x71D1, 0x72D8, 
-    0x2191, 0x216B, 0xFF5C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5305, 
-    0x79C9, 0x98A4, 0x6EC1, 0x888B, 0x8FED, 0x9975, 0x4F0F, 0x66F4, 0x88F9, 0x72D0, 0x7A3D, 0x952E, 0x8FD1, 0x519B, 0x594E, 0x5088, 
-    0x5499, 0x66FC, 0x547D, 0x72DE, 0x5288, 0x6CE3, 0x5C48, 0x8D5B, 0x7272, 0x5EB6, 0x5B83, 0x5385, 0x5FD8, 0x5438, 0x5BB5, 0x60AC, 
-    0x8170, 0x5C39, 0x72F1, 0x6E23, 0x62EF, 0x8D2E, 0x0000, 0x6538, 0x51B1, 0x90B3, 0x57F8, 0x8333, 0x8539, 0x6484, 0x553F, 0x5E31, 
-    0x72F3, 0x607B, 0x6CD3, 0x6F7C, 0x59A9, 0x7EA5, 0x7430, 0x691F, 0x8F84, 0x6308, 0x6726, 0x79B3, 0x7743, 0x94E7, 0x7A02, 0x7618, 
-    0x9878, 0x87AF, 0x7C0F, 0x914E, 0x89DE, 0x9CC7, 0x9F3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4FA1, 0x50B9, 0x51D6, 0x530C, 0x54A0, 0x5604, 0x5710, 0x583C, 0x5936, 0x5A5F, 0x5B46, 0x5CA7, 0x5D9F, 0x5EC4, 0x5FFC, 0x6145, 
-    0x6246, 0x63BF, 0x64D9, 0x65EA, 0x6702, 0x685A, 0x695C, 0x6A57, 0x6B2D, 0x6C56, 0x6DC9, 0x6EEE, 0x6FE4, 0x70D7, 0x71D2, 0x72DA, 
-    0x2193, 0x0000, 0xFF5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8912, 
-    0x997C, 0x660C, 0x9664, 0x5F85, 0x8C0D, 0x6D31, 0x4FD8, 0x5E9A, 0x8FC7, 0x7CCA, 0x79EF, 0x7BAD, 0x70EC, 0x541B, 0x9B41, 0x4F8B, 
-    0x7B3C, 0x6162, 0x8C2C, 0x51DD, 0x7435, 0x8BAB, 0x9A71, 0x4E09, 0x5347, 0x6570, 0x5979, 0x542C, 0x5984, 0x9521, 0x6DC6, 0x65CB, 
-    0x5996, 0x5F15, 0x80B2, 0x672D, 0x6B63, 0x94F8, 0x0000, 0x4F5A, 0x51BD, 0x90B6, 0x57E4, 0x8366, 0x851F, 0x646D, 0x5550, 0x5E3B, 
-    0x7303, 0x607A, 0x6CEF, 0x6F7A, 0x59AA, 0x7EA8, 0x742E, 0x6920, 0x8F87, 0x6332, 0x81CA, 0x5FD1, 0x775A, 0x94E8, 0x7A1E, 0x7615, 
-    0x9880, 0x87A8, 0x7C16, 0x914F, 0x89DA, 0x9CCA, 0x9F3E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x4FA2, 0x50BC, 0x51D7, 0x530E, 0x54A1, 0x5605, 0x5711, 0x583D, 0x593B, 0x5A60, 0x5B47, 0x5CA8, 0x5DA0, 0x5EC5, 0x6007, 0x6146, 
-    0x624A, 0x63C0, 0x64DA, 0x65EB, 0x6703, 0x685B, 0x695F, 0x6A5A, 0x6B2E, 0x6C58, 0x6DCA, 0x6EEF, 0x6FE5, 0x70DA, 0x71D3, 0x72DB, 
-    0x3013, 0x0000, 0xFFE3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5265, 
-    0x70B3, 0x7316, 0x695A, 0x902E, 0x53E0, 0x4E8C, 0x670D, 0x7FB9, 0x54C8, 0x6E56, 0x7B95, 0x4EF6, 0x6D78, 0x5CFB, 0x5080, 0x4FD0, 
-    0x7ABF, 0x6F2B, 0x6478, 0x5B81, 0x6BD7, 0x6390, 0x6E20, 0x53C1, 0x7EF3, 0x6F31, 0x5854, 0x70C3, 0x5A01, 0x727A, 0x6653, 0x7384, 
-    0x7476, 0x9690, 0x8A89, 0x8F67, 0x653F, 0x7B51, 0x0000, 0x4F5D, 0x51BC, 0x90BA, 0x57DD, 0x8365, 0x853A, 0x6496, 0x553C, 0x5E3C, 
-    0x72FA, 0x6042, 0x6CFE, 0x6FD1, 0x59A3, 0x7EA9, 0x742C, 0x68F9, 0x8F8B, 0x63B0, 0x81BB, 0x5FD0, 0x7768, 0x94EA, 0x7A14, 0x7619, 
-    0x9883, 0x87D2, 0x7C0B, 0x9164, 0x89DC, 0x9CCB, 0x9F44, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
+// GBK2UNI_NO_SIMD (make PORTABLE=1) keeps only the portable word-at-a-time paths.
+#if defined(__SSE2__) && !defined(GBK2UNI_NO_SIMD)
+#include <emmintrin.h>
+#define GBK2UNI_SSE2 1
+#endif
 
-#define GBK2UNI_TABLE_START 0x4081
+// AVX2 paths are compiled with target attributes and picked at runtime.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(GBK2UNI_NO_SIMD)
+#include <immintrin.h>
+#define GBK2UNI_AVX2 1
+#endif
+
+// Tables are generated at build time by libiconv/gen_gbk2uni_tab, see Makefile.
+#if defined(GBK2UNI_COMPACT)
+#warning "Use compact gbk2uni table!"
+#include <pthread.h>
+#include "gbk2uni_runs.h"
+#elif defined(GBK2UNI_ICONV)
+#warning "Use iconv gbk2uni table!"
+#include "gbk2uni_flat.h"
+#include "gbk2utf8_tab.h"
 #else
 #warning "Use orig gbk2uni table!"
 // 我
@@ -3089,1668 +39,378 @@ static const uint16_t GBK2UNI_TABLE[] = {
 //[(0xce - 0x81) * 12 * 16 + 0xd2 - 0x40] = 14930
 // uni:0x6211
 // utf8:0xe68891
-
-// size: 24192
-static const uint16_t GBK2UNI_TABLE[] = {
-    0X4E02,0X4E04,0X4E05,0X4E06,0X4E0F,0X4E12,0X4E17,0X4E1F,0X4E20,0X4E21,0X4E23,0X4E26,0X4E29,0X4E2E,0X4E2F,0X4E31,
-    0X4E33,0X4E35,0X4E37,0X4E3C,0X4E40,0X4E41,0X4E42,0X4E44,0X4E46,0X4E4A,0X4E51,0X4E55,0X4E57,0X4E5A,0X4E5B,0X4E62,
-    0X4E63,0X4E64,0X4E65,0X4E67,0X4E68,0X4E6A,0X4E6B,0X4E6C,0X4E6D,0X4E6E,0X4E6F,0X4E72,0X4E74,0X4E75,0X4E76,0X4E77,
-    0X4E78,0X4E79,0X4E7A,0X4E7B,0X4E7C,0X4E7D,0X4E7F,0X4E80,0X4E81,0X4E82,0X4E83,0X4E84,0X4E85,0X4E87,0X4E8A,0X0001,
-    0X4E90,0X4E96,0X4E97,0X4E99,0X4E9C,0X4E9D,0X4E9E,0X4EA3,0X4EAA,0X4EAF,0X4EB0,0X4EB1,0X4EB4,0X4EB6,0X4EB7,0X4EB8,
-    0X4EB9,0X4EBC,0X4EBD,0X4EBE,0X4EC8,0X4ECC,0X4ECF,0X4ED0,0X4ED2,0X4EDA,0X4EDB,0X4EDC,0X4EE0,0X4EE2,0X4EE6,0X4EE7,
-    0X4EE9,0X4EED,0X4EEE,0X4EEF,0X4EF1,0X4EF4,0X4EF8,0X4EF9,0X4EFA,0X4EFC,0X4EFE,0X4F00,0X4F02,0X4F03,0X4F04,0X4F05,
-    0X4F06,0X4F07,0X4F08,0X4F0B,0X4F0C,0X4F12,0X4F13,0X4F14,0X4F15,0X4F16,0X4F1C,0X4F1D,0X4F21,0X4F23,0X4F28,0X4F29,
-    0X4F2C,0X4F2D,0X4F2E,0X4F31,0X4F33,0X4F35,0X4F37,0X4F39,0X4F3B,0X4F3E,0X4F3F,0X4F40,0X4F41,0X4F42,0X4F44,0X4F45,
-    0X4F47,0X4F48,0X4F49,0X4F4A,0X4F4B,0X4F4C,0X4F52,0X4F54,0X4F56,0X4F61,0X4F62,0X4F66,0X4F68,0X4F6A,0X4F6B,0X4F6D,
-    0X4F6E,0X4F71,0X4F72,0X4F75,0X4F77,0X4F78,0X4F79,0X4F7A,0X4F7D,0X4F80,0X4F81,0X4F82,0X4F85,0X4F86,0X4F87,0X4F8A,
-    0X4F8C,0X4F8E,0X4F90,0X4F92,0X4F93,0X4F95,0X4F96,0X4F98,0X4F99,0X4F9A,0X4F9C,0X4F9E,0X4F9F,0X4FA1,0X4FA2,0X0001,
-    0X4FA4,0X4FAB,0X4FAD,0X4FB0,0X4FB1,0X4FB2,0X4FB3,0X4FB4,0X4FB6,0X4FB7,0X4FB8,0X4FB9,0X4FBA,0X4FBB,0X4FBC,0X4FBD,
-    0X4FBE,0X4FC0,0X4FC1,0X4FC2,0X4FC6,0X4FC7,0X4FC8,0X4FC9,0X4FCB,0X4FCC,0X4FCD,0X4FD2,0X4FD3,0X4FD4,0X4FD5,0X4FD6,
-    0X4FD9,0X4FDB,0X4FE0,0X4FE2,0X4FE4,0X4FE5,0X4FE7,0X4FEB,0X4FEC,0X4FF0,0X4FF2,0X4FF4,0X4FF5,0X4FF6,0X4FF7,0X4FF9,
-    0X4FFB,0X4FFC,0X4FFD,0X4FFF,0X5000,0X5001,0X5002,0X5003,0X5004,0X5005,0X5006,0X5007,0X5008,0X5009,0X500A,0X0001,
-    0X500B,0X500E,0X5010,0X5011,0X5013,0X5015,0X5016,0X5017,0X501B,0X501D,0X501E,0X5020,0X5022,0X5023,0X5024,0X5027,
-    0X502B,0X502F,0X5030,0X5031,0X5032,0X5033,0X5034,0X5035,0X5036,0X5037,0X5038,0X5039,0X503B,0X503D,0X503F,0X5040,
-    0X5041,0X5042,0X5044,0X5045,0X5046,0X5049,0X504A,0X504B,0X504D,0X5050,0X5051,0X5052,0X5053,0X5054,0X5056,0X5057,
-    0X5058,0X5059,0X505B,0X505D,0X505E,0X505F,0X5060,0X5061,0X5062,0X5063,0X5064,0X5066,0X5067,0X5068,0X5069,0X506A,
-    0X506B,0X506D,0X506E,0X506F,0X5070,0X5071,0X5072,0X5073,0X5074,0X5075,0X5078,0X5079,0X507A,0X507C,0X507D,0X5081,
-    0X5082,0X5083,0X5084,0X5086,0X5087,0X5089,0X508A,0X508B,0X508C,0X508E,0X508F,0X5090,0X5091,0X5092,0X5093,0X5094,
-    0X5095,0X5096,0X5097,0X5098,0X5099,0X509A,0X509B,0X509C,0X509D,0X509E,0X509F,0X50A0,0X50A1,0X50A2,0X50A4,0X50A6,
-    0X50AA,0X50AB,0X50AD,0X50AE,0X50AF,0X50B0,0X50B1,0X50B3,0X50B4,0X50B5,0X50B6,0X50B7,0X50B8,0X50B9,0X50BC,0X0001,
-    0X50BD,0X50BE,0X50BF,0X50C0,0X50C1,0X50C2,0X50C3,0X50C4,0X50C5,0X50C6,0X50C7,0X50C8,0X50C9,0X50CA,0X50CB,0X50CC,
-    0X50CD,0X50CE,0X50D0,0X50D1,0X50D2,0X50D3,0X50D4,0X50D5,0X50D7,0X50D8,0X50D9,0X50DB,0X50DC,0X50DD,0X50DE,0X50DF,
-    0X50E0,0X50E1,0X50E2,0X50E3,0X50E4,0X50E5,0X50E8,0X50E9,0X50EA,0X50EB,0X50EF,0X50F0,0X50F1,0X50F2,0X50F4,0X50F6,
-    0X50F7,0X50F8,0X50F9,0X50FA,0X50FC,0X50FD,0X50FE,0X50FF,0X5100,0X5101,0X5102,0X5103,0X5104,0X5105,0X5108,0X0001,
-    0X5109,0X510A,0X510C,0X510D,0X510E,0X510F,0X5110,0X5111,0X5113,0X5114,0X5115,0X5116,0X5117,0X5118,0X5119,0X511A,
-    0X511B,0X511C,0X511D,0X511E,0X511F,0X5120,0X5122,0X5123,0X5124,0X5125,0X5126,0X5127,0X5128,0X5129,0X512A,0X512B,
-    0X512C,0X512D,0X512E,0X512F,0X5130,0X5131,0X5132,0X5133,0X5134,0X5135,0X5136,0X5137,0X5138,0X5139,0X513A,0X513B,
-    0X513C,0X513D,0X513E,0X5142,0X5147,0X514A,0X514C,0X514E,0X514F,0X5150,0X5152,0X5153,0X5157,0X5158,0X5159,0X515B,
-    0X515D,0X515E,0X515F,0X5160,0X5161,0X5163,0X5164,0X5166,0X5167,0X5169,0X516A,0X516F,0X5172,0X517A,0X517E,0X517F,
-    0X5183,0X5184,0X5186,0X5187,0X518A,0X518B,0X518E,0X518F,0X5190,0X5191,0X5193,0X5194,0X5198,0X519A,0X519D,0X519E,
-    0X519F,0X51A1,0X51A3,0X51A6,0X51A7,0X51A8,0X51A9,0X51AA,0X51AD,0X51AE,0X51B4,0X51B8,0X51B9,0X51BA,0X51BE,0X51BF,
-    0X51C1,0X51C2,0X51C3,0X51C5,0X51C8,0X51CA,0X51CD,0X51CE,0X51D0,0X51D2,0X51D3,0X51D4,0X51D5,0X51D6,0X51D7,0X0001,
-    0X51D8,0X51D9,0X51DA,0X51DC,0X51DE,0X51DF,0X51E2,0X51E3,0X51E5,0X51E6,0X51E7,0X51E8,0X51E9,0X51EA,0X51EC,0X51EE,
-    0X51F1,0X51F2,0X51F4,0X51F7,0X51FE,0X5204,0X5205,0X5209,0X520B,0X520C,0X520F,0X5210,0X5213,0X5214,0X5215,0X521C,
-    0X521E,0X521F,0X5221,0X5222,0X5223,0X5225,0X5226,0X5227,0X522A,0X522C,0X522F,0X5231,0X5232,0X5234,0X5235,0X523C,
-    0X523E,0X5244,0X5245,0X5246,0X5247,0X5248,0X5249,0X524B,0X524E,0X524F,0X5252,0X5253,0X5255,0X5257,0X5258,0X0001,
-    0X5259,0X525A,0X525B,0X525D,0X525F,0X5260,0X5262,0X5263,0X5264,0X5266,0X5268,0X526B,0X526C,0X526D,0X526E,0X5270,
-    0X5271,0X5273,0X5274,0X5275,0X5276,0X5277,0X5278,0X5279,0X527A,0X527B,0X527C,0X527E,0X5280,0X5283,0X5284,0X5285,
-    0X5286,0X5287,0X5289,0X528A,0X528B,0X528C,0X528D,0X528E,0X528F,0X5291,0X5292,0X5294,0X5295,0X5296,0X5297,0X5298,
-    0X5299,0X529A,0X529C,0X52A4,0X52A5,0X52A6,0X52A7,0X52AE,0X52AF,0X52B0,0X52B4,0X52B5,0X52B6,0X52B7,0X52B8,0X52B9,
-    0X52BA,0X52BB,0X52BC,0X52BD,0X52C0,0X52C1,0X52C2,0X52C4,0X52C5,0X52C6,0X52C8,0X52CA,0X52CC,0X52CD,0X52CE,0X52CF,
-    0X52D1,0X52D3,0X52D4,0X52D5,0X52D7,0X52D9,0X52DA,0X52DB,0X52DC,0X52DD,0X52DE,0X52E0,0X52E1,0X52E2,0X52E3,0X52E5,
-    0X52E6,0X52E7,0X52E8,0X52E9,0X52EA,0X52EB,0X52EC,0X52ED,0X52EE,0X52EF,0X52F1,0X52F2,0X52F3,0X52F4,0X52F5,0X52F6,
-    0X52F7,0X52F8,0X52FB,0X52FC,0X52FD,0X5301,0X5302,0X5303,0X5304,0X5307,0X5309,0X530A,0X530B,0X530C,0X530E,0X0001,
-    0X5311,0X5312,0X5313,0X5314,0X5318,0X531B,0X531C,0X531E,0X531F,0X5322,0X5324,0X5325,0X5327,0X5328,0X5329,0X532B,
-    0X532C,0X532D,0X532F,0X5330,0X5331,0X5332,0X5333,0X5334,0X5335,0X5336,0X5337,0X5338,0X533C,0X533D,0X5340,0X5342,
-    0X5344,0X5346,0X534B,0X534C,0X534D,0X5350,0X5354,0X5358,0X5359,0X535B,0X535D,0X5365,0X5368,0X536A,0X536C,0X536D,
-    0X5372,0X5376,0X5379,0X537B,0X537C,0X537D,0X537E,0X5380,0X5381,0X5383,0X5387,0X5388,0X538A,0X538E,0X538F,0X0001,
-    0X5390,0X5391,0X5392,0X5393,0X5394,0X5396,0X5397,0X5399,0X539B,0X539C,0X539E,0X53A0,0X53A1,0X53A4,0X53A7,0X53AA,
-    0X53AB,0X53AC,0X53AD,0X53AF,0X53B0,0X53B1,0X53B2,0X53B3,0X53B4,0X53B5,0X53B7,0X53B8,0X53B9,0X53BA,0X53BC,0X53BD,
-    0X53BE,0X53C0,0X53C3,0X53C4,0X53C5,0X53C6,0X53C7,0X53CE,0X53CF,0X53D0,0X53D2,0X53D3,0X53D5,0X53DA,0X53DC,0X53DD,
-    0X53DE,0X53E1,0X53E2,0X53E7,0X53F4,0X53FA,0X53FE,0X53FF,0X5400,0X5402,0X5405,0X5407,0X540B,0X5414,0X5418,0X5419,
-    0X541A,0X541C,0X5422,0X5424,0X5425,0X542A,0X5430,0X5433,0X5436,0X5437,0X543A,0X543D,0X543F,0X5441,0X5442,0X5444,
-    0X5445,0X5447,0X5449,0X544C,0X544D,0X544E,0X544F,0X5451,0X545A,0X545D,0X545E,0X545F,0X5460,0X5461,0X5463,0X5465,
-    0X5467,0X5469,0X546A,0X546B,0X546C,0X546D,0X546E,0X546F,0X5470,0X5474,0X5479,0X547A,0X547E,0X547F,0X5481,0X5483,
-    0X5485,0X5487,0X5488,0X5489,0X548A,0X548D,0X5491,0X5493,0X5497,0X5498,0X549C,0X549E,0X549F,0X54A0,0X54A1,0X0001,
-    0X54A2,0X54A5,0X54AE,0X54B0,0X54B2,0X54B5,0X54B6,0X54B7,0X54B9,0X54BA,0X54BC,0X54BE,0X54C3,0X54C5,0X54CA,0X54CB,
-    0X54D6,0X54D8,0X54DB,0X54E0,0X54E1,0X54E2,0X54E3,0X54E4,0X54EB,0X54EC,0X54EF,0X54F0,0X54F1,0X54F4,0X54F5,0X54F6,
-    0X54F7,0X54F8,0X54F9,0X54FB,0X54FE,0X5500,0X5502,0X5503,0X5504,0X5505,0X5508,0X550A,0X550B,0X550C,0X550D,0X550E,
-    0X5512,0X5513,0X5515,0X5516,0X5517,0X5518,0X5519,0X551A,0X551C,0X551D,0X551E,0X551F,0X5521,0X5525,0X5526,0X0001,
-    0X5528,0X5529,0X552B,0X552D,0X5532,0X5534,0X5535,0X5536,0X5538,0X5539,0X553A,0X553B,0X553D,0X5540,0X5542,0X5545,
-    0X5547,0X5548,0X554B,0X554C,0X554D,0X554E,0X554F,0X5551,0X5552,0X5553,0X5554,0X5557,0X5558,0X5559,0X555A,0X555B,
-    0X555D,0X555E,0X555F,0X5560,0X5562,0X5563,0X5568,0X5569,0X556B,0X556F,0X5570,0X5571,0X5572,0X5573,0X5574,0X5579,
-    0X557A,0X557D,0X557F,0X5585,0X5586,0X558C,0X558D,0X558E,0X5590,0X5592,0X5593,0X5595,0X5596,0X5597,0X559A,0X559B,
-    0X559E,0X55A0,0X55A1,0X55A2,0X55A3,0X55A4,0X55A5,0X55A6,0X55A8,0X55A9,0X55AA,0X55AB,0X55AC,0X55AD,0X55AE,0X55AF,
-    0X55B0,0X55B2,0X55B4,0X55B6,0X55B8,0X55BA,0X55BC,0X55BF,0X55C0,0X55C1,0X55C2,0X55C3,0X55C6,0X55C7,0X55C8,0X55CA,
-    0X55CB,0X55CE,0X55CF,0X55D0,0X55D5,0X55D7,0X55D8,0X55D9,0X55DA,0X55DB,0X55DE,0X55E0,0X55E2,0X55E7,0X55E9,0X55ED,
-    0X55EE,0X55F0,0X55F1,0X55F4,0X55F6,0X55F8,0X55F9,0X55FA,0X55FB,0X55FC,0X55FF,0X5602,0X5603,0X5604,0X5605,0X0001,
-    0X5606,0X5607,0X560A,0X560B,0X560D,0X5610,0X5611,0X5612,0X5613,0X5614,0X5615,0X5616,0X5617,0X5619,0X561A,0X561C,
-    0X561D,0X5620,0X5621,0X5622,0X5625,0X5626,0X5628,0X5629,0X562A,0X562B,0X562E,0X562F,0X5630,0X5633,0X5635,0X5637,
-    0X5638,0X563A,0X563C,0X563D,0X563E,0X5640,0X5641,0X5642,0X5643,0X5644,0X5645,0X5646,0X5647,0X5648,0X5649,0X564A,
-    0X564B,0X564F,0X5650,0X5651,0X5652,0X5653,0X5655,0X5656,0X565A,0X565B,0X565D,0X565E,0X565F,0X5660,0X5661,0X0001,
-    0X5663,0X5665,0X5666,0X5667,0X566D,0X566E,0X566F,0X5670,0X5672,0X5673,0X5674,0X5675,0X5677,0X5678,0X5679,0X567A,
-    0X567D,0X567E,0X567F,0X5680,0X5681,0X5682,0X5683,0X5684,0X5687,0X5688,0X5689,0X568A,0X568B,0X568C,0X568D,0X5690,
-    0X5691,0X5692,0X5694,0X5695,0X5696,0X5697,0X5698,0X5699,0X569A,0X569B,0X569C,0X569D,0X569E,0X569F,0X56A0,0X56A1,
-    0X56A2,0X56A4,0X56A5,0X56A6,0X56A7,0X56A8,0X56A9,0X56AA,0X56AB,0X56AC,0X56AD,0X56AE,0X56B0,0X56B1,0X56B2,0X56B3,
-    0X56B4,0X56B5,0X56B6,0X56B8,0X56B9,0X56BA,0X56BB,0X56BD,0X56BE,0X56BF,0X56C0,0X56C1,0X56C2,0X56C3,0X56C4,0X56C5,
-    0X56C6,0X56C7,0X56C8,0X56C9,0X56CB,0X56CC,0X56CD,0X56CE,0X56CF,0X56D0,0X56D1,0X56D2,0X56D3,0X56D5,0X56D6,0X56D8,
-    0X56D9,0X56DC,0X56E3,0X56E5,0X56E6,0X56E7,0X56E8,0X56E9,0X56EA,0X56EC,0X56EE,0X56EF,0X56F2,0X56F3,0X56F6,0X56F7,
-    0X56F8,0X56FB,0X56FC,0X5700,0X5701,0X5702,0X5705,0X5707,0X570B,0X570C,0X570D,0X570E,0X570F,0X5710,0X5711,0X0001,
-    0X5712,0X5713,0X5714,0X5715,0X5716,0X5717,0X5718,0X5719,0X571A,0X571B,0X571D,0X571E,0X5720,0X5721,0X5722,0X5724,
-    0X5725,0X5726,0X5727,0X572B,0X5731,0X5732,0X5734,0X5735,0X5736,0X5737,0X5738,0X573C,0X573D,0X573F,0X5741,0X5743,
-    0X5744,0X5745,0X5746,0X5748,0X5749,0X574B,0X5752,0X5753,0X5754,0X5755,0X5756,0X5758,0X5759,0X5762,0X5763,0X5765,
-    0X5767,0X576C,0X576E,0X5770,0X5771,0X5772,0X5774,0X5775,0X5778,0X5779,0X577A,0X577D,0X577E,0X577F,0X5780,0X0001,
-    0X5781,0X5787,0X5788,0X5789,0X578A,0X578D,0X578E,0X578F,0X5790,0X5791,0X5794,0X5795,0X5796,0X5797,0X5798,0X5799,
-    0X579A,0X579C,0X579D,0X579E,0X579F,0X57A5,0X57A8,0X57AA,0X57AC,0X57AF,0X57B0,0X57B1,0X57B3,0X57B5,0X57B6,0X57B7,
-    0X57B9,0X57BA,0X57BB,0X57BC,0X57BD,0X57BE,0X57BF,0X57C0,0X57C1,0X57C4,0X57C5,0X57C6,0X57C7,0X57C8,0X57C9,0X57CA,
-    0X57CC,0X57CD,0X57D0,0X57D1,0X57D3,0X57D6,0X57D7,0X57DB,0X57DC,0X57DE,0X57E1,0X57E2,0X57E3,0X57E5,0X57E6,0X57E7,
-    0X57E8,0X57E9,0X57EA,0X57EB,0X57EC,0X57EE,0X57F0,0X57F1,0X57F2,0X57F3,0X57F5,0X57F6,0X57F7,0X57FB,0X57FC,0X57FE,
-    0X57FF,0X5801,0X5803,0X5804,0X5805,0X5808,0X5809,0X580A,0X580C,0X580E,0X580F,0X5810,0X5812,0X5813,0X5814,0X5816,
-    0X5817,0X5818,0X581A,0X581B,0X581C,0X581D,0X581F,0X5822,0X5823,0X5825,0X5826,0X5827,0X5828,0X5829,0X582B,0X582C,
-    0X582D,0X582E,0X582F,0X5831,0X5832,0X5833,0X5834,0X5836,0X5837,0X5838,0X5839,0X583A,0X583B,0X583C,0X583D,0X0001,
-    0X583E,0X583F,0X5840,0X5841,0X5842,0X5843,0X5845,0X5846,0X5847,0X5848,0X5849,0X584A,0X584B,0X584E,0X584F,0X5850,
-    0X5852,0X5853,0X5855,0X5856,0X5857,0X5859,0X585A,0X585B,0X585C,0X585D,0X585F,0X5860,0X5861,0X5862,0X5863,0X5864,
-    0X5866,0X5867,0X5868,0X5869,0X586A,0X586D,0X586E,0X586F,0X5870,0X5871,0X5872,0X5873,0X5874,0X5875,0X5876,0X5877,
-    0X5878,0X5879,0X587A,0X587B,0X587C,0X587D,0X587F,0X5882,0X5884,0X5886,0X5887,0X5888,0X588A,0X588B,0X588C,0X0001,
-    0X588D,0X588E,0X588F,0X5890,0X5891,0X5894,0X5895,0X5896,0X5897,0X5898,0X589B,0X589C,0X589D,0X58A0,0X58A1,0X58A2,
-    0X58A3,0X58A4,0X58A5,0X58A6,0X58A7,0X58AA,0X58AB,0X58AC,0X58AD,0X58AE,0X58AF,0X58B0,0X58B1,0X58B2,0X58B3,0X58B4,
-    0X58B5,0X58B6,0X58B7,0X58B8,0X58B9,0X58BA,0X58BB,0X58BD,0X58BE,0X58BF,0X58C0,0X58C2,0X58C3,0X58C4,0X58C6,0X58C7,
-    0X58C8,0X58C9,0X58CA,0X58CB,0X58CC,0X58CD,0X58CE,0X58CF,0X58D0,0X58D2,0X58D3,0X58D4,0X58D6,0X58D7,0X58D8,0X58D9,
-    0X58DA,0X58DB,0X58DC,0X58DD,0X58DE,0X58DF,0X58E0,0X58E1,0X58E2,0X58E3,0X58E5,0X58E6,0X58E7,0X58E8,0X58E9,0X58EA,
-    0X58ED,0X58EF,0X58F1,0X58F2,0X58F4,0X58F5,0X58F7,0X58F8,0X58FA,0X58FB,0X58FC,0X58FD,0X58FE,0X58FF,0X5900,0X5901,
-    0X5903,0X5905,0X5906,0X5908,0X5909,0X590A,0X590B,0X590C,0X590E,0X5910,0X5911,0X5912,0X5913,0X5917,0X5918,0X591B,
-    0X591D,0X591E,0X5920,0X5921,0X5922,0X5923,0X5926,0X5928,0X592C,0X5930,0X5932,0X5933,0X5935,0X5936,0X593B,0X0001,
-    0X593D,0X593E,0X593F,0X5940,0X5943,0X5945,0X5946,0X594A,0X594C,0X594D,0X5950,0X5952,0X5953,0X5959,0X595B,0X595C,
-    0X595D,0X595E,0X595F,0X5961,0X5963,0X5964,0X5966,0X5967,0X5968,0X5969,0X596A,0X596B,0X596C,0X596D,0X596E,0X596F,
-    0X5970,0X5971,0X5972,0X5975,0X5977,0X597A,0X597B,0X597C,0X597E,0X597F,0X5980,0X5985,0X5989,0X598B,0X598C,0X598E,
-    0X598F,0X5990,0X5991,0X5994,0X5995,0X5998,0X599A,0X599B,0X599C,0X599D,0X599F,0X59A0,0X59A1,0X59A2,0X59A6,0X0001,
-    0X59A7,0X59AC,0X59AD,0X59B0,0X59B1,0X59B3,0X59B4,0X59B5,0X59B6,0X59B7,0X59B8,0X59BA,0X59BC,0X59BD,0X59BF,0X59C0,
-    0X59C1,0X59C2,0X59C3,0X59C4,0X59C5,0X59C7,0X59C8,0X59C9,0X59CC,0X59CD,0X59CE,0X59CF,0X59D5,0X59D6,0X59D9,0X59DB,
-    0X59DE,0X59DF,0X59E0,0X59E1,0X59E2,0X59E4,0X59E6,0X59E7,0X59E9,0X59EA,0X59EB,0X59ED,0X59EE,0X59EF,0X59F0,0X59F1,
-    0X59F2,0X59F3,0X59F4,0X59F5,0X59F6,0X59F7,0X59F8,0X59FA,0X59FC,0X59FD,0X59FE,0X5A00,0X5A02,0X5A0A,0X5A0B,0X5A0D,
-    0X5A0E,0X5A0F,0X5A10,0X5A12,0X5A14,0X5A15,0X5A16,0X5A17,0X5A19,0X5A1A,0X5A1B,0X5A1D,0X5A1E,0X5A21,0X5A22,0X5A24,
-    0X5A26,0X5A27,0X5A28,0X5A2A,0X5A2B,0X5A2C,0X5A2D,0X5A2E,0X5A2F,0X5A30,0X5A33,0X5A35,0X5A37,0X5A38,0X5A39,0X5A3A,
-    0X5A3B,0X5A3D,0X5A3E,0X5A3F,0X5A41,0X5A42,0X5A43,0X5A44,0X5A45,0X5A47,0X5A48,0X5A4B,0X5A4C,0X5A4D,0X5A4E,0X5A4F,
-    0X5A50,0X5A51,0X5A52,0X5A53,0X5A54,0X5A56,0X5A57,0X5A58,0X5A59,0X5A5B,0X5A5C,0X5A5D,0X5A5E,0X5A5F,0X5A60,0X0001,
-    0X5A61,0X5A63,0X5A64,0X5A65,0X5A66,0X5A68,0X5A69,0X5A6B,0X5A6C,0X5A6D,0X5A6E,0X5A6F,0X5A70,0X5A71,0X5A72,0X5A73,
-    0X5A78,0X5A79,0X5A7B,0X5A7C,0X5A7D,0X5A7E,0X5A80,0X5A81,0X5A82,0X5A83,0X5A84,0X5A85,0X5A86,0X5A87,0X5A88,0X5A89,
-    0X5A8A,0X5A8B,0X5A8C,0X5A8D,0X5A8E,0X5A8F,0X5A90,0X5A91,0X5A93,0X5A94,0X5A95,0X5A96,0X5A97,0X5A98,0X5A99,0X5A9C,
-    0X5A9D,0X5A9E,0X5A9F,0X5AA0,0X5AA1,0X5AA2,0X5AA3,0X5AA4,0X5AA5,0X5AA6,0X5AA7,0X5AA8,0X5AA9,0X5AAB,0X5AAC,0X0001,
-    0X5AAD,0X5AAE,0X5AAF,0X5AB0,0X5AB1,0X5AB4,0X5AB6,0X5AB7,0X5AB9,0X5ABA,0X5ABB,0X5ABC,0X5ABD,0X5ABF,0X5AC0,0X5AC3,
-    0X5AC4,0X5AC5,0X5AC6,0X5AC7,0X5AC8,0X5ACA,0X5ACB,0X5ACD,0X5ACE,0X5ACF,0X5AD0,0X5AD1,0X5AD3,0X5AD5,0X5AD7,0X5AD9,
-    0X5ADA,0X5ADB,0X5ADD,0X5ADE,0X5ADF,0X5AE2,0X5AE4,0X5AE5,0X5AE7,0X5AE8,0X5AEA,0X5AEC,0X5AED,0X5AEE,0X5AEF,0X5AF0,
-    0X5AF2,0X5AF3,0X5AF4,0X5AF5,0X5AF6,0X5AF7,0X5AF8,0X5AF9,0X5AFA,0X5AFB,0X5AFC,0X5AFD,0X5AFE,0X5AFF,0X5B00,0X5B01,
-    0X5B02,0X5B03,0X5B04,0X5B05,0X5B06,0X5B07,0X5B08,0X5B0A,0X5B0B,0X5B0C,0X5B0D,0X5B0E,0X5B0F,0X5B10,0X5B11,0X5B12,
-    0X5B13,0X5B14,0X5B15,0X5B18,0X5B19,0X5B1A,0X5B1B,0X5B1C,0X5B1D,0X5B1E,0X5B1F,0X5B20,0X5B21,0X5B22,0X5B23,0X5B24,
-    0X5B25,0X5B26,0X5B27,0X5B28,0X5B29,0X5B2A,0X5B2B,0X5B2C,0X5B2D,0X5B2E,0X5B2F,0X5B30,0X5B31,0X5B33,0X5B35,0X5B36,
-    0X5B38,0X5B39,0X5B3A,0X5B3B,0X5B3C,0X5B3D,0X5B3E,0X5B3F,0X5B41,0X5B42,0X5B43,0X5B44,0X5B45,0X5B46,0X5B47,0X0001,
-    0X5B48,0X5B49,0X5B4A,0X5B4B,0X5B4C,0X5B4D,0X5B4E,0X5B4F,0X5B52,0X5B56,0X5B5E,0X5B60,0X5B61,0X5B67,0X5B68,0X5B6B,
-    0X5B6D,0X5B6E,0X5B6F,0X5B72,0X5B74,0X5B76,0X5B77,0X5B78,0X5B79,0X5B7B,0X5B7C,0X5B7E,0X5B7F,0X5B82,0X5B86,0X5B8A,
-    0X5B8D,0X5B8E,0X5B90,0X5B91,0X5B92,0X5B94,0X5B96,0X5B9F,0X5BA7,0X5BA8,0X5BA9,0X5BAC,0X5BAD,0X5BAE,0X5BAF,0X5BB1,
-    0X5BB2,0X5BB7,0X5BBA,0X5BBB,0X5BBC,0X5BC0,0X5BC1,0X5BC3,0X5BC8,0X5BC9,0X5BCA,0X5BCB,0X5BCD,0X5BCE,0X5BCF,0X0001,
-    0X5BD1,0X5BD4,0X5BD5,0X5BD6,0X5BD7,0X5BD8,0X5BD9,0X5BDA,0X5BDB,0X5BDC,0X5BE0,0X5BE2,0X5BE3,0X5BE6,0X5BE7,0X5BE9,
-    0X5BEA,0X5BEB,0X5BEC,0X5BED,0X5BEF,0X5BF1,0X5BF2,0X5BF3,0X5BF4,0X5BF5,0X5BF6,0X5BF7,0X5BFD,0X5BFE,0X5C00,0X5C02,
-    0X5C03,0X5C05,0X5C07,0X5C08,0X5C0B,0X5C0C,0X5C0D,0X5C0E,0X5C10,0X5C12,0X5C13,0X5C17,0X5C19,0X5C1B,0X5C1E,0X5C1F,
-    0X5C20,0X5C21,0X5C23,0X5C26,0X5C28,0X5C29,0X5C2A,0X5C2B,0X5C2D,0X5C2E,0X5C2F,0X5C30,0X5C32,0X5C33,0X5C35,0X5C36,
-    0X5C37,0X5C43,0X5C44,0X5C46,0X5C47,0X5C4C,0X5C4D,0X5C52,0X5C53,0X5C54,0X5C56,0X5C57,0X5C58,0X5C5A,0X5C5B,0X5C5C,
-    0X5C5D,0X5C5F,0X5C62,0X5C64,0X5C67,0X5C68,0X5C69,0X5C6A,0X5C6B,0X5C6C,0X5C6D,0X5C70,0X5C72,0X5C73,0X5C74,0X5C75,
-    0X5C76,0X5C77,0X5C78,0X5C7B,0X5C7C,0X5C7D,0X5C7E,0X5C80,0X5C83,0X5C84,0X5C85,0X5C86,0X5C87,0X5C89,0X5C8A,0X5C8B,
-    0X5C8E,0X5C8F,0X5C92,0X5C93,0X5C95,0X5C9D,0X5C9E,0X5C9F,0X5CA0,0X5CA1,0X5CA4,0X5CA5,0X5CA6,0X5CA7,0X5CA8,0X0001,
-    0X5CAA,0X5CAE,0X5CAF,0X5CB0,0X5CB2,0X5CB4,0X5CB6,0X5CB9,0X5CBA,0X5CBB,0X5CBC,0X5CBE,0X5CC0,0X5CC2,0X5CC3,0X5CC5,
-    0X5CC6,0X5CC7,0X5CC8,0X5CC9,0X5CCA,0X5CCC,0X5CCD,0X5CCE,0X5CCF,0X5CD0,0X5CD1,0X5CD3,0X5CD4,0X5CD5,0X5CD6,0X5CD7,
-    0X5CD8,0X5CDA,0X5CDB,0X5CDC,0X5CDD,0X5CDE,0X5CDF,0X5CE0,0X5CE2,0X5CE3,0X5CE7,0X5CE9,0X5CEB,0X5CEC,0X5CEE,0X5CEF,
-    0X5CF1,0X5CF2,0X5CF3,0X5CF4,0X5CF5,0X5CF6,0X5CF7,0X5CF8,0X5CF9,0X5CFA,0X5CFC,0X5CFD,0X5CFE,0X5CFF,0X5D00,0X0001,
-    0X5D01,0X5D04,0X5D05,0X5D08,0X5D09,0X5D0A,0X5D0B,0X5D0C,0X5D0D,0X5D0F,0X5D10,0X5D11,0X5D12,0X5D13,0X5D15,0X5D17,
-    0X5D18,0X5D19,0X5D1A,0X5D1C,0X5D1D,0X5D1F,0X5D20,0X5D21,0X5D22,0X5D23,0X5D25,0X5D28,0X5D2A,0X5D2B,0X5D2C,0X5D2F,
-    0X5D30,0X5D31,0X5D32,0X5D33,0X5D35,0X5D36,0X5D37,0X5D38,0X5D39,0X5D3A,0X5D3B,0X5D3C,0X5D3F,0X5D40,0X5D41,0X5D42,
-    0X5D43,0X5D44,0X5D45,0X5D46,0X5D48,0X5D49,0X5D4D,0X5D4E,0X5D4F,0X5D50,0X5D51,0X5D52,0X5D53,0X5D54,0X5D55,0X5D56,
-    0X5D57,0X5D59,0X5D5A,0X5D5C,0X5D5E,0X5D5F,0X5D60,0X5D61,0X5D62,0X5D63,0X5D64,0X5D65,0X5D66,0X5D67,0X5D68,0X5D6A,
-    0X5D6D,0X5D6E,0X5D70,0X5D71,0X5D72,0X5D73,0X5D75,0X5D76,0X5D77,0X5D78,0X5D79,0X5D7A,0X5D7B,0X5D7C,0X5D7D,0X5D7E,
-    0X5D7F,0X5D80,0X5D81,0X5D83,0X5D84,0X5D85,0X5D86,0X5D87,0X5D88,0X5D89,0X5D8A,0X5D8B,0X5D8C,0X5D8D,0X5D8E,0X5D8F,
-    0X5D90,0X5D91,0X5D92,0X5D93,0X5D94,0X5D95,0X5D96,0X5D97,0X5D98,0X5D9A,0X5D9B,0X5D9C,0X5D9E,0X5D9F,0X5DA0,0X0001,
-    0X5DA1,0X5DA2,0X5DA3,0X5DA4,0X5DA5,0X5DA6,0X5DA7,0X5DA8,0X5DA9,0X5DAA,0X5DAB,0X5DAC,0X5DAD,0X5DAE,0X5DAF,0X5DB0,
-    0X5DB1,0X5DB2,0X5DB3,0X5DB4,0X5DB5,0X5DB6,0X5DB8,0X5DB9,0X5DBA,0X5DBB,0X5DBC,0X5DBD,0X5DBE,0X5DBF,0X5DC0,0X5DC1,
-    0X5DC2,0X5DC3,0X5DC4,0X5DC6,0X5DC7,0X5DC8,0X5DC9,0X5DCA,0X5DCB,0X5DCC,0X5DCE,0X5DCF,0X5DD0,0X5DD1,0X5DD2,0X5DD3,
-    0X5DD4,0X5DD5,0X5DD6,0X5DD7,0X5DD8,0X5DD9,0X5DDA,0X5DDC,0X5DDF,0X5DE0,0X5DE3,0X5DE4,0X5DEA,0X5DEC,0X5DED,0X0001,
-    0X5DF0,0X5DF5,0X5DF6,0X5DF8,0X5DF9,0X5DFA,0X5DFB,0X5DFC,0X5DFF,0X5E00,0X5E04,0X5E07,0X5E09,0X5E0A,0X5E0B,0X5E0D,
-    0X5E0E,0X5E12,0X5E13,0X5E17,0X5E1E,0X5E1F,0X5E20,0X5E21,0X5E22,0X5E23,0X5E24,0X5E25,0X5E28,0X5E29,0X5E2A,0X5E2B,
-    0X5E2C,0X5E2F,0X5E30,0X5E32,0X5E33,0X5E34,0X5E35,0X5E36,0X5E39,0X5E3A,0X5E3E,0X5E3F,0X5E40,0X5E41,0X5E43,0X5E46,
-    0X5E47,0X5E48,0X5E49,0X5E4A,0X5E4B,0X5E4D,0X5E4E,0X5E4F,0X5E50,0X5E51,0X5E52,0X5E53,0X5E56,0X5E57,0X5E58,0X5E59,
-    0X5E5A,0X5E5C,0X5E5D,0X5E5F,0X5E60,0X5E63,0X5E64,0X5E65,0X5E66,0X5E67,0X5E68,0X5E69,0X5E6A,0X5E6B,0X5E6C,0X5E6D,
-    0X5E6E,0X5E6F,0X5E70,0X5E71,0X5E75,0X5E77,0X5E79,0X5E7E,0X5E81,0X5E82,0X5E83,0X5E85,0X5E88,0X5E89,0X5E8C,0X5E8D,
-    0X5E8E,0X5E92,0X5E98,0X5E9B,0X5E9D,0X5EA1,0X5EA2,0X5EA3,0X5EA4,0X5EA8,0X5EA9,0X5EAA,0X5EAB,0X5EAC,0X5EAE,0X5EAF,
-    0X5EB0,0X5EB1,0X5EB2,0X5EB4,0X5EBA,0X5EBB,0X5EBC,0X5EBD,0X5EBF,0X5EC0,0X5EC1,0X5EC2,0X5EC3,0X5EC4,0X5EC5,0X0001,
-    0X5EC6,0X5EC7,0X5EC8,0X5ECB,0X5ECC,0X5ECD,0X5ECE,0X5ECF,0X5ED0,0X5ED4,0X5ED5,0X5ED7,0X5ED8,0X5ED9,0X5EDA,0X5EDC,
-    0X5EDD,0X5EDE,0X5EDF,0X5EE0,0X5EE1,0X5EE2,0X5EE3,0X5EE4,0X5EE5,0X5EE6,0X5EE7,0X5EE9,0X5EEB,0X5EEC,0X5EED,0X5EEE,
-    0X5EEF,0X5EF0,0X5EF1,0X5EF2,0X5EF3,0X5EF5,0X5EF8,0X5EF9,0X5EFB,0X5EFC,0X5EFD,0X5F05,0X5F06,0X5F07,0X5F09,0X5F0C,
-    0X5F0D,0X5F0E,0X5F10,0X5F12,0X5F14,0X5F16,0X5F19,0X5F1A,0X5F1C,0X5F1D,0X5F1E,0X5F21,0X5F22,0X5F23,0X5F24,0X0001,
-    0X5F28,0X5F2B,0X5F2C,0X5F2E,0X5F30,0X5F32,0X5F33,0X5F34,0X5F35,0X5F36,0X5F37,0X5F38,0X5F3B,0X5F3D,0X5F3E,0X5F3F,
-    0X5F41,0X5F42,0X5F43,0X5F44,0X5F45,0X5F46,0X5F47,0X5F48,0X5F49,0X5F4A,0X5F4B,0X5F4C,0X5F4D,0X5F4E,0X5F4F,0X5F51,
-    0X5F54,0X5F59,0X5F5A,0X5F5B,0X5F5C,0X5F5E,0X5F5F,0X5F60,0X5F63,0X5F65,0X5F67,0X5F68,0X5F6B,0X5F6E,0X5F6F,0X5F72,
-    0X5F74,0X5F75,0X5F76,0X5F78,0X5F7A,0X5F7D,0X5F7E,0X5F7F,0X5F83,0X5F86,0X5F8D,0X5F8E,0X5F8F,0X5F91,0X5F93,0X5F94,
-    0X5F96,0X5F9A,0X5F9B,0X5F9D,0X5F9E,0X5F9F,0X5FA0,0X5FA2,0X5FA3,0X5FA4,0X5FA5,0X5FA6,0X5FA7,0X5FA9,0X5FAB,0X5FAC,
-    0X5FAF,0X5FB0,0X5FB1,0X5FB2,0X5FB3,0X5FB4,0X5FB6,0X5FB8,0X5FB9,0X5FBA,0X5FBB,0X5FBE,0X5FBF,0X5FC0,0X5FC1,0X5FC2,
-    0X5FC7,0X5FC8,0X5FCA,0X5FCB,0X5FCE,0X5FD3,0X5FD4,0X5FD5,0X5FDA,0X5FDB,0X5FDC,0X5FDE,0X5FDF,0X5FE2,0X5FE3,0X5FE5,
-    0X5FE6,0X5FE8,0X5FE9,0X5FEC,0X5FEF,0X5FF0,0X5FF2,0X5FF3,0X5FF4,0X5FF6,0X5FF7,0X5FF9,0X5FFA,0X5FFC,0X6007,0X0001,
-    0X6008,0X6009,0X600B,0X600C,0X6010,0X6011,0X6013,0X6017,0X6018,0X601A,0X601E,0X601F,0X6022,0X6023,0X6024,0X602C,
-    0X602D,0X602E,0X6030,0X6031,0X6032,0X6033,0X6034,0X6036,0X6037,0X6038,0X6039,0X603A,0X603D,0X603E,0X6040,0X6044,
-    0X6045,0X6046,0X6047,0X6048,0X6049,0X604A,0X604C,0X604E,0X604F,0X6051,0X6053,0X6054,0X6056,0X6057,0X6058,0X605B,
-    0X605C,0X605E,0X605F,0X6060,0X6061,0X6065,0X6066,0X606E,0X6071,0X6072,0X6074,0X6075,0X6077,0X607E,0X6080,0X0001,
-    0X6081,0X6082,0X6085,0X6086,0X6087,0X6088,0X608A,0X608B,0X608E,0X608F,0X6090,0X6091,0X6093,0X6095,0X6097,0X6098,
-    0X6099,0X609C,0X609E,0X60A1,0X60A2,0X60A4,0X60A5,0X60A7,0X60A9,0X60AA,0X60AE,0X60B0,0X60B3,0X60B5,0X60B6,0X60B7,
-    0X60B9,0X60BA,0X60BD,0X60BE,0X60BF,0X60C0,0X60C1,0X60C2,0X60C3,0X60C4,0X60C7,0X60C8,0X60C9,0X60CC,0X60CD,0X60CE,
-    0X60CF,0X60D0,0X60D2,0X60D3,0X60D4,0X60D6,0X60D7,0X60D9,0X60DB,0X60DE,0X60E1,0X60E2,0X60E3,0X60E4,0X60E5,0X60EA,
-    0X60F1,0X60F2,0X60F5,0X60F7,0X60F8,0X60FB,0X60FC,0X60FD,0X60FE,0X60FF,0X6102,0X6103,0X6104,0X6105,0X6107,0X610A,
-    0X610B,0X610C,0X6110,0X6111,0X6112,0X6113,0X6114,0X6116,0X6117,0X6118,0X6119,0X611B,0X611C,0X611D,0X611E,0X6121,
-    0X6122,0X6125,0X6128,0X6129,0X612A,0X612C,0X612D,0X612E,0X612F,0X6130,0X6131,0X6132,0X6133,0X6134,0X6135,0X6136,
-    0X6137,0X6138,0X6139,0X613A,0X613B,0X613C,0X613D,0X613E,0X6140,0X6141,0X6142,0X6143,0X6144,0X6145,0X6146,0X0001,
-    0X6147,0X6149,0X614B,0X614D,0X614F,0X6150,0X6152,0X6153,0X6154,0X6156,0X6157,0X6158,0X6159,0X615A,0X615B,0X615C,
-    0X615E,0X615F,0X6160,0X6161,0X6163,0X6164,0X6165,0X6166,0X6169,0X616A,0X616B,0X616C,0X616D,0X616E,0X616F,0X6171,
-    0X6172,0X6173,0X6174,0X6176,0X6178,0X6179,0X617A,0X617B,0X617C,0X617D,0X617E,0X617F,0X6180,0X6181,0X6182,0X6183,
-    0X6184,0X6185,0X6186,0X6187,0X6188,0X6189,0X618A,0X618C,0X618D,0X618F,0X6190,0X6191,0X6192,0X6193,0X6195,0X0001,
-    0X6196,0X6197,0X6198,0X6199,0X619A,0X619B,0X619C,0X619E,0X619F,0X61A0,0X61A1,0X61A2,0X61A3,0X61A4,0X61A5,0X61A6,
-    0X61AA,0X61AB,0X61AD,0X61AE,0X61AF,0X61B0,0X61B1,0X61B2,0X61B3,0X61B4,0X61B5,0X61B6,0X61B8,0X61B9,0X61BA,0X61BB,
-    0X61BC,0X61BD,0X61BF,0X61C0,0X61C1,0X61C3,0X61C4,0X61C5,0X61C6,0X61C7,0X61C9,0X61CC,0X61CD,0X61CE,0X61CF,0X61D0,
-    0X61D3,0X61D5,0X61D6,0X61D7,0X61D8,0X61D9,0X61DA,0X61DB,0X61DC,0X61DD,0X61DE,0X61DF,0X61E0,0X61E1,0X61E2,0X61E3,
-    0X61E4,0X61E5,0X61E7,0X61E8,0X61E9,0X61EA,0X61EB,0X61EC,0X61ED,0X61EE,0X61EF,0X61F0,0X61F1,0X61F2,0X61F3,0X61F4,
-    0X61F6,0X61F7,0X61F8,0X61F9,0X61FA,0X61FB,0X61FC,0X61FD,0X61FE,0X6200,0X6201,0X6202,0X6203,0X6204,0X6205,0X6207,
-    0X6209,0X6213,0X6214,0X6219,0X621C,0X621D,0X621E,0X6220,0X6223,0X6226,0X6227,0X6228,0X6229,0X622B,0X622D,0X622F,
-    0X6230,0X6231,0X6232,0X6235,0X6236,0X6238,0X6239,0X623A,0X623B,0X623C,0X6242,0X6244,0X6245,0X6246,0X624A,0X0001,
-    0X624F,0X6250,0X6255,0X6256,0X6257,0X6259,0X625A,0X625C,0X625D,0X625E,0X625F,0X6260,0X6261,0X6262,0X6264,0X6265,
-    0X6268,0X6271,0X6272,0X6274,0X6275,0X6277,0X6278,0X627A,0X627B,0X627D,0X6281,0X6282,0X6283,0X6285,0X6286,0X6287,
-    0X6288,0X628B,0X628C,0X628D,0X628E,0X628F,0X6290,0X6294,0X6299,0X629C,0X629D,0X629E,0X62A3,0X62A6,0X62A7,0X62A9,
-    0X62AA,0X62AD,0X62AE,0X62AF,0X62B0,0X62B2,0X62B3,0X62B4,0X62B6,0X62B7,0X62B8,0X62BA,0X62BE,0X62C0,0X62C1,0X0001,
-    0X62C3,0X62CB,0X62CF,0X62D1,0X62D5,0X62DD,0X62DE,0X62E0,0X62E1,0X62E4,0X62EA,0X62EB,0X62F0,0X62F2,0X62F5,0X62F8,
-    0X62F9,0X62FA,0X62FB,0X6300,0X6303,0X6304,0X6305,0X6306,0X630A,0X630B,0X630C,0X630D,0X630F,0X6310,0X6312,0X6313,
-    0X6314,0X6315,0X6317,0X6318,0X6319,0X631C,0X6326,0X6327,0X6329,0X632C,0X632D,0X632E,0X6330,0X6331,0X6333,0X6334,
-    0X6335,0X6336,0X6337,0X6338,0X633B,0X633C,0X633E,0X633F,0X6340,0X6341,0X6344,0X6347,0X6348,0X634A,0X6351,0X6352,
-    0X6353,0X6354,0X6356,0X6357,0X6358,0X6359,0X635A,0X635B,0X635C,0X635D,0X6360,0X6364,0X6365,0X6366,0X6368,0X636A,
-    0X636B,0X636C,0X636F,0X6370,0X6372,0X6373,0X6374,0X6375,0X6378,0X6379,0X637C,0X637D,0X637E,0X637F,0X6381,0X6383,
-    0X6384,0X6385,0X6386,0X638B,0X638D,0X6391,0X6393,0X6394,0X6395,0X6397,0X6399,0X639A,0X639B,0X639C,0X639D,0X639E,
-    0X639F,0X63A1,0X63A4,0X63A6,0X63AB,0X63AF,0X63B1,0X63B2,0X63B5,0X63B6,0X63B9,0X63BB,0X63BD,0X63BF,0X63C0,0X0001,
-    0X63C1,0X63C2,0X63C3,0X63C5,0X63C7,0X63C8,0X63CA,0X63CB,0X63CC,0X63D1,0X63D3,0X63D4,0X63D5,0X63D7,0X63D8,0X63D9,
-    0X63DA,0X63DB,0X63DC,0X63DD,0X63DF,0X63E2,0X63E4,0X63E5,0X63E6,0X63E7,0X63E8,0X63EB,0X63EC,0X63EE,0X63EF,0X63F0,
-    0X63F1,0X63F3,0X63F5,0X63F7,0X63F9,0X63FA,0X63FB,0X63FC,0X63FE,0X6403,0X6404,0X6406,0X6407,0X6408,0X6409,0X640A,
-    0X640D,0X640E,0X6411,0X6412,0X6415,0X6416,0X6417,0X6418,0X6419,0X641A,0X641D,0X641F,0X6422,0X6423,0X6424,0X0001,
-    0X6425,0X6427,0X6428,0X6429,0X642B,0X642E,0X642F,0X6430,0X6431,0X6432,0X6433,0X6435,0X6436,0X6437,0X6438,0X6439,
-    0X643B,0X643C,0X643E,0X6440,0X6442,0X6443,0X6449,0X644B,0X644C,0X644D,0X644E,0X644F,0X6450,0X6451,0X6453,0X6455,
-    0X6456,0X6457,0X6459,0X645A,0X645B,0X645C,0X645D,0X645F,0X6460,0X6461,0X6462,0X6463,0X6464,0X6465,0X6466,0X6468,
-    0X646A,0X646B,0X646C,0X646E,0X646F,0X6470,0X6471,0X6472,0X6473,0X6474,0X6475,0X6476,0X6477,0X647B,0X647C,0X647D,
-    0X647E,0X647F,0X6480,0X6481,0X6483,0X6486,0X6488,0X6489,0X648A,0X648B,0X648C,0X648D,0X648E,0X648F,0X6490,0X6493,
-    0X6494,0X6497,0X6498,0X649A,0X649B,0X649C,0X649D,0X649F,0X64A0,0X64A1,0X64A2,0X64A3,0X64A5,0X64A6,0X64A7,0X64A8,
-    0X64AA,0X64AB,0X64AF,0X64B1,0X64B2,0X64B3,0X64B4,0X64B6,0X64B9,0X64BB,0X64BD,0X64BE,0X64BF,0X64C1,0X64C3,0X64C4,
-    0X64C6,0X64C7,0X64C8,0X64C9,0X64CA,0X64CB,0X64CC,0X64CF,0X64D1,0X64D3,0X64D4,0X64D5,0X64D6,0X64D9,0X64DA,0X0001,
-    0X64DB,0X64DC,0X64DD,0X64DF,0X64E0,0X64E1,0X64E3,0X64E5,0X64E7,0X64E8,0X64E9,0X64EA,0X64EB,0X64EC,0X64ED,0X64EE,
-    0X64EF,0X64F0,0X64F1,0X64F2,0X64F3,0X64F4,0X64F5,0X64F6,0X64F7,0X64F8,0X64F9,0X64FA,0X64FB,0X64FC,0X64FD,0X64FE,
-    0X64FF,0X6501,0X6502,0X6503,0X6504,0X6505,0X6506,0X6507,0X6508,0X650A,0X650B,0X650C,0X650D,0X650E,0X650F,0X6510,
-    0X6511,0X6513,0X6514,0X6515,0X6516,0X6517,0X6519,0X651A,0X651B,0X651C,0X651D,0X651E,0X651F,0X6520,0X6521,0X0001,
-    0X6522,0X6523,0X6524,0X6526,0X6527,0X6528,0X6529,0X652A,0X652C,0X652D,0X6530,0X6531,0X6532,0X6533,0X6537,0X653A,
-    0X653C,0X653D,0X6540,0X6541,0X6542,0X6543,0X6544,0X6546,0X6547,0X654A,0X654B,0X654D,0X654E,0X6550,0X6552,0X6553,
-    0X6554,0X6557,0X6558,0X655A,0X655C,0X655F,0X6560,0X6561,0X6564,0X6565,0X6567,0X6568,0X6569,0X656A,0X656D,0X656E,
-    0X656F,0X6571,0X6573,0X6575,0X6576,0X6578,0X6579,0X657A,0X657B,0X657C,0X657D,0X657E,0X657F,0X6580,0X6581,0X6582,
-    0X6583,0X6584,0X6585,0X6586,0X6588,0X6589,0X658A,0X658D,0X658E,0X658F,0X6592,0X6594,0X6595,0X6596,0X6598,0X659A,
-    0X659D,0X659E,0X65A0,0X65A2,0X65A3,0X65A6,0X65A8,0X65AA,0X65AC,0X65AE,0X65B1,0X65B2,0X65B3,0X65B4,0X65B5,0X65B6,
-    0X65B7,0X65B8,0X65BA,0X65BB,0X65BE,0X65BF,0X65C0,0X65C2,0X65C7,0X65C8,0X65C9,0X65CA,0X65CD,0X65D0,0X65D1,0X65D3,
-    0X65D4,0X65D5,0X65D8,0X65D9,0X65DA,0X65DB,0X65DC,0X65DD,0X65DE,0X65DF,0X65E1,0X65E3,0X65E4,0X65EA,0X65EB,0X0001,
-    0X65F2,0X65F3,0X65F4,0X65F5,0X65F8,0X65F9,0X65FB,0X65FC,0X65FD,0X65FE,0X65FF,0X6601,0X6604,0X6605,0X6607,0X6608,
-    0X6609,0X660B,0X660D,0X6610,0X6611,0X6612,0X6616,0X6617,0X6618,0X661A,0X661B,0X661C,0X661E,0X6621,0X6622,0X6623,
-    0X6624,0X6626,0X6629,0X662A,0X662B,0X662C,0X662E,0X6630,0X6632,0X6633,0X6637,0X6638,0X6639,0X663A,0X663B,0X663D,
-    0X663F,0X6640,0X6642,0X6644,0X6645,0X6646,0X6647,0X6648,0X6649,0X664A,0X664D,0X664E,0X6650,0X6651,0X6658,0X0001,
-    0X6659,0X665B,0X665C,0X665D,0X665E,0X6660,0X6662,0X6663,0X6665,0X6667,0X6669,0X666A,0X666B,0X666C,0X666D,0X6671,
-    0X6672,0X6673,0X6675,0X6678,0X6679,0X667B,0X667C,0X667D,0X667F,0X6680,0X6681,0X6683,0X6685,0X6686,0X6688,0X6689,
-    0X668A,0X668B,0X668D,0X668E,0X668F,0X6690,0X6692,0X6693,0X6694,0X6695,0X6698,0X6699,0X669A,0X669B,0X669C,0X669E,
-    0X669F,0X66A0,0X66A1,0X66A2,0X66A3,0X66A4,0X66A5,0X66A6,0X66A9,0X66AA,0X66AB,0X66AC,0X66AD,0X66AF,0X66B0,0X66B1,
-    0X66B2,0X66B3,0X66B5,0X66B6,0X66B7,0X66B8,0X66BA,0X66BB,0X66BC,0X66BD,0X66BF,0X66C0,0X66C1,0X66C2,0X66C3,0X66C4,
-    0X66C5,0X66C6,0X66C7,0X66C8,0X66C9,0X66CA,0X66CB,0X66CC,0X66CD,0X66CE,0X66CF,0X66D0,0X66D1,0X66D2,0X66D3,0X66D4,
-    0X66D5,0X66D6,0X66D7,0X66D8,0X66DA,0X66DE,0X66DF,0X66E0,0X66E1,0X66E2,0X66E3,0X66E4,0X66E5,0X66E7,0X66E8,0X66EA,
-    0X66EB,0X66EC,0X66ED,0X66EE,0X66EF,0X66F1,0X66F5,0X66F6,0X66F8,0X66FA,0X66FB,0X66FD,0X6701,0X6702,0X6703,0X0001,
-    0X6704,0X6705,0X6706,0X6707,0X670C,0X670E,0X670F,0X6711,0X6712,0X6713,0X6716,0X6718,0X6719,0X671A,0X671C,0X671E,
-    0X6720,0X6721,0X6722,0X6723,0X6724,0X6725,0X6727,0X6729,0X672E,0X6730,0X6732,0X6733,0X6736,0X6737,0X6738,0X6739,
-    0X673B,0X673C,0X673E,0X673F,0X6741,0X6744,0X6745,0X6747,0X674A,0X674B,0X674D,0X6752,0X6754,0X6755,0X6757,0X6758,
-    0X6759,0X675A,0X675B,0X675D,0X6762,0X6763,0X6764,0X6766,0X6767,0X676B,0X676C,0X676E,0X6771,0X6774,0X6776,0X0001,
-    0X6778,0X6779,0X677A,0X677B,0X677D,0X6780,0X6782,0X6783,0X6785,0X6786,0X6788,0X678A,0X678C,0X678D,0X678E,0X678F,
-    0X6791,0X6792,0X6793,0X6794,0X6796,0X6799,0X679B,0X679F,0X67A0,0X67A1,0X67A4,0X67A6,0X67A9,0X67AC,0X67AE,0X67B1,
-    0X67B2,0X67B4,0X67B9,0X67BA,0X67BB,0X67BC,0X67BD,0X67BE,0X67BF,0X67C0,0X67C2,0X67C5,0X67C6,0X67C7,0X67C8,0X67C9,
-    0X67CA,0X67CB,0X67CC,0X67CD,0X67CE,0X67D5,0X67D6,0X67D7,0X67DB,0X67DF,0X67E1,0X67E3,0X67E4,0X67E6,0X67E7,0X67E8,
-    0X67EA,0X67EB,0X67ED,0X67EE,0X67F2,0X67F5,0X67F6,0X67F7,0X67F8,0X67F9,0X67FA,0X67FB,0X67FC,0X67FE,0X6801,0X6802,
-    0X6803,0X6804,0X6806,0X680D,0X6810,0X6812,0X6814,0X6815,0X6818,0X6819,0X681A,0X681B,0X681C,0X681E,0X681F,0X6820,
-    0X6822,0X6823,0X6824,0X6825,0X6826,0X6827,0X6828,0X682B,0X682C,0X682D,0X682E,0X682F,0X6830,0X6831,0X6834,0X6835,
-    0X6836,0X683A,0X683B,0X683F,0X6847,0X684B,0X684D,0X684F,0X6852,0X6856,0X6857,0X6858,0X6859,0X685A,0X685B,0X0001,
-    0X685C,0X685D,0X685E,0X685F,0X686A,0X686C,0X686D,0X686E,0X686F,0X6870,0X6871,0X6872,0X6873,0X6875,0X6878,0X6879,
-    0X687A,0X687B,0X687C,0X687D,0X687E,0X687F,0X6880,0X6882,0X6884,0X6887,0X6888,0X6889,0X688A,0X688B,0X688C,0X688D,
-    0X688E,0X6890,0X6891,0X6892,0X6894,0X6895,0X6896,0X6898,0X6899,0X689A,0X689B,0X689C,0X689D,0X689E,0X689F,0X68A0,
-    0X68A1,0X68A3,0X68A4,0X68A5,0X68A9,0X68AA,0X68AB,0X68AC,0X68AE,0X68B1,0X68B2,0X68B4,0X68B6,0X68B7,0X68B8,0X0001,
-    0X68B9,0X68BA,0X68BB,0X68BC,0X68BD,0X68BE,0X68BF,0X68C1,0X68C3,0X68C4,0X68C5,0X68C6,0X68C7,0X68C8,0X68CA,0X68CC,
-    0X68CE,0X68CF,0X68D0,0X68D1,0X68D3,0X68D4,0X68D6,0X68D7,0X68D9,0X68DB,0X68DC,0X68DD,0X68DE,0X68DF,0X68E1,0X68E2,
-    0X68E4,0X68E5,0X68E6,0X68E7,0X68E8,0X68E9,0X68EA,0X68EB,0X68EC,0X68ED,0X68EF,0X68F2,0X68F3,0X68F4,0X68F6,0X68F7,
-    0X68F8,0X68FB,0X68FD,0X68FE,0X68FF,0X6900,0X6902,0X6903,0X6904,0X6906,0X6907,0X6908,0X6909,0X690A,0X690C,0X690F,
-    0X6911,0X6913,0X6914,0X6915,0X6916,0X6917,0X6918,0X6919,0X691A,0X691B,0X691C,0X691D,0X691E,0X6921,0X6922,0X6923,
-    0X6925,0X6926,0X6927,0X6928,0X6929,0X692A,0X692B,0X692C,0X692E,0X692F,0X6931,0X6932,0X6933,0X6935,0X6936,0X6937,
-    0X6938,0X693A,0X693B,0X693C,0X693E,0X6940,0X6941,0X6943,0X6944,0X6945,0X6946,0X6947,0X6948,0X6949,0X694A,0X694B,
-    0X694C,0X694D,0X694E,0X694F,0X6950,0X6951,0X6952,0X6953,0X6955,0X6956,0X6958,0X6959,0X695B,0X695C,0X695F,0X0001,
-    0X6961,0X6962,0X6964,0X6965,0X6967,0X6968,0X6969,0X696A,0X696C,0X696D,0X696F,0X6970,0X6972,0X6973,0X6974,0X6975,
-    0X6976,0X697A,0X697B,0X697D,0X697E,0X697F,0X6981,0X6983,0X6985,0X698A,0X698B,0X698C,0X698E,0X698F,0X6990,0X6991,
-    0X6992,0X6993,0X6996,0X6997,0X6999,0X699A,0X699D,0X699E,0X699F,0X69A0,0X69A1,0X69A2,0X69A3,0X69A4,0X69A5,0X69A6,
-    0X69A9,0X69AA,0X69AC,0X69AE,0X69AF,0X69B0,0X69B2,0X69B3,0X69B5,0X69B6,0X69B8,0X69B9,0X69BA,0X69BC,0X69BD,0X0001,
-    0X69BE,0X69BF,0X69C0,0X69C2,0X69C3,0X69C4,0X69C5,0X69C6,0X69C7,0X69C8,0X69C9,0X69CB,0X69CD,0X69CF,0X69D1,0X69D2,
-    0X69D3,0X69D5,0X69D6,0X69D7,0X69D8,0X69D9,0X69DA,0X69DC,0X69DD,0X69DE,0X69E1,0X69E2,0X69E3,0X69E4,0X69E5,0X69E6,
-    0X69E7,0X69E8,0X69E9,0X69EA,0X69EB,0X69EC,0X69EE,0X69EF,0X69F0,0X69F1,0X69F3,0X69F4,0X69F5,0X69F6,0X69F7,0X69F8,
-    0X69F9,0X69FA,0X69FB,0X69FC,0X69FE,0X6A00,0X6A01,0X6A02,0X6A03,0X6A04,0X6A05,0X6A06,0X6A07,0X6A08,0X6A09,0X6A0B,
-    0X6A0C,0X6A0D,0X6A0E,0X6A0F,0X6A10,0X6A11,0X6A12,0X6A13,0X6A14,0X6A15,0X6A16,0X6A19,0X6A1A,0X6A1B,0X6A1C,0X6A1D,
-    0X6A1E,0X6A20,0X6A22,0X6A23,0X6A24,0X6A25,0X6A26,0X6A27,0X6A29,0X6A2B,0X6A2C,0X6A2D,0X6A2E,0X6A30,0X6A32,0X6A33,
-    0X6A34,0X6A36,0X6A37,0X6A38,0X6A39,0X6A3A,0X6A3B,0X6A3C,0X6A3F,0X6A40,0X6A41,0X6A42,0X6A43,0X6A45,0X6A46,0X6A48,
-    0X6A49,0X6A4A,0X6A4B,0X6A4C,0X6A4D,0X6A4E,0X6A4F,0X6A51,0X6A52,0X6A53,0X6A54,0X6A55,0X6A56,0X6A57,0X6A5A,0X0001,
-    0X6A5C,0X6A5D,0X6A5E,0X6A5F,0X6A60,0X6A62,0X6A63,0X6A64,0X6A66,0X6A67,0X6A68,0X6A69,0X6A6A,0X6A6B,0X6A6C,0X6A6D,
-    0X6A6E,0X6A6F,0X6A70,0X6A72,0X6A73,0X6A74,0X6A75,0X6A76,0X6A77,0X6A78,0X6A7A,0X6A7B,0X6A7D,0X6A7E,0X6A7F,0X6A81,
-    0X6A82,0X6A83,0X6A85,0X6A86,0X6A87,0X6A88,0X6A89,0X6A8A,0X6A8B,0X6A8C,0X6A8D,0X6A8F,0X6A92,0X6A93,0X6A94,0X6A95,
-    0X6A96,0X6A98,0X6A99,0X6A9A,0X6A9B,0X6A9C,0X6A9D,0X6A9E,0X6A9F,0X6AA1,0X6AA2,0X6AA3,0X6AA4,0X6AA5,0X6AA6,0X0001,
-    0X6AA7,0X6AA8,0X6AAA,0X6AAD,0X6AAE,0X6AAF,0X6AB0,0X6AB1,0X6AB2,0X6AB3,0X6AB4,0X6AB5,0X6AB6,0X6AB7,0X6AB8,0X6AB9,
-    0X6ABA,0X6ABB,0X6ABC,0X6ABD,0X6ABE,0X6ABF,0X6AC0,0X6AC1,0X6AC2,0X6AC3,0X6AC4,0X6AC5,0X6AC6,0X6AC7,0X6AC8,0X6AC9,
-    0X6ACA,0X6ACB,0X6ACC,0X6ACD,0X6ACE,0X6ACF,0X6AD0,0X6AD1,0X6AD2,0X6AD3,0X6AD4,0X6AD5,0X6AD6,0X6AD7,0X6AD8,0X6AD9,
-    0X6ADA,0X6ADB,0X6ADC,0X6ADD,0X6ADE,0X6ADF,0X6AE0,0X6AE1,0X6AE2,0X6AE3,0X6AE4,0X6AE5,0X6AE6,0X6AE7,0X6AE8,0X6AE9,
-    0X6AEA,0X6AEB,0X6AEC,0X6AED,0X6AEE,0X6AEF,0X6AF0,0X6AF1,0X6AF2,0X6AF3,0X6AF4,0X6AF5,0X6AF6,0X6AF7,0X6AF8,0X6AF9,
-    0X6AFA,0X6AFB,0X6AFC,0X6AFD,0X6AFE,0X6AFF,0X6B00,0X6B01,0X6B02,0X6B03,0X6B04,0X6B05,0X6B06,0X6B07,0X6B08,0X6B09,
-    0X6B0A,0X6B0B,0X6B0C,0X6B0D,0X6B0E,0X6B0F,0X6B10,0X6B11,0X6B12,0X6B13,0X6B14,0X6B15,0X6B16,0X6B17,0X6B18,0X6B19,
-    0X6B1A,0X6B1B,0X6B1C,0X6B1D,0X6B1E,0X6B1F,0X6B25,0X6B26,0X6B28,0X6B29,0X6B2A,0X6B2B,0X6B2C,0X6B2D,0X6B2E,0X0001,
-    0X6B2F,0X6B30,0X6B31,0X6B33,0X6B34,0X6B35,0X6B36,0X6B38,0X6B3B,0X6B3C,0X6B3D,0X6B3F,0X6B40,0X6B41,0X6B42,0X6B44,
-    0X6B45,0X6B48,0X6B4A,0X6B4B,0X6B4D,0X6B4E,0X6B4F,0X6B50,0X6B51,0X6B52,0X6B53,0X6B54,0X6B55,0X6B56,0X6B57,0X6B58,
-    0X6B5A,0X6B5B,0X6B5C,0X6B5D,0X6B5E,0X6B5F,0X6B60,0X6B61,0X6B68,0X6B69,0X6B6B,0X6B6C,0X6B6D,0X6B6E,0X6B6F,0X6B70,
-    0X6B71,0X6B72,0X6B73,0X6B74,0X6B75,0X6B76,0X6B77,0X6B78,0X6B7A,0X6B7D,0X6B7E,0X6B7F,0X6B80,0X6B85,0X6B88,0X0001,
-    0X6B8C,0X6B8E,0X6B8F,0X6B90,0X6B91,0X6B94,0X6B95,0X6B97,0X6B98,0X6B99,0X6B9C,0X6B9D,0X6B9E,0X6B9F,0X6BA0,0X6BA2,
-    0X6BA3,0X6BA4,0X6BA5,0X6BA6,0X6BA7,0X6BA8,0X6BA9,0X6BAB,0X6BAC,0X6BAD,0X6BAE,0X6BAF,0X6BB0,0X6BB1,0X6BB2,0X6BB6,
-    0X6BB8,0X6BB9,0X6BBA,0X6BBB,0X6BBC,0X6BBD,0X6BBE,0X6BC0,0X6BC3,0X6BC4,0X6BC6,0X6BC7,0X6BC8,0X6BC9,0X6BCA,0X6BCC,
-    0X6BCE,0X6BD0,0X6BD1,0X6BD8,0X6BDA,0X6BDC,0X6BDD,0X6BDE,0X6BDF,0X6BE0,0X6BE2,0X6BE3,0X6BE4,0X6BE5,0X6BE6,0X6BE7,
-    0X6BE8,0X6BE9,0X6BEC,0X6BED,0X6BEE,0X6BF0,0X6BF1,0X6BF2,0X6BF4,0X6BF6,0X6BF7,0X6BF8,0X6BFA,0X6BFB,0X6BFC,0X6BFE,
-    0X6BFF,0X6C00,0X6C01,0X6C02,0X6C03,0X6C04,0X6C08,0X6C09,0X6C0A,0X6C0B,0X6C0C,0X6C0E,0X6C12,0X6C17,0X6C1C,0X6C1D,
-    0X6C1E,0X6C20,0X6C23,0X6C25,0X6C2B,0X6C2C,0X6C2D,0X6C31,0X6C33,0X6C36,0X6C37,0X6C39,0X6C3A,0X6C3B,0X6C3C,0X6C3E,
-    0X6C3F,0X6C43,0X6C44,0X6C45,0X6C48,0X6C4B,0X6C4C,0X6C4D,0X6C4E,0X6C4F,0X6C51,0X6C52,0X6C53,0X6C56,0X6C58,0X0001,
-    0X6C59,0X6C5A,0X6C62,0X6C63,0X6C65,0X6C66,0X6C67,0X6C6B,0X6C6C,0X6C6D,0X6C6E,0X6C6F,0X6C71,0X6C73,0X6C75,0X6C77,
-    0X6C78,0X6C7A,0X6C7B,0X6C7C,0X6C7F,0X6C80,0X6C84,0X6C87,0X6C8A,0X6C8B,0X6C8D,0X6C8E,0X6C91,0X6C92,0X6C95,0X6C96,
-    0X6C97,0X6C98,0X6C9A,0X6C9C,0X6C9D,0X6C9E,0X6CA0,0X6CA2,0X6CA8,0X6CAC,0X6CAF,0X6CB0,0X6CB4,0X6CB5,0X6CB6,0X6CB7,
-    0X6CBA,0X6CC0,0X6CC1,0X6CC2,0X6CC3,0X6CC6,0X6CC7,0X6CC8,0X6CCB,0X6CCD,0X6CCE,0X6CCF,0X6CD1,0X6CD2,0X6CD8,0X0001,
-    0X6CD9,0X6CDA,0X6CDC,0X6CDD,0X6CDF,0X6CE4,0X6CE6,0X6CE7,0X6CE9,0X6CEC,0X6CED,0X6CF2,0X6CF4,0X6CF9,0X6CFF,0X6D00,
-    0X6D02,0X6D03,0X6D05,0X6D06,0X6D08,0X6D09,0X6D0A,0X6D0D,0X6D0F,0X6D10,0X6D11,0X6D13,0X6D14,0X6D15,0X6D16,0X6D18,
-    0X6D1C,0X6D1D,0X6D1F,0X6D20,0X6D21,0X6D22,0X6D23,0X6D24,0X6D26,0X6D28,0X6D29,0X6D2C,0X6D2D,0X6D2F,0X6D30,0X6D34,
-    0X6D36,0X6D37,0X6D38,0X6D3A,0X6D3F,0X6D40,0X6D42,0X6D44,0X6D49,0X6D4C,0X6D50,0X6D55,0X6D56,0X6D57,0X6D58,0X6D5B,
-    0X6D5D,0X6D5F,0X6D61,0X6D62,0X6D64,0X6D65,0X6D67,0X6D68,0X6D6B,0X6D6C,0X6D6D,0X6D70,0X6D71,0X6D72,0X6D73,0X6D75,
-    0X6D76,0X6D79,0X6D7A,0X6D7B,0X6D7D,0X6D7E,0X6D7F,0X6D80,0X6D81,0X6D83,0X6D84,0X6D86,0X6D87,0X6D8A,0X6D8B,0X6D8D,
-    0X6D8F,0X6D90,0X6D92,0X6D96,0X6D97,0X6D98,0X6D99,0X6D9A,0X6D9C,0X6DA2,0X6DA5,0X6DAC,0X6DAD,0X6DB0,0X6DB1,0X6DB3,
-    0X6DB4,0X6DB6,0X6DB7,0X6DB9,0X6DBA,0X6DBB,0X6DBC,0X6DBD,0X6DBE,0X6DC1,0X6DC2,0X6DC3,0X6DC8,0X6DC9,0X6DCA,0X0001,
-    0X6DCD,0X6DCE,0X6DCF,0X6DD0,0X6DD2,0X6DD3,0X6DD4,0X6DD5,0X6DD7,0X6DDA,0X6DDB,0X6DDC,0X6DDF,0X6DE2,0X6DE3,0X6DE5,
-    0X6DE7,0X6DE8,0X6DE9,0X6DEA,0X6DED,0X6DEF,0X6DF0,0X6DF2,0X6DF4,0X6DF5,0X6DF6,0X6DF8,0X6DFA,0X6DFD,0X6DFE,0X6DFF,
-    0X6E00,0X6E01,0X6E02,0X6E03,0X6E04,0X6E06,0X6E07,0X6E08,0X6E09,0X6E0B,0X6E0F,0X6E12,0X6E13,0X6E15,0X6E18,0X6E19,
-    0X6E1B,0X6E1C,0X6E1E,0X6E1F,0X6E22,0X6E26,0X6E27,0X6E28,0X6E2A,0X6E2C,0X6E2E,0X6E30,0X6E31,0X6E33,0X6E35,0X0001,
-    0X6E36,0X6E37,0X6E39,0X6E3B,0X6E3C,0X6E3D,0X6E3E,0X6E3F,0X6E40,0X6E41,0X6E42,0X6E45,0X6E46,0X6E47,0X6E48,0X6E49,
-    0X6E4A,0X6E4B,0X6E4C,0X6E4F,0X6E50,0X6E51,0X6E52,0X6E55,0X6E57,0X6E59,0X6E5A,0X6E5C,0X6E5D,0X6E5E,0X6E60,0X6E61,
-    0X6E62,0X6E63,0X6E64,0X6E65,0X6E66,0X6E67,0X6E68,0X6E69,0X6E6A,0X6E6C,0X6E6D,0X6E6F,0X6E70,0X6E71,0X6E72,0X6E73,
-    0X6E74,0X6E75,0X6E76,0X6E77,0X6E78,0X6E79,0X6E7A,0X6E7B,0X6E7C,0X6E7D,0X6E80,0X6E81,0X6E82,0X6E84,0X6E87,0X6E88,
-    0X6E8A,0X6E8B,0X6E8C,0X6E8D,0X6E8E,0X6E91,0X6E92,0X6E93,0X6E94,0X6E95,0X6E96,0X6E97,0X6E99,0X6E9A,0X6E9B,0X6E9D,
-    0X6E9E,0X6EA0,0X6EA1,0X6EA3,0X6EA4,0X6EA6,0X6EA8,0X6EA9,0X6EAB,0X6EAC,0X6EAD,0X6EAE,0X6EB0,0X6EB3,0X6EB5,0X6EB8,
-    0X6EB9,0X6EBC,0X6EBE,0X6EBF,0X6EC0,0X6EC3,0X6EC4,0X6EC5,0X6EC6,0X6EC8,0X6EC9,0X6ECA,0X6ECC,0X6ECD,0X6ECE,0X6ED0,
-    0X6ED2,0X6ED6,0X6ED8,0X6ED9,0X6EDB,0X6EDC,0X6EDD,0X6EE3,0X6EE7,0X6EEA,0X6EEB,0X6EEC,0X6EED,0X6EEE,0X6EEF,0X0001,
-    0X6EF0,0X6EF1,0X6EF2,0X6EF3,0X6EF5,0X6EF6,0X6EF7,0X6EF8,0X6EFA,0X6EFB,0X6EFC,0X6EFD,0X6EFE,0X6EFF,0X6F00,0X6F01,
-    0X6F03,0X6F04,0X6F05,0X6F07,0X6F08,0X6F0A,0X6F0B,0X6F0C,0X6F0D,0X6F0E,0X6F10,0X6F11,0X6F12,0X6F16,0X6F17,0X6F18,
-    0X6F19,0X6F1A,0X6F1B,0X6F1C,0X6F1D,0X6F1E,0X6F1F,0X6F21,0X6F22,0X6F23,0X6F25,0X6F26,0X6F27,0X6F28,0X6F2C,0X6F2E,
-    0X6F30,0X6F32,0X6F34,0X6F35,0X6F37,0X6F38,0X6F39,0X6F3A,0X6F3B,0X6F3C,0X6F3D,0X6F3F,0X6F40,0X6F41,0X6F42,0X0001,
-    0X6F43,0X6F44,0X6F45,0X6F48,0X6F49,0X6F4A,0X6F4C,0X6F4E,0X6F4F,0X6F50,0X6F51,0X6F52,0X6F53,0X6F54,0X6F55,0X6F56,
-    0X6F57,0X6F59,0X6F5A,0X6F5B,0X6F5D,0X6F5F,0X6F60,0X6F61,0X6F63,0X6F64,0X6F65,0X6F67,0X6F68,0X6F69,0X6F6A,0X6F6B,
-    0X6F6C,0X6F6F,0X6F70,0X6F71,0X6F73,0X6F75,0X6F76,0X6F77,0X6F79,0X6F7B,0X6F7D,0X6F7E,0X6F7F,0X6F80,0X6F81,0X6F82,
-    0X6F83,0X6F85,0X6F86,0X6F87,0X6F8A,0X6F8B,0X6F8F,0X6F90,0X6F91,0X6F92,0X6F93,0X6F94,0X6F95,0X6F96,0X6F97,0X6F98,
-    0X6F99,0X6F9A,0X6F9B,0X6F9D,0X6F9E,0X6F9F,0X6FA0,0X6FA2,0X6FA3,0X6FA4,0X6FA5,0X6FA6,0X6FA8,0X6FA9,0X6FAA,0X6FAB,
-    0X6FAC,0X6FAD,0X6FAE,0X6FAF,0X6FB0,0X6FB1,0X6FB2,0X6FB4,0X6FB5,0X6FB7,0X6FB8,0X6FBA,0X6FBB,0X6FBC,0X6FBD,0X6FBE,
-    0X6FBF,0X6FC1,0X6FC3,0X6FC4,0X6FC5,0X6FC6,0X6FC7,0X6FC8,0X6FCA,0X6FCB,0X6FCC,0X6FCD,0X6FCE,0X6FCF,0X6FD0,0X6FD3,
-    0X6FD4,0X6FD5,0X6FD6,0X6FD7,0X6FD8,0X6FD9,0X6FDA,0X6FDB,0X6FDC,0X6FDD,0X6FDF,0X6FE2,0X6FE3,0X6FE4,0X6FE5,0X0001,
-    0X6FE6,0X6FE7,0X6FE8,0X6FE9,0X6FEA,0X6FEB,0X6FEC,0X6FED,0X6FF0,0X6FF1,0X6FF2,0X6FF3,0X6FF4,0X6FF5,0X6FF6,0X6FF7,
-    0X6FF8,0X6FF9,0X6FFA,0X6FFB,0X6FFC,0X6FFD,0X6FFE,0X6FFF,0X7000,0X7001,0X7002,0X7003,0X7004,0X7005,0X7006,0X7007,
-    0X7008,0X7009,0X700A,0X700B,0X700C,0X700D,0X700E,0X700F,0X7010,0X7012,0X7013,0X7014,0X7015,0X7016,0X7017,0X7018,
-    0X7019,0X701C,0X701D,0X701E,0X701F,0X7020,0X7021,0X7022,0X7024,0X7025,0X7026,0X7027,0X7028,0X7029,0X702A,0X0001,
-    0X702B,0X702C,0X702D,0X702E,0X702F,0X7030,0X7031,0X7032,0X7033,0X7034,0X7036,0X7037,0X7038,0X703A,0X703B,0X703C,
-    0X703D,0X703E,0X703F,0X7040,0X7041,0X7042,0X7043,0X7044,0X7045,0X7046,0X7047,0X7048,0X7049,0X704A,0X704B,0X704D,
-    0X704E,0X7050,0X7051,0X7052,0X7053,0X7054,0X7055,0X7056,0X7057,0X7058,0X7059,0X705A,0X705B,0X705C,0X705D,0X705F,
-    0X7060,0X7061,0X7062,0X7063,0X7064,0X7065,0X7066,0X7067,0X7068,0X7069,0X706A,0X706E,0X7071,0X7072,0X7073,0X7074,
-    0X7077,0X7079,0X707A,0X707B,0X707D,0X7081,0X7082,0X7083,0X7084,0X7086,0X7087,0X7088,0X708B,0X708C,0X708D,0X708F,
-    0X7090,0X7091,0X7093,0X7097,0X7098,0X709A,0X709B,0X709E,0X709F,0X70A0,0X70A1,0X70A2,0X70A3,0X70A4,0X70A5,0X70A6,
-    0X70A7,0X70A8,0X70A9,0X70AA,0X70B0,0X70B2,0X70B4,0X70B5,0X70B6,0X70BA,0X70BE,0X70BF,0X70C4,0X70C5,0X70C6,0X70C7,
-    0X70C9,0X70CB,0X70CC,0X70CD,0X70CE,0X70CF,0X70D0,0X70D1,0X70D2,0X70D3,0X70D4,0X70D5,0X70D6,0X70D7,0X70DA,0X0001,
-    0X70DC,0X70DD,0X70DE,0X70E0,0X70E1,0X70E2,0X70E3,0X70E5,0X70EA,0X70EE,0X70F0,0X70F1,0X70F2,0X70F3,0X70F4,0X70F5,
-    0X70F6,0X70F8,0X70FA,0X70FB,0X70FC,0X70FE,0X70FF,0X7100,0X7101,0X7102,0X7103,0X7104,0X7105,0X7106,0X7107,0X7108,
-    0X710B,0X710C,0X710D,0X710E,0X710F,0X7111,0X7112,0X7114,0X7117,0X711B,0X711C,0X711D,0X711E,0X711F,0X7120,0X7121,
-    0X7122,0X7123,0X7124,0X7125,0X7127,0X7128,0X7129,0X712A,0X712B,0X712C,0X712D,0X712E,0X7132,0X7133,0X7134,0X0001,
-    0X7135,0X7137,0X7138,0X7139,0X713A,0X713B,0X713C,0X713D,0X713E,0X713F,0X7140,0X7141,0X7142,0X7143,0X7144,0X7146,
-    0X7147,0X7148,0X7149,0X714B,0X714D,0X714F,0X7150,0X7151,0X7152,0X7153,0X7154,0X7155,0X7156,0X7157,0X7158,0X7159,
-    0X715A,0X715B,0X715D,0X715F,0X7160,0X7161,0X7162,0X7163,0X7165,0X7169,0X716A,0X716B,0X716C,0X716D,0X716F,0X7170,
-    0X7171,0X7174,0X7175,0X7176,0X7177,0X7179,0X717B,0X717C,0X717E,0X717F,0X7180,0X7181,0X7182,0X7183,0X7185,0X7186,
-    0X7187,0X7188,0X7189,0X718B,0X718C,0X718D,0X718E,0X7190,0X7191,0X7192,0X7193,0X7195,0X7196,0X7197,0X719A,0X719B,
-    0X719C,0X719D,0X719E,0X71A1,0X71A2,0X71A3,0X71A4,0X71A5,0X71A6,0X71A7,0X71A9,0X71AA,0X71AB,0X71AD,0X71AE,0X71AF,
-    0X71B0,0X71B1,0X71B2,0X71B4,0X71B6,0X71B7,0X71B8,0X71BA,0X71BB,0X71BC,0X71BD,0X71BE,0X71BF,0X71C0,0X71C1,0X71C2,
-    0X71C4,0X71C5,0X71C6,0X71C7,0X71C8,0X71C9,0X71CA,0X71CB,0X71CC,0X71CD,0X71CF,0X71D0,0X71D1,0X71D2,0X71D3,0X0001,
-    0X71D6,0X71D7,0X71D8,0X71D9,0X71DA,0X71DB,0X71DC,0X71DD,0X71DE,0X71DF,0X71E1,0X71E2,0X71E3,0X71E4,0X71E6,0X71E8,
-    0X71E9,0X71EA,0X71EB,0X71EC,0X71ED,0X71EF,0X71F0,0X71F1,0X71F2,0X71F3,0X71F4,0X71F5,0X71F6,0X71F7,0X71F8,0X71FA,
-    0X71FB,0X71FC,0X71FD,0X71FE,0X71FF,0X7200,0X7201,0X7202,0X7203,0X7204,0X7205,0X7207,0X7208,0X7209,0X720A,0X720B,
-    0X720C,0X720D,0X720E,0X720F,0X7210,0X7211,0X7212,0X7213,0X7214,0X7215,0X7216,0X7217,0X7218,0X7219,0X721A,0X0001,
-    0X721B,0X721C,0X721E,0X721F,0X7220,0X7221,0X7222,0X7223,0X7224,0X7225,0X7226,0X7227,0X7229,0X722B,0X722D,0X722E,
-    0X722F,0X7232,0X7233,0X7234,0X723A,0X723C,0X723E,0X7240,0X7241,0X7242,0X7243,0X7244,0X7245,0X7246,0X7249,0X724A,
-    0X724B,0X724E,0X724F,0X7250,0X7251,0X7253,0X7254,0X7255,0X7257,0X7258,0X725A,0X725C,0X725E,0X7260,0X7263,0X7264,
-    0X7265,0X7268,0X726A,0X726B,0X726C,0X726D,0X7270,0X7271,0X7273,0X7274,0X7276,0X7277,0X7278,0X727B,0X727C,0X727D,
-    0X7282,0X7283,0X7285,0X7286,0X7287,0X7288,0X7289,0X728C,0X728E,0X7290,0X7291,0X7293,0X7294,0X7295,0X7296,0X7297,
-    0X7298,0X7299,0X729A,0X729B,0X729C,0X729D,0X729E,0X72A0,0X72A1,0X72A2,0X72A3,0X72A4,0X72A5,0X72A6,0X72A7,0X72A8,
-    0X72A9,0X72AA,0X72AB,0X72AE,0X72B1,0X72B2,0X72B3,0X72B5,0X72BA,0X72BB,0X72BC,0X72BD,0X72BE,0X72BF,0X72C0,0X72C5,
-    0X72C6,0X72C7,0X72C9,0X72CA,0X72CB,0X72CC,0X72CF,0X72D1,0X72D3,0X72D4,0X72D5,0X72D6,0X72D8,0X72DA,0X72DB,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X3000,0X3001,0X3002,0X00B7,0X02C9,0X02C7,0X00A8,0X3003,0X3005,0X2014,0XFF5E,0X2016,0X2026,0X2018,0X2019,
-    0X201C,0X201D,0X3014,0X3015,0X3008,0X3009,0X300A,0X300B,0X300C,0X300D,0X300E,0X300F,0X3016,0X3017,0X3010,0X3011,
-    0X00B1,0X00D7,0X00F7,0X2236,0X2227,0X2228,0X2211,0X220F,0X222A,0X2229,0X2208,0X2237,0X221A,0X22A5,0X2225,0X2220,
-    0X2312,0X2299,0X222B,0X222E,0X2261,0X224C,0X2248,0X223D,0X221D,0X2260,0X226E,0X226F,0X2264,0X2265,0X221E,0X2235,
-    0X2234,0X2642,0X2640,0X00B0,0X2032,0X2033,0X2103,0XFF04,0X00A4,0XFFE0,0XFFE1,0X2030,0X00A7,0X2116,0X2606,0X2605,
-    0X25CB,0X25CF,0X25CE,0X25C7,0X25C6,0X25A1,0X25A0,0X25B3,0X25B2,0X203B,0X2192,0X2190,0X2191,0X2193,0X3013,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X2170,0X2171,0X2172,0X2173,0X2174,0X2175,0X2176,0X2177,0X2178,0X2179,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X2488,0X2489,0X248A,0X248B,0X248C,0X248D,0X248E,0X248F,0X2490,0X2491,0X2492,0X2493,0X2494,0X2495,0X2496,
-    0X2497,0X2498,0X2499,0X249A,0X249B,0X2474,0X2475,0X2476,0X2477,0X2478,0X2479,0X247A,0X247B,0X247C,0X247D,0X247E,
-    0X247F,0X2480,0X2481,0X2482,0X2483,0X2484,0X2485,0X2486,0X2487,0X2460,0X2461,0X2462,0X2463,0X2464,0X2465,0X2466,
-    0X2467,0X2468,0X2469,0X0001,0X0001,0X3220,0X3221,0X3222,0X3223,0X3224,0X3225,0X3226,0X3227,0X3228,0X3229,0X0001,
-    0X0001,0X2160,0X2161,0X2162,0X2163,0X2164,0X2165,0X2166,0X2167,0X2168,0X2169,0X216A,0X216B,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0XFF01,0XFF02,0XFF03,0XFFE5,0XFF05,0XFF06,0XFF07,0XFF08,0XFF09,0XFF0A,0XFF0B,0XFF0C,0XFF0D,0XFF0E,0XFF0F,
-    0XFF10,0XFF11,0XFF12,0XFF13,0XFF14,0XFF15,0XFF16,0XFF17,0XFF18,0XFF19,0XFF1A,0XFF1B,0XFF1C,0XFF1D,0XFF1E,0XFF1F,
-    0XFF20,0XFF21,0XFF22,0XFF23,0XFF24,0XFF25,0XFF26,0XFF27,0XFF28,0XFF29,0XFF2A,0XFF2B,0XFF2C,0XFF2D,0XFF2E,0XFF2F,
-    0XFF30,0XFF31,0XFF32,0XFF33,0XFF34,0XFF35,0XFF36,0XFF37,0XFF38,0XFF39,0XFF3A,0XFF3B,0XFF3C,0XFF3D,0XFF3E,0XFF3F,
-    0XFF40,0XFF41,0XFF42,0XFF43,0XFF44,0XFF45,0XFF46,0XFF47,0XFF48,0XFF49,0XFF4A,0XFF4B,0XFF4C,0XFF4D,0XFF4E,0XFF4F,
-    0XFF50,0XFF51,0XFF52,0XFF53,0XFF54,0XFF55,0XFF56,0XFF57,0XFF58,0XFF59,0XFF5A,0XFF5B,0XFF5C,0XFF5D,0XFFE3,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X3041,0X3042,0X3043,0X3044,0X3045,0X3046,0X3047,0X3048,0X3049,0X304A,0X304B,0X304C,0X304D,0X304E,0X304F,
-    0X3050,0X3051,0X3052,0X3053,0X3054,0X3055,0X3056,0X3057,0X3058,0X3059,0X305A,0X305B,0X305C,0X305D,0X305E,0X305F,
-    0X3060,0X3061,0X3062,0X3063,0X3064,0X3065,0X3066,0X3067,0X3068,0X3069,0X306A,0X306B,0X306C,0X306D,0X306E,0X306F,
-    0X3070,0X3071,0X3072,0X3073,0X3074,0X3075,0X3076,0X3077,0X3078,0X3079,0X307A,0X307B,0X307C,0X307D,0X307E,0X307F,
-    0X3080,0X3081,0X3082,0X3083,0X3084,0X3085,0X3086,0X3087,0X3088,0X3089,0X308A,0X308B,0X308C,0X308D,0X308E,0X308F,
-    0X3090,0X3091,0X3092,0X3093,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X30A1,0X30A2,0X30A3,0X30A4,0X30A5,0X30A6,0X30A7,0X30A8,0X30A9,0X30AA,0X30AB,0X30AC,0X30AD,0X30AE,0X30AF,
-    0X30B0,0X30B1,0X30B2,0X30B3,0X30B4,0X30B5,0X30B6,0X30B7,0X30B8,0X30B9,0X30BA,0X30BB,0X30BC,0X30BD,0X30BE,0X30BF,
-    0X30C0,0X30C1,0X30C2,0X30C3,0X30C4,0X30C5,0X30C6,0X30C7,0X30C8,0X30C9,0X30CA,0X30CB,0X30CC,0X30CD,0X30CE,0X30CF,
-    0X30D0,0X30D1,0X30D2,0X30D3,0X30D4,0X30D5,0X30D6,0X30D7,0X30D8,0X30D9,0X30DA,0X30DB,0X30DC,0X30DD,0X30DE,0X30DF,
-    0X30E0,0X30E1,0X30E2,0X30E3,0X30E4,0X30E5,0X30E6,0X30E7,0X30E8,0X30E9,0X30EA,0X30EB,0X30EC,0X30ED,0X30EE,0X30EF,
-    0X30F0,0X30F1,0X30F2,0X30F3,0X30F4,0X30F5,0X30F6,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0391,0X0392,0X0393,0X0394,0X0395,0X0396,0X0397,0X0398,0X0399,0X039A,0X039B,0X039C,0X039D,0X039E,0X039F,
-    0X03A0,0X03A1,0X03A3,0X03A4,0X03A5,0X03A6,0X03A7,0X03A8,0X03A9,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X03B1,0X03B2,0X03B3,0X03B4,0X03B5,0X03B6,0X03B7,0X03B8,0X03B9,0X03BA,0X03BB,0X03BC,0X03BD,0X03BE,0X03BF,
-    0X03C0,0X03C1,0X03C3,0X03C4,0X03C5,0X03C6,0X03C7,0X03C8,0X03C9,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0XFE35,0XFE36,0XFE39,0XFE3A,0XFE3F,0XFE40,0XFE3D,0XFE3E,0XFE41,0XFE42,0XFE43,0XFE44,0X0001,0X0001,0XFE3B,0XFE3C,
-    0XFE37,0XFE38,0XFE31,0X0001,0XFE33,0XFE34,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0410,0X0411,0X0412,0X0413,0X0414,0X0415,0X0401,0X0416,0X0417,0X0418,0X0419,0X041A,0X041B,0X041C,0X041D,
-    0X041E,0X041F,0X0420,0X0421,0X0422,0X0423,0X0424,0X0425,0X0426,0X0427,0X0428,0X0429,0X042A,0X042B,0X042C,0X042D,
-    0X042E,0X042F,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0430,0X0431,0X0432,0X0433,0X0434,0X0435,0X0451,0X0436,0X0437,0X0438,0X0439,0X043A,0X043B,0X043C,0X043D,
-    0X043E,0X043F,0X0440,0X0441,0X0442,0X0443,0X0444,0X0445,0X0446,0X0447,0X0448,0X0449,0X044A,0X044B,0X044C,0X044D,
-    0X044E,0X044F,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X02CA,0X02CB,0X02D9,0X2013,0X2015,0X2025,0X2035,0X2105,0X2109,0X2196,0X2197,0X2198,0X2199,0X2215,0X221F,0X2223,
-    0X2252,0X2266,0X2267,0X22BF,0X2550,0X2551,0X2552,0X2553,0X2554,0X2555,0X2556,0X2557,0X2558,0X2559,0X255A,0X255B,
-    0X255C,0X255D,0X255E,0X255F,0X2560,0X2561,0X2562,0X2563,0X2564,0X2565,0X2566,0X2567,0X2568,0X2569,0X256A,0X256B,
-    0X256C,0X256D,0X256E,0X256F,0X2570,0X2571,0X2572,0X2573,0X2581,0X2582,0X2583,0X2584,0X2585,0X2586,0X2587,0X0001,
-    0X2588,0X2589,0X258A,0X258B,0X258C,0X258D,0X258E,0X258F,0X2593,0X2594,0X2595,0X25BC,0X25BD,0X25E2,0X25E3,0X25E4,
-    0X25E5,0X2609,0X2295,0X3012,0X301D,0X301E,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0101,0X00E1,0X01CE,0X00E0,0X0113,0X00E9,0X011B,0X00E8,0X012B,0X00ED,0X01D0,0X00EC,0X014D,0X00F3,0X01D2,
-    0X00F2,0X016B,0X00FA,0X01D4,0X00F9,0X01D6,0X01D8,0X01DA,0X01DC,0X00FC,0X00EA,0X0251,0X0001,0X0144,0X0148,0X0001,
-    0X0261,0X0001,0X0001,0X0001,0X0001,0X3105,0X3106,0X3107,0X3108,0X3109,0X310A,0X310B,0X310C,0X310D,0X310E,0X310F,
-    0X3110,0X3111,0X3112,0X3113,0X3114,0X3115,0X3116,0X3117,0X3118,0X3119,0X311A,0X311B,0X311C,0X311D,0X311E,0X311F,
-    0X3120,0X3121,0X3122,0X3123,0X3124,0X3125,0X3126,0X3127,0X3128,0X3129,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X3021,0X3022,0X3023,0X3024,0X3025,0X3026,0X3027,0X3028,0X3029,0X32A3,0X338E,0X338F,0X339C,0X339D,0X339E,0X33A1,
-    0X33C4,0X33CE,0X33D1,0X33D2,0X33D5,0XFE30,0XFFE2,0XFFE4,0X0001,0X2121,0X3231,0X0001,0X2010,0X0001,0X0001,0X0001,
-    0X30FC,0X309B,0X309C,0X30FD,0X30FE,0X3006,0X309D,0X309E,0XFE49,0XFE4A,0XFE4B,0XFE4C,0XFE4D,0XFE4E,0XFE4F,0XFE50,
-    0XFE51,0XFE52,0XFE54,0XFE55,0XFE56,0XFE57,0XFE59,0XFE5A,0XFE5B,0XFE5C,0XFE5D,0XFE5E,0XFE5F,0XFE60,0XFE61,0X0001,
-    0XFE62,0XFE63,0XFE64,0XFE65,0XFE66,0XFE68,0XFE69,0XFE6A,0XFE6B,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X3007,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X2500,0X2501,0X2502,0X2503,0X2504,0X2505,0X2506,0X2507,0X2508,0X2509,0X250A,0X250B,
-    0X250C,0X250D,0X250E,0X250F,0X2510,0X2511,0X2512,0X2513,0X2514,0X2515,0X2516,0X2517,0X2518,0X2519,0X251A,0X251B,
-    0X251C,0X251D,0X251E,0X251F,0X2520,0X2521,0X2522,0X2523,0X2524,0X2525,0X2526,0X2527,0X2528,0X2529,0X252A,0X252B,
-    0X252C,0X252D,0X252E,0X252F,0X2530,0X2531,0X2532,0X2533,0X2534,0X2535,0X2536,0X2537,0X2538,0X2539,0X253A,0X253B,
-    0X253C,0X253D,0X253E,0X253F,0X2540,0X2541,0X2542,0X2543,0X2544,0X2545,0X2546,0X2547,0X2548,0X2549,0X254A,0X254B,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X72DC,0X72DD,0X72DF,0X72E2,0X72E3,0X72E4,0X72E5,0X72E6,0X72E7,0X72EA,0X72EB,0X72F5,0X72F6,0X72F9,0X72FD,0X72FE,
-    0X72FF,0X7300,0X7302,0X7304,0X7305,0X7306,0X7307,0X7308,0X7309,0X730B,0X730C,0X730D,0X730F,0X7310,0X7311,0X7312,
-    0X7314,0X7318,0X7319,0X731A,0X731F,0X7320,0X7323,0X7324,0X7326,0X7327,0X7328,0X732D,0X732F,0X7330,0X7332,0X7333,
-    0X7335,0X7336,0X733A,0X733B,0X733C,0X733D,0X7340,0X7341,0X7342,0X7343,0X7344,0X7345,0X7346,0X7347,0X7348,0X0001,
-    0X7349,0X734A,0X734B,0X734C,0X734E,0X734F,0X7351,0X7353,0X7354,0X7355,0X7356,0X7358,0X7359,0X735A,0X735B,0X735C,
-    0X735D,0X735E,0X735F,0X7361,0X7362,0X7363,0X7364,0X7365,0X7366,0X7367,0X7368,0X7369,0X736A,0X736B,0X736E,0X7370,
-    0X7371,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X7372,0X7373,0X7374,0X7375,0X7376,0X7377,0X7378,0X7379,0X737A,0X737B,0X737C,0X737D,0X737F,0X7380,0X7381,0X7382,
-    0X7383,0X7385,0X7386,0X7388,0X738A,0X738C,0X738D,0X738F,0X7390,0X7392,0X7393,0X7394,0X7395,0X7397,0X7398,0X7399,
-    0X739A,0X739C,0X739D,0X739E,0X73A0,0X73A1,0X73A3,0X73A4,0X73A5,0X73A6,0X73A7,0X73A8,0X73AA,0X73AC,0X73AD,0X73B1,
-    0X73B4,0X73B5,0X73B6,0X73B8,0X73B9,0X73BC,0X73BD,0X73BE,0X73BF,0X73C1,0X73C3,0X73C4,0X73C5,0X73C6,0X73C7,0X0001,
-    0X73CB,0X73CC,0X73CE,0X73D2,0X73D3,0X73D4,0X73D5,0X73D6,0X73D7,0X73D8,0X73DA,0X73DB,0X73DC,0X73DD,0X73DF,0X73E1,
-    0X73E2,0X73E3,0X73E4,0X73E6,0X73E8,0X73EA,0X73EB,0X73EC,0X73EE,0X73EF,0X73F0,0X73F1,0X73F3,0X73F4,0X73F5,0X73F6,
-    0X73F7,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X73F8,0X73F9,0X73FA,0X73FB,0X73FC,0X73FD,0X73FE,0X73FF,0X7400,0X7401,0X7402,0X7404,0X7407,0X7408,0X740B,0X740C,
-    0X740D,0X740E,0X7411,0X7412,0X7413,0X7414,0X7415,0X7416,0X7417,0X7418,0X7419,0X741C,0X741D,0X741E,0X741F,0X7420,
-    0X7421,0X7423,0X7424,0X7427,0X7429,0X742B,0X742D,0X742F,0X7431,0X7432,0X7437,0X7438,0X7439,0X743A,0X743B,0X743D,
-    0X743E,0X743F,0X7440,0X7442,0X7443,0X7444,0X7445,0X7446,0X7447,0X7448,0X7449,0X744A,0X744B,0X744C,0X744D,0X0001,
-    0X744E,0X744F,0X7450,0X7451,0X7452,0X7453,0X7454,0X7456,0X7458,0X745D,0X7460,0X7461,0X7462,0X7463,0X7464,0X7465,
-    0X7466,0X7467,0X7468,0X7469,0X746A,0X746B,0X746C,0X746E,0X746F,0X7471,0X7472,0X7473,0X7474,0X7475,0X7478,0X7479,
-    0X747A,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X747B,0X747C,0X747D,0X747F,0X7482,0X7484,0X7485,0X7486,0X7488,0X7489,0X748A,0X748C,0X748D,0X748F,0X7491,0X7492,
-    0X7493,0X7494,0X7495,0X7496,0X7497,0X7498,0X7499,0X749A,0X749B,0X749D,0X749F,0X74A0,0X74A1,0X74A2,0X74A3,0X74A4,
-    0X74A5,0X74A6,0X74AA,0X74AB,0X74AC,0X74AD,0X74AE,0X74AF,0X74B0,0X74B1,0X74B2,0X74B3,0X74B4,0X74B5,0X74B6,0X74B7,
-    0X74B8,0X74B9,0X74BB,0X74BC,0X74BD,0X74BE,0X74BF,0X74C0,0X74C1,0X74C2,0X74C3,0X74C4,0X74C5,0X74C6,0X74C7,0X0001,
-    0X74C8,0X74C9,0X74CA,0X74CB,0X74CC,0X74CD,0X74CE,0X74CF,0X74D0,0X74D1,0X74D3,0X74D4,0X74D5,0X74D6,0X74D7,0X74D8,
-    0X74D9,0X74DA,0X74DB,0X74DD,0X74DF,0X74E1,0X74E5,0X74E7,0X74E8,0X74E9,0X74EA,0X74EB,0X74EC,0X74ED,0X74F0,0X74F1,
-    0X74F2,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X74F3,0X74F5,0X74F8,0X74F9,0X74FA,0X74FB,0X74FC,0X74FD,0X74FE,0X7500,0X7501,0X7502,0X7503,0X7505,0X7506,0X7507,
-    0X7508,0X7509,0X750A,0X750B,0X750C,0X750E,0X7510,0X7512,0X7514,0X7515,0X7516,0X7517,0X751B,0X751D,0X751E,0X7520,
-    0X7521,0X7522,0X7523,0X7524,0X7526,0X7527,0X752A,0X752E,0X7534,0X7536,0X7539,0X753C,0X753D,0X753F,0X7541,0X7542,
-    0X7543,0X7544,0X7546,0X7547,0X7549,0X754A,0X754D,0X7550,0X7551,0X7552,0X7553,0X7555,0X7556,0X7557,0X7558,0X0001,
-    0X755D,0X755E,0X755F,0X7560,0X7561,0X7562,0X7563,0X7564,0X7567,0X7568,0X7569,0X756B,0X756C,0X756D,0X756E,0X756F,
-    0X7570,0X7571,0X7573,0X7575,0X7576,0X7577,0X757A,0X757B,0X757C,0X757D,0X757E,0X7580,0X7581,0X7582,0X7584,0X7585,
-    0X7587,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X7588,0X7589,0X758A,0X758C,0X758D,0X758E,0X7590,0X7593,0X7595,0X7598,0X759B,0X759C,0X759E,0X75A2,0X75A6,0X75A7,
-    0X75A8,0X75A9,0X75AA,0X75AD,0X75B6,0X75B7,0X75BA,0X75BB,0X75BF,0X75C0,0X75C1,0X75C6,0X75CB,0X75CC,0X75CE,0X75CF,
-    0X75D0,0X75D1,0X75D3,0X75D7,0X75D9,0X75DA,0X75DC,0X75DD,0X75DF,0X75E0,0X75E1,0X75E5,0X75E9,0X75EC,0X75ED,0X75EE,
-    0X75EF,0X75F2,0X75F3,0X75F5,0X75F6,0X75F7,0X75F8,0X75FA,0X75FB,0X75FD,0X75FE,0X7602,0X7604,0X7606,0X7607,0X0001,
-    0X7608,0X7609,0X760B,0X760D,0X760E,0X760F,0X7611,0X7612,0X7613,0X7614,0X7616,0X761A,0X761C,0X761D,0X761E,0X7621,
-    0X7623,0X7627,0X7628,0X762C,0X762E,0X762F,0X7631,0X7632,0X7636,0X7637,0X7639,0X763A,0X763B,0X763D,0X7641,0X7642,
-    0X7644,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X7645,0X7646,0X7647,0X7648,0X7649,0X764A,0X764B,0X764E,0X764F,0X7650,0X7651,0X7652,0X7653,0X7655,0X7657,0X7658,
-    0X7659,0X765A,0X765B,0X765D,0X765F,0X7660,0X7661,0X7662,0X7664,0X7665,0X7666,0X7667,0X7668,0X7669,0X766A,0X766C,
-    0X766D,0X766E,0X7670,0X7671,0X7672,0X7673,0X7674,0X7675,0X7676,0X7677,0X7679,0X767A,0X767C,0X767F,0X7680,0X7681,
-    0X7683,0X7685,0X7689,0X768A,0X768C,0X768D,0X768F,0X7690,0X7692,0X7694,0X7695,0X7697,0X7698,0X769A,0X769B,0X0001,
-    0X769C,0X769D,0X769E,0X769F,0X76A0,0X76A1,0X76A2,0X76A3,0X76A5,0X76A6,0X76A7,0X76A8,0X76A9,0X76AA,0X76AB,0X76AC,
-    0X76AD,0X76AF,0X76B0,0X76B3,0X76B5,0X76B6,0X76B7,0X76B8,0X76B9,0X76BA,0X76BB,0X76BC,0X76BD,0X76BE,0X76C0,0X76C1,
-    0X76C3,0X554A,0X963F,0X57C3,0X6328,0X54CE,0X5509,0X54C0,0X7691,0X764C,0X853C,0X77EE,0X827E,0X788D,0X7231,0X9698,
-    0X978D,0X6C28,0X5B89,0X4FFA,0X6309,0X6697,0X5CB8,0X80FA,0X6848,0X80AE,0X6602,0X76CE,0X51F9,0X6556,0X71AC,0X7FF1,
-    0X8884,0X50B2,0X5965,0X61CA,0X6FB3,0X82AD,0X634C,0X6252,0X53ED,0X5427,0X7B06,0X516B,0X75A4,0X5DF4,0X62D4,0X8DCB,
-    0X9776,0X628A,0X8019,0X575D,0X9738,0X7F62,0X7238,0X767D,0X67CF,0X767E,0X6446,0X4F70,0X8D25,0X62DC,0X7A17,0X6591,
-    0X73ED,0X642C,0X6273,0X822C,0X9881,0X677F,0X7248,0X626E,0X62CC,0X4F34,0X74E3,0X534A,0X529E,0X7ECA,0X90A6,0X5E2E,
-    0X6886,0X699C,0X8180,0X7ED1,0X68D2,0X78C5,0X868C,0X9551,0X508D,0X8C24,0X82DE,0X80DE,0X5305,0X8912,0X5265,0X0001,
-    0X76C4,0X76C7,0X76C9,0X76CB,0X76CC,0X76D3,0X76D5,0X76D9,0X76DA,0X76DC,0X76DD,0X76DE,0X76E0,0X76E1,0X76E2,0X76E3,
-    0X76E4,0X76E6,0X76E7,0X76E8,0X76E9,0X76EA,0X76EB,0X76EC,0X76ED,0X76F0,0X76F3,0X76F5,0X76F6,0X76F7,0X76FA,0X76FB,
-    0X76FD,0X76FF,0X7700,0X7702,0X7703,0X7705,0X7706,0X770A,0X770C,0X770E,0X770F,0X7710,0X7711,0X7712,0X7713,0X7714,
-    0X7715,0X7716,0X7717,0X7718,0X771B,0X771C,0X771D,0X771E,0X7721,0X7723,0X7724,0X7725,0X7727,0X772A,0X772B,0X0001,
-    0X772C,0X772E,0X7730,0X7731,0X7732,0X7733,0X7734,0X7739,0X773B,0X773D,0X773E,0X773F,0X7742,0X7744,0X7745,0X7746,
-    0X7748,0X7749,0X774A,0X774B,0X774C,0X774D,0X774E,0X774F,0X7752,0X7753,0X7754,0X7755,0X7756,0X7757,0X7758,0X7759,
-    0X775C,0X8584,0X96F9,0X4FDD,0X5821,0X9971,0X5B9D,0X62B1,0X62A5,0X66B4,0X8C79,0X9C8D,0X7206,0X676F,0X7891,0X60B2,
-    0X5351,0X5317,0X8F88,0X80CC,0X8D1D,0X94A1,0X500D,0X72C8,0X5907,0X60EB,0X7119,0X88AB,0X5954,0X82EF,0X672C,0X7B28,
-    0X5D29,0X7EF7,0X752D,0X6CF5,0X8E66,0X8FF8,0X903C,0X9F3B,0X6BD4,0X9119,0X7B14,0X5F7C,0X78A7,0X84D6,0X853D,0X6BD5,
-    0X6BD9,0X6BD6,0X5E01,0X5E87,0X75F9,0X95ED,0X655D,0X5F0A,0X5FC5,0X8F9F,0X58C1,0X81C2,0X907F,0X965B,0X97AD,0X8FB9,
-    0X7F16,0X8D2C,0X6241,0X4FBF,0X53D8,0X535E,0X8FA8,0X8FA9,0X8FAB,0X904D,0X6807,0X5F6A,0X8198,0X8868,0X9CD6,0X618B,
-    0X522B,0X762A,0X5F6C,0X658C,0X6FD2,0X6EE8,0X5BBE,0X6448,0X5175,0X51B0,0X67C4,0X4E19,0X79C9,0X997C,0X70B3,0X0001,
-    0X775D,0X775E,0X775F,0X7760,0X7764,0X7767,0X7769,0X776A,0X776D,0X776E,0X776F,0X7770,0X7771,0X7772,0X7773,0X7774,
-    0X7775,0X7776,0X7777,0X7778,0X777A,0X777B,0X777C,0X7781,0X7782,0X7783,0X7786,0X7787,0X7788,0X7789,0X778A,0X778B,
-    0X778F,0X7790,0X7793,0X7794,0X7795,0X7796,0X7797,0X7798,0X7799,0X779A,0X779B,0X779C,0X779D,0X779E,0X77A1,0X77A3,
-    0X77A4,0X77A6,0X77A8,0X77AB,0X77AD,0X77AE,0X77AF,0X77B1,0X77B2,0X77B4,0X77B6,0X77B7,0X77B8,0X77B9,0X77BA,0X0001,
-    0X77BC,0X77BE,0X77C0,0X77C1,0X77C2,0X77C3,0X77C4,0X77C5,0X77C6,0X77C7,0X77C8,0X77C9,0X77CA,0X77CB,0X77CC,0X77CE,
-    0X77CF,0X77D0,0X77D1,0X77D2,0X77D3,0X77D4,0X77D5,0X77D6,0X77D8,0X77D9,0X77DA,0X77DD,0X77DE,0X77DF,0X77E0,0X77E1,
-    0X77E4,0X75C5,0X5E76,0X73BB,0X83E0,0X64AD,0X62E8,0X94B5,0X6CE2,0X535A,0X52C3,0X640F,0X94C2,0X7B94,0X4F2F,0X5E1B,
-    0X8236,0X8116,0X818A,0X6E24,0X6CCA,0X9A73,0X6355,0X535C,0X54FA,0X8865,0X57E0,0X4E0D,0X5E03,0X6B65,0X7C3F,0X90E8,
-    0X6016,0X64E6,0X731C,0X88C1,0X6750,0X624D,0X8D22,0X776C,0X8E29,0X91C7,0X5F69,0X83DC,0X8521,0X9910,0X53C2,0X8695,
-    0X6B8B,0X60ED,0X60E8,0X707F,0X82CD,0X8231,0X4ED3,0X6CA7,0X85CF,0X64CD,0X7CD9,0X69FD,0X66F9,0X8349,0X5395,0X7B56,
-    0X4FA7,0X518C,0X6D4B,0X5C42,0X8E6D,0X63D2,0X53C9,0X832C,0X8336,0X67E5,0X78B4,0X643D,0X5BDF,0X5C94,0X5DEE,0X8BE7,
-    0X62C6,0X67F4,0X8C7A,0X6400,0X63BA,0X8749,0X998B,0X8C17,0X7F20,0X94F2,0X4EA7,0X9610,0X98A4,0X660C,0X7316,0X0001,
-    0X77E6,0X77E8,0X77EA,0X77EF,0X77F0,0X77F1,0X77F2,0X77F4,0X77F5,0X77F7,0X77F9,0X77FA,0X77FB,0X77FC,0X7803,0X7804,
-    0X7805,0X7806,0X7807,0X7808,0X780A,0X780B,0X780E,0X780F,0X7810,0X7813,0X7815,0X7819,0X781B,0X781E,0X7820,0X7821,
-    0X7822,0X7824,0X7828,0X782A,0X782B,0X782E,0X782F,0X7831,0X7832,0X7833,0X7835,0X7836,0X783D,0X783F,0X7841,0X7842,
-    0X7843,0X7844,0X7846,0X7848,0X7849,0X784A,0X784B,0X784D,0X784F,0X7851,0X7853,0X7854,0X7858,0X7859,0X785A,0X0001,
-    0X785B,0X785C,0X785E,0X785F,0X7860,0X7861,0X7862,0X7863,0X7864,0X7865,0X7866,0X7867,0X7868,0X7869,0X786F,0X7870,
-    0X7871,0X7872,0X7873,0X7874,0X7875,0X7876,0X7878,0X7879,0X787A,0X787B,0X787D,0X787E,0X787F,0X7880,0X7881,0X7882,
-    0X7883,0X573A,0X5C1D,0X5E38,0X957F,0X507F,0X80A0,0X5382,0X655E,0X7545,0X5531,0X5021,0X8D85,0X6284,0X949E,0X671D,
-    0X5632,0X6F6E,0X5DE2,0X5435,0X7092,0X8F66,0X626F,0X64A4,0X63A3,0X5F7B,0X6F88,0X90F4,0X81E3,0X8FB0,0X5C18,0X6668,
-    0X5FF1,0X6C89,0X9648,0X8D81,0X886C,0X6491,0X79F0,0X57CE,0X6A59,0X6210,0X5448,0X4E58,0X7A0B,0X60E9,0X6F84,0X8BDA,
-    0X627F,0X901E,0X9A8B,0X79E4,0X5403,0X75F4,0X6301,0X5319,0X6C60,0X8FDF,0X5F1B,0X9A70,0X803B,0X9F7F,0X4F88,0X5C3A,
-    0X8D64,0X7FC5,0X65A5,0X70BD,0X5145,0X51B2,0X866B,0X5D07,0X5BA0,0X62BD,0X916C,0X7574,0X8E0C,0X7A20,0X6101,0X7B79,
-    0X4EC7,0X7EF8,0X7785,0X4E11,0X81ED,0X521D,0X51FA,0X6A71,0X53A8,0X8E87,0X9504,0X96CF,0X6EC1,0X9664,0X695A,0X0001,
-    0X7884,0X7885,0X7886,0X7888,0X788A,0X788B,0X788F,0X7890,0X7892,0X7894,0X7895,0X7896,0X7899,0X789D,0X789E,0X78A0,
-    0X78A2,0X78A4,0X78A6,0X78A8,0X78A9,0X78AA,0X78AB,0X78AC,0X78AD,0X78AE,0X78AF,0X78B5,0X78B6,0X78B7,0X78B8,0X78BA,
-    0X78BB,0X78BC,0X78BD,0X78BF,0X78C0,0X78C2,0X78C3,0X78C4,0X78C6,0X78C7,0X78C8,0X78CC,0X78CD,0X78CE,0X78CF,0X78D1,
-    0X78D2,0X78D3,0X78D6,0X78D7,0X78D8,0X78DA,0X78DB,0X78DC,0X78DD,0X78DE,0X78DF,0X78E0,0X78E1,0X78E2,0X78E3,0X0001,
-    0X78E4,0X78E5,0X78E6,0X78E7,0X78E9,0X78EA,0X78EB,0X78ED,0X78EE,0X78EF,0X78F0,0X78F1,0X78F3,0X78F5,0X78F6,0X78F8,
-    0X78F9,0X78FB,0X78FC,0X78FD,0X78FE,0X78FF,0X7900,0X7902,0X7903,0X7904,0X7906,0X7907,0X7908,0X7909,0X790A,0X790B,
-    0X790C,0X7840,0X50A8,0X77D7,0X6410,0X89E6,0X5904,0X63E3,0X5DDD,0X7A7F,0X693D,0X4F20,0X8239,0X5598,0X4E32,0X75AE,
-    0X7A97,0X5E62,0X5E8A,0X95EF,0X521B,0X5439,0X708A,0X6376,0X9524,0X5782,0X6625,0X693F,0X9187,0X5507,0X6DF3,0X7EAF,
-    0X8822,0X6233,0X7EF0,0X75B5,0X8328,0X78C1,0X96CC,0X8F9E,0X6148,0X74F7,0X8BCD,0X6B64,0X523A,0X8D50,0X6B21,0X806A,
-    0X8471,0X56F1,0X5306,0X4ECE,0X4E1B,0X51D1,0X7C97,0X918B,0X7C07,0X4FC3,0X8E7F,0X7BE1,0X7A9C,0X6467,0X5D14,0X50AC,
-    0X8106,0X7601,0X7CB9,0X6DEC,0X7FE0,0X6751,0X5B58,0X5BF8,0X78CB,0X64AE,0X6413,0X63AA,0X632B,0X9519,0X642D,0X8FBE,
-    0X7B54,0X7629,0X6253,0X5927,0X5446,0X6B79,0X50A3,0X6234,0X5E26,0X6B86,0X4EE3,0X8D37,0X888B,0X5F85,0X902E,0X0001,
-    0X790D,0X790E,0X790F,0X7910,0X7911,0X7912,0X7914,0X7915,0X7916,0X7917,0X7918,0X7919,0X791A,0X791B,0X791C,0X791D,
-    0X791F,0X7920,0X7921,0X7922,0X7923,0X7925,0X7926,0X7927,0X7928,0X7929,0X792A,0X792B,0X792C,0X792D,0X792E,0X792F,
-    0X7930,0X7931,0X7932,0X7933,0X7935,0X7936,0X7937,0X7938,0X7939,0X793D,0X793F,0X7942,0X7943,0X7944,0X7945,0X7947,
-    0X794A,0X794B,0X794C,0X794D,0X794E,0X794F,0X7950,0X7951,0X7952,0X7954,0X7955,0X7958,0X7959,0X7961,0X7963,0X0001,
-    0X7964,0X7966,0X7969,0X796A,0X796B,0X796C,0X796E,0X7970,0X7971,0X7972,0X7973,0X7974,0X7975,0X7976,0X7979,0X797B,
-    0X797C,0X797D,0X797E,0X797F,0X7982,0X7983,0X7986,0X7987,0X7988,0X7989,0X798B,0X798C,0X798D,0X798E,0X7990,0X7991,
-    0X7992,0X6020,0X803D,0X62C5,0X4E39,0X5355,0X90F8,0X63B8,0X80C6,0X65E6,0X6C2E,0X4F46,0X60EE,0X6DE1,0X8BDE,0X5F39,
-    0X86CB,0X5F53,0X6321,0X515A,0X8361,0X6863,0X5200,0X6363,0X8E48,0X5012,0X5C9B,0X7977,0X5BFC,0X5230,0X7A3B,0X60BC,
-    0X9053,0X76D7,0X5FB7,0X5F97,0X7684,0X8E6C,0X706F,0X767B,0X7B49,0X77AA,0X51F3,0X9093,0X5824,0X4F4E,0X6EF4,0X8FEA,
-    0X654C,0X7B1B,0X72C4,0X6DA4,0X7FDF,0X5AE1,0X62B5,0X5E95,0X5730,0X8482,0X7B2C,0X5E1D,0X5F1F,0X9012,0X7F14,0X98A0,
-    0X6382,0X6EC7,0X7898,0X70B9,0X5178,0X975B,0X57AB,0X7535,0X4F43,0X7538,0X5E97,0X60E6,0X5960,0X6DC0,0X6BBF,0X7889,
-    0X53FC,0X96D5,0X51CB,0X5201,0X6389,0X540A,0X9493,0X8C03,0X8DCC,0X7239,0X789F,0X8776,0X8FED,0X8C0D,0X53E0,0X0001,
-    0X7993,0X7994,0X7995,0X7996,0X7997,0X7998,0X7999,0X799B,0X799C,0X799D,0X799E,0X799F,0X79A0,0X79A1,0X79A2,0X79A3,
-    0X79A4,0X79A5,0X79A6,0X79A8,0X79A9,0X79AA,0X79AB,0X79AC,0X79AD,0X79AE,0X79AF,0X79B0,0X79B1,0X79B2,0X79B4,0X79B5,
-    0X79B6,0X79B7,0X79B8,0X79BC,0X79BF,0X79C2,0X79C4,0X79C5,0X79C7,0X79C8,0X79CA,0X79CC,0X79CE,0X79CF,0X79D0,0X79D3,
-    0X79D4,0X79D6,0X79D7,0X79D9,0X79DA,0X79DB,0X79DC,0X79DD,0X79DE,0X79E0,0X79E1,0X79E2,0X79E5,0X79E8,0X79EA,0X0001,
-    0X79EC,0X79EE,0X79F1,0X79F2,0X79F3,0X79F4,0X79F5,0X79F6,0X79F7,0X79F9,0X79FA,0X79FC,0X79FE,0X79FF,0X7A01,0X7A04,
-    0X7A05,0X7A07,0X7A08,0X7A09,0X7A0A,0X7A0C,0X7A0F,0X7A10,0X7A11,0X7A12,0X7A13,0X7A15,0X7A16,0X7A18,0X7A19,0X7A1B,
-    0X7A1C,0X4E01,0X76EF,0X53EE,0X9489,0X9876,0X9F0E,0X952D,0X5B9A,0X8BA2,0X4E22,0X4E1C,0X51AC,0X8463,0X61C2,0X52A8,
-    0X680B,0X4F97,0X606B,0X51BB,0X6D1E,0X515C,0X6296,0X6597,0X9661,0X8C46,0X9017,0X75D8,0X90FD,0X7763,0X6BD2,0X728A,
-    0X72EC,0X8BFB,0X5835,0X7779,0X8D4C,0X675C,0X9540,0X809A,0X5EA6,0X6E21,0X5992,0X7AEF,0X77ED,0X953B,0X6BB5,0X65AD,
-    0X7F0E,0X5806,0X5151,0X961F,0X5BF9,0X58A9,0X5428,0X8E72,0X6566,0X987F,0X56E4,0X949D,0X76FE,0X9041,0X6387,0X54C6,
-    0X591A,0X593A,0X579B,0X8EB2,0X6735,0X8DFA,0X8235,0X5241,0X60F0,0X5815,0X86FE,0X5CE8,0X9E45,0X4FC4,0X989D,0X8BB9,
-    0X5A25,0X6076,0X5384,0X627C,0X904F,0X9102,0X997F,0X6069,0X800C,0X513F,0X8033,0X5C14,0X9975,0X6D31,0X4E8C,0X0001,
-    0X7A1D,0X7A1F,0X7A21,0X7A22,0X7A24,0X7A25,0X7A26,0X7A27,0X7A28,0X7A29,0X7A2A,0X7A2B,0X7A2C,0X7A2D,0X7A2E,0X7A2F,
-    0X7A30,0X7A31,0X7A32,0X7A34,0X7A35,0X7A36,0X7A38,0X7A3A,0X7A3E,0X7A40,0X7A41,0X7A42,0X7A43,0X7A44,0X7A45,0X7A47,
-    0X7A48,0X7A49,0X7A4A,0X7A4B,0X7A4C,0X7A4D,0X7A4E,0X7A4F,0X7A50,0X7A52,0X7A53,0X7A54,0X7A55,0X7A56,0X7A58,0X7A59,
-    0X7A5A,0X7A5B,0X7A5C,0X7A5D,0X7A5E,0X7A5F,0X7A60,0X7A61,0X7A62,0X7A63,0X7A64,0X7A65,0X7A66,0X7A67,0X7A68,0X0001,
-    0X7A69,0X7A6A,0X7A6B,0X7A6C,0X7A6D,0X7A6E,0X7A6F,0X7A71,0X7A72,0X7A73,0X7A75,0X7A7B,0X7A7C,0X7A7D,0X7A7E,0X7A82,
-    0X7A85,0X7A87,0X7A89,0X7A8A,0X7A8B,0X7A8C,0X7A8E,0X7A8F,0X7A90,0X7A93,0X7A94,0X7A99,0X7A9A,0X7A9B,0X7A9E,0X7AA1,
-    0X7AA2,0X8D30,0X53D1,0X7F5A,0X7B4F,0X4F10,0X4E4F,0X9600,0X6CD5,0X73D0,0X85E9,0X5E06,0X756A,0X7FFB,0X6A0A,0X77FE,
-    0X9492,0X7E41,0X51E1,0X70E6,0X53CD,0X8FD4,0X8303,0X8D29,0X72AF,0X996D,0X6CDB,0X574A,0X82B3,0X65B9,0X80AA,0X623F,
-    0X9632,0X59A8,0X4EFF,0X8BBF,0X7EBA,0X653E,0X83F2,0X975E,0X5561,0X98DE,0X80A5,0X532A,0X8BFD,0X5420,0X80BA,0X5E9F,
-    0X6CB8,0X8D39,0X82AC,0X915A,0X5429,0X6C1B,0X5206,0X7EB7,0X575F,0X711A,0X6C7E,0X7C89,0X594B,0X4EFD,0X5FFF,0X6124,
-    0X7CAA,0X4E30,0X5C01,0X67AB,0X8702,0X5CF0,0X950B,0X98CE,0X75AF,0X70FD,0X9022,0X51AF,0X7F1D,0X8BBD,0X5949,0X51E4,
-    0X4F5B,0X5426,0X592B,0X6577,0X80A4,0X5B75,0X6276,0X62C2,0X8F90,0X5E45,0X6C1F,0X7B26,0X4F0F,0X4FD8,0X670D,0X0001,
-    0X7AA3,0X7AA4,0X7AA7,0X7AA9,0X7AAA,0X7AAB,0X7AAE,0X7AAF,0X7AB0,0X7AB1,0X7AB2,0X7AB4,0X7AB5,0X7AB6,0X7AB7,0X7AB8,
-    0X7AB9,0X7ABA,0X7ABB,0X7ABC,0X7ABD,0X7ABE,0X7AC0,0X7AC1,0X7AC2,0X7AC3,0X7AC4,0X7AC5,0X7AC6,0X7AC7,0X7AC8,0X7AC9,
-    0X7ACA,0X7ACC,0X7ACD,0X7ACE,0X7ACF,0X7AD0,0X7AD1,0X7AD2,0X7AD3,0X7AD4,0X7AD5,0X7AD7,0X7AD8,0X7ADA,0X7ADB,0X7ADC,
-    0X7ADD,0X7AE1,0X7AE2,0X7AE4,0X7AE7,0X7AE8,0X7AE9,0X7AEA,0X7AEB,0X7AEC,0X7AEE,0X7AF0,0X7AF1,0X7AF2,0X7AF3,0X0001,
-    0X7AF4,0X7AF5,0X7AF6,0X7AF7,0X7AF8,0X7AFB,0X7AFC,0X7AFE,0X7B00,0X7B01,0X7B02,0X7B05,0X7B07,0X7B09,0X7B0C,0X7B0D,
-    0X7B0E,0X7B10,0X7B12,0X7B13,0X7B16,0X7B17,0X7B18,0X7B1A,0X7B1C,0X7B1D,0X7B1F,0X7B21,0X7B22,0X7B23,0X7B27,0X7B29,
-    0X7B2D,0X6D6E,0X6DAA,0X798F,0X88B1,0X5F17,0X752B,0X629A,0X8F85,0X4FEF,0X91DC,0X65A7,0X812F,0X8151,0X5E9C,0X8150,
-    0X8D74,0X526F,0X8986,0X8D4B,0X590D,0X5085,0X4ED8,0X961C,0X7236,0X8179,0X8D1F,0X5BCC,0X8BA3,0X9644,0X5987,0X7F1A,
-    0X5490,0X5676,0X560E,0X8BE5,0X6539,0X6982,0X9499,0X76D6,0X6E89,0X5E72,0X7518,0X6746,0X67D1,0X7AFF,0X809D,0X8D76,
-    0X611F,0X79C6,0X6562,0X8D63,0X5188,0X521A,0X94A2,0X7F38,0X809B,0X7EB2,0X5C97,0X6E2F,0X6760,0X7BD9,0X768B,0X9AD8,
-    0X818F,0X7F94,0X7CD5,0X641E,0X9550,0X7A3F,0X544A,0X54E5,0X6B4C,0X6401,0X6208,0X9E3D,0X80F3,0X7599,0X5272,0X9769,
-    0X845B,0X683C,0X86E4,0X9601,0X9694,0X94EC,0X4E2A,0X5404,0X7ED9,0X6839,0X8DDF,0X8015,0X66F4,0X5E9A,0X7FB9,0X0001,
-    0X7B2F,0X7B30,0X7B32,0X7B34,0X7B35,0X7B36,0X7B37,0X7B39,0X7B3B,0X7B3D,0X7B3F,0X7B40,0X7B41,0X7B42,0X7B43,0X7B44,
-    0X7B46,0X7B48,0X7B4A,0X7B4D,0X7B4E,0X7B53,0X7B55,0X7B57,0X7B59,0X7B5C,0X7B5E,0X7B5F,0X7B61,0X7B63,0X7B64,0X7B65,
-    0X7B66,0X7B67,0X7B68,0X7B69,0X7B6A,0X7B6B,0X7B6C,0X7B6D,0X7B6F,0X7B70,0X7B73,0X7B74,0X7B76,0X7B78,0X7B7A,0X7B7C,
-    0X7B7D,0X7B7F,0X7B81,0X7B82,0X7B83,0X7B84,0X7B86,0X7B87,0X7B88,0X7B89,0X7B8A,0X7B8B,0X7B8C,0X7B8E,0X7B8F,0X0001,
-    0X7B91,0X7B92,0X7B93,0X7B96,0X7B98,0X7B99,0X7B9A,0X7B9B,0X7B9E,0X7B9F,0X7BA0,0X7BA3,0X7BA4,0X7BA5,0X7BAE,0X7BAF,
-    0X7BB0,0X7BB2,0X7BB3,0X7BB5,0X7BB6,0X7BB7,0X7BB9,0X7BBA,0X7BBB,0X7BBC,0X7BBD,0X7BBE,0X7BBF,0X7BC0,0X7BC2,0X7BC3,
-    0X7BC4,0X57C2,0X803F,0X6897,0X5DE5,0X653B,0X529F,0X606D,0X9F9A,0X4F9B,0X8EAC,0X516C,0X5BAB,0X5F13,0X5DE9,0X6C5E,
-    0X62F1,0X8D21,0X5171,0X94A9,0X52FE,0X6C9F,0X82DF,0X72D7,0X57A2,0X6784,0X8D2D,0X591F,0X8F9C,0X83C7,0X5495,0X7B8D,
-    0X4F30,0X6CBD,0X5B64,0X59D1,0X9F13,0X53E4,0X86CA,0X9AA8,0X8C37,0X80A1,0X6545,0X987E,0X56FA,0X96C7,0X522E,0X74DC,
-    0X5250,0X5BE1,0X6302,0X8902,0X4E56,0X62D0,0X602A,0X68FA,0X5173,0X5B98,0X51A0,0X89C2,0X7BA1,0X9986,0X7F50,0X60EF,
-    0X704C,0X8D2F,0X5149,0X5E7F,0X901B,0X7470,0X89C4,0X572D,0X7845,0X5F52,0X9F9F,0X95FA,0X8F68,0X9B3C,0X8BE1,0X7678,
-    0X6842,0X67DC,0X8DEA,0X8D35,0X523D,0X8F8A,0X6EDA,0X68CD,0X9505,0X90ED,0X56FD,0X679C,0X88F9,0X8FC7,0X54C8,0X0001,
-    0X7BC5,0X7BC8,0X7BC9,0X7BCA,0X7BCB,0X7BCD,0X7BCE,0X7BCF,0X7BD0,0X7BD2,0X7BD4,0X7BD5,0X7BD6,0X7BD7,0X7BD8,0X7BDB,
-    0X7BDC,0X7BDE,0X7BDF,0X7BE0,0X7BE2,0X7BE3,0X7BE4,0X7BE7,0X7BE8,0X7BE9,0X7BEB,0X7BEC,0X7BED,0X7BEF,0X7BF0,0X7BF2,
-    0X7BF3,0X7BF4,0X7BF5,0X7BF6,0X7BF8,0X7BF9,0X7BFA,0X7BFB,0X7BFD,0X7BFF,0X7C00,0X7C01,0X7C02,0X7C03,0X7C04,0X7C05,
-    0X7C06,0X7C08,0X7C09,0X7C0A,0X7C0D,0X7C0E,0X7C10,0X7C11,0X7C12,0X7C13,0X7C14,0X7C15,0X7C17,0X7C18,0X7C19,0X0001,
-    0X7C1A,0X7C1B,0X7C1C,0X7C1D,0X7C1E,0X7C20,0X7C21,0X7C22,0X7C23,0X7C24,0X7C25,0X7C28,0X7C29,0X7C2B,0X7C2C,0X7C2D,
-    0X7C2E,0X7C2F,0X7C30,0X7C31,0X7C32,0X7C33,0X7C34,0X7C35,0X7C36,0X7C37,0X7C39,0X7C3A,0X7C3B,0X7C3C,0X7C3D,0X7C3E,
-    0X7C42,0X9AB8,0X5B69,0X6D77,0X6C26,0X4EA5,0X5BB3,0X9A87,0X9163,0X61A8,0X90AF,0X97E9,0X542B,0X6DB5,0X5BD2,0X51FD,
-    0X558A,0X7F55,0X7FF0,0X64BC,0X634D,0X65F1,0X61BE,0X608D,0X710A,0X6C57,0X6C49,0X592F,0X676D,0X822A,0X58D5,0X568E,
-    0X8C6A,0X6BEB,0X90DD,0X597D,0X8017,0X53F7,0X6D69,0X5475,0X559D,0X8377,0X83CF,0X6838,0X79BE,0X548C,0X4F55,0X5408,
-    0X76D2,0X8C89,0X9602,0X6CB3,0X6DB8,0X8D6B,0X8910,0X9E64,0X8D3A,0X563F,0X9ED1,0X75D5,0X5F88,0X72E0,0X6068,0X54FC,
-    0X4EA8,0X6A2A,0X8861,0X6052,0X8F70,0X54C4,0X70D8,0X8679,0X9E3F,0X6D2A,0X5B8F,0X5F18,0X7EA2,0X5589,0X4FAF,0X7334,
-    0X543C,0X539A,0X5019,0X540E,0X547C,0X4E4E,0X5FFD,0X745A,0X58F6,0X846B,0X80E1,0X8774,0X72D0,0X7CCA,0X6E56,0X0001,
-    0X7C43,0X7C44,0X7C45,0X7C46,0X7C47,0X7C48,0X7C49,0X7C4A,0X7C4B,0X7C4C,0X7C4E,0X7C4F,0X7C50,0X7C51,0X7C52,0X7C53,
-    0X7C54,0X7C55,0X7C56,0X7C57,0X7C58,0X7C59,0X7C5A,0X7C5B,0X7C5C,0X7C5D,0X7C5E,0X7C5F,0X7C60,0X7C61,0X7C62,0X7C63,
-    0X7C64,0X7C65,0X7C66,0X7C67,0X7C68,0X7C69,0X7C6A,0X7C6B,0X7C6C,0X7C6D,0X7C6E,0X7C6F,0X7C70,0X7C71,0X7C72,0X7C75,
-    0X7C76,0X7C77,0X7C78,0X7C79,0X7C7A,0X7C7E,0X7C7F,0X7C80,0X7C81,0X7C82,0X7C83,0X7C84,0X7C85,0X7C86,0X7C87,0X0001,
-    0X7C88,0X7C8A,0X7C8B,0X7C8C,0X7C8D,0X7C8E,0X7C8F,0X7C90,0X7C93,0X7C94,0X7C96,0X7C99,0X7C9A,0X7C9B,0X7CA0,0X7CA1,
-    0X7CA3,0X7CA6,0X7CA7,0X7CA8,0X7CA9,0X7CAB,0X7CAC,0X7CAD,0X7CAF,0X7CB0,0X7CB4,0X7CB5,0X7CB6,0X7CB7,0X7CB8,0X7CBA,
-    0X7CBB,0X5F27,0X864E,0X552C,0X62A4,0X4E92,0X6CAA,0X6237,0X82B1,0X54D7,0X534E,0X733E,0X6ED1,0X753B,0X5212,0X5316,
-    0X8BDD,0X69D0,0X5F8A,0X6000,0X6DEE,0X574F,0X6B22,0X73AF,0X6853,0X8FD8,0X7F13,0X6362,0X60A3,0X5524,0X75EA,0X8C62,
-    0X7115,0X6DA3,0X5BA6,0X5E7B,0X8352,0X614C,0X9EC4,0X78FA,0X8757,0X7C27,0X7687,0X51F0,0X60F6,0X714C,0X6643,0X5E4C,
-    0X604D,0X8C0E,0X7070,0X6325,0X8F89,0X5FBD,0X6062,0X86D4,0X56DE,0X6BC1,0X6094,0X6167,0X5349,0X60E0,0X6666,0X8D3F,
-    0X79FD,0X4F1A,0X70E9,0X6C47,0X8BB3,0X8BF2,0X7ED8,0X8364,0X660F,0X5A5A,0X9B42,0X6D51,0X6DF7,0X8C41,0X6D3B,0X4F19,
-    0X706B,0X83B7,0X6216,0X60D1,0X970D,0X8D27,0X7978,0X51FB,0X573E,0X57FA,0X673A,0X7578,0X7A3D,0X79EF,0X7B95,0X0001,
-    0X7CBF,0X7CC0,0X7CC2,0X7CC3,0X7CC4,0X7CC6,0X7CC9,0X7CCB,0X7CCE,0X7CCF,0X7CD0,0X7CD1,0X7CD2,0X7CD3,0X7CD4,0X7CD8,
-    0X7CDA,0X7CDB,0X7CDD,0X7CDE,0X7CE1,0X7CE2,0X7CE3,0X7CE4,0X7CE5,0X7CE6,0X7CE7,0X7CE9,0X7CEA,0X7CEB,0X7CEC,0X7CED,
-    0X7CEE,0X7CF0,0X7CF1,0X7CF2,0X7CF3,0X7CF4,0X7CF5,0X7CF6,0X7CF7,0X7CF9,0X7CFA,0X7CFC,0X7CFD,0X7CFE,0X7CFF,0X7D00,
-    0X7D01,0X7D02,0X7D03,0X7D04,0X7D05,0X7D06,0X7D07,0X7D08,0X7D09,0X7D0B,0X7D0C,0X7D0D,0X7D0E,0X7D0F,0X7D10,0X0001,
-    0X7D11,0X7D12,0X7D13,0X7D14,0X7D15,0X7D16,0X7D17,0X7D18,0X7D19,0X7D1A,0X7D1B,0X7D1C,0X7D1D,0X7D1E,0X7D1F,0X7D21,
-    0X7D23,0X7D24,0X7D25,0X7D26,0X7D28,0X7D29,0X7D2A,0X7D2C,0X7D2D,0X7D2E,0X7D30,0X7D31,0X7D32,0X7D33,0X7D34,0X7D35,
-    0X7D36,0X808C,0X9965,0X8FF9,0X6FC0,0X8BA5,0X9E21,0X59EC,0X7EE9,0X7F09,0X5409,0X6781,0X68D8,0X8F91,0X7C4D,0X96C6,
-    0X53CA,0X6025,0X75BE,0X6C72,0X5373,0X5AC9,0X7EA7,0X6324,0X51E0,0X810A,0X5DF1,0X84DF,0X6280,0X5180,0X5B63,0X4F0E,
-    0X796D,0X5242,0X60B8,0X6D4E,0X5BC4,0X5BC2,0X8BA1,0X8BB0,0X65E2,0X5FCC,0X9645,0X5993,0X7EE7,0X7EAA,0X5609,0X67B7,
-    0X5939,0X4F73,0X5BB6,0X52A0,0X835A,0X988A,0X8D3E,0X7532,0X94BE,0X5047,0X7A3C,0X4EF7,0X67B6,0X9A7E,0X5AC1,0X6B7C,
-    0X76D1,0X575A,0X5C16,0X7B3A,0X95F4,0X714E,0X517C,0X80A9,0X8270,0X5978,0X7F04,0X8327,0X68C0,0X67EC,0X78B1,0X7877,
-    0X62E3,0X6361,0X7B80,0X4FED,0X526A,0X51CF,0X8350,0X69DB,0X9274,0X8DF5,0X8D31,0X89C1,0X952E,0X7BAD,0X4EF6,0X0001,
-    0X7D37,0X7D38,0X7D39,0X7D3A,0X7D3B,0X7D3C,0X7D3D,0X7D3E,0X7D3F,0X7D40,0X7D41,0X7D42,0X7D43,0X7D44,0X7D45,0X7D46,
-    0X7D47,0X7D48,0X7D49,0X7D4A,0X7D4B,0X7D4C,0X7D4D,0X7D4E,0X7D4F,0X7D50,0X7D51,0X7D52,0X7D53,0X7D54,0X7D55,0X7D56,
-    0X7D57,0X7D58,0X7D59,0X7D5A,0X7D5B,0X7D5C,0X7D5D,0X7D5E,0X7D5F,0X7D60,0X7D61,0X7D62,0X7D63,0X7D64,0X7D65,0X7D66,
-    0X7D67,0X7D68,0X7D69,0X7D6A,0X7D6B,0X7D6C,0X7D6D,0X7D6F,0X7D70,0X7D71,0X7D72,0X7D73,0X7D74,0X7D75,0X7D76,0X0001,
-    0X7D78,0X7D79,0X7D7A,0X7D7B,0X7D7C,0X7D7D,0X7D7E,0X7D7F,0X7D80,0X7D81,0X7D82,0X7D83,0X7D84,0X7D85,0X7D86,0X7D87,
-    0X7D88,0X7D89,0X7D8A,0X7D8B,0X7D8C,0X7D8D,0X7D8E,0X7D8F,0X7D90,0X7D91,0X7D92,0X7D93,0X7D94,0X7D95,0X7D96,0X7D97,
-    0X7D98,0X5065,0X8230,0X5251,0X996F,0X6E10,0X6E85,0X6DA7,0X5EFA,0X50F5,0X59DC,0X5C06,0X6D46,0X6C5F,0X7586,0X848B,
-    0X6868,0X5956,0X8BB2,0X5320,0X9171,0X964D,0X8549,0X6912,0X7901,0X7126,0X80F6,0X4EA4,0X90CA,0X6D47,0X9A84,0X5A07,
-    0X56BC,0X6405,0X94F0,0X77EB,0X4FA5,0X811A,0X72E1,0X89D2,0X997A,0X7F34,0X7EDE,0X527F,0X6559,0X9175,0X8F7F,0X8F83,
-    0X53EB,0X7A96,0X63ED,0X63A5,0X7686,0X79F8,0X8857,0X9636,0X622A,0X52AB,0X8282,0X6854,0X6770,0X6377,0X776B,0X7AED,
-    0X6D01,0X7ED3,0X89E3,0X59D0,0X6212,0X85C9,0X82A5,0X754C,0X501F,0X4ECB,0X75A5,0X8BEB,0X5C4A,0X5DFE,0X7B4B,0X65A4,
-    0X91D1,0X4ECA,0X6D25,0X895F,0X7D27,0X9526,0X4EC5,0X8C28,0X8FDB,0X9773,0X664B,0X7981,0X8FD1,0X70EC,0X6D78,0X0001,
-    0X7D99,0X7D9A,0X7D9B,0X7D9C,0X7D9D,0X7D9E,0X7D9F,0X7DA0,0X7DA1,0X7DA2,0X7DA3,0X7DA4,0X7DA5,0X7DA7,0X7DA8,0X7DA9,
-    0X7DAA,0X7DAB,0X7DAC,0X7DAD,0X7DAF,0X7DB0,0X7DB1,0X7DB2,0X7DB3,0X7DB4,0X7DB5,0X7DB6,0X7DB7,0X7DB8,0X7DB9,0X7DBA,
-    0X7DBB,0X7DBC,0X7DBD,0X7DBE,0X7DBF,0X7DC0,0X7DC1,0X7DC2,0X7DC3,0X7DC4,0X7DC5,0X7DC6,0X7DC7,0X7DC8,0X7DC9,0X7DCA,
-    0X7DCB,0X7DCC,0X7DCD,0X7DCE,0X7DCF,0X7DD0,0X7DD1,0X7DD2,0X7DD3,0X7DD4,0X7DD5,0X7DD6,0X7DD7,0X7DD8,0X7DD9,0X0001,
-    0X7DDA,0X7DDB,0X7DDC,0X7DDD,0X7DDE,0X7DDF,0X7DE0,0X7DE1,0X7DE2,0X7DE3,0X7DE4,0X7DE5,0X7DE6,0X7DE7,0X7DE8,0X7DE9,
-    0X7DEA,0X7DEB,0X7DEC,0X7DED,0X7DEE,0X7DEF,0X7DF0,0X7DF1,0X7DF2,0X7DF3,0X7DF4,0X7DF5,0X7DF6,0X7DF7,0X7DF8,0X7DF9,
-    0X7DFA,0X5C3D,0X52B2,0X8346,0X5162,0X830E,0X775B,0X6676,0X9CB8,0X4EAC,0X60CA,0X7CBE,0X7CB3,0X7ECF,0X4E95,0X8B66,
-    0X666F,0X9888,0X9759,0X5883,0X656C,0X955C,0X5F84,0X75C9,0X9756,0X7ADF,0X7ADE,0X51C0,0X70AF,0X7A98,0X63EA,0X7A76,
-    0X7EA0,0X7396,0X97ED,0X4E45,0X7078,0X4E5D,0X9152,0X53A9,0X6551,0X65E7,0X81FC,0X8205,0X548E,0X5C31,0X759A,0X97A0,
-    0X62D8,0X72D9,0X75BD,0X5C45,0X9A79,0X83CA,0X5C40,0X5480,0X77E9,0X4E3E,0X6CAE,0X805A,0X62D2,0X636E,0X5DE8,0X5177,
-    0X8DDD,0X8E1E,0X952F,0X4FF1,0X53E5,0X60E7,0X70AC,0X5267,0X6350,0X9E43,0X5A1F,0X5026,0X7737,0X5377,0X7EE2,0X6485,
-    0X652B,0X6289,0X6398,0X5014,0X7235,0X89C9,0X51B3,0X8BC0,0X7EDD,0X5747,0X83CC,0X94A7,0X519B,0X541B,0X5CFB,0X0001,
-    0X7DFB,0X7DFC,0X7DFD,0X7DFE,0X7DFF,0X7E00,0X7E01,0X7E02,0X7E03,0X7E04,0X7E05,0X7E06,0X7E07,0X7E08,0X7E09,0X7E0A,
-    0X7E0B,0X7E0C,0X7E0D,0X7E0E,0X7E0F,0X7E10,0X7E11,0X7E12,0X7E13,0X7E14,0X7E15,0X7E16,0X7E17,0X7E18,0X7E19,0X7E1A,
-    0X7E1B,0X7E1C,0X7E1D,0X7E1E,0X7E1F,0X7E20,0X7E21,0X7E22,0X7E23,0X7E24,0X7E25,0X7E26,0X7E27,0X7E28,0X7E29,0X7E2A,
-    0X7E2B,0X7E2C,0X7E2D,0X7E2E,0X7E2F,0X7E30,0X7E31,0X7E32,0X7E33,0X7E34,0X7E35,0X7E36,0X7E37,0X7E38,0X7E39,0X0001,
-    0X7E3A,0X7E3C,0X7E3D,0X7E3E,0X7E3F,0X7E40,0X7E42,0X7E43,0X7E44,0X7E45,0X7E46,0X7E48,0X7E49,0X7E4A,0X7E4B,0X7E4C,
-    0X7E4D,0X7E4E,0X7E4F,0X7E50,0X7E51,0X7E52,0X7E53,0X7E54,0X7E55,0X7E56,0X7E57,0X7E58,0X7E59,0X7E5A,0X7E5B,0X7E5C,
-    0X7E5D,0X4FCA,0X7AE3,0X6D5A,0X90E1,0X9A8F,0X5580,0X5496,0X5361,0X54AF,0X5F00,0X63E9,0X6977,0X51EF,0X6168,0X520A,
-    0X582A,0X52D8,0X574E,0X780D,0X770B,0X5EB7,0X6177,0X7CE0,0X625B,0X6297,0X4EA2,0X7095,0X8003,0X62F7,0X70E4,0X9760,
-    0X5777,0X82DB,0X67EF,0X68F5,0X78D5,0X9897,0X79D1,0X58F3,0X54B3,0X53EF,0X6E34,0X514B,0X523B,0X5BA2,0X8BFE,0X80AF,
-    0X5543,0X57A6,0X6073,0X5751,0X542D,0X7A7A,0X6050,0X5B54,0X63A7,0X62A0,0X53E3,0X6263,0X5BC7,0X67AF,0X54ED,0X7A9F,
-    0X82E6,0X9177,0X5E93,0X88E4,0X5938,0X57AE,0X630E,0X8DE8,0X80EF,0X5757,0X7B77,0X4FA9,0X5FEB,0X5BBD,0X6B3E,0X5321,
-    0X7B50,0X72C2,0X6846,0X77FF,0X7736,0X65F7,0X51B5,0X4E8F,0X76D4,0X5CBF,0X7AA5,0X8475,0X594E,0X9B41,0X5080,0X0001,
-    0X7E5E,0X7E5F,0X7E60,0X7E61,0X7E62,0X7E63,0X7E64,0X7E65,0X7E66,0X7E67,0X7E68,0X7E69,0X7E6A,0X7E6B,0X7E6C,0X7E6D,
-    0X7E6E,0X7E6F,0X7E70,0X7E71,0X7E72,0X7E73,0X7E74,0X7E75,0X7E76,0X7E77,0X7E78,0X7E79,0X7E7A,0X7E7B,0X7E7C,0X7E7D,
-    0X7E7E,0X7E7F,0X7E80,0X7E81,0X7E83,0X7E84,0X7E85,0X7E86,0X7E87,0X7E88,0X7E89,0X7E8A,0X7E8B,0X7E8C,0X7E8D,0X7E8E,
-    0X7E8F,0X7E90,0X7E91,0X7E92,0X7E93,0X7E94,0X7E95,0X7E96,0X7E97,0X7E98,0X7E99,0X7E9A,0X7E9C,0X7E9D,0X7E9E,0X0001,
-    0X7EAE,0X7EB4,0X7EBB,0X7EBC,0X7ED6,0X7EE4,0X7EEC,0X7EF9,0X7F0A,0X7F10,0X7F1E,0X7F37,0X7F39,0X7F3B,0X7F3C,0X7F3D,
-    0X7F3E,0X7F3F,0X7F40,0X7F41,0X7F43,0X7F46,0X7F47,0X7F48,0X7F49,0X7F4A,0X7F4B,0X7F4C,0X7F4D,0X7F4E,0X7F4F,0X7F52,
-    0X7F53,0X9988,0X6127,0X6E83,0X5764,0X6606,0X6346,0X56F0,0X62EC,0X6269,0X5ED3,0X9614,0X5783,0X62C9,0X5587,0X8721,
-    0X814A,0X8FA3,0X5566,0X83B1,0X6765,0X8D56,0X84DD,0X5A6A,0X680F,0X62E6,0X7BEE,0X9611,0X5170,0X6F9C,0X8C30,0X63FD,
-    0X89C8,0X61D2,0X7F06,0X70C2,0X6EE5,0X7405,0X6994,0X72FC,0X5ECA,0X90CE,0X6717,0X6D6A,0X635E,0X52B3,0X7262,0X8001,
-    0X4F6C,0X59E5,0X916A,0X70D9,0X6D9D,0X52D2,0X4E50,0X96F7,0X956D,0X857E,0X78CA,0X7D2F,0X5121,0X5792,0X64C2,0X808B,
-    0X7C7B,0X6CEA,0X68F1,0X695E,0X51B7,0X5398,0X68A8,0X7281,0X9ECE,0X7BF1,0X72F8,0X79BB,0X6F13,0X7406,0X674E,0X91CC,
-    0X9CA4,0X793C,0X8389,0X8354,0X540F,0X6817,0X4E3D,0X5389,0X52B1,0X783E,0X5386,0X5229,0X5088,0X4F8B,0X4FD0,0X0001,
-    0X7F56,0X7F59,0X7F5B,0X7F5C,0X7F5D,0X7F5E,0X7F60,0X7F63,0X7F64,0X7F65,0X7F66,0X7F67,0X7F6B,0X7F6C,0X7F6D,0X7F6F,
-    0X7F70,0X7F73,0X7F75,0X7F76,0X7F77,0X7F78,0X7F7A,0X7F7B,0X7F7C,0X7F7D,0X7F7F,0X7F80,0X7F82,0X7F83,0X7F84,0X7F85,
-    0X7F86,0X7F87,0X7F88,0X7F89,0X7F8B,0X7F8D,0X7F8F,0X7F90,0X7F91,0X7F92,0X7F93,0X7F95,0X7F96,0X7F97,0X7F98,0X7F99,
-    0X7F9B,0X7F9C,0X7FA0,0X7FA2,0X7FA3,0X7FA5,0X7FA6,0X7FA8,0X7FA9,0X7FAA,0X7FAB,0X7FAC,0X7FAD,0X7FAE,0X7FB1,0X0001,
-    0X7FB3,0X7FB4,0X7FB5,0X7FB6,0X7FB7,0X7FBA,0X7FBB,0X7FBE,0X7FC0,0X7FC2,0X7FC3,0X7FC4,0X7FC6,0X7FC7,0X7FC8,0X7FC9,
-    0X7FCB,0X7FCD,0X7FCF,0X7FD0,0X7FD1,0X7FD2,0X7FD3,0X7FD6,0X7FD7,0X7FD9,0X7FDA,0X7FDB,0X7FDC,0X7FDD,0X7FDE,0X7FE2,
-    0X7FE3,0X75E2,0X7ACB,0X7C92,0X6CA5,0X96B6,0X529B,0X7483,0X54E9,0X4FE9,0X8054,0X83B2,0X8FDE,0X9570,0X5EC9,0X601C,
-    0X6D9F,0X5E18,0X655B,0X8138,0X94FE,0X604B,0X70BC,0X7EC3,0X7CAE,0X51C9,0X6881,0X7CB1,0X826F,0X4E24,0X8F86,0X91CF,
-    0X667E,0X4EAE,0X8C05,0X64A9,0X804A,0X50DA,0X7597,0X71CE,0X5BE5,0X8FBD,0X6F66,0X4E86,0X6482,0X9563,0X5ED6,0X6599,
-    0X5217,0X88C2,0X70C8,0X52A3,0X730E,0X7433,0X6797,0X78F7,0X9716,0X4E34,0X90BB,0X9CDE,0X6DCB,0X51DB,0X8D41,0X541D,
-    0X62CE,0X73B2,0X83F1,0X96F6,0X9F84,0X94C3,0X4F36,0X7F9A,0X51CC,0X7075,0X9675,0X5CAD,0X9886,0X53E6,0X4EE4,0X6E9C,
-    0X7409,0X69B4,0X786B,0X998F,0X7559,0X5218,0X7624,0X6D41,0X67F3,0X516D,0X9F99,0X804B,0X5499,0X7B3C,0X7ABF,0X0001,
-    0X7FE4,0X7FE7,0X7FE8,0X7FEA,0X7FEB,0X7FEC,0X7FED,0X7FEF,0X7FF2,0X7FF4,0X7FF5,0X7FF6,0X7FF7,0X7FF8,0X7FF9,0X7FFA,
-    0X7FFD,0X7FFE,0X7FFF,0X8002,0X8007,0X8008,0X8009,0X800A,0X800E,0X800F,0X8011,0X8013,0X801A,0X801B,0X801D,0X801E,
-    0X801F,0X8021,0X8023,0X8024,0X802B,0X802C,0X802D,0X802E,0X802F,0X8030,0X8032,0X8034,0X8039,0X803A,0X803C,0X803E,
-    0X8040,0X8041,0X8044,0X8045,0X8047,0X8048,0X8049,0X804E,0X804F,0X8050,0X8051,0X8053,0X8055,0X8056,0X8057,0X0001,
-    0X8059,0X805B,0X805C,0X805D,0X805E,0X805F,0X8060,0X8061,0X8062,0X8063,0X8064,0X8065,0X8066,0X8067,0X8068,0X806B,
-    0X806C,0X806D,0X806E,0X806F,0X8070,0X8072,0X8073,0X8074,0X8075,0X8076,0X8077,0X8078,0X8079,0X807A,0X807B,0X807C,
-    0X807D,0X9686,0X5784,0X62E2,0X9647,0X697C,0X5A04,0X6402,0X7BD3,0X6F0F,0X964B,0X82A6,0X5362,0X9885,0X5E90,0X7089,
-    0X63B3,0X5364,0X864F,0X9C81,0X9E93,0X788C,0X9732,0X8DEF,0X8D42,0X9E7F,0X6F5E,0X7984,0X5F55,0X9646,0X622E,0X9A74,
-    0X5415,0X94DD,0X4FA3,0X65C5,0X5C65,0X5C61,0X7F15,0X8651,0X6C2F,0X5F8B,0X7387,0X6EE4,0X7EFF,0X5CE6,0X631B,0X5B6A,
-    0X6EE6,0X5375,0X4E71,0X63A0,0X7565,0X62A1,0X8F6E,0X4F26,0X4ED1,0X6CA6,0X7EB6,0X8BBA,0X841D,0X87BA,0X7F57,0X903B,
-    0X9523,0X7BA9,0X9AA1,0X88F8,0X843D,0X6D1B,0X9A86,0X7EDC,0X5988,0X9EBB,0X739B,0X7801,0X8682,0X9A6C,0X9A82,0X561B,
-    0X5417,0X57CB,0X4E70,0X9EA6,0X5356,0X8FC8,0X8109,0X7792,0X9992,0X86EE,0X6EE1,0X8513,0X66FC,0X6162,0X6F2B,0X0001,
-    0X807E,0X8081,0X8082,0X8085,0X8088,0X808A,0X808D,0X808E,0X808F,0X8090,0X8091,0X8092,0X8094,0X8095,0X8097,0X8099,
-    0X809E,0X80A3,0X80A6,0X80A7,0X80A8,0X80AC,0X80B0,0X80B3,0X80B5,0X80B6,0X80B8,0X80B9,0X80BB,0X80C5,0X80C7,0X80C8,
-    0X80C9,0X80CA,0X80CB,0X80CF,0X80D0,0X80D1,0X80D2,0X80D3,0X80D4,0X80D5,0X80D8,0X80DF,0X80E0,0X80E2,0X80E3,0X80E6,
-    0X80EE,0X80F5,0X80F7,0X80F9,0X80FB,0X80FE,0X80FF,0X8100,0X8101,0X8103,0X8104,0X8105,0X8107,0X8108,0X810B,0X0001,
-    0X810C,0X8115,0X8117,0X8119,0X811B,0X811C,0X811D,0X811F,0X8120,0X8121,0X8122,0X8123,0X8124,0X8125,0X8126,0X8127,
-    0X8128,0X8129,0X812A,0X812B,0X812D,0X812E,0X8130,0X8133,0X8134,0X8135,0X8137,0X8139,0X813A,0X813B,0X813C,0X813D,
-    0X813F,0X8C29,0X8292,0X832B,0X76F2,0X6C13,0X5FD9,0X83BD,0X732B,0X8305,0X951A,0X6BDB,0X77DB,0X94C6,0X536F,0X8302,
-    0X5192,0X5E3D,0X8C8C,0X8D38,0X4E48,0X73AB,0X679A,0X6885,0X9176,0X9709,0X7164,0X6CA1,0X7709,0X5A92,0X9541,0X6BCF,
-    0X7F8E,0X6627,0X5BD0,0X59B9,0X5A9A,0X95E8,0X95F7,0X4EEC,0X840C,0X8499,0X6AAC,0X76DF,0X9530,0X731B,0X68A6,0X5B5F,
-    0X772F,0X919A,0X9761,0X7CDC,0X8FF7,0X8C1C,0X5F25,0X7C73,0X79D8,0X89C5,0X6CCC,0X871C,0X5BC6,0X5E42,0X68C9,0X7720,
-    0X7EF5,0X5195,0X514D,0X52C9,0X5A29,0X7F05,0X9762,0X82D7,0X63CF,0X7784,0X85D0,0X79D2,0X6E3A,0X5E99,0X5999,0X8511,
-    0X706D,0X6C11,0X62BF,0X76BF,0X654F,0X60AF,0X95FD,0X660E,0X879F,0X9E23,0X94ED,0X540D,0X547D,0X8C2C,0X6478,0X0001,
-    0X8140,0X8141,0X8142,0X8143,0X8144,0X8145,0X8147,0X8149,0X814D,0X814E,0X814F,0X8152,0X8156,0X8157,0X8158,0X815B,
-    0X815C,0X815D,0X815E,0X815F,0X8161,0X8162,0X8163,0X8164,0X8166,0X8168,0X816A,0X816B,0X816C,0X816F,0X8172,0X8173,
-    0X8175,0X8176,0X8177,0X8178,0X8181,0X8183,0X8184,0X8185,0X8186,0X8187,0X8189,0X818B,0X818C,0X818D,0X818E,0X8190,
-    0X8192,0X8193,0X8194,0X8195,0X8196,0X8197,0X8199,0X819A,0X819E,0X819F,0X81A0,0X81A1,0X81A2,0X81A4,0X81A5,0X0001,
-    0X81A7,0X81A9,0X81AB,0X81AC,0X81AD,0X81AE,0X81AF,0X81B0,0X81B1,0X81B2,0X81B4,0X81B5,0X81B6,0X81B7,0X81B8,0X81B9,
-    0X81BC,0X81BD,0X81BE,0X81BF,0X81C4,0X81C5,0X81C7,0X81C8,0X81C9,0X81CB,0X81CD,0X81CE,0X81CF,0X81D0,0X81D1,0X81D2,
-    0X81D3,0X6479,0X8611,0X6A21,0X819C,0X78E8,0X6469,0X9B54,0X62B9,0X672B,0X83AB,0X58A8,0X9ED8,0X6CAB,0X6F20,0X5BDE,
-    0X964C,0X8C0B,0X725F,0X67D0,0X62C7,0X7261,0X4EA9,0X59C6,0X6BCD,0X5893,0X66AE,0X5E55,0X52DF,0X6155,0X6728,0X76EE,
-    0X7766,0X7267,0X7A46,0X62FF,0X54EA,0X5450,0X94A0,0X90A3,0X5A1C,0X7EB3,0X6C16,0X4E43,0X5976,0X8010,0X5948,0X5357,
-    0X7537,0X96BE,0X56CA,0X6320,0X8111,0X607C,0X95F9,0X6DD6,0X5462,0X9981,0X5185,0X5AE9,0X80FD,0X59AE,0X9713,0X502A,
-    0X6CE5,0X5C3C,0X62DF,0X4F60,0X533F,0X817B,0X9006,0X6EBA,0X852B,0X62C8,0X5E74,0X78BE,0X64B5,0X637B,0X5FF5,0X5A18,
-    0X917F,0X9E1F,0X5C3F,0X634F,0X8042,0X5B7D,0X556E,0X954A,0X954D,0X6D85,0X60A8,0X67E0,0X72DE,0X51DD,0X5B81,0X0001,
-    0X81D4,0X81D5,0X81D6,0X81D7,0X81D8,0X81D9,0X81DA,0X81DB,0X81DC,0X81DD,0X81DE,0X81DF,0X81E0,0X81E1,0X81E2,0X81E4,
-    0X81E5,0X81E6,0X81E8,0X81E9,0X81EB,0X81EE,0X81EF,0X81F0,0X81F1,0X81F2,0X81F5,0X81F6,0X81F7,0X81F8,0X81F9,0X81FA,
-    0X81FD,0X81FF,0X8203,0X8207,0X8208,0X8209,0X820A,0X820B,0X820E,0X820F,0X8211,0X8213,0X8215,0X8216,0X8217,0X8218,
-    0X8219,0X821A,0X821D,0X8220,0X8224,0X8225,0X8226,0X8227,0X8229,0X822E,0X8232,0X823A,0X823C,0X823D,0X823F,0X0001,
-    0X8240,0X8241,0X8242,0X8243,0X8245,0X8246,0X8248,0X824A,0X824C,0X824D,0X824E,0X8250,0X8251,0X8252,0X8253,0X8254,
-    0X8255,0X8256,0X8257,0X8259,0X825B,0X825C,0X825D,0X825E,0X8260,0X8261,0X8262,0X8263,0X8264,0X8265,0X8266,0X8267,
-    0X8269,0X62E7,0X6CDE,0X725B,0X626D,0X94AE,0X7EBD,0X8113,0X6D53,0X519C,0X5F04,0X5974,0X52AA,0X6012,0X5973,0X6696,
-    0X8650,0X759F,0X632A,0X61E6,0X7CEF,0X8BFA,0X54E6,0X6B27,0X9E25,0X6BB4,0X85D5,0X5455,0X5076,0X6CA4,0X556A,0X8DB4,
-    0X722C,0X5E15,0X6015,0X7436,0X62CD,0X6392,0X724C,0X5F98,0X6E43,0X6D3E,0X6500,0X6F58,0X76D8,0X78D0,0X76FC,0X7554,
-    0X5224,0X53DB,0X4E53,0X5E9E,0X65C1,0X802A,0X80D6,0X629B,0X5486,0X5228,0X70AE,0X888D,0X8DD1,0X6CE1,0X5478,0X80DA,
-    0X57F9,0X88F4,0X8D54,0X966A,0X914D,0X4F69,0X6C9B,0X55B7,0X76C6,0X7830,0X62A8,0X70F9,0X6F8E,0X5F6D,0X84EC,0X68DA,
-    0X787C,0X7BF7,0X81A8,0X670B,0X9E4F,0X6367,0X78B0,0X576F,0X7812,0X9739,0X6279,0X62AB,0X5288,0X7435,0X6BD7,0X0001,
-    0X826A,0X826B,0X826C,0X826D,0X8271,0X8275,0X8276,0X8277,0X8278,0X827B,0X827C,0X8280,0X8281,0X8283,0X8285,0X8286,
-    0X8287,0X8289,0X828C,0X8290,0X8293,0X8294,0X8295,0X8296,0X829A,0X829B,0X829E,0X82A0,0X82A2,0X82A3,0X82A7,0X82B2,
-    0X82B5,0X82B6,0X82BA,0X82BB,0X82BC,0X82BF,0X82C0,0X82C2,0X82C3,0X82C5,0X82C6,0X82C9,0X82D0,0X82D6,0X82D9,0X82DA,
-    0X82DD,0X82E2,0X82E7,0X82E8,0X82E9,0X82EA,0X82EC,0X82ED,0X82EE,0X82F0,0X82F2,0X82F3,0X82F5,0X82F6,0X82F8,0X0001,
-    0X82FA,0X82FC,0X82FD,0X82FE,0X82FF,0X8300,0X830A,0X830B,0X830D,0X8310,0X8312,0X8313,0X8316,0X8318,0X8319,0X831D,
-    0X831E,0X831F,0X8320,0X8321,0X8322,0X8323,0X8324,0X8325,0X8326,0X8329,0X832A,0X832E,0X8330,0X8332,0X8337,0X833B,
-    0X833D,0X5564,0X813E,0X75B2,0X76AE,0X5339,0X75DE,0X50FB,0X5C41,0X8B6C,0X7BC7,0X504F,0X7247,0X9A97,0X98D8,0X6F02,
-    0X74E2,0X7968,0X6487,0X77A5,0X62FC,0X9891,0X8D2B,0X54C1,0X8058,0X4E52,0X576A,0X82F9,0X840D,0X5E73,0X51ED,0X74F6,
-    0X8BC4,0X5C4F,0X5761,0X6CFC,0X9887,0X5A46,0X7834,0X9B44,0X8FEB,0X7C95,0X5256,0X6251,0X94FA,0X4EC6,0X8386,0X8461,
-    0X83E9,0X84B2,0X57D4,0X6734,0X5703,0X666E,0X6D66,0X8C31,0X66DD,0X7011,0X671F,0X6B3A,0X6816,0X621A,0X59BB,0X4E03,
-    0X51C4,0X6F06,0X67D2,0X6C8F,0X5176,0X68CB,0X5947,0X6B67,0X7566,0X5D0E,0X8110,0X9F50,0X65D7,0X7948,0X7941,0X9A91,
-    0X8D77,0X5C82,0X4E5E,0X4F01,0X542F,0X5951,0X780C,0X5668,0X6C14,0X8FC4,0X5F03,0X6C7D,0X6CE3,0X8BAB,0X6390,0X0001,
-    0X833E,0X833F,0X8341,0X8342,0X8344,0X8345,0X8348,0X834A,0X834B,0X834C,0X834D,0X834E,0X8353,0X8355,0X8356,0X8357,
-    0X8358,0X8359,0X835D,0X8362,0X8370,0X8371,0X8372,0X8373,0X8374,0X8375,0X8376,0X8379,0X837A,0X837E,0X837F,0X8380,
-    0X8381,0X8382,0X8383,0X8384,0X8387,0X8388,0X838A,0X838B,0X838C,0X838D,0X838F,0X8390,0X8391,0X8394,0X8395,0X8396,
-    0X8397,0X8399,0X839A,0X839D,0X839F,0X83A1,0X83A2,0X83A3,0X83A4,0X83A5,0X83A6,0X83A7,0X83AC,0X83AD,0X83AE,0X0001,
-    0X83AF,0X83B5,0X83BB,0X83BE,0X83BF,0X83C2,0X83C3,0X83C4,0X83C6,0X83C8,0X83C9,0X83CB,0X83CD,0X83CE,0X83D0,0X83D1,
-    0X83D2,0X83D3,0X83D5,0X83D7,0X83D9,0X83DA,0X83DB,0X83DE,0X83E2,0X83E3,0X83E4,0X83E6,0X83E7,0X83E8,0X83EB,0X83EC,
-    0X83ED,0X6070,0X6D3D,0X7275,0X6266,0X948E,0X94C5,0X5343,0X8FC1,0X7B7E,0X4EDF,0X8C26,0X4E7E,0X9ED4,0X94B1,0X94B3,
-    0X524D,0X6F5C,0X9063,0X6D45,0X8C34,0X5811,0X5D4C,0X6B20,0X6B49,0X67AA,0X545B,0X8154,0X7F8C,0X5899,0X8537,0X5F3A,
-    0X62A2,0X6A47,0X9539,0X6572,0X6084,0X6865,0X77A7,0X4E54,0X4FA8,0X5DE7,0X9798,0X64AC,0X7FD8,0X5CED,0X4FCF,0X7A8D,
-    0X5207,0X8304,0X4E14,0X602F,0X7A83,0X94A6,0X4FB5,0X4EB2,0X79E6,0X7434,0X52E4,0X82B9,0X64D2,0X79BD,0X5BDD,0X6C81,
-    0X9752,0X8F7B,0X6C22,0X503E,0X537F,0X6E05,0X64CE,0X6674,0X6C30,0X60C5,0X9877,0X8BF7,0X5E86,0X743C,0X7A77,0X79CB,
-    0X4E18,0X90B1,0X7403,0X6C42,0X56DA,0X914B,0X6CC5,0X8D8B,0X533A,0X86C6,0X66F2,0X8EAF,0X5C48,0X9A71,0X6E20,0X0001,
-    0X83EE,0X83EF,0X83F3,0X83F4,0X83F5,0X83F6,0X83F7,0X83FA,0X83FB,0X83FC,0X83FE,0X83FF,0X8400,0X8402,0X8405,0X8407,
-    0X8408,0X8409,0X840A,0X8410,0X8412,0X8413,0X8414,0X8415,0X8416,0X8417,0X8419,0X841A,0X841B,0X841E,0X841F,0X8420,
-    0X8421,0X8422,0X8423,0X8429,0X842A,0X842B,0X842C,0X842D,0X842E,0X842F,0X8430,0X8432,0X8433,0X8434,0X8435,0X8436,
-    0X8437,0X8439,0X843A,0X843B,0X843E,0X843F,0X8440,0X8441,0X8442,0X8443,0X8444,0X8445,0X8447,0X8448,0X8449,0X0001,
-    0X844A,0X844B,0X844C,0X844D,0X844E,0X844F,0X8450,0X8452,0X8453,0X8454,0X8455,0X8456,0X8458,0X845D,0X845E,0X845F,
-    0X8460,0X8462,0X8464,0X8465,0X8466,0X8467,0X8468,0X846A,0X846E,0X846F,0X8470,0X8472,0X8474,0X8477,0X8479,0X847B,
-    0X847C,0X53D6,0X5A36,0X9F8B,0X8DA3,0X53BB,0X5708,0X98A7,0X6743,0X919B,0X6CC9,0X5168,0X75CA,0X62F3,0X72AC,0X5238,
-    0X529D,0X7F3A,0X7094,0X7638,0X5374,0X9E4A,0X69B7,0X786E,0X96C0,0X88D9,0X7FA4,0X7136,0X71C3,0X5189,0X67D3,0X74E4,
-    0X58E4,0X6518,0X56B7,0X8BA9,0X9976,0X6270,0X7ED5,0X60F9,0X70ED,0X58EC,0X4EC1,0X4EBA,0X5FCD,0X97E7,0X4EFB,0X8BA4,
-    0X5203,0X598A,0X7EAB,0X6254,0X4ECD,0X65E5,0X620E,0X8338,0X84C9,0X8363,0X878D,0X7194,0X6EB6,0X5BB9,0X7ED2,0X5197,
-    0X63C9,0X67D4,0X8089,0X8339,0X8815,0X5112,0X5B7A,0X5982,0X8FB1,0X4E73,0X6C5D,0X5165,0X8925,0X8F6F,0X962E,0X854A,
-    0X745E,0X9510,0X95F0,0X6DA6,0X82E5,0X5F31,0X6492,0X6D12,0X8428,0X816E,0X9CC3,0X585E,0X8D5B,0X4E09,0X53C1,0X0001,
-    0X847D,0X847E,0X847F,0X8480,0X8481,0X8483,0X8484,0X8485,0X8486,0X848A,0X848D,0X848F,0X8490,0X8491,0X8492,0X8493,
-    0X8494,0X8495,0X8496,0X8498,0X849A,0X849B,0X849D,0X849E,0X849F,0X84A0,0X84A2,0X84A3,0X84A4,0X84A5,0X84A6,0X84A7,
-    0X84A8,0X84A9,0X84AA,0X84AB,0X84AC,0X84AD,0X84AE,0X84B0,0X84B1,0X84B3,0X84B5,0X84B6,0X84B7,0X84BB,0X84BC,0X84BE,
-    0X84C0,0X84C2,0X84C3,0X84C5,0X84C6,0X84C7,0X84C8,0X84CB,0X84CC,0X84CE,0X84CF,0X84D2,0X84D4,0X84D5,0X84D7,0X0001,
-    0X84D8,0X84D9,0X84DA,0X84DB,0X84DC,0X84DE,0X84E1,0X84E2,0X84E4,0X84E7,0X84E8,0X84E9,0X84EA,0X84EB,0X84ED,0X84EE,
-    0X84EF,0X84F1,0X84F2,0X84F3,0X84F4,0X84F5,0X84F6,0X84F7,0X84F8,0X84F9,0X84FA,0X84FB,0X84FD,0X84FE,0X8500,0X8501,
-    0X8502,0X4F1E,0X6563,0X6851,0X55D3,0X4E27,0X6414,0X9A9A,0X626B,0X5AC2,0X745F,0X8272,0X6DA9,0X68EE,0X50E7,0X838E,
-    0X7802,0X6740,0X5239,0X6C99,0X7EB1,0X50BB,0X5565,0X715E,0X7B5B,0X6652,0X73CA,0X82EB,0X6749,0X5C71,0X5220,0X717D,
-    0X886B,0X95EA,0X9655,0X64C5,0X8D61,0X81B3,0X5584,0X6C55,0X6247,0X7F2E,0X5892,0X4F24,0X5546,0X8D4F,0X664C,0X4E0A,
-    0X5C1A,0X88F3,0X68A2,0X634E,0X7A0D,0X70E7,0X828D,0X52FA,0X97F6,0X5C11,0X54E8,0X90B5,0X7ECD,0X5962,0X8D4A,0X86C7,
-    0X820C,0X820D,0X8D66,0X6444,0X5C04,0X6151,0X6D89,0X793E,0X8BBE,0X7837,0X7533,0X547B,0X4F38,0X8EAB,0X6DF1,0X5A20,
-    0X7EC5,0X795E,0X6C88,0X5BA1,0X5A76,0X751A,0X80BE,0X614E,0X6E17,0X58F0,0X751F,0X7525,0X7272,0X5347,0X7EF3,0X0001,
-    0X8503,0X8504,0X8505,0X8506,0X8507,0X8508,0X8509,0X850A,0X850B,0X850D,0X850E,0X850F,0X8510,0X8512,0X8514,0X8515,
-    0X8516,0X8518,0X8519,0X851B,0X851C,0X851D,0X851E,0X8520,0X8522,0X8523,0X8524,0X8525,0X8526,0X8527,0X8528,0X8529,
-    0X852A,0X852D,0X852E,0X852F,0X8530,0X8531,0X8532,0X8533,0X8534,0X8535,0X8536,0X853E,0X853F,0X8540,0X8541,0X8542,
-    0X8544,0X8545,0X8546,0X8547,0X854B,0X854C,0X854D,0X854E,0X854F,0X8550,0X8551,0X8552,0X8553,0X8554,0X8555,0X0001,
-    0X8557,0X8558,0X855A,0X855B,0X855C,0X855D,0X855F,0X8560,0X8561,0X8562,0X8563,0X8565,0X8566,0X8567,0X8569,0X856A,
-    0X856B,0X856C,0X856D,0X856E,0X856F,0X8570,0X8571,0X8573,0X8575,0X8576,0X8577,0X8578,0X857C,0X857D,0X857F,0X8580,
-    0X8581,0X7701,0X76DB,0X5269,0X80DC,0X5723,0X5E08,0X5931,0X72EE,0X65BD,0X6E7F,0X8BD7,0X5C38,0X8671,0X5341,0X77F3,
-    0X62FE,0X65F6,0X4EC0,0X98DF,0X8680,0X5B9E,0X8BC6,0X53F2,0X77E2,0X4F7F,0X5C4E,0X9A76,0X59CB,0X5F0F,0X793A,0X58EB,
-    0X4E16,0X67FF,0X4E8B,0X62ED,0X8A93,0X901D,0X52BF,0X662F,0X55DC,0X566C,0X9002,0X4ED5,0X4F8D,0X91CA,0X9970,0X6C0F,
-    0X5E02,0X6043,0X5BA4,0X89C6,0X8BD5,0X6536,0X624B,0X9996,0X5B88,0X5BFF,0X6388,0X552E,0X53D7,0X7626,0X517D,0X852C,
-    0X67A2,0X68B3,0X6B8A,0X6292,0X8F93,0X53D4,0X8212,0X6DD1,0X758F,0X4E66,0X8D4E,0X5B70,0X719F,0X85AF,0X6691,0X66D9,
-    0X7F72,0X8700,0X9ECD,0X9F20,0X5C5E,0X672F,0X8FF0,0X6811,0X675F,0X620D,0X7AD6,0X5885,0X5EB6,0X6570,0X6F31,0X0001,
-    0X8582,0X8583,0X8586,0X8588,0X8589,0X858A,0X858B,0X858C,0X858D,0X858E,0X8590,0X8591,0X8592,0X8593,0X8594,0X8595,
-    0X8596,0X8597,0X8598,0X8599,0X859A,0X859D,0X859E,0X859F,0X85A0,0X85A1,0X85A2,0X85A3,0X85A5,0X85A6,0X85A7,0X85A9,
-    0X85AB,0X85AC,0X85AD,0X85B1,0X85B2,0X85B3,0X85B4,0X85B5,0X85B6,0X85B8,0X85BA,0X85BB,0X85BC,0X85BD,0X85BE,0X85BF,
-    0X85C0,0X85C2,0X85C3,0X85C4,0X85C5,0X85C6,0X85C7,0X85C8,0X85CA,0X85CB,0X85CC,0X85CD,0X85CE,0X85D1,0X85D2,0X0001,
-    0X85D4,0X85D6,0X85D7,0X85D8,0X85D9,0X85DA,0X85DB,0X85DD,0X85DE,0X85DF,0X85E0,0X85E1,0X85E2,0X85E3,0X85E5,0X85E6,
-    0X85E7,0X85E8,0X85EA,0X85EB,0X85EC,0X85ED,0X85EE,0X85EF,0X85F0,0X85F1,0X85F2,0X85F3,0X85F4,0X85F5,0X85F6,0X85F7,
-    0X85F8,0X6055,0X5237,0X800D,0X6454,0X8870,0X7529,0X5E05,0X6813,0X62F4,0X971C,0X53CC,0X723D,0X8C01,0X6C34,0X7761,
-    0X7A0E,0X542E,0X77AC,0X987A,0X821C,0X8BF4,0X7855,0X6714,0X70C1,0X65AF,0X6495,0X5636,0X601D,0X79C1,0X53F8,0X4E1D,
-    0X6B7B,0X8086,0X5BFA,0X55E3,0X56DB,0X4F3A,0X4F3C,0X9972,0X5DF3,0X677E,0X8038,0X6002,0X9882,0X9001,0X5B8B,0X8BBC,
-    0X8BF5,0X641C,0X8258,0X64DE,0X55FD,0X82CF,0X9165,0X4FD7,0X7D20,0X901F,0X7C9F,0X50F3,0X5851,0X6EAF,0X5BBF,0X8BC9,
-    0X8083,0X9178,0X849C,0X7B97,0X867D,0X968B,0X968F,0X7EE5,0X9AD3,0X788E,0X5C81,0X7A57,0X9042,0X96A7,0X795F,0X5B59,
-    0X635F,0X7B0B,0X84D1,0X68AD,0X5506,0X7F29,0X7410,0X7D22,0X9501,0X6240,0X584C,0X4ED6,0X5B83,0X5979,0X5854,0X0001,
-    0X85F9,0X85FA,0X85FC,0X85FD,0X85FE,0X8600,0X8601,0X8602,0X8603,0X8604,0X8606,0X8607,0X8608,0X8609,0X860A,0X860B,
-    0X860C,0X860D,0X860E,0X860F,0X8610,0X8612,0X8613,0X8614,0X8615,0X8617,0X8618,0X8619,0X861A,0X861B,0X861C,0X861D,
-    0X861E,0X861F,0X8620,0X8621,0X8622,0X8623,0X8624,0X8625,0X8626,0X8628,0X862A,0X862B,0X862C,0X862D,0X862E,0X862F,
-    0X8630,0X8631,0X8632,0X8633,0X8634,0X8635,0X8636,0X8637,0X8639,0X863A,0X863B,0X863D,0X863E,0X863F,0X8640,0X0001,
-    0X8641,0X8642,0X8643,0X8644,0X8645,0X8646,0X8647,0X8648,0X8649,0X864A,0X864B,0X864C,0X8652,0X8653,0X8655,0X8656,
-    0X8657,0X8658,0X8659,0X865B,0X865C,0X865D,0X865F,0X8660,0X8661,0X8663,0X8664,0X8665,0X8666,0X8667,0X8668,0X8669,
-    0X866A,0X736D,0X631E,0X8E4B,0X8E0F,0X80CE,0X82D4,0X62AC,0X53F0,0X6CF0,0X915E,0X592A,0X6001,0X6C70,0X574D,0X644A,
-    0X8D2A,0X762B,0X6EE9,0X575B,0X6A80,0X75F0,0X6F6D,0X8C2D,0X8C08,0X5766,0X6BEF,0X8892,0X78B3,0X63A2,0X53F9,0X70AD,
-    0X6C64,0X5858,0X642A,0X5802,0X68E0,0X819B,0X5510,0X7CD6,0X5018,0X8EBA,0X6DCC,0X8D9F,0X70EB,0X638F,0X6D9B,0X6ED4,
-    0X7EE6,0X8404,0X6843,0X9003,0X6DD8,0X9676,0X8BA8,0X5957,0X7279,0X85E4,0X817E,0X75BC,0X8A8A,0X68AF,0X5254,0X8E22,
-    0X9511,0X63D0,0X9898,0X8E44,0X557C,0X4F53,0X66FF,0X568F,0X60D5,0X6D95,0X5243,0X5C49,0X5929,0X6DFB,0X586B,0X7530,
-    0X751C,0X606C,0X8214,0X8146,0X6311,0X6761,0X8FE2,0X773A,0X8DF3,0X8D34,0X94C1,0X5E16,0X5385,0X542C,0X70C3,0X0001,
-    0X866D,0X866F,0X8670,0X8672,0X8673,0X8674,0X8675,0X8676,0X8677,0X8678,0X8683,0X8684,0X8685,0X8686,0X8687,0X8688,
-    0X8689,0X868E,0X868F,0X8690,0X8691,0X8692,0X8694,0X8696,0X8697,0X8698,0X8699,0X869A,0X869B,0X869E,0X869F,0X86A0,
-    0X86A1,0X86A2,0X86A5,0X86A6,0X86AB,0X86AD,0X86AE,0X86B2,0X86B3,0X86B7,0X86B8,0X86B9,0X86BB,0X86BC,0X86BD,0X86BE,
-    0X86BF,0X86C1,0X86C2,0X86C3,0X86C5,0X86C8,0X86CC,0X86CD,0X86D2,0X86D3,0X86D5,0X86D6,0X86D7,0X86DA,0X86DC,0X0001,
-    0X86DD,0X86E0,0X86E1,0X86E2,0X86E3,0X86E5,0X86E6,0X86E7,0X86E8,0X86EA,0X86EB,0X86EC,0X86EF,0X86F5,0X86F6,0X86F7,
-    0X86FA,0X86FB,0X86FC,0X86FD,0X86FF,0X8701,0X8704,0X8705,0X8706,0X870B,0X870C,0X870E,0X870F,0X8710,0X8711,0X8714,
-    0X8716,0X6C40,0X5EF7,0X505C,0X4EAD,0X5EAD,0X633A,0X8247,0X901A,0X6850,0X916E,0X77B3,0X540C,0X94DC,0X5F64,0X7AE5,
-    0X6876,0X6345,0X7B52,0X7EDF,0X75DB,0X5077,0X6295,0X5934,0X900F,0X51F8,0X79C3,0X7A81,0X56FE,0X5F92,0X9014,0X6D82,
-    0X5C60,0X571F,0X5410,0X5154,0X6E4D,0X56E2,0X63A8,0X9893,0X817F,0X8715,0X892A,0X9000,0X541E,0X5C6F,0X81C0,0X62D6,
-    0X6258,0X8131,0X9E35,0X9640,0X9A6E,0X9A7C,0X692D,0X59A5,0X62D3,0X553E,0X6316,0X54C7,0X86D9,0X6D3C,0X5A03,0X74E6,
-    0X889C,0X6B6A,0X5916,0X8C4C,0X5F2F,0X6E7E,0X73A9,0X987D,0X4E38,0X70F7,0X5B8C,0X7897,0X633D,0X665A,0X7696,0X60CB,
-    0X5B9B,0X5A49,0X4E07,0X8155,0X6C6A,0X738B,0X4EA1,0X6789,0X7F51,0X5F80,0X65FA,0X671B,0X5FD8,0X5984,0X5A01,0X0001,
-    0X8719,0X871B,0X871D,0X871F,0X8720,0X8724,0X8726,0X8727,0X8728,0X872A,0X872B,0X872C,0X872D,0X872F,0X8730,0X8732,
-    0X8733,0X8735,0X8736,0X8738,0X8739,0X873A,0X873C,0X873D,0X8740,0X8741,0X8742,0X8743,0X8744,0X8745,0X8746,0X874A,
-    0X874B,0X874D,0X874F,0X8750,0X8751,0X8752,0X8754,0X8755,0X8756,0X8758,0X875A,0X875B,0X875C,0X875D,0X875E,0X875F,
-    0X8761,0X8762,0X8766,0X8767,0X8768,0X8769,0X876A,0X876B,0X876C,0X876D,0X876F,0X8771,0X8772,0X8773,0X8775,0X0001,
-    0X8777,0X8778,0X8779,0X877A,0X877F,0X8780,0X8781,0X8784,0X8786,0X8787,0X8789,0X878A,0X878C,0X878E,0X878F,0X8790,
-    0X8791,0X8792,0X8794,0X8795,0X8796,0X8798,0X8799,0X879A,0X879B,0X879C,0X879D,0X879E,0X87A0,0X87A1,0X87A2,0X87A3,
-    0X87A4,0X5DCD,0X5FAE,0X5371,0X97E6,0X8FDD,0X6845,0X56F4,0X552F,0X60DF,0X4E3A,0X6F4D,0X7EF4,0X82C7,0X840E,0X59D4,
-    0X4F1F,0X4F2A,0X5C3E,0X7EAC,0X672A,0X851A,0X5473,0X754F,0X80C3,0X5582,0X9B4F,0X4F4D,0X6E2D,0X8C13,0X5C09,0X6170,
-    0X536B,0X761F,0X6E29,0X868A,0X6587,0X95FB,0X7EB9,0X543B,0X7A33,0X7D0A,0X95EE,0X55E1,0X7FC1,0X74EE,0X631D,0X8717,
-    0X6DA1,0X7A9D,0X6211,0X65A1,0X5367,0X63E1,0X6C83,0X5DEB,0X545C,0X94A8,0X4E4C,0X6C61,0X8BEC,0X5C4B,0X65E0,0X829C,
-    0X68A7,0X543E,0X5434,0X6BCB,0X6B66,0X4E94,0X6342,0X5348,0X821E,0X4F0D,0X4FAE,0X575E,0X620A,0X96FE,0X6664,0X7269,
-    0X52FF,0X52A1,0X609F,0X8BEF,0X6614,0X7199,0X6790,0X897F,0X7852,0X77FD,0X6670,0X563B,0X5438,0X9521,0X727A,0X0001,
-    0X87A5,0X87A6,0X87A7,0X87A9,0X87AA,0X87AE,0X87B0,0X87B1,0X87B2,0X87B4,0X87B6,0X87B7,0X87B8,0X87B9,0X87BB,0X87BC,
-    0X87BE,0X87BF,0X87C1,0X87C2,0X87C3,0X87C4,0X87C5,0X87C7,0X87C8,0X87C9,0X87CC,0X87CD,0X87CE,0X87CF,0X87D0,0X87D4,
-    0X87D5,0X87D6,0X87D7,0X87D8,0X87D9,0X87DA,0X87DC,0X87DD,0X87DE,0X87DF,0X87E1,0X87E2,0X87E3,0X87E4,0X87E6,0X87E7,
-    0X87E8,0X87E9,0X87EB,0X87EC,0X87ED,0X87EF,0X87F0,0X87F1,0X87F2,0X87F3,0X87F4,0X87F5,0X87F6,0X87F7,0X87F8,0X0001,
-    0X87FA,0X87FB,0X87FC,0X87FD,0X87FF,0X8800,0X8801,0X8802,0X8804,0X8805,0X8806,0X8807,0X8808,0X8809,0X880B,0X880C,
-    0X880D,0X880E,0X880F,0X8810,0X8811,0X8812,0X8814,0X8817,0X8818,0X8819,0X881A,0X881C,0X881D,0X881E,0X881F,0X8820,
-    0X8823,0X7A00,0X606F,0X5E0C,0X6089,0X819D,0X5915,0X60DC,0X7184,0X70EF,0X6EAA,0X6C50,0X7280,0X6A84,0X88AD,0X5E2D,
-    0X4E60,0X5AB3,0X559C,0X94E3,0X6D17,0X7CFB,0X9699,0X620F,0X7EC6,0X778E,0X867E,0X5323,0X971E,0X8F96,0X6687,0X5CE1,
-    0X4FA0,0X72ED,0X4E0B,0X53A6,0X590F,0X5413,0X6380,0X9528,0X5148,0X4ED9,0X9C9C,0X7EA4,0X54B8,0X8D24,0X8854,0X8237,
-    0X95F2,0X6D8E,0X5F26,0X5ACC,0X663E,0X9669,0X73B0,0X732E,0X53BF,0X817A,0X9985,0X7FA1,0X5BAA,0X9677,0X9650,0X7EBF,
-    0X76F8,0X53A2,0X9576,0X9999,0X7BB1,0X8944,0X6E58,0X4E61,0X7FD4,0X7965,0X8BE6,0X60F3,0X54CD,0X4EAB,0X9879,0X5DF7,
-    0X6A61,0X50CF,0X5411,0X8C61,0X8427,0X785D,0X9704,0X524A,0X54EE,0X56A3,0X9500,0X6D88,0X5BB5,0X6DC6,0X6653,0X0001,
-    0X8824,0X8825,0X8826,0X8827,0X8828,0X8829,0X882A,0X882B,0X882C,0X882D,0X882E,0X882F,0X8830,0X8831,0X8833,0X8834,
-    0X8835,0X8836,0X8837,0X8838,0X883A,0X883B,0X883D,0X883E,0X883F,0X8841,0X8842,0X8843,0X8846,0X8847,0X8848,0X8849,
-    0X884A,0X884B,0X884E,0X884F,0X8850,0X8851,0X8852,0X8853,0X8855,0X8856,0X8858,0X885A,0X885B,0X885C,0X885D,0X885E,
-    0X885F,0X8860,0X8866,0X8867,0X886A,0X886D,0X886F,0X8871,0X8873,0X8874,0X8875,0X8876,0X8878,0X8879,0X887A,0X0001,
-    0X887B,0X887C,0X8880,0X8883,0X8886,0X8887,0X8889,0X888A,0X888C,0X888E,0X888F,0X8890,0X8891,0X8893,0X8894,0X8895,
-    0X8897,0X8898,0X8899,0X889A,0X889B,0X889D,0X889E,0X889F,0X88A0,0X88A1,0X88A3,0X88A5,0X88A6,0X88A7,0X88A8,0X88A9,
-    0X88AA,0X5C0F,0X5B5D,0X6821,0X8096,0X5578,0X7B11,0X6548,0X6954,0X4E9B,0X6B47,0X874E,0X978B,0X534F,0X631F,0X643A,
-    0X90AA,0X659C,0X80C1,0X8C10,0X5199,0X68B0,0X5378,0X87F9,0X61C8,0X6CC4,0X6CFB,0X8C22,0X5C51,0X85AA,0X82AF,0X950C,
-    0X6B23,0X8F9B,0X65B0,0X5FFB,0X5FC3,0X4FE1,0X8845,0X661F,0X8165,0X7329,0X60FA,0X5174,0X5211,0X578B,0X5F62,0X90A2,
-    0X884C,0X9192,0X5E78,0X674F,0X6027,0X59D3,0X5144,0X51F6,0X80F8,0X5308,0X6C79,0X96C4,0X718A,0X4F11,0X4FEE,0X7F9E,
-    0X673D,0X55C5,0X9508,0X79C0,0X8896,0X7EE3,0X589F,0X620C,0X9700,0X865A,0X5618,0X987B,0X5F90,0X8BB8,0X84C4,0X9157,
-    0X53D9,0X65ED,0X5E8F,0X755C,0X6064,0X7D6E,0X5A7F,0X7EEA,0X7EED,0X8F69,0X55A7,0X5BA3,0X60AC,0X65CB,0X7384,0X0001,
-    0X88AC,0X88AE,0X88AF,0X88B0,0X88B2,0X88B3,0X88B4,0X88B5,0X88B6,0X88B8,0X88B9,0X88BA,0X88BB,0X88BD,0X88BE,0X88BF,
-    0X88C0,0X88C3,0X88C4,0X88C7,0X88C8,0X88CA,0X88CB,0X88CC,0X88CD,0X88CF,0X88D0,0X88D1,0X88D3,0X88D6,0X88D7,0X88DA,
-    0X88DB,0X88DC,0X88DD,0X88DE,0X88E0,0X88E1,0X88E6,0X88E7,0X88E9,0X88EA,0X88EB,0X88EC,0X88ED,0X88EE,0X88EF,0X88F2,
-    0X88F5,0X88F6,0X88F7,0X88FA,0X88FB,0X88FD,0X88FF,0X8900,0X8901,0X8903,0X8904,0X8905,0X8906,0X8907,0X8908,0X0001,
-    0X8909,0X890B,0X890C,0X890D,0X890E,0X890F,0X8911,0X8914,0X8915,0X8916,0X8917,0X8918,0X891C,0X891D,0X891E,0X891F,
-    0X8920,0X8922,0X8923,0X8924,0X8926,0X8927,0X8928,0X8929,0X892C,0X892D,0X892E,0X892F,0X8931,0X8932,0X8933,0X8935,
-    0X8937,0X9009,0X7663,0X7729,0X7EDA,0X9774,0X859B,0X5B66,0X7A74,0X96EA,0X8840,0X52CB,0X718F,0X5FAA,0X65EC,0X8BE2,
-    0X5BFB,0X9A6F,0X5DE1,0X6B89,0X6C5B,0X8BAD,0X8BAF,0X900A,0X8FC5,0X538B,0X62BC,0X9E26,0X9E2D,0X5440,0X4E2B,0X82BD,
-    0X7259,0X869C,0X5D16,0X8859,0X6DAF,0X96C5,0X54D1,0X4E9A,0X8BB6,0X7109,0X54BD,0X9609,0X70DF,0X6DF9,0X76D0,0X4E25,
-    0X7814,0X8712,0X5CA9,0X5EF6,0X8A00,0X989C,0X960E,0X708E,0X6CBF,0X5944,0X63A9,0X773C,0X884D,0X6F14,0X8273,0X5830,
-    0X71D5,0X538C,0X781A,0X96C1,0X5501,0X5F66,0X7130,0X5BB4,0X8C1A,0X9A8C,0X6B83,0X592E,0X9E2F,0X79E7,0X6768,0X626C,
-    0X4F6F,0X75A1,0X7F8A,0X6D0B,0X9633,0X6C27,0X4EF0,0X75D2,0X517B,0X6837,0X6F3E,0X9080,0X8170,0X5996,0X7476,0X0001,
-    0X8938,0X8939,0X893A,0X893B,0X893C,0X893D,0X893E,0X893F,0X8940,0X8942,0X8943,0X8945,0X8946,0X8947,0X8948,0X8949,
-    0X894A,0X894B,0X894C,0X894D,0X894E,0X894F,0X8950,0X8951,0X8952,0X8953,0X8954,0X8955,0X8956,0X8957,0X8958,0X8959,
-    0X895A,0X895B,0X895C,0X895D,0X8960,0X8961,0X8962,0X8963,0X8964,0X8965,0X8967,0X8968,0X8969,0X896A,0X896B,0X896C,
-    0X896D,0X896E,0X896F,0X8970,0X8971,0X8972,0X8973,0X8974,0X8975,0X8976,0X8977,0X8978,0X8979,0X897A,0X897C,0X0001,
-    0X897D,0X897E,0X8980,0X8982,0X8984,0X8985,0X8987,0X8988,0X8989,0X898A,0X898B,0X898C,0X898D,0X898E,0X898F,0X8990,
-    0X8991,0X8992,0X8993,0X8994,0X8995,0X8996,0X8997,0X8998,0X8999,0X899A,0X899B,0X899C,0X899D,0X899E,0X899F,0X89A0,
-    0X89A1,0X6447,0X5C27,0X9065,0X7A91,0X8C23,0X59DA,0X54AC,0X8200,0X836F,0X8981,0X8000,0X6930,0X564E,0X8036,0X7237,
-    0X91CE,0X51B6,0X4E5F,0X9875,0X6396,0X4E1A,0X53F6,0X66F3,0X814B,0X591C,0X6DB2,0X4E00,0X58F9,0X533B,0X63D6,0X94F1,
-    0X4F9D,0X4F0A,0X8863,0X9890,0X5937,0X9057,0X79FB,0X4EEA,0X80F0,0X7591,0X6C82,0X5B9C,0X59E8,0X5F5D,0X6905,0X8681,
-    0X501A,0X5DF2,0X4E59,0X77E3,0X4EE5,0X827A,0X6291,0X6613,0X9091,0X5C79,0X4EBF,0X5F79,0X81C6,0X9038,0X8084,0X75AB,
-    0X4EA6,0X88D4,0X610F,0X6BC5,0X5FC6,0X4E49,0X76CA,0X6EA2,0X8BE3,0X8BAE,0X8C0A,0X8BD1,0X5F02,0X7FFC,0X7FCC,0X7ECE,
-    0X8335,0X836B,0X56E0,0X6BB7,0X97F3,0X9634,0X59FB,0X541F,0X94F6,0X6DEB,0X5BC5,0X996E,0X5C39,0X5F15,0X9690,0X0001,
-    0X89A2,0X89A3,0X89A4,0X89A5,0X89A6,0X89A7,0X89A8,0X89A9,0X89AA,0X89AB,0X89AC,0X89AD,0X89AE,0X89AF,0X89B0,0X89B1,
-    0X89B2,0X89B3,0X89B4,0X89B5,0X89B6,0X89B7,0X89B8,0X89B9,0X89BA,0X89BB,0X89BC,0X89BD,0X89BE,0X89BF,0X89C0,0X89C3,
-    0X89CD,0X89D3,0X89D4,0X89D5,0X89D7,0X89D8,0X89D9,0X89DB,0X89DD,0X89DF,0X89E0,0X89E1,0X89E2,0X89E4,0X89E7,0X89E8,
-    0X89E9,0X89EA,0X89EC,0X89ED,0X89EE,0X89F0,0X89F1,0X89F2,0X89F4,0X89F5,0X89F6,0X89F7,0X89F8,0X89F9,0X89FA,0X0001,
-    0X89FB,0X89FC,0X89FD,0X89FE,0X89FF,0X8A01,0X8A02,0X8A03,0X8A04,0X8A05,0X8A06,0X8A08,0X8A09,0X8A0A,0X8A0B,0X8A0C,
-    0X8A0D,0X8A0E,0X8A0F,0X8A10,0X8A11,0X8A12,0X8A13,0X8A14,0X8A15,0X8A16,0X8A17,0X8A18,0X8A19,0X8A1A,0X8A1B,0X8A1C,
-    0X8A1D,0X5370,0X82F1,0X6A31,0X5A74,0X9E70,0X5E94,0X7F28,0X83B9,0X8424,0X8425,0X8367,0X8747,0X8FCE,0X8D62,0X76C8,
-    0X5F71,0X9896,0X786C,0X6620,0X54DF,0X62E5,0X4F63,0X81C3,0X75C8,0X5EB8,0X96CD,0X8E0A,0X86F9,0X548F,0X6CF3,0X6D8C,
-    0X6C38,0X607F,0X52C7,0X7528,0X5E7D,0X4F18,0X60A0,0X5FE7,0X5C24,0X7531,0X90AE,0X94C0,0X72B9,0X6CB9,0X6E38,0X9149,
-    0X6709,0X53CB,0X53F3,0X4F51,0X91C9,0X8BF1,0X53C8,0X5E7C,0X8FC2,0X6DE4,0X4E8E,0X76C2,0X6986,0X865E,0X611A,0X8206,
-    0X4F59,0X4FDE,0X903E,0X9C7C,0X6109,0X6E1D,0X6E14,0X9685,0X4E88,0X5A31,0X96E8,0X4E0E,0X5C7F,0X79B9,0X5B87,0X8BED,
-    0X7FBD,0X7389,0X57DF,0X828B,0X90C1,0X5401,0X9047,0X55BB,0X5CEA,0X5FA1,0X6108,0X6B32,0X72F1,0X80B2,0X8A89,0X0001,
-    0X8A1E,0X8A1F,0X8A20,0X8A21,0X8A22,0X8A23,0X8A24,0X8A25,0X8A26,0X8A27,0X8A28,0X8A29,0X8A2A,0X8A2B,0X8A2C,0X8A2D,
-    0X8A2E,0X8A2F,0X8A30,0X8A31,0X8A32,0X8A33,0X8A34,0X8A35,0X8A36,0X8A37,0X8A38,0X8A39,0X8A3A,0X8A3B,0X8A3C,0X8A3D,
-    0X8A3F,0X8A40,0X8A41,0X8A42,0X8A43,0X8A44,0X8A45,0X8A46,0X8A47,0X8A49,0X8A4A,0X8A4B,0X8A4C,0X8A4D,0X8A4E,0X8A4F,
-    0X8A50,0X8A51,0X8A52,0X8A53,0X8A54,0X8A55,0X8A56,0X8A57,0X8A58,0X8A59,0X8A5A,0X8A5B,0X8A5C,0X8A5D,0X8A5E,0X0001,
-    0X8A5F,0X8A60,0X8A61,0X8A62,0X8A63,0X8A64,0X8A65,0X8A66,0X8A67,0X8A68,0X8A69,0X8A6A,0X8A6B,0X8A6C,0X8A6D,0X8A6E,
-    0X8A6F,0X8A70,0X8A71,0X8A72,0X8A73,0X8A74,0X8A75,0X8A76,0X8A77,0X8A78,0X8A7A,0X8A7B,0X8A7C,0X8A7D,0X8A7E,0X8A7F,
-    0X8A80,0X6D74,0X5BD3,0X88D5,0X9884,0X8C6B,0X9A6D,0X9E33,0X6E0A,0X51A4,0X5143,0X57A3,0X8881,0X539F,0X63F4,0X8F95,
-    0X56ED,0X5458,0X5706,0X733F,0X6E90,0X7F18,0X8FDC,0X82D1,0X613F,0X6028,0X9662,0X66F0,0X7EA6,0X8D8A,0X8DC3,0X94A5,
-    0X5CB3,0X7CA4,0X6708,0X60A6,0X9605,0X8018,0X4E91,0X90E7,0X5300,0X9668,0X5141,0X8FD0,0X8574,0X915D,0X6655,0X97F5,
-    0X5B55,0X531D,0X7838,0X6742,0X683D,0X54C9,0X707E,0X5BB0,0X8F7D,0X518D,0X5728,0X54B1,0X6512,0X6682,0X8D5E,0X8D43,
-    0X810F,0X846C,0X906D,0X7CDF,0X51FF,0X85FB,0X67A3,0X65E9,0X6FA1,0X86A4,0X8E81,0X566A,0X9020,0X7682,0X7076,0X71E5,
-    0X8D23,0X62E9,0X5219,0X6CFD,0X8D3C,0X600E,0X589E,0X618E,0X66FE,0X8D60,0X624E,0X55B3,0X6E23,0X672D,0X8F67,0X0001,
-    0X8A81,0X8A82,0X8A83,0X8A84,0X8A85,0X8A86,0X8A87,0X8A88,0X8A8B,0X8A8C,0X8A8D,0X8A8E,0X8A8F,0X8A90,0X8A91,0X8A92,
-    0X8A94,0X8A95,0X8A96,0X8A97,0X8A98,0X8A99,0X8A9A,0X8A9B,0X8A9C,0X8A9D,0X8A9E,0X8A9F,0X8AA0,0X8AA1,0X8AA2,0X8AA3,
-    0X8AA4,0X8AA5,0X8AA6,0X8AA7,0X8AA8,0X8AA9,0X8AAA,0X8AAB,0X8AAC,0X8AAD,0X8AAE,0X8AAF,0X8AB0,0X8AB1,0X8AB2,0X8AB3,
-    0X8AB4,0X8AB5,0X8AB6,0X8AB7,0X8AB8,0X8AB9,0X8ABA,0X8ABB,0X8ABC,0X8ABD,0X8ABE,0X8ABF,0X8AC0,0X8AC1,0X8AC2,0X0001,
-    0X8AC3,0X8AC4,0X8AC5,0X8AC6,0X8AC7,0X8AC8,0X8AC9,0X8ACA,0X8ACB,0X8ACC,0X8ACD,0X8ACE,0X8ACF,0X8AD0,0X8AD1,0X8AD2,
-    0X8AD3,0X8AD4,0X8AD5,0X8AD6,0X8AD7,0X8AD8,0X8AD9,0X8ADA,0X8ADB,0X8ADC,0X8ADD,0X8ADE,0X8ADF,0X8AE0,0X8AE1,0X8AE2,
-    0X8AE3,0X94E1,0X95F8,0X7728,0X6805,0X69A8,0X548B,0X4E4D,0X70B8,0X8BC8,0X6458,0X658B,0X5B85,0X7A84,0X503A,0X5BE8,
-    0X77BB,0X6BE1,0X8A79,0X7C98,0X6CBE,0X76CF,0X65A9,0X8F97,0X5D2D,0X5C55,0X8638,0X6808,0X5360,0X6218,0X7AD9,0X6E5B,
-    0X7EFD,0X6A1F,0X7AE0,0X5F70,0X6F33,0X5F20,0X638C,0X6DA8,0X6756,0X4E08,0X5E10,0X8D26,0X4ED7,0X80C0,0X7634,0X969C,
-    0X62DB,0X662D,0X627E,0X6CBC,0X8D75,0X7167,0X7F69,0X5146,0X8087,0X53EC,0X906E,0X6298,0X54F2,0X86F0,0X8F99,0X8005,
-    0X9517,0X8517,0X8FD9,0X6D59,0X73CD,0X659F,0X771F,0X7504,0X7827,0X81FB,0X8D1E,0X9488,0X4FA6,0X6795,0X75B9,0X8BCA,
-    0X9707,0X632F,0X9547,0X9635,0X84B8,0X6323,0X7741,0X5F81,0X72F0,0X4E89,0X6014,0X6574,0X62EF,0X6B63,0X653F,0X0001,
-    0X8AE4,0X8AE5,0X8AE6,0X8AE7,0X8AE8,0X8AE9,0X8AEA,0X8AEB,0X8AEC,0X8AED,0X8AEE,0X8AEF,0X8AF0,0X8AF1,0X8AF2,0X8AF3,
-    0X8AF4,0X8AF5,0X8AF6,0X8AF7,0X8AF8,0X8AF9,0X8AFA,0X8AFB,0X8AFC,0X8AFD,0X8AFE,0X8AFF,0X8B00,0X8B01,0X8B02,0X8B03,
-    0X8B04,0X8B05,0X8B06,0X8B08,0X8B09,0X8B0A,0X8B0B,0X8B0C,0X8B0D,0X8B0E,0X8B0F,0X8B10,0X8B11,0X8B12,0X8B13,0X8B14,
-    0X8B15,0X8B16,0X8B17,0X8B18,0X8B19,0X8B1A,0X8B1B,0X8B1C,0X8B1D,0X8B1E,0X8B1F,0X8B20,0X8B21,0X8B22,0X8B23,0X0001,
-    0X8B24,0X8B25,0X8B27,0X8B28,0X8B29,0X8B2A,0X8B2B,0X8B2C,0X8B2D,0X8B2E,0X8B2F,0X8B30,0X8B31,0X8B32,0X8B33,0X8B34,
-    0X8B35,0X8B36,0X8B37,0X8B38,0X8B39,0X8B3A,0X8B3B,0X8B3C,0X8B3D,0X8B3E,0X8B3F,0X8B40,0X8B41,0X8B42,0X8B43,0X8B44,
-    0X8B45,0X5E27,0X75C7,0X90D1,0X8BC1,0X829D,0X679D,0X652F,0X5431,0X8718,0X77E5,0X80A2,0X8102,0X6C41,0X4E4B,0X7EC7,
-    0X804C,0X76F4,0X690D,0X6B96,0X6267,0X503C,0X4F84,0X5740,0X6307,0X6B62,0X8DBE,0X53EA,0X65E8,0X7EB8,0X5FD7,0X631A,
-    0X63B7,0X81F3,0X81F4,0X7F6E,0X5E1C,0X5CD9,0X5236,0X667A,0X79E9,0X7A1A,0X8D28,0X7099,0X75D4,0X6EDE,0X6CBB,0X7A92,
-    0X4E2D,0X76C5,0X5FE0,0X949F,0X8877,0X7EC8,0X79CD,0X80BF,0X91CD,0X4EF2,0X4F17,0X821F,0X5468,0X5DDE,0X6D32,0X8BCC,
-    0X7CA5,0X8F74,0X8098,0X5E1A,0X5492,0X76B1,0X5B99,0X663C,0X9AA4,0X73E0,0X682A,0X86DB,0X6731,0X732A,0X8BF8,0X8BDB,
-    0X9010,0X7AF9,0X70DB,0X716E,0X62C4,0X77A9,0X5631,0X4E3B,0X8457,0X67F1,0X52A9,0X86C0,0X8D2E,0X94F8,0X7B51,0X0001,
-    0X8B46,0X8B47,0X8B48,0X8B49,0X8B4A,0X8B4B,0X8B4C,0X8B4D,0X8B4E,0X8B4F,0X8B50,0X8B51,0X8B52,0X8B53,0X8B54,0X8B55,
-    0X8B56,0X8B57,0X8B58,0X8B59,0X8B5A,0X8B5B,0X8B5C,0X8B5D,0X8B5E,0X8B5F,0X8B60,0X8B61,0X8B62,0X8B63,0X8B64,0X8B65,
-    0X8B67,0X8B68,0X8B69,0X8B6A,0X8B6B,0X8B6D,0X8B6E,0X8B6F,0X8B70,0X8B71,0X8B72,0X8B73,0X8B74,0X8B75,0X8B76,0X8B77,
-    0X8B78,0X8B79,0X8B7A,0X8B7B,0X8B7C,0X8B7D,0X8B7E,0X8B7F,0X8B80,0X8B81,0X8B82,0X8B83,0X8B84,0X8B85,0X8B86,0X0001,
-    0X8B87,0X8B88,0X8B89,0X8B8A,0X8B8B,0X8B8C,0X8B8D,0X8B8E,0X8B8F,0X8B90,0X8B91,0X8B92,0X8B93,0X8B94,0X8B95,0X8B96,
-    0X8B97,0X8B98,0X8B99,0X8B9A,0X8B9B,0X8B9C,0X8B9D,0X8B9E,0X8B9F,0X8BAC,0X8BB1,0X8BBB,0X8BC7,0X8BD0,0X8BEA,0X8C09,
-    0X8C1E,0X4F4F,0X6CE8,0X795D,0X9A7B,0X6293,0X722A,0X62FD,0X4E13,0X7816,0X8F6C,0X64B0,0X8D5A,0X7BC6,0X6869,0X5E84,
-    0X88C5,0X5986,0X649E,0X58EE,0X72B6,0X690E,0X9525,0X8FFD,0X8D58,0X5760,0X7F00,0X8C06,0X51C6,0X6349,0X62D9,0X5353,
-    0X684C,0X7422,0X8301,0X914C,0X5544,0X7740,0X707C,0X6D4A,0X5179,0X54A8,0X8D44,0X59FF,0X6ECB,0X6DC4,0X5B5C,0X7D2B,
-    0X4ED4,0X7C7D,0X6ED3,0X5B50,0X81EA,0X6E0D,0X5B57,0X9B03,0X68D5,0X8E2A,0X5B97,0X7EFC,0X603B,0X7EB5,0X90B9,0X8D70,
-    0X594F,0X63CD,0X79DF,0X8DB3,0X5352,0X65CF,0X7956,0X8BC5,0X963B,0X7EC4,0X94BB,0X7E82,0X5634,0X9189,0X6700,0X7F6A,
-    0X5C0A,0X9075,0X6628,0X5DE6,0X4F50,0X67DE,0X505A,0X4F5C,0X5750,0X5EA7,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X8C38,0X8C39,0X8C3A,0X8C3B,0X8C3C,0X8C3D,0X8C3E,0X8C3F,0X8C40,0X8C42,0X8C43,0X8C44,0X8C45,0X8C48,0X8C4A,0X8C4B,
-    0X8C4D,0X8C4E,0X8C4F,0X8C50,0X8C51,0X8C52,0X8C53,0X8C54,0X8C56,0X8C57,0X8C58,0X8C59,0X8C5B,0X8C5C,0X8C5D,0X8C5E,
-    0X8C5F,0X8C60,0X8C63,0X8C64,0X8C65,0X8C66,0X8C67,0X8C68,0X8C69,0X8C6C,0X8C6D,0X8C6E,0X8C6F,0X8C70,0X8C71,0X8C72,
-    0X8C74,0X8C75,0X8C76,0X8C77,0X8C7B,0X8C7C,0X8C7D,0X8C7E,0X8C7F,0X8C80,0X8C81,0X8C83,0X8C84,0X8C86,0X8C87,0X0001,
-    0X8C88,0X8C8B,0X8C8D,0X8C8E,0X8C8F,0X8C90,0X8C91,0X8C92,0X8C93,0X8C95,0X8C96,0X8C97,0X8C99,0X8C9A,0X8C9B,0X8C9C,
-    0X8C9D,0X8C9E,0X8C9F,0X8CA0,0X8CA1,0X8CA2,0X8CA3,0X8CA4,0X8CA5,0X8CA6,0X8CA7,0X8CA8,0X8CA9,0X8CAA,0X8CAB,0X8CAC,
-    0X8CAD,0X4E8D,0X4E0C,0X5140,0X4E10,0X5EFF,0X5345,0X4E15,0X4E98,0X4E1E,0X9B32,0X5B6C,0X5669,0X4E28,0X79BA,0X4E3F,
-    0X5315,0X4E47,0X592D,0X723B,0X536E,0X6C10,0X56DF,0X80E4,0X9997,0X6BD3,0X777E,0X9F17,0X4E36,0X4E9F,0X9F10,0X4E5C,
-    0X4E69,0X4E93,0X8288,0X5B5B,0X556C,0X560F,0X4EC4,0X538D,0X539D,0X53A3,0X53A5,0X53AE,0X9765,0X8D5D,0X531A,0X53F5,
-    0X5326,0X532E,0X533E,0X8D5C,0X5366,0X5363,0X5202,0X5208,0X520E,0X522D,0X5233,0X523F,0X5240,0X524C,0X525E,0X5261,
-    0X525C,0X84AF,0X527D,0X5282,0X5281,0X5290,0X5293,0X5182,0X7F54,0X4EBB,0X4EC3,0X4EC9,0X4EC2,0X4EE8,0X4EE1,0X4EEB,
-    0X4EDE,0X4F1B,0X4EF3,0X4F22,0X4F64,0X4EF5,0X4F25,0X4F27,0X4F09,0X4F2B,0X4F5E,0X4F67,0X6538,0X4F5A,0X4F5D,0X0001,
-    0X8CAE,0X8CAF,0X8CB0,0X8CB1,0X8CB2,0X8CB3,0X8CB4,0X8CB5,0X8CB6,0X8CB7,0X8CB8,0X8CB9,0X8CBA,0X8CBB,0X8CBC,0X8CBD,
-    0X8CBE,0X8CBF,0X8CC0,0X8CC1,0X8CC2,0X8CC3,0X8CC4,0X8CC5,0X8CC6,0X8CC7,0X8CC8,0X8CC9,0X8CCA,0X8CCB,0X8CCC,0X8CCD,
-    0X8CCE,0X8CCF,0X8CD0,0X8CD1,0X8CD2,0X8CD3,0X8CD4,0X8CD5,0X8CD6,0X8CD7,0X8CD8,0X8CD9,0X8CDA,0X8CDB,0X8CDC,0X8CDD,
-    0X8CDE,0X8CDF,0X8CE0,0X8CE1,0X8CE2,0X8CE3,0X8CE4,0X8CE5,0X8CE6,0X8CE7,0X8CE8,0X8CE9,0X8CEA,0X8CEB,0X8CEC,0X0001,
-    0X8CED,0X8CEE,0X8CEF,0X8CF0,0X8CF1,0X8CF2,0X8CF3,0X8CF4,0X8CF5,0X8CF6,0X8CF7,0X8CF8,0X8CF9,0X8CFA,0X8CFB,0X8CFC,
-    0X8CFD,0X8CFE,0X8CFF,0X8D00,0X8D01,0X8D02,0X8D03,0X8D04,0X8D05,0X8D06,0X8D07,0X8D08,0X8D09,0X8D0A,0X8D0B,0X8D0C,
-    0X8D0D,0X4F5F,0X4F57,0X4F32,0X4F3D,0X4F76,0X4F74,0X4F91,0X4F89,0X4F83,0X4F8F,0X4F7E,0X4F7B,0X4FAA,0X4F7C,0X4FAC,
-    0X4F94,0X4FE6,0X4FE8,0X4FEA,0X4FC5,0X4FDA,0X4FE3,0X4FDC,0X4FD1,0X4FDF,0X4FF8,0X5029,0X504C,0X4FF3,0X502C,0X500F,
-    0X502E,0X502D,0X4FFE,0X501C,0X500C,0X5025,0X5028,0X507E,0X5043,0X5055,0X5048,0X504E,0X506C,0X507B,0X50A5,0X50A7,
-    0X50A9,0X50BA,0X50D6,0X5106,0X50ED,0X50EC,0X50E6,0X50EE,0X5107,0X510B,0X4EDD,0X6C3D,0X4F58,0X4F65,0X4FCE,0X9FA0,
-    0X6C46,0X7C74,0X516E,0X5DFD,0X9EC9,0X9998,0X5181,0X5914,0X52F9,0X530D,0X8A07,0X5310,0X51EB,0X5919,0X5155,0X4EA0,
-    0X5156,0X4EB3,0X886E,0X88A4,0X4EB5,0X8114,0X88D2,0X7980,0X5B34,0X8803,0X7FB8,0X51AB,0X51B1,0X51BD,0X51BC,0X0001,
-    0X8D0E,0X8D0F,0X8D10,0X8D11,0X8D12,0X8D13,0X8D14,0X8D15,0X8D16,0X8D17,0X8D18,0X8D19,0X8D1A,0X8D1B,0X8D1C,0X8D20,
-    0X8D51,0X8D52,0X8D57,0X8D5F,0X8D65,0X8D68,0X8D69,0X8D6A,0X8D6C,0X8D6E,0X8D6F,0X8D71,0X8D72,0X8D78,0X8D79,0X8D7A,
-    0X8D7B,0X8D7C,0X8D7D,0X8D7E,0X8D7F,0X8D80,0X8D82,0X8D83,0X8D86,0X8D87,0X8D88,0X8D89,0X8D8C,0X8D8D,0X8D8E,0X8D8F,
-    0X8D90,0X8D92,0X8D93,0X8D95,0X8D96,0X8D97,0X8D98,0X8D99,0X8D9A,0X8D9B,0X8D9C,0X8D9D,0X8D9E,0X8DA0,0X8DA1,0X0001,
-    0X8DA2,0X8DA4,0X8DA5,0X8DA6,0X8DA7,0X8DA8,0X8DA9,0X8DAA,0X8DAB,0X8DAC,0X8DAD,0X8DAE,0X8DAF,0X8DB0,0X8DB2,0X8DB6,
-    0X8DB7,0X8DB9,0X8DBB,0X8DBD,0X8DC0,0X8DC1,0X8DC2,0X8DC5,0X8DC7,0X8DC8,0X8DC9,0X8DCA,0X8DCD,0X8DD0,0X8DD2,0X8DD3,
-    0X8DD4,0X51C7,0X5196,0X51A2,0X51A5,0X8BA0,0X8BA6,0X8BA7,0X8BAA,0X8BB4,0X8BB5,0X8BB7,0X8BC2,0X8BC3,0X8BCB,0X8BCF,
-    0X8BCE,0X8BD2,0X8BD3,0X8BD4,0X8BD6,0X8BD8,0X8BD9,0X8BDC,0X8BDF,0X8BE0,0X8BE4,0X8BE8,0X8BE9,0X8BEE,0X8BF0,0X8BF3,
-    0X8BF6,0X8BF9,0X8BFC,0X8BFF,0X8C00,0X8C02,0X8C04,0X8C07,0X8C0C,0X8C0F,0X8C11,0X8C12,0X8C14,0X8C15,0X8C16,0X8C19,
-    0X8C1B,0X8C18,0X8C1D,0X8C1F,0X8C20,0X8C21,0X8C25,0X8C27,0X8C2A,0X8C2B,0X8C2E,0X8C2F,0X8C32,0X8C33,0X8C35,0X8C36,
-    0X5369,0X537A,0X961D,0X9622,0X9621,0X9631,0X962A,0X963D,0X963C,0X9642,0X9649,0X9654,0X965F,0X9667,0X966C,0X9672,
-    0X9674,0X9688,0X968D,0X9697,0X96B0,0X9097,0X909B,0X909D,0X9099,0X90AC,0X90A1,0X90B4,0X90B3,0X90B6,0X90BA,0X0001,
-    0X8DD5,0X8DD8,0X8DD9,0X8DDC,0X8DE0,0X8DE1,0X8DE2,0X8DE5,0X8DE6,0X8DE7,0X8DE9,0X8DED,0X8DEE,0X8DF0,0X8DF1,0X8DF2,
-    0X8DF4,0X8DF6,0X8DFC,0X8DFE,0X8DFF,0X8E00,0X8E01,0X8E02,0X8E03,0X8E04,0X8E06,0X8E07,0X8E08,0X8E0B,0X8E0D,0X8E0E,
-    0X8E10,0X8E11,0X8E12,0X8E13,0X8E15,0X8E16,0X8E17,0X8E18,0X8E19,0X8E1A,0X8E1B,0X8E1C,0X8E20,0X8E21,0X8E24,0X8E25,
-    0X8E26,0X8E27,0X8E28,0X8E2B,0X8E2D,0X8E30,0X8E32,0X8E33,0X8E34,0X8E36,0X8E37,0X8E38,0X8E3B,0X8E3C,0X8E3E,0X0001,
-    0X8E3F,0X8E43,0X8E45,0X8E46,0X8E4C,0X8E4D,0X8E4E,0X8E4F,0X8E50,0X8E53,0X8E54,0X8E55,0X8E56,0X8E57,0X8E58,0X8E5A,
-    0X8E5B,0X8E5C,0X8E5D,0X8E5E,0X8E5F,0X8E60,0X8E61,0X8E62,0X8E63,0X8E64,0X8E65,0X8E67,0X8E68,0X8E6A,0X8E6B,0X8E6E,
-    0X8E71,0X90B8,0X90B0,0X90CF,0X90C5,0X90BE,0X90D0,0X90C4,0X90C7,0X90D3,0X90E6,0X90E2,0X90DC,0X90D7,0X90DB,0X90EB,
-    0X90EF,0X90FE,0X9104,0X9122,0X911E,0X9123,0X9131,0X912F,0X9139,0X9143,0X9146,0X520D,0X5942,0X52A2,0X52AC,0X52AD,
-    0X52BE,0X54FF,0X52D0,0X52D6,0X52F0,0X53DF,0X71EE,0X77CD,0X5EF4,0X51F5,0X51FC,0X9B2F,0X53B6,0X5F01,0X755A,0X5DEF,
-    0X574C,0X57A9,0X57A1,0X587E,0X58BC,0X58C5,0X58D1,0X5729,0X572C,0X572A,0X5733,0X5739,0X572E,0X572F,0X575C,0X573B,
-    0X5742,0X5769,0X5785,0X576B,0X5786,0X577C,0X577B,0X5768,0X576D,0X5776,0X5773,0X57AD,0X57A4,0X578C,0X57B2,0X57CF,
-    0X57A7,0X57B4,0X5793,0X57A0,0X57D5,0X57D8,0X57DA,0X57D9,0X57D2,0X57B8,0X57F4,0X57EF,0X57F8,0X57E4,0X57DD,0X0001,
-    0X8E73,0X8E75,0X8E77,0X8E78,0X8E79,0X8E7A,0X8E7B,0X8E7D,0X8E7E,0X8E80,0X8E82,0X8E83,0X8E84,0X8E86,0X8E88,0X8E89,
-    0X8E8A,0X8E8B,0X8E8C,0X8E8D,0X8E8E,0X8E91,0X8E92,0X8E93,0X8E95,0X8E96,0X8E97,0X8E98,0X8E99,0X8E9A,0X8E9B,0X8E9D,
-    0X8E9F,0X8EA0,0X8EA1,0X8EA2,0X8EA3,0X8EA4,0X8EA5,0X8EA6,0X8EA7,0X8EA8,0X8EA9,0X8EAA,0X8EAD,0X8EAE,0X8EB0,0X8EB1,
-    0X8EB3,0X8EB4,0X8EB5,0X8EB6,0X8EB7,0X8EB8,0X8EB9,0X8EBB,0X8EBC,0X8EBD,0X8EBE,0X8EBF,0X8EC0,0X8EC1,0X8EC2,0X0001,
-    0X8EC3,0X8EC4,0X8EC5,0X8EC6,0X8EC7,0X8EC8,0X8EC9,0X8ECA,0X8ECB,0X8ECC,0X8ECD,0X8ECF,0X8ED0,0X8ED1,0X8ED2,0X8ED3,
-    0X8ED4,0X8ED5,0X8ED6,0X8ED7,0X8ED8,0X8ED9,0X8EDA,0X8EDB,0X8EDC,0X8EDD,0X8EDE,0X8EDF,0X8EE0,0X8EE1,0X8EE2,0X8EE3,
-    0X8EE4,0X580B,0X580D,0X57FD,0X57ED,0X5800,0X581E,0X5819,0X5844,0X5820,0X5865,0X586C,0X5881,0X5889,0X589A,0X5880,
-    0X99A8,0X9F19,0X61FF,0X8279,0X827D,0X827F,0X828F,0X828A,0X82A8,0X8284,0X828E,0X8291,0X8297,0X8299,0X82AB,0X82B8,
-    0X82BE,0X82B0,0X82C8,0X82CA,0X82E3,0X8298,0X82B7,0X82AE,0X82CB,0X82CC,0X82C1,0X82A9,0X82B4,0X82A1,0X82AA,0X829F,
-    0X82C4,0X82CE,0X82A4,0X82E1,0X8309,0X82F7,0X82E4,0X830F,0X8307,0X82DC,0X82F4,0X82D2,0X82D8,0X830C,0X82FB,0X82D3,
-    0X8311,0X831A,0X8306,0X8314,0X8315,0X82E0,0X82D5,0X831C,0X8351,0X835B,0X835C,0X8308,0X8392,0X833C,0X8334,0X8331,
-    0X839B,0X835E,0X832F,0X834F,0X8347,0X8343,0X835F,0X8340,0X8317,0X8360,0X832D,0X833A,0X8333,0X8366,0X8365,0X0001,
-    0X8EE5,0X8EE6,0X8EE7,0X8EE8,0X8EE9,0X8EEA,0X8EEB,0X8EEC,0X8EED,0X8EEE,0X8EEF,0X8EF0,0X8EF1,0X8EF2,0X8EF3,0X8EF4,
-    0X8EF5,0X8EF6,0X8EF7,0X8EF8,0X8EF9,0X8EFA,0X8EFB,0X8EFC,0X8EFD,0X8EFE,0X8EFF,0X8F00,0X8F01,0X8F02,0X8F03,0X8F04,
-    0X8F05,0X8F06,0X8F07,0X8F08,0X8F09,0X8F0A,0X8F0B,0X8F0C,0X8F0D,0X8F0E,0X8F0F,0X8F10,0X8F11,0X8F12,0X8F13,0X8F14,
-    0X8F15,0X8F16,0X8F17,0X8F18,0X8F19,0X8F1A,0X8F1B,0X8F1C,0X8F1D,0X8F1E,0X8F1F,0X8F20,0X8F21,0X8F22,0X8F23,0X0001,
-    0X8F24,0X8F25,0X8F26,0X8F27,0X8F28,0X8F29,0X8F2A,0X8F2B,0X8F2C,0X8F2D,0X8F2E,0X8F2F,0X8F30,0X8F31,0X8F32,0X8F33,
-    0X8F34,0X8F35,0X8F36,0X8F37,0X8F38,0X8F39,0X8F3A,0X8F3B,0X8F3C,0X8F3D,0X8F3E,0X8F3F,0X8F40,0X8F41,0X8F42,0X8F43,
-    0X8F44,0X8368,0X831B,0X8369,0X836C,0X836A,0X836D,0X836E,0X83B0,0X8378,0X83B3,0X83B4,0X83A0,0X83AA,0X8393,0X839C,
-    0X8385,0X837C,0X83B6,0X83A9,0X837D,0X83B8,0X837B,0X8398,0X839E,0X83A8,0X83BA,0X83BC,0X83C1,0X8401,0X83E5,0X83D8,
-    0X5807,0X8418,0X840B,0X83DD,0X83FD,0X83D6,0X841C,0X8438,0X8411,0X8406,0X83D4,0X83DF,0X840F,0X8403,0X83F8,0X83F9,
-    0X83EA,0X83C5,0X83C0,0X8426,0X83F0,0X83E1,0X845C,0X8451,0X845A,0X8459,0X8473,0X8487,0X8488,0X847A,0X8489,0X8478,
-    0X843C,0X8446,0X8469,0X8476,0X848C,0X848E,0X8431,0X846D,0X84C1,0X84CD,0X84D0,0X84E6,0X84BD,0X84D3,0X84CA,0X84BF,
-    0X84BA,0X84E0,0X84A1,0X84B9,0X84B4,0X8497,0X84E5,0X84E3,0X850C,0X750D,0X8538,0X84F0,0X8539,0X851F,0X853A,0X0001,
-    0X8F45,0X8F46,0X8F47,0X8F48,0X8F49,0X8F4A,0X8F4B,0X8F4C,0X8F4D,0X8F4E,0X8F4F,0X8F50,0X8F51,0X8F52,0X8F53,0X8F54,
-    0X8F55,0X8F56,0X8F57,0X8F58,0X8F59,0X8F5A,0X8F5B,0X8F5C,0X8F5D,0X8F5E,0X8F5F,0X8F60,0X8F61,0X8F62,0X8F63,0X8F64,
-    0X8F65,0X8F6A,0X8F80,0X8F8C,0X8F92,0X8F9D,0X8FA0,0X8FA1,0X8FA2,0X8FA4,0X8FA5,0X8FA6,0X8FA7,0X8FAA,0X8FAC,0X8FAD,
-    0X8FAE,0X8FAF,0X8FB2,0X8FB3,0X8FB4,0X8FB5,0X8FB7,0X8FB8,0X8FBA,0X8FBB,0X8FBC,0X8FBF,0X8FC0,0X8FC3,0X8FC6,0X0001,
-    0X8FC9,0X8FCA,0X8FCB,0X8FCC,0X8FCD,0X8FCF,0X8FD2,0X8FD6,0X8FD7,0X8FDA,0X8FE0,0X8FE1,0X8FE3,0X8FE7,0X8FEC,0X8FEF,
-    0X8FF1,0X8FF2,0X8FF4,0X8FF5,0X8FF6,0X8FFA,0X8FFB,0X8FFC,0X8FFE,0X8FFF,0X9007,0X9008,0X900C,0X900E,0X9013,0X9015,
-    0X9018,0X8556,0X853B,0X84FF,0X84FC,0X8559,0X8548,0X8568,0X8564,0X855E,0X857A,0X77A2,0X8543,0X8572,0X857B,0X85A4,
-    0X85A8,0X8587,0X858F,0X8579,0X85AE,0X859C,0X8585,0X85B9,0X85B7,0X85B0,0X85D3,0X85C1,0X85DC,0X85FF,0X8627,0X8605,
-    0X8629,0X8616,0X863C,0X5EFE,0X5F08,0X593C,0X5941,0X8037,0X5955,0X595A,0X5958,0X530F,0X5C22,0X5C25,0X5C2C,0X5C34,
-    0X624C,0X626A,0X629F,0X62BB,0X62CA,0X62DA,0X62D7,0X62EE,0X6322,0X62F6,0X6339,0X634B,0X6343,0X63AD,0X63F6,0X6371,
-    0X637A,0X638E,0X63B4,0X636D,0X63AC,0X638A,0X6369,0X63AE,0X63BC,0X63F2,0X63F8,0X63E0,0X63FF,0X63C4,0X63DE,0X63CE,
-    0X6452,0X63C6,0X63BE,0X6445,0X6441,0X640B,0X641B,0X6420,0X640C,0X6426,0X6421,0X645E,0X6484,0X646D,0X6496,0X0001,
-    0X9019,0X901C,0X9023,0X9024,0X9025,0X9027,0X9028,0X9029,0X902A,0X902B,0X902C,0X9030,0X9031,0X9032,0X9033,0X9034,
-    0X9037,0X9039,0X903A,0X903D,0X903F,0X9040,0X9043,0X9045,0X9046,0X9048,0X9049,0X904A,0X904B,0X904C,0X904E,0X9054,
-    0X9055,0X9056,0X9059,0X905A,0X905C,0X905D,0X905E,0X905F,0X9060,0X9061,0X9064,0X9066,0X9067,0X9069,0X906A,0X906B,
-    0X906C,0X906F,0X9070,0X9071,0X9072,0X9073,0X9076,0X9077,0X9078,0X9079,0X907A,0X907B,0X907C,0X907E,0X9081,0X0001,
-    0X9084,0X9085,0X9086,0X9087,0X9089,0X908A,0X908C,0X908D,0X908E,0X908F,0X9090,0X9092,0X9094,0X9096,0X9098,0X909A,
-    0X909C,0X909E,0X909F,0X90A0,0X90A4,0X90A5,0X90A7,0X90A8,0X90A9,0X90AB,0X90AD,0X90B2,0X90B7,0X90BC,0X90BD,0X90BF,
-    0X90C0,0X647A,0X64B7,0X64B8,0X6499,0X64BA,0X64C0,0X64D0,0X64D7,0X64E4,0X64E2,0X6509,0X6525,0X652E,0X5F0B,0X5FD2,
-    0X7519,0X5F11,0X535F,0X53F1,0X53FD,0X53E9,0X53E8,0X53FB,0X5412,0X5416,0X5406,0X544B,0X5452,0X5453,0X5454,0X5456,
-    0X5443,0X5421,0X5457,0X5459,0X5423,0X5432,0X5482,0X5494,0X5477,0X5471,0X5464,0X549A,0X549B,0X5484,0X5476,0X5466,
-    0X549D,0X54D0,0X54AD,0X54C2,0X54B4,0X54D2,0X54A7,0X54A6,0X54D3,0X54D4,0X5472,0X54A3,0X54D5,0X54BB,0X54BF,0X54CC,
-    0X54D9,0X54DA,0X54DC,0X54A9,0X54AA,0X54A4,0X54DD,0X54CF,0X54DE,0X551B,0X54E7,0X5520,0X54FD,0X5514,0X54F3,0X5522,
-    0X5523,0X550F,0X5511,0X5527,0X552A,0X5567,0X558F,0X55B5,0X5549,0X556D,0X5541,0X5555,0X553F,0X5550,0X553C,0X0001,
-    0X90C2,0X90C3,0X90C6,0X90C8,0X90C9,0X90CB,0X90CC,0X90CD,0X90D2,0X90D4,0X90D5,0X90D6,0X90D8,0X90D9,0X90DA,0X90DE,
-    0X90DF,0X90E0,0X90E3,0X90E4,0X90E5,0X90E9,0X90EA,0X90EC,0X90EE,0X90F0,0X90F1,0X90F2,0X90F3,0X90F5,0X90F6,0X90F7,
-    0X90F9,0X90FA,0X90FB,0X90FC,0X90FF,0X9100,0X9101,0X9103,0X9105,0X9106,0X9107,0X9108,0X9109,0X910A,0X910B,0X910C,
-    0X910D,0X910E,0X910F,0X9110,0X9111,0X9112,0X9113,0X9114,0X9115,0X9116,0X9117,0X9118,0X911A,0X911B,0X911C,0X0001,
-    0X911D,0X911F,0X9120,0X9121,0X9124,0X9125,0X9126,0X9127,0X9128,0X9129,0X912A,0X912B,0X912C,0X912D,0X912E,0X9130,
-    0X9132,0X9133,0X9134,0X9135,0X9136,0X9137,0X9138,0X913A,0X913B,0X913C,0X913D,0X913E,0X913F,0X9140,0X9141,0X9142,
-    0X9144,0X5537,0X5556,0X5575,0X5576,0X5577,0X5533,0X5530,0X555C,0X558B,0X55D2,0X5583,0X55B1,0X55B9,0X5588,0X5581,
-    0X559F,0X557E,0X55D6,0X5591,0X557B,0X55DF,0X55BD,0X55BE,0X5594,0X5599,0X55EA,0X55F7,0X55C9,0X561F,0X55D1,0X55EB,
-    0X55EC,0X55D4,0X55E6,0X55DD,0X55C4,0X55EF,0X55E5,0X55F2,0X55F3,0X55CC,0X55CD,0X55E8,0X55F5,0X55E4,0X8F94,0X561E,
-    0X5608,0X560C,0X5601,0X5624,0X5623,0X55FE,0X5600,0X5627,0X562D,0X5658,0X5639,0X5657,0X562C,0X564D,0X5662,0X5659,
-    0X565C,0X564C,0X5654,0X5686,0X5664,0X5671,0X566B,0X567B,0X567C,0X5685,0X5693,0X56AF,0X56D4,0X56D7,0X56DD,0X56E1,
-    0X56F5,0X56EB,0X56F9,0X56FF,0X5704,0X570A,0X5709,0X571C,0X5E0F,0X5E19,0X5E14,0X5E11,0X5E31,0X5E3B,0X5E3C,0X0001,
-    0X9145,0X9147,0X9148,0X9151,0X9153,0X9154,0X9155,0X9156,0X9158,0X9159,0X915B,0X915C,0X915F,0X9160,0X9166,0X9167,
-    0X9168,0X916B,0X916D,0X9173,0X917A,0X917B,0X917C,0X9180,0X9181,0X9182,0X9183,0X9184,0X9186,0X9188,0X918A,0X918E,
-    0X918F,0X9193,0X9194,0X9195,0X9196,0X9197,0X9198,0X9199,0X919C,0X919D,0X919E,0X919F,0X91A0,0X91A1,0X91A4,0X91A5,
-    0X91A6,0X91A7,0X91A8,0X91A9,0X91AB,0X91AC,0X91B0,0X91B1,0X91B2,0X91B3,0X91B6,0X91B7,0X91B8,0X91B9,0X91BB,0X0001,
-    0X91BC,0X91BD,0X91BE,0X91BF,0X91C0,0X91C1,0X91C2,0X91C3,0X91C4,0X91C5,0X91C6,0X91C8,0X91CB,0X91D0,0X91D2,0X91D3,
-    0X91D4,0X91D5,0X91D6,0X91D7,0X91D8,0X91D9,0X91DA,0X91DB,0X91DD,0X91DE,0X91DF,0X91E0,0X91E1,0X91E2,0X91E3,0X91E4,
-    0X91E5,0X5E37,0X5E44,0X5E54,0X5E5B,0X5E5E,0X5E61,0X5C8C,0X5C7A,0X5C8D,0X5C90,0X5C96,0X5C88,0X5C98,0X5C99,0X5C91,
-    0X5C9A,0X5C9C,0X5CB5,0X5CA2,0X5CBD,0X5CAC,0X5CAB,0X5CB1,0X5CA3,0X5CC1,0X5CB7,0X5CC4,0X5CD2,0X5CE4,0X5CCB,0X5CE5,
-    0X5D02,0X5D03,0X5D27,0X5D26,0X5D2E,0X5D24,0X5D1E,0X5D06,0X5D1B,0X5D58,0X5D3E,0X5D34,0X5D3D,0X5D6C,0X5D5B,0X5D6F,
-    0X5D5D,0X5D6B,0X5D4B,0X5D4A,0X5D69,0X5D74,0X5D82,0X5D99,0X5D9D,0X8C73,0X5DB7,0X5DC5,0X5F73,0X5F77,0X5F82,0X5F87,
-    0X5F89,0X5F8C,0X5F95,0X5F99,0X5F9C,0X5FA8,0X5FAD,0X5FB5,0X5FBC,0X8862,0X5F61,0X72AD,0X72B0,0X72B4,0X72B7,0X72B8,
-    0X72C3,0X72C1,0X72CE,0X72CD,0X72D2,0X72E8,0X72EF,0X72E9,0X72F2,0X72F4,0X72F7,0X7301,0X72F3,0X7303,0X72FA,0X0001,
-    0X91E6,0X91E7,0X91E8,0X91E9,0X91EA,0X91EB,0X91EC,0X91ED,0X91EE,0X91EF,0X91F0,0X91F1,0X91F2,0X91F3,0X91F4,0X91F5,
-    0X91F6,0X91F7,0X91F8,0X91F9,0X91FA,0X91FB,0X91FC,0X91FD,0X91FE,0X91FF,0X9200,0X9201,0X9202,0X9203,0X9204,0X9205,
-    0X9206,0X9207,0X9208,0X9209,0X920A,0X920B,0X920C,0X920D,0X920E,0X920F,0X9210,0X9211,0X9212,0X9213,0X9214,0X9215,
-    0X9216,0X9217,0X9218,0X9219,0X921A,0X921B,0X921C,0X921D,0X921E,0X921F,0X9220,0X9221,0X9222,0X9223,0X9224,0X0001,
-    0X9225,0X9226,0X9227,0X9228,0X9229,0X922A,0X922B,0X922C,0X922D,0X922E,0X922F,0X9230,0X9231,0X9232,0X9233,0X9234,
-    0X9235,0X9236,0X9237,0X9238,0X9239,0X923A,0X923B,0X923C,0X923D,0X923E,0X923F,0X9240,0X9241,0X9242,0X9243,0X9244,
-    0X9245,0X72FB,0X7317,0X7313,0X7321,0X730A,0X731E,0X731D,0X7315,0X7322,0X7339,0X7325,0X732C,0X7338,0X7331,0X7350,
-    0X734D,0X7357,0X7360,0X736C,0X736F,0X737E,0X821B,0X5925,0X98E7,0X5924,0X5902,0X9963,0X9967,0X9968,0X9969,0X996A,
-    0X996B,0X996C,0X9974,0X9977,0X997D,0X9980,0X9984,0X9987,0X998A,0X998D,0X9990,0X9991,0X9993,0X9994,0X9995,0X5E80,
-    0X5E91,0X5E8B,0X5E96,0X5EA5,0X5EA0,0X5EB9,0X5EB5,0X5EBE,0X5EB3,0X8D53,0X5ED2,0X5ED1,0X5EDB,0X5EE8,0X5EEA,0X81BA,
-    0X5FC4,0X5FC9,0X5FD6,0X5FCF,0X6003,0X5FEE,0X6004,0X5FE1,0X5FE4,0X5FFE,0X6005,0X6006,0X5FEA,0X5FED,0X5FF8,0X6019,
-    0X6035,0X6026,0X601B,0X600F,0X600D,0X6029,0X602B,0X600A,0X603F,0X6021,0X6078,0X6079,0X607B,0X607A,0X6042,0X0001,
-    0X9246,0X9247,0X9248,0X9249,0X924A,0X924B,0X924C,0X924D,0X924E,0X924F,0X9250,0X9251,0X9252,0X9253,0X9254,0X9255,
-    0X9256,0X9257,0X9258,0X9259,0X925A,0X925B,0X925C,0X925D,0X925E,0X925F,0X9260,0X9261,0X9262,0X9263,0X9264,0X9265,
-    0X9266,0X9267,0X9268,0X9269,0X926A,0X926B,0X926C,0X926D,0X926E,0X926F,0X9270,0X9271,0X9272,0X9273,0X9275,0X9276,
-    0X9277,0X9278,0X9279,0X927A,0X927B,0X927C,0X927D,0X927E,0X927F,0X9280,0X9281,0X9282,0X9283,0X9284,0X9285,0X0001,
-    0X9286,0X9287,0X9288,0X9289,0X928A,0X928B,0X928C,0X928D,0X928F,0X9290,0X9291,0X9292,0X9293,0X9294,0X9295,0X9296,
-    0X9297,0X9298,0X9299,0X929A,0X929B,0X929C,0X929D,0X929E,0X929F,0X92A0,0X92A1,0X92A2,0X92A3,0X92A4,0X92A5,0X92A6,
-    0X92A7,0X606A,0X607D,0X6096,0X609A,0X60AD,0X609D,0X6083,0X6092,0X608C,0X609B,0X60EC,0X60BB,0X60B1,0X60DD,0X60D8,
-    0X60C6,0X60DA,0X60B4,0X6120,0X6126,0X6115,0X6123,0X60F4,0X6100,0X610E,0X612B,0X614A,0X6175,0X61AC,0X6194,0X61A7,
-    0X61B7,0X61D4,0X61F5,0X5FDD,0X96B3,0X95E9,0X95EB,0X95F1,0X95F3,0X95F5,0X95F6,0X95FC,0X95FE,0X9603,0X9604,0X9606,
-    0X9608,0X960A,0X960B,0X960C,0X960D,0X960F,0X9612,0X9615,0X9616,0X9617,0X9619,0X961A,0X4E2C,0X723F,0X6215,0X6C35,
-    0X6C54,0X6C5C,0X6C4A,0X6CA3,0X6C85,0X6C90,0X6C94,0X6C8C,0X6C68,0X6C69,0X6C74,0X6C76,0X6C86,0X6CA9,0X6CD0,0X6CD4,
-    0X6CAD,0X6CF7,0X6CF8,0X6CF1,0X6CD7,0X6CB2,0X6CE0,0X6CD6,0X6CFA,0X6CEB,0X6CEE,0X6CB1,0X6CD3,0X6CEF,0X6CFE,0X0001,
-    0X92A8,0X92A9,0X92AA,0X92AB,0X92AC,0X92AD,0X92AF,0X92B0,0X92B1,0X92B2,0X92B3,0X92B4,0X92B5,0X92B6,0X92B7,0X92B8,
-    0X92B9,0X92BA,0X92BB,0X92BC,0X92BD,0X92BE,0X92BF,0X92C0,0X92C1,0X92C2,0X92C3,0X92C4,0X92C5,0X92C6,0X92C7,0X92C9,
-    0X92CA,0X92CB,0X92CC,0X92CD,0X92CE,0X92CF,0X92D0,0X92D1,0X92D2,0X92D3,0X92D4,0X92D5,0X92D6,0X92D7,0X92D8,0X92D9,
-    0X92DA,0X92DB,0X92DC,0X92DD,0X92DE,0X92DF,0X92E0,0X92E1,0X92E2,0X92E3,0X92E4,0X92E5,0X92E6,0X92E7,0X92E8,0X0001,
-    0X92E9,0X92EA,0X92EB,0X92EC,0X92ED,0X92EE,0X92EF,0X92F0,0X92F1,0X92F2,0X92F3,0X92F4,0X92F5,0X92F6,0X92F7,0X92F8,
-    0X92F9,0X92FA,0X92FB,0X92FC,0X92FD,0X92FE,0X92FF,0X9300,0X9301,0X9302,0X9303,0X9304,0X9305,0X9306,0X9307,0X9308,
-    0X9309,0X6D39,0X6D27,0X6D0C,0X6D43,0X6D48,0X6D07,0X6D04,0X6D19,0X6D0E,0X6D2B,0X6D4D,0X6D2E,0X6D35,0X6D1A,0X6D4F,
-    0X6D52,0X6D54,0X6D33,0X6D91,0X6D6F,0X6D9E,0X6DA0,0X6D5E,0X6D93,0X6D94,0X6D5C,0X6D60,0X6D7C,0X6D63,0X6E1A,0X6DC7,
-    0X6DC5,0X6DDE,0X6E0E,0X6DBF,0X6DE0,0X6E11,0X6DE6,0X6DDD,0X6DD9,0X6E16,0X6DAB,0X6E0C,0X6DAE,0X6E2B,0X6E6E,0X6E4E,
-    0X6E6B,0X6EB2,0X6E5F,0X6E86,0X6E53,0X6E54,0X6E32,0X6E25,0X6E44,0X6EDF,0X6EB1,0X6E98,0X6EE0,0X6F2D,0X6EE2,0X6EA5,
-    0X6EA7,0X6EBD,0X6EBB,0X6EB7,0X6ED7,0X6EB4,0X6ECF,0X6E8F,0X6EC2,0X6E9F,0X6F62,0X6F46,0X6F47,0X6F24,0X6F15,0X6EF9,
-    0X6F2F,0X6F36,0X6F4B,0X6F74,0X6F2A,0X6F09,0X6F29,0X6F89,0X6F8D,0X6F8C,0X6F78,0X6F72,0X6F7C,0X6F7A,0X6FD1,0X0001,
-    0X930A,0X930B,0X930C,0X930D,0X930E,0X930F,0X9310,0X9311,0X9312,0X9313,0X9314,0X9315,0X9316,0X9317,0X9318,0X9319,
-    0X931A,0X931B,0X931C,0X931D,0X931E,0X931F,0X9320,0X9321,0X9322,0X9323,0X9324,0X9325,0X9326,0X9327,0X9328,0X9329,
-    0X932A,0X932B,0X932C,0X932D,0X932E,0X932F,0X9330,0X9331,0X9332,0X9333,0X9334,0X9335,0X9336,0X9337,0X9338,0X9339,
-    0X933A,0X933B,0X933C,0X933D,0X933F,0X9340,0X9341,0X9342,0X9343,0X9344,0X9345,0X9346,0X9347,0X9348,0X9349,0X0001,
-    0X934A,0X934B,0X934C,0X934D,0X934E,0X934F,0X9350,0X9351,0X9352,0X9353,0X9354,0X9355,0X9356,0X9357,0X9358,0X9359,
-    0X935A,0X935B,0X935C,0X935D,0X935E,0X935F,0X9360,0X9361,0X9362,0X9363,0X9364,0X9365,0X9366,0X9367,0X9368,0X9369,
-    0X936B,0X6FC9,0X6FA7,0X6FB9,0X6FB6,0X6FC2,0X6FE1,0X6FEE,0X6FDE,0X6FE0,0X6FEF,0X701A,0X7023,0X701B,0X7039,0X7035,
-    0X704F,0X705E,0X5B80,0X5B84,0X5B95,0X5B93,0X5BA5,0X5BB8,0X752F,0X9A9E,0X6434,0X5BE4,0X5BEE,0X8930,0X5BF0,0X8E47,
-    0X8B07,0X8FB6,0X8FD3,0X8FD5,0X8FE5,0X8FEE,0X8FE4,0X8FE9,0X8FE6,0X8FF3,0X8FE8,0X9005,0X9004,0X900B,0X9026,0X9011,
-    0X900D,0X9016,0X9021,0X9035,0X9036,0X902D,0X902F,0X9044,0X9051,0X9052,0X9050,0X9068,0X9058,0X9062,0X905B,0X66B9,
-    0X9074,0X907D,0X9082,0X9088,0X9083,0X908B,0X5F50,0X5F57,0X5F56,0X5F58,0X5C3B,0X54AB,0X5C50,0X5C59,0X5B71,0X5C63,
-    0X5C66,0X7FBC,0X5F2A,0X5F29,0X5F2D,0X8274,0X5F3C,0X9B3B,0X5C6E,0X5981,0X5983,0X598D,0X59A9,0X59AA,0X59A3,0X0001,
-    0X936C,0X936D,0X936E,0X936F,0X9370,0X9371,0X9372,0X9373,0X9374,0X9375,0X9376,0X9377,0X9378,0X9379,0X937A,0X937B,
-    0X937C,0X937D,0X937E,0X937F,0X9380,0X9381,0X9382,0X9383,0X9384,0X9385,0X9386,0X9387,0X9388,0X9389,0X938A,0X938B,
-    0X938C,0X938D,0X938E,0X9390,0X9391,0X9392,0X9393,0X9394,0X9395,0X9396,0X9397,0X9398,0X9399,0X939A,0X939B,0X939C,
-    0X939D,0X939E,0X939F,0X93A0,0X93A1,0X93A2,0X93A3,0X93A4,0X93A5,0X93A6,0X93A7,0X93A8,0X93A9,0X93AA,0X93AB,0X0001,
-    0X93AC,0X93AD,0X93AE,0X93AF,0X93B0,0X93B1,0X93B2,0X93B3,0X93B4,0X93B5,0X93B6,0X93B7,0X93B8,0X93B9,0X93BA,0X93BB,
-    0X93BC,0X93BD,0X93BE,0X93BF,0X93C0,0X93C1,0X93C2,0X93C3,0X93C4,0X93C5,0X93C6,0X93C7,0X93C8,0X93C9,0X93CB,0X93CC,
-    0X93CD,0X5997,0X59CA,0X59AB,0X599E,0X59A4,0X59D2,0X59B2,0X59AF,0X59D7,0X59BE,0X5A05,0X5A06,0X59DD,0X5A08,0X59E3,
-    0X59D8,0X59F9,0X5A0C,0X5A09,0X5A32,0X5A34,0X5A11,0X5A23,0X5A13,0X5A40,0X5A67,0X5A4A,0X5A55,0X5A3C,0X5A62,0X5A75,
-    0X80EC,0X5AAA,0X5A9B,0X5A77,0X5A7A,0X5ABE,0X5AEB,0X5AB2,0X5AD2,0X5AD4,0X5AB8,0X5AE0,0X5AE3,0X5AF1,0X5AD6,0X5AE6,
-    0X5AD8,0X5ADC,0X5B09,0X5B17,0X5B16,0X5B32,0X5B37,0X5B40,0X5C15,0X5C1C,0X5B5A,0X5B65,0X5B73,0X5B51,0X5B53,0X5B62,
-    0X9A75,0X9A77,0X9A78,0X9A7A,0X9A7F,0X9A7D,0X9A80,0X9A81,0X9A85,0X9A88,0X9A8A,0X9A90,0X9A92,0X9A93,0X9A96,0X9A98,
-    0X9A9B,0X9A9C,0X9A9D,0X9A9F,0X9AA0,0X9AA2,0X9AA3,0X9AA5,0X9AA7,0X7E9F,0X7EA1,0X7EA3,0X7EA5,0X7EA8,0X7EA9,0X0001,
-    0X93CE,0X93CF,0X93D0,0X93D1,0X93D2,0X93D3,0X93D4,0X93D5,0X93D7,0X93D8,0X93D9,0X93DA,0X93DB,0X93DC,0X93DD,0X93DE,
-    0X93DF,0X93E0,0X93E1,0X93E2,0X93E3,0X93E4,0X93E5,0X93E6,0X93E7,0X93E8,0X93E9,0X93EA,0X93EB,0X93EC,0X93ED,0X93EE,
-    0X93EF,0X93F0,0X93F1,0X93F2,0X93F3,0X93F4,0X93F5,0X93F6,0X93F7,0X93F8,0X93F9,0X93FA,0X93FB,0X93FC,0X93FD,0X93FE,
-    0X93FF,0X9400,0X9401,0X9402,0X9403,0X9404,0X9405,0X9406,0X9407,0X9408,0X9409,0X940A,0X940B,0X940C,0X940D,0X0001,
-    0X940E,0X940F,0X9410,0X9411,0X9412,0X9413,0X9414,0X9415,0X9416,0X9417,0X9418,0X9419,0X941A,0X941B,0X941C,0X941D,
-    0X941E,0X941F,0X9420,0X9421,0X9422,0X9423,0X9424,0X9425,0X9426,0X9427,0X9428,0X9429,0X942A,0X942B,0X942C,0X942D,
-    0X942E,0X7EAD,0X7EB0,0X7EBE,0X7EC0,0X7EC1,0X7EC2,0X7EC9,0X7ECB,0X7ECC,0X7ED0,0X7ED4,0X7ED7,0X7EDB,0X7EE0,0X7EE1,
-    0X7EE8,0X7EEB,0X7EEE,0X7EEF,0X7EF1,0X7EF2,0X7F0D,0X7EF6,0X7EFA,0X7EFB,0X7EFE,0X7F01,0X7F02,0X7F03,0X7F07,0X7F08,
-    0X7F0B,0X7F0C,0X7F0F,0X7F11,0X7F12,0X7F17,0X7F19,0X7F1C,0X7F1B,0X7F1F,0X7F21,0X7F22,0X7F23,0X7F24,0X7F25,0X7F26,
-    0X7F27,0X7F2A,0X7F2B,0X7F2C,0X7F2D,0X7F2F,0X7F30,0X7F31,0X7F32,0X7F33,0X7F35,0X5E7A,0X757F,0X5DDB,0X753E,0X9095,
-    0X738E,0X7391,0X73AE,0X73A2,0X739F,0X73CF,0X73C2,0X73D1,0X73B7,0X73B3,0X73C0,0X73C9,0X73C8,0X73E5,0X73D9,0X987C,
-    0X740A,0X73E9,0X73E7,0X73DE,0X73BA,0X73F2,0X740F,0X742A,0X745B,0X7426,0X7425,0X7428,0X7430,0X742E,0X742C,0X0001,
-    0X942F,0X9430,0X9431,0X9432,0X9433,0X9434,0X9435,0X9436,0X9437,0X9438,0X9439,0X943A,0X943B,0X943C,0X943D,0X943F,
-    0X9440,0X9441,0X9442,0X9443,0X9444,0X9445,0X9446,0X9447,0X9448,0X9449,0X944A,0X944B,0X944C,0X944D,0X944E,0X944F,
-    0X9450,0X9451,0X9452,0X9453,0X9454,0X9455,0X9456,0X9457,0X9458,0X9459,0X945A,0X945B,0X945C,0X945D,0X945E,0X945F,
-    0X9460,0X9461,0X9462,0X9463,0X9464,0X9465,0X9466,0X9467,0X9468,0X9469,0X946A,0X946C,0X946D,0X946E,0X946F,0X0001,
-    0X9470,0X9471,0X9472,0X9473,0X9474,0X9475,0X9476,0X9477,0X9478,0X9479,0X947A,0X947B,0X947C,0X947D,0X947E,0X947F,
-    0X9480,0X9481,0X9482,0X9483,0X9484,0X9491,0X9496,0X9498,0X94C7,0X94CF,0X94D3,0X94D4,0X94DA,0X94E6,0X94FB,0X951C,
-    0X9520,0X741B,0X741A,0X7441,0X745C,0X7457,0X7455,0X7459,0X7477,0X746D,0X747E,0X749C,0X748E,0X7480,0X7481,0X7487,
-    0X748B,0X749E,0X74A8,0X74A9,0X7490,0X74A7,0X74D2,0X74BA,0X97EA,0X97EB,0X97EC,0X674C,0X6753,0X675E,0X6748,0X6769,
-    0X67A5,0X6787,0X676A,0X6773,0X6798,0X67A7,0X6775,0X67A8,0X679E,0X67AD,0X678B,0X6777,0X677C,0X67F0,0X6809,0X67D8,
-    0X680A,0X67E9,0X67B0,0X680C,0X67D9,0X67B5,0X67DA,0X67B3,0X67DD,0X6800,0X67C3,0X67B8,0X67E2,0X680E,0X67C1,0X67FD,
-    0X6832,0X6833,0X6860,0X6861,0X684E,0X6862,0X6844,0X6864,0X6883,0X681D,0X6855,0X6866,0X6841,0X6867,0X6840,0X683E,
-    0X684A,0X6849,0X6829,0X68B5,0X688F,0X6874,0X6877,0X6893,0X686B,0X68C2,0X696E,0X68FC,0X691F,0X6920,0X68F9,0X0001,
-    0X9527,0X9533,0X953D,0X9543,0X9548,0X954B,0X9555,0X955A,0X9560,0X956E,0X9574,0X9575,0X9577,0X9578,0X9579,0X957A,
-    0X957B,0X957C,0X957D,0X957E,0X9580,0X9581,0X9582,0X9583,0X9584,0X9585,0X9586,0X9587,0X9588,0X9589,0X958A,0X958B,
-    0X958C,0X958D,0X958E,0X958F,0X9590,0X9591,0X9592,0X9593,0X9594,0X9595,0X9596,0X9597,0X9598,0X9599,0X959A,0X959B,
-    0X959C,0X959D,0X959E,0X959F,0X95A0,0X95A1,0X95A2,0X95A3,0X95A4,0X95A5,0X95A6,0X95A7,0X95A8,0X95A9,0X95AA,0X0001,
-    0X95AB,0X95AC,0X95AD,0X95AE,0X95AF,0X95B0,0X95B1,0X95B2,0X95B3,0X95B4,0X95B5,0X95B6,0X95B7,0X95B8,0X95B9,0X95BA,
-    0X95BB,0X95BC,0X95BD,0X95BE,0X95BF,0X95C0,0X95C1,0X95C2,0X95C3,0X95C4,0X95C5,0X95C6,0X95C7,0X95C8,0X95C9,0X95CA,
-    0X95CB,0X6924,0X68F0,0X690B,0X6901,0X6957,0X68E3,0X6910,0X6971,0X6939,0X6960,0X6942,0X695D,0X6984,0X696B,0X6980,
-    0X6998,0X6978,0X6934,0X69CC,0X6987,0X6988,0X69CE,0X6989,0X6966,0X6963,0X6979,0X699B,0X69A7,0X69BB,0X69AB,0X69AD,
-    0X69D4,0X69B1,0X69C1,0X69CA,0X69DF,0X6995,0X69E0,0X698D,0X69FF,0X6A2F,0X69ED,0X6A17,0X6A18,0X6A65,0X69F2,0X6A44,
-    0X6A3E,0X6AA0,0X6A50,0X6A5B,0X6A35,0X6A8E,0X6A79,0X6A3D,0X6A28,0X6A58,0X6A7C,0X6A91,0X6A90,0X6AA9,0X6A97,0X6AAB,
-    0X7337,0X7352,0X6B81,0X6B82,0X6B87,0X6B84,0X6B92,0X6B93,0X6B8D,0X6B9A,0X6B9B,0X6BA1,0X6BAA,0X8F6B,0X8F6D,0X8F71,
-    0X8F72,0X8F73,0X8F75,0X8F76,0X8F78,0X8F77,0X8F79,0X8F7A,0X8F7C,0X8F7E,0X8F81,0X8F82,0X8F84,0X8F87,0X8F8B,0X0001,
-    0X95CC,0X95CD,0X95CE,0X95CF,0X95D0,0X95D1,0X95D2,0X95D3,0X95D4,0X95D5,0X95D6,0X95D7,0X95D8,0X95D9,0X95DA,0X95DB,
-    0X95DC,0X95DD,0X95DE,0X95DF,0X95E0,0X95E1,0X95E2,0X95E3,0X95E4,0X95E5,0X95E6,0X95E7,0X95EC,0X95FF,0X9607,0X9613,
-    0X9618,0X961B,0X961E,0X9620,0X9623,0X9624,0X9625,0X9626,0X9627,0X9628,0X9629,0X962B,0X962C,0X962D,0X962F,0X9630,
-    0X9637,0X9638,0X9639,0X963A,0X963E,0X9641,0X9643,0X964A,0X964E,0X964F,0X9651,0X9652,0X9653,0X9656,0X9657,0X0001,
-    0X9658,0X9659,0X965A,0X965C,0X965D,0X965E,0X9660,0X9663,0X9665,0X9666,0X966B,0X966D,0X966E,0X966F,0X9670,0X9671,
-    0X9673,0X9678,0X9679,0X967A,0X967B,0X967C,0X967D,0X967E,0X967F,0X9680,0X9681,0X9682,0X9683,0X9684,0X9687,0X9689,
-    0X968A,0X8F8D,0X8F8E,0X8F8F,0X8F98,0X8F9A,0X8ECE,0X620B,0X6217,0X621B,0X621F,0X6222,0X6221,0X6225,0X6224,0X622C,
-    0X81E7,0X74EF,0X74F4,0X74FF,0X750F,0X7511,0X7513,0X6534,0X65EE,0X65EF,0X65F0,0X660A,0X6619,0X6772,0X6603,0X6615,
-    0X6600,0X7085,0X66F7,0X661D,0X6634,0X6631,0X6636,0X6635,0X8006,0X665F,0X6654,0X6641,0X664F,0X6656,0X6661,0X6657,
-    0X6677,0X6684,0X668C,0X66A7,0X669D,0X66BE,0X66DB,0X66DC,0X66E6,0X66E9,0X8D32,0X8D33,0X8D36,0X8D3B,0X8D3D,0X8D40,
-    0X8D45,0X8D46,0X8D48,0X8D49,0X8D47,0X8D4D,0X8D55,0X8D59,0X89C7,0X89CA,0X89CB,0X89CC,0X89CE,0X89CF,0X89D0,0X89D1,
-    0X726E,0X729F,0X725D,0X7266,0X726F,0X727E,0X727F,0X7284,0X728B,0X728D,0X728F,0X7292,0X6308,0X6332,0X63B0,0X0001,
-    0X968C,0X968E,0X9691,0X9692,0X9693,0X9695,0X9696,0X969A,0X969B,0X969D,0X969E,0X969F,0X96A0,0X96A1,0X96A2,0X96A3,
-    0X96A4,0X96A5,0X96A6,0X96A8,0X96A9,0X96AA,0X96AB,0X96AC,0X96AD,0X96AE,0X96AF,0X96B1,0X96B2,0X96B4,0X96B5,0X96B7,
-    0X96B8,0X96BA,0X96BB,0X96BF,0X96C2,0X96C3,0X96C8,0X96CA,0X96CB,0X96D0,0X96D1,0X96D3,0X96D4,0X96D6,0X96D7,0X96D8,
-    0X96D9,0X96DA,0X96DB,0X96DC,0X96DD,0X96DE,0X96DF,0X96E1,0X96E2,0X96E3,0X96E4,0X96E5,0X96E6,0X96E7,0X96EB,0X0001,
-    0X96EC,0X96ED,0X96EE,0X96F0,0X96F1,0X96F2,0X96F4,0X96F5,0X96F8,0X96FA,0X96FB,0X96FC,0X96FD,0X96FF,0X9702,0X9703,
-    0X9705,0X970A,0X970B,0X970C,0X9710,0X9711,0X9712,0X9714,0X9715,0X9717,0X9718,0X9719,0X971A,0X971B,0X971D,0X971F,
-    0X9720,0X643F,0X64D8,0X8004,0X6BEA,0X6BF3,0X6BFD,0X6BF5,0X6BF9,0X6C05,0X6C07,0X6C06,0X6C0D,0X6C15,0X6C18,0X6C19,
-    0X6C1A,0X6C21,0X6C29,0X6C24,0X6C2A,0X6C32,0X6535,0X6555,0X656B,0X724D,0X7252,0X7256,0X7230,0X8662,0X5216,0X809F,
-    0X809C,0X8093,0X80BC,0X670A,0X80BD,0X80B1,0X80AB,0X80AD,0X80B4,0X80B7,0X80E7,0X80E8,0X80E9,0X80EA,0X80DB,0X80C2,
-    0X80C4,0X80D9,0X80CD,0X80D7,0X6710,0X80DD,0X80EB,0X80F1,0X80F4,0X80ED,0X810D,0X810E,0X80F2,0X80FC,0X6715,0X8112,
-    0X8C5A,0X8136,0X811E,0X812C,0X8118,0X8132,0X8148,0X814C,0X8153,0X8174,0X8159,0X815A,0X8171,0X8160,0X8169,0X817C,
-    0X817D,0X816D,0X8167,0X584D,0X5AB5,0X8188,0X8182,0X8191,0X6ED5,0X81A3,0X81AA,0X81CC,0X6726,0X81CA,0X81BB,0X0001,
-    0X9721,0X9722,0X9723,0X9724,0X9725,0X9726,0X9727,0X9728,0X9729,0X972B,0X972C,0X972E,0X972F,0X9731,0X9733,0X9734,
-    0X9735,0X9736,0X9737,0X973A,0X973B,0X973C,0X973D,0X973F,0X9740,0X9741,0X9742,0X9743,0X9744,0X9745,0X9746,0X9747,
-    0X9748,0X9749,0X974A,0X974B,0X974C,0X974D,0X974E,0X974F,0X9750,0X9751,0X9754,0X9755,0X9757,0X9758,0X975A,0X975C,
-    0X975D,0X975F,0X9763,0X9764,0X9766,0X9767,0X9768,0X976A,0X976B,0X976C,0X976D,0X976E,0X976F,0X9770,0X9771,0X0001,
-    0X9772,0X9775,0X9777,0X9778,0X9779,0X977A,0X977B,0X977D,0X977E,0X977F,0X9780,0X9781,0X9782,0X9783,0X9784,0X9786,
-    0X9787,0X9788,0X9789,0X978A,0X978C,0X978E,0X978F,0X9790,0X9793,0X9795,0X9796,0X9797,0X9799,0X979A,0X979B,0X979C,
-    0X979D,0X81C1,0X81A6,0X6B24,0X6B37,0X6B39,0X6B43,0X6B46,0X6B59,0X98D1,0X98D2,0X98D3,0X98D5,0X98D9,0X98DA,0X6BB3,
-    0X5F40,0X6BC2,0X89F3,0X6590,0X9F51,0X6593,0X65BC,0X65C6,0X65C4,0X65C3,0X65CC,0X65CE,0X65D2,0X65D6,0X7080,0X709C,
-    0X7096,0X709D,0X70BB,0X70C0,0X70B7,0X70AB,0X70B1,0X70E8,0X70CA,0X7110,0X7113,0X7116,0X712F,0X7131,0X7173,0X715C,
-    0X7168,0X7145,0X7172,0X714A,0X7178,0X717A,0X7198,0X71B3,0X71B5,0X71A8,0X71A0,0X71E0,0X71D4,0X71E7,0X71F9,0X721D,
-    0X7228,0X706C,0X7118,0X7166,0X71B9,0X623E,0X623D,0X6243,0X6248,0X6249,0X793B,0X7940,0X7946,0X7949,0X795B,0X795C,
-    0X7953,0X795A,0X7962,0X7957,0X7960,0X796F,0X7967,0X797A,0X7985,0X798A,0X799A,0X79A7,0X79B3,0X5FD1,0X5FD0,0X0001,
-    0X979E,0X979F,0X97A1,0X97A2,0X97A4,0X97A5,0X97A6,0X97A7,0X97A8,0X97A9,0X97AA,0X97AC,0X97AE,0X97B0,0X97B1,0X97B3,
-    0X97B5,0X97B6,0X97B7,0X97B8,0X97B9,0X97BA,0X97BB,0X97BC,0X97BD,0X97BE,0X97BF,0X97C0,0X97C1,0X97C2,0X97C3,0X97C4,
-    0X97C5,0X97C6,0X97C7,0X97C8,0X97C9,0X97CA,0X97CB,0X97CC,0X97CD,0X97CE,0X97CF,0X97D0,0X97D1,0X97D2,0X97D3,0X97D4,
-    0X97D5,0X97D6,0X97D7,0X97D8,0X97D9,0X97DA,0X97DB,0X97DC,0X97DD,0X97DE,0X97DF,0X97E0,0X97E1,0X97E2,0X97E3,0X0001,
-    0X97E4,0X97E5,0X97E8,0X97EE,0X97EF,0X97F0,0X97F1,0X97F2,0X97F4,0X97F7,0X97F8,0X97F9,0X97FA,0X97FB,0X97FC,0X97FD,
-    0X97FE,0X97FF,0X9800,0X9801,0X9802,0X9803,0X9804,0X9805,0X9806,0X9807,0X9808,0X9809,0X980A,0X980B,0X980C,0X980D,
-    0X980E,0X603C,0X605D,0X605A,0X6067,0X6041,0X6059,0X6063,0X60AB,0X6106,0X610D,0X615D,0X61A9,0X619D,0X61CB,0X61D1,
-    0X6206,0X8080,0X807F,0X6C93,0X6CF6,0X6DFC,0X77F6,0X77F8,0X7800,0X7809,0X7817,0X7818,0X7811,0X65AB,0X782D,0X781C,
-    0X781D,0X7839,0X783A,0X783B,0X781F,0X783C,0X7825,0X782C,0X7823,0X7829,0X784E,0X786D,0X7856,0X7857,0X7826,0X7850,
-    0X7847,0X784C,0X786A,0X789B,0X7893,0X789A,0X7887,0X789C,0X78A1,0X78A3,0X78B2,0X78B9,0X78A5,0X78D4,0X78D9,0X78C9,
-    0X78EC,0X78F2,0X7905,0X78F4,0X7913,0X7924,0X791E,0X7934,0X9F9B,0X9EF9,0X9EFB,0X9EFC,0X76F1,0X7704,0X770D,0X76F9,
-    0X7707,0X7708,0X771A,0X7722,0X7719,0X772D,0X7726,0X7735,0X7738,0X7750,0X7751,0X7747,0X7743,0X775A,0X7768,0X0001,
-    0X980F,0X9810,0X9811,0X9812,0X9813,0X9814,0X9815,0X9816,0X9817,0X9818,0X9819,0X981A,0X981B,0X981C,0X981D,0X981E,
-    0X981F,0X9820,0X9821,0X9822,0X9823,0X9824,0X9825,0X9826,0X9827,0X9828,0X9829,0X982A,0X982B,0X982C,0X982D,0X982E,
-    0X982F,0X9830,0X9831,0X9832,0X9833,0X9834,0X9835,0X9836,0X9837,0X9838,0X9839,0X983A,0X983B,0X983C,0X983D,0X983E,
-    0X983F,0X9840,0X9841,0X9842,0X9843,0X9844,0X9845,0X9846,0X9847,0X9848,0X9849,0X984A,0X984B,0X984C,0X984D,0X0001,
-    0X984E,0X984F,0X9850,0X9851,0X9852,0X9853,0X9854,0X9855,0X9856,0X9857,0X9858,0X9859,0X985A,0X985B,0X985C,0X985D,
-    0X985E,0X985F,0X9860,0X9861,0X9862,0X9863,0X9864,0X9865,0X9866,0X9867,0X9868,0X9869,0X986A,0X986B,0X986C,0X986D,
-    0X986E,0X7762,0X7765,0X777F,0X778D,0X777D,0X7780,0X778C,0X7791,0X779F,0X77A0,0X77B0,0X77B5,0X77BD,0X753A,0X7540,
-    0X754E,0X754B,0X7548,0X755B,0X7572,0X7579,0X7583,0X7F58,0X7F61,0X7F5F,0X8A48,0X7F68,0X7F74,0X7F71,0X7F79,0X7F81,
-    0X7F7E,0X76CD,0X76E5,0X8832,0X9485,0X9486,0X9487,0X948B,0X948A,0X948C,0X948D,0X948F,0X9490,0X9494,0X9497,0X9495,
-    0X949A,0X949B,0X949C,0X94A3,0X94A4,0X94AB,0X94AA,0X94AD,0X94AC,0X94AF,0X94B0,0X94B2,0X94B4,0X94B6,0X94B7,0X94B8,
-    0X94B9,0X94BA,0X94BC,0X94BD,0X94BF,0X94C4,0X94C8,0X94C9,0X94CA,0X94CB,0X94CC,0X94CD,0X94CE,0X94D0,0X94D1,0X94D2,
-    0X94D5,0X94D6,0X94D7,0X94D9,0X94D8,0X94DB,0X94DE,0X94DF,0X94E0,0X94E2,0X94E4,0X94E5,0X94E7,0X94E8,0X94EA,0X0001,
-    0X986F,0X9870,0X9871,0X9872,0X9873,0X9874,0X988B,0X988E,0X9892,0X9895,0X9899,0X98A3,0X98A8,0X98A9,0X98AA,0X98AB,
-    0X98AC,0X98AD,0X98AE,0X98AF,0X98B0,0X98B1,0X98B2,0X98B3,0X98B4,0X98B5,0X98B6,0X98B7,0X98B8,0X98B9,0X98BA,0X98BB,
-    0X98BC,0X98BD,0X98BE,0X98BF,0X98C0,0X98C1,0X98C2,0X98C3,0X98C4,0X98C5,0X98C6,0X98C7,0X98C8,0X98C9,0X98CA,0X98CB,
-    0X98CC,0X98CD,0X98CF,0X98D0,0X98D4,0X98D6,0X98D7,0X98DB,0X98DC,0X98DD,0X98E0,0X98E1,0X98E2,0X98E3,0X98E4,0X0001,
-    0X98E5,0X98E6,0X98E9,0X98EA,0X98EB,0X98EC,0X98ED,0X98EE,0X98EF,0X98F0,0X98F1,0X98F2,0X98F3,0X98F4,0X98F5,0X98F6,
-    0X98F7,0X98F8,0X98F9,0X98FA,0X98FB,0X98FC,0X98FD,0X98FE,0X98FF,0X9900,0X9901,0X9902,0X9903,0X9904,0X9905,0X9906,
-    0X9907,0X94E9,0X94EB,0X94EE,0X94EF,0X94F3,0X94F4,0X94F5,0X94F7,0X94F9,0X94FC,0X94FD,0X94FF,0X9503,0X9502,0X9506,
-    0X9507,0X9509,0X950A,0X950D,0X950E,0X950F,0X9512,0X9513,0X9514,0X9515,0X9516,0X9518,0X951B,0X951D,0X951E,0X951F,
-    0X9522,0X952A,0X952B,0X9529,0X952C,0X9531,0X9532,0X9534,0X9536,0X9537,0X9538,0X953C,0X953E,0X953F,0X9542,0X9535,
-    0X9544,0X9545,0X9546,0X9549,0X954C,0X954E,0X954F,0X9552,0X9553,0X9554,0X9556,0X9557,0X9558,0X9559,0X955B,0X955E,
-    0X955F,0X955D,0X9561,0X9562,0X9564,0X9565,0X9566,0X9567,0X9568,0X9569,0X956A,0X956B,0X956C,0X956F,0X9571,0X9572,
-    0X9573,0X953A,0X77E7,0X77EC,0X96C9,0X79D5,0X79ED,0X79E3,0X79EB,0X7A06,0X5D47,0X7A03,0X7A02,0X7A1E,0X7A14,0X0001,
-    0X9908,0X9909,0X990A,0X990B,0X990C,0X990E,0X990F,0X9911,0X9912,0X9913,0X9914,0X9915,0X9916,0X9917,0X9918,0X9919,
-    0X991A,0X991B,0X991C,0X991D,0X991E,0X991F,0X9920,0X9921,0X9922,0X9923,0X9924,0X9925,0X9926,0X9927,0X9928,0X9929,
-    0X992A,0X992B,0X992C,0X992D,0X992F,0X9930,0X9931,0X9932,0X9933,0X9934,0X9935,0X9936,0X9937,0X9938,0X9939,0X993A,
-    0X993B,0X993C,0X993D,0X993E,0X993F,0X9940,0X9941,0X9942,0X9943,0X9944,0X9945,0X9946,0X9947,0X9948,0X9949,0X0001,
-    0X994A,0X994B,0X994C,0X994D,0X994E,0X994F,0X9950,0X9951,0X9952,0X9953,0X9956,0X9957,0X9958,0X9959,0X995A,0X995B,
-    0X995C,0X995D,0X995E,0X995F,0X9960,0X9961,0X9962,0X9964,0X9966,0X9973,0X9978,0X9979,0X997B,0X997E,0X9982,0X9983,
-    0X9989,0X7A39,0X7A37,0X7A51,0X9ECF,0X99A5,0X7A70,0X7688,0X768E,0X7693,0X7699,0X76A4,0X74DE,0X74E0,0X752C,0X9E20,
-    0X9E22,0X9E28,0X9E29,0X9E2A,0X9E2B,0X9E2C,0X9E32,0X9E31,0X9E36,0X9E38,0X9E37,0X9E39,0X9E3A,0X9E3E,0X9E41,0X9E42,
-    0X9E44,0X9E46,0X9E47,0X9E48,0X9E49,0X9E4B,0X9E4C,0X9E4E,0X9E51,0X9E55,0X9E57,0X9E5A,0X9E5B,0X9E5C,0X9E5E,0X9E63,
-    0X9E66,0X9E67,0X9E68,0X9E69,0X9E6A,0X9E6B,0X9E6C,0X9E71,0X9E6D,0X9E73,0X7592,0X7594,0X7596,0X75A0,0X759D,0X75AC,
-    0X75A3,0X75B3,0X75B4,0X75B8,0X75C4,0X75B1,0X75B0,0X75C3,0X75C2,0X75D6,0X75CD,0X75E3,0X75E8,0X75E6,0X75E4,0X75EB,
-    0X75E7,0X7603,0X75F1,0X75FC,0X75FF,0X7610,0X7600,0X7605,0X760C,0X7617,0X760A,0X7625,0X7618,0X7615,0X7619,0X0001,
-    0X998C,0X998E,0X999A,0X999B,0X999C,0X999D,0X999E,0X999F,0X99A0,0X99A1,0X99A2,0X99A3,0X99A4,0X99A6,0X99A7,0X99A9,
-    0X99AA,0X99AB,0X99AC,0X99AD,0X99AE,0X99AF,0X99B0,0X99B1,0X99B2,0X99B3,0X99B4,0X99B5,0X99B6,0X99B7,0X99B8,0X99B9,
-    0X99BA,0X99BB,0X99BC,0X99BD,0X99BE,0X99BF,0X99C0,0X99C1,0X99C2,0X99C3,0X99C4,0X99C5,0X99C6,0X99C7,0X99C8,0X99C9,
-    0X99CA,0X99CB,0X99CC,0X99CD,0X99CE,0X99CF,0X99D0,0X99D1,0X99D2,0X99D3,0X99D4,0X99D5,0X99D6,0X99D7,0X99D8,0X0001,
-    0X99D9,0X99DA,0X99DB,0X99DC,0X99DD,0X99DE,0X99DF,0X99E0,0X99E1,0X99E2,0X99E3,0X99E4,0X99E5,0X99E6,0X99E7,0X99E8,
-    0X99E9,0X99EA,0X99EB,0X99EC,0X99ED,0X99EE,0X99EF,0X99F0,0X99F1,0X99F2,0X99F3,0X99F4,0X99F5,0X99F6,0X99F7,0X99F8,
-    0X99F9,0X761B,0X763C,0X7622,0X7620,0X7640,0X762D,0X7630,0X763F,0X7635,0X7643,0X763E,0X7633,0X764D,0X765E,0X7654,
-    0X765C,0X7656,0X766B,0X766F,0X7FCA,0X7AE6,0X7A78,0X7A79,0X7A80,0X7A86,0X7A88,0X7A95,0X7AA6,0X7AA0,0X7AAC,0X7AA8,
-    0X7AAD,0X7AB3,0X8864,0X8869,0X8872,0X887D,0X887F,0X8882,0X88A2,0X88C6,0X88B7,0X88BC,0X88C9,0X88E2,0X88CE,0X88E3,
-    0X88E5,0X88F1,0X891A,0X88FC,0X88E8,0X88FE,0X88F0,0X8921,0X8919,0X8913,0X891B,0X890A,0X8934,0X892B,0X8936,0X8941,
-    0X8966,0X897B,0X758B,0X80E5,0X76B2,0X76B4,0X77DC,0X8012,0X8014,0X8016,0X801C,0X8020,0X8022,0X8025,0X8026,0X8027,
-    0X8029,0X8028,0X8031,0X800B,0X8035,0X8043,0X8046,0X804D,0X8052,0X8069,0X8071,0X8983,0X9878,0X9880,0X9883,0X0001,
-    0X99FA,0X99FB,0X99FC,0X99FD,0X99FE,0X99FF,0X9A00,0X9A01,0X9A02,0X9A03,0X9A04,0X9A05,0X9A06,0X9A07,0X9A08,0X9A09,
-    0X9A0A,0X9A0B,0X9A0C,0X9A0D,0X9A0E,0X9A0F,0X9A10,0X9A11,0X9A12,0X9A13,0X9A14,0X9A15,0X9A16,0X9A17,0X9A18,0X9A19,
-    0X9A1A,0X9A1B,0X9A1C,0X9A1D,0X9A1E,0X9A1F,0X9A20,0X9A21,0X9A22,0X9A23,0X9A24,0X9A25,0X9A26,0X9A27,0X9A28,0X9A29,
-    0X9A2A,0X9A2B,0X9A2C,0X9A2D,0X9A2E,0X9A2F,0X9A30,0X9A31,0X9A32,0X9A33,0X9A34,0X9A35,0X9A36,0X9A37,0X9A38,0X0001,
-    0X9A39,0X9A3A,0X9A3B,0X9A3C,0X9A3D,0X9A3E,0X9A3F,0X9A40,0X9A41,0X9A42,0X9A43,0X9A44,0X9A45,0X9A46,0X9A47,0X9A48,
-    0X9A49,0X9A4A,0X9A4B,0X9A4C,0X9A4D,0X9A4E,0X9A4F,0X9A50,0X9A51,0X9A52,0X9A53,0X9A54,0X9A55,0X9A56,0X9A57,0X9A58,
-    0X9A59,0X9889,0X988C,0X988D,0X988F,0X9894,0X989A,0X989B,0X989E,0X989F,0X98A1,0X98A2,0X98A5,0X98A6,0X864D,0X8654,
-    0X866C,0X866E,0X867F,0X867A,0X867C,0X867B,0X86A8,0X868D,0X868B,0X86AC,0X869D,0X86A7,0X86A3,0X86AA,0X8693,0X86A9,
-    0X86B6,0X86C4,0X86B5,0X86CE,0X86B0,0X86BA,0X86B1,0X86AF,0X86C9,0X86CF,0X86B4,0X86E9,0X86F1,0X86F2,0X86ED,0X86F3,
-    0X86D0,0X8713,0X86DE,0X86F4,0X86DF,0X86D8,0X86D1,0X8703,0X8707,0X86F8,0X8708,0X870A,0X870D,0X8709,0X8723,0X873B,
-    0X871E,0X8725,0X872E,0X871A,0X873E,0X8748,0X8734,0X8731,0X8729,0X8737,0X873F,0X8782,0X8722,0X877D,0X877E,0X877B,
-    0X8760,0X8770,0X874C,0X876E,0X878B,0X8753,0X8763,0X877C,0X8764,0X8759,0X8765,0X8793,0X87AF,0X87A8,0X87D2,0X0001,
-    0X9A5A,0X9A5B,0X9A5C,0X9A5D,0X9A5E,0X9A5F,0X9A60,0X9A61,0X9A62,0X9A63,0X9A64,0X9A65,0X9A66,0X9A67,0X9A68,0X9A69,
-    0X9A6A,0X9A6B,0X9A72,0X9A83,0X9A89,0X9A8D,0X9A8E,0X9A94,0X9A95,0X9A99,0X9AA6,0X9AA9,0X9AAA,0X9AAB,0X9AAC,0X9AAD,
-    0X9AAE,0X9AAF,0X9AB2,0X9AB3,0X9AB4,0X9AB5,0X9AB9,0X9ABB,0X9ABD,0X9ABE,0X9ABF,0X9AC3,0X9AC4,0X9AC6,0X9AC7,0X9AC8,
-    0X9AC9,0X9ACA,0X9ACD,0X9ACE,0X9ACF,0X9AD0,0X9AD2,0X9AD4,0X9AD5,0X9AD6,0X9AD7,0X9AD9,0X9ADA,0X9ADB,0X9ADC,0X0001,
-    0X9ADD,0X9ADE,0X9AE0,0X9AE2,0X9AE3,0X9AE4,0X9AE5,0X9AE7,0X9AE8,0X9AE9,0X9AEA,0X9AEC,0X9AEE,0X9AF0,0X9AF1,0X9AF2,
-    0X9AF3,0X9AF4,0X9AF5,0X9AF6,0X9AF7,0X9AF8,0X9AFA,0X9AFC,0X9AFD,0X9AFE,0X9AFF,0X9B00,0X9B01,0X9B02,0X9B04,0X9B05,
-    0X9B06,0X87C6,0X8788,0X8785,0X87AD,0X8797,0X8783,0X87AB,0X87E5,0X87AC,0X87B5,0X87B3,0X87CB,0X87D3,0X87BD,0X87D1,
-    0X87C0,0X87CA,0X87DB,0X87EA,0X87E0,0X87EE,0X8816,0X8813,0X87FE,0X880A,0X881B,0X8821,0X8839,0X883C,0X7F36,0X7F42,
-    0X7F44,0X7F45,0X8210,0X7AFA,0X7AFD,0X7B08,0X7B03,0X7B04,0X7B15,0X7B0A,0X7B2B,0X7B0F,0X7B47,0X7B38,0X7B2A,0X7B19,
-    0X7B2E,0X7B31,0X7B20,0X7B25,0X7B24,0X7B33,0X7B3E,0X7B1E,0X7B58,0X7B5A,0X7B45,0X7B75,0X7B4C,0X7B5D,0X7B60,0X7B6E,
-    0X7B7B,0X7B62,0X7B72,0X7B71,0X7B90,0X7BA6,0X7BA7,0X7BB8,0X7BAC,0X7B9D,0X7BA8,0X7B85,0X7BAA,0X7B9C,0X7BA2,0X7BAB,
-    0X7BB4,0X7BD1,0X7BC1,0X7BCC,0X7BDD,0X7BDA,0X7BE5,0X7BE6,0X7BEA,0X7C0C,0X7BFE,0X7BFC,0X7C0F,0X7C16,0X7C0B,0X0001,
-    0X9B07,0X9B09,0X9B0A,0X9B0B,0X9B0C,0X9B0D,0X9B0E,0X9B10,0X9B11,0X9B12,0X9B14,0X9B15,0X9B16,0X9B17,0X9B18,0X9B19,
-    0X9B1A,0X9B1B,0X9B1C,0X9B1D,0X9B1E,0X9B20,0X9B21,0X9B22,0X9B24,0X9B25,0X9B26,0X9B27,0X9B28,0X9B29,0X9B2A,0X9B2B,
-    0X9B2C,0X9B2D,0X9B2E,0X9B30,0X9B31,0X9B33,0X9B34,0X9B35,0X9B36,0X9B37,0X9B38,0X9B39,0X9B3A,0X9B3D,0X9B3E,0X9B3F,
-    0X9B40,0X9B46,0X9B4A,0X9B4B,0X9B4C,0X9B4E,0X9B50,0X9B52,0X9B53,0X9B55,0X9B56,0X9B57,0X9B58,0X9B59,0X9B5A,0X0001,
-    0X9B5B,0X9B5C,0X9B5D,0X9B5E,0X9B5F,0X9B60,0X9B61,0X9B62,0X9B63,0X9B64,0X9B65,0X9B66,0X9B67,0X9B68,0X9B69,0X9B6A,
-    0X9B6B,0X9B6C,0X9B6D,0X9B6E,0X9B6F,0X9B70,0X9B71,0X9B72,0X9B73,0X9B74,0X9B75,0X9B76,0X9B77,0X9B78,0X9B79,0X9B7A,
-    0X9B7B,0X7C1F,0X7C2A,0X7C26,0X7C38,0X7C41,0X7C40,0X81FE,0X8201,0X8202,0X8204,0X81EC,0X8844,0X8221,0X8222,0X8223,
-    0X822D,0X822F,0X8228,0X822B,0X8238,0X823B,0X8233,0X8234,0X823E,0X8244,0X8249,0X824B,0X824F,0X825A,0X825F,0X8268,
-    0X887E,0X8885,0X8888,0X88D8,0X88DF,0X895E,0X7F9D,0X7F9F,0X7FA7,0X7FAF,0X7FB0,0X7FB2,0X7C7C,0X6549,0X7C91,0X7C9D,
-    0X7C9C,0X7C9E,0X7CA2,0X7CB2,0X7CBC,0X7CBD,0X7CC1,0X7CC7,0X7CCC,0X7CCD,0X7CC8,0X7CC5,0X7CD7,0X7CE8,0X826E,0X66A8,
-    0X7FBF,0X7FCE,0X7FD5,0X7FE5,0X7FE1,0X7FE6,0X7FE9,0X7FEE,0X7FF3,0X7CF8,0X7D77,0X7DA6,0X7DAE,0X7E47,0X7E9B,0X9EB8,
-    0X9EB4,0X8D73,0X8D84,0X8D94,0X8D91,0X8DB1,0X8D67,0X8D6D,0X8C47,0X8C49,0X914A,0X9150,0X914E,0X914F,0X9164,0X0001,
-    0X9B7C,0X9B7D,0X9B7E,0X9B7F,0X9B80,0X9B81,0X9B82,0X9B83,0X9B84,0X9B85,0X9B86,0X9B87,0X9B88,0X9B89,0X9B8A,0X9B8B,
-    0X9B8C,0X9B8D,0X9B8E,0X9B8F,0X9B90,0X9B91,0X9B92,0X9B93,0X9B94,0X9B95,0X9B96,0X9B97,0X9B98,0X9B99,0X9B9A,0X9B9B,
-    0X9B9C,0X9B9D,0X9B9E,0X9B9F,0X9BA0,0X9BA1,0X9BA2,0X9BA3,0X9BA4,0X9BA5,0X9BA6,0X9BA7,0X9BA8,0X9BA9,0X9BAA,0X9BAB,
-    0X9BAC,0X9BAD,0X9BAE,0X9BAF,0X9BB0,0X9BB1,0X9BB2,0X9BB3,0X9BB4,0X9BB5,0X9BB6,0X9BB7,0X9BB8,0X9BB9,0X9BBA,0X0001,
-    0X9BBB,0X9BBC,0X9BBD,0X9BBE,0X9BBF,0X9BC0,0X9BC1,0X9BC2,0X9BC3,0X9BC4,0X9BC5,0X9BC6,0X9BC7,0X9BC8,0X9BC9,0X9BCA,
-    0X9BCB,0X9BCC,0X9BCD,0X9BCE,0X9BCF,0X9BD0,0X9BD1,0X9BD2,0X9BD3,0X9BD4,0X9BD5,0X9BD6,0X9BD7,0X9BD8,0X9BD9,0X9BDA,
-    0X9BDB,0X9162,0X9161,0X9170,0X9169,0X916F,0X917D,0X917E,0X9172,0X9174,0X9179,0X918C,0X9185,0X9190,0X918D,0X9191,
-    0X91A2,0X91A3,0X91AA,0X91AD,0X91AE,0X91AF,0X91B5,0X91B4,0X91BA,0X8C55,0X9E7E,0X8DB8,0X8DEB,0X8E05,0X8E59,0X8E69,
-    0X8DB5,0X8DBF,0X8DBC,0X8DBA,0X8DC4,0X8DD6,0X8DD7,0X8DDA,0X8DDE,0X8DCE,0X8DCF,0X8DDB,0X8DC6,0X8DEC,0X8DF7,0X8DF8,
-    0X8DE3,0X8DF9,0X8DFB,0X8DE4,0X8E09,0X8DFD,0X8E14,0X8E1D,0X8E1F,0X8E2C,0X8E2E,0X8E23,0X8E2F,0X8E3A,0X8E40,0X8E39,
-    0X8E35,0X8E3D,0X8E31,0X8E49,0X8E41,0X8E42,0X8E51,0X8E52,0X8E4A,0X8E70,0X8E76,0X8E7C,0X8E6F,0X8E74,0X8E85,0X8E8F,
-    0X8E94,0X8E90,0X8E9C,0X8E9E,0X8C78,0X8C82,0X8C8A,0X8C85,0X8C98,0X8C94,0X659B,0X89D6,0X89DE,0X89DA,0X89DC,0X0001,
-    0X9BDC,0X9BDD,0X9BDE,0X9BDF,0X9BE0,0X9BE1,0X9BE2,0X9BE3,0X9BE4,0X9BE5,0X9BE6,0X9BE7,0X9BE8,0X9BE9,0X9BEA,0X9BEB,
-    0X9BEC,0X9BED,0X9BEE,0X9BEF,0X9BF0,0X9BF1,0X9BF2,0X9BF3,0X9BF4,0X9BF5,0X9BF6,0X9BF7,0X9BF8,0X9BF9,0X9BFA,0X9BFB,
-    0X9BFC,0X9BFD,0X9BFE,0X9BFF,0X9C00,0X9C01,0X9C02,0X9C03,0X9C04,0X9C05,0X9C06,0X9C07,0X9C08,0X9C09,0X9C0A,0X9C0B,
-    0X9C0C,0X9C0D,0X9C0E,0X9C0F,0X9C10,0X9C11,0X9C12,0X9C13,0X9C14,0X9C15,0X9C16,0X9C17,0X9C18,0X9C19,0X9C1A,0X0001,
-    0X9C1B,0X9C1C,0X9C1D,0X9C1E,0X9C1F,0X9C20,0X9C21,0X9C22,0X9C23,0X9C24,0X9C25,0X9C26,0X9C27,0X9C28,0X9C29,0X9C2A,
-    0X9C2B,0X9C2C,0X9C2D,0X9C2E,0X9C2F,0X9C30,0X9C31,0X9C32,0X9C33,0X9C34,0X9C35,0X9C36,0X9C37,0X9C38,0X9C39,0X9C3A,
-    0X9C3B,0X89E5,0X89EB,0X89EF,0X8A3E,0X8B26,0X9753,0X96E9,0X96F3,0X96EF,0X9706,0X9701,0X9708,0X970F,0X970E,0X972A,
-    0X972D,0X9730,0X973E,0X9F80,0X9F83,0X9F85,0X9F86,0X9F87,0X9F88,0X9F89,0X9F8A,0X9F8C,0X9EFE,0X9F0B,0X9F0D,0X96B9,
-    0X96BC,0X96BD,0X96CE,0X96D2,0X77BF,0X96E0,0X928E,0X92AE,0X92C8,0X933E,0X936A,0X93CA,0X938F,0X943E,0X946B,0X9C7F,
-    0X9C82,0X9C85,0X9C86,0X9C87,0X9C88,0X7A23,0X9C8B,0X9C8E,0X9C90,0X9C91,0X9C92,0X9C94,0X9C95,0X9C9A,0X9C9B,0X9C9E,
-    0X9C9F,0X9CA0,0X9CA1,0X9CA2,0X9CA3,0X9CA5,0X9CA6,0X9CA7,0X9CA8,0X9CA9,0X9CAB,0X9CAD,0X9CAE,0X9CB0,0X9CB1,0X9CB2,
-    0X9CB3,0X9CB4,0X9CB5,0X9CB6,0X9CB7,0X9CBA,0X9CBB,0X9CBC,0X9CBD,0X9CC4,0X9CC5,0X9CC6,0X9CC7,0X9CCA,0X9CCB,0X0001,
-    0X9C3C,0X9C3D,0X9C3E,0X9C3F,0X9C40,0X9C41,0X9C42,0X9C43,0X9C44,0X9C45,0X9C46,0X9C47,0X9C48,0X9C49,0X9C4A,0X9C4B,
-    0X9C4C,0X9C4D,0X9C4E,0X9C4F,0X9C50,0X9C51,0X9C52,0X9C53,0X9C54,0X9C55,0X9C56,0X9C57,0X9C58,0X9C59,0X9C5A,0X9C5B,
-    0X9C5C,0X9C5D,0X9C5E,0X9C5F,0X9C60,0X9C61,0X9C62,0X9C63,0X9C64,0X9C65,0X9C66,0X9C67,0X9C68,0X9C69,0X9C6A,0X9C6B,
-    0X9C6C,0X9C6D,0X9C6E,0X9C6F,0X9C70,0X9C71,0X9C72,0X9C73,0X9C74,0X9C75,0X9C76,0X9C77,0X9C78,0X9C79,0X9C7A,0X0001,
-    0X9C7B,0X9C7D,0X9C7E,0X9C80,0X9C83,0X9C84,0X9C89,0X9C8A,0X9C8C,0X9C8F,0X9C93,0X9C96,0X9C97,0X9C98,0X9C99,0X9C9D,
-    0X9CAA,0X9CAC,0X9CAF,0X9CB9,0X9CBE,0X9CBF,0X9CC0,0X9CC1,0X9CC2,0X9CC8,0X9CC9,0X9CD1,0X9CD2,0X9CDA,0X9CDB,0X9CE0,
-    0X9CE1,0X9CCC,0X9CCD,0X9CCE,0X9CCF,0X9CD0,0X9CD3,0X9CD4,0X9CD5,0X9CD7,0X9CD8,0X9CD9,0X9CDC,0X9CDD,0X9CDF,0X9CE2,
-    0X977C,0X9785,0X9791,0X9792,0X9794,0X97AF,0X97AB,0X97A3,0X97B2,0X97B4,0X9AB1,0X9AB0,0X9AB7,0X9E58,0X9AB6,0X9ABA,
-    0X9ABC,0X9AC1,0X9AC0,0X9AC5,0X9AC2,0X9ACB,0X9ACC,0X9AD1,0X9B45,0X9B43,0X9B47,0X9B49,0X9B48,0X9B4D,0X9B51,0X98E8,
-    0X990D,0X992E,0X9955,0X9954,0X9ADF,0X9AE1,0X9AE6,0X9AEF,0X9AEB,0X9AFB,0X9AED,0X9AF9,0X9B08,0X9B0F,0X9B13,0X9B1F,
-    0X9B23,0X9EBD,0X9EBE,0X7E3B,0X9E82,0X9E87,0X9E88,0X9E8B,0X9E92,0X93D6,0X9E9D,0X9E9F,0X9EDB,0X9EDC,0X9EDD,0X9EE0,
-    0X9EDF,0X9EE2,0X9EE9,0X9EE7,0X9EE5,0X9EEA,0X9EEF,0X9F22,0X9F2C,0X9F2F,0X9F39,0X9F37,0X9F3D,0X9F3E,0X9F44,0X0001,
-    0X9CE3,0X9CE4,0X9CE5,0X9CE6,0X9CE7,0X9CE8,0X9CE9,0X9CEA,0X9CEB,0X9CEC,0X9CED,0X9CEE,0X9CEF,0X9CF0,0X9CF1,0X9CF2,
-    0X9CF3,0X9CF4,0X9CF5,0X9CF6,0X9CF7,0X9CF8,0X9CF9,0X9CFA,0X9CFB,0X9CFC,0X9CFD,0X9CFE,0X9CFF,0X9D00,0X9D01,0X9D02,
-    0X9D03,0X9D04,0X9D05,0X9D06,0X9D07,0X9D08,0X9D09,0X9D0A,0X9D0B,0X9D0C,0X9D0D,0X9D0E,0X9D0F,0X9D10,0X9D11,0X9D12,
-    0X9D13,0X9D14,0X9D15,0X9D16,0X9D17,0X9D18,0X9D19,0X9D1A,0X9D1B,0X9D1C,0X9D1D,0X9D1E,0X9D1F,0X9D20,0X9D21,0X0001,
-    0X9D22,0X9D23,0X9D24,0X9D25,0X9D26,0X9D27,0X9D28,0X9D29,0X9D2A,0X9D2B,0X9D2C,0X9D2D,0X9D2E,0X9D2F,0X9D30,0X9D31,
-    0X9D32,0X9D33,0X9D34,0X9D35,0X9D36,0X9D37,0X9D38,0X9D39,0X9D3A,0X9D3B,0X9D3C,0X9D3D,0X9D3E,0X9D3F,0X9D40,0X9D41,
-    0X9D42,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X9D43,0X9D44,0X9D45,0X9D46,0X9D47,0X9D48,0X9D49,0X9D4A,0X9D4B,0X9D4C,0X9D4D,0X9D4E,0X9D4F,0X9D50,0X9D51,0X9D52,
-    0X9D53,0X9D54,0X9D55,0X9D56,0X9D57,0X9D58,0X9D59,0X9D5A,0X9D5B,0X9D5C,0X9D5D,0X9D5E,0X9D5F,0X9D60,0X9D61,0X9D62,
-    0X9D63,0X9D64,0X9D65,0X9D66,0X9D67,0X9D68,0X9D69,0X9D6A,0X9D6B,0X9D6C,0X9D6D,0X9D6E,0X9D6F,0X9D70,0X9D71,0X9D72,
-    0X9D73,0X9D74,0X9D75,0X9D76,0X9D77,0X9D78,0X9D79,0X9D7A,0X9D7B,0X9D7C,0X9D7D,0X9D7E,0X9D7F,0X9D80,0X9D81,0X0001,
-    0X9D82,0X9D83,0X9D84,0X9D85,0X9D86,0X9D87,0X9D88,0X9D89,0X9D8A,0X9D8B,0X9D8C,0X9D8D,0X9D8E,0X9D8F,0X9D90,0X9D91,
-    0X9D92,0X9D93,0X9D94,0X9D95,0X9D96,0X9D97,0X9D98,0X9D99,0X9D9A,0X9D9B,0X9D9C,0X9D9D,0X9D9E,0X9D9F,0X9DA0,0X9DA1,
-    0X9DA2,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X9DA3,0X9DA4,0X9DA5,0X9DA6,0X9DA7,0X9DA8,0X9DA9,0X9DAA,0X9DAB,0X9DAC,0X9DAD,0X9DAE,0X9DAF,0X9DB0,0X9DB1,0X9DB2,
-    0X9DB3,0X9DB4,0X9DB5,0X9DB6,0X9DB7,0X9DB8,0X9DB9,0X9DBA,0X9DBB,0X9DBC,0X9DBD,0X9DBE,0X9DBF,0X9DC0,0X9DC1,0X9DC2,
-    0X9DC3,0X9DC4,0X9DC5,0X9DC6,0X9DC7,0X9DC8,0X9DC9,0X9DCA,0X9DCB,0X9DCC,0X9DCD,0X9DCE,0X9DCF,0X9DD0,0X9DD1,0X9DD2,
-    0X9DD3,0X9DD4,0X9DD5,0X9DD6,0X9DD7,0X9DD8,0X9DD9,0X9DDA,0X9DDB,0X9DDC,0X9DDD,0X9DDE,0X9DDF,0X9DE0,0X9DE1,0X0001,
-    0X9DE2,0X9DE3,0X9DE4,0X9DE5,0X9DE6,0X9DE7,0X9DE8,0X9DE9,0X9DEA,0X9DEB,0X9DEC,0X9DED,0X9DEE,0X9DEF,0X9DF0,0X9DF1,
-    0X9DF2,0X9DF3,0X9DF4,0X9DF5,0X9DF6,0X9DF7,0X9DF8,0X9DF9,0X9DFA,0X9DFB,0X9DFC,0X9DFD,0X9DFE,0X9DFF,0X9E00,0X9E01,
-    0X9E02,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X9E03,0X9E04,0X9E05,0X9E06,0X9E07,0X9E08,0X9E09,0X9E0A,0X9E0B,0X9E0C,0X9E0D,0X9E0E,0X9E0F,0X9E10,0X9E11,0X9E12,
-    0X9E13,0X9E14,0X9E15,0X9E16,0X9E17,0X9E18,0X9E19,0X9E1A,0X9E1B,0X9E1C,0X9E1D,0X9E1E,0X9E24,0X9E27,0X9E2E,0X9E30,
-    0X9E34,0X9E3B,0X9E3C,0X9E40,0X9E4D,0X9E50,0X9E52,0X9E53,0X9E54,0X9E56,0X9E59,0X9E5D,0X9E5F,0X9E60,0X9E61,0X9E62,
-    0X9E65,0X9E6E,0X9E6F,0X9E72,0X9E74,0X9E75,0X9E76,0X9E77,0X9E78,0X9E79,0X9E7A,0X9E7B,0X9E7C,0X9E7D,0X9E80,0X0001,
-    0X9E81,0X9E83,0X9E84,0X9E85,0X9E86,0X9E89,0X9E8A,0X9E8C,0X9E8D,0X9E8E,0X9E8F,0X9E90,0X9E91,0X9E94,0X9E95,0X9E96,
-    0X9E97,0X9E98,0X9E99,0X9E9A,0X9E9B,0X9E9C,0X9E9E,0X9EA0,0X9EA1,0X9EA2,0X9EA3,0X9EA4,0X9EA5,0X9EA7,0X9EA8,0X9EA9,
-    0X9EAA,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X9EAB,0X9EAC,0X9EAD,0X9EAE,0X9EAF,0X9EB0,0X9EB1,0X9EB2,0X9EB3,0X9EB5,0X9EB6,0X9EB7,0X9EB9,0X9EBA,0X9EBC,0X9EBF,
-    0X9EC0,0X9EC1,0X9EC2,0X9EC3,0X9EC5,0X9EC6,0X9EC7,0X9EC8,0X9ECA,0X9ECB,0X9ECC,0X9ED0,0X9ED2,0X9ED3,0X9ED5,0X9ED6,
-    0X9ED7,0X9ED9,0X9EDA,0X9EDE,0X9EE1,0X9EE3,0X9EE4,0X9EE6,0X9EE8,0X9EEB,0X9EEC,0X9EED,0X9EEE,0X9EF0,0X9EF1,0X9EF2,
-    0X9EF3,0X9EF4,0X9EF5,0X9EF6,0X9EF7,0X9EF8,0X9EFA,0X9EFD,0X9EFF,0X9F00,0X9F01,0X9F02,0X9F03,0X9F04,0X9F05,0X0001,
-    0X9F06,0X9F07,0X9F08,0X9F09,0X9F0A,0X9F0C,0X9F0F,0X9F11,0X9F12,0X9F14,0X9F15,0X9F16,0X9F18,0X9F1A,0X9F1B,0X9F1C,
-    0X9F1D,0X9F1E,0X9F1F,0X9F21,0X9F23,0X9F24,0X9F25,0X9F26,0X9F27,0X9F28,0X9F29,0X9F2A,0X9F2B,0X9F2D,0X9F2E,0X9F30,
-    0X9F31,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X9F32,0X9F33,0X9F34,0X9F35,0X9F36,0X9F38,0X9F3A,0X9F3C,0X9F3F,0X9F40,0X9F41,0X9F42,0X9F43,0X9F45,0X9F46,0X9F47,
-    0X9F48,0X9F49,0X9F4A,0X9F4B,0X9F4C,0X9F4D,0X9F4E,0X9F4F,0X9F52,0X9F53,0X9F54,0X9F55,0X9F56,0X9F57,0X9F58,0X9F59,
-    0X9F5A,0X9F5B,0X9F5C,0X9F5D,0X9F5E,0X9F5F,0X9F60,0X9F61,0X9F62,0X9F63,0X9F64,0X9F65,0X9F66,0X9F67,0X9F68,0X9F69,
-    0X9F6A,0X9F6B,0X9F6C,0X9F6D,0X9F6E,0X9F6F,0X9F70,0X9F71,0X9F72,0X9F73,0X9F74,0X9F75,0X9F76,0X9F77,0X9F78,0X0001,
-    0X9F79,0X9F7A,0X9F7B,0X9F7C,0X9F7D,0X9F7E,0X9F81,0X9F82,0X9F8D,0X9F8E,0X9F8F,0X9F90,0X9F91,0X9F92,0X9F93,0X9F94,
-    0X9F95,0X9F96,0X9F97,0X9F98,0X9F9C,0X9F9D,0X9F9E,0X9FA1,0X9FA2,0X9FA3,0X9FA4,0X9FA5,0XF92C,0XF979,0XF995,0XF9E7,
-    0XF9F1,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0XFA0C,0XFA0D,0XFA0E,0XFA0F,0XFA11,0XFA13,0XFA14,0XFA18,0XFA1F,0XFA20,0XFA21,0XFA23,0XFA24,0XFA27,0XFA28,0XFA29,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-    0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,0X0001,
-};
+#include "gbk2uni_row.h"
 #endif
+#ifndef GBK2UNI_COMPACT
 #define GBK2UNI_TABLE_SIZE (sizeof(GBK2UNI_TABLE) / sizeof(uint16_t))
-// clang-format on
+#endif
 
-bool is_valid_gbk(const uint8_t *data, size_t len) {
-    bool flg = false;
-    uint32_t i = 0;
-    const uint8_t *cur;
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_HIGHS 0x8080808080808080ULL
 
-    if ((NULL == data) || (len <= 0)) {
-        return 0;
+// Length of the leading ascii run, 16 bytes per step with SSE2, otherwise 8 bytes per 64-bit word.
+static inline size_t ascii_prefix_len(const uint8_t *data, size_t len) {
+    size_t i = 0;
+#ifdef GBK2UNI_SSE2
+    while ((i + 16 <= len) && (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(data + i))) == 0)) {
+        i += 16;
     }
+#else
+    uint64_t w = 0;
 
-    LOGD("data=[%p]. len=[%u]", data, len);
+    for (; i + 8 <= len; i += 8) {
+        memcpy(&w, data + i, sizeof(w));
+        if ((w & SWAR_HIGHS) != 0) {
+            break;
+        }
+    }
+#endif
+    while ((i < len) && ((data[i] & 0x80) == 0)) {
+        i++;
+    }
+    return i;
+}
 
-    flg = true;
+// No output filter touches 0x20..0x7E but '"' and '\\'.
+static inline bool is_filter_clean(uint8_t c) {
+    return ((c >= 0x20) && (c < 0x7F) && (c != '"') && (c != '\\'));
+}
 
-    for (i = 0, cur = data; i < len; i++, cur++) {
-        if ((*cur & 0x80) == 0) {
-            /* 0xxxxxxx */
-            continue;
-        } else if ((*cur > 0x80) && (*cur < 0xFF)) {
-            if ((i + 1) >= len) {
-                flg = false;
-                LOGD("%u Is invalid gbk!", cur - data);
+/*
+ * Length of the leading run of is_filter_clean() bytes, and of bytes from 0x80 on if high.
+ * As signed bytes, controls and high bytes are both below 0x20, one compare takes them.
+ */
+static inline size_t filter_prefix_len(const uint8_t *data, size_t len, bool high) {
+    size_t i = 0;
+#ifdef GBK2UNI_SSE2
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i x1f = _mm_set1_epi8(0x1F);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('\\');
+    const __m128i del = _mm_set1_epi8(0x7F);
+    __m128i v, ctrl;
+    uint32_t mask = 0;
+
+    for (; i + 16 <= len; i += 16) {
+        v = _mm_loadu_si128((const __m128i *)(data + i));
+        ctrl = (high ? _mm_cmpeq_epi8(_mm_min_epu8(v, x1f), v) : _mm_cmplt_epi8(v, space));
+        mask = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(ctrl, _mm_cmpeq_epi8(v, quote)),
+                                              _mm_or_si128(_mm_cmpeq_epi8(v, slash), _mm_cmpeq_epi8(v, del))));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#else
+    uint64_t w = 0, q = 0, b = 0, d = 0;
+
+    // (x - 1) & ~x has the high bit of every zero byte, of a few above it too, the byte loop sorts them out.
+    for (; i + 8 <= len; i += 8) {
+        memcpy(&w, data + i, sizeof(w));
+        q = w ^ (SWAR_ONES * '"');
+        b = w ^ (SWAR_ONES * '\\');
+        d = w ^ (SWAR_ONES * 0x7F);
+        if (((((w - SWAR_ONES * 0x20) & (high ? ~w : ~0ULL)) | (high ? 0 : w) | ((q - SWAR_ONES) & ~q) |
+             ((b - SWAR_ONES) & ~b) | ((d - SWAR_ONES) & ~d)) &
+            SWAR_HIGHS) != 0) {
+            break;
+        }
+    }
+#endif
+    while ((i < len) && (is_filter_clean(data[i]) || (high && (data[i] >= 0x80)))) {
+        i++;
+    }
+    return i;
+}
+
+// Dropped by GBK2UTF8_FILTER_C0.
+static inline bool is_filter_c0(uint8_t c) {
+    return (((c < 0x20) && (c != '\t') && (c != '\n') && (c != '\r')) || (c == 0x7F));
+}
+
+/*
+ * The ascii byte data[i] through the filters, see GBK2UTF8_FILTER_C0. Returns the bytes
+ * written to out, -1 if room is too small.
+ */
+static int32_t filter_ascii(const uint8_t *data, size_t i, size_t len, uint32_t filters, uint8_t *out, size_t room) {
+    static const char hex[] = "0123456789abcdef";
+    uint8_t c = data[i], esc = 0;
+    size_t j = i + 1;
+
+    if (((filters & GBK2UTF8_FILTER_C0) != 0) && is_filter_c0(c)) {
+        return 0;
+    }
+    // The "\n" may follow controls C0 drops.
+    if (((filters & GBK2UTF8_FILTER_CRLF) != 0) && (c == '\r')) {
+        while (((filters & GBK2UTF8_FILTER_C0) != 0) && (j < len) && is_filter_c0(data[j])) {
+            j++;
+        }
+        if ((j < len) && (data[j] == '\n')) {
+            return 0;
+        }
+    }
+    if ((filters & GBK2UTF8_FILTER_JSON) != 0) {
+        switch (c) {
+            case '"':
+            case '\\':
+                esc = c;
+                break;
+            case '\b':
+                esc = 'b';
+                break;
+            case '\f':
+                esc = 'f';
                 break;
+            case '\n':
+                esc = 'n';
+                break;
+            case '\r':
+                esc = 'r';
+                break;
+            case '\t':
+                esc = 't';
+                break;
+            default:
+                break;
+        }
+        if (esc != 0) {
+            if (room < 2) {
+                return -1;
             }
-            i += 1;
-            cur += 1;
-            if ((*cur < 0x40) || (*cur == 0xFF) || (*cur == 0x7F)) {
-                flg = false;
-                LOGD("%u Is invalid gbk!", cur - data);
+            out[0] = '\\';
+            out[1] = esc;
+            return 2;
+        }
+        if (c < 0x20) {
+            if (room < 6) {
+                return -1;
+            }
+            memcpy(out, "\\u00", 4);
+            out[4] = hex[c >> 4];
+            out[5] = hex[c & 0x0F];
+            return 6;
+        }
+    }
+    if (room < 1) {
+        return -1;
+    }
+    out[0] = c;
+    return 1;
+}
+
+const uint8_t gbk_byte_class[256] = {
+    [0x00 ... 0x3F] = GBK_CLASS_ASCII,
+    [0x40 ... 0x7E] = GBK_CLASS_ASCII | GBK_CLASS_TRAIL,
+    [0x7F] = GBK_CLASS_ASCII,
+    [0x80] = GBK_CLASS_TRAIL,
+    [0x81 ... 0xFE] = GBK_CLASS_LEAD | GBK_CLASS_TRAIL,
+    [0xFF] = 0,
+};
+
+/*
+ * Validator state machine: "trail" is set after a lead byte. From the class bits
+ * the next state and the error flag are a few ALU ops, no data-dependent branch
+ * and no load on the state chain. Errors are checked once per block; the exact
+ * position is then found by stepping the block again.
+ */
+#define GBK_STATE_BLOCK 64
+
+// Exact error position inside one block, entered with trail set if a lead byte ended the previous block.
+static size_t gbk_valid_block(const uint8_t *data, size_t i, size_t end, uint32_t trail) {
+    size_t last = i - trail;
+    uint8_t c = 0;
+
+    for (; i < end; i++) {
+        c = gbk_byte_class[data[i]];
+        if (trail) {
+            if ((c & GBK_CLASS_TRAIL) == 0) {
                 break;
             }
+            trail = 0;
+            last = i + 1;
+        } else if (c & GBK_CLASS_ASCII) {
+            last = i + 1;
+        } else if (c & GBK_CLASS_LEAD) {
+            trail = 1;
         } else {
-            flg = false;
-            LOGD("%u Is invalid gbk!", cur - data);
             break;
         }
     }
+    return last;
+}
+
+// Scalar validator from offset i, trail set if data[i - 1] was a lead byte.
+static size_t gbk_valid_from(const uint8_t *data, size_t i, size_t len, uint32_t trail) {
+    size_t beg = 0, end = 0;
+    uint32_t start = 0, c = 0;
+    int32_t err = 0;
 
-    LOGD("Is %s gbk!", (flg ? "valid" : "invalid"));
-    return flg;
+    while (i < len) {
+        if (trail == 0) {
+            i += ascii_prefix_len(data + i, len - i);
+        }
+        beg = i;
+        start = trail;
+        end = (((len - i) > GBK_STATE_BLOCK) ? (i + GBK_STATE_BLOCK) : len);
+        for (; i < end; i++) {
+            c = gbk_byte_class[data[i]];
+            // A byte must be ascii or lead (mask 3), or trail after a lead (mask 4); err goes negative otherwise.
+            err |= (int32_t)(c & (3 + trail)) - 1;
+            trail = (trail ^ 1) & (c >> 1);
+        }
+        if (err < 0) {
+            return gbk_valid_block(data, beg, end, start);
+        }
+    }
+    return (trail ? (len - 1) : len);
 }
 
-bool is_valid_utf8(const uint8_t *data, size_t len) {
-    uint32_t i = 0;
-    uint32_t t = 0, v = 0;
-    bool flg = false;
-    const uint8_t *cur = NULL;
+#ifdef GBK2UNI_AVX2
+/*
+ * 32 bytes per step. With H the high-bit mask, a byte is a lead iff it is high and the byte
+ * before it is not a lead, so leads sit at even offsets of every run of high bits. Runs
+ * starting at an even position are found by adding their start bits to H: the carry
+ * ripples through exactly those runs. The lead bit of the last byte carries into the
+ * next block; a run continuing a lead from the previous block has no start bit and so
+ * takes the odd positions, as it should.
+ */
+__attribute__((target("avx2"))) static size_t gbk_valid_len_avx2(const uint8_t *data, size_t len) {
+    const uint64_t even = 0x55555555ULL;
+    const __m256i ff = _mm256_set1_epi8((char)0xFF);
+    const __m256i x80 = _mm256_set1_epi8((char)0x80);
+    const __m256i x7f = _mm256_set1_epi8(0x7F);
+    const __m256i x3f = _mm256_set1_epi8(0x3F);
+    size_t i = 0;
+    uint64_t high = 0, starts = 0, runs = 0, lead = 0, trail = 0, bad_lead = 0, bad_trail = 0;
+    uint64_t carry = 0;
+    __m256i v;
 
-    if ((NULL == data) || (len <= 0)) {
-        return 0;
+    for (; i + 32 <= len; i += 32) {
+        v = _mm256_loadu_si256((const __m256i *)(data + i));
+        high = (uint32_t)_mm256_movemask_epi8(v);
+        if ((high | carry) == 0) {
+            continue;
+        }
+
+        starts = high & ~((high << 1) | carry);
+        runs = ((high + (starts & even)) ^ high) & high;
+        lead = ((runs & even) | (high & ~runs & ~even)) & 0xFFFFFFFFULL;
+        trail = ((lead << 1) | carry) & 0xFFFFFFFFULL;
+
+        // Leads must be 0x81..0xFE, trails 0x40..0xFE without 0x7F.
+        bad_lead = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, ff), _mm256_cmpeq_epi8(v, x80)));
+        bad_trail = (uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, ff), _mm256_cmpeq_epi8(v, x7f)),
+                            _mm256_cmpeq_epi8(_mm256_min_epu8(v, x3f), v)));
+        if (((lead & bad_lead) | (trail & bad_trail)) != 0) {
+            return gbk_valid_block(data, i, i + 32, carry);
+        }
+        carry = lead >> 31;
     }
+    return gbk_valid_from(data, i, len, carry);
+}
+#endif
 
-    LOGD("data=[%p]. len=[%u]", data, len);
+// Length of the longest valid gbk prefix, silent so it can run once per line.
+size_t gbk_valid_len(const uint8_t *data, size_t len) {
+#ifdef GBK2UNI_AVX2
+    if ((len >= 64) && __builtin_cpu_supports("avx2")) {
+        return gbk_valid_len_avx2(data, len);
+    }
+#endif
+    return gbk_valid_from(data, 0, len, 0);
+}
 
-    flg = true;
+static inline bool is_rejected_utf8_2byte(uint32_t v) {
+    if (v <= 0xA0) {
+        return true;
+    }
+    return ((v == 0x70E) || (v == 0x70F) || (v == 0x7FF) || (v == 0x7FE) || (v == 0x7FD) || (v == 0x7FC) ||
+            (v == 0x7FB) || (v == 0x7BF) || (v == 0x7BE) || (v == 0x7BD) || (v == 0x7BC) || (v == 0x7BB) ||
+            (v == 0x7BA) || (v == 0x7B9) || (v == 0x7B8) || (v == 0x7B7) || (v == 0x7B6) || (v == 0x7B5) ||
+            (v == 0x7B4) || (v == 0x7B3) || (v == 0x7B2) || (v == 0x74B) || (v == 0x74C) || (v == 0x61D) ||
+            (v == 0x5F5) || (v == 0x5F6) || (v == 0x5F7) || (v == 0x5F8) || (v == 0x5F9) || (v == 0x5FA) ||
+            (v == 0x5FB) || (v == 0x5FC) || (v == 0x5FD) || (v == 0x5FE) || (v == 0x5FF) || (v == 0x5EB) ||
+            (v == 0x5EC) || (v == 0x5ED) || (v == 0x5EE) || (v == 0x5EF) || (v == 0x5C8) || (v == 0x5C9) ||
+            (v == 0x5CA) || (v == 0x5CB) || (v == 0x5CC) || (v == 0x5CD) || (v == 0x5CE) || (v == 0x5CF) ||
+            (v == 0x588) || (v == 0x58B) || (v == 0x58C) || (v == 0x58D) || (v == 0x58E) || (v == 0x590) ||
+            (v == 0x557) || (v == 0x558) || (v == 0x560) || (v == 0x530) || (v == 0x3A2) || (v == 0x38D) ||
+            (v == 0x38B) || (v == 0x383) || (v == 0x382) || (v == 0x381) || (v == 0x380) || (v == 0x379) ||
+            (v == 0x378));
+}
+
+// Length of the longest valid utf8 prefix, silent so it can run once per line.
+size_t utf8_valid_len(const uint8_t *data, size_t len) {
+    size_t i = 0;
+    const uint8_t *cur = NULL;
 
-    for (i = 0, cur = data; i < len; i++, cur++) {
+    while (i < len) {
+        cur = data + i;
         if ((*cur & 0x80) == 0) {
             /* 0xxxxxxx */
-            continue;
+            i += ascii_prefix_len(cur, len - i);
         } else if ((*cur & 0xE0) == 0xC0) {
-
-#if 0
             /* 110xxxxx 10xxxxxx */
-            if ((*cur & 0x1F) < 2)
-            {
-                flg = false;
-                break;
-            }
-#endif
-            if (i + 1 >= len) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
-                break;
-            }
-            if ((*(cur + 1) & 0xC0) != 0x80) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
+            if ((i + 1 >= len) || ((cur[1] & 0xC0) != 0x80)) {
                 break;
             }
-            t = *cur & 0x1F;
-            v = *(cur + 1) & 0x3F;
-            v |= (t << 6);
-            if (v <= 0xA0) {
-                flg = false;
+            if (is_rejected_utf8_2byte(((uint32_t)(*cur & 0x1F) << 6) | (cur[1] & 0x3F))) {
                 break;
             }
-            if ((v == 0x70E) || (v == 0x70F) || (v == 0x7FF) || (v == 0x7FE) || (v == 0x7FD) || (v == 0x7FC) ||
-                (v == 0x7FB) || (v == 0x7BF) || (v == 0x7BE) || (v == 0x7BD) || (v == 0x7BC) || (v == 0x7BB) ||
-                (v == 0x7BA) || (v == 0x7B9) || (v == 0x7B8) || (v == 0x7B7) || (v == 0x7B6) || (v == 0x7B5) ||
-                (v == 0x7B4) || (v == 0x7B3) || (v == 0x7B2) || (v == 0x74B) || (v == 0x74C) || (v == 0x61D) ||
-                (v == 0x5F5) || (v == 0x5F6) || (v == 0x5F7) || (v == 0x5F8) || (v == 0x5F9) || (v == 0x5FA) ||
-                (v == 0x5FB) || (v == 0x5FC) || (v == 0x5FD) || (v == 0x5FE) || (v == 0x5FF) || (v == 0x5EB) ||
-                (v == 0x5EC) || (v == 0x5ED) || (v == 0x5EE) || (v == 0x5EF) || (v == 0x5C8) || (v == 0x5C9) ||
-                (v == 0x5CA) || (v == 0x5CB) || (v == 0x5CC) || (v == 0x5CD) || (v == 0x5CE) || (v == 0x5CF) ||
-                (v == 0x588) || (v == 0x58B) || (v == 0x58C) || (v == 0x58D) || (v == 0x58E) || (v == 0x590) ||
-                (v == 0x557) || (v == 0x558) || (v == 0x560) || (v == 0x530) || (v == 0x3A2) || (v == 0x38D) ||
-                (v == 0x38B) || (v == 0x383) || (v == 0x382) || (v == 0x381) || (v == 0x380) || (v == 0x379) ||
-                (v == 0x378)) {
-                LOGD("%u Is invalid utf8!", cur - data);
-                flg = false;
-                break;
-            }
-
-            i += 1;
-            cur += 1;
+            i += 2;
         } else if ((*cur & 0xF0) == 0xE0) {
             /* 1110xxxx 10xxxxxx 10xxxxxx */
-            if (i + 2 >= len) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
+            if ((i + 2 >= len) || ((cur[1] & 0xC0) != 0x80) || ((cur[2] & 0xC0) != 0x80)) {
                 break;
             }
-            if (((*(cur + 1) & 0xC0) != 0x80) || ((*(cur + 2) & 0xC0) != 0x80)) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
-                break;
-            }
-            i += 2;
-            cur += 2;
+            i += 3;
         } else if ((*cur & 0xF8) == 0xF0) {
             /* 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx */
-            if (i + 3 >= len) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
+            if ((i + 3 >= len) || ((cur[1] & 0xC0) != 0x80) || ((cur[2] & 0xC0) != 0x80) ||
+                ((cur[3] & 0xC0) != 0x80)) {
                 break;
             }
-            if (((*(cur + 1) & 0xC0) != 0x80) || ((*(cur + 2) & 0xC0) != 0x80) || ((*(cur + 3) & 0xC0) != 0x80)) {
-                flg = false;
-                LOGD("%u Is invalid utf8!", cur - data);
-                break;
-            }
-            i += 3;
-            cur += 3;
+            i += 4;
         } else {
-            flg = false;
-            LOGD("%u Is invalid utf8!", cur - data);
             break;
         }
     }
+    return i;
+}
+
+bool is_valid_gbk(const uint8_t *data, size_t len) {
+    size_t pos = 0;
+
+    if ((NULL == data) || (len <= 0)) {
+        return 0;
+    }
+
+    LOGD("data=[%p]. len=[%u]", data, len);
+
+    pos = gbk_valid_len(data, len);
+    if (pos < len) {
+        LOGD("%zu Is invalid gbk!", pos);
+    }
+
+    LOGD("Is %s gbk!", ((pos == len) ? "valid" : "invalid"));
+    return (pos == len);
+}
+
+bool is_valid_utf8(const uint8_t *data, size_t len) {
+    size_t pos = 0;
+
+    if ((NULL == data) || (len <= 0)) {
+        return 0;
+    }
+
+    LOGD("data=[%p]. len=[%u]", data, len);
 
-    LOGD("Is %s utf8!", (flg ? "valid" : "invalid"));
-    return flg;
+    pos = utf8_valid_len(data, len);
+    if (pos < len) {
+        LOGD("%zu Is invalid utf8!", pos);
+    }
+
+    LOGD("Is %s utf8!", ((pos == len) ? "valid" : "invalid"));
+    return (pos == len);
 }
 
 int32_t uni2utf8(uint16_t ns, uint8_t buf[4]) {
@@ -4791,14 +451,80 @@ int32_t uni2utf8(uint16_t ns, uint8_t buf[4]) {
 #define GBKC_L 1
 #endif
 
-#ifdef GBK2UNI_ICONV
-uint16_t gbk2uni(const char *gbk) {
-    uint16_t idx = 0, uni = 0;
-    uint16_t gbkc = 0;
+// Row-compact table mapped at runtime (see gbktab.h), NULL selects the builtin table.
+static const uint16_t *gbk2uni_rows = NULL;
+// gbktab_checksum() of gbk2uni_rows, and of the builtin mapping in the same layout once computed.
+static uint32_t gbk2uni_rows_checksum = 0;
+static uint32_t gbk2uni_builtin_checksum = 0;
 
-    if ((gbk == NULL) || (gbk[0] == 0) || (gbk[1] == 0)) {
+void gbk2uni_set_table_ex(const uint16_t *rows, uint32_t checksum) {
+    __atomic_store_n(&gbk2uni_rows_checksum, checksum, __ATOMIC_RELEASE);
+    __atomic_store_n(&gbk2uni_rows, rows, __ATOMIC_RELEASE);
+}
+
+void gbk2uni_set_table(const uint16_t *rows) {
+    gbk2uni_set_table_ex(rows, ((rows != NULL) ? gbktab_checksum(rows, GBKTAB_SIZE) : 0));
+}
+
+const uint16_t *gbk2uni_get_table(void) {
+    return __atomic_load_n(&gbk2uni_rows, __ATOMIC_ACQUIRE);
+}
+
+static inline uint16_t gbk2uni_loaded(const uint16_t *rows, const char *gbk) {
+    uint8_t lead = gbk[0];
+    uint8_t trail = gbk[1];
+
+    if ((lead < GBKTAB_LEAD_MIN) || (lead > GBKTAB_LEAD_MAX) || (trail < GBKTAB_TRAIL_MIN)) {
         return 0;
     }
+    return rows[(lead - GBKTAB_LEAD_MIN) * GBKTAB_COLS + (trail - GBKTAB_TRAIL_MIN)];
+}
+
+bool gbk2uni_selftest(void) {
+#if defined(GBK2UNI_COMPACT)
+    return gbk2uni_runs_selftest();
+#elif defined(GBK2UNI_ICONV)
+    return gbk2uni_flat_selftest() && gbk2utf8_tab_selftest();
+#else
+    return gbk2uni_row_selftest();
+#endif
+}
+
+#if defined(GBK2UNI_COMPACT)
+// Rows are expanded from the compressed runs on first use, rows never touched cost no RSS.
+static uint16_t gbk2uni_cache[GBK2UNI_RUNS_ROWS][GBK2UNI_RUNS_COLS];
+static uint8_t gbk2uni_ready[GBK2UNI_RUNS_ROWS];
+static pthread_mutex_t gbk2uni_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const uint16_t *gbk2uni_cached_row(uint32_t row) {
+    if (!__atomic_load_n(&gbk2uni_ready[row], __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&gbk2uni_lock);
+        if (!gbk2uni_ready[row]) {
+            gbk2uni_runs_expand(row, gbk2uni_cache[row]);
+            __atomic_store_n(&gbk2uni_ready[row], 1, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&gbk2uni_lock);
+    }
+    return gbk2uni_cache[row];
+}
+
+static inline __attribute__((always_inline)) uint16_t gbk2uni_builtin(const char *gbk) {
+    uint8_t lead = 0, trail = 0;
+
+    lead = gbk[0];
+    trail = gbk[1];
+    if ((lead < GBK2UNI_RUNS_LEAD_MIN) || (lead >= GBK2UNI_RUNS_LEAD_MIN + GBK2UNI_RUNS_ROWS) ||
+        (trail < GBK2UNI_RUNS_TRAIL_MIN)) {
+        LOGD("Invalid gbk code! [0x%02X%02X]!", lead, trail);
+        return 0;
+    }
+
+    return gbk2uni_cached_row(lead - GBK2UNI_RUNS_LEAD_MIN)[trail - GBK2UNI_RUNS_TRAIL_MIN];
+}
+#elif defined(GBK2UNI_ICONV)
+static inline __attribute__((always_inline)) uint16_t gbk2uni_builtin(const char *gbk) {
+    uint16_t idx = 0, uni = 0;
+    uint16_t gbkc = 0;
 
     gbkc = *((uint16_t *)gbk);
     gbkc = GBKC_B16(gbkc);
@@ -4822,14 +548,10 @@ uint16_t gbk2uni(const char *gbk) {
     return uni;
 }
 #else
-uint16_t gbk2uni(const char *gbk) {
+static inline __attribute__((always_inline)) uint16_t gbk2uni_builtin(const char *gbk) {
     uint16_t idx = 0, uni = 0;
     uint8_t gbkl = 0, gbkh = 0;
 
-    if ((gbk == NULL) || (gbk[0] == 0) || (gbk[1] == 0)) {
-        return 0;
-    }
-
     gbkl = gbk[GBKC_L];
     gbkh = gbk[GBKC_H];
 
@@ -4860,74 +582,511 @@ uint16_t gbk2uni(const char *gbk) {
 }
 #endif
 
-char *gbk2utf8(const uint8_t *data, size_t len) {
-    uint32_t i = 0, j = 0;
-    bool flg = false;
-    int32_t count = 0;
-    char *p_ret = NULL;
-    uint8_t *p_cur = NULL;
-    uint8_t *p_src = NULL;
-    uint32_t p_len = 0;
-    const uint8_t *cur = NULL;
-    uint8_t buf[4] = {0};
+uint16_t gbk2uni(const char *gbk) {
+    const uint16_t *rows = NULL;
 
-    if ((NULL == data) || (len <= 0)) {
-        return NULL;
+    if ((gbk == NULL) || (gbk[0] == 0) || (gbk[1] == 0)) {
+        return 0;
     }
 
-    if (!is_valid_gbk(data, len)) {
-        return NULL;
+    rows = gbk2uni_get_table();
+    if (rows != NULL) {
+        return gbk2uni_loaded(rows, gbk);
     }
+    return gbk2uni_builtin(gbk);
+}
 
-    p_len = ((len * 2) + 1);
-    p_src = (uint8_t *)malloc(p_len);
-    if (NULL == p_src) {
-        goto __oops;
+/*
+ * Checksum of the mapping in use, for caches of converted output. A loaded table has the one
+ * of its header; the builtin mapping is decoded once into the gbktab layout and hashed the
+ * same way, so every build and a table file with the same mapping share the version.
+ */
+uint32_t gbk2uni_table_version(void) {
+    uint32_t hash = 0, lead = 0, trail = 0;
+    uint16_t row[GBKTAB_COLS];
+    char pair[2] = {0};
+
+    if (gbk2uni_get_table() != NULL) {
+        return __atomic_load_n(&gbk2uni_rows_checksum, __ATOMIC_ACQUIRE);
     }
-    memset(p_src, 0, p_len);
+    hash = __atomic_load_n(&gbk2uni_builtin_checksum, __ATOMIC_ACQUIRE);
+    if (hash != 0) {
+        return hash;
+    }
+    // Threads racing here compute the same value.
+    hash = GBKTAB_CHECKSUM_SEED;
+    for (lead = GBKTAB_LEAD_MIN; lead <= GBKTAB_LEAD_MAX; lead++) {
+#if defined(GBK2UNI_COMPACT)
+        // Expanded on the stack, the row cache keeps only the rows conversions touch.
+        gbk2uni_runs_expand(lead - GBK2UNI_RUNS_LEAD_MIN, row);
+#else
+        for (trail = GBKTAB_TRAIL_MIN; trail <= GBKTAB_TRAIL_MAX; trail++) {
+            pair[0] = lead;
+            pair[1] = trail;
+            row[trail - GBKTAB_TRAIL_MIN] = (is_gbk_trail(trail) ? gbk2uni_builtin(pair) : 0);
+        }
+#endif
+        hash = gbktab_checksum_update(hash, row, GBKTAB_COLS);
+    }
+    __atomic_store_n(&gbk2uni_builtin_checksum, hash, __ATOMIC_RELEASE);
+    return hash;
+}
 
-    flg = true;
+#if defined(GBK2UNI_AVX2) && defined(GBK2UNI_ICONV) && !defined(GBK2UNI_COMPACT)
+#define GBK2UNI_GATHER 1
+/*
+ * Decode blocks of 8 double-byte characters from the builtin flat table. A little-endian
+ * load of a code is already its flat key (trail << 8 | lead), widened to 32 bits it indexes
+ * GBK2UNI_TABLE through vpgatherdd. Only blocks of 16 high bytes whose code points are all
+ * >= 0x1000 qualify, uni2utf8() writes those as three bytes with no reject list entry, so
+ * the utf8 bytes are built in registers and compacted by one shuffle. Anything else stops
+ * the kernel and is left to the scalar loop. Returns the new input offset.
+ */
+__attribute__((target("avx2"))) static size_t gbk2utf8_gather_avx2(const uint8_t *data, size_t i, size_t len,
+                                                                   uint8_t *out, size_t *po, size_t outlen) {
+    const __m128i ff = _mm_set1_epi8((char)0xFF);
+    const __m128i x80 = _mm_set1_epi8((char)0x80);
+    const __m256i start = _mm256_set1_epi32(GBK2UNI_TABLE_START);
+    const __m256i low16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i wide = _mm256_set1_epi32(0x0FFF);
+    const __m256i low6 = _mm256_set1_epi32(0x3F);
+    const __m256i mark = _mm256_set1_epi32(0x008080E0);
+    const __m256i pack = _mm256_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5, 6,
+                                          8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    size_t o = *po;
+    __m128i v;
+    __m256i uni, utf;
 
-    for (i = 0, cur = data, p_cur = p_src; (i < len) && (p_cur < (p_src + p_len)) && flg; i++, cur++) {
-        if ((*cur & 0x80) == 0) {
-            /* 0xxxxxxx */
-            *p_cur++ = *cur;
-            continue;
-        } else if ((*cur > 0x80) && (*cur < 0xFF)) {
-            if ((i + 1) >= len) {
-                flg = false;
-                break;
+    // Each block writes 24 bytes with two 16 byte stores, the second ending 4 bytes later.
+    for (; (i + 16 <= len) && (o + 28 <= outlen); i += 16, o += 24) {
+        v = _mm_loadu_si128((const __m128i *)(data + i));
+        if ((_mm_movemask_epi8(v) != 0xFFFF) || (_mm_movemask_epi8(_mm_cmpeq_epi8(v, ff)) != 0) ||
+            ((_mm_movemask_epi8(_mm_cmpeq_epi8(v, x80)) & 0x5555) != 0)) {
+            break;
+        }
+        uni = _mm256_sub_epi32(_mm256_cvtepu16_epi32(v), start);
+        uni = _mm256_and_si256(_mm256_i32gather_epi32((const int *)GBK2UNI_TABLE, uni, 2), low16);
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(uni, wide)) != -1) {
+            break;
+        }
+        // 1110xxxx 10xxxxxx 10xxxxxx, byte 0 in the low bits of each lane.
+        utf = _mm256_or_si256(_mm256_srli_epi32(uni, 12),
+                              _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(uni, 6), low6), 8));
+        utf = _mm256_or_si256(utf, _mm256_slli_epi32(_mm256_and_si256(uni, low6), 16));
+        utf = _mm256_shuffle_epi8(_mm256_or_si256(utf, mark), pack);
+        _mm_storeu_si128((__m128i *)(out + o), _mm256_castsi256_si128(utf));
+        _mm_storeu_si128((__m128i *)(out + o + 12), _mm256_extracti128_si256(utf, 1));
+    }
+    *po = o;
+    return i;
+}
+#endif
+
+#if defined(GBK2UNI_ICONV) && !defined(GBK2UNI_COMPACT) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define GBK2UNI_UTF8TAB 1
+#define GBK2UTF8_RUN_GROUP 4
+/*
+ * Decodes runs of double-byte codes GBK2UTF8_RUN_GROUP at a time from GBK2UTF8_TABLE, which
+ * holds the uni2utf8() bytes of each code with their length in the top byte. Bounds are
+ * checked once per group and every code is stored as a whole word, the next store overwrites
+ * the spare bytes. A group with an ascii byte or a code the table has no bytes for stops the
+ * run and is left to the scalar loop. Returns the new input offset.
+ */
+static inline __attribute__((always_inline)) size_t gbk2utf8_run(const uint8_t *data, size_t i, size_t len,
+                                                                 uint8_t *out, size_t *po, size_t outlen) {
+    size_t o = *po;
+    uint32_t k = 0, bad = 0, lead = 0, trail = 0;
+    uint32_t v[GBK2UTF8_RUN_GROUP];
+
+    for (; (i + GBK2UTF8_RUN_GROUP * 2 <= len) && (o + GBK2UTF8_RUN_GROUP * 4 <= outlen);
+         i += GBK2UTF8_RUN_GROUP * 2) {
+        bad = 0;
+        for (k = 0; k < GBK2UTF8_RUN_GROUP; k++) {
+            lead = data[i + k * 2] - 0x81u;
+            trail = data[i + k * 2 + 1] - 0x40u;
+            bad |= (lead >= 0x7E) | (trail >= GBK2UTF8_TABLE_COLS);
+            v[k] = lead * GBK2UTF8_TABLE_COLS + trail;
+        }
+        if (bad != 0) {
+            break;
+        }
+        for (k = 0; k < GBK2UTF8_RUN_GROUP; k++) {
+            v[k] = GBK2UTF8_TABLE[v[k]];
+            bad |= (v[k] == 0);
+        }
+        if (bad != 0) {
+            break;
+        }
+        for (k = 0; k < GBK2UTF8_RUN_GROUP; k++) {
+            memcpy(out + o, &v[k], sizeof(v[k]));
+            o += GBK2UTF8_TABLE_LEN(v[k]);
+        }
+    }
+    *po = o;
+    return i;
+}
+#endif
+
+/*
+ * Blocks are classified by the share of bytes with the high bit set, in percent:
+ *   <= ascii_max  ascii runs are skipped by ascii_prefix_len() and copied with memcpy
+ *   >= dense_min  double-byte kernel, the AVX2 gather when the builtin table is in use
+ *   otherwise     mixed scalar loop, one character at a time without scanning ahead
+ * bench --calibrate measures the crossover points on a given corpus.
+ */
+#define GBK2UTF8_BLOCK 64
+
+enum {
+    GBK2UTF8_KERNEL_ASCII = 0,
+    GBK2UTF8_KERNEL_MIXED,
+    GBK2UTF8_KERNEL_DENSE,
+};
+
+static const gbk2utf8_tune_t gbk2utf8_tune_default = {GBK2UTF8_TUNE_ASCII_MAX, GBK2UTF8_TUNE_DENSE_MIN};
+static gbk2utf8_tune_t gbk2utf8_tune = {GBK2UTF8_TUNE_ASCII_MAX, GBK2UTF8_TUNE_DENSE_MIN};
+
+void gbk2utf8_set_tune(const gbk2utf8_tune_t *tune) {
+    gbk2utf8_tune = ((tune != NULL) ? *tune : gbk2utf8_tune_default);
+}
+
+void gbk2utf8_get_tune(gbk2utf8_tune_t *tune) {
+    if (tune != NULL) {
+        *tune = gbk2utf8_tune;
+    }
+}
+
+// Number of bytes with the high bit set, a popcount per 64-bit word.
+static inline uint32_t high_bytes(const uint8_t *data, size_t len) {
+    size_t i = 0;
+    uint32_t cnt = 0;
+    uint64_t w = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        memcpy(&w, data + i, sizeof(w));
+        cnt += __builtin_popcountll(w & SWAR_HIGHS);
+    }
+    for (; i < len; i++) {
+        cnt += (data[i] >> 7);
+    }
+    return cnt;
+}
+
+static inline __attribute__((always_inline)) int32_t gbk2utf8_kernel(const uint8_t *data, size_t len,
+                                                                     const gbk2utf8_tune_t *tune) {
+    int32_t density = (int32_t)(high_bytes(data, len) * 100 / len);
+
+    if (density <= tune->ascii_max) {
+        return GBK2UTF8_KERNEL_ASCII;
+    }
+    return ((density >= tune->dense_min) ? GBK2UTF8_KERNEL_DENSE : GBK2UTF8_KERNEL_MIXED);
+}
+
+/*
+ * Picks a kernel per block, see GBK2UTF8_BLOCK. A kernel may run past the end of its block
+ * to finish an ascii run or a double-byte code. Statistics are kept in locals and added to
+ * *stats once per call. With filters, ascii runs stop at the bytes a filter takes and those
+ * go through filter_ascii() one at a time; the double-byte kernels are the same.
+ */
+static inline __attribute__((always_inline)) ssize_t gbk2utf8_convert(const uint8_t *data, size_t len, uint8_t *out,
+                                                                       size_t outlen, uint32_t filters,
+                                                                       gbk2utf8_stats_t *stats) {
+    size_t i = 0, o = 0, beg = 0, end = 0;
+    size_t ascii = 0, dbcs = 0, unmapped = 0, rejected = 0;
+    ssize_t ret = -1;
+    int32_t kernel = 0, n = 0;
+    uint16_t uni = 0;
+    uint8_t buf[4] = {0};
+    gbk2utf8_tune_t tune = gbk2utf8_tune;
+#ifdef GBK2UNI_GATHER
+    size_t retry = 0;
+    bool gather = false;
+#endif
+#ifdef GBK2UNI_UTF8TAB
+    bool builtin = (gbk2uni_get_table() == NULL);
+    size_t stop = 0;
+#endif
+
+    if ((NULL == data) || (NULL == out)) {
+        return -1;
+    }
+
+#ifdef GBK2UNI_GATHER
+    gather = ((gbk2uni_get_table() == NULL) && __builtin_cpu_supports("avx2"));
+#endif
+
+    while (i < len) {
+        end = (((len - i) > GBK2UTF8_BLOCK) ? (i + GBK2UTF8_BLOCK) : len);
+        kernel = gbk2utf8_kernel(data + i, end - i, &tune);
+
+        while (i < end) {
+            if ((data[i] & 0x80) == 0) {
+                /* 0xxxxxxx */
+                if (kernel == GBK2UTF8_KERNEL_ASCII) {
+                    beg = i;
+                    i += ((filters == 0) ? ascii_prefix_len(data + i, len - i)
+                                         : filter_prefix_len(data + i, len - i, false));
+                    if (o + (i - beg) > outlen) {
+                        i = beg;
+                        goto __done;
+                    }
+                    memcpy(out + o, data + beg, i - beg);
+                    o += i - beg;
+                    ascii += i - beg;
+                    if (i != beg) {
+                        continue;
+                    }
+                }
+                if ((filters != 0) && !is_filter_clean(data[i])) {
+                    n = filter_ascii(data, i, len, filters, out + o, outlen - o);
+                    if (n < 0) {
+                        goto __done;
+                    }
+                    o += n;
+                    i++;
+                    ascii++;
+                    continue;
+                }
+                if (o >= outlen) {
+                    goto __done;
+                }
+                out[o++] = data[i++];
+                ascii++;
+                continue;
             }
-            if (0 != uni2utf8(gbk2uni(cur), buf)) {
-                flg = false;
-                break;
+#ifdef GBK2UNI_GATHER
+            // After the gather stops, the scalar code takes at least that block before it is tried again.
+            if ((kernel == GBK2UTF8_KERNEL_DENSE) && gather && (i >= retry)) {
+                beg = i;
+                i = gbk2utf8_gather_avx2(data, i, len, out, &o, outlen);
+                dbcs += (i - beg) / 2;
+                retry = i + 16;
+                continue;
             }
-            for (j = 0; j < sizeof(buf); j++) {
-                if (0 == buf[j]) {
-                    break;
+#endif
+#ifdef GBK2UNI_UTF8TAB
+            // With the gather enabled, the run hands back to it where it is tried next.
+            stop = len;
+#ifdef GBK2UNI_GATHER
+            stop = ((gather && (retry < len)) ? retry : len);
+#endif
+            if ((kernel == GBK2UTF8_KERNEL_DENSE) && builtin) {
+                beg = i;
+                i = gbk2utf8_run(data, i, stop, out, &o, outlen);
+                dbcs += (i - beg) / 2;
+                if (i != beg) {
+                    continue;
                 }
-                *p_cur++ = buf[j];
             }
-            i += 1;
-            cur += 1;
-        } else {
-            flg = false;
-            break;
+#endif
+            if (((i + 1) >= len) || !is_gbk_lead(data[i]) || !is_gbk_trail(data[i + 1]) || ((o + 3) > outlen)) {
+                goto __done;
+            }
+            uni = gbk2uni((const char *)(data + i));
+            if (0 != uni2utf8(uni, buf)) {
+                unmapped += (uni == 0);
+                rejected += (uni != 0);
+                goto __done;
+            }
+            // buf is NUL padded, so the two or three byte form is copied without a branch per byte.
+            out[o] = buf[0];
+            out[o + 1] = buf[1];
+            out[o + 2] = buf[2];
+            o += ((buf[2] != 0) ? 3 : 2);
+            i += 2;
+            dbcs++;
+        }
+    }
+    ret = o;
+
+__done:
+    if (stats != NULL) {
+        stats->in_bytes += i;
+        stats->out_bytes += o;
+        stats->ascii_bytes += ascii;
+        stats->dbcs_chars += dbcs;
+        stats->unmapped += unmapped;
+        stats->rejected += rejected;
+    }
+    return ret;
+}
+
+ssize_t gbk2utf8_buf_stats(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, gbk2utf8_stats_t *stats) {
+    return gbk2utf8_convert(data, len, out, outlen, 0, stats);
+}
+
+ssize_t gbk2utf8_buf(const uint8_t *data, size_t len, uint8_t *out, size_t outlen) {
+    return gbk2utf8_buf_stats(data, len, out, outlen, NULL);
+}
+
+ssize_t gbk2utf8_buf_filter(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, uint32_t filters,
+                            gbk2utf8_stats_t *stats) {
+    return gbk2utf8_convert(data, len, out, outlen, filters, stats);
+}
+
+ssize_t utf8_filter_buf(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, uint32_t filters) {
+    size_t i = 0, o = 0, beg = 0;
+    int32_t n = 0;
+
+    if ((NULL == data) || (NULL == out)) {
+        return -1;
+    }
+    while (i < len) {
+        beg = i;
+        i += filter_prefix_len(data + i, len - i, true);
+        if (o + (i - beg) > outlen) {
+            return -1;
+        }
+        memcpy(out + o, data + beg, i - beg);
+        o += i - beg;
+        if ((i != beg) || (i >= len)) {
+            continue;
+        }
+        n = filter_ascii(data, i, len, filters, out + o, outlen - o);
+        if (n < 0) {
+            return -1;
+        }
+        o += n;
+        i++;
+    }
+    return o;
+}
+
+/*
+ * Output size of gbk2utf8_buf() for data without converting it: ascii runs are skipped whole,
+ * double-byte codes take their length from GBK2UTF8_TABLE when the builtin table is in use.
+ * Codes it fails on, and bytes that start no code, count as none.
+ */
+size_t gbk2utf8_len(const uint8_t *data, size_t len) {
+    size_t i = 0, o = 0, n = 0;
+    uint8_t buf[4] = {0};
+#ifdef GBK2UNI_UTF8TAB
+    bool builtin = (gbk2uni_get_table() == NULL);
+#endif
+
+    if (NULL == data) {
+        return 0;
+    }
+    while (i < len) {
+        if ((data[i] & 0x80) == 0) {
+            n = ascii_prefix_len(data + i, len - i);
+            i += n;
+            o += n;
+            continue;
+        }
+        if (((i + 1) >= len) || !is_gbk_lead(data[i]) || !is_gbk_trail(data[i + 1])) {
+            i++;
+            continue;
+        }
+#ifdef GBK2UNI_UTF8TAB
+        if (builtin) {
+            o += GBK2UTF8_TABLE_LEN(GBK2UTF8_TABLE[GBK2UTF8_TABLE_INDEX(data[i], data[i + 1])]);
+            i += 2;
+            continue;
+        }
+#endif
+        if (0 == uni2utf8(gbk2uni((const char *)(data + i)), buf)) {
+            o += ((buf[2] != 0) ? 3 : 2);
         }
+        i += 2;
+    }
+    return o;
+}
+
+void gbk2utf8_stream_init(gbk2utf8_stream_t *stream) {
+    if (stream != NULL) {
+        memset(stream, 0, sizeof(*stream));
+    }
+}
+
+/*
+ * The pending lead is joined with the first byte of the chunk and converted on its own, the
+ * rest goes through gbk2utf8_buf_stats(). A failure exactly at a lead byte ending the chunk
+ * is no error, that byte becomes the pending lead.
+ */
+ssize_t gbk2utf8_stream_feed(gbk2utf8_stream_t *stream, const uint8_t *data, size_t len, uint8_t *out,
+                             size_t outlen) {
+    uint8_t pair[2] = {0};
+    size_t i = 0, o = 0;
+    uint64_t in_beg = 0, out_beg = 0;
+    ssize_t ret = 0;
+
+    if ((NULL == stream) || (NULL == out) || ((NULL == data) && (len > 0))) {
+        return -1;
+    }
+    if (len == 0) {
+        return 0;
     }
 
-    if (flg != false) {
-        *p_cur = 0;
-        p_ret = strdup((char *)p_src);
+    if (stream->has_lead) {
+        pair[0] = stream->lead;
+        pair[1] = data[0];
+        ret = gbk2utf8_buf_stats(pair, sizeof(pair), out, outlen, &stream->stats);
+        if (ret < 0) {
+            return -1;
+        }
+        stream->has_lead = false;
+        o = ret;
+        i = 1;
     }
 
-__oops:
-    if (p_src) {
-        free(p_src);
-        p_src = NULL;
+    in_beg = stream->stats.in_bytes;
+    out_beg = stream->stats.out_bytes;
+    ret = gbk2utf8_buf_stats(data + i, len - i, out + o, outlen - o, &stream->stats);
+    if (ret >= 0) {
+        return o + ret;
+    }
+    if ((i + (stream->stats.in_bytes - in_beg) + 1 == len) && is_gbk_lead(data[len - 1])) {
+        stream->lead = data[len - 1];
+        stream->has_lead = true;
+        return o + (stream->stats.out_bytes - out_beg);
     }
+    return -1;
+}
 
-    return p_ret;
+int32_t gbk2utf8_stream_finish(gbk2utf8_stream_t *stream) {
+    return (((stream != NULL) && !stream->has_lead) ? 0 : -1);
+}
+
+/*
+ * One block of the worst case size is taken from the allocator, converted into and shrunk to
+ * the string, no temporary buffer and no copy. NULL stands for malloc.
+ */
+char *gbk2utf8_with(const uint8_t *data, size_t len, const gbk_allocator_t *a, gbk2utf8_stats_t *stats) {
+    char *p_ret = NULL;
+    size_t p_len = 0;
+    ssize_t o_len = 0;
+
+    if ((NULL == data) || (len <= 0)) {
+        return NULL;
+    }
+
+    if (!is_valid_gbk(data, len)) {
+        return NULL;
+    }
+
+    p_len = GBK2UTF8_MAX_LEN(len) + 1;
+    p_ret = (char *)gbk_alloc(a, p_len);
+    if (NULL == p_ret) {
+        LOGE("Failed to malloc size [%zu]!", p_len);
+        return NULL;
+    }
+
+    o_len = gbk2utf8_buf_stats(data, len, (uint8_t *)p_ret, p_len - 1, stats);
+    if (o_len < 0) {
+        gbk_free(a, p_ret);
+        return NULL;
+    }
+    p_ret[o_len] = 0;
+
+    return (char *)gbk_shrink(a, p_ret, p_len, o_len + 1);
+}
+
+char *gbk2utf8_ex(const uint8_t *data, size_t len, gbk2utf8_stats_t *stats) {
+    return gbk2utf8_with(data, len, NULL, stats);
+}
+
+char *gbk2utf8(const uint8_t *data, size_t len) {
+    return gbk2utf8_ex(data, len, NULL);
 }
 
 #if 0
@@ -4938,6 +1097,7 @@ __oops:
 
 bool is_printns(const char *str, size_t len) {
     size_t idx = 0;
+    uint64_t w = 0;
     const char *ptr = NULL;
 
     if (!str) {
@@ -4945,6 +1105,13 @@ bool is_printns(const char *str, size_t len) {
     }
 
     ptr = str;
+    // Whole words without a high bit or a NUL byte are printable.
+    for (; idx + 8 <= len; idx += 8) {
+        memcpy(&w, ptr + idx, sizeof(w));
+        if (((w | ((w - SWAR_ONES) & ~w)) & SWAR_HIGHS) != 0) {
+            break;
+        }
+    }
     while ((ptr[idx] != 0) && (idx < len)) {
         if (!_isprint(ptr[idx])) {
             LOGD("[%u][0x%02X] isn't printable!", idx, (uint8_t)(ptr[idx]));
@@ -18,10 +18,114 @@
 #include <string.h>
 #include <unistd.h>
 
+#include "gbkalloc.h"
+
+// Worst case utf8 size of a gbk buffer: a double-byte code never grows beyond three bytes.
+#define GBK2UTF8_MAX_LEN(_len) (((_len) * 3 + 1) / 2)
+// Worst case with GBK2UTF8_FILTER_JSON, a control byte becomes \u00XX.
+#define GBK2UTF8_FILTER_MAX_LEN(_len) ((_len) * 6)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Byte classes shared by the validators and the converters: lead 0x81..0xFE,
+ * trail 0x40..0xFE without 0x7F, ascii 0x00..0x7F. 0xFF is in no class.
+ */
+#define GBK_CLASS_ASCII 0x01
+#define GBK_CLASS_LEAD 0x02
+#define GBK_CLASS_TRAIL 0x04
+
+extern const uint8_t gbk_byte_class[256];
+
+static inline bool is_gbk_lead(uint8_t c) {
+    return ((gbk_byte_class[c] & GBK_CLASS_LEAD) != 0);
+}
+
+static inline bool is_gbk_trail(uint8_t c) {
+    return ((gbk_byte_class[c] & GBK_CLASS_TRAIL) != 0);
+}
+
+/*
+ * Filled by the *_stats converters, counters are added to, so one struct can sum many calls.
+ * unmapped counts codes without a mapping, rejected codes dropped by the uni2utf8() reject list.
+ */
+typedef struct gbk2utf8_stats {
+    uint64_t in_bytes;
+    uint64_t out_bytes;
+    uint64_t ascii_bytes;
+    uint64_t dbcs_chars;
+    uint64_t unmapped;
+    uint64_t rejected;
+} gbk2utf8_stats_t;
+
+/*
+ * Kernel selection of gbk2utf8_buf(), by the percentage of high bytes in each 64 byte block:
+ * up to ascii_max skips ascii runs, from dense_min on uses the double-byte kernel, the mixed
+ * scalar loop takes the rest. -1 or 101 switch a kernel off. bench --calibrate suggests values.
+ */
+#define GBK2UTF8_TUNE_ASCII_MAX 25
+#define GBK2UTF8_TUNE_DENSE_MIN 95
+
+/*
+ * Output filters of gbk2utf8_buf_filter(), applied while converting so the output is written
+ * once in its final form. Double-byte codes never become ascii, only ascii bytes are filtered:
+ *   C0    drops 0x00..0x1F but "\t", "\n", "\r", and 0x7F
+ *   CRLF  drops a "\r" followed by "\n"
+ *   JSON  escapes '"', '\\' and the controls left for a JSON string, 0x7F and up are kept
+ * Combined they give what passes in that order would: C0 | JSON escapes a lone "\r" as \r.
+ */
+#define GBK2UTF8_FILTER_C0 0x01
+#define GBK2UTF8_FILTER_CRLF 0x02
+#define GBK2UTF8_FILTER_JSON 0x04
+
+typedef struct gbk2utf8_tune {
+    int32_t ascii_max;
+    int32_t dense_min;
+} gbk2utf8_tune_t;
+
+/*
+ * Conversion of input arriving in chunks. A lead byte ending a chunk is kept for the next one,
+ * so a feed of len bytes needs GBK2UTF8_MAX_LEN(len + 1) bytes of room. stats.in_bytes is the
+ * input converted so far, after a failed feed the offset of the bad code.
+ */
+typedef struct gbk2utf8_stream {
+    gbk2utf8_stats_t stats;
+    uint8_t lead;
+    bool has_lead;
+} gbk2utf8_stream_t;
+
+size_t gbk_valid_len(const uint8_t *data, size_t len);
+size_t utf8_valid_len(const uint8_t *data, size_t len);
 bool is_valid_gbk(const uint8_t *data, size_t len);
 bool is_valid_utf8(const uint8_t *data, size_t len);
 int32_t uni2utf8(uint16_t ns, uint8_t buf[4]);
+uint16_t gbk2uni(const char *gbk);
+void gbk2uni_set_table(const uint16_t *rows);
+// checksum is gbktab_checksum() of rows, as a table header stores it.
+void gbk2uni_set_table_ex(const uint16_t *rows, uint32_t checksum);
+const uint16_t *gbk2uni_get_table(void);
+bool gbk2uni_selftest(void);
+uint32_t gbk2uni_table_version(void);
+ssize_t gbk2utf8_buf(const uint8_t *data, size_t len, uint8_t *out, size_t outlen);
+ssize_t gbk2utf8_buf_stats(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, gbk2utf8_stats_t *stats);
+size_t gbk2utf8_len(const uint8_t *data, size_t len);
+// out needs GBK2UTF8_FILTER_MAX_LEN(len) bytes in the worst case with JSON, GBK2UTF8_MAX_LEN(len) without.
+ssize_t gbk2utf8_buf_filter(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, uint32_t filters,
+                            gbk2utf8_stats_t *stats);
+// The filters alone, for input that is utf8 already; bytes from 0x80 on are copied.
+ssize_t utf8_filter_buf(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, uint32_t filters);
+void gbk2utf8_set_tune(const gbk2utf8_tune_t *tune);
+void gbk2utf8_get_tune(gbk2utf8_tune_t *tune);
 char *gbk2utf8(const uint8_t *data, size_t len);
+char *gbk2utf8_ex(const uint8_t *data, size_t len, gbk2utf8_stats_t *stats);
+void gbk2utf8_stream_init(gbk2utf8_stream_t *stream);
+ssize_t gbk2utf8_stream_feed(gbk2utf8_stream_t *stream, const uint8_t *data, size_t len, uint8_t *out,
+                             size_t outlen);
+int32_t gbk2utf8_stream_finish(gbk2utf8_stream_t *stream);
+// The result is released with gbk_free(a, ptr), free() when a is NULL.
+char *gbk2utf8_with(const uint8_t *data, size_t len, const gbk_allocator_t *a, gbk2utf8_stats_t *stats);
 bool is_printns(const char *str, size_t len);
 bool is_prints(const char *str);
 bool is_valid_gbkns(const char *str, size_t len);
@@ -29,4 +133,52 @@ bool is_valid_gbks(const char *str);
 bool is_valid_utf8ns(const char *str, size_t len);
 bool is_valid_utf8s(const char *str);
 
+// *cp of gbk_next() for a byte that starts no gbk character, or a code without a mapping.
+#define GBK_BAD_CODE_POINT 0xFFFFFFFFu
+
+/*
+ * Decodes one character through gbk2uni(), for callers reading only part of a buffer. Returns
+ * the bytes it takes, 0 at the end: a bad lead or a lead without a trail takes one byte, an
+ * unmapped code two.
+ */
+static inline size_t gbk_next(const uint8_t *data, size_t len, uint32_t *cp) {
+    uint16_t uni = 0;
+
+    if (len == 0) {
+        return 0;
+    }
+    if ((data[0] & 0x80) == 0) {
+        *cp = data[0];
+        return 1;
+    }
+    if ((len < 2) || !is_gbk_lead(data[0]) || !is_gbk_trail(data[1])) {
+        *cp = GBK_BAD_CODE_POINT;
+        return 1;
+    }
+    uni = gbk2uni((const char *)data);
+    *cp = ((uni != 0) ? uni : GBK_BAD_CODE_POINT);
+    return 2;
+}
+
+/*
+ * First character start at or after pos, given that from <= pos is one: pos, or pos + 1 if a
+ * code spans it. The byte after an ascii byte starts a character whether that ascii stands
+ * alone or is a trail, so the parse only goes back to the last ascii byte and never behind from.
+ */
+static inline size_t gbk_char_start(const uint8_t *data, size_t len, size_t from, size_t pos) {
+    size_t i = pos;
+
+    while ((i > from) && ((data[i - 1] & 0x80) != 0)) {
+        i--;
+    }
+    while (i < pos) {
+        i += ((is_gbk_lead(data[i]) && (i + 1 < len) && is_gbk_trail(data[i + 1])) ? 2 : 1);
+    }
+    return i;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
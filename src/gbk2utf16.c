@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include "gbk2uni.h"
+#include "gbk2utf16.h"
+#include "log.h"
+
+#if defined(__SSE2__) && !defined(GBK2UNI_NO_SIMD) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <emmintrin.h>
+#define GBK2UTF16_SSE2 1
+#endif
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define UTF16_LE(_x) (_x)
+#define UTF16_BE(_x) __builtin_bswap16(_x)
+#else
+#define UTF16_LE(_x) __builtin_bswap16(_x)
+#define UTF16_BE(_x) (_x)
+#endif
+
+ssize_t gbk2utf16_len(const uint8_t *data, size_t len) {
+    size_t i = 0;
+    ssize_t units = 0;
+
+    if ((NULL == data) || (len <= 0)) {
+        return -1;
+    }
+
+    while (i < len) {
+#ifdef GBK2UTF16_SSE2
+        while ((i + 16 <= len) && (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(data + i))) == 0)) {
+            i += 16;
+            units += 16;
+        }
+        if (i >= len) {
+            break;
+        }
+#endif
+        if ((data[i] & 0x80) == 0) {
+            i++;
+        } else if (is_gbk_lead(data[i]) && ((i + 1) < len) && is_gbk_trail(data[i + 1])) {
+            i += 2;
+        } else {
+            LOGD("%zu Is invalid gbk!", i);
+            return -1;
+        }
+        units++;
+    }
+    return units;
+}
+
+ssize_t gbk2utf16(const uint8_t *data, size_t len, uint16_t *out, size_t outlen, bool big_endian) {
+    size_t i = 0, o = 0;
+    uint16_t uni = 0;
+#ifdef GBK2UTF16_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v;
+#endif
+
+    if ((NULL == data) || (len <= 0) || (NULL == out)) {
+        return -1;
+    }
+
+    while (i < len) {
+#ifdef GBK2UTF16_SSE2
+        // Widen ASCII runs 16 bytes at a time, the zero byte goes after (LE) or before (BE) each input byte.
+        while ((i + 16 <= len) && (o + 16 <= outlen)) {
+            v = _mm_loadu_si128((const __m128i *)(data + i));
+            if (_mm_movemask_epi8(v) != 0) {
+                break;
+            }
+            if (big_endian) {
+                _mm_storeu_si128((__m128i *)(out + o), _mm_unpacklo_epi8(zero, v));
+                _mm_storeu_si128((__m128i *)(out + o + 8), _mm_unpackhi_epi8(zero, v));
+            } else {
+                _mm_storeu_si128((__m128i *)(out + o), _mm_unpacklo_epi8(v, zero));
+                _mm_storeu_si128((__m128i *)(out + o + 8), _mm_unpackhi_epi8(v, zero));
+            }
+            i += 16;
+            o += 16;
+        }
+        if (i >= len) {
+            break;
+        }
+#endif
+        if (o >= outlen) {
+            LOGD("Output buffer too small [%zu]!", outlen);
+            return -1;
+        }
+        if ((data[i] & 0x80) == 0) {
+            uni = data[i];
+            i++;
+        } else if (is_gbk_lead(data[i]) && ((i + 1) < len) && is_gbk_trail(data[i + 1])) {
+            uni = gbk2uni((const char *)(data + i));
+            if (uni < 0x80) {
+                // 0 and 0x0001 mark unmapped codes, no double-byte code maps to ASCII.
+                LOGD("%zu Is unmapped gbk [0x%02X%02X]!", i, data[i], data[i + 1]);
+                return -1;
+            }
+            i += 2;
+        } else {
+            LOGD("%zu Is invalid gbk!", i);
+            return -1;
+        }
+        out[o++] = (big_endian ? UTF16_BE(uni) : UTF16_LE(uni));
+    }
+    return o;
+}
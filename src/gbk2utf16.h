@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBK2UTF16_H__
+#define __GBK2UTF16_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/*
+ * Every GBK character, ASCII or double-byte, becomes exactly one UTF-16 unit,
+ * so gbk2utf16_len() gives the exact output size before converting.
+ */
+ssize_t gbk2utf16_len(const uint8_t *data, size_t len);
+ssize_t gbk2utf16(const uint8_t *data, size_t len, uint16_t *out, size_t outlen, bool big_endian);
+
+#endif
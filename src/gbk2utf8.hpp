@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBK2UTF8_HPP__
+#define __GBK2UTF8_HPP__
+
+/*
+ * Header-only C++17 layer over gbk2utf8_buf_stats(). Input is a std::string_view, or a
+ * std::span<const std::byte> with C++20; output is appended to a caller owned string, any
+ * std::basic_string<char> including std::pmr::string. The only allocation is the growth of
+ * that string, with resize_and_overwrite() (C++23) it is not zero filled first.
+ * code_points() and utf8_chars() decode lazily instead, for readers that stop early, and
+ * transcoder converts input arriving in chunks, see gbkasync.hpp for an epoll coroutine.
+ *
+ *   std::pmr::monotonic_buffer_resource arena;
+ *   std::pmr::string out(&arena);
+ *   if (auto r = gbk::append_utf8(in, out); !r) {
+ *       fprintf(stderr, "bad gbk at %zu\n", r.error().offset);
+ *   }
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+#if defined(__cpp_lib_expected)
+#include <expected>
+#endif
+
+#include "gbk2uni.h"
+
+namespace gbk {
+
+enum class errc {
+    invalid = 1,  // not gbk: a lone lead byte, a bad trail or a truncated code
+    unmapped,     // a code the table has no character for
+    rejected,     // a character uni2utf8() refuses to convert
+};
+
+// Where the conversion stopped, offset is relative to the start of the input.
+struct conv_error {
+    errc code;
+    size_t offset;
+};
+
+#if defined(__cpp_lib_expected)
+template <class T>
+using result = std::expected<T, conv_error>;
+
+inline std::unexpected<conv_error> make_error(errc code, size_t offset) {
+    return std::unexpected<conv_error>(conv_error{code, offset});
+}
+#else
+// The part of std::expected the functions below need.
+template <class T>
+class result {
+public:
+    result(T value) : ok_(true), value_(std::move(value)), error_{} {}
+    result(conv_error err) : ok_(false), value_{}, error_(err) {}
+
+    bool has_value() const noexcept { return ok_; }
+    explicit operator bool() const noexcept { return ok_; }
+    const T &value() const & { return value_; }
+    T &value() & { return value_; }
+    T &&value() && { return std::move(value_); }
+    const T &operator*() const & { return value_; }
+    T &operator*() & { return value_; }
+    const T *operator->() const { return &value_; }
+    const conv_error &error() const noexcept { return error_; }
+
+private:
+    bool ok_;
+    T value_;
+    conv_error error_;
+};
+
+inline conv_error make_error(errc code, size_t offset) {
+    return conv_error{code, offset};
+}
+#endif
+
+namespace detail {
+
+inline result<size_t> convert_into(const uint8_t *data, size_t len, char *out, size_t outlen) {
+    gbk2utf8_stats_t stats = {};
+    ssize_t ret = gbk2utf8_buf_stats(data, len, reinterpret_cast<uint8_t *>(out), outlen, &stats);
+
+    if (ret >= 0) {
+        return static_cast<size_t>(ret);
+    }
+    if (stats.unmapped != 0) {
+        return make_error(errc::unmapped, stats.in_bytes);
+    }
+    return make_error((stats.rejected != 0) ? errc::rejected : errc::invalid, stats.in_bytes);
+}
+
+}  // namespace detail
+
+/*
+ * Appends the utf8 form of data to out and returns the number of bytes appended. On error
+ * out keeps its previous contents. The room reserved is GBK2UTF8_MAX_LEN(len).
+ */
+template <class Traits, class Alloc>
+result<size_t> append_utf8(std::string_view data, std::basic_string<char, Traits, Alloc> &out) {
+    const uint8_t *in = reinterpret_cast<const uint8_t *>(data.data());
+    size_t base = out.size();
+    size_t room = GBK2UTF8_MAX_LEN(data.size());
+    result<size_t> ret = size_t{0};
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+    out.resize_and_overwrite(base + room, [&](char *buf, size_t) {
+        ret = detail::convert_into(in, data.size(), buf + base, room);
+        return base + (ret ? *ret : 0);
+    });
+#else
+    out.resize(base + room);
+    ret = detail::convert_into(in, data.size(), &out[base], room);
+    out.resize(base + (ret ? *ret : 0));
+#endif
+    return ret;
+}
+
+#if defined(__cpp_lib_span)
+template <class Traits, class Alloc>
+result<size_t> append_utf8(std::span<const std::byte> data, std::basic_string<char, Traits, Alloc> &out) {
+    return append_utf8(std::string_view(reinterpret_cast<const char *>(data.data()), data.size()), out);
+}
+#endif
+
+// Converts into a new string allocated from mr, the default resource unless one is given.
+inline result<std::pmr::string> to_utf8(std::string_view data,
+                                        std::pmr::memory_resource *mr = std::pmr::get_default_resource()) {
+    std::pmr::string out(mr);
+    result<size_t> ret = append_utf8(data, out);
+
+    if (!ret) {
+        return make_error(ret.error().code, ret.error().offset);
+    }
+    return out;
+}
+
+/*
+ * C++ side of gbk2utf8_stream_t for input arriving in chunks. feed() returns a slice of an
+ * internal buffer that stays valid until the next call; the buffer only grows.
+ */
+class transcoder {
+public:
+    transcoder() { gbk2utf8_stream_init(&state_); }
+
+    result<std::string_view> feed(std::string_view chunk) {
+        size_t need = GBK2UTF8_MAX_LEN(chunk.size() + 1);
+        ssize_t ret = 0;
+
+        if (buf_.size() < need) {
+            buf_.resize(need);
+        }
+        ret = gbk2utf8_stream_feed(&state_, reinterpret_cast<const uint8_t *>(chunk.data()), chunk.size(),
+                                   reinterpret_cast<uint8_t *>(&buf_[0]), buf_.size());
+        if (ret < 0) {
+            return make_error(failure(), state_.stats.in_bytes);
+        }
+        return std::string_view(buf_.data(), static_cast<size_t>(ret));
+    }
+
+    // Fails if the input ended with a lead byte still waiting for its trail.
+    result<uint64_t> finish() {
+        if (gbk2utf8_stream_finish(&state_) != 0) {
+            return make_error(errc::invalid, state_.stats.in_bytes);
+        }
+        return state_.stats.in_bytes;
+    }
+
+    const gbk2utf8_stats_t &stats() const noexcept { return state_.stats; }
+
+private:
+    errc failure() const noexcept {
+        if (state_.stats.unmapped != 0) {
+            return errc::unmapped;
+        }
+        return ((state_.stats.rejected != 0) ? errc::rejected : errc::invalid);
+    }
+
+    gbk2utf8_stream_t state_;
+    std::string buf_;
+};
+
+// One character as utf8 for utf8_chars(), empty where uni2utf8() has no bytes for it.
+struct utf8_char {
+    char bytes[4];
+    uint8_t len;
+
+    const char *data() const noexcept { return bytes; }
+    size_t size() const noexcept { return len; }
+    bool empty() const noexcept { return len == 0; }
+    operator std::string_view() const noexcept { return std::string_view(bytes, len); }
+};
+
+namespace detail {
+
+inline void decode_value(uint32_t cp, size_t step, char32_t &out) {
+    (void)step;
+    out = static_cast<char32_t>(cp);
+}
+
+// Ascii is copied, uni2utf8() refuses code points below 0xFF.
+inline void decode_value(uint32_t cp, size_t step, utf8_char &out) {
+    uint8_t buf[4] = {0};
+
+    out.len = 0;
+    if (step == 1) {
+        out.bytes[0] = static_cast<char>(cp);
+        out.len = (cp != GBK_BAD_CODE_POINT);
+    } else if ((cp != GBK_BAD_CODE_POINT) && (uni2utf8(static_cast<uint16_t>(cp), buf) == 0)) {
+        out.bytes[0] = static_cast<char>(buf[0]);
+        out.bytes[1] = static_cast<char>(buf[1]);
+        out.bytes[2] = static_cast<char>(buf[2]);
+        out.len = ((buf[2] != 0) ? 3 : 2);
+    }
+}
+
+}  // namespace detail
+
+/*
+ * Forward iterator decoding one character per step with gbk_next(), nothing is decoded
+ * ahead of the position read. T is char32_t, GBK_BAD_CODE_POINT for bytes that are not gbk,
+ * or utf8_char. offset() is the input position of the current character.
+ */
+template <class T>
+class decode_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    decode_iterator() = default;
+    explicit decode_iterator(std::string_view data, size_t pos = 0) : data_(data), pos_(pos) { decode(); }
+
+    reference operator*() const { return value_; }
+    pointer operator->() const { return &value_; }
+    size_t offset() const noexcept { return pos_; }
+
+    decode_iterator &operator++() {
+        pos_ += step_;
+        decode();
+        return *this;
+    }
+    decode_iterator operator++(int) {
+        decode_iterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    friend bool operator==(const decode_iterator &a, const decode_iterator &b) { return a.pos_ == b.pos_; }
+    friend bool operator!=(const decode_iterator &a, const decode_iterator &b) { return a.pos_ != b.pos_; }
+#if defined(__cpp_lib_ranges)
+    friend bool operator==(const decode_iterator &a, std::default_sentinel_t) { return a.pos_ >= a.data_.size(); }
+#endif
+
+private:
+    void decode() {
+        uint32_t cp = GBK_BAD_CODE_POINT;
+
+        step_ = gbk_next(reinterpret_cast<const uint8_t *>(data_.data()) + pos_, data_.size() - pos_, &cp);
+        if (step_ != 0) {
+            detail::decode_value(cp, step_, value_);
+        }
+    }
+
+    std::string_view data_;
+    size_t pos_ = 0;
+    size_t step_ = 0;
+    T value_{};
+};
+
+// A view over gbk bytes it does not own, a std::ranges::view with C++20.
+template <class T>
+class decode_view
+#if defined(__cpp_lib_ranges)
+    : public std::ranges::view_interface<decode_view<T>>
+#endif
+{
+public:
+    decode_view() = default;
+    explicit decode_view(std::string_view data) : data_(data) {}
+
+    decode_iterator<T> begin() const { return decode_iterator<T>(data_); }
+    decode_iterator<T> end() const { return decode_iterator<T>(data_, data_.size()); }
+
+private:
+    std::string_view data_;
+};
+
+inline decode_view<char32_t> code_points(std::string_view data) {
+    return decode_view<char32_t>(data);
+}
+
+inline decode_view<utf8_char> utf8_chars(std::string_view data) {
+    return decode_view<utf8_char>(data);
+}
+
+}  // namespace gbk
+
+#if defined(__cpp_lib_ranges)
+template <class T>
+inline constexpr bool std::ranges::enable_borrowed_range<gbk::decode_view<T>> = true;
+#endif
+
+#endif
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "gbkalloc.h"
+#include "log.h"
+
+#define ALIGN_UP(_n) (((_n) + GBK_ALLOC_ALIGN - 1) & ~((size_t)GBK_ALLOC_ALIGN - 1))
+
+static void *libc_alloc(void *ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void *libc_shrink(void *ctx, void *ptr, size_t size, size_t new_size) {
+    (void)ctx;
+    (void)size;
+    return realloc(ptr, new_size);
+}
+
+static void libc_free(void *ctx, void *ptr) {
+    (void)ctx;
+    free(ptr);
+}
+
+const gbk_allocator_t gbk_allocator_libc = {libc_alloc, libc_shrink, libc_free, NULL};
+
+void *gbk_alloc(const gbk_allocator_t *a, size_t size) {
+    a = ((a != NULL) ? a : &gbk_allocator_libc);
+    return a->alloc(a->ctx, size);
+}
+
+void *gbk_shrink(const gbk_allocator_t *a, void *ptr, size_t size, size_t new_size) {
+    void *ret = NULL;
+
+    a = ((a != NULL) ? a : &gbk_allocator_libc);
+    if ((ptr == NULL) || (a->shrink == NULL) || (new_size >= size)) {
+        return ptr;
+    }
+    ret = a->shrink(a->ctx, ptr, size, new_size);
+    return ((ret != NULL) ? ret : ptr);
+}
+
+void gbk_free(const gbk_allocator_t *a, void *ptr) {
+    a = ((a != NULL) ? a : &gbk_allocator_libc);
+    if ((ptr != NULL) && (a->free != NULL)) {
+        a->free(a->ctx, ptr);
+    }
+}
+
+/*
+ * Chunks stay linked after a reset, cur is the one being carved and the chunks behind it are
+ * empty. A chunk that cannot fit a block is left with its tail unused until the next reset.
+ */
+typedef struct gbk_arena_chunk {
+    struct gbk_arena_chunk *next;
+    size_t size;
+    size_t used;
+} gbk_arena_chunk_t;
+
+#define ARENA_CHUNK_HEAD ALIGN_UP(sizeof(gbk_arena_chunk_t))
+#define ARENA_CHUNK_DATA(_c) ((uint8_t *)(_c) + ARENA_CHUNK_HEAD)
+
+struct gbk_arena {
+    gbk_arena_chunk_t *head;
+    gbk_arena_chunk_t *cur;
+    size_t chunk_size;
+    void *last;
+};
+
+static gbk_arena_chunk_t *arena_chunk_new(size_t size) {
+    gbk_arena_chunk_t *c = (gbk_arena_chunk_t *)malloc(ARENA_CHUNK_HEAD + size);
+
+    if (c == NULL) {
+        LOGE("Failed to malloc arena chunk size [%zu]!", size);
+        return NULL;
+    }
+    c->next = NULL;
+    c->size = size;
+    c->used = 0;
+    return c;
+}
+
+gbk_arena_t *gbk_arena_create(size_t chunk_size) {
+    gbk_arena_t *arena = (gbk_arena_t *)calloc(1, sizeof(gbk_arena_t));
+
+    if (arena == NULL) {
+        return NULL;
+    }
+    arena->chunk_size = ALIGN_UP((chunk_size > 0) ? chunk_size : (64 << 10));
+    arena->head = arena_chunk_new(arena->chunk_size);
+    if (arena->head == NULL) {
+        free(arena);
+        return NULL;
+    }
+    arena->cur = arena->head;
+    return arena;
+}
+
+void *gbk_arena_alloc(gbk_arena_t *arena, size_t size) {
+    gbk_arena_chunk_t *c = NULL;
+    void *ptr = NULL;
+
+    if (arena == NULL) {
+        return NULL;
+    }
+    size = ALIGN_UP((size > 0) ? size : 1);
+    c = arena->cur;
+    while (c->size - c->used < size) {
+        if ((c->next != NULL) && (c->next->size >= size)) {
+            c = c->next;
+            continue;
+        }
+        c = arena_chunk_new((size > arena->chunk_size) ? size : arena->chunk_size);
+        if (c == NULL) {
+            return NULL;
+        }
+        c->next = arena->cur->next;
+        arena->cur->next = c;
+    }
+    arena->cur = c;
+    ptr = ARENA_CHUNK_DATA(c) + c->used;
+    c->used += size;
+    arena->last = ptr;
+    return ptr;
+}
+
+// Only the latest block can give its tail back.
+static void *arena_shrink(void *ctx, void *ptr, size_t size, size_t new_size) {
+    gbk_arena_t *arena = (gbk_arena_t *)ctx;
+
+    if (ptr == arena->last) {
+        arena->cur->used -= ALIGN_UP(size) - ALIGN_UP((new_size > 0) ? new_size : 1);
+    }
+    return ptr;
+}
+
+static void *arena_alloc(void *ctx, size_t size) {
+    return gbk_arena_alloc((gbk_arena_t *)ctx, size);
+}
+
+void gbk_arena_reset(gbk_arena_t *arena) {
+    gbk_arena_chunk_t *c = NULL;
+
+    if (arena == NULL) {
+        return;
+    }
+    for (c = arena->head; c != NULL; c = c->next) {
+        c->used = 0;
+    }
+    arena->cur = arena->head;
+    arena->last = NULL;
+}
+
+size_t gbk_arena_used(const gbk_arena_t *arena) {
+    const gbk_arena_chunk_t *c = NULL;
+    size_t used = 0;
+
+    for (c = ((arena != NULL) ? arena->head : NULL); c != NULL; c = c->next) {
+        used += c->used;
+    }
+    return used;
+}
+
+void gbk_arena_destroy(gbk_arena_t *arena) {
+    gbk_arena_chunk_t *c = NULL, *next = NULL;
+
+    if (arena == NULL) {
+        return;
+    }
+    for (c = arena->head; c != NULL; c = next) {
+        next = c->next;
+        free(c);
+    }
+    free(arena);
+}
+
+gbk_allocator_t gbk_arena_allocator(gbk_arena_t *arena) {
+    gbk_allocator_t a = {arena_alloc, arena_shrink, NULL, arena};
+    return a;
+}
+
+/*
+ * Every pool block starts with a GBK_ALLOC_ALIGN sized head holding its class, or
+ * POOL_LARGE for blocks from malloc. Free blocks reuse the head as the list link.
+ * Large blocks are preceded by a link into the pool's list, so destroy frees them too.
+ */
+#define POOL_MIN_SHIFT 5
+#define POOL_CLASSES 12
+#define POOL_LARGE 0xFFFFFFFFu
+#define POOL_SLAB (256 << 10)
+#define POOL_HEAD ALIGN_UP(sizeof(gbk_pool_head_t))
+
+typedef union gbk_pool_head {
+    uint32_t cls;
+    union gbk_pool_head *next;
+} gbk_pool_head_t;
+
+typedef struct gbk_pool_large {
+    struct gbk_pool_large *prev;
+    struct gbk_pool_large *next;
+} gbk_pool_large_t;
+
+#define POOL_LARGE_HEAD ALIGN_UP(sizeof(gbk_pool_large_t))
+
+struct gbk_pool {
+    gbk_pool_head_t *free_list[POOL_CLASSES];
+    gbk_pool_head_t *slabs;
+    gbk_pool_large_t large;
+    uint8_t *pos;
+    size_t left;
+};
+
+gbk_pool_t *gbk_pool_create(void) {
+    gbk_pool_t *pool = (gbk_pool_t *)calloc(1, sizeof(gbk_pool_t));
+
+    if (pool != NULL) {
+        pool->large.prev = &pool->large;
+        pool->large.next = &pool->large;
+    }
+    return pool;
+}
+
+static inline uint32_t pool_class(size_t size) {
+    if (size <= (1u << POOL_MIN_SHIFT)) {
+        return 0;
+    }
+    return 64 - __builtin_clzll(size - 1) - POOL_MIN_SHIFT;
+}
+
+void *gbk_pool_alloc(gbk_pool_t *pool, size_t size) {
+    gbk_pool_head_t *head = NULL;
+    gbk_pool_large_t *large = NULL;
+    uint32_t cls = 0;
+    size_t need = POOL_HEAD + size;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+    if (need > GBK_POOL_MAX) {
+        large = (gbk_pool_large_t *)malloc(POOL_LARGE_HEAD + need);
+        if (large == NULL) {
+            return NULL;
+        }
+        large->prev = &pool->large;
+        large->next = pool->large.next;
+        large->next->prev = large;
+        pool->large.next = large;
+        head = (gbk_pool_head_t *)((uint8_t *)large + POOL_LARGE_HEAD);
+        head->cls = POOL_LARGE;
+        return (uint8_t *)head + POOL_HEAD;
+    }
+
+    cls = pool_class(need);
+    head = pool->free_list[cls];
+    if (head != NULL) {
+        pool->free_list[cls] = head->next;
+    } else {
+        need = (size_t)1 << (cls + POOL_MIN_SHIFT);
+        if (pool->left < need) {
+            // The first block of every slab links the slabs for gbk_pool_destroy().
+            head = (gbk_pool_head_t *)malloc(POOL_SLAB);
+            if (head == NULL) {
+                LOGE("Failed to malloc pool slab!");
+                return NULL;
+            }
+            head->next = pool->slabs;
+            pool->slabs = head;
+            pool->pos = (uint8_t *)head + POOL_HEAD;
+            pool->left = POOL_SLAB - POOL_HEAD;
+        }
+        head = (gbk_pool_head_t *)pool->pos;
+        pool->pos += need;
+        pool->left -= need;
+    }
+    head->cls = cls;
+    return (uint8_t *)head + POOL_HEAD;
+}
+
+size_t gbk_pool_block_size(size_t size) {
+    size_t need = POOL_HEAD + size;
+
+    if (need > GBK_POOL_MAX) {
+        return POOL_LARGE_HEAD + need;
+    }
+    return (size_t)1 << (pool_class(need) + POOL_MIN_SHIFT);
+}
+
+void gbk_pool_free(gbk_pool_t *pool, void *ptr) {
+    gbk_pool_head_t *head = NULL;
+    gbk_pool_large_t *large = NULL;
+    uint32_t cls = 0;
+
+    if ((pool == NULL) || (ptr == NULL)) {
+        return;
+    }
+    head = (gbk_pool_head_t *)((uint8_t *)ptr - POOL_HEAD);
+    cls = head->cls;
+    if (cls == POOL_LARGE) {
+        large = (gbk_pool_large_t *)((uint8_t *)head - POOL_LARGE_HEAD);
+        large->prev->next = large->next;
+        large->next->prev = large->prev;
+        free(large);
+        return;
+    }
+    head->next = pool->free_list[cls];
+    pool->free_list[cls] = head;
+}
+
+void gbk_pool_destroy(gbk_pool_t *pool) {
+    gbk_pool_head_t *slab = NULL, *next = NULL;
+    gbk_pool_large_t *large = NULL, *large_next = NULL;
+
+    if (pool == NULL) {
+        return;
+    }
+    for (slab = pool->slabs; slab != NULL; slab = next) {
+        next = slab->next;
+        free(slab);
+    }
+    for (large = pool->large.next; large != &pool->large; large = large_next) {
+        large_next = large->next;
+        free(large);
+    }
+    free(pool);
+}
+
+static void *pool_alloc(void *ctx, size_t size) {
+    return gbk_pool_alloc((gbk_pool_t *)ctx, size);
+}
+
+static void pool_free(void *ctx, void *ptr) {
+    gbk_pool_free((gbk_pool_t *)ctx, ptr);
+}
+
+gbk_allocator_t gbk_pool_allocator(gbk_pool_t *pool) {
+    gbk_allocator_t a = {pool_alloc, NULL, pool_free, pool};
+    return a;
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKALLOC_H__
+#define __GBKALLOC_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Allocator hooks for the converters that return memory, e.g. gbk2utf8_with(). shrink gives
+ * back the tail of a block once its final size is known and returns the block, which may have
+ * moved; NULL keeps the block as it is. Both shrink and free may be NULL, e.g. for an arena
+ * that is released as a whole. Blocks are aligned to GBK_ALLOC_ALIGN.
+ */
+#define GBK_ALLOC_ALIGN 16
+
+typedef struct gbk_allocator {
+    void *(*alloc)(void *ctx, size_t size);
+    void *(*shrink)(void *ctx, void *ptr, size_t size, size_t new_size);
+    void (*free)(void *ctx, void *ptr);
+    void *ctx;
+} gbk_allocator_t;
+
+// malloc, realloc and free, what a NULL allocator stands for.
+extern const gbk_allocator_t gbk_allocator_libc;
+
+void *gbk_alloc(const gbk_allocator_t *a, size_t size);
+void *gbk_shrink(const gbk_allocator_t *a, void *ptr, size_t size, size_t new_size);
+void gbk_free(const gbk_allocator_t *a, void *ptr);
+
+/*
+ * Bump pointer arena for request scoped work: allocation is a pointer increment, free is a
+ * no-op and gbk_arena_reset() releases everything at once while keeping the chunks for reuse.
+ * Blocks larger than a chunk get a chunk of their own. Not thread safe.
+ */
+typedef struct gbk_arena gbk_arena_t;
+
+gbk_arena_t *gbk_arena_create(size_t chunk_size);
+void *gbk_arena_alloc(gbk_arena_t *arena, size_t size);
+void gbk_arena_reset(gbk_arena_t *arena);
+size_t gbk_arena_used(const gbk_arena_t *arena);
+void gbk_arena_destroy(gbk_arena_t *arena);
+gbk_allocator_t gbk_arena_allocator(gbk_arena_t *arena);
+
+/*
+ * Size class pool: power of two classes from GBK_POOL_MIN to GBK_POOL_MAX carved from slabs,
+ * freed blocks go to a per class free list. Larger blocks come from malloc, gbk_pool_destroy()
+ * releases those too. Not thread safe, use one pool per thread.
+ */
+#define GBK_POOL_MIN 32
+#define GBK_POOL_MAX (64 << 10)
+
+typedef struct gbk_pool gbk_pool_t;
+
+gbk_pool_t *gbk_pool_create(void);
+void *gbk_pool_alloc(gbk_pool_t *pool, size_t size);
+void gbk_pool_free(gbk_pool_t *pool, void *ptr);
+// Bytes gbk_pool_alloc(pool, size) takes from the pool: its head and the rounding to a class.
+size_t gbk_pool_block_size(size_t size);
+void gbk_pool_destroy(gbk_pool_t *pool);
+gbk_allocator_t gbk_pool_allocator(gbk_pool_t *pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
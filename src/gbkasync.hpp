@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKASYNC_HPP__
+#define __GBKASYNC_HPP__
+
+/*
+ * C++20 coroutines over gbk::transcoder for payloads read from a non-blocking fd: every chunk
+ * is converted as soon as it arrives, while the rest is still on the wire. Linux, epoll.
+ *
+ *   gbk::task consume(gbk::epoll_loop &loop, int fd, gbk::stream_status &status) {
+ *       auto slices = gbk::transcode(loop, fd, status);
+ *       while (auto slice = co_await slices.next()) {
+ *           write(1, slice->data(), slice->size());
+ *       }
+ *   }
+ *
+ *   gbk::epoll_loop loop;
+ *   consume(loop, fd, status);
+ *   loop.run();
+ */
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "gbk2utf8.hpp"
+
+namespace gbk {
+
+// Resumes coroutines waiting for their fd to become readable, one shot per wait.
+class epoll_loop {
+public:
+    epoll_loop() : fd_(epoll_create1(EPOLL_CLOEXEC)) {}
+    ~epoll_loop() {
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+    epoll_loop(const epoll_loop &) = delete;
+    epoll_loop &operator=(const epoll_loop &) = delete;
+
+    struct readable_awaiter {
+        epoll_loop &loop;
+        int fd;
+        int err;
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> h) noexcept {
+            struct epoll_event ev = {};
+
+            ev.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+            ev.data.ptr = h.address();
+            // A one shot fd stays registered, disabled, after it fired.
+            if ((epoll_ctl(loop.fd_, EPOLL_CTL_MOD, fd, &ev) != 0) &&
+                ((errno != ENOENT) || (epoll_ctl(loop.fd_, EPOLL_CTL_ADD, fd, &ev) != 0))) {
+                err = errno;
+                return false;
+            }
+            loop.waiting_++;
+            return true;
+        }
+        // 0, or the errno of a failed registration.
+        int await_resume() const noexcept { return err; }
+    };
+
+    readable_awaiter readable(int fd) { return readable_awaiter{*this, fd, 0}; }
+
+    void forget(int fd) { epoll_ctl(fd_, EPOLL_CTL_DEL, fd, nullptr); }
+
+    // Runs until no coroutine waits any more, false on an epoll error.
+    bool run() {
+        struct epoll_event evs[64];
+        int i = 0, n = 0;
+
+        while (waiting_ > 0) {
+            n = epoll_wait(fd_, evs, sizeof(evs) / sizeof(evs[0]), -1);
+            if ((n < 0) && (errno == EINTR)) {
+                continue;
+            }
+            if (n < 0) {
+                return false;
+            }
+            for (i = 0; i < n; i++) {
+                waiting_--;
+                std::coroutine_handle<>::from_address(evs[i].data.ptr).resume();
+            }
+        }
+        return true;
+    }
+
+private:
+    int fd_;
+    size_t waiting_ = 0;
+};
+
+// Fire and forget coroutine, runs eagerly until its first suspension and frees itself at the end.
+struct task {
+    struct promise_type {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+// Outcome of transcode(), valid once next() has returned nullopt.
+struct stream_status {
+    bool ok = true;
+    int sys_errno = 0;        // read() or epoll failure
+    conv_error error = {};    // conversion failure, offset into the whole stream
+    gbk2utf8_stats_t stats = {};
+};
+
+/*
+ * Async generator of utf8 slices. co_await next() runs the producer until it yields a slice
+ * or finishes; while it waits for input the consumer stays suspended as well. A slice is
+ * valid until the following next().
+ */
+class utf8_slices {
+public:
+    struct promise_type {
+        std::string_view slice;
+        std::coroutine_handle<> consumer;
+
+        struct transfer {
+            bool await_ready() const noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                return h.promise().consumer;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        utf8_slices get_return_object() noexcept {
+            return utf8_slices(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        transfer final_suspend() noexcept { return {}; }
+        transfer yield_value(std::string_view value) noexcept {
+            slice = value;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    struct next_awaiter {
+        std::coroutine_handle<promise_type> producer;
+
+        bool await_ready() const noexcept { return producer.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> h) noexcept {
+            producer.promise().consumer = h;
+            return producer;
+        }
+        std::optional<std::string_view> await_resume() const noexcept {
+            if (producer.done()) {
+                return std::nullopt;
+            }
+            return producer.promise().slice;
+        }
+    };
+
+    explicit utf8_slices(std::coroutine_handle<promise_type> h) : h_(h) {}
+    utf8_slices(utf8_slices &&other) noexcept : h_(other.h_) { other.h_ = nullptr; }
+    utf8_slices(const utf8_slices &) = delete;
+    utf8_slices &operator=(const utf8_slices &) = delete;
+    ~utf8_slices() {
+        if (h_) {
+            h_.destroy();
+        }
+    }
+
+    next_awaiter next() { return next_awaiter{h_}; }
+
+private:
+    std::coroutine_handle<promise_type> h_;
+};
+
+/*
+ * Reads fd, which must be non-blocking, until EOF and yields the converted slices. Errors end
+ * the stream and are left in status.
+ */
+inline utf8_slices transcode(epoll_loop &loop, int fd, stream_status &status, size_t chunk_size = 64 << 10) {
+    transcoder tc;
+    std::string chunk(chunk_size, '\0');
+    ssize_t n = 0;
+    int err = 0;
+
+    for (;;) {
+        n = read(fd, &chunk[0], chunk.size());
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN) {
+                status.sys_errno = errno;
+                break;
+            }
+            if ((err = co_await loop.readable(fd)) != 0) {
+                status.sys_errno = err;
+                break;
+            }
+            continue;
+        }
+        if (n == 0) {
+            auto end = tc.finish();
+            if (!end) {
+                status.error = end.error();
+            }
+            break;
+        }
+        auto slice = tc.feed(std::string_view(chunk.data(), static_cast<size_t>(n)));
+        if (!slice) {
+            status.error = slice.error();
+            break;
+        }
+        if (!slice->empty()) {
+            co_yield *slice;
+        }
+    }
+    loop.forget(fd);
+    status.ok = ((status.sys_errno == 0) && (status.error.code == errc{}));
+    status.stats = tc.stats();
+}
+
+}  // namespace gbk
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+// Loopback test of gbkasync.hpp: a writer thread sends each input over a socketpair in random
+// sized chunks, gbk::transcode() must produce what whole-buffer conversion produces, and stop
+// with the same error kind and offset on bad input.
+
+#include <fcntl.h>
+#include <sys/socket.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "gbkasync.hpp"
+
+namespace {
+
+struct loopback_result {
+    bool run = false;
+    gbk::stream_status status;
+    std::string out;
+    size_t slices = 0;
+};
+
+gbk::task consume(gbk::epoll_loop &loop, int fd, loopback_result &res, size_t chunk_size) {
+    auto slices = gbk::transcode(loop, fd, res.status, chunk_size);
+
+    while (auto slice = co_await slices.next()) {
+        res.out += *slice;
+        res.slices++;
+    }
+}
+
+// Up to max_chunk bytes per write, with a pause now and then so the reader sees EAGAIN.
+loopback_result loopback(const std::string &in, unsigned seed, size_t max_chunk, size_t chunk_size) {
+    loopback_result res;
+    gbk::epoll_loop loop;
+    int sv[2] = {-1, -1};
+
+    if ((socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) || (fcntl(sv[0], F_SETFL, O_NONBLOCK) != 0)) {
+        res.status.sys_errno = errno;
+        return res;
+    }
+    std::thread writer([&] {
+        unsigned state = seed;
+        size_t i = 0, n = 0;
+
+        while (i < in.size()) {
+            n = std::min<size_t>(rand_r(&state) % max_chunk + 1, in.size() - i);
+            if (write(sv[1], in.data() + i, n) != static_cast<ssize_t>(n)) {
+                break;
+            }
+            i += n;
+            if (rand_r(&state) % 8 == 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+        close(sv[1]);
+    });
+
+    consume(loop, sv[0], res, chunk_size);
+    res.run = loop.run();
+    // The reader stops at the first error, the writer may still be blocked on a full socket.
+    close(sv[0]);
+    writer.join();
+    return res;
+}
+
+bool check(const char *name, const std::string &in) {
+    std::string ref;
+    auto expect = gbk::append_utf8(in, ref);
+    static const size_t max_chunks[] = {1, 7, 3001};
+    static const size_t chunk_sizes[] = {1, 4096};
+    bool ok = true;
+
+    for (size_t max_chunk : max_chunks) {
+        for (size_t chunk_size : chunk_sizes) {
+            auto res = loopback(in, static_cast<unsigned>(max_chunk + chunk_size), max_chunk, chunk_size);
+            bool same = res.run && (res.status.sys_errno == 0) && (res.status.ok == static_cast<bool>(expect));
+
+            if (same && expect) {
+                same = (res.out == ref);
+            } else if (same) {
+                same = (res.status.error.code == expect.error().code) &&
+                       (res.status.error.offset == expect.error().offset);
+            }
+            if (!same) {
+                fprintf(stderr, "%s: chunks up to %zu, reads of %zu: ok %d errno %d error %d at %zu, expect %d at %zu\n",
+                        name, max_chunk, chunk_size, res.status.ok, res.status.sys_errno,
+                        static_cast<int>(res.status.error.code), res.status.error.offset,
+                        (expect ? 0 : static_cast<int>(expect.error().code)), (expect ? 0 : expect.error().offset));
+                ok = false;
+            }
+        }
+    }
+    printf("%-10s %8zu bytes %s\n", name, in.size(), (ok ? "ok" : "FAILED"));
+    return ok;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+    std::string text;
+    bool ok = true;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s GBK_FILE\n", argv[0]);
+        return 2;
+    }
+    std::ifstream file(argv[1], std::ios::binary);
+    std::stringstream buf;
+    buf << file.rdbuf();
+    text = buf.str();
+    if (!file || text.empty()) {
+        fprintf(stderr, "Failed to read [%s]\n", argv[1]);
+        return 2;
+    }
+    // A writer blocked on a socket the reader closed early gets EPIPE, not a signal.
+    signal(SIGPIPE, SIG_IGN);
+
+    ok &= check("valid", text);
+    ok &= check("empty", "");
+    // "ab" then a lead byte with the trail 0x20.
+    ok &= check("invalid", text + "ab\xC4\x20zz" + text);
+    // 0xA140 has a valid lead and trail, but no character.
+    ok &= check("unmapped", text + "\xA1\x40" + text);
+    // 0xA7A1 is U+0410, which uni2utf8() refuses.
+    ok &= check("rejected", text + "\xA7\xA1" + text);
+    ok &= check("truncated", text + "\xC4");
+    return ok ? 0 : 1;
+}
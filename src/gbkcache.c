@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+// copy_file_range()
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gbk2uni.h"
+#include "gbkcache.h"
+#include "gbkhash.h"
+#include "log.h"
+
+// <16 hex digits>GBKCACHE_SUFFIX
+#define GBKCACHE_NAME_LEN (16 + sizeof(GBKCACHE_SUFFIX) - 1)
+
+struct gbkcache {
+    char *dir;
+    uint64_t max_bytes;
+};
+
+typedef struct gbkcache_file {
+    int64_t mtime_ns;
+    uint64_t size;
+    char name[GBKCACHE_NAME_LEN + 1];
+} gbkcache_file_t;
+
+static int64_t mtime_ns(const struct stat *st) {
+    return (int64_t)st->st_mtim.tv_sec * 1000000000LL + st->st_mtim.tv_nsec;
+}
+
+// Like mkdir -p, an existing directory is no error.
+static int32_t make_dirs(char *path) {
+    char *p = path;
+
+    while ((p = strchr(p + 1, '/')) != NULL) {
+        *p = 0;
+        if ((mkdir(path, 0755) != 0) && (errno != EEXIST)) {
+            *p = '/';
+            return -1;
+        }
+        *p = '/';
+    }
+    return (((mkdir(path, 0755) == 0) || (errno == EEXIST)) ? 0 : -1);
+}
+
+gbkcache_t *gbkcache_open(const char *dir, uint64_t max_bytes) {
+    gbkcache_t *cache = NULL;
+    const char *base = NULL;
+    const char *sub = "/gbk2utf8";
+    char *path = NULL;
+
+    if (dir == NULL) {
+        base = getenv("XDG_CACHE_HOME");
+        if ((base == NULL) || (base[0] == 0)) {
+            base = getenv("HOME");
+            sub = "/.cache/gbk2utf8";
+        }
+        if ((base == NULL) || (base[0] == 0)) {
+            LOGE("No cache directory, neither XDG_CACHE_HOME nor HOME is set!");
+            return NULL;
+        }
+    } else {
+        base = dir;
+        sub = "";
+    }
+
+    path = (char *)malloc(strlen(base) + strlen(sub) + 1);
+    cache = (gbkcache_t *)malloc(sizeof(gbkcache_t));
+    if ((path == NULL) || (cache == NULL)) {
+        goto __oops;
+    }
+    strcpy(path, base);
+    strcat(path, sub);
+    if (make_dirs(path) != 0) {
+        LOGE("Failed to create cache directory [%s]!", path);
+        goto __oops;
+    }
+    cache->dir = path;
+    cache->max_bytes = ((max_bytes != 0) ? max_bytes : GBKCACHE_MAX_BYTES);
+    LOGD("Cache [%s], max [%llu] bytes", path, (unsigned long long)cache->max_bytes);
+    return cache;
+
+__oops:
+    free(cache);
+    free(path);
+    return NULL;
+}
+
+void gbkcache_close(gbkcache_t *cache) {
+    if (cache != NULL) {
+        free(cache->dir);
+        free(cache);
+    }
+}
+
+// Without filters the seed, and so every key, is what it was before filters were keyed.
+uint64_t gbkcache_key(const uint8_t *data, size_t len, uint32_t filters) {
+    uint64_t seed = ((uint64_t)(GBKCACHE_VERSION | (filters << 8)) << 32) | gbk2uni_table_version();
+
+    return gbk_xxh64(data, len, seed);
+}
+
+static char *gbkcache_path(const gbkcache_t *cache, uint64_t key) {
+    size_t len = strlen(cache->dir) + 1 + GBKCACHE_NAME_LEN + 1;
+    char *path = (char *)malloc(len);
+
+    if (path != NULL) {
+        snprintf(path, len, "%s/%016llx%s", cache->dir, (unsigned long long)key, GBKCACHE_SUFFIX);
+    }
+    return path;
+}
+
+static int32_t write_all(int fd, const uint8_t *buf, size_t len) {
+    ssize_t n = 0;
+
+    while (len > 0) {
+        n = write(fd, buf, len);
+        if ((n < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * copy_file_range() keeps the copy in the kernel, between files on one filesystem it may
+ * share the blocks. It refuses pipes, terminals and some filesystem pairs, what is left then
+ * is written from a mapping of the entry.
+ */
+static int32_t gbkcache_send(int in, size_t size, loff_t off, int fd) {
+    ssize_t n = 0;
+    void *addr = MAP_FAILED;
+    int32_t ret = 0;
+
+    while ((size_t)off < size) {
+        n = copy_file_range(in, &off, fd, NULL, size - off, 0);
+        if ((n < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+    }
+    if ((size_t)off >= size) {
+        return 0;
+    }
+    if ((n == 0) ||
+        ((errno != EXDEV) && (errno != EINVAL) && (errno != ENOSYS) && (errno != EOPNOTSUPP) && (errno != EBADF))) {
+        return -1;
+    }
+
+    addr = mmap(NULL, size, PROT_READ, MAP_SHARED, in, 0);
+    if (addr == MAP_FAILED) {
+        return -1;
+    }
+    ret = write_all(fd, (const uint8_t *)addr + off, size - off);
+    munmap(addr, size);
+    return ret;
+}
+
+ssize_t gbkcache_get(gbkcache_t *cache, uint64_t key, size_t in_len, int fd) {
+    ssize_t ret = -1;
+    int in = -1;
+    struct stat st;
+    gbkcache_header_t head;
+    char *path = NULL;
+
+    if ((cache == NULL) || ((path = gbkcache_path(cache, key)) == NULL)) {
+        return -1;
+    }
+    in = open(path, O_RDONLY | O_CLOEXEC);
+    if (in < 0) {
+        LOGD("Cache miss [%s]", path);
+        goto __oops;
+    }
+    if ((pread(in, &head, sizeof(head), 0) != sizeof(head)) || (fstat(in, &st) != 0) ||
+        (memcmp(head.magic, GBKCACHE_MAGIC, sizeof(head.magic)) != 0) || (head.version != GBKCACHE_VERSION) ||
+        (head.key != key) || (head.in_len != in_len) || ((uint64_t)st.st_size != sizeof(head) + head.out_len)) {
+        LOGW("Invalid cache entry [%s]!", path);
+        goto __oops;
+    }
+    if (gbkcache_send(in, st.st_size, sizeof(head), fd) != 0) {
+        LOGE("Failed to copy cache entry [%s]!", path);
+        goto __oops;
+    }
+    // The mtime is the last use, see gbkcache_evict().
+    futimens(in, NULL);
+    LOGD("Cache hit [%s], [%llu] bytes", path, (unsigned long long)head.out_len);
+    ret = head.out_len;
+
+__oops:
+    if (in >= 0) {
+        close(in);
+    }
+    free(path);
+    return ret;
+}
+
+static int cmp_mtime(const void *a, const void *b) {
+    const gbkcache_file_t *fa = (const gbkcache_file_t *)a;
+    const gbkcache_file_t *fb = (const gbkcache_file_t *)b;
+
+    return ((fa->mtime_ns > fb->mtime_ns) - (fa->mtime_ns < fb->mtime_ns));
+}
+
+// Removes the least recently used entries until the directory fits max_bytes.
+static void gbkcache_evict(gbkcache_t *cache) {
+    DIR *dir = NULL;
+    struct dirent *de = NULL;
+    struct stat st;
+    gbkcache_file_t *files = NULL, *grown = NULL;
+    size_t i = 0, n = 0, cap = 0, len = 0;
+    uint64_t total = 0;
+
+    dir = opendir(cache->dir);
+    if (dir == NULL) {
+        return;
+    }
+    while ((de = readdir(dir)) != NULL) {
+        len = strlen(de->d_name);
+        if ((len != GBKCACHE_NAME_LEN) || (strcmp(de->d_name + 16, GBKCACHE_SUFFIX) != 0) ||
+            (fstatat(dirfd(dir), de->d_name, &st, 0) != 0) || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+        if (n == cap) {
+            cap = ((cap > 0) ? (cap * 2) : 64);
+            grown = (gbkcache_file_t *)realloc(files, cap * sizeof(gbkcache_file_t));
+            if (grown == NULL) {
+                goto __oops;
+            }
+            files = grown;
+        }
+        files[n].mtime_ns = mtime_ns(&st);
+        files[n].size = st.st_size;
+        memcpy(files[n].name, de->d_name, len + 1);
+        total += st.st_size;
+        n++;
+    }
+
+    if (total > cache->max_bytes) {
+        qsort(files, n, sizeof(gbkcache_file_t), cmp_mtime);
+        for (i = 0; (i < n) && (total > cache->max_bytes); i++) {
+            if (unlinkat(dirfd(dir), files[i].name, 0) == 0) {
+                LOGD("Evict [%s], [%llu] bytes", files[i].name, (unsigned long long)files[i].size);
+                total -= files[i].size;
+            }
+        }
+    }
+__oops:
+    free(files);
+    closedir(dir);
+}
+
+int32_t gbkcache_put(gbkcache_t *cache, uint64_t key, size_t in_len, const uint8_t *out, size_t out_len) {
+    int32_t ret = -1;
+    int fd = -1;
+    gbkcache_header_t head;
+    char *path = NULL, *tmp = NULL;
+
+    if ((cache == NULL) || ((out == NULL) && (out_len > 0))) {
+        return -1;
+    }
+    path = gbkcache_path(cache, key);
+    tmp = (char *)malloc(strlen(cache->dir) + sizeof("/.tmp.XXXXXX"));
+    if ((path == NULL) || (tmp == NULL)) {
+        goto __oops;
+    }
+    strcpy(tmp, cache->dir);
+    strcat(tmp, "/.tmp.XXXXXX");
+    fd = mkstemp(tmp);
+    if (fd < 0) {
+        LOGE("Failed to create [%s]!", tmp);
+        goto __oops;
+    }
+
+    memset(&head, 0, sizeof(head));
+    memcpy(head.magic, GBKCACHE_MAGIC, sizeof(head.magic));
+    head.version = GBKCACHE_VERSION;
+    head.key = key;
+    head.in_len = in_len;
+    head.out_len = out_len;
+    if ((write_all(fd, (const uint8_t *)&head, sizeof(head)) != 0) || (write_all(fd, out, out_len) != 0) ||
+        (close(fd) != 0)) {
+        fd = -1;
+        LOGE("Failed to write [%s]!", tmp);
+        unlink(tmp);
+        goto __oops;
+    }
+    fd = -1;
+    if (rename(tmp, path) != 0) {
+        LOGE("Failed to rename [%s] to [%s]!", tmp, path);
+        unlink(tmp);
+        goto __oops;
+    }
+    LOGD("Cache put [%s], [%zu] bytes", path, out_len);
+    gbkcache_evict(cache);
+    ret = 0;
+
+__oops:
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(tmp);
+    free(path);
+    return ret;
+}
+
+ssize_t gbkcache_convert(gbkcache_t *cache, const uint8_t *data, size_t len, uint32_t filters, int fd) {
+    uint64_t key = gbkcache_key(data, len, filters);
+    size_t room = (((filters & GBK2UTF8_FILTER_JSON) != 0) ? GBK2UTF8_FILTER_MAX_LEN(len) : GBK2UTF8_MAX_LEN(len));
+    ssize_t ret = gbkcache_get(cache, key, len, fd);
+    uint8_t *out = NULL;
+
+    if (ret >= 0) {
+        return ret;
+    }
+    out = (uint8_t *)malloc(room + 1);
+    if (out == NULL) {
+        return -1;
+    }
+    ret = gbk2utf8_buf_filter(data, len, out, room, filters, NULL);
+    if (ret >= 0) {
+        // A failed put only costs the next call a conversion.
+        gbkcache_put(cache, key, len, out, (size_t)ret);
+        ret = ((write_all(fd, out, (size_t)ret) == 0) ? ret : -1);
+    }
+    free(out);
+    return ret;
+}
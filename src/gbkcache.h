@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKCACHE_H__
+#define __GBKCACHE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Content addressed cache of converted output in a local directory. An entry is keyed by
+ * XXH64 of the input seeded with gbk2uni_table_version(), so loading another table misses.
+ * Entries are <key>GBKCACHE_SUFFIX files, a gbkcache_header_t followed by the output; they
+ * are written to a temporary file and renamed, several processes may share one directory.
+ *
+ * The directory is kept under max_bytes by least recently used eviction: a hit touches the
+ * mtime of its entry, every insert removes the oldest entries while the total is too large.
+ */
+#define GBKCACHE_MAGIC "GBKC"
+#define GBKCACHE_VERSION 1
+#define GBKCACHE_SUFFIX ".utf8"
+#define GBKCACHE_MAX_BYTES (256ULL << 20)
+
+typedef struct gbkcache_header {
+    char magic[4];     /* GBKCACHE_MAGIC */
+    uint32_t version;  /* GBKCACHE_VERSION */
+    uint64_t key;      /* gbkcache_key() of the input */
+    uint64_t in_len;   /* input size */
+    uint64_t out_len;  /* output size, the rest of the file */
+} gbkcache_header_t;
+
+typedef struct gbkcache gbkcache_t;
+
+/*
+ * dir is created if needed, NULL is $XDG_CACHE_HOME/gbk2utf8 or ~/.cache/gbk2utf8.
+ * max_bytes 0 means GBKCACHE_MAX_BYTES.
+ */
+gbkcache_t *gbkcache_open(const char *dir, uint64_t max_bytes);
+void gbkcache_close(gbkcache_t *cache);
+
+/*
+ * One pass over the input, the only work a hit costs besides the copy. filters are the
+ * GBK2UTF8_FILTER_* flags of the output, so filtered output is another entry for the same input.
+ */
+uint64_t gbkcache_key(const uint8_t *data, size_t len, uint32_t filters);
+
+/*
+ * Writes the output cached for key to fd, with copy_file_range() where the kernel can, else
+ * from a mapping of the entry. Returns the bytes written, -1 on a miss or an error.
+ */
+ssize_t gbkcache_get(gbkcache_t *cache, uint64_t key, size_t in_len, int fd);
+int32_t gbkcache_put(gbkcache_t *cache, uint64_t key, size_t in_len, const uint8_t *out, size_t out_len);
+
+/*
+ * gbk2utf8_buf_filter() through the cache: a hit is copied to fd, a miss is converted, stored
+ * and written to fd. Returns the output size, -1 if data is not gbk or on an error.
+ */
+ssize_t gbkcache_convert(gbkcache_t *cache, const uint8_t *data, size_t len, uint32_t filters, int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include "gbk2uni.h"
+#include "gbkcsv.h"
+#include "log.h"
+
+#if defined(__SSE2__) && !defined(GBK2UNI_NO_SIMD)
+#include <emmintrin.h>
+#define GBKCSV_SSE2 1
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(GBK2UNI_NO_SIMD)
+#include <immintrin.h>
+#define GBKCSV_AVX2 1
+#endif
+
+// Columns a list may name one by one, "N-" selects any number beyond.
+#define GBKCSV_MAX_COLUMNS 65536
+#define GBKCSV_BLOCK 64
+
+struct gbkcsv {
+    uint8_t delimiter;
+    uint8_t quote;
+    bool avx2;
+    size_t rest;   /* columns from here on are selected */
+    size_t ncols;  /* columns before rest, selected where select[] is set */
+    uint8_t select[];
+};
+
+// Bit i of each mask stands for byte i of a block.
+typedef struct csv_masks {
+    uint64_t delimiter;
+    uint64_t quote;
+    uint64_t newline;
+    uint64_t high;
+} csv_masks_t;
+
+typedef struct csv_state {
+    const gbkcsv_t *csv;
+    const uint8_t *data;
+    uint8_t *out;
+    size_t outlen;
+    size_t o;
+    size_t done;  /* input up to here is in out */
+    size_t start; /* of the current field */
+    size_t col;
+    bool quoted;
+    bool field_quoted;
+    gbkcsv_stats_t stats;
+} csv_state_t;
+
+/*
+ * One "N", "N-M", "N-" or "-M" of a field list, from 1. *hi is SIZE_MAX for an open range.
+ * Returns the characters taken, 0 if there is no valid range.
+ */
+static size_t parse_range(const char *s, size_t *lo, size_t *hi) {
+    const char *p = s;
+    char *end = NULL;
+
+    *lo = 1;
+    *hi = SIZE_MAX;
+    if (isdigit((uint8_t)*p)) {
+        *lo = strtoul(p, &end, 10);
+        p = end;
+        *hi = *lo;
+    }
+    if (*p == '-') {
+        p++;
+        *hi = SIZE_MAX;
+        if (isdigit((uint8_t)*p)) {
+            *hi = strtoul(p, &end, 10);
+            p = end;
+        }
+    }
+    if ((p == s) || ((p == s + 1) && (*s == '-')) || (*lo == 0) || (*hi < *lo) ||
+        ((*hi != SIZE_MAX) && (*hi > GBKCSV_MAX_COLUMNS)) || (*lo > GBKCSV_MAX_COLUMNS) || ((*p != ',') && (*p != 0))) {
+        return 0;
+    }
+    return p - s;
+}
+
+gbkcsv_t *gbkcsv_create(uint8_t delimiter, uint8_t quote, const char *fields) {
+    gbkcsv_t *csv = NULL;
+    const char *p = fields;
+    size_t n = 0, lo = 0, hi = 0, ncols = 0, rest = SIZE_MAX, i = 0;
+
+    if ((delimiter >= 0x40) || (quote >= 0x40) || (delimiter == quote) || (delimiter == '\n') || (quote == '\n')) {
+        LOGE("Delimiter [0x%02X] and quote [0x%02X] must be distinct ascii below 0x40!", delimiter, quote);
+        return NULL;
+    }
+    if ((fields != NULL) && (*fields == 0)) {
+        LOGE("Empty field list!");
+        return NULL;
+    }
+    // A first pass validates the list and sizes select[].
+    while ((p != NULL) && (*p != 0)) {
+        n = parse_range(p, &lo, &hi);
+        if (n == 0) {
+            LOGE("Invalid field list [%s]!", fields);
+            return NULL;
+        }
+        if (hi == SIZE_MAX) {
+            rest = ((lo - 1 < rest) ? lo - 1 : rest);
+        } else {
+            ncols = ((hi > ncols) ? hi : ncols);
+        }
+        p += n + (p[n] == ',');
+    }
+    if (fields == NULL) {
+        rest = 0;
+    }
+    ncols = ((ncols < rest) ? ncols : rest);
+
+    csv = (gbkcsv_t *)calloc(1, sizeof(gbkcsv_t) + ncols);
+    if (csv == NULL) {
+        LOGE("Failed to malloc size [%zu]!", sizeof(gbkcsv_t) + ncols);
+        return NULL;
+    }
+    csv->delimiter = delimiter;
+    csv->quote = quote;
+    csv->rest = rest;
+    csv->ncols = ncols;
+    for (p = fields; (p != NULL) && (*p != 0); p += n + (p[n] == ',')) {
+        n = parse_range(p, &lo, &hi);
+        for (i = lo - 1; (i < hi) && (i < ncols); i++) {
+            csv->select[i] = 1;
+        }
+    }
+#ifdef GBKCSV_AVX2
+    csv->avx2 = __builtin_cpu_supports("avx2");
+#else
+    csv->avx2 = false;
+#endif
+    return csv;
+}
+
+void gbkcsv_destroy(gbkcsv_t *csv) {
+    free(csv);
+}
+
+static inline bool is_selected(const gbkcsv_t *csv, size_t col) {
+    return ((col < csv->ncols) ? (csv->select[col] != 0) : (col >= csv->rest));
+}
+
+static bool has_high_byte(const uint8_t *data, size_t len) {
+    size_t i = 0;
+    uint64_t w = 0, acc = 0;
+
+    for (; i + 8 <= len; i += 8) {
+        memcpy(&w, data + i, sizeof(w));
+        acc |= w;
+    }
+    for (; i < len; i++) {
+        acc |= data[i];
+    }
+    return ((acc & 0x8080808080808080ULL) != 0);
+}
+
+static void block_masks_scalar(const gbkcsv_t *csv, const uint8_t *p, size_t n, csv_masks_t *m) {
+    size_t i = 0;
+
+    memset(m, 0, sizeof(*m));
+    for (i = 0; i < n; i++) {
+        m->delimiter |= (uint64_t)(p[i] == csv->delimiter) << i;
+        m->quote |= (uint64_t)(p[i] == csv->quote) << i;
+        m->newline |= (uint64_t)(p[i] == '\n') << i;
+        m->high |= (uint64_t)(p[i] >> 7) << i;
+    }
+}
+
+#ifdef GBKCSV_SSE2
+static void block_masks_sse2(const gbkcsv_t *csv, const uint8_t *p, csv_masks_t *m) {
+    const __m128i d = _mm_set1_epi8(csv->delimiter);
+    const __m128i q = _mm_set1_epi8(csv->quote);
+    const __m128i nl = _mm_set1_epi8('\n');
+    __m128i v;
+    uint32_t k = 0;
+
+    memset(m, 0, sizeof(*m));
+    for (k = 0; k < GBKCSV_BLOCK; k += 16) {
+        v = _mm_loadu_si128((const __m128i *)(p + k));
+        m->delimiter |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, d)) << k;
+        m->quote |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, q)) << k;
+        m->newline |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, nl)) << k;
+        m->high |= (uint64_t)(uint32_t)_mm_movemask_epi8(v) << k;
+    }
+}
+#endif
+
+#ifdef GBKCSV_AVX2
+__attribute__((target("avx2"))) static void block_masks_avx2(const gbkcsv_t *csv, const uint8_t *p, csv_masks_t *m) {
+    const __m256i d = _mm256_set1_epi8(csv->delimiter);
+    const __m256i q = _mm256_set1_epi8(csv->quote);
+    const __m256i nl = _mm256_set1_epi8('\n');
+    const __m256i lo = _mm256_loadu_si256((const __m256i *)p);
+    const __m256i hi = _mm256_loadu_si256((const __m256i *)(p + 32));
+
+    m->delimiter = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, d)) |
+                   ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, d)) << 32);
+    m->quote = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, q)) |
+               ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, q)) << 32);
+    m->newline = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, nl)) |
+                 ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, nl)) << 32);
+    m->high = (uint32_t)_mm256_movemask_epi8(lo) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+}
+#endif
+
+static inline void block_masks(const gbkcsv_t *csv, const uint8_t *p, size_t n, csv_masks_t *m) {
+    if (n == GBKCSV_BLOCK) {
+#ifdef GBKCSV_AVX2
+        if (csv->avx2) {
+            block_masks_avx2(csv, p, m);
+            return;
+        }
+#endif
+#ifdef GBKCSV_SSE2
+        block_masks_sse2(csv, p, m);
+        return;
+#endif
+    }
+    block_masks_scalar(csv, p, n, m);
+}
+
+/*
+ * Ends the field [st->start, end). A selected field with a high byte is converted, after the
+ * bytes pending since the last conversion are copied; other fields stay pending.
+ */
+static int32_t field_end(csv_state_t *st, size_t end) {
+    size_t n = st->start - st->done;
+    ssize_t ret = 0;
+
+    st->stats.fields++;
+    if (!is_selected(st->csv, st->col) || !has_high_byte(st->data + st->start, end - st->start)) {
+        return 0;
+    }
+    if (st->o + n > st->outlen) {
+        return -1;
+    }
+    memcpy(st->out + st->o, st->data + st->done, n);
+    st->o += n;
+    st->stats.copied_bytes += n;
+    ret = gbk2utf8_buf(st->data + st->start, end - st->start, st->out + st->o, st->outlen - st->o);
+    if (ret < 0) {
+        LOGE("Failed to convert row [%llu] column [%zu]!", (unsigned long long)st->stats.rows + 1, st->col + 1);
+        return -1;
+    }
+    st->o += ret;
+    st->done = end;
+    st->stats.converted++;
+    return 0;
+}
+
+// A delimiter, quote or newline at p.
+static int32_t field_event(csv_state_t *st, size_t p) {
+    uint8_t c = st->data[p];
+
+    if (c == st->csv->quote) {
+        if (p == st->start) {
+            st->field_quoted = st->quoted = true;
+        } else if (st->field_quoted) {
+            st->quoted = !st->quoted;
+        }
+        return 0;
+    }
+    if (st->quoted) {
+        return 0;
+    }
+    if (field_end(st, p) != 0) {
+        return -1;
+    }
+    if (c == '\n') {
+        st->stats.rows++;
+        st->col = 0;
+    } else {
+        st->col++;
+    }
+    st->start = p + 1;
+    st->field_quoted = false;
+    return 0;
+}
+
+/*
+ * Blocks are scanned for the delimiter, the quote, newlines and high bytes at once. A block
+ * without quotes or high bytes, outside a quoted field, needs only its first boundary
+ * handled, for the field reaching into it; the fields after it are ascii and unquoted, their
+ * boundaries are only counted.
+ */
+ssize_t gbkcsv_convert(const gbkcsv_t *csv, const uint8_t *data, size_t len, uint8_t *out, size_t outlen,
+                       gbkcsv_stats_t *stats) {
+    csv_state_t st;
+    csv_masks_t m;
+    size_t base = 0, n = 0, last = 0;
+    uint64_t events = 0, rest = 0, newlines = 0;
+
+    if ((NULL == csv) || (NULL == data) || (NULL == out)) {
+        return -1;
+    }
+    memset(&st, 0, sizeof(st));
+    st.csv = csv;
+    st.data = data;
+    st.out = out;
+    st.outlen = outlen;
+
+    for (base = 0; base < len; base += GBKCSV_BLOCK) {
+        n = (((len - base) < GBKCSV_BLOCK) ? (len - base) : GBKCSV_BLOCK);
+        block_masks(csv, data + base, n, &m);
+        events = m.delimiter | m.quote | m.newline;
+        if (events == 0) {
+            continue;
+        }
+        if (((m.quote | m.high) == 0) && !st.quoted) {
+            if (field_event(&st, base + __builtin_ctzll(events)) != 0) {
+                return -1;
+            }
+            rest = events & (events - 1);
+            if (rest == 0) {
+                continue;
+            }
+            newlines = m.newline & rest;
+            if (newlines != 0) {
+                last = 63 - __builtin_clzll(newlines);
+                st.stats.rows += __builtin_popcountll(newlines);
+                st.col = ((last < 63) ? __builtin_popcountll(m.delimiter & (~0ULL << (last + 1))) : 0);
+            } else {
+                st.col += __builtin_popcountll(rest);
+            }
+            st.stats.fields += __builtin_popcountll(rest);
+            st.start = base + (63 - __builtin_clzll(rest)) + 1;
+            continue;
+        }
+        while (events != 0) {
+            if (field_event(&st, base + __builtin_ctzll(events)) != 0) {
+                return -1;
+            }
+            events &= events - 1;
+        }
+    }
+    // A last record without a newline.
+    if ((st.start < len) || (st.col > 0)) {
+        if (field_end(&st, len) != 0) {
+            return -1;
+        }
+        st.stats.rows++;
+    }
+
+    n = len - st.done;
+    if (st.o + n > outlen) {
+        return -1;
+    }
+    memcpy(out + st.o, data + st.done, n);
+    st.o += n;
+    st.stats.copied_bytes += n;
+    LOGD("Csv rows [%llu] fields [%llu] converted [%llu] copied [%llu]", (unsigned long long)st.stats.rows,
+         (unsigned long long)st.stats.fields, (unsigned long long)st.stats.converted,
+         (unsigned long long)st.stats.copied_bytes);
+
+    if (stats != NULL) {
+        stats->rows += st.stats.rows;
+        stats->fields += st.stats.fields;
+        stats->converted += st.stats.converted;
+        stats->copied_bytes += st.stats.copied_bytes;
+    }
+    return st.o;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKCSV_H__
+#define __GBKCSV_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Conversion of delimited records where only some columns hold gbk. Field boundaries are
+ * found by scanning for the delimiter, the quote and newlines a vector at a time; a selected
+ * field is converted only if it has a high byte, everything else is copied as is, so runs of
+ * rows needing nothing go out in one memcpy.
+ *
+ * A field starting with the quote is quoted up to the next single quote, "" inside it is a
+ * literal quote, delimiters and newlines inside it belong to it. A quote anywhere else is a
+ * literal byte. Records end at "\n", a "\r" before it stays with the last field.
+ *
+ * The delimiter and the quote must be ascii below 0x40, under the lowest gbk trail byte, so
+ * they never occur inside a gbk code and the scan needs no gbk parse: ',' '\t' ';' ':' are
+ * fine, '|' is not.
+ */
+#define GBKCSV_DELIMITER ','
+#define GBKCSV_QUOTE '"'
+
+typedef struct gbkcsv_stats {
+    uint64_t rows;
+    uint64_t fields;
+    uint64_t converted;    /* selected fields with a high byte */
+    uint64_t copied_bytes; /* input bytes copied without conversion */
+} gbkcsv_stats_t;
+
+typedef struct gbkcsv gbkcsv_t;
+
+/*
+ * fields lists the columns to convert like cut -f, from 1: "2,5-7,9-". NULL converts every
+ * column. Returns NULL on a bad list, delimiter or quote.
+ */
+gbkcsv_t *gbkcsv_create(uint8_t delimiter, uint8_t quote, const char *fields);
+void gbkcsv_destroy(gbkcsv_t *csv);
+
+/*
+ * Converts data into out, which needs GBK2UTF8_MAX_LEN(len) bytes in the worst case. stats may
+ * be NULL, its counters are added to. Returns the output length, -1 if a selected field is not
+ * gbk or out is too small.
+ */
+ssize_t gbkcsv_convert(const gbkcsv_t *csv, const uint8_t *data, size_t len, uint8_t *out, size_t outlen,
+                       gbkcsv_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
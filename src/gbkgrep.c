@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include "gbk2uni.h"
+#include "gbkgrep.h"
+#include "log.h"
+#include "uni2gbk_tab.h"
+
+#if defined(__SSE2__) && !defined(GBK2UNI_NO_SIMD)
+#include <emmintrin.h>
+#define GBKGREP_SSE2 1
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(GBK2UNI_NO_SIMD)
+#include <immintrin.h>
+#define GBKGREP_AVX2 1
+#endif
+
+struct gbkgrep {
+    bool avx2;
+    size_t len;
+    uint8_t needle[];
+};
+
+/*
+ * One utf8 character of at most three bytes, a gbk code has no character beyond the BMP.
+ * Returns the bytes taken, 0 if it is not utf8.
+ */
+static size_t utf8_decode(const uint8_t *data, size_t len, uint32_t *cp) {
+    if (data[0] < 0x80) {
+        *cp = data[0];
+        return 1;
+    }
+    if (((data[0] & 0xE0) == 0xC0) && (len >= 2) && ((data[1] & 0xC0) == 0x80)) {
+        *cp = ((data[0] & 0x1F) << 6) | (data[1] & 0x3F);
+        return ((*cp >= 0x80) ? 2 : 0);
+    }
+    if (((data[0] & 0xF0) == 0xE0) && (len >= 3) && ((data[1] & 0xC0) == 0x80) && ((data[2] & 0xC0) == 0x80)) {
+        *cp = ((data[0] & 0x0F) << 12) | ((data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+        return (((*cp >= 0x800) && ((*cp < 0xD800) || (*cp > 0xDFFF))) ? 3 : 0);
+    }
+    return 0;
+}
+
+gbkgrep_t *gbkgrep_create(const uint8_t *needle, size_t len) {
+    gbkgrep_t *grep = NULL;
+    size_t i = 0, n = 0;
+    uint32_t cp = 0;
+    uint16_t code = 0;
+    char pair[2] = {0};
+
+    if ((NULL == needle) || (len == 0)) {
+        return NULL;
+    }
+    // No character is longer in gbk than in utf8.
+    grep = (gbkgrep_t *)malloc(sizeof(gbkgrep_t) + len);
+    if (grep == NULL) {
+        LOGE("Failed to malloc size [%zu]!", sizeof(gbkgrep_t) + len);
+        return NULL;
+    }
+    grep->len = 0;
+    while (i < len) {
+        n = utf8_decode(needle + i, len - i, &cp);
+        if (n == 0) {
+            LOGE("Needle is not utf8 at [%zu]!", i);
+            goto __oops;
+        }
+        i += n;
+        if (cp < 0x80) {
+            grep->needle[grep->len++] = cp;
+            continue;
+        }
+        code = UNI2GBK_TABLE[UNI2GBK_TABLE_INDEX(cp)];
+        pair[0] = code >> 8;
+        pair[1] = code & 0xFF;
+        if ((code == 0) || (gbk2uni(pair) != cp)) {
+            LOGE("No gbk code for U+%04X in the needle!", cp);
+            goto __oops;
+        }
+        grep->needle[grep->len++] = pair[0];
+        grep->needle[grep->len++] = pair[1];
+    }
+#ifdef GBKGREP_AVX2
+    grep->avx2 = __builtin_cpu_supports("avx2");
+#else
+    grep->avx2 = false;
+#endif
+    return grep;
+
+__oops:
+    free(grep);
+    return NULL;
+}
+
+void gbkgrep_destroy(gbkgrep_t *grep) {
+    free(grep);
+}
+
+const uint8_t *gbkgrep_needle(const gbkgrep_t *grep, size_t *len) {
+    *len = grep->len;
+    return grep->needle;
+}
+
+static size_t find_raw_scalar(const uint8_t *needle, size_t n, const uint8_t *data, size_t i, size_t len) {
+    const uint8_t *p = NULL;
+
+    while (i + n <= len) {
+        p = (const uint8_t *)memchr(data + i, needle[0], len - n + 1 - i);
+        if (p == NULL) {
+            break;
+        }
+        i = p - data;
+        if (memcmp(p + 1, needle + 1, n - 1) == 0) {
+            return i;
+        }
+        i++;
+    }
+    return len;
+}
+
+/*
+ * Candidates are the positions where both the first and the last needle byte match, one
+ * compare each for a whole vector; only those get a memcmp of the bytes between.
+ */
+#ifdef GBKGREP_SSE2
+static size_t find_raw_sse2(const uint8_t *needle, size_t n, const uint8_t *data, size_t i, size_t len) {
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[n - 1]);
+    __m128i a, b;
+    uint32_t mask = 0, bit = 0;
+
+    while (i + n - 1 + 16 <= len) {
+        a = _mm_loadu_si128((const __m128i *)(data + i));
+        b = _mm_loadu_si128((const __m128i *)(data + i + n - 1));
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            bit = __builtin_ctz(mask);
+            if (memcmp(data + i + bit + 1, needle + 1, n - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+        i += 16;
+    }
+    return find_raw_scalar(needle, n, data, i, len);
+}
+#endif
+
+#ifdef GBKGREP_AVX2
+__attribute__((target("avx2"))) static size_t find_raw_avx2(const uint8_t *needle, size_t n, const uint8_t *data,
+                                                            size_t i, size_t len) {
+    const __m256i first = _mm256_set1_epi8(needle[0]);
+    const __m256i last = _mm256_set1_epi8(needle[n - 1]);
+    __m256i a, b;
+    uint32_t mask = 0, bit = 0;
+
+    while (i + n - 1 + 32 <= len) {
+        a = _mm256_loadu_si256((const __m256i *)(data + i));
+        b = _mm256_loadu_si256((const __m256i *)(data + i + n - 1));
+        mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last)));
+        while (mask != 0) {
+            bit = __builtin_ctz(mask);
+            if (memcmp(data + i + bit + 1, needle + 1, n - 2) == 0) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+        i += 32;
+    }
+    return find_raw_scalar(needle, n, data, i, len);
+}
+#endif
+
+// Next occurrence of the needle bytes at or after i, len if there is none. memchr does one byte needles.
+static size_t find_raw(const gbkgrep_t *grep, const uint8_t *data, size_t i, size_t len) {
+    if (grep->len >= 2) {
+#ifdef GBKGREP_AVX2
+        if (grep->avx2) {
+            return find_raw_avx2(grep->needle, grep->len, data, i, len);
+        }
+#endif
+#ifdef GBKGREP_SSE2
+        return find_raw_sse2(grep->needle, grep->len, data, i, len);
+#endif
+    }
+    return find_raw_scalar(grep->needle, grep->len, data, i, len);
+}
+
+/*
+ * A hit is checked with gbk_char_start() from the last character start found, so over a whole
+ * search every byte is parsed at most twice.
+ */
+ssize_t gbkgrep_find(const gbkgrep_t *grep, const uint8_t *data, size_t len, size_t from) {
+    size_t i = from, sync = from;
+
+    if ((NULL == grep) || (NULL == data)) {
+        return -1;
+    }
+    while ((i = find_raw(grep, data, i, len)) < len) {
+        sync = gbk_char_start(data, len, sync, i);
+        if (sync == i) {
+            return i;
+        }
+        i++;
+    }
+    return -1;
+}
+
+/*
+ * The utf8 offset is counted on between matches only, from the end of one to the start of the
+ * next, and the matched bytes are counted once for the needle.
+ */
+size_t gbkgrep_search(const gbkgrep_t *grep, const uint8_t *data, size_t len, gbkgrep_fn fn, void *ctx) {
+    size_t i = 0, done = 0, count = 0, needle_utf8 = 0;
+    ssize_t pos = 0;
+    gbkgrep_match_t match = {0, 0};
+
+    if ((NULL == grep) || (NULL == data)) {
+        return 0;
+    }
+    needle_utf8 = gbk2utf8_len(grep->needle, grep->len);
+    while ((pos = gbkgrep_find(grep, data, len, i)) >= 0) {
+        match.utf8_off += gbk2utf8_len(data + done, pos - done);
+        match.gbk_off = pos;
+        count++;
+        if ((fn != NULL) && (fn(ctx, &match) != 0)) {
+            break;
+        }
+        match.utf8_off += needle_utf8;
+        i = done = pos + grep->len;
+    }
+    return count;
+}
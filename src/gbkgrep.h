@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKGREP_H__
+#define __GBKGREP_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Substring search in gbk text for a utf8 needle, without converting the text. The needle is
+ * encoded to gbk once, the raw bytes are scanned for it and a hit is kept only if it starts on
+ * a character: "\xCE\xD2" also occurs across two codes as the trail of one and the lead of the
+ * next. Matches do not overlap.
+ */
+typedef struct gbkgrep gbkgrep_t;
+
+typedef struct gbkgrep_match {
+    size_t gbk_off;  /* offset in the gbk input */
+    size_t utf8_off; /* offset in the gbk2utf8() output, bytes it fails on count as none */
+} gbkgrep_match_t;
+
+// Called for every match in order, a non-zero return stops the search.
+typedef int32_t (*gbkgrep_fn)(void *ctx, const gbkgrep_match_t *match);
+
+/*
+ * Encodes a utf8 needle through the builtin inverse table. Returns NULL if it is empty, not
+ * utf8, or has a character without a gbk code, also one the table in use maps elsewhere.
+ */
+gbkgrep_t *gbkgrep_create(const uint8_t *needle, size_t len);
+void gbkgrep_destroy(gbkgrep_t *grep);
+
+// The gbk form of the needle.
+const uint8_t *gbkgrep_needle(const gbkgrep_t *grep, size_t *len);
+
+// Offset of the first match at or after from, which must start a character, -1 if there is none.
+ssize_t gbkgrep_find(const gbkgrep_t *grep, const uint8_t *data, size_t len, size_t from);
+
+// Reports every match to fn, which may be NULL, and returns how many were reported.
+size_t gbkgrep_search(const gbkgrep_t *grep, const uint8_t *data, size_t len, gbkgrep_fn fn, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
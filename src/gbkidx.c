@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "gbk2uni.h"
+#include "gbkidx.h"
+#include "log.h"
+
+struct gbkidx {
+    gbkidx_header_t head;
+    gbkidx_entry_t *entries;
+};
+
+/*
+ * The share of one build thread, entries [first, last). If no code spans the first byte of
+ * the share, the parse from that byte is the right one, otherwise the parse from the next
+ * byte is. Parse s fills rel[s], with utf8 offsets relative to where it started, and ends at
+ * end[s], the first character start at or after the share, with utf8[s] bytes counted.
+ */
+typedef struct gbkidx_part {
+    const uint8_t *data;
+    size_t len;
+    uint32_t interval;
+    size_t first;
+    size_t last;
+    uint32_t parses; /* 1 for the share starting at 0, else 2 */
+    gbkidx_entry_t *rel[2];
+    size_t end[2];
+    uint64_t utf8[2];
+    pthread_t tid;
+    bool joinable;
+} gbkidx_part_t;
+
+static inline size_t max_size(size_t a, size_t b) {
+    return ((a > b) ? a : b);
+}
+
+/*
+ * Both parses are in step from the first ascii byte on, see gbk_char_start(). Parse 1 stops
+ * at the first entry it shares with parse 0 and copies the rest, its utf8 offsets differ from
+ * there on by a constant, added modulo 2^64 as it may be negative.
+ */
+static void gbkidx_parse(gbkidx_part_t *part, uint32_t s) {
+    const uint8_t *data = part->data;
+    const gbkidx_entry_t *rel0 = part->rel[0];
+    gbkidx_entry_t *rel = part->rel[s];
+    size_t k = 0, n = part->last - part->first;
+    size_t b = part->first * part->interval + s, e = 0;
+    size_t stop = ((part->last * part->interval < part->len) ? (part->last * part->interval) : part->len);
+    uint64_t u = 0, delta = 0;
+
+    for (k = 0; k < n; k++) {
+        e = gbk_char_start(data, part->len, b, max_size(b, (part->first + k) * part->interval));
+        u += gbk2utf8_len(data + b, e - b);
+        b = e;
+        rel[k].gbk_off = e;
+        rel[k].utf8_off = u;
+        if ((s == 1) && (e == rel0[k].gbk_off)) {
+            delta = u - rel0[k].utf8_off;
+            for (k++; k < n; k++) {
+                rel[k].gbk_off = rel0[k].gbk_off;
+                rel[k].utf8_off = rel0[k].utf8_off + delta;
+            }
+            part->end[1] = part->end[0];
+            part->utf8[1] = part->utf8[0] + delta;
+            return;
+        }
+    }
+    e = gbk_char_start(data, part->len, b, max_size(b, stop));
+    part->end[s] = e;
+    part->utf8[s] = u + gbk2utf8_len(data + b, e - b);
+}
+
+static void *gbkidx_worker(void *arg) {
+    gbkidx_part_t *part = (gbkidx_part_t *)arg;
+
+    gbkidx_parse(part, 0);
+    if (part->parses > 1) {
+        gbkidx_parse(part, 1);
+    }
+    return NULL;
+}
+
+/*
+ * Shares are parsed in parallel and stitched in order: the end of one share tells which parse
+ * of the next is right, the offsets of that parse are moved by the utf8 counted so far.
+ */
+gbkidx_t *gbkidx_build(const uint8_t *data, size_t len, uint32_t interval, uint32_t threads) {
+    gbkidx_t *idx = NULL;
+    gbkidx_part_t *parts = NULL;
+    gbkidx_entry_t *rel = NULL;
+    size_t i = 0, k = 0, count = 0, per = 0, nparts = 0, gbk = 0;
+    uint64_t utf8 = 0;
+    uint32_t s = 0;
+    long cpus = 0;
+
+    if ((NULL == data) && (len > 0)) {
+        return NULL;
+    }
+    interval = ((interval != 0) ? interval : GBKIDX_INTERVAL);
+    count = ((len > 0) ? ((len - 1) / interval + 1) : 1);
+    if (threads == 0) {
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = ((cpus > 0) ? cpus : 1);
+    }
+    per = (count + threads - 1) / threads;
+    nparts = (count + per - 1) / per;
+
+    idx = (gbkidx_t *)calloc(1, sizeof(gbkidx_t));
+    parts = (gbkidx_part_t *)calloc(nparts, sizeof(gbkidx_part_t));
+    rel = (gbkidx_entry_t *)malloc(2 * count * sizeof(gbkidx_entry_t));
+    if ((idx == NULL) || (parts == NULL) || (rel == NULL) ||
+        ((idx->entries = (gbkidx_entry_t *)malloc(count * sizeof(gbkidx_entry_t))) == NULL)) {
+        LOGE("Failed to malloc an index of [%zu] entries!", count);
+        gbkidx_free(idx);
+        idx = NULL;
+        goto __oops;
+    }
+
+    for (i = 0; i < nparts; i++) {
+        parts[i].data = data;
+        parts[i].len = len;
+        parts[i].interval = interval;
+        parts[i].first = i * per;
+        parts[i].last = (((i + 1) * per < count) ? ((i + 1) * per) : count);
+        parts[i].parses = ((i == 0) ? 1 : 2);
+        parts[i].rel[0] = rel + parts[i].first;
+        parts[i].rel[1] = rel + count + parts[i].first;
+    }
+    // Share 0 is parsed by the calling thread, a share whose thread fails to start as well.
+    for (i = 1; i < nparts; i++) {
+        parts[i].joinable = (pthread_create(&parts[i].tid, NULL, gbkidx_worker, &parts[i]) == 0);
+        if (!parts[i].joinable) {
+            gbkidx_worker(&parts[i]);
+        }
+    }
+    gbkidx_worker(&parts[0]);
+    for (i = 1; i < nparts; i++) {
+        if (parts[i].joinable) {
+            pthread_join(parts[i].tid, NULL);
+        }
+    }
+
+    for (i = 0; i < nparts; i++) {
+        s = gbk - parts[i].first * interval;
+        for (k = 0; k < parts[i].last - parts[i].first; k++) {
+            idx->entries[parts[i].first + k].gbk_off = parts[i].rel[s][k].gbk_off;
+            idx->entries[parts[i].first + k].utf8_off = utf8 + parts[i].rel[s][k].utf8_off;
+        }
+        gbk = parts[i].end[s];
+        utf8 += parts[i].utf8[s];
+    }
+
+    memcpy(idx->head.magic, GBKIDX_MAGIC, sizeof(idx->head.magic));
+    idx->head.bom = GBKIDX_BOM;
+    idx->head.version = GBKIDX_VERSION;
+    idx->head.header = sizeof(gbkidx_header_t);
+    idx->head.interval = interval;
+    idx->head.count = count;
+    idx->head.gbk_len = len;
+    idx->head.utf8_len = utf8;
+    LOGD("Index [%zu] bytes, [%zu] entries, [%zu] threads", len, count, nparts);
+
+__oops:
+    free(rel);
+    free(parts);
+    return idx;
+}
+
+void gbkidx_free(gbkidx_t *idx) {
+    if (idx != NULL) {
+        free(idx->entries);
+        free(idx);
+    }
+}
+
+const gbkidx_header_t *gbkidx_header(const gbkidx_t *idx) {
+    return &idx->head;
+}
+
+const gbkidx_entry_t *gbkidx_entries(const gbkidx_t *idx) {
+    return idx->entries;
+}
+
+static char *gbkidx_path(const char *file, const char *suffix) {
+    size_t len = strlen(file);
+    char *path = (char *)malloc(len + strlen(suffix) + 1);
+
+    if (path != NULL) {
+        memcpy(path, file, len);
+        strcpy(path + len, suffix);
+    }
+    return path;
+}
+
+static int64_t mtime_ns(const struct stat *st) {
+    return (int64_t)st->st_mtim.tv_sec * 1000000000LL + st->st_mtim.tv_nsec;
+}
+
+/*
+ * Written to a unique temporary file first, a reader never sees a partial index and builders
+ * racing on the same file each rename a whole one.
+ */
+int32_t gbkidx_save(const gbkidx_t *idx, const char *file) {
+    int32_t ret = -1;
+    int fd = -1;
+    struct stat st;
+    gbkidx_header_t head;
+    char *path = NULL, *tmp = NULL;
+    FILE *fp = NULL;
+
+    if ((idx == NULL) || (file == NULL)) {
+        return -1;
+    }
+    if ((stat(file, &st) != 0) || ((uint64_t)st.st_size != idx->head.gbk_len)) {
+        LOGE("Index does not fit [%s]!", file);
+        return -1;
+    }
+    head = idx->head;
+    head.mtime_ns = mtime_ns(&st);
+
+    path = gbkidx_path(file, GBKIDX_SUFFIX);
+    tmp = gbkidx_path(file, GBKIDX_SUFFIX ".tmp.XXXXXX");
+    if ((path == NULL) || (tmp == NULL)) {
+        goto __oops;
+    }
+    fd = mkstemp(tmp);
+    if (fd < 0) {
+        LOGE("Failed to create [%s]!", tmp);
+        free(tmp);
+        tmp = NULL;
+        goto __oops;
+    }
+    // mkstemp() creates it 0600, the index is as readable as an index written by fopen().
+    fchmod(fd, 0644);
+    fp = fdopen(fd, "wb");
+    if (fp == NULL) {
+        LOGE("Failed to open file [%s]", tmp);
+        close(fd);
+        goto __oops;
+    }
+    if ((fwrite(&head, sizeof(head), 1, fp) != 1) ||
+        (fwrite(idx->entries, sizeof(gbkidx_entry_t), head.count, fp) != head.count)) {
+        LOGE("Failed to write index [%s]!", tmp);
+        goto __oops;
+    }
+    if (fclose(fp) != 0) {
+        fp = NULL;
+        LOGE("Failed to write index [%s]!", tmp);
+        goto __oops;
+    }
+    fp = NULL;
+    if (rename(tmp, path) != 0) {
+        LOGE("Failed to rename [%s] to [%s]!", tmp, path);
+        goto __oops;
+    }
+    LOGD("Save index [%s], [%llu] entries", path, (unsigned long long)head.count);
+    ret = 0;
+
+__oops:
+    if (fp != NULL) {
+        fclose(fp);
+    }
+    if ((ret != 0) && (tmp != NULL)) {
+        unlink(tmp);
+    }
+    free(tmp);
+    free(path);
+    return ret;
+}
+
+gbkidx_t *gbkidx_load(const char *file) {
+    struct stat st, ist;
+    gbkidx_t *idx = NULL;
+    gbkidx_header_t head;
+    char *path = NULL;
+    FILE *fp = NULL;
+
+    if ((file == NULL) || (stat(file, &st) != 0) || ((path = gbkidx_path(file, GBKIDX_SUFFIX)) == NULL)) {
+        return NULL;
+    }
+    fp = fopen(path, "rb");
+    if (fp == NULL) {
+        LOGD("No index [%s]", path);
+        goto __oops;
+    }
+    if ((fstat(fileno(fp), &ist) != 0) || (fread(&head, sizeof(head), 1, fp) != 1) ||
+        (memcmp(head.magic, GBKIDX_MAGIC, sizeof(head.magic)) != 0) || (head.bom != GBKIDX_BOM) ||
+        (head.version != GBKIDX_VERSION) || (head.header != sizeof(gbkidx_header_t)) || (head.interval == 0) ||
+        ((uint64_t)ist.st_size != head.header + head.count * sizeof(gbkidx_entry_t))) {
+        LOGE("Invalid index [%s]!", path);
+        goto __oops;
+    }
+    if ((head.gbk_len != (uint64_t)st.st_size) || (head.mtime_ns != mtime_ns(&st)) ||
+        (head.count != ((head.gbk_len > 0) ? ((head.gbk_len - 1) / head.interval + 1) : 1))) {
+        LOGD("Stale index [%s]", path);
+        goto __oops;
+    }
+
+    idx = (gbkidx_t *)calloc(1, sizeof(gbkidx_t));
+    if ((idx == NULL) || ((idx->entries = (gbkidx_entry_t *)malloc(head.count * sizeof(gbkidx_entry_t))) == NULL) ||
+        (fread(idx->entries, sizeof(gbkidx_entry_t), head.count, fp) != head.count)) {
+        LOGE("Failed to read index [%s]!", path);
+        gbkidx_free(idx);
+        idx = NULL;
+        goto __oops;
+    }
+    idx->head = head;
+    LOGD("Load index [%s], [%llu] entries", path, (unsigned long long)head.count);
+
+__oops:
+    if (fp != NULL) {
+        fclose(fp);
+    }
+    free(path);
+    return idx;
+}
+
+static bool gbkidx_fits(const gbkidx_t *idx, const uint8_t *data, size_t len) {
+    return ((idx != NULL) && ((data != NULL) || (len == 0)) && (idx->head.gbk_len == len));
+}
+
+int32_t gbkidx_locate(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t gbk_off, gbkidx_entry_t *pos) {
+    const gbkidx_entry_t *entry = NULL;
+
+    if (!gbkidx_fits(idx, data, len) || (pos == NULL)) {
+        return -1;
+    }
+    if (gbk_off >= len) {
+        pos->gbk_off = len;
+        pos->utf8_off = idx->head.utf8_len;
+        return 0;
+    }
+    // Entry k is at k * interval or one byte after it.
+    entry = &idx->entries[gbk_off / idx->head.interval];
+    if (entry->gbk_off > gbk_off) {
+        entry--;
+    }
+    pos->gbk_off = gbk_char_start(data, len, entry->gbk_off, gbk_off);
+    pos->utf8_off = entry->utf8_off + gbk2utf8_len(data + entry->gbk_off, pos->gbk_off - entry->gbk_off);
+    return 0;
+}
+
+int32_t gbkidx_locate_utf8(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t utf8_off,
+                           gbkidx_entry_t *pos) {
+    size_t lo = 0, hi = 0, mid = 0, b = 0, e = 0;
+    uint64_t u = 0, n = 0;
+
+    if (!gbkidx_fits(idx, data, len) || (pos == NULL)) {
+        return -1;
+    }
+    if (utf8_off >= idx->head.utf8_len) {
+        pos->gbk_off = len;
+        pos->utf8_off = idx->head.utf8_len;
+        return 0;
+    }
+    // The last entry at or before utf8_off, then one character at a time.
+    lo = 0;
+    hi = idx->head.count;
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (idx->entries[mid].utf8_off <= utf8_off) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    b = idx->entries[lo].gbk_off;
+    u = idx->entries[lo].utf8_off;
+    while (b < len) {
+        e = gbk_char_start(data, len, b, b + 1);
+        n = gbk2utf8_len(data + b, e - b);
+        if (u + n > utf8_off) {
+            break;
+        }
+        u += n;
+        b = e;
+    }
+    pos->gbk_off = b;
+    pos->utf8_off = u;
+    return 0;
+}
+
+ssize_t gbkidx_convert(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t from, uint64_t to,
+                       uint8_t *out, size_t outlen, gbkidx_entry_t *pos) {
+    gbkidx_entry_t beg;
+    size_t end = 0;
+
+    if ((out == NULL) || (gbkidx_locate(idx, data, len, from, &beg) != 0)) {
+        return -1;
+    }
+    to = ((to < len) ? to : len);
+    end = gbk_char_start(data, len, beg.gbk_off, max_size(beg.gbk_off, to));
+    if (pos != NULL) {
+        *pos = beg;
+    }
+    return gbk2utf8_buf(data + beg.gbk_off, end - beg.gbk_off, out, outlen);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKIDX_H__
+#define __GBKIDX_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Sparse checkpoint index for random access into a large gbk file. Entry k is the first
+ * character start at or after k * interval with the size of the utf8 before it, as counted by
+ * gbk2utf8_len(). Any range then converts from the nearest entry, parsing at most one
+ * interval ahead of it.
+ *
+ * The index is saved next to the file as <file>GBKIDX_SUFFIX: a fixed header followed by the
+ * entries, in host byte order like gbktab.h. The size and mtime of the file it was built from
+ * are kept to detect a stale index.
+ */
+#define GBKIDX_MAGIC "GBKI"
+#define GBKIDX_VERSION 1
+#define GBKIDX_BOM 0x01020304
+#define GBKIDX_SUFFIX ".gbkidx"
+#define GBKIDX_INTERVAL (1 << 20)
+
+typedef struct gbkidx_entry {
+    uint64_t gbk_off;
+    uint64_t utf8_off;
+} gbkidx_entry_t;
+
+typedef struct gbkidx_header {
+    char magic[4];     /* GBKIDX_MAGIC */
+    uint32_t bom;      /* GBKIDX_BOM */
+    uint16_t version;  /* GBKIDX_VERSION */
+    uint16_t header;   /* sizeof(gbkidx_header_t), entries start here */
+    uint32_t interval; /* gbk bytes between entries */
+    uint64_t count;    /* number of entries */
+    uint64_t gbk_len;  /* size of the indexed file */
+    uint64_t utf8_len; /* gbk2utf8_len() of the whole file */
+    int64_t mtime_ns;  /* mtime of the indexed file, set by gbkidx_save() */
+} gbkidx_header_t;
+
+typedef struct gbkidx gbkidx_t;
+
+/*
+ * One pass over data split between threads, 0 for one per online cpu. Each thread parses its
+ * share from both possible character starts until the two parses meet, so no thread waits
+ * for the one before it. interval 0 means GBKIDX_INTERVAL.
+ */
+gbkidx_t *gbkidx_build(const uint8_t *data, size_t len, uint32_t interval, uint32_t threads);
+// Writes <file>GBKIDX_SUFFIX, file is the path of the indexed file.
+int32_t gbkidx_save(const gbkidx_t *idx, const char *file);
+// Reads <file>GBKIDX_SUFFIX, NULL if it is missing, invalid or older than file.
+gbkidx_t *gbkidx_load(const char *file);
+void gbkidx_free(gbkidx_t *idx);
+
+const gbkidx_header_t *gbkidx_header(const gbkidx_t *idx);
+const gbkidx_entry_t *gbkidx_entries(const gbkidx_t *idx);
+
+/*
+ * data is the indexed file, len its size. gbkidx_locate() finds the first character start at
+ * or after gbk_off, gbkidx_locate_utf8() the character whose utf8 covers utf8_off. Both fill
+ * *pos with its offsets and return -1 if data does not fit the index.
+ */
+int32_t gbkidx_locate(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t gbk_off, gbkidx_entry_t *pos);
+int32_t gbkidx_locate_utf8(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t utf8_off,
+                           gbkidx_entry_t *pos);
+
+/*
+ * Converts the characters starting in [from, to) with gbk2utf8_buf(), out needs
+ * GBK2UTF8_MAX_LEN(to - from + 1) bytes. pos may be NULL, otherwise it gets where the output
+ * starts. Returns the output length, or -1.
+ */
+ssize_t gbkidx_convert(const gbkidx_t *idx, const uint8_t *data, size_t len, uint64_t from, uint64_t to,
+                       uint8_t *out, size_t outlen, gbkidx_entry_t *pos);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
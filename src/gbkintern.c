@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include <pthread.h>
+
+#include "gbk2uni.h"
+#include "gbkalloc.h"
+#include "gbkhash.h"
+#include "gbkintern.h"
+#include "log.h"
+
+// Buckets per shard, one for every this many bytes of its budget.
+#define GBKINTERN_BUCKET_BYTES 128
+
+/*
+ * gbk bytes followed by their utf8. An entry is in the chain of its bucket and in the lru
+ * list of its shard, the most recently used first.
+ */
+typedef struct gbkintern_entry {
+    struct gbkintern_entry *chain;
+    struct gbkintern_entry *newer;
+    struct gbkintern_entry *older;
+    uint64_t hash;
+    uint16_t gbk_len;
+    uint16_t utf8_len;
+    uint8_t bytes[];
+} gbkintern_entry_t;
+
+// Aligned to a cache line, the lock of one shard does not share a line with its neighbour.
+typedef struct gbkintern_shard {
+    pthread_mutex_t lock;
+    gbk_pool_t *pool;
+    gbkintern_entry_t **buckets;
+    size_t mask;
+    gbkintern_entry_t lru; /* sentinel, lru.older is the newest entry */
+    size_t max_bytes;
+    gbkintern_stats_t stats;
+} __attribute__((aligned(64))) gbkintern_shard_t;
+
+struct gbkintern {
+    uint32_t nshards;
+    gbkintern_shard_t *shards;
+    uint64_t bypassed; /* atomic, a bypass takes no lock */
+};
+
+// The pool block of the entry, what it really costs, not just what it holds.
+static inline size_t entry_size(const gbkintern_entry_t *e) {
+    return gbk_pool_block_size(sizeof(gbkintern_entry_t) + e->gbk_len + e->utf8_len);
+}
+
+static void lru_unlink(gbkintern_entry_t *e) {
+    e->newer->older = e->older;
+    e->older->newer = e->newer;
+}
+
+static void lru_push(gbkintern_shard_t *shard, gbkintern_entry_t *e) {
+    e->newer = &shard->lru;
+    e->older = shard->lru.older;
+    shard->lru.older->newer = e;
+    shard->lru.older = e;
+}
+
+static gbkintern_entry_t *shard_find(gbkintern_shard_t *shard, uint64_t hash, const uint8_t *data, size_t len) {
+    gbkintern_entry_t *e = shard->buckets[(hash >> 16) & shard->mask];
+
+    while ((e != NULL) && ((e->hash != hash) || (e->gbk_len != len) || (memcmp(e->bytes, data, len) != 0))) {
+        e = e->chain;
+    }
+    return e;
+}
+
+static void shard_evict(gbkintern_shard_t *shard) {
+    gbkintern_entry_t *e = shard->lru.newer;
+    gbkintern_entry_t **pp = &shard->buckets[(e->hash >> 16) & shard->mask];
+
+    while (*pp != e) {
+        pp = &(*pp)->chain;
+    }
+    *pp = e->chain;
+    lru_unlink(e);
+    shard->stats.bytes -= entry_size(e);
+    shard->stats.entries--;
+    shard->stats.evictions++;
+    gbk_pool_free(shard->pool, e);
+}
+
+static void shard_insert(gbkintern_shard_t *shard, uint64_t hash, const uint8_t *data, size_t len,
+                         const uint8_t *utf8, size_t utf8_len) {
+    gbkintern_entry_t *e = NULL;
+    gbkintern_entry_t **bucket = &shard->buckets[(hash >> 16) & shard->mask];
+
+    // Another thread may have added the same string since the lookup.
+    if (shard_find(shard, hash, data, len) != NULL) {
+        return;
+    }
+    e = (gbkintern_entry_t *)gbk_pool_alloc(shard->pool, sizeof(gbkintern_entry_t) + len + utf8_len);
+    if (e == NULL) {
+        return;
+    }
+    e->hash = hash;
+    e->gbk_len = len;
+    e->utf8_len = utf8_len;
+    memcpy(e->bytes, data, len);
+    memcpy(e->bytes + len, utf8, utf8_len);
+    e->chain = *bucket;
+    *bucket = e;
+    lru_push(shard, e);
+    shard->stats.bytes += entry_size(e);
+    shard->stats.entries++;
+    while (shard->stats.bytes > shard->max_bytes) {
+        shard_evict(shard);
+    }
+}
+
+gbkintern_t *gbkintern_create(size_t max_bytes, uint32_t shards) {
+    gbkintern_t *cache = NULL;
+    gbkintern_shard_t *shard = NULL;
+    size_t buckets = 64;
+    uint32_t i = 0, n = 1;
+
+    max_bytes = ((max_bytes != 0) ? max_bytes : GBKINTERN_MAX_BYTES);
+    shards = ((shards != 0) ? shards : GBKINTERN_SHARDS);
+    while (n < shards) {
+        n <<= 1;
+    }
+    while (buckets < max_bytes / n / GBKINTERN_BUCKET_BYTES) {
+        buckets <<= 1;
+    }
+
+    cache = (gbkintern_t *)calloc(1, sizeof(gbkintern_t));
+    if ((cache == NULL) || (posix_memalign((void **)&cache->shards, 64, n * sizeof(gbkintern_shard_t)) != 0)) {
+        LOGE("Failed to malloc [%u] shards!", n);
+        free(cache);
+        return NULL;
+    }
+    memset(cache->shards, 0, n * sizeof(gbkintern_shard_t));
+    for (i = 0; i < n; i++) {
+        shard = &cache->shards[i];
+        pthread_mutex_init(&shard->lock, NULL);
+        shard->lru.newer = &shard->lru;
+        shard->lru.older = &shard->lru;
+        shard->max_bytes = max_bytes / n;
+        shard->mask = buckets - 1;
+        shard->pool = gbk_pool_create();
+        shard->buckets = (gbkintern_entry_t **)calloc(buckets, sizeof(gbkintern_entry_t *));
+        cache->nshards = i + 1;
+        if ((shard->pool == NULL) || (shard->buckets == NULL)) {
+            LOGE("Failed to set up shard [%u]!", i);
+            gbkintern_destroy(cache);
+            return NULL;
+        }
+    }
+    LOGD("Intern cache [%zu] bytes, [%u] shards of [%zu] buckets", max_bytes, n, buckets);
+    return cache;
+}
+
+// The pool of a shard owns its entries, they go with it.
+void gbkintern_destroy(gbkintern_t *cache) {
+    uint32_t i = 0;
+
+    if (cache == NULL) {
+        return;
+    }
+    for (i = 0; i < cache->nshards; i++) {
+        gbk_pool_destroy(cache->shards[i].pool);
+        free(cache->shards[i].buckets);
+        pthread_mutex_destroy(&cache->shards[i].lock);
+    }
+    free(cache->shards);
+    free(cache);
+}
+
+/*
+ * A miss converts outside the lock, straight into out, and only takes the lock again to add
+ * the result. Failed conversions are not cached. The hash is seeded with the table version,
+ * entries converted by another table are never found again and age out of the lru; a result
+ * is not added if the table changed while converting it.
+ */
+ssize_t gbkintern_convert(gbkintern_t *cache, const uint8_t *data, size_t len, uint8_t *out, size_t outlen) {
+    gbkintern_shard_t *shard = NULL;
+    gbkintern_entry_t *e = NULL;
+    uint64_t hash = 0;
+    uint32_t version = 0;
+    ssize_t ret = -1;
+
+    if ((cache == NULL) || (NULL == data) || (NULL == out)) {
+        return gbk2utf8_buf(data, len, out, outlen);
+    }
+    if (len > GBKINTERN_MAX_LEN) {
+        __atomic_fetch_add(&cache->bypassed, 1, __ATOMIC_RELAXED);
+        return gbk2utf8_buf(data, len, out, outlen);
+    }
+    version = gbk2uni_table_version();
+    hash = gbk_xxh64(data, len, version);
+    shard = &cache->shards[hash & (cache->nshards - 1)];
+
+    pthread_mutex_lock(&shard->lock);
+    e = shard_find(shard, hash, data, len);
+    if (e != NULL) {
+        shard->stats.hits++;
+        if (e->utf8_len <= outlen) {
+            memcpy(out, e->bytes + len, e->utf8_len);
+            ret = e->utf8_len;
+        }
+        lru_unlink(e);
+        lru_push(shard, e);
+        pthread_mutex_unlock(&shard->lock);
+        return ret;
+    }
+    shard->stats.misses++;
+    pthread_mutex_unlock(&shard->lock);
+
+    ret = gbk2utf8_buf(data, len, out, outlen);
+    if ((ret >= 0) && (gbk2uni_table_version() == version)) {
+        pthread_mutex_lock(&shard->lock);
+        shard_insert(shard, hash, data, len, out, ret);
+        pthread_mutex_unlock(&shard->lock);
+    }
+    return ret;
+}
+
+void gbkintern_get_stats(gbkintern_t *cache, gbkintern_stats_t *stats) {
+    gbkintern_shard_t *shard = NULL;
+    uint32_t i = 0;
+
+    memset(stats, 0, sizeof(*stats));
+    if (cache != NULL) {
+        stats->bypassed = __atomic_load_n(&cache->bypassed, __ATOMIC_RELAXED);
+    }
+    for (i = 0; (cache != NULL) && (i < cache->nshards); i++) {
+        shard = &cache->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        stats->hits += shard->stats.hits;
+        stats->misses += shard->stats.misses;
+        stats->evictions += shard->stats.evictions;
+        stats->entries += shard->stats.entries;
+        stats->bytes += shard->stats.bytes;
+        pthread_mutex_unlock(&shard->lock);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKINTERN_H__
+#define __GBKINTERN_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bounded in-memory cache of converted short strings, for columns repeating a few values
+ * millions of times: a hit costs a hash and a copy instead of a conversion. The cache is
+ * split into shards by hash, each with its own lock, size class pool and least recently used
+ * list, so threads converting different values rarely meet. Strings longer than
+ * GBKINTERN_MAX_LEN bypass it.
+ */
+#define GBKINTERN_MAX_LEN 256
+#define GBKINTERN_SHARDS 16
+#define GBKINTERN_MAX_BYTES (16 << 20)
+
+typedef struct gbkintern_stats {
+    uint64_t hits;
+    uint64_t misses;    /* converted and added, or failed to convert */
+    uint64_t bypassed;  /* longer than GBKINTERN_MAX_LEN */
+    uint64_t evictions;
+    uint64_t entries;
+    uint64_t bytes;     /* pool blocks of the entries, heads and size class rounding included */
+} gbkintern_stats_t;
+
+typedef struct gbkintern gbkintern_t;
+
+// max_bytes 0 means GBKINTERN_MAX_BYTES, shards 0 GBKINTERN_SHARDS, rounded up to a power of two.
+gbkintern_t *gbkintern_create(size_t max_bytes, uint32_t shards);
+void gbkintern_destroy(gbkintern_t *cache);
+
+// gbk2utf8_buf() through the cache, thread safe. A NULL cache converts directly.
+ssize_t gbkintern_convert(gbkintern_t *cache, const uint8_t *data, size_t len, uint8_t *out, size_t outlen);
+
+// Counters summed over the shards; a snapshot while other threads convert.
+void gbkintern_get_stats(gbkintern_t *cache, gbkintern_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
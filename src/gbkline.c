@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include <sys/uio.h>
+
+#include "gbk2uni.h"
+#include "gbkline.h"
+#include "log.h"
+
+#if defined(__SSE2__) && !defined(GBK2UNI_NO_SIMD)
+#include <emmintrin.h>
+#define GBKLINE_SSE2 1
+#endif
+
+#define GBKLINE_IOV_MAX 64
+#define GBKLINE_SCRATCH_SIZE (64 * 1024)
+
+// Pending output: spans of the input buffer and of the scratch buffer, written with one writev().
+typedef struct gbkline_out {
+    int fd;
+    int cnt;
+    struct iovec iov[GBKLINE_IOV_MAX];
+    uint8_t *scratch;
+    size_t size;
+    size_t used;
+} gbkline_out_t;
+
+/*
+ * Find the end of the line starting at cur, like memchr(cur, '\n'), and tell whether it is pure ascii.
+ * Both come from the same 16 byte loads, so ascii lines need no second pass.
+ */
+static const uint8_t *gbkline_scan(const uint8_t *cur, const uint8_t *end, bool *ascii) {
+    uint32_t high = 0;
+#ifdef GBKLINE_SSE2
+    const __m128i nl = _mm_set1_epi8('\n');
+    __m128i v;
+    uint32_t eol = 0;
+
+    while (cur + 16 <= end) {
+        v = _mm_loadu_si128((const __m128i *)cur);
+        eol = _mm_movemask_epi8(_mm_cmpeq_epi8(v, nl));
+        if (eol != 0) {
+            eol = __builtin_ctz(eol);
+            high |= _mm_movemask_epi8(v) & ((1u << eol) - 1);
+            *ascii = (high == 0);
+            return cur + eol;
+        }
+        high |= _mm_movemask_epi8(v);
+        cur += 16;
+    }
+#endif
+    while ((cur < end) && (*cur != '\n')) {
+        high |= (*cur & 0x80);
+        cur++;
+    }
+    *ascii = (high == 0);
+    return cur;
+}
+
+static int32_t gbkline_flush(gbkline_out_t *out) {
+    struct iovec *iov = out->iov;
+    int cnt = out->cnt;
+    ssize_t wlen = 0;
+
+    while (cnt > 0) {
+        wlen = writev(out->fd, iov, cnt);
+        if (wlen < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOGE("Failed to write output, errno [%d]!", errno);
+            return -1;
+        }
+        while ((cnt > 0) && ((size_t)wlen >= iov->iov_len)) {
+            wlen -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (uint8_t *)iov->iov_base + wlen;
+            iov->iov_len -= wlen;
+        }
+    }
+    out->cnt = 0;
+    out->used = 0;
+    return 0;
+}
+
+static int32_t gbkline_put(gbkline_out_t *out, const uint8_t *data, size_t len) {
+    struct iovec *last = NULL;
+
+    // Adjacent lines of the same kind are contiguous in their buffer and share one iovec.
+    if (out->cnt > 0) {
+        last = &out->iov[out->cnt - 1];
+        if ((uint8_t *)last->iov_base + last->iov_len == data) {
+            last->iov_len += len;
+            return 0;
+        }
+    }
+    if ((out->cnt >= GBKLINE_IOV_MAX) && (gbkline_flush(out) != 0)) {
+        return -1;
+    }
+    out->iov[out->cnt].iov_base = (void *)data;
+    out->iov[out->cnt].iov_len = len;
+    out->cnt++;
+    return 0;
+}
+
+// Returns 1 if the line is not convertible, it is then left to the caller.
+static int32_t gbkline_put_gbk(gbkline_out_t *out, const uint8_t *data, size_t len, gbk2utf8_stats_t *stats) {
+    size_t need = GBK2UTF8_MAX_LEN(len);
+    uint8_t *scratch = NULL;
+    ssize_t o_len = 0;
+
+    if (out->used + need > out->size) {
+        // The queued iovecs may point into scratch, write them out before reusing or moving it.
+        if (gbkline_flush(out) != 0) {
+            return -1;
+        }
+        if (need > out->size) {
+            scratch = (uint8_t *)realloc(out->scratch, need);
+            if (scratch == NULL) {
+                LOGE("Failed to malloc size [%zu]!", need);
+                return -1;
+            }
+            out->scratch = scratch;
+            out->size = need;
+        }
+    }
+
+    o_len = gbk2utf8_buf_stats(data, len, out->scratch + out->used, out->size - out->used, stats);
+    if (o_len < 0) {
+        return 1;
+    }
+    if (gbkline_put(out, out->scratch + out->used, o_len) != 0) {
+        return -1;
+    }
+    out->used += o_len;
+    return 0;
+}
+
+int32_t gbkline_convert(const uint8_t *data, size_t len, int fd, gbkline_stats_t *stats) {
+    int32_t ret = 0;
+    const uint8_t *cur = data;
+    const uint8_t *end = data + len;
+    const uint8_t *eol = NULL;
+    size_t n = 0;
+    bool ascii = false;
+    gbkline_stats_t st;
+    gbkline_out_t out;
+
+    if ((NULL == data) || (fd < 0)) {
+        return -1;
+    }
+
+    memset(&st, 0, sizeof(st));
+    memset(&out, 0, sizeof(out));
+    out.fd = fd;
+    out.size = GBKLINE_SCRATCH_SIZE;
+    out.scratch = (uint8_t *)malloc(out.size);
+    if (out.scratch == NULL) {
+        LOGE("Failed to malloc size [%zu]!", out.size);
+        return -1;
+    }
+
+    while (cur < end) {
+        eol = gbkline_scan(cur, end, &ascii);
+        n = ((eol < end) ? (eol - cur + 1) : (eol - cur));
+        st.lines++;
+
+        /*
+         * utf8 is checked before gbk: real gbk text almost never forms valid utf8
+         * sequences, while utf8 hanzi are often valid gbk byte pairs.
+         */
+        if (ascii) {
+            st.ascii++;
+            ret = gbkline_put(&out, cur, n);
+        } else if (utf8_valid_len(cur, n) == n) {
+            st.utf8++;
+            ret = gbkline_put(&out, cur, n);
+        } else if ((gbk_valid_len(cur, n) == n) && ((ret = gbkline_put_gbk(&out, cur, n, &st.conv)) <= 0)) {
+            st.gbk++;
+        } else {
+            st.bad++;
+            ret = gbkline_put(&out, cur, n);
+        }
+        if (ret != 0) {
+            goto __oops;
+        }
+        cur += n;
+    }
+
+    ret = gbkline_flush(&out);
+    if (stats != NULL) {
+        *stats = st;
+    }
+
+__oops:
+    free(out.scratch);
+    return ret;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKLINE_H__
+#define __GBKLINE_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gbk2uni.h"
+
+/*
+ * Line mode for files mixing gbk and utf8 lines, e.g. merged logs.
+ *
+ * Every line is classified on its own: ascii and utf8 lines are written straight
+ * from the input buffer, gbk lines are converted into a scratch buffer. Lines
+ * that are neither are passed through unchanged and counted in bad.
+ */
+typedef struct gbkline_stats {
+    size_t lines;
+    size_t ascii;
+    size_t utf8;
+    size_t gbk;
+    size_t bad;
+    gbk2utf8_stats_t conv; /* of the gbk lines */
+} gbkline_stats_t;
+
+int32_t gbkline_convert(const uint8_t *data, size_t len, int fd, gbkline_stats_t *stats);
+
+#endif
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include "gbk2uni.h"
+#include "gbkseg.h"
+#include "log.h"
+
+// A utf8 prefix of a word must hold this many multibyte characters, one of them wider than two bytes.
+#define GBKSEG_UTF8_MIN_CHARS 2
+
+typedef struct gbkseg_map {
+    gbkseg_run_t *runs;
+    size_t cap;
+    size_t cnt;
+    uint32_t last;
+} gbkseg_map_t;
+
+const char *gbkseg_kind_name(uint32_t kind) {
+    switch (kind) {
+        case GBKSEG_ASCII:
+            return "ascii";
+        case GBKSEG_UTF8:
+            return "utf8";
+        case GBKSEG_GBK:
+            return "gbk";
+        default:
+            return "invalid";
+    }
+}
+
+static inline size_t utf8_char_len(uint8_t c) {
+    if ((c & 0xE0) == 0xC0) {
+        return 2;
+    } else if ((c & 0xF0) == 0xE0) {
+        return 3;
+    }
+    return 4;
+}
+
+static inline bool is_ascii_letter(uint8_t c) {
+    return (((c | 0x20) >= 'a') && ((c | 0x20) <= 'z'));
+}
+
+// Every pair of the len high bytes at data is a gbk code with a character uni2utf8() takes.
+static bool is_mapped_gbk(const uint8_t *data, size_t len) {
+    uint8_t buf[4];
+    size_t i = 0;
+
+    if ((len % 2) != 0) {
+        return false;
+    }
+    for (i = 0; i < len; i += 2) {
+        if (!is_gbk_lead(data[i]) || !is_gbk_trail(data[i + 1]) ||
+            (uni2utf8(gbk2uni((const char *)(data + i)), buf) < 0)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+ * Any gbk pair of the form C0..DF 80..BF is also a valid two byte utf8 sequence,
+ * whole gbk rows (e.g. D8A1..D8BF) read as Arabic. So a utf8 prefix of a word
+ * needs a second multibyte character and at least one three or four byte one,
+ * hanzi in utf8 are three bytes. A word that is utf8 as a whole is utf8 if it has
+ * a wide character; one of two byte characters only if it is not mapped gbk, or
+ * an ascii letter touches it, as in "caf\xC3\xA9 na\xC3\xAFve": a lone hanzi
+ * between spaces, "x \xCA\xB1 y", stays gbk.
+ */
+static bool is_utf8_run(const uint8_t *data, size_t len, size_t word, bool letter_before) {
+    size_t i = 0, n = 0, chars = 0, high = 0;
+    bool wide = false;
+
+    while (i < len) {
+        if ((data[i] & 0x80) == 0) {
+            i++;
+            continue;
+        }
+        n = utf8_char_len(data[i]);
+        wide |= (n > 2);
+        if ((++chars >= GBKSEG_UTF8_MIN_CHARS) && wide) {
+            return true;
+        }
+        i += n;
+    }
+    if ((len != word) || (len == 0)) {
+        return false;
+    }
+    if (wide) {
+        return true;
+    }
+    // A word is its high bytes and the ascii after them.
+    while ((high < word) && ((data[high] & 0x80) != 0)) {
+        high++;
+    }
+    return (letter_before || ((high < word) && is_ascii_letter(data[high])) || !is_mapped_gbk(data, high));
+}
+
+// Non-ascii bytes and the ascii after them, up to the next ascii to non-ascii edge.
+static size_t word_len(const uint8_t *data, size_t len) {
+    size_t i = 0;
+
+    while ((i < len) && ((data[i] & 0x80) != 0)) {
+        i++;
+    }
+    while ((i < len) && ((data[i] & 0x80) == 0)) {
+        i++;
+    }
+    return i;
+}
+
+/*
+ * One gbk word: double-byte codes followed by the ascii after them. gbk runs are
+ * cut at every ascii to non-ascii edge so utf8 gets a chance again, otherwise
+ * utf8 hanzi after a gbk field would be read as gbk pairs.
+ */
+static size_t gbk_word_len(const uint8_t *data, size_t len) {
+    size_t i = 0;
+
+    while ((i + 1 < len) && is_gbk_lead(data[i]) && is_gbk_trail(data[i + 1])) {
+        i += 2;
+    }
+    if ((i == 0) || ((i < len) && ((data[i] & 0x80) != 0))) {
+        return i;
+    }
+    while ((i < len) && ((data[i] & 0x80) == 0)) {
+        i++;
+    }
+    return i;
+}
+
+static int32_t gbkseg_push(gbkseg_map_t *map, uint32_t kind, size_t off, size_t len, size_t out_off,
+                           size_t out_len) {
+    gbkseg_run_t *last = NULL;
+
+    if ((map->cnt > 0) && (map->last == kind)) {
+        if (map->runs != NULL) {
+            last = &map->runs[map->cnt - 1];
+            last->len += len;
+            last->out_len += out_len;
+        }
+        return 0;
+    }
+    map->last = kind;
+    if (map->runs == NULL) {
+        map->cnt++;
+        return 0;
+    }
+    if (map->cnt >= map->cap) {
+        LOGE("Run map is full, capacity [%zu]!", map->cap);
+        return -1;
+    }
+    last = &map->runs[map->cnt++];
+    last->kind = kind;
+    last->off = off;
+    last->len = len;
+    last->out_off = out_off;
+    last->out_len = out_len;
+    return 0;
+}
+
+ssize_t gbkseg_convert(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, gbkseg_run_t *runs,
+                       size_t *nruns) {
+    size_t i = 0, o = 0;
+    size_t n = 0, u = 0, g = 0, w = 0;
+    ssize_t c = 0;
+    uint32_t kind = GBKSEG_ASCII;
+    gbkseg_map_t map;
+
+    if ((NULL == data) || (NULL == out) || ((runs != NULL) && (nruns == NULL))) {
+        return -1;
+    }
+
+    map.runs = runs;
+    map.cap = ((runs != NULL) ? *nruns : 0);
+    map.cnt = 0;
+    map.last = GBKSEG_ASCII;
+
+    while (i < len) {
+        if ((data[i] & 0x80) == 0) {
+            for (n = i + 1; (n < len) && ((data[n] & 0x80) == 0); n++) {
+            }
+            n -= i;
+            kind = GBKSEG_ASCII;
+        } else {
+            /*
+             * No utf8 character spans an ascii byte, so the utf8 scan stops at the end of the
+             * word; the gbk scan stops there too. Each byte is scanned a bounded number of times.
+             */
+            w = word_len(data + i, len - i);
+            u = utf8_valid_len(data + i, w);
+            if (is_utf8_run(data + i, u, w, ((i > 0) && is_ascii_letter(data[i - 1])))) {
+                n = u;
+                kind = GBKSEG_UTF8;
+            } else if ((g = gbk_word_len(data + i, len - i)) > 0) {
+                n = g;
+                kind = GBKSEG_GBK;
+            } else {
+                n = ((u > 0) ? u : 1);
+                kind = ((u > 0) ? GBKSEG_UTF8 : GBKSEG_INVALID);
+            }
+        }
+
+        c = -1;
+        if (kind == GBKSEG_GBK) {
+            c = gbk2utf8_buf(data + i, n, out + o, outlen - o);
+            if (c < 0) {
+                LOGD("%zu Unmapped gbk run, len [%zu]!", i, n);
+                kind = GBKSEG_INVALID;
+            }
+        }
+        if (c < 0) {
+            if (o + n > outlen) {
+                LOGE("Output buffer is too small [%zu]!", outlen);
+                return -1;
+            }
+            memcpy(out + o, data + i, n);
+            c = n;
+        }
+
+        if (gbkseg_push(&map, kind, i, n, o, c) != 0) {
+            return -1;
+        }
+        i += n;
+        o += c;
+    }
+
+    if (nruns != NULL) {
+        *nruns = map.cnt;
+    }
+    return o;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKSEG_H__
+#define __GBKSEG_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+/*
+ * Segmenting decoder for buffers mixing encodings inside one record, e.g. a utf8
+ * prefix followed by a gbk payload. The buffer is split into maximal runs in one
+ * pass, only gbk runs are converted, everything else is copied as is. Ascii bytes
+ * next to a utf8 or gbk run belong to that run.
+ *
+ * The run map tells where every run went in the output, so callers can hand the
+ * utf8 spans on without validating them again.
+ */
+enum {
+    GBKSEG_ASCII = 0,
+    GBKSEG_UTF8,
+    GBKSEG_GBK,
+    GBKSEG_INVALID, /* neither encoding, or an unmapped gbk code, copied unchanged */
+};
+
+typedef struct gbkseg_run {
+    uint32_t kind;
+    size_t off;     /* offset in the input */
+    size_t len;     /* length in the input */
+    size_t out_off; /* offset in the output */
+    size_t out_len; /* length in the output */
+} gbkseg_run_t;
+
+const char *gbkseg_kind_name(uint32_t kind);
+
+/*
+ * Convert data into out, which needs GBK2UTF8_MAX_LEN(len) bytes in the worst case.
+ * runs may be NULL; otherwise *nruns is its capacity on input and the number of runs on return.
+ * Returns the output length, or -1 if out or runs is too small.
+ */
+ssize_t gbkseg_convert(const uint8_t *data, size_t len, uint8_t *out, size_t outlen, gbkseg_run_t *runs,
+                       size_t *nruns);
+
+#endif
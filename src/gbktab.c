@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "gbk2uni.h"
+#include "gbktab.h"
+#include "log.h"
+
+struct gbktab {
+    void *addr;
+    size_t size;
+    const gbktab_header_t *head;
+    const uint16_t *rows;
+};
+
+gbktab_t *gbktab_open(const char *file) {
+    int fd = -1;
+    struct stat st;
+    void *addr = MAP_FAILED;
+    const gbktab_header_t *head = NULL;
+    gbktab_t *tab = NULL;
+
+    if (file == NULL) {
+        LOGE("Invalid table file name!");
+        return NULL;
+    }
+
+    fd = open(file, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOGE("Failed to open table [%s]", file);
+        goto __oops;
+    }
+
+    if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(gbktab_header_t))) {
+        LOGE("Invalid table size [%s]!", file);
+        goto __oops;
+    }
+
+    /* Read-only shared mapping, every process using the same table shares its pages. */
+    addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        LOGE("Failed to mmap table [%s]!", file);
+        goto __oops;
+    }
+
+    head = (const gbktab_header_t *)addr;
+    if ((memcmp(head->magic, GBKTAB_MAGIC, sizeof(head->magic)) != 0) || (head->bom != GBKTAB_BOM) ||
+        (head->version != GBKTAB_VERSION) || (memchr(head->name, 0, sizeof(head->name)) == NULL)) {
+        LOGE("Invalid table header [%s]!", file);
+        goto __oops;
+    }
+
+    if ((head->count != GBKTAB_SIZE) || (head->header < sizeof(gbktab_header_t)) ||
+        ((size_t)st.st_size < head->header + head->count * sizeof(uint16_t))) {
+        LOGE("Invalid table layout [%s], count [%u]!", file, head->count);
+        goto __oops;
+    }
+
+    if (gbktab_checksum((const uint16_t *)((const uint8_t *)addr + head->header), head->count) != head->checksum) {
+        LOGE("Table checksum mismatch [%s]!", file);
+        goto __oops;
+    }
+
+    tab = (gbktab_t *)malloc(sizeof(gbktab_t));
+    if (tab == NULL) {
+        goto __oops;
+    }
+    tab->addr = addr;
+    tab->size = st.st_size;
+    tab->head = head;
+    tab->rows = (const uint16_t *)((const uint8_t *)addr + head->header);
+    close(fd);
+
+    LOGD("Load table [%s] name [%s] mapped [%u]", file, head->name, head->mapped);
+    return tab;
+
+__oops:
+    if (addr != MAP_FAILED) {
+        munmap(addr, st.st_size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    return NULL;
+}
+
+void gbktab_close(gbktab_t *tab) {
+    if (tab == NULL) {
+        return;
+    }
+    if (gbk2uni_get_table() == tab->rows) {
+        gbk2uni_set_table(NULL);
+    }
+    munmap(tab->addr, tab->size);
+    free(tab);
+}
+
+const char *gbktab_name(const gbktab_t *tab) {
+    return ((tab != NULL) ? tab->head->name : "builtin");
+}
+
+const uint16_t *gbktab_rows(const gbktab_t *tab) {
+    return ((tab != NULL) ? tab->rows : NULL);
+}
+
+int32_t gbktab_use(const gbktab_t *tab) {
+    gbk2uni_set_table_ex(gbktab_rows(tab), ((tab != NULL) ? tab->head->checksum : 0));
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+#ifndef __GBKTAB_H__
+#define __GBKTAB_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Binary mapping table, as written by ucm2tab and mapped read-only by gbktab_open().
+ *
+ * The file is a fixed header followed by a row-compact decode table: one row of
+ * GBKTAB_COLS entries per lead byte 0x81..0xFE, indexed by trail byte 0x40..0xFF.
+ * An entry of 0 means the sequence is unmapped. All fields are in host byte order, a
+ * table written on a host of the other byte order fails the GBKTAB_BOM check and is rejected.
+ */
+
+#define GBKTAB_MAGIC "GBKT"
+#define GBKTAB_VERSION 1
+#define GBKTAB_BOM 0x01020304
+
+#define GBKTAB_LEAD_MIN 0x81
+#define GBKTAB_LEAD_MAX 0xFE
+#define GBKTAB_TRAIL_MIN 0x40
+#define GBKTAB_TRAIL_MAX 0xFF
+#define GBKTAB_ROWS (GBKTAB_LEAD_MAX - GBKTAB_LEAD_MIN + 1)
+#define GBKTAB_COLS (GBKTAB_TRAIL_MAX - GBKTAB_TRAIL_MIN + 1)
+#define GBKTAB_SIZE (GBKTAB_ROWS * GBKTAB_COLS)
+
+typedef struct gbktab_header {
+    char magic[4];     /* GBKTAB_MAGIC */
+    uint32_t bom;      /* GBKTAB_BOM */
+    uint16_t version;  /* GBKTAB_VERSION */
+    uint16_t header;   /* sizeof(gbktab_header_t), entries start here */
+    uint32_t count;    /* number of entries, GBKTAB_SIZE */
+    uint32_t mapped;   /* number of non-zero entries */
+    uint32_t checksum; /* gbktab_checksum() of the entries */
+    char name[40];     /* <code_set_name> of the source .ucm */
+} gbktab_header_t;
+
+typedef struct gbktab gbktab_t;
+
+/* FNV-1a over the table entries, shared by the compiler and the loader. */
+#define GBKTAB_CHECKSUM_SEED 0x811C9DC5
+
+// Continues a checksum over the next count entries, for tables hashed a row at a time.
+static inline uint32_t gbktab_checksum_update(uint32_t hash, const uint16_t *tab, size_t count) {
+    size_t i = 0;
+
+    for (i = 0; i < count; i++) {
+        hash = (hash ^ (tab[i] & 0xFF)) * 0x01000193;
+        hash = (hash ^ (tab[i] >> 8)) * 0x01000193;
+    }
+    return hash;
+}
+
+static inline uint32_t gbktab_checksum(const uint16_t *tab, size_t count) {
+    return gbktab_checksum_update(GBKTAB_CHECKSUM_SEED, tab, count);
+}
+
+gbktab_t *gbktab_open(const char *file);
+void gbktab_close(gbktab_t *tab);
+const char *gbktab_name(const gbktab_t *tab);
+const uint16_t *gbktab_rows(const gbktab_t *tab);
+// Makes tab the table of gbk2uni(), NULL the builtin one; its header checksum is the table version.
+int32_t gbktab_use(const gbktab_t *tab);
+
+#endif
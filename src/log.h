@@ -8,7 +8,14 @@
         fprintf(stderr, "(%s:%d) " FMT "\n", __func__, __LINE__, ##__VA_ARGS__); \
     } while (0)
 
+// LOG_QUIET compiles debug logs out, e.g. for the benchmark build where they would dominate the timing.
+#ifdef LOG_QUIET
+#define LOGD(FMT, ...) \
+    do {               \
+    } while (0)
+#else
 #define LOGD(FMT, ...) LOG(LOG_DEBUG, FMT, ##__VA_ARGS__)
+#endif
 #define LOGW(FMT, ...) LOG(LOG_WARNING, FMT, ##__VA_ARGS__)
 #define LOGE(FMT, ...) LOG(LOG_ERR, FMT, ##__VA_ARGS__)
 
@@ -12,9 +12,61 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "log.h"
 #include "gbk2uni.h"
+#include "gbktab.h"
+#include "gbk2utf16.h"
+#include "gbkline.h"
+#include "gbkseg.h"
+#include "gbkgrep.h"
+#include "gbkidx.h"
+#include "gbkcache.h"
+#include "gbkcsv.h"
+
+/*
+ * --stats output. Phases are wall time; the streaming modes (lines, segment, utf16)
+ * write while converting, their write time is part of convert.
+ */
+typedef struct cli_stats {
+    const char *mode;
+    uint64_t read_ns;
+    uint64_t detect_ns;
+    uint64_t convert_ns;
+    uint64_t write_ns;
+    gbk2utf8_stats_t conv;
+    gbkline_stats_t lines;
+} cli_stats_t;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void print_stats_json(FILE *fp, const cli_stats_t *st, uint32_t in_len) {
+    fprintf(fp, "{\"mode\":\"%s\",\"in_bytes\":%u,", st->mode, in_len);
+    fprintf(fp, "\"ns\":{\"read\":%llu,\"detect\":%llu,\"convert\":%llu,\"write\":%llu},",
+            (unsigned long long)st->read_ns, (unsigned long long)st->detect_ns, (unsigned long long)st->convert_ns,
+            (unsigned long long)st->write_ns);
+    fprintf(fp,
+            "\"gbk\":{\"in_bytes\":%llu,\"out_bytes\":%llu,\"ascii_bytes\":%llu,\"dbcs_chars\":%llu,"
+            "\"unmapped\":%llu,\"rejected\":%llu}",
+            (unsigned long long)st->conv.in_bytes, (unsigned long long)st->conv.out_bytes,
+            (unsigned long long)st->conv.ascii_bytes, (unsigned long long)st->conv.dbcs_chars,
+            (unsigned long long)st->conv.unmapped, (unsigned long long)st->conv.rejected);
+    if (st->lines.lines > 0) {
+        fprintf(fp, ",\"lines\":{\"total\":%zu,\"ascii\":%zu,\"utf8\":%zu,\"gbk\":%zu,\"unknown\":%zu}",
+                st->lines.lines, st->lines.ascii, st->lines.utf8, st->lines.gbk, st->lines.bad);
+    }
+    fprintf(fp, "}\n");
+}
 
 int32_t read_file_to_buff(const char *file, uint8_t **fbuff, uint32_t *pflen) {
     int ret = 0;
@@ -116,52 +168,636 @@ err:
     return ret;
 }
 
+static int32_t gbk2utf16_file(const uint8_t *in_buff, uint32_t in_len, bool big_endian, const char *out_file) {
+    int32_t ret = 0;
+    ssize_t units = 0;
+    uint16_t *out_buff = NULL;
+
+    units = gbk2utf16_len(in_buff, in_len);
+    if (units < 0) {
+        LOGE("Not a gbk or ascii string!");
+        return -1;
+    }
+
+    out_buff = (uint16_t *)malloc(units * sizeof(uint16_t));
+    if (out_buff == NULL) {
+        LOGE("Failed to malloc size [%zd]!", units);
+        return -1;
+    }
+
+    if (gbk2utf16(in_buff, in_len, out_buff, units, big_endian) != units) {
+        LOGE("Failed to decode gbk string!");
+        ret = -1;
+        goto __oops;
+    }
+    LOGD("output buff[%p], units[%zd], %s", out_buff, units, (big_endian ? "utf16be" : "utf16le"));
+
+    if (out_file != NULL) {
+        ret = write_buff_to_file((uint8_t *)out_buff, units * sizeof(uint16_t), out_file);
+    } else if (fwrite(out_buff, sizeof(uint16_t), units, stdout) != (size_t)units) {
+        ret = -1;
+    }
+    if (ret != 0) {
+        LOGE("Failed to write utf16 output!");
+    }
+__oops:
+    free(out_buff);
+    return ret;
+}
+
+static int32_t gbkline_file(const uint8_t *in_buff, uint32_t in_len, const char *out_file, gbkline_stats_t *pst) {
+    int32_t ret = 0;
+    int fd = STDOUT_FILENO;
+    gbkline_stats_t st;
+
+    if (out_file != NULL) {
+        fd = open(out_file, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            LOGE("Failed to open file [%s]", out_file);
+            return -1;
+        }
+    }
+
+    ret = gbkline_convert(in_buff, in_len, fd, &st);
+    if (ret != 0) {
+        LOGE("Failed to convert lines!");
+    } else {
+        LOGD("lines[%zu], ascii[%zu], utf8[%zu], gbk[%zu], unknown[%zu]", st.lines, st.ascii, st.utf8, st.gbk,
+             st.bad);
+        *pst = st;
+    }
+
+    if ((fd != STDOUT_FILENO) && (close(fd) != 0) && (ret == 0)) {
+        ret = -1;
+    }
+    return ret;
+}
+
+static int32_t gbkseg_file(const uint8_t *in_buff, uint32_t in_len, const char *out_file) {
+    int32_t ret = 0;
+    ssize_t out_len = 0;
+    size_t i = 0, nruns = 0;
+    uint8_t *out_buff = NULL;
+    gbkseg_run_t *runs = NULL;
+
+    // A dry run without output sizes the run map.
+    out_buff = (uint8_t *)malloc(GBK2UTF8_MAX_LEN(in_len));
+    if ((out_buff == NULL) || (gbkseg_convert(in_buff, in_len, out_buff, GBK2UTF8_MAX_LEN(in_len), NULL, &nruns) < 0)) {
+        LOGE("Failed to segment input!");
+        ret = -1;
+        goto __oops;
+    }
+    runs = (gbkseg_run_t *)malloc((nruns + 1) * sizeof(gbkseg_run_t));
+    if (runs == NULL) {
+        LOGE("Failed to malloc [%zu] runs!", nruns);
+        ret = -1;
+        goto __oops;
+    }
+    out_len = gbkseg_convert(in_buff, in_len, out_buff, GBK2UTF8_MAX_LEN(in_len), runs, &nruns);
+    if (out_len < 0) {
+        LOGE("Failed to segment input!");
+        ret = -1;
+        goto __oops;
+    }
+
+    for (i = 0; i < nruns; i++) {
+        LOGD("run[%zu] %s in[%zu+%zu] out[%zu+%zu]", i, gbkseg_kind_name(runs[i].kind), runs[i].off, runs[i].len,
+             runs[i].out_off, runs[i].out_len);
+    }
+
+    if (out_file != NULL) {
+        ret = write_buff_to_file(out_buff, out_len, out_file);
+    } else if (fwrite(out_buff, 1, out_len, stdout) != (size_t)out_len) {
+        ret = -1;
+    }
+    if (ret != 0) {
+        LOGE("Failed to write output!");
+    }
+__oops:
+    free(runs);
+    free(out_buff);
+    return ret;
+}
+
+static int32_t gbkgrep_print(void *ctx, const gbkgrep_match_t *match) {
+    return ((fprintf((FILE *)ctx, "%zu %zu\n", match->gbk_off, match->utf8_off) < 0) ? -1 : 0);
+}
+
+// One line per match: the gbk offset, then the utf8 offset.
+static int32_t gbkgrep_file(const uint8_t *in_buff, uint32_t in_len, const char *needle, const char *out_file) {
+    int32_t ret = 0;
+    size_t count = 0;
+    FILE *fp = stdout;
+    gbkgrep_t *grep = NULL;
+
+    grep = gbkgrep_create((const uint8_t *)needle, strlen(needle));
+    if (grep == NULL) {
+        LOGE("Invalid needle [%s]!", needle);
+        return -1;
+    }
+    if (out_file != NULL) {
+        fp = fopen(out_file, "w");
+        if (fp == NULL) {
+            LOGE("Failed to open file [%s]", out_file);
+            ret = -1;
+            goto __oops;
+        }
+    }
+
+    count = gbkgrep_search(grep, in_buff, in_len, gbkgrep_print, fp);
+    LOGD("Found [%zu] matches of [%s]", count, needle);
+
+    if ((fflush(fp) != 0) || ferror(fp)) {
+        LOGE("Failed to write matches!");
+        ret = -1;
+    }
+    if ((fp != stdout) && (fclose(fp) != 0)) {
+        ret = -1;
+    }
+__oops:
+    gbkgrep_destroy(grep);
+    return ret;
+}
+
+/*
+ * --index builds <file>.gbkidx, --range converts the gbk bytes [from, to) through it and builds
+ * it first if it is missing or stale. The file is mapped, not read, so a range only reads the
+ * pages it converts plus at most one index interval before them.
+ */
+static int32_t gbkidx_file(const char *in_file, bool range, uint64_t from, uint64_t to, const char *out_file) {
+    int32_t ret = -1;
+    int fd = -1;
+    struct stat st;
+    void *addr = MAP_FAILED;
+    const uint8_t *data = NULL;
+    size_t len = 0, out_len = 0;
+    ssize_t n = 0;
+    uint8_t *out_buff = NULL;
+    gbkidx_t *idx = NULL;
+    gbkidx_entry_t pos;
+
+    fd = open(in_file, O_RDONLY | O_CLOEXEC);
+    if ((fd < 0) || (fstat(fd, &st) != 0)) {
+        LOGE("Failed to open file [%s]", in_file);
+        goto __oops;
+    }
+    len = st.st_size;
+    if (len > 0) {
+        addr = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+            LOGE("Failed to mmap file [%s]!", in_file);
+            goto __oops;
+        }
+        data = (const uint8_t *)addr;
+    }
+
+    idx = (range ? gbkidx_load(in_file) : NULL);
+    if (idx == NULL) {
+        idx = gbkidx_build(data, len, GBKIDX_INTERVAL, 0);
+        if (idx == NULL) {
+            LOGE("Failed to index [%s]!", in_file);
+            goto __oops;
+        }
+        // A range of a file in a directory we cannot write still converts, from the index in memory.
+        if (gbkidx_save(idx, in_file) != 0) {
+            if (!range) {
+                LOGE("Failed to save the index of [%s]!", in_file);
+                goto __oops;
+            }
+            LOGW("Failed to save the index of [%s], using it unsaved", in_file);
+        }
+    }
+    LOGD("Index [%llu] entries, utf8 [%llu]", (unsigned long long)gbkidx_header(idx)->count,
+         (unsigned long long)gbkidx_header(idx)->utf8_len);
+    if (!range) {
+        ret = 0;
+        goto __oops;
+    }
+
+    to = ((to < len) ? to : len);
+    from = ((from < to) ? from : to);
+    out_len = GBK2UTF8_MAX_LEN(to - from + 1);
+    out_buff = (uint8_t *)malloc(out_len + 1);
+    if (out_buff == NULL) {
+        LOGE("Failed to malloc size [%zu]!", out_len);
+        goto __oops;
+    }
+    n = gbkidx_convert(idx, data, len, from, to, out_buff, out_len, &pos);
+    if (n < 0) {
+        LOGE("Failed to convert range [%llu, %llu)!", (unsigned long long)from, (unsigned long long)to);
+        goto __oops;
+    }
+    LOGD("Range gbk [%llu] utf8 [%llu] len [%zd]", (unsigned long long)pos.gbk_off,
+         (unsigned long long)pos.utf8_off, n);
+
+    if (out_file != NULL) {
+        ret = ((n > 0) ? write_buff_to_file(out_buff, n, out_file) : 0);
+    } else {
+        ret = ((fwrite(out_buff, 1, n, stdout) == (size_t)n) ? 0 : -1);
+    }
+    if (ret != 0) {
+        LOGE("Failed to write output!");
+    }
+__oops:
+    free(out_buff);
+    gbkidx_free(idx);
+    if (addr != MAP_FAILED) {
+        munmap(addr, len);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    return ret;
+}
+
+// Only the --fields columns of delimited records are converted, the rest is copied.
+static int32_t gbkcsv_file(const uint8_t *in_buff, uint32_t in_len, uint8_t delimiter, const char *fields,
+                           const char *out_file, gbk2utf8_stats_t *pst) {
+    int32_t ret = 0;
+    ssize_t out_len = 0;
+    uint8_t *out_buff = NULL;
+    gbkcsv_t *csv = NULL;
+    gbkcsv_stats_t st;
+
+    memset(&st, 0, sizeof(st));
+    csv = gbkcsv_create(delimiter, GBKCSV_QUOTE, fields);
+    out_buff = (uint8_t *)malloc(GBK2UTF8_MAX_LEN(in_len) + 1);
+    if ((csv == NULL) || (out_buff == NULL)) {
+        ret = -1;
+        goto __oops;
+    }
+    out_len = gbkcsv_convert(csv, in_buff, in_len, out_buff, GBK2UTF8_MAX_LEN(in_len), &st);
+    if (out_len < 0) {
+        LOGE("Failed to convert records!");
+        ret = -1;
+        goto __oops;
+    }
+    LOGD("Rows [%llu] fields [%llu] converted [%llu]", (unsigned long long)st.rows, (unsigned long long)st.fields,
+         (unsigned long long)st.converted);
+    pst->in_bytes = in_len;
+    pst->out_bytes = out_len;
+
+    if (out_file != NULL) {
+        ret = write_buff_to_file(out_buff, out_len, out_file);
+    } else if (fwrite(out_buff, 1, out_len, stdout) != (size_t)out_len) {
+        ret = -1;
+    }
+    if (ret != 0) {
+        LOGE("Failed to write output!");
+    }
+__oops:
+    gbkcsv_destroy(csv);
+    free(out_buff);
+    return ret;
+}
+
+// A hit is written like the conversion it stands for, stdout gets the newline printf() adds.
+static int32_t gbkcache_file(gbkcache_t *cache, uint64_t key, uint32_t in_len, const char *out_file) {
+    int fd = STDOUT_FILENO;
+    ssize_t n = 0;
+
+    if (out_file != NULL) {
+        fd = open(out_file, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            LOGE("Failed to open file [%s]", out_file);
+            return -1;
+        }
+    }
+    fflush(stdout);
+    n = gbkcache_get(cache, key, in_len, fd);
+    if ((n >= 0) && (out_file == NULL)) {
+        printf("\n");
+        fflush(stdout);
+    }
+    if ((fd != STDOUT_FILENO) && (close(fd) != 0)) {
+        n = -1;
+    }
+    return ((n >= 0) ? 0 : -1);
+}
+
+// Comma separated filter names of --filter, 0 with a LOGE on an unknown name.
+static uint32_t parse_filters(const char *list) {
+    static const struct {
+        const char *name;
+        uint32_t flag;
+    } names[] = {{"c0", GBK2UTF8_FILTER_C0}, {"crlf", GBK2UTF8_FILTER_CRLF}, {"json", GBK2UTF8_FILTER_JSON}};
+    const char *p = list;
+    size_t n = 0, k = 0;
+    uint32_t filters = 0;
+
+    while (*p != 0) {
+        n = strcspn(p, ",");
+        for (k = 0; k < sizeof(names) / sizeof(names[0]); k++) {
+            if ((strlen(names[k].name) == n) && (strncmp(p, names[k].name, n) == 0)) {
+                filters |= names[k].flag;
+                break;
+            }
+        }
+        if (k == sizeof(names) / sizeof(names[0])) {
+            LOGE("Unknown filter [%.*s]!", (int)n, p);
+            return 0;
+        }
+        p += n + (p[n] == ',');
+    }
+    return filters;
+}
+
 static void usage(const char *exe_name) {
-    printf("Usage: %s <INPUT_FILE> [OUTPUT_FILE]\n", exe_name);
+    printf("Usage: %s [OPTIONS] <INPUT_FILE> [OUTPUT_FILE]\n", exe_name);
+    printf("  -t, --table=FILE    use a mapping table compiled by ucm2tab\n");
+    printf("  -s, --selftest      verify the builtin tables and exit\n");
+    printf("  -e, --encoding=ENC  output encoding: utf8 (default), utf16le, utf16be\n");
+    printf("  -g, --segment       split the input into utf8, gbk and ascii runs, convert the gbk runs\n");
+    printf("  -G, --grep=TEXT     print the gbk and utf8 offsets of every match of the utf8 TEXT\n");
+    printf("  -i, --index         build INPUT_FILE%s for --range\n", GBKIDX_SUFFIX);
+    printf("  -r, --range=FROM,TO convert the gbk bytes [FROM, TO) through the index, building it if needed\n");
+    printf("  -C, --cache=DIR     reuse the output of earlier runs on the same input, '' for ~/.cache/gbk2utf8;\n");
+    printf("                      plain utf8 conversion only\n");
+    printf("  -f, --fields=LIST   convert only these columns of delimited records, like cut -f: 2,5-7,9-\n");
+    printf("  -d, --delimiter=C   field delimiter of --fields, default ',', \\t for tab\n");
+    printf("  -F, --filter=LIST   json, crlf and c0, comma separated: escape for a JSON string, CRLF to LF,\n");
+    printf("                      drop controls but tab and newlines; plain utf8 conversion only\n");
+    printf("  -l, --lines         detect the encoding of every line, for files mixing gbk and utf8\n");
+    printf("  -S, --stats=json    print conversion statistics and phase timings to stderr\n");
 }
+
+static const struct option long_options[] = {
+    {"table", required_argument, NULL, 't'},
+    {"selftest", no_argument, NULL, 's'},
+    {"encoding", required_argument, NULL, 'e'},
+    {"grep", required_argument, NULL, 'G'},
+    {"index", no_argument, NULL, 'i'},
+    {"range", required_argument, NULL, 'r'},
+    {"cache", required_argument, NULL, 'C'},
+    {"fields", required_argument, NULL, 'f'},
+    {"delimiter", required_argument, NULL, 'd'},
+    {"filter", required_argument, NULL, 'F'},
+    {"lines", no_argument, NULL, 'l'},
+    {"segment", no_argument, NULL, 'g'},
+    {"stats", required_argument, NULL, 'S'},
+    {"help", no_argument, NULL, 'h'},
+    {NULL, 0, NULL, 0},
+};
+
 int main(int argc, char *argv[]) {
     int32_t ret = 0;
+    int opt = 0;
     char *in_file = NULL;
     char *out_file = NULL;
+    char *tab_file = NULL;
+    char *encoding = "utf8";
+    char *needle = NULL;
+    char *cache_dir = NULL;
+    char *fields = NULL;
+    uint8_t delimiter = GBKCSV_DELIMITER;
+    uint32_t filters = 0;
+    size_t room = 0;
+    ssize_t n = 0;
+    bool lines = false;
+    bool index = false;
+    bool range = false;
+    unsigned long long from = 0, to = 0;
+    bool segment = false;
+    bool stats = false;
+    uint64_t t0 = 0;
+    cli_stats_t st;
+    gbktab_t *tab = NULL;
+    gbkcache_t *cache = NULL;
+    uint64_t key = 0;
     uint8_t *in_buff = NULL;
     uint8_t *out_buff = NULL;
     uint32_t in_len = 0;
     uint32_t out_len = 0;
 
-    if ((argc < 2) || (NULL == argv[1]) || (strlen(argv[1]) <= 0)) {
+    while ((opt = getopt_long(argc, argv, "t:se:G:ir:C:f:d:F:lgS:h", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 't':
+                tab_file = optarg;
+                break;
+            case 'e':
+                encoding = optarg;
+                break;
+            case 'G':
+                needle = optarg;
+                break;
+            case 'i':
+                index = true;
+                break;
+            case 'r':
+                if ((sscanf(optarg, "%llu,%llu", &from, &to) != 2) || (from > to)) {
+                    LOGE("Invalid range [%s]!", optarg);
+                    ret = 1;
+                    goto __oops;
+                }
+                range = true;
+                break;
+            case 'C':
+                cache_dir = optarg;
+                break;
+            case 'f':
+                fields = optarg;
+                break;
+            case 'd':
+                if (strcmp(optarg, "\\t") == 0) {
+                    delimiter = '\t';
+                } else if (strlen(optarg) == 1) {
+                    delimiter = optarg[0];
+                } else {
+                    LOGE("Invalid delimiter [%s]!", optarg);
+                    ret = 1;
+                    goto __oops;
+                }
+                break;
+            case 'F':
+                filters = parse_filters(optarg);
+                if (filters == 0) {
+                    ret = 1;
+                    goto __oops;
+                }
+                break;
+            case 'l':
+                lines = true;
+                break;
+            case 'g':
+                segment = true;
+                break;
+            case 'S':
+                if (strcmp(optarg, "json") != 0) {
+                    LOGE("Unknown stats format [%s]!", optarg);
+                    ret = 1;
+                    goto __oops;
+                }
+                stats = true;
+                break;
+            case 's':
+                ret = (gbk2uni_selftest() ? 0 : -1);
+                LOGD("Selftest %s!", ((ret == 0) ? "passed" : "failed"));
+                goto __oops;
+            case 'h':
+                // Nothing is allocated yet.
+                usage(argv[0]);
+                return 0;
+            default:
+                ret = 1;
+                goto __oops;
+        }
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.mode = "unknown";
+
+    // The other modes write their own output, the filters and the cache only serve the plain utf8 conversion.
+    if (((filters != 0) || (cache_dir != NULL)) && ((needle != NULL) || index || range || segment || lines ||
+                                                     (fields != NULL) || (strcmp(encoding, "utf8") != 0))) {
+        LOGE("--%s only works with the plain utf8 conversion!", ((filters != 0) ? "filter" : "cache"));
+        ret = 1;
+        goto __oops;
+    }
+
+    if ((optind >= argc) || (NULL == argv[optind]) || (strlen(argv[optind]) <= 0)) {
         LOGE("Invalid input filename!");
         ret = 1;
         goto __oops;
     }
-    in_file = argv[1];
+    in_file = argv[optind];
     LOGD("Input file[%s]", in_file);
 
-    if ((argc > 2) && (NULL != argv[2]) && (strlen(argv[2]) > 0)) {
-        out_file = argv[2];
+    if ((argc > optind + 1) && (NULL != argv[optind + 1]) && (strlen(argv[optind + 1]) > 0)) {
+        out_file = argv[optind + 1];
+    }
+
+    if (tab_file != NULL) {
+        tab = gbktab_open(tab_file);
+        if (tab == NULL) {
+            LOGE("Failed to load table [%s]!", tab_file);
+            ret = -1;
+            goto __oops;
+        }
+        gbktab_use(tab);
+        LOGD("Use table [%s]", gbktab_name(tab));
     }
 
     LOGD("Output file[%s]", ((out_file != NULL) ? out_file : "stdout"));
 
+    if (index || range) {
+        st.mode = (range ? "range" : "index");
+        t0 = now_ns();
+        ret = gbkidx_file(in_file, range, from, to, out_file);
+        st.convert_ns = now_ns() - t0;
+        goto __oops;
+    }
+
+    t0 = now_ns();
     ret = read_file_to_buff(in_file, &in_buff, &in_len);
     if (ret != 0) {
         LOGE("Failed to read file [%s]!", in_file);
         goto __oops;
     }
+    st.read_ns = now_ns() - t0;
     LOGD("Input buff[%p], len[%u]", in_buff, in_len);
+    if (needle != NULL) {
+        st.mode = "grep";
+        t0 = now_ns();
+        ret = gbkgrep_file(in_buff, in_len, needle, out_file);
+        st.convert_ns = now_ns() - t0;
+        goto __oops;
+    }
+
+    if (strncmp(encoding, "utf16", 5) == 0) {
+        st.mode = encoding;
+        t0 = now_ns();
+        ret = gbk2utf16_file(in_buff, in_len, (strcmp(encoding, "utf16be") == 0), out_file);
+        st.convert_ns = now_ns() - t0;
+        goto __oops;
+    } else if (strcmp(encoding, "utf8") != 0) {
+        LOGE("Unknown output encoding [%s]!", encoding);
+        ret = 1;
+        goto __oops;
+    }
+
+    if (segment) {
+        st.mode = "segment";
+        t0 = now_ns();
+        ret = gbkseg_file(in_buff, in_len, out_file);
+        st.convert_ns = now_ns() - t0;
+        goto __oops;
+    }
+
+    if (fields != NULL) {
+        st.mode = "csv";
+        t0 = now_ns();
+        ret = gbkcsv_file(in_buff, in_len, delimiter, fields, out_file, &st.conv);
+        st.convert_ns = now_ns() - t0;
+        goto __oops;
+    }
+
+    if (lines) {
+        st.mode = "lines";
+        t0 = now_ns();
+        ret = gbkline_file(in_buff, in_len, out_file, &st.lines);
+        st.convert_ns = now_ns() - t0;
+        st.conv = st.lines.conv;
+        goto __oops;
+    }
+
+    // A hit costs one hash pass instead of detection and conversion.
+    if (cache_dir != NULL) {
+        cache = gbkcache_open(((cache_dir[0] != 0) ? cache_dir : NULL), 0);
+        if (cache == NULL) {
+            LOGW("Failed to open the cache, convert without it!");
+        }
+    }
+    if (cache != NULL) {
+        t0 = now_ns();
+        key = gbkcache_key(in_buff, in_len, filters);
+        st.detect_ns = now_ns() - t0;
+        t0 = now_ns();
+        if (gbkcache_file(cache, key, in_len, out_file) == 0) {
+            st.mode = "cache";
+            st.write_ns = now_ns() - t0;
+            ret = 0;
+            goto __oops;
+        }
+    }
+
+    t0 = now_ns();
     if (is_valid_gbkns(in_buff, in_len)) {
         LOGD("Is valid gbk string!");
-        out_buff = gbk2utf8(in_buff, in_len);
+        st.mode = "gbk";
     } else if (is_valid_utf8ns(in_buff, in_len)) {
         LOGD("Is valid utf8 string!");
-        out_buff = strdup(in_buff);
+        st.mode = "utf8";
     } else if (is_printns(in_buff, in_len)) {
         LOGD("Is ascii string!");
-        out_buff = strdup(in_buff);
+        st.mode = "ascii";
     } else {
         LOGE("Unknow encode!");
         ret = -1;
         goto __oops;
     }
+    st.detect_ns = now_ns() - t0;
+
+    t0 = now_ns();
+    if (filters != 0) {
+        room = (((filters & GBK2UTF8_FILTER_JSON) != 0) ? GBK2UTF8_FILTER_MAX_LEN((size_t)in_len)
+                                                           : GBK2UTF8_MAX_LEN((size_t)in_len));
+        out_buff = (uint8_t *)malloc(room + 1);
+        if (out_buff != NULL) {
+            n = ((strcmp(st.mode, "gbk") == 0) ? gbk2utf8_buf_filter(in_buff, in_len, out_buff, room, filters, &st.conv)
+                                               : utf8_filter_buf(in_buff, in_len, out_buff, room, filters));
+            if (n < 0) {
+                free(out_buff);
+                out_buff = NULL;
+            } else {
+                out_buff[n] = 0;
+            }
+        }
+    } else if (strcmp(st.mode, "gbk") == 0) {
+        out_buff = gbk2utf8_ex(in_buff, in_len, &st.conv);
+    } else {
+        out_buff = strdup(in_buff);
+    }
+    st.convert_ns = now_ns() - t0;
 
     if (out_buff == NULL) {
         LOGE("Failed to decode gbk string!");
@@ -170,7 +806,11 @@ int main(int argc, char *argv[]) {
     }
     out_len = strlen(out_buff);
     LOGD("output buff[%p], len[%u]", out_buff, out_len);
+    if (cache != NULL) {
+        gbkcache_put(cache, key, in_len, out_buff, out_len);
+    }
 
+    t0 = now_ns();
     if (out_file != NULL) {
         LOGD("Write buff to file [%s]!", out_file);
         ret = write_buff_to_file(out_buff, out_len, out_file);
@@ -181,12 +821,16 @@ int main(int argc, char *argv[]) {
     } else {
         LOGD("Write buff to stdout:");
         printf("%s\n", out_buff);
+        fflush(stdout);
     }
+    st.write_ns = now_ns() - t0;
 
     ret = 0;
 __oops:
     if (ret > 0) {
         usage(argv[0]);
+    } else if (stats) {
+        print_stats_json(stderr, &st, in_len);
     }
 
     if (out_buff != NULL) {
@@ -197,5 +841,11 @@ __oops:
         free(in_buff);
     }
 
+    if (tab != NULL) {
+        gbktab_close(tab);
+    }
+
+    gbkcache_close(cache);
+
     return ret;
 }
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020 Louis Suen
+ * Licensed under the MIT License. See the LICENSE file for the full text.
+ */
+
+// Compile an ICU .ucm mapping file into the binary table format of gbktab.h.
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gbktab.h"
+#include "log.h"
+
+#define UCM_LINE_MAX 512
+
+/*
+ * Precision indicators of a .ucm mapping line:
+ *   |0 roundtrip, |1 fallback from Unicode, |2 sub-char, |3 fallback to Unicode, |4 one-way from Unicode
+ * Only |0 and |3 describe the decode direction, a roundtrip wins over a reverse fallback.
+ */
+#define UCM_PREC_ROUNDTRIP 0
+#define UCM_PREC_REVERSE 3
+
+static int32_t parse_bytes(const char *str, uint8_t *bytes, int32_t max) {
+    int32_t cnt = 0;
+    unsigned int val = 0;
+
+    while (*str == '\\') {
+        if ((str[1] != 'x') || (sscanf(str + 2, "%2x", &val) != 1)) {
+            return -1;
+        }
+        if (cnt >= max) {
+            return -1;
+        }
+        bytes[cnt++] = (uint8_t)val;
+        str += 4;
+    }
+    return cnt;
+}
+
+static void parse_name(const char *line, char *name, size_t size) {
+    const char *beg = strchr(line, '"');
+    const char *end = NULL;
+    size_t len = 0;
+
+    if ((beg == NULL) || ((end = strchr(beg + 1, '"')) == NULL)) {
+        return;
+    }
+    len = end - beg - 1;
+    if (len >= size) {
+        len = size - 1;
+    }
+    memcpy(name, beg + 1, len);
+    name[len] = 0;
+}
+
+static int32_t compile_ucm(FILE *fp, uint16_t *tab, uint8_t *prec, char *name, size_t size) {
+    char line[UCM_LINE_MAX] = {0};
+    char *ptr = NULL;
+    unsigned int uni = 0;
+    int32_t pos = 0, cnt = 0, lineno = 0;
+    uint8_t bytes[4] = {0};
+    uint32_t idx = 0;
+    int32_t fb = 0;
+    bool charmap = false;
+
+    while (fgets(line, sizeof(line), fp) != NULL) {
+        lineno++;
+        if (strncmp(line, "<code_set_name>", 15) == 0) {
+            parse_name(line, name, size);
+            continue;
+        }
+        if (strncmp(line, "CHARMAP", 7) == 0) {
+            charmap = true;
+            continue;
+        }
+        if (strncmp(line, "END CHARMAP", 11) == 0) {
+            charmap = false;
+            continue;
+        }
+        if (!charmap || (strncmp(line, "<U", 2) != 0)) {
+            continue;
+        }
+
+        if (sscanf(line, "<U%x> %n", &uni, &pos) != 1) {
+            LOGE("Invalid mapping at line %d!", lineno);
+            return -1;
+        }
+        ptr = line + pos;
+        cnt = parse_bytes(ptr, bytes, sizeof(bytes));
+        if (cnt < 0) {
+            LOGE("Invalid byte sequence at line %d!", lineno);
+            return -1;
+        }
+        ptr = strchr(ptr, '|');
+        fb = ((ptr != NULL) ? atoi(ptr + 1) : UCM_PREC_ROUNDTRIP);
+
+        // Only double-byte BMP mappings fit the table, ASCII and 4-byte GB18030 codes are handled elsewhere.
+        if ((cnt != 2) || (uni > 0xFFFF) || ((fb != UCM_PREC_ROUNDTRIP) && (fb != UCM_PREC_REVERSE))) {
+            continue;
+        }
+        if ((bytes[0] < GBKTAB_LEAD_MIN) || (bytes[0] > GBKTAB_LEAD_MAX) || (bytes[1] < GBKTAB_TRAIL_MIN)) {
+            LOGW("Skip out of range code 0x%02X%02X at line %d", bytes[0], bytes[1], lineno);
+            continue;
+        }
+
+        idx = (bytes[0] - GBKTAB_LEAD_MIN) * GBKTAB_COLS + (bytes[1] - GBKTAB_TRAIL_MIN);
+        if ((tab[idx] != 0) && (prec[idx] == UCM_PREC_ROUNDTRIP)) {
+            continue;
+        }
+        tab[idx] = (uint16_t)uni;
+        prec[idx] = (uint8_t)fb;
+    }
+    return 0;
+}
+
+static void usage(const char *exe_name) {
+    printf("Usage: %s <UCM_FILE> <TABLE_FILE>\n", exe_name);
+}
+
+int main(int argc, char *argv[]) {
+    int32_t ret = 0;
+    FILE *in = NULL;
+    FILE *out = NULL;
+    uint16_t *tab = NULL;
+    uint8_t *prec = NULL;
+    uint32_t i = 0;
+    gbktab_header_t head;
+
+    if (argc != 3) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    memset(&head, 0, sizeof(head));
+    memcpy(head.magic, GBKTAB_MAGIC, sizeof(head.magic));
+    head.bom = GBKTAB_BOM;
+    head.version = GBKTAB_VERSION;
+    head.header = sizeof(head);
+    head.count = GBKTAB_SIZE;
+
+    tab = (uint16_t *)calloc(GBKTAB_SIZE, sizeof(uint16_t));
+    prec = (uint8_t *)calloc(GBKTAB_SIZE, sizeof(uint8_t));
+    if ((tab == NULL) || (prec == NULL)) {
+        LOGE("Failed to malloc table!");
+        ret = -1;
+        goto __oops;
+    }
+
+    in = fopen(argv[1], "r");
+    if (in == NULL) {
+        LOGE("Failed to open file [%s]", argv[1]);
+        ret = -1;
+        goto __oops;
+    }
+
+    if (compile_ucm(in, tab, prec, head.name, sizeof(head.name)) != 0) {
+        LOGE("Failed to compile [%s]!", argv[1]);
+        ret = -1;
+        goto __oops;
+    }
+
+    for (i = 0; i < GBKTAB_SIZE; i++) {
+        head.mapped += (tab[i] != 0);
+    }
+    head.checksum = gbktab_checksum(tab, GBKTAB_SIZE);
+
+    out = fopen(argv[2], "wb");
+    if (out == NULL) {
+        LOGE("Failed to open file [%s]", argv[2]);
+        ret = -1;
+        goto __oops;
+    }
+    if ((fwrite(&head, sizeof(head), 1, out) != 1) || (fwrite(tab, sizeof(uint16_t), GBKTAB_SIZE, out) != GBKTAB_SIZE)) {
+        LOGE("Failed to write table [%s]!", argv[2]);
+        ret = -1;
+        goto __oops;
+    }
+
+    LOGD("Compile [%s] name [%s] mapped [%u] checksum [0x%08X] to [%s]", argv[1], head.name, head.mapped,
+         head.checksum, argv[2]);
+    ret = 0;
+__oops:
+    if (out != NULL) {
+        if ((fclose(out) != 0) && (ret == 0)) {
+            ret = -1;
+        }
+        if (ret != 0) {
+            remove(argv[2]);
+        }
+    }
+    if (in != NULL) {
+        fclose(in);
+    }
+    free(prec);
+    free(tab);
+    return ret;
+}